@@ -6,6 +6,23 @@ dnl Function to detect if libvsmbr dependencies are available
 AC_DEFUN([AX_LIBVSMBR_CHECK_LOCAL],
   [dnl Check for internationalization functions in libvsmbr/libvsmbr_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Headers and functions used to export partitions in libvsmbr/libvsmbr_file_descriptor.c
+  AC_CHECK_HEADERS([errno.h fcntl.h sys/sendfile.h sys/stat.h unistd.h])
+
+  AC_CHECK_FUNCS([copy_file_range fallocate ftruncate pwrite sendfile])
+
+  dnl Headers and functions used to measure the export throughput in vsmbrtools/export_handle.c,
+  dnl the time blocked in IO in libvsmbr/libvsmbr_statistics.c and the performance in tests/vsmbr_bench.c
+  AC_CHECK_HEADERS([sys/time.h time.h])
+
+  AC_CHECK_FUNCS([clock_gettime gettimeofday])
+
+  dnl Functions used to inject latency in tests/vsmbr_test_latency_io_handle.c
+  AC_CHECK_FUNCS([nanosleep])
+
+  dnl Functions used to read file objects without the GIL in pyvsmbr/pyvsmbr_file_object_io_handle.c
+  AC_CHECK_FUNCS([pread])
 ])
 
 dnl Function to check if DLL support is needed
@@ -0,0 +1,1698 @@
+/*
+ * Block cache IO handle functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsmbr_block_cache_io_handle.h"
+#include "libvsmbr_definitions.h"
+#include "libvsmbr_digest.h"
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_unused.h"
+
+#include "vsmbr_block_cache.h"
+
+const uint8_t vsmbr_block_cache_signature[ 8 ] = {
+	'V', 'S', 'M', 'B', 'R', 'B', 'C', 'F' };
+
+/* Retrieves the index of the set that contains the entry of a block
+ */
+static uint32_t libvsmbr_block_cache_io_handle_get_set_index(
+                 libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+                 off64_t block_offset )
+{
+	uint64_t hash_value = 0;
+
+	hash_value  = (uint64_t) block_offset / block_cache_io_handle->block_size;
+	hash_value *= 0x9e3779b97f4a7c15ULL;
+	hash_value ^= block_cache_io_handle->image_identifier;
+	hash_value ^= hash_value >> 33;
+	hash_value *= 0xff51afd7ed558ccdULL;
+	hash_value ^= hash_value >> 33;
+
+	return( (uint32_t) ( hash_value % block_cache_io_handle->number_of_sets ) );
+}
+
+/* Creates a block cache IO handle
+ * Make sure the value block_cache_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_block_cache_io_handle_initialize(
+     libvsmbr_block_cache_io_handle_t **block_cache_io_handle,
+     libbfio_handle_t *base_file_io_handle,
+     libbfio_handle_t *cache_file_io_handle,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_block_cache_io_handle_initialize";
+
+	if( block_cache_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block cache IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_size < LIBVSMBR_BLOCK_CACHE_MINIMUM_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid maximum cache size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	*block_cache_io_handle = memory_allocate_structure(
+	                          libvsmbr_block_cache_io_handle_t );
+
+	if( *block_cache_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block cache IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *block_cache_io_handle,
+	     0,
+	     sizeof( libvsmbr_block_cache_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block cache IO handle.",
+		 function );
+
+		memory_free(
+		 *block_cache_io_handle );
+
+		*block_cache_io_handle = NULL;
+
+		return( -1 );
+	}
+	( *block_cache_io_handle )->base_file_io_handle  = base_file_io_handle;
+	( *block_cache_io_handle )->cache_file_io_handle = cache_file_io_handle;
+	( *block_cache_io_handle )->maximum_cache_size   = maximum_cache_size;
+	( *block_cache_io_handle )->block_size           = LIBVSMBR_BLOCK_CACHE_BLOCK_SIZE;
+	( *block_cache_io_handle )->number_of_ways       = LIBVSMBR_BLOCK_CACHE_NUMBER_OF_WAYS;
+	( *block_cache_io_handle )->block_offset         = -1;
+
+	return( 1 );
+}
+
+/* Creates a block cache handle
+ * Reads are served from the cache file for blocks that were read before,
+ * possibly in an earlier session, and from the base file IO handle otherwise
+ * The handle does not take over management of the base and cache file IO handles
+ * Make sure the value handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_block_cache_initialize(
+     libbfio_handle_t **handle,
+     libbfio_handle_t *base_file_io_handle,
+     libbfio_handle_t *cache_file_io_handle,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_block_cache_io_handle_t *block_cache_io_handle = NULL;
+	static char *function                                   = "libvsmbr_block_cache_initialize";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_block_cache_io_handle_initialize(
+	     &block_cache_io_handle,
+	     base_file_io_handle,
+	     cache_file_io_handle,
+	     maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block cache IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     handle,
+	     (intptr_t *) block_cache_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libvsmbr_block_cache_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libvsmbr_block_cache_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libvsmbr_block_cache_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libvsmbr_block_cache_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libvsmbr_block_cache_io_handle_read,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libvsmbr_block_cache_io_handle_write,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libvsmbr_block_cache_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libvsmbr_block_cache_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libvsmbr_block_cache_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libvsmbr_block_cache_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( block_cache_io_handle != NULL )
+	{
+		libvsmbr_block_cache_io_handle_free(
+		 &block_cache_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a block cache IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_block_cache_io_handle_free(
+     libvsmbr_block_cache_io_handle_t **block_cache_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_block_cache_io_handle_free";
+	int result            = 1;
+
+	if( block_cache_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache_io_handle != NULL )
+	{
+		if( ( *block_cache_io_handle )->is_open != 0 )
+		{
+			if( libvsmbr_block_cache_io_handle_close(
+			     *block_cache_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close block cache IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *block_cache_io_handle );
+
+		*block_cache_io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the block cache IO handle
+ * This is not supported since the cache file would no longer be shared
+ * Returns -1 on error
+ */
+int libvsmbr_block_cache_io_handle_clone(
+     libvsmbr_block_cache_io_handle_t **destination_block_cache_io_handle,
+     libvsmbr_block_cache_io_handle_t *source_block_cache_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_block_cache_io_handle_clone";
+
+	LIBVSMBR_UNREFERENCED_PARAMETER( destination_block_cache_io_handle )
+	LIBVSMBR_UNREFERENCED_PARAMETER( source_block_cache_io_handle )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: cloning a block cache IO handle is not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Reads the image identifier
+ * The image identifier is the FNV-1a 64-bit digest of the size of the base
+ * and its first sector, which contains the disk identity and partition table,
+ * so that the same image is recognized when it is opened from a different path
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_block_cache_io_handle_read_image_identifier(
+     libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t digest[ LIBVSMBR_DIGEST_FNV1A_64_SIZE ];
+	uint8_t identifier_data[ 8 + 512 ];
+
+	static char *function = "libvsmbr_block_cache_io_handle_read_image_identifier";
+	size_t read_size      = 512;
+	ssize_t read_count    = 0;
+
+	if( block_cache_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     identifier_data,
+	     0,
+	     8 + 512 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear identifier data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 identifier_data,
+	 block_cache_io_handle->size );
+
+	if( (size64_t) read_size > block_cache_io_handle->size )
+	{
+		read_size = (size_t) block_cache_io_handle->size;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              block_cache_io_handle->base_file_io_handle,
+	              &( identifier_data[ 8 ] ),
+	              read_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read first sector from base.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_digest_calculate(
+	     LIBVSMBR_DIGEST_TYPE_FNV1A_64,
+	     identifier_data,
+	     8 + 512,
+	     digest,
+	     LIBVSMBR_DIGEST_FNV1A_64_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate image identifier.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 digest,
+	 block_cache_io_handle->image_identifier );
+
+	return( 1 );
+}
+
+/* Reads the index from the cache file
+ * Returns 1 if successful, 0 if the cache file does not contain an index
+ * with the same layout or -1 on error
+ */
+int libvsmbr_block_cache_io_handle_read_index(
+     libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+     libcerror_error_t **error )
+{
+	vsmbr_block_cache_file_header_t file_header;
+
+	static char *function     = "libvsmbr_block_cache_io_handle_read_index";
+	size_t index_data_offset  = 0;
+	ssize_t read_count        = 0;
+	uint64_t data_offset      = 0;
+	uint64_t sequence_number  = 0;
+	uint32_t block_size       = 0;
+	uint32_t format_version   = 0;
+	uint32_t number_of_sets   = 0;
+	uint32_t number_of_ways   = 0;
+
+	if( block_cache_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_cache_io_handle->index_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid block cache IO handle - missing index data.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              block_cache_io_handle->cache_file_io_handle,
+	              (uint8_t *) &file_header,
+	              sizeof( vsmbr_block_cache_file_header_t ),
+	              0,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header data at offset: 0 (0x00000000).",
+		 function );
+
+		return( -1 );
+	}
+	/* A new or truncated cache file is initialized by the caller
+	 */
+	if( read_count != (ssize_t) sizeof( vsmbr_block_cache_file_header_t ) )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     file_header.signature,
+	     vsmbr_block_cache_signature,
+	     8 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.block_size,
+	 block_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.number_of_sets,
+	 number_of_sets );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.number_of_ways,
+	 number_of_ways );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header.data_offset,
+	 data_offset );
+
+	/* A cache file with a different layout is reinitialized, since
+	 * the blocks it contains can no longer be located
+	 */
+	if( ( format_version != 1 )
+	 || ( (size_t) block_size != block_cache_io_handle->block_size )
+	 || ( number_of_sets != block_cache_io_handle->number_of_sets )
+	 || ( number_of_ways != block_cache_io_handle->number_of_ways )
+	 || ( (off64_t) data_offset != block_cache_io_handle->data_offset ) )
+	{
+		return( 0 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              block_cache_io_handle->cache_file_io_handle,
+	              block_cache_io_handle->index_data,
+	              block_cache_io_handle->index_data_size,
+	              LIBVSMBR_BLOCK_CACHE_INDEX_OFFSET,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index data.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_count != (ssize_t) block_cache_io_handle->index_data_size )
+	{
+		return( 0 );
+	}
+	block_cache_io_handle->next_sequence_number = 1;
+
+	for( index_data_offset = 0;
+	     index_data_offset < block_cache_io_handle->index_data_size;
+	     index_data_offset += sizeof( vsmbr_block_cache_entry_t ) )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (vsmbr_block_cache_entry_t *) &( block_cache_io_handle->index_data[ index_data_offset ] ) )->sequence_number,
+		 sequence_number );
+
+		if( sequence_number >= block_cache_io_handle->next_sequence_number )
+		{
+			block_cache_io_handle->next_sequence_number = sequence_number + 1;
+		}
+	}
+	return( 1 );
+}
+
+/* Writes the index to the cache file
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_block_cache_io_handle_write_index(
+     libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+     uint8_t write_file_header,
+     libcerror_error_t **error )
+{
+	uint8_t file_header_data[ LIBVSMBR_BLOCK_CACHE_INDEX_OFFSET ];
+
+	vsmbr_block_cache_file_header_t *file_header = NULL;
+	static char *function                        = "libvsmbr_block_cache_io_handle_write_index";
+	ssize_t write_count                          = 0;
+
+	if( block_cache_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_cache_io_handle->index_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid block cache IO handle - missing index data.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_file_header != 0 )
+	{
+		if( memory_set(
+		     file_header_data,
+		     0,
+		     LIBVSMBR_BLOCK_CACHE_INDEX_OFFSET ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear file header data.",
+			 function );
+
+			return( -1 );
+		}
+		file_header = (vsmbr_block_cache_file_header_t *) file_header_data;
+
+		if( memory_copy(
+		     file_header->signature,
+		     vsmbr_block_cache_signature,
+		     8 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy signature.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 file_header->format_version,
+		 1 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 file_header->block_size,
+		 (uint32_t) block_cache_io_handle->block_size );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 file_header->number_of_sets,
+		 block_cache_io_handle->number_of_sets );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 file_header->number_of_ways,
+		 block_cache_io_handle->number_of_ways );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 file_header->data_offset,
+		 (uint64_t) block_cache_io_handle->data_offset );
+
+		write_count = libbfio_handle_write_buffer_at_offset(
+		               block_cache_io_handle->cache_file_io_handle,
+		               file_header_data,
+		               LIBVSMBR_BLOCK_CACHE_INDEX_OFFSET,
+		               0,
+		               error );
+
+		if( write_count != (ssize_t) LIBVSMBR_BLOCK_CACHE_INDEX_OFFSET )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write file header.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               block_cache_io_handle->cache_file_io_handle,
+	               block_cache_io_handle->index_data,
+	               block_cache_io_handle->index_data_size,
+	               LIBVSMBR_BLOCK_CACHE_INDEX_OFFSET,
+	               error );
+
+	if( write_count != (ssize_t) block_cache_io_handle->index_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index data.",
+		 function );
+
+		return( -1 );
+	}
+	block_cache_io_handle->index_is_dirty = 0;
+
+	return( 1 );
+}
+
+/* Opens the block cache IO handle
+ * The cache file IO handle is opened if it is not open, a cache file
+ * that does not contain an index with the layout that corresponds to
+ * the maximum cache size is reinitialized
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_block_cache_io_handle_open(
+     libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function      = "libvsmbr_block_cache_io_handle_open";
+	uint64_t number_of_entries = 0;
+	int file_io_handle_is_open = 0;
+	int result                 = 0;
+
+	if( block_cache_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_cache_io_handle->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block cache IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	 || ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     block_cache_io_handle->base_file_io_handle,
+	     &( block_cache_io_handle->size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve base file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_block_cache_io_handle_read_image_identifier(
+	     block_cache_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read image identifier.",
+		 function );
+
+		goto on_error;
+	}
+	/* The cache file consists of the file header, an index entry and a block
+	 * per entry and the padding that aligns the block data
+	 */
+	number_of_entries = ( block_cache_io_handle->maximum_cache_size - LIBVSMBR_BLOCK_CACHE_INDEX_OFFSET - LIBVSMBR_BLOCK_CACHE_DATA_ALIGNMENT )
+	                  / ( block_cache_io_handle->block_size + sizeof( vsmbr_block_cache_entry_t ) );
+
+	if( ( number_of_entries / block_cache_io_handle->number_of_ways ) > (uint64_t) UINT32_MAX )
+	{
+		number_of_entries = (uint64_t) UINT32_MAX * block_cache_io_handle->number_of_ways;
+	}
+	block_cache_io_handle->number_of_sets = (uint32_t) ( number_of_entries / block_cache_io_handle->number_of_ways );
+
+	if( block_cache_io_handle->number_of_sets == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of sets value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_entries = (uint64_t) block_cache_io_handle->number_of_sets * block_cache_io_handle->number_of_ways;
+
+	if( number_of_entries > ( (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( vsmbr_block_cache_entry_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid index data size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	block_cache_io_handle->index_data_size = (size_t) number_of_entries * sizeof( vsmbr_block_cache_entry_t );
+
+	block_cache_io_handle->data_offset = (off64_t) ( LIBVSMBR_BLOCK_CACHE_INDEX_OFFSET + block_cache_io_handle->index_data_size );
+
+	if( ( block_cache_io_handle->data_offset % LIBVSMBR_BLOCK_CACHE_DATA_ALIGNMENT ) != 0 )
+	{
+		block_cache_io_handle->data_offset += LIBVSMBR_BLOCK_CACHE_DATA_ALIGNMENT
+		                                    - ( block_cache_io_handle->data_offset % LIBVSMBR_BLOCK_CACHE_DATA_ALIGNMENT );
+	}
+	block_cache_io_handle->index_data = (uint8_t *) memory_allocate(
+	                                                 sizeof( uint8_t ) * block_cache_io_handle->index_data_size );
+
+	if( block_cache_io_handle->index_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index data.",
+		 function );
+
+		goto on_error;
+	}
+	block_cache_io_handle->block_data = (uint8_t *) memory_allocate(
+	                                                 sizeof( uint8_t ) * block_cache_io_handle->block_size );
+
+	if( block_cache_io_handle->block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block data.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          block_cache_io_handle->cache_file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if cache file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     block_cache_io_handle->cache_file_io_handle,
+		     LIBBFIO_OPEN_READ_WRITE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open cache file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		block_cache_io_handle->cache_file_io_handle_opened_in_library = 1;
+	}
+	result = libvsmbr_block_cache_io_handle_read_index(
+	          block_cache_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( memory_set(
+		     block_cache_io_handle->index_data,
+		     0,
+		     block_cache_io_handle->index_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear index data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libvsmbr_block_cache_io_handle_write_index(
+		     block_cache_io_handle,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to initialize cache file.",
+			 function );
+
+			goto on_error;
+		}
+		block_cache_io_handle->next_sequence_number = 1;
+	}
+	block_cache_io_handle->index_is_dirty   = 0;
+	block_cache_io_handle->block_offset     = -1;
+	block_cache_io_handle->current_offset   = 0;
+	block_cache_io_handle->number_of_hits   = 0;
+	block_cache_io_handle->number_of_misses = 0;
+	block_cache_io_handle->is_open          = 1;
+
+	return( 1 );
+
+on_error:
+	if( block_cache_io_handle->cache_file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 block_cache_io_handle->cache_file_io_handle,
+		 NULL );
+
+		block_cache_io_handle->cache_file_io_handle_opened_in_library = 0;
+	}
+	if( block_cache_io_handle->block_data != NULL )
+	{
+		memory_free(
+		 block_cache_io_handle->block_data );
+
+		block_cache_io_handle->block_data = NULL;
+	}
+	if( block_cache_io_handle->index_data != NULL )
+	{
+		memory_free(
+		 block_cache_io_handle->index_data );
+
+		block_cache_io_handle->index_data = NULL;
+	}
+	block_cache_io_handle->index_data_size = 0;
+
+	return( -1 );
+}
+
+/* Closes the block cache IO handle
+ * The sequence numbers of the blocks that were read from the cache file
+ * are written so that the least recently used order persists
+ * Returns 0 if successful or -1 on error
+ */
+int libvsmbr_block_cache_io_handle_close(
+     libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_block_cache_io_handle_close";
+	int result            = 0;
+
+	if( block_cache_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_cache_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid block cache IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_cache_io_handle->index_is_dirty != 0 )
+	{
+		if( libvsmbr_block_cache_io_handle_write_index(
+		     block_cache_io_handle,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write index.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( block_cache_io_handle->cache_file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     block_cache_io_handle->cache_file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close cache file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		block_cache_io_handle->cache_file_io_handle_opened_in_library = 0;
+	}
+	if( block_cache_io_handle->block_data != NULL )
+	{
+		memory_free(
+		 block_cache_io_handle->block_data );
+
+		block_cache_io_handle->block_data = NULL;
+	}
+	if( block_cache_io_handle->index_data != NULL )
+	{
+		memory_free(
+		 block_cache_io_handle->index_data );
+
+		block_cache_io_handle->index_data = NULL;
+	}
+	block_cache_io_handle->index_data_size = 0;
+	block_cache_io_handle->block_offset    = -1;
+	block_cache_io_handle->is_open         = 0;
+
+	return( result );
+}
+
+/* Reads a block into the block data
+ * The block is read from the cache file if the set of the block contains
+ * an entry of the block with a matching checksum, otherwise it is read from
+ * the base file IO handle and stored in the least recently used entry of the set
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_block_cache_io_handle_read_block(
+     libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+     off64_t block_offset,
+     libcerror_error_t **error )
+{
+	uint8_t checksum[ LIBVSMBR_DIGEST_FNV1A_64_SIZE ];
+
+	vsmbr_block_cache_entry_t *cache_entry = NULL;
+	static char *function                  = "libvsmbr_block_cache_io_handle_read_block";
+	size_t read_size                       = 0;
+	ssize_t read_count                     = 0;
+	ssize_t write_count                    = 0;
+	uint64_t entry_block_offset            = 0;
+	uint64_t entry_image_identifier        = 0;
+	uint64_t entry_index                   = 0;
+	uint64_t first_entry_index             = 0;
+	uint64_t least_recently_used_sequence  = 0;
+	uint64_t replacement_entry_index       = 0;
+	uint64_t sequence_number               = 0;
+	uint32_t way_index                     = 0;
+	int found_entry                        = 0;
+
+	if( block_cache_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_cache_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid block cache IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_offset < 0 )
+	 || ( (size64_t) block_offset >= block_cache_io_handle->size )
+	 || ( ( block_offset % block_cache_io_handle->block_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_offset == block_cache_io_handle->block_offset )
+	{
+		return( 1 );
+	}
+	block_cache_io_handle->block_offset = -1;
+
+	first_entry_index = (uint64_t) libvsmbr_block_cache_io_handle_get_set_index(
+	                                block_cache_io_handle,
+	                                block_offset )
+	                  * block_cache_io_handle->number_of_ways;
+
+	replacement_entry_index = first_entry_index;
+
+	for( way_index = 0;
+	     way_index < block_cache_io_handle->number_of_ways;
+	     way_index++ )
+	{
+		entry_index = first_entry_index + way_index;
+		cache_entry = (vsmbr_block_cache_entry_t *) &( block_cache_io_handle->index_data[ entry_index * sizeof( vsmbr_block_cache_entry_t ) ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 cache_entry->sequence_number,
+		 sequence_number );
+
+		if( sequence_number != 0 )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 cache_entry->image_identifier,
+			 entry_image_identifier );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 cache_entry->block_offset,
+			 entry_block_offset );
+
+			if( ( entry_image_identifier == block_cache_io_handle->image_identifier )
+			 && ( entry_block_offset == (uint64_t) block_offset ) )
+			{
+				found_entry = 1;
+
+				break;
+			}
+		}
+		if( ( way_index == 0 )
+		 || ( sequence_number < least_recently_used_sequence ) )
+		{
+			least_recently_used_sequence = sequence_number;
+			replacement_entry_index      = entry_index;
+		}
+	}
+	if( found_entry != 0 )
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              block_cache_io_handle->cache_file_io_handle,
+		              block_cache_io_handle->block_data,
+		              block_cache_io_handle->block_size,
+		              block_cache_io_handle->data_offset + (off64_t) ( entry_index * block_cache_io_handle->block_size ),
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block data from cache file.",
+			 function );
+
+			return( -1 );
+		}
+		if( read_count == (ssize_t) block_cache_io_handle->block_size )
+		{
+			if( libvsmbr_digest_calculate(
+			     LIBVSMBR_DIGEST_TYPE_FNV1A_64,
+			     block_cache_io_handle->block_data,
+			     block_cache_io_handle->block_size,
+			     checksum,
+			     LIBVSMBR_DIGEST_FNV1A_64_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calculate checksum.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_compare(
+			     cache_entry->checksum,
+			     checksum,
+			     LIBVSMBR_DIGEST_FNV1A_64_SIZE ) == 0 )
+			{
+				byte_stream_copy_from_uint64_little_endian(
+				 cache_entry->sequence_number,
+				 block_cache_io_handle->next_sequence_number );
+
+				block_cache_io_handle->next_sequence_number += 1;
+				block_cache_io_handle->index_is_dirty        = 1;
+				block_cache_io_handle->number_of_hits       += 1;
+				block_cache_io_handle->block_offset          = block_offset;
+
+				return( 1 );
+			}
+		}
+		/* A block that was not completely written or was corrupted
+		 * is read from the base and stored in its entry again
+		 */
+		replacement_entry_index = entry_index;
+	}
+	read_size = block_cache_io_handle->block_size;
+
+	if( (size64_t) read_size > ( block_cache_io_handle->size - block_offset ) )
+	{
+		read_size = (size_t) ( block_cache_io_handle->size - block_offset );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              block_cache_io_handle->base_file_io_handle,
+	              block_cache_io_handle->block_data,
+	              read_size,
+	              block_offset,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block at offset: %" PRIi64 " (0x%08" PRIx64 ") from base.",
+		 function,
+		 block_offset,
+		 block_offset );
+
+		return( -1 );
+	}
+	if( read_size < block_cache_io_handle->block_size )
+	{
+		if( memory_set(
+		     &( block_cache_io_handle->block_data[ read_size ] ),
+		     0,
+		     block_cache_io_handle->block_size - read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear block data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	block_cache_io_handle->number_of_misses += 1;
+
+	if( libvsmbr_digest_calculate(
+	     LIBVSMBR_DIGEST_TYPE_FNV1A_64,
+	     block_cache_io_handle->block_data,
+	     block_cache_io_handle->block_size,
+	     checksum,
+	     LIBVSMBR_DIGEST_FNV1A_64_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The replaced entry is marked unused until both the block data
+	 * and the entry have been written
+	 */
+	cache_entry = (vsmbr_block_cache_entry_t *) &( block_cache_io_handle->index_data[ replacement_entry_index * sizeof( vsmbr_block_cache_entry_t ) ] );
+
+	if( memory_set(
+	     cache_entry,
+	     0,
+	     sizeof( vsmbr_block_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	block_cache_io_handle->index_is_dirty = 1;
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               block_cache_io_handle->cache_file_io_handle,
+	               block_cache_io_handle->block_data,
+	               block_cache_io_handle->block_size,
+	               block_cache_io_handle->data_offset + (off64_t) ( replacement_entry_index * block_cache_io_handle->block_size ),
+	               error );
+
+	if( write_count != (ssize_t) block_cache_io_handle->block_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write block data to cache file.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 cache_entry->image_identifier,
+	 block_cache_io_handle->image_identifier );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 cache_entry->block_offset,
+	 (uint64_t) block_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 cache_entry->sequence_number,
+	 block_cache_io_handle->next_sequence_number );
+
+	if( memory_copy(
+	     cache_entry->checksum,
+	     checksum,
+	     LIBVSMBR_DIGEST_FNV1A_64_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy checksum.",
+		 function );
+
+		return( -1 );
+	}
+	block_cache_io_handle->next_sequence_number += 1;
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               block_cache_io_handle->cache_file_io_handle,
+	               (uint8_t *) cache_entry,
+	               sizeof( vsmbr_block_cache_entry_t ),
+	               LIBVSMBR_BLOCK_CACHE_INDEX_OFFSET + (off64_t) ( replacement_entry_index * sizeof( vsmbr_block_cache_entry_t ) ),
+	               error );
+
+	if( write_count != (ssize_t) sizeof( vsmbr_block_cache_entry_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write cache entry to cache file.",
+		 function );
+
+		return( -1 );
+	}
+	block_cache_io_handle->block_offset = block_offset;
+
+	return( 1 );
+}
+
+/* Reads a buffer from the block cache IO handle
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libvsmbr_block_cache_io_handle_read(
+         libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function    = "libvsmbr_block_cache_io_handle_read";
+	size_t block_data_offset = 0;
+	size_t buffer_offset     = 0;
+	size_t read_size         = 0;
+	off64_t block_offset     = 0;
+
+	if( block_cache_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_cache_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid block cache IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) block_cache_io_handle->current_offset >= block_cache_io_handle->size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) size > ( block_cache_io_handle->size - block_cache_io_handle->current_offset ) )
+	{
+		size = (size_t) ( block_cache_io_handle->size - block_cache_io_handle->current_offset );
+	}
+	while( buffer_offset < size )
+	{
+		block_data_offset = (size_t) ( block_cache_io_handle->current_offset % block_cache_io_handle->block_size );
+		block_offset      = block_cache_io_handle->current_offset - block_data_offset;
+
+		read_size = block_cache_io_handle->block_size - block_data_offset;
+
+		if( read_size > ( size - buffer_offset ) )
+		{
+			read_size = size - buffer_offset;
+		}
+		if( libvsmbr_block_cache_io_handle_read_block(
+		     block_cache_io_handle,
+		     block_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 block_offset,
+			 block_offset );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     &( buffer[ buffer_offset ] ),
+		     &( block_cache_io_handle->block_data[ block_data_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy block data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		block_cache_io_handle->current_offset += read_size;
+		buffer_offset                         += read_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Writes a buffer to the block cache IO handle
+ * This is not supported since the block cache is read-only
+ * Returns -1 on error
+ */
+ssize_t libvsmbr_block_cache_io_handle_write(
+         libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_block_cache_io_handle_write";
+
+	LIBVSMBR_UNREFERENCED_PARAMETER( block_cache_io_handle )
+	LIBVSMBR_UNREFERENCED_PARAMETER( buffer )
+	LIBVSMBR_UNREFERENCED_PARAMETER( size )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: writing to a block cache IO handle is not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Seeks a certain offset within the block cache IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libvsmbr_block_cache_io_handle_seek_offset(
+         libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_block_cache_io_handle_seek_offset";
+
+	if( block_cache_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += block_cache_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) block_cache_io_handle->size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	block_cache_io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if the block cache exists
+ * Returns 1 if the base file IO handle exists, 0 if not or -1 on error
+ */
+int libvsmbr_block_cache_io_handle_exists(
+     libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_block_cache_io_handle_exists";
+	int result            = 0;
+
+	if( block_cache_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_exists(
+	          block_cache_io_handle->base_file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if base file IO handle exists.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Check if the block cache IO handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libvsmbr_block_cache_io_handle_is_open(
+     libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_block_cache_io_handle_is_open";
+
+	if( block_cache_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_cache_io_handle->is_open == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the block cache, which is the size of the base
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_block_cache_io_handle_get_size(
+     libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_block_cache_io_handle_get_size";
+
+	if( block_cache_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_cache_io_handle->is_open == 0 )
+	{
+		if( libbfio_handle_get_size(
+		     block_cache_io_handle->base_file_io_handle,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve base file size.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		*size = block_cache_io_handle->size;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,211 @@
+/*
+ * Block cache IO handle functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSMBR_BLOCK_CACHE_IO_HANDLE_H )
+#define _LIBVSMBR_BLOCK_CACHE_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsmbr_block_cache_io_handle libvsmbr_block_cache_io_handle_t;
+
+/* The block cache IO handle serves reads of a slow base file IO handle
+ * from a cache file of a fixed maximum size that persists between sessions,
+ * the blocks in the cache file are keyed by an image identifier and block offset
+ */
+struct libvsmbr_block_cache_io_handle
+{
+	/* The base file IO handle
+	 */
+	libbfio_handle_t *base_file_io_handle;
+
+	/* The cache file IO handle
+	 */
+	libbfio_handle_t *cache_file_io_handle;
+
+	/* Value to indicate if the cache file IO handle was opened inside the library
+	 */
+	uint8_t cache_file_io_handle_opened_in_library;
+
+	/* The maximum size of the cache file
+	 */
+	size64_t maximum_cache_size;
+
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The number of sets
+	 */
+	uint32_t number_of_sets;
+
+	/* The number of entries per set
+	 */
+	uint32_t number_of_ways;
+
+	/* The offset of the block data in the cache file
+	 */
+	off64_t data_offset;
+
+	/* The index data, which contains the index entries as stored in the cache file
+	 */
+	uint8_t *index_data;
+
+	/* The index data size
+	 */
+	size_t index_data_size;
+
+	/* Value to indicate the sequence numbers in the index data were
+	 * changed and the index must be written when the handle is closed
+	 */
+	uint8_t index_is_dirty;
+
+	/* The image identifier
+	 */
+	uint64_t image_identifier;
+
+	/* The next sequence number
+	 */
+	uint64_t next_sequence_number;
+
+	/* The size, which is the size of the base
+	 */
+	size64_t size;
+
+	/* The block data
+	 */
+	uint8_t *block_data;
+
+	/* The offset of the block in the block data, where -1 represents none
+	 */
+	off64_t block_offset;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The number of blocks read from the cache file
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of blocks read from the base file IO handle
+	 */
+	uint64_t number_of_misses;
+
+	/* Value to indicate if the block cache IO handle is open
+	 */
+	uint8_t is_open;
+};
+
+int libvsmbr_block_cache_io_handle_initialize(
+     libvsmbr_block_cache_io_handle_t **block_cache_io_handle,
+     libbfio_handle_t *base_file_io_handle,
+     libbfio_handle_t *cache_file_io_handle,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libvsmbr_block_cache_initialize(
+     libbfio_handle_t **handle,
+     libbfio_handle_t *base_file_io_handle,
+     libbfio_handle_t *cache_file_io_handle,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libvsmbr_block_cache_io_handle_free(
+     libvsmbr_block_cache_io_handle_t **block_cache_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_block_cache_io_handle_clone(
+     libvsmbr_block_cache_io_handle_t **destination_block_cache_io_handle,
+     libvsmbr_block_cache_io_handle_t *source_block_cache_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_block_cache_io_handle_read_image_identifier(
+     libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_block_cache_io_handle_read_index(
+     libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_block_cache_io_handle_write_index(
+     libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+     uint8_t write_file_header,
+     libcerror_error_t **error );
+
+int libvsmbr_block_cache_io_handle_open(
+     libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libvsmbr_block_cache_io_handle_close(
+     libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_block_cache_io_handle_read_block(
+     libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+     off64_t block_offset,
+     libcerror_error_t **error );
+
+ssize_t libvsmbr_block_cache_io_handle_read(
+         libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libvsmbr_block_cache_io_handle_write(
+         libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libvsmbr_block_cache_io_handle_seek_offset(
+         libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libvsmbr_block_cache_io_handle_exists(
+     libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_block_cache_io_handle_is_open(
+     libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_block_cache_io_handle_get_size(
+     libvsmbr_block_cache_io_handle_t *block_cache_io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSMBR_BLOCK_CACHE_IO_HANDLE_H ) */
+
@@ -0,0 +1,2240 @@
+/*
+ * Block hash index functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "libvsmbr_block_hash_index.h"
+#include "libvsmbr_definitions.h"
+#include "libvsmbr_digest.h"
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_libcthreads.h"
+#include "libvsmbr_partition.h"
+#include "libvsmbr_types.h"
+
+#include "vsmbr_block_hash_index.h"
+
+const uint8_t vsmbr_block_hash_index_signature[ 8 ] = {
+	'V', 'S', 'M', 'B', 'R', 'B', 'H', 'I' };
+
+/* Creates a block hash index
+ * Make sure the value block_hash_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_block_hash_index_initialize(
+     libvsmbr_block_hash_index_t **block_hash_index,
+     uint32_t block_size,
+     int digest_type,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_block_hash_index_t *internal_block_hash_index = NULL;
+	static char *function                                           = "libvsmbr_block_hash_index_initialize";
+	size_t digest_size                                              = 0;
+
+	if( block_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hash index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_hash_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block hash index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( ( block_size % 512 ) != 0 )
+	 || ( block_size > LIBVSMBR_MAXIMUM_BLOCK_HASH_INDEX_BLOCK_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported block size: %" PRIu32 ".",
+		 function,
+		 block_size );
+
+		return( -1 );
+	}
+	if( libvsmbr_digest_get_size(
+	     digest_type,
+	     &digest_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported digest type.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_hash_index = memory_allocate_structure(
+	                             libvsmbr_internal_block_hash_index_t );
+
+	if( internal_block_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block hash index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_block_hash_index,
+	     0,
+	     sizeof( libvsmbr_internal_block_hash_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block hash index.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_block_hash_index->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_block_hash_index->block_size  = block_size;
+	internal_block_hash_index->digest_type = digest_type;
+	internal_block_hash_index->digest_size = digest_size;
+
+	*block_hash_index = (libvsmbr_block_hash_index_t *) internal_block_hash_index;
+
+	return( 1 );
+
+on_error:
+	if( internal_block_hash_index != NULL )
+	{
+		memory_free(
+		 internal_block_hash_index );
+	}
+	return( -1 );
+}
+
+/* Frees a block hash index
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_block_hash_index_free(
+     libvsmbr_block_hash_index_t **block_hash_index,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_block_hash_index_t *internal_block_hash_index = NULL;
+	static char *function                                           = "libvsmbr_block_hash_index_free";
+	int result                                                      = 1;
+
+	if( block_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hash index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_hash_index != NULL )
+	{
+		internal_block_hash_index = (libvsmbr_internal_block_hash_index_t *) *block_hash_index;
+		*block_hash_index         = NULL;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_block_hash_index->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( internal_block_hash_index->digests != NULL )
+		{
+			memory_free(
+			 internal_block_hash_index->digests );
+		}
+		memory_free(
+		 internal_block_hash_index );
+	}
+	return( result );
+}
+
+/* Sets the data size and (re)allocates the digests
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_block_hash_index_set_data_size(
+     libvsmbr_internal_block_hash_index_t *internal_block_hash_index,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libvsmbr_internal_block_hash_index_set_data_size";
+	uint64_t number_of_blocks = 0;
+	size_t digests_size       = 0;
+
+	if( internal_block_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hash index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_block_hash_index->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid block hash index - missing block size.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_blocks = data_size / internal_block_hash_index->block_size;
+
+	if( ( data_size % internal_block_hash_index->block_size ) != 0 )
+	{
+		number_of_blocks += 1;
+	}
+	if( number_of_blocks > (uint64_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / internal_block_hash_index->digest_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of blocks value exceeds maximum, use a larger block size.",
+		 function );
+
+		return( -1 );
+	}
+	digests_size = (size_t) number_of_blocks * internal_block_hash_index->digest_size;
+
+	if( internal_block_hash_index->digests != NULL )
+	{
+		memory_free(
+		 internal_block_hash_index->digests );
+
+		internal_block_hash_index->digests      = NULL;
+		internal_block_hash_index->digests_size = 0;
+	}
+	internal_block_hash_index->data_size        = 0;
+	internal_block_hash_index->number_of_blocks = 0;
+
+	if( digests_size > 0 )
+	{
+		internal_block_hash_index->digests = (uint8_t *) memory_allocate(
+		                                                  sizeof( uint8_t ) * digests_size );
+
+		if( internal_block_hash_index->digests == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create digests.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     internal_block_hash_index->digests,
+		     0,
+		     digests_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear digests.",
+			 function );
+
+			memory_free(
+			 internal_block_hash_index->digests );
+
+			internal_block_hash_index->digests = NULL;
+
+			return( -1 );
+		}
+	}
+	internal_block_hash_index->data_size        = data_size;
+	internal_block_hash_index->number_of_blocks = number_of_blocks;
+	internal_block_hash_index->digests_size     = digests_size;
+
+	return( 1 );
+}
+
+/* Builds the block hash index from the data of a partition
+ * Any previously indexed digests are replaced
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_block_hash_index_build_from_partition(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     libvsmbr_partition_t *partition,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_block_hash_index_t *internal_block_hash_index = NULL;
+	uint8_t *block_data                                             = NULL;
+	static char *function                                           = "libvsmbr_block_hash_index_build_from_partition";
+	size64_t partition_size                                         = 0;
+	size_t read_size                                                = 0;
+	ssize_t read_count                                              = 0;
+	off64_t block_offset                                            = 0;
+	uint64_t block_index                                            = 0;
+	int result                                                      = 1;
+
+	if( block_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hash index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_hash_index = (libvsmbr_internal_block_hash_index_t *) block_hash_index;
+
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_partition_get_size(
+	     partition,
+	     &partition_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition size.",
+		 function );
+
+		return( -1 );
+	}
+	block_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * internal_block_hash_index->block_size );
+
+	if( block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_block_hash_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		memory_free(
+		 block_data );
+
+		return( -1 );
+	}
+#endif
+	if( libvsmbr_internal_block_hash_index_set_data_size(
+	     internal_block_hash_index,
+	     partition_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data size.",
+		 function );
+
+		result = -1;
+	}
+	for( block_index = 0;
+	     ( result == 1 ) && ( block_index < internal_block_hash_index->number_of_blocks );
+	     block_index++ )
+	{
+		read_size = internal_block_hash_index->block_size;
+
+		if( (size64_t) read_size > ( partition_size - (size64_t) block_offset ) )
+		{
+			read_size = (size_t) ( partition_size - (size64_t) block_offset );
+		}
+		read_count = libvsmbr_partition_read_buffer_at_offset(
+		              partition,
+		              block_data,
+		              read_size,
+		              block_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 block_index,
+			 block_offset,
+			 block_offset );
+
+			result = -1;
+		}
+		else if( libvsmbr_digest_calculate(
+		          internal_block_hash_index->digest_type,
+		          block_data,
+		          read_size,
+		          &( internal_block_hash_index->digests[ block_index * internal_block_hash_index->digest_size ] ),
+		          internal_block_hash_index->digest_size,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate digest of block: %" PRIu64 ".",
+			 function,
+			 block_index );
+
+			result = -1;
+		}
+		block_offset += read_size;
+	}
+	if( result != 1 )
+	{
+		/* Do not leave a partially built index behind
+		 */
+		libvsmbr_internal_block_hash_index_set_data_size(
+		 internal_block_hash_index,
+		 0,
+		 NULL );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_block_hash_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		memory_free(
+		 block_data );
+
+		return( -1 );
+	}
+#endif
+	memory_free(
+	 block_data );
+
+	return( result );
+}
+
+/* Retrieves the block size
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_block_hash_index_get_block_size(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     uint32_t *block_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_block_hash_index_t *internal_block_hash_index = NULL;
+	static char *function                                           = "libvsmbr_block_hash_index_get_block_size";
+
+	if( block_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hash index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_hash_index = (libvsmbr_internal_block_hash_index_t *) block_hash_index;
+
+	if( block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_block_hash_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*block_size = internal_block_hash_index->block_size;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_block_hash_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the digest type
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_block_hash_index_get_digest_type(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     int *digest_type,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_block_hash_index_t *internal_block_hash_index = NULL;
+	static char *function                                           = "libvsmbr_block_hash_index_get_digest_type";
+
+	if( block_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hash index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_hash_index = (libvsmbr_internal_block_hash_index_t *) block_hash_index;
+
+	if( digest_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest type.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_block_hash_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*digest_type = internal_block_hash_index->digest_type;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_block_hash_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the size of the indexed data
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_block_hash_index_get_data_size(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     size64_t *data_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_block_hash_index_t *internal_block_hash_index = NULL;
+	static char *function                                           = "libvsmbr_block_hash_index_get_data_size";
+
+	if( block_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hash index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_hash_index = (libvsmbr_internal_block_hash_index_t *) block_hash_index;
+
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_block_hash_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*data_size = internal_block_hash_index->data_size;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_block_hash_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of blocks
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_block_hash_index_get_number_of_blocks(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     uint64_t *number_of_blocks,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_block_hash_index_t *internal_block_hash_index = NULL;
+	static char *function                                           = "libvsmbr_block_hash_index_get_number_of_blocks";
+
+	if( block_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hash index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_hash_index = (libvsmbr_internal_block_hash_index_t *) block_hash_index;
+
+	if( number_of_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_block_hash_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_blocks = internal_block_hash_index->number_of_blocks;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_block_hash_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the offset and size of the data covered by a specific block
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_block_hash_index_get_block_range(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     uint64_t block_index,
+     off64_t *block_offset,
+     size64_t *block_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_block_hash_index_t *internal_block_hash_index = NULL;
+	static char *function                                           = "libvsmbr_block_hash_index_get_block_range";
+	size64_t safe_block_size                                        = 0;
+	off64_t safe_block_offset                                       = 0;
+	int result                                                      = 1;
+
+	if( block_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hash index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_hash_index = (libvsmbr_internal_block_hash_index_t *) block_hash_index;
+
+	if( block_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_block_hash_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( block_index >= internal_block_hash_index->number_of_blocks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block index value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		safe_block_offset = (off64_t) ( block_index * internal_block_hash_index->block_size );
+		safe_block_size   = internal_block_hash_index->data_size - (size64_t) safe_block_offset;
+
+		if( safe_block_size > internal_block_hash_index->block_size )
+		{
+			safe_block_size = internal_block_hash_index->block_size;
+		}
+		*block_offset = safe_block_offset;
+		*block_size   = safe_block_size;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_block_hash_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the digest of a specific block
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_block_hash_index_get_digest(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     uint64_t block_index,
+     uint8_t *digest,
+     size_t digest_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_block_hash_index_t *internal_block_hash_index = NULL;
+	static char *function                                           = "libvsmbr_block_hash_index_get_digest";
+	int result                                                      = 1;
+
+	if( block_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hash index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_hash_index = (libvsmbr_internal_block_hash_index_t *) block_hash_index;
+
+	if( digest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid digest size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_block_hash_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( block_index >= internal_block_hash_index->number_of_blocks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block index value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else if( digest_size < internal_block_hash_index->digest_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid digest size value too small.",
+		 function );
+
+		result = -1;
+	}
+	else if( memory_copy(
+	          digest,
+	          &( internal_block_hash_index->digests[ block_index * internal_block_hash_index->digest_size ] ),
+	          internal_block_hash_index->digest_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy digest.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_block_hash_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Determines the next block, from a specific block index onwards, that differs
+ * between the block hash index and the compare block hash index
+ * A block that is only present in one of the indexes or that covers a different
+ * amount of data is considered changed
+ * Both indexes must use the same block size and digest type
+ * Returns 1 if a changed block was found, 0 if not or -1 on error
+ */
+int libvsmbr_block_hash_index_get_next_changed_block(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     libvsmbr_block_hash_index_t *compare_block_hash_index,
+     uint64_t start_block_index,
+     uint64_t *block_index,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_block_hash_index_t *internal_block_hash_index         = NULL;
+	libvsmbr_internal_block_hash_index_t *internal_compare_block_hash_index = NULL;
+	static char *function                                                   = "libvsmbr_block_hash_index_get_next_changed_block";
+	size64_t common_data_size                                               = 0;
+	uint64_t common_number_of_blocks                                        = 0;
+	uint64_t maximum_number_of_blocks                                       = 0;
+	uint64_t safe_block_index                                               = 0;
+	size_t digest_offset                                                    = 0;
+	int result                                                              = 0;
+
+	if( block_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hash index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_hash_index = (libvsmbr_internal_block_hash_index_t *) block_hash_index;
+
+	if( compare_block_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compare block hash index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_compare_block_hash_index = (libvsmbr_internal_block_hash_index_t *) compare_block_hash_index;
+
+	if( block_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_block_hash_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_compare_block_hash_index != internal_block_hash_index )
+	{
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_compare_block_hash_index->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab compare read/write lock for reading.",
+			 function );
+
+			libcthreads_read_write_lock_release_for_read(
+			 internal_block_hash_index->read_write_lock,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( ( internal_block_hash_index->block_size != internal_compare_block_hash_index->block_size )
+	 || ( internal_block_hash_index->digest_type != internal_compare_block_hash_index->digest_type ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: block size or digest type of block hash indexes differ.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		common_number_of_blocks  = internal_block_hash_index->number_of_blocks;
+		maximum_number_of_blocks = internal_compare_block_hash_index->number_of_blocks;
+
+		if( common_number_of_blocks > maximum_number_of_blocks )
+		{
+			common_number_of_blocks  = internal_compare_block_hash_index->number_of_blocks;
+			maximum_number_of_blocks = internal_block_hash_index->number_of_blocks;
+		}
+		common_data_size = internal_block_hash_index->data_size;
+
+		if( common_data_size > internal_compare_block_hash_index->data_size )
+		{
+			common_data_size = internal_compare_block_hash_index->data_size;
+		}
+		for( safe_block_index = start_block_index;
+		     safe_block_index < maximum_number_of_blocks;
+		     safe_block_index++ )
+		{
+			if( safe_block_index >= common_number_of_blocks )
+			{
+				result = 1;
+
+				break;
+			}
+			/* The last block of the smaller data covers less data
+			 */
+			if( ( internal_block_hash_index->data_size != internal_compare_block_hash_index->data_size )
+			 && ( ( ( safe_block_index + 1 ) * internal_block_hash_index->block_size ) > common_data_size ) )
+			{
+				result = 1;
+
+				break;
+			}
+			digest_offset = (size_t) safe_block_index * internal_block_hash_index->digest_size;
+
+			if( memory_compare(
+			     &( internal_block_hash_index->digests[ digest_offset ] ),
+			     &( internal_compare_block_hash_index->digests[ digest_offset ] ),
+			     internal_block_hash_index->digest_size ) != 0 )
+			{
+				result = 1;
+
+				break;
+			}
+		}
+		if( result == 1 )
+		{
+			*block_index = safe_block_index;
+		}
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( internal_compare_block_hash_index != internal_block_hash_index )
+	{
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_compare_block_hash_index->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release compare read/write lock for reading.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_block_hash_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the block hash index from a file
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_block_hash_index_read_file(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libvsmbr_block_hash_index_read_file";
+	size_t filename_length           = 0;
+
+	if( block_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hash index.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_block_hash_index_read_file_io_handle(
+	     block_hash_index,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block hash index: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Reads the block hash index from a file
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_block_hash_index_read_file_wide(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libvsmbr_block_hash_index_read_file_wide";
+	size_t filename_length           = 0;
+
+	if( block_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hash index.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_block_hash_index_read_file_io_handle(
+	     block_hash_index,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block hash index: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Reads the block hash index using a Basic File IO (bfio) handle
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_block_hash_index_read_file_io_handle(
+     libvsmbr_internal_block_hash_index_t *internal_block_hash_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	vsmbr_block_hash_index_file_header_t file_header;
+
+	static char *function       = "libvsmbr_internal_block_hash_index_read_file_io_handle";
+	size64_t data_size          = 0;
+	size_t digest_size          = 0;
+	ssize_t read_count          = 0;
+	uint64_t number_of_blocks   = 0;
+	uint32_t block_size         = 0;
+	uint32_t digest_type        = 0;
+	uint32_t format_version     = 0;
+	uint32_t stored_digest_size = 0;
+
+	if( internal_block_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hash index.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &file_header,
+	              sizeof( vsmbr_block_hash_index_file_header_t ),
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( vsmbr_block_hash_index_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header data at offset: 0 (0x00000000).",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     file_header.signature,
+	     vsmbr_block_hash_index_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.digest_type,
+	 digest_type );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.block_size,
+	 block_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.digest_size,
+	 stored_digest_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header.data_size,
+	 data_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header.number_of_blocks,
+	 number_of_blocks );
+
+	if( format_version != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( ( block_size % 512 ) != 0 )
+	 || ( block_size > LIBVSMBR_MAXIMUM_BLOCK_HASH_INDEX_BLOCK_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported block size: %" PRIu32 ".",
+		 function,
+		 block_size );
+
+		return( -1 );
+	}
+	if( libvsmbr_digest_get_size(
+	     (int) digest_type,
+	     &digest_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported digest type: %" PRIu32 ".",
+		 function,
+		 digest_type );
+
+		return( -1 );
+	}
+	if( (size_t) stored_digest_size != digest_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in digest size.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_hash_index->block_size  = block_size;
+	internal_block_hash_index->digest_type = (int) digest_type;
+	internal_block_hash_index->digest_size = digest_size;
+
+	if( libvsmbr_internal_block_hash_index_set_data_size(
+	     internal_block_hash_index,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_blocks != internal_block_hash_index->number_of_blocks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in number of blocks.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_block_hash_index->digests_size > 0 )
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              internal_block_hash_index->digests,
+		              internal_block_hash_index->digests_size,
+		              (off64_t) sizeof( vsmbr_block_hash_index_file_header_t ),
+		              error );
+
+		if( read_count != (ssize_t) internal_block_hash_index->digests_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read digests.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	libvsmbr_internal_block_hash_index_set_data_size(
+	 internal_block_hash_index,
+	 0,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Reads the block hash index using a Basic File IO (bfio) handle
+ * The block size and digest type are replaced by those stored in the file
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_block_hash_index_read_file_io_handle(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_block_hash_index_t *internal_block_hash_index = NULL;
+	static char *function                                           = "libvsmbr_block_hash_index_read_file_io_handle";
+	int file_io_handle_is_open                                      = 0;
+	int file_io_handle_opened_in_library                            = 0;
+	int result                                                      = 1;
+
+	if( block_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hash index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_hash_index = (libvsmbr_internal_block_hash_index_t *) block_hash_index;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		return( -1 );
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_block_hash_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libvsmbr_internal_block_hash_index_read_file_io_handle(
+	     internal_block_hash_index,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block hash index.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_block_hash_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		file_io_handle_opened_in_library = 0;
+
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the block hash index to a file
+ * An existing file is overwritten
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_block_hash_index_write_file(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libvsmbr_block_hash_index_write_file";
+	size_t filename_length           = 0;
+
+	if( block_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hash index.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_block_hash_index_write_file_io_handle(
+	     block_hash_index,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write block hash index: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Writes the block hash index to a file
+ * An existing file is overwritten
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_block_hash_index_write_file_wide(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libvsmbr_block_hash_index_write_file_wide";
+	size_t filename_length           = 0;
+
+	if( block_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hash index.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_block_hash_index_write_file_io_handle(
+	     block_hash_index,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write block hash index: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Writes the block hash index using a Basic File IO (bfio) handle
+ * This function is not multi-thread safe acquire read lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_block_hash_index_write_file_io_handle(
+     libvsmbr_internal_block_hash_index_t *internal_block_hash_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	vsmbr_block_hash_index_file_header_t file_header;
+
+	static char *function = "libvsmbr_internal_block_hash_index_write_file_io_handle";
+	ssize_t write_count   = 0;
+
+	if( internal_block_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hash index.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     file_header.signature,
+	     vsmbr_block_hash_index_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.format_version,
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.digest_type,
+	 (uint32_t) internal_block_hash_index->digest_type );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.block_size,
+	 internal_block_hash_index->block_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.digest_size,
+	 (uint32_t) internal_block_hash_index->digest_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header.data_size,
+	 internal_block_hash_index->data_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header.number_of_blocks,
+	 internal_block_hash_index->number_of_blocks );
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               file_io_handle,
+	               (uint8_t *) &file_header,
+	               sizeof( vsmbr_block_hash_index_file_header_t ),
+	               0,
+	               error );
+
+	if( write_count != (ssize_t) sizeof( vsmbr_block_hash_index_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_block_hash_index->digests_size > 0 )
+	{
+		write_count = libbfio_handle_write_buffer_at_offset(
+		               file_io_handle,
+		               internal_block_hash_index->digests,
+		               internal_block_hash_index->digests_size,
+		               (off64_t) sizeof( vsmbr_block_hash_index_file_header_t ),
+		               error );
+
+		if( write_count != (ssize_t) internal_block_hash_index->digests_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write digests.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes the block hash index using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_block_hash_index_write_file_io_handle(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_block_hash_index_t *internal_block_hash_index = NULL;
+	static char *function                                           = "libvsmbr_block_hash_index_write_file_io_handle";
+	int file_io_handle_is_open                                      = 0;
+	int file_io_handle_opened_in_library                            = 0;
+	int result                                                      = 1;
+
+	if( block_hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hash index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_hash_index = (libvsmbr_internal_block_hash_index_t *) block_hash_index;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		return( -1 );
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_WRITE_TRUNCATE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_block_hash_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libvsmbr_internal_block_hash_index_write_file_io_handle(
+	     internal_block_hash_index,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write block hash index.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_block_hash_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		file_io_handle_opened_in_library = 0;
+
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
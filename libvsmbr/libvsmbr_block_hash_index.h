@@ -0,0 +1,207 @@
+/*
+ * Block hash index functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSMBR_BLOCK_HASH_INDEX_H )
+#define _LIBVSMBR_BLOCK_HASH_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsmbr_extern.h"
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_libcthreads.h"
+#include "libvsmbr_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsmbr_internal_block_hash_index libvsmbr_internal_block_hash_index_t;
+
+struct libvsmbr_internal_block_hash_index
+{
+	/* The block size
+	 */
+	uint32_t block_size;
+
+	/* The digest type
+	 */
+	int digest_type;
+
+	/* The digest size
+	 */
+	size_t digest_size;
+
+	/* The data size
+	 */
+	size64_t data_size;
+
+	/* The number of blocks
+	 */
+	uint64_t number_of_blocks;
+
+	/* The digests
+	 */
+	uint8_t *digests;
+
+	/* The digests size
+	 */
+	size_t digests_size;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+LIBVSMBR_EXTERN \
+int libvsmbr_block_hash_index_initialize(
+     libvsmbr_block_hash_index_t **block_hash_index,
+     uint32_t block_size,
+     int digest_type,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_block_hash_index_free(
+     libvsmbr_block_hash_index_t **block_hash_index,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_block_hash_index_set_data_size(
+     libvsmbr_internal_block_hash_index_t *internal_block_hash_index,
+     size64_t data_size,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_block_hash_index_build_from_partition(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     libvsmbr_partition_t *partition,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_block_hash_index_get_block_size(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     uint32_t *block_size,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_block_hash_index_get_digest_type(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     int *digest_type,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_block_hash_index_get_data_size(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     size64_t *data_size,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_block_hash_index_get_number_of_blocks(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     uint64_t *number_of_blocks,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_block_hash_index_get_block_range(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     uint64_t block_index,
+     off64_t *block_offset,
+     size64_t *block_size,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_block_hash_index_get_digest(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     uint64_t block_index,
+     uint8_t *digest,
+     size_t digest_size,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_block_hash_index_get_next_changed_block(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     libvsmbr_block_hash_index_t *compare_block_hash_index,
+     uint64_t start_block_index,
+     uint64_t *block_index,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_block_hash_index_read_file(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBVSMBR_EXTERN \
+int libvsmbr_block_hash_index_read_file_wide(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+int libvsmbr_internal_block_hash_index_read_file_io_handle(
+     libvsmbr_internal_block_hash_index_t *internal_block_hash_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_block_hash_index_read_file_io_handle(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_block_hash_index_write_file(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBVSMBR_EXTERN \
+int libvsmbr_block_hash_index_write_file_wide(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+int libvsmbr_internal_block_hash_index_write_file_io_handle(
+     libvsmbr_internal_block_hash_index_t *internal_block_hash_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_block_hash_index_write_file_io_handle(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSMBR_BLOCK_HASH_INDEX_H ) */
+
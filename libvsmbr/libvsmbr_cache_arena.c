@@ -0,0 +1,2243 @@
+/*
+ * Cache arena functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsmbr_cache_arena.h"
+#include "libvsmbr_cache_arena_block.h"
+#include "libvsmbr_definitions.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_libcthreads.h"
+#include "libvsmbr_types.h"
+
+/* Retrieves the index of the hash bucket of a block
+ */
+static int libvsmbr_cache_arena_get_bucket_index(
+            uint32_t owner_identifier,
+            off64_t offset )
+{
+	uint64_t hash_value = 0;
+
+	hash_value  = (uint64_t) offset >> 9;
+	hash_value ^= (uint64_t) owner_identifier << 40;
+	hash_value *= 0x9e3779b97f4a7c15ULL;
+
+	return( (int) ( ( hash_value >> 32 ) % LIBVSMBR_CACHE_ARENA_NUMBER_OF_BUCKETS ) );
+}
+
+/* Creates a cache arena
+ * The maximum size is the budget in bytes of the cached data of all
+ * partitions that use the cache arena, including their bookkeeping
+ * The cache arena initially uses the least recently used replacement policy
+ * Make sure the value cache_arena is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_cache_arena_initialize(
+     libvsmbr_cache_arena_t **cache_arena,
+     size64_t maximum_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_cache_arena_t *internal_cache_arena = NULL;
+	static char *function                                 = "libvsmbr_cache_arena_initialize";
+	size_t buckets_size                                   = 0;
+
+	if( cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cache arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_arena = memory_allocate_structure(
+	                        libvsmbr_internal_cache_arena_t );
+
+	if( internal_cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_cache_arena,
+	     0,
+	     sizeof( libvsmbr_internal_cache_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache arena.",
+		 function );
+
+		memory_free(
+		 internal_cache_arena );
+
+		return( -1 );
+	}
+	buckets_size = sizeof( libvsmbr_cache_arena_block_t * ) * LIBVSMBR_CACHE_ARENA_NUMBER_OF_BUCKETS;
+
+	internal_cache_arena->buckets = (libvsmbr_cache_arena_block_t **) memory_allocate(
+	                                                                   buckets_size );
+
+	if( internal_cache_arena->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_cache_arena->buckets,
+	     0,
+	     buckets_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( internal_cache_arena->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_cache_arena->maximum_size       = maximum_size;
+	internal_cache_arena->replacement_policy = LIBVSMBR_CACHE_REPLACEMENT_POLICY_LEAST_RECENTLY_USED;
+
+	*cache_arena = (libvsmbr_cache_arena_t *) internal_cache_arena;
+
+	return( 1 );
+
+on_error:
+	if( internal_cache_arena != NULL )
+	{
+		if( internal_cache_arena->buckets != NULL )
+		{
+			memory_free(
+			 internal_cache_arena->buckets );
+		}
+		memory_free(
+		 internal_cache_arena );
+	}
+	return( -1 );
+}
+
+/* Frees a cache arena
+ * The partitions that use the cache arena must be freed before it is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_cache_arena_free(
+     libvsmbr_cache_arena_t **cache_arena,
+     libcerror_error_t **error )
+{
+	libvsmbr_cache_arena_block_t *cache_arena_block       = NULL;
+	libvsmbr_cache_arena_block_t *next_cache_arena_block  = NULL;
+	libvsmbr_internal_cache_arena_t *internal_cache_arena = NULL;
+	static char *function                                 = "libvsmbr_cache_arena_free";
+	int queue                                             = 0;
+	int result                                            = 1;
+
+	if( cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_arena != NULL )
+	{
+		internal_cache_arena = (libvsmbr_internal_cache_arena_t *) *cache_arena;
+
+		if( internal_cache_arena->number_of_owners != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid cache arena - owners still registered.",
+			 function );
+
+			return( -1 );
+		}
+		*cache_arena = NULL;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( internal_cache_arena->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		for( queue = 0;
+		     queue < LIBVSMBR_CACHE_ARENA_NUMBER_OF_QUEUES;
+		     queue++ )
+		{
+			cache_arena_block = internal_cache_arena->first_blocks[ queue ];
+
+			while( cache_arena_block != NULL )
+			{
+				next_cache_arena_block = cache_arena_block->next_block;
+
+				if( libvsmbr_cache_arena_block_free(
+				     &cache_arena_block,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free block.",
+					 function );
+
+					result = -1;
+				}
+				cache_arena_block = next_cache_arena_block;
+			}
+		}
+		memory_free(
+		 internal_cache_arena->buckets );
+
+		memory_free(
+		 internal_cache_arena );
+	}
+	return( result );
+}
+
+/* Retrieves the maximum size
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_cache_arena_get_maximum_size(
+     libvsmbr_cache_arena_t *cache_arena,
+     size64_t *maximum_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_cache_arena_t *internal_cache_arena = NULL;
+	static char *function                                 = "libvsmbr_cache_arena_get_maximum_size";
+
+	if( cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_arena = (libvsmbr_internal_cache_arena_t *) cache_arena;
+
+	if( maximum_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_cache_arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*maximum_size = internal_cache_arena->maximum_size;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_cache_arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum size
+ * Blocks are evicted until the cached data fits the new maximum size
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_cache_arena_set_maximum_size(
+     libvsmbr_cache_arena_t *cache_arena,
+     size64_t maximum_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_cache_arena_t *internal_cache_arena = NULL;
+	static char *function                                 = "libvsmbr_cache_arena_set_maximum_size";
+	int number_of_evicted_blocks                          = 0;
+	int result                                            = 1;
+
+	if( cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_arena = (libvsmbr_internal_cache_arena_t *) cache_arena;
+
+	if( maximum_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_cache_arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_cache_arena->maximum_size = maximum_size;
+
+	if( libvsmbr_internal_cache_arena_evict_blocks(
+	     internal_cache_arena,
+	     0,
+	     &number_of_evicted_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to evict blocks.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_cache_arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the cached data, including its bookkeeping
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_cache_arena_get_size(
+     libvsmbr_cache_arena_t *cache_arena,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_cache_arena_t *internal_cache_arena = NULL;
+	static char *function                                 = "libvsmbr_cache_arena_get_size";
+
+	if( cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_arena = (libvsmbr_internal_cache_arena_t *) cache_arena;
+
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_cache_arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*size = internal_cache_arena->size;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_cache_arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of cached blocks
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_cache_arena_get_number_of_blocks(
+     libvsmbr_cache_arena_t *cache_arena,
+     int *number_of_blocks,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_cache_arena_t *internal_cache_arena = NULL;
+	static char *function                                 = "libvsmbr_cache_arena_get_number_of_blocks";
+
+	if( cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_arena = (libvsmbr_internal_cache_arena_t *) cache_arena;
+
+	if( number_of_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_cache_arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_blocks = internal_cache_arena->number_of_blocks;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_cache_arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the replacement policy
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_cache_arena_get_replacement_policy(
+     libvsmbr_cache_arena_t *cache_arena,
+     int *replacement_policy,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_cache_arena_t *internal_cache_arena = NULL;
+	static char *function                                 = "libvsmbr_cache_arena_get_replacement_policy";
+
+	if( cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_arena = (libvsmbr_internal_cache_arena_t *) cache_arena;
+
+	if( replacement_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid replacement policy.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_cache_arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*replacement_policy = internal_cache_arena->replacement_policy;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_cache_arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the replacement policy
+ * When the least recently used policy is set the blocks in the recent queue
+ * are moved to the frequent queue and the ghost queue is emptied
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_cache_arena_set_replacement_policy(
+     libvsmbr_cache_arena_t *cache_arena,
+     int replacement_policy,
+     libcerror_error_t **error )
+{
+	libvsmbr_cache_arena_block_t *cache_arena_block       = NULL;
+	libvsmbr_internal_cache_arena_t *internal_cache_arena = NULL;
+	static char *function                                 = "libvsmbr_cache_arena_set_replacement_policy";
+	int result                                            = 1;
+
+	if( cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_arena = (libvsmbr_internal_cache_arena_t *) cache_arena;
+
+	if( ( replacement_policy != LIBVSMBR_CACHE_REPLACEMENT_POLICY_LEAST_RECENTLY_USED )
+	 && ( replacement_policy != LIBVSMBR_CACHE_REPLACEMENT_POLICY_TWO_QUEUE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported replacement policy: %d.",
+		 function,
+		 replacement_policy );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_cache_arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( replacement_policy == LIBVSMBR_CACHE_REPLACEMENT_POLICY_LEAST_RECENTLY_USED )
+	{
+		/* The oldest block of the recent queue is moved first so that
+		 * the blocks retain their order
+		 */
+		while( internal_cache_arena->last_blocks[ LIBVSMBR_CACHE_ARENA_QUEUE_RECENT ] != NULL )
+		{
+			cache_arena_block = internal_cache_arena->last_blocks[ LIBVSMBR_CACHE_ARENA_QUEUE_RECENT ];
+
+			if( libvsmbr_internal_cache_arena_unlink_block(
+			     internal_cache_arena,
+			     cache_arena_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to unlink block from recent queue.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+			if( libvsmbr_internal_cache_arena_link_block(
+			     internal_cache_arena,
+			     cache_arena_block,
+			     LIBVSMBR_CACHE_ARENA_QUEUE_FREQUENT,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to link block in frequent queue.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+		if( result == 1 )
+		{
+			if( libvsmbr_internal_cache_arena_remove_queue_blocks(
+			     internal_cache_arena,
+			     LIBVSMBR_CACHE_ARENA_QUEUE_GHOST,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove blocks of ghost queue.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		internal_cache_arena->replacement_policy = replacement_policy;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_cache_arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Unlinks a block from its queue
+ * This function is not multi-thread safe acquire mutex before call
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_cache_arena_unlink_block(
+     libvsmbr_internal_cache_arena_t *internal_cache_arena,
+     libvsmbr_cache_arena_block_t *cache_arena_block,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_internal_cache_arena_unlink_block";
+	uint8_t queue         = 0;
+
+	if( internal_cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_arena_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	queue = cache_arena_block->queue;
+
+	if( queue >= LIBVSMBR_CACHE_ARENA_NUMBER_OF_QUEUES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block - queue value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_arena_block->previous_block == NULL )
+	{
+		internal_cache_arena->first_blocks[ queue ] = cache_arena_block->next_block;
+	}
+	else
+	{
+		cache_arena_block->previous_block->next_block = cache_arena_block->next_block;
+	}
+	if( cache_arena_block->next_block == NULL )
+	{
+		internal_cache_arena->last_blocks[ queue ] = cache_arena_block->previous_block;
+	}
+	else
+	{
+		cache_arena_block->next_block->previous_block = cache_arena_block->previous_block;
+	}
+	cache_arena_block->previous_block = NULL;
+	cache_arena_block->next_block     = NULL;
+
+	internal_cache_arena->queue_sizes[ queue ]            -= sizeof( libvsmbr_cache_arena_block_t ) + cache_arena_block->data_size;
+	internal_cache_arena->queue_number_of_blocks[ queue ] -= 1;
+
+	return( 1 );
+}
+
+/* Links a block as the most recently used block of a specific queue
+ * This function is not multi-thread safe acquire mutex before call
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_cache_arena_link_block(
+     libvsmbr_internal_cache_arena_t *internal_cache_arena,
+     libvsmbr_cache_arena_block_t *cache_arena_block,
+     uint8_t queue,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_internal_cache_arena_link_block";
+
+	if( internal_cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_arena_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	if( queue >= LIBVSMBR_CACHE_ARENA_NUMBER_OF_QUEUES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid queue value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	cache_arena_block->queue          = queue;
+	cache_arena_block->previous_block = NULL;
+	cache_arena_block->next_block     = internal_cache_arena->first_blocks[ queue ];
+
+	if( internal_cache_arena->first_blocks[ queue ] == NULL )
+	{
+		internal_cache_arena->last_blocks[ queue ] = cache_arena_block;
+	}
+	else
+	{
+		internal_cache_arena->first_blocks[ queue ]->previous_block = cache_arena_block;
+	}
+	internal_cache_arena->first_blocks[ queue ] = cache_arena_block;
+
+	internal_cache_arena->queue_sizes[ queue ]            += sizeof( libvsmbr_cache_arena_block_t ) + cache_arena_block->data_size;
+	internal_cache_arena->queue_number_of_blocks[ queue ] += 1;
+
+	return( 1 );
+}
+
+/* Appends a block as the least recently used block of a specific queue
+ * This function is not multi-thread safe acquire mutex before call
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_cache_arena_append_block(
+     libvsmbr_internal_cache_arena_t *internal_cache_arena,
+     libvsmbr_cache_arena_block_t *cache_arena_block,
+     uint8_t queue,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_internal_cache_arena_append_block";
+
+	if( internal_cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_arena_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	if( queue >= LIBVSMBR_CACHE_ARENA_NUMBER_OF_QUEUES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid queue value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	cache_arena_block->queue          = queue;
+	cache_arena_block->previous_block = internal_cache_arena->last_blocks[ queue ];
+	cache_arena_block->next_block     = NULL;
+
+	if( internal_cache_arena->last_blocks[ queue ] == NULL )
+	{
+		internal_cache_arena->first_blocks[ queue ] = cache_arena_block;
+	}
+	else
+	{
+		internal_cache_arena->last_blocks[ queue ]->next_block = cache_arena_block;
+	}
+	internal_cache_arena->last_blocks[ queue ] = cache_arena_block;
+
+	internal_cache_arena->queue_sizes[ queue ]            += sizeof( libvsmbr_cache_arena_block_t ) + cache_arena_block->data_size;
+	internal_cache_arena->queue_number_of_blocks[ queue ] += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the block of a specific owner at a specific offset
+ * This function is not multi-thread safe acquire mutex before call
+ * Returns 1 if successful, 0 if no such block or -1 on error
+ */
+int libvsmbr_internal_cache_arena_get_block(
+     libvsmbr_internal_cache_arena_t *internal_cache_arena,
+     uint32_t owner_identifier,
+     off64_t offset,
+     libvsmbr_cache_arena_block_t **cache_arena_block,
+     libcerror_error_t **error )
+{
+	libvsmbr_cache_arena_block_t *bucket_block = NULL;
+	static char *function                      = "libvsmbr_internal_cache_arena_get_block";
+	int bucket_index                           = 0;
+
+	if( internal_cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_arena_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = libvsmbr_cache_arena_get_bucket_index(
+	                owner_identifier,
+	                offset );
+
+	bucket_block = internal_cache_arena->buckets[ bucket_index ];
+
+	while( bucket_block != NULL )
+	{
+		if( ( bucket_block->owner_identifier == owner_identifier )
+		 && ( bucket_block->offset == offset ) )
+		{
+			*cache_arena_block = bucket_block;
+
+			return( 1 );
+		}
+		bucket_block = bucket_block->next_in_bucket;
+	}
+	return( 0 );
+}
+
+/* Removes a block from the cache arena and frees it
+ * This function is not multi-thread safe acquire mutex before call
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_cache_arena_remove_block(
+     libvsmbr_internal_cache_arena_t *internal_cache_arena,
+     libvsmbr_cache_arena_block_t *cache_arena_block,
+     libcerror_error_t **error )
+{
+	libvsmbr_cache_arena_block_t *bucket_block          = NULL;
+	libvsmbr_cache_arena_block_t *previous_bucket_block = NULL;
+	static char *function                               = "libvsmbr_internal_cache_arena_remove_block";
+	int bucket_index                                    = 0;
+
+	if( internal_cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_arena_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = libvsmbr_cache_arena_get_bucket_index(
+	                cache_arena_block->owner_identifier,
+	                cache_arena_block->offset );
+
+	bucket_block = internal_cache_arena->buckets[ bucket_index ];
+
+	while( ( bucket_block != NULL )
+	    && ( bucket_block != cache_arena_block ) )
+	{
+		previous_bucket_block = bucket_block;
+		bucket_block          = bucket_block->next_in_bucket;
+	}
+	if( bucket_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing block in bucket: %d.",
+		 function,
+		 bucket_index );
+
+		return( -1 );
+	}
+	if( libvsmbr_internal_cache_arena_unlink_block(
+	     internal_cache_arena,
+	     cache_arena_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to unlink block.",
+		 function );
+
+		return( -1 );
+	}
+	if( previous_bucket_block == NULL )
+	{
+		internal_cache_arena->buckets[ bucket_index ] = cache_arena_block->next_in_bucket;
+	}
+	else
+	{
+		previous_bucket_block->next_in_bucket = cache_arena_block->next_in_bucket;
+	}
+	internal_cache_arena->size -= sizeof( libvsmbr_cache_arena_block_t ) + cache_arena_block->data_size;
+
+	if( cache_arena_block->queue != LIBVSMBR_CACHE_ARENA_QUEUE_GHOST )
+	{
+		internal_cache_arena->number_of_blocks -= 1;
+	}
+
+	if( libvsmbr_cache_arena_block_free(
+	     &cache_arena_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free block.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Demotes a block of the recent queue to the ghost queue
+ * The data of the block is freed and only its identifier is retained
+ * This function is not multi-thread safe acquire mutex before call
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_cache_arena_demote_block(
+     libvsmbr_internal_cache_arena_t *internal_cache_arena,
+     libvsmbr_cache_arena_block_t *cache_arena_block,
+     libcerror_error_t **error )
+{
+	static char *function              = "libvsmbr_internal_cache_arena_demote_block";
+	int maximum_number_of_ghost_blocks = 0;
+
+	if( internal_cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_arena_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_arena_block->queue != LIBVSMBR_CACHE_ARENA_QUEUE_RECENT )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid block - unsupported queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_internal_cache_arena_unlink_block(
+	     internal_cache_arena,
+	     cache_arena_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to unlink block from recent queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_arena->size -= cache_arena_block->data_size;
+
+	internal_cache_arena->number_of_blocks -= 1;
+
+	memory_free(
+	 cache_arena_block->data );
+
+	cache_arena_block->data      = NULL;
+	cache_arena_block->data_size = 0;
+
+	if( libvsmbr_internal_cache_arena_link_block(
+	     internal_cache_arena,
+	     cache_arena_block,
+	     LIBVSMBR_CACHE_ARENA_QUEUE_GHOST,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to link block in ghost queue.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_number_of_ghost_blocks = ( internal_cache_arena->number_of_blocks * LIBVSMBR_CACHE_ARENA_GHOST_QUEUE_PERCENTAGE ) / 100;
+
+	if( maximum_number_of_ghost_blocks < 1 )
+	{
+		maximum_number_of_ghost_blocks = 1;
+	}
+	while( internal_cache_arena->queue_number_of_blocks[ LIBVSMBR_CACHE_ARENA_QUEUE_GHOST ] > maximum_number_of_ghost_blocks )
+	{
+		if( libvsmbr_internal_cache_arena_remove_block(
+		     internal_cache_arena,
+		     internal_cache_arena->last_blocks[ LIBVSMBR_CACHE_ARENA_QUEUE_GHOST ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove oldest block of ghost queue.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Removes the blocks of a specific queue
+ * This function is not multi-thread safe acquire mutex before call
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_cache_arena_remove_queue_blocks(
+     libvsmbr_internal_cache_arena_t *internal_cache_arena,
+     uint8_t queue,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_internal_cache_arena_remove_queue_blocks";
+
+	if( internal_cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( queue >= LIBVSMBR_CACHE_ARENA_NUMBER_OF_QUEUES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid queue value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( internal_cache_arena->last_blocks[ queue ] != NULL )
+	{
+		if( libvsmbr_internal_cache_arena_remove_block(
+		     internal_cache_arena,
+		     internal_cache_arena->last_blocks[ queue ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove block.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Evicts blocks until a block of the required size fits within the maximum size
+ * With the least recently used policy the least recently used blocks are
+ * removed. With the two queue policy the oldest blocks of the recent queue
+ * are demoted while the recent queue exceeds its share of the maximum size,
+ * otherwise the least recently used blocks of the frequent queue are removed
+ * This function is not multi-thread safe acquire mutex before call
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_cache_arena_evict_blocks(
+     libvsmbr_internal_cache_arena_t *internal_cache_arena,
+     size64_t required_size,
+     int *number_of_evicted_blocks,
+     libcerror_error_t **error )
+{
+	libvsmbr_cache_arena_block_t *frequent_block = NULL;
+	libvsmbr_cache_arena_block_t *recent_block   = NULL;
+	static char *function                        = "libvsmbr_internal_cache_arena_evict_blocks";
+	size64_t maximum_recent_size                 = 0;
+
+	if( internal_cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_evicted_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of evicted blocks.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_evicted_blocks = 0;
+
+	maximum_recent_size = ( internal_cache_arena->maximum_size / 100 ) * LIBVSMBR_CACHE_ARENA_RECENT_QUEUE_PERCENTAGE;
+
+	while( ( internal_cache_arena->size + required_size ) > internal_cache_arena->maximum_size )
+	{
+		frequent_block = internal_cache_arena->last_blocks[ LIBVSMBR_CACHE_ARENA_QUEUE_FREQUENT ];
+		recent_block   = internal_cache_arena->last_blocks[ LIBVSMBR_CACHE_ARENA_QUEUE_RECENT ];
+
+		if( ( recent_block != NULL )
+		 && ( internal_cache_arena->replacement_policy == LIBVSMBR_CACHE_REPLACEMENT_POLICY_TWO_QUEUE )
+		 && ( ( frequent_block == NULL )
+		  ||  ( internal_cache_arena->queue_sizes[ LIBVSMBR_CACHE_ARENA_QUEUE_RECENT ] > maximum_recent_size ) ) )
+		{
+			if( libvsmbr_internal_cache_arena_demote_block(
+			     internal_cache_arena,
+			     recent_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to demote oldest block of recent queue.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else if( frequent_block != NULL )
+		{
+			if( libvsmbr_internal_cache_arena_remove_block(
+			     internal_cache_arena,
+			     frequent_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove least recently used block.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else if( recent_block != NULL )
+		{
+			if( libvsmbr_internal_cache_arena_remove_block(
+			     internal_cache_arena,
+			     recent_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove oldest block of recent queue.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else if( internal_cache_arena->last_blocks[ LIBVSMBR_CACHE_ARENA_QUEUE_GHOST ] != NULL )
+		{
+			/* Only the identifiers of evicted blocks remain
+			 */
+			if( libvsmbr_internal_cache_arena_remove_block(
+			     internal_cache_arena,
+			     internal_cache_arena->last_blocks[ LIBVSMBR_CACHE_ARENA_QUEUE_GHOST ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove oldest block of ghost queue.",
+				 function );
+
+				return( -1 );
+			}
+			continue;
+		}
+		else
+		{
+			break;
+		}
+		*number_of_evicted_blocks += 1;
+	}
+	return( 1 );
+}
+
+/* Removes the blocks of a specific owner
+ * This function is not multi-thread safe acquire mutex before call
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_cache_arena_remove_owner_blocks(
+     libvsmbr_internal_cache_arena_t *internal_cache_arena,
+     uint32_t owner_identifier,
+     libcerror_error_t **error )
+{
+	libvsmbr_cache_arena_block_t *cache_arena_block      = NULL;
+	libvsmbr_cache_arena_block_t *next_cache_arena_block = NULL;
+	static char *function                                = "libvsmbr_internal_cache_arena_remove_owner_blocks";
+	int queue                                            = 0;
+
+	if( internal_cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	for( queue = 0;
+	     queue < LIBVSMBR_CACHE_ARENA_NUMBER_OF_QUEUES;
+	     queue++ )
+	{
+		cache_arena_block = internal_cache_arena->first_blocks[ queue ];
+
+		while( cache_arena_block != NULL )
+		{
+			next_cache_arena_block = cache_arena_block->next_block;
+
+			if( cache_arena_block->owner_identifier == owner_identifier )
+			{
+				if( libvsmbr_internal_cache_arena_remove_block(
+				     internal_cache_arena,
+				     cache_arena_block,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+					 "%s: unable to remove block.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			cache_arena_block = next_cache_arena_block;
+		}
+	}
+	return( 1 );
+}
+
+/* Registers an owner of blocks
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_cache_arena_register_owner(
+     libvsmbr_cache_arena_t *cache_arena,
+     uint32_t *owner_identifier,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_cache_arena_t *internal_cache_arena = NULL;
+	static char *function                                 = "libvsmbr_cache_arena_register_owner";
+
+	if( cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_arena = (libvsmbr_internal_cache_arena_t *) cache_arena;
+
+	if( owner_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid owner identifier.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_cache_arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*owner_identifier = internal_cache_arena->next_owner_identifier;
+
+	internal_cache_arena->next_owner_identifier += 1;
+	internal_cache_arena->number_of_owners      += 1;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_cache_arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Unregisters an owner of blocks and removes its blocks
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_cache_arena_unregister_owner(
+     libvsmbr_cache_arena_t *cache_arena,
+     uint32_t owner_identifier,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_cache_arena_t *internal_cache_arena = NULL;
+	static char *function                                 = "libvsmbr_cache_arena_unregister_owner";
+	int result                                            = 1;
+
+	if( cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_arena = (libvsmbr_internal_cache_arena_t *) cache_arena;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_cache_arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_cache_arena->number_of_owners <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cache arena - number of owners value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		if( libvsmbr_internal_cache_arena_remove_owner_blocks(
+		     internal_cache_arena,
+		     owner_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove blocks of owner: %" PRIu32 ".",
+			 function,
+			 owner_identifier );
+
+			result = -1;
+		}
+		internal_cache_arena->number_of_owners -= 1;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_cache_arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Removes the blocks of a specific owner
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_cache_arena_remove_owner_blocks(
+     libvsmbr_cache_arena_t *cache_arena,
+     uint32_t owner_identifier,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_cache_arena_t *internal_cache_arena = NULL;
+	static char *function                                 = "libvsmbr_cache_arena_remove_owner_blocks";
+	int result                                            = 1;
+
+	if( cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_arena = (libvsmbr_internal_cache_arena_t *) cache_arena;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_cache_arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libvsmbr_internal_cache_arena_remove_owner_blocks(
+	     internal_cache_arena,
+	     owner_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove blocks of owner: %" PRIu32 ".",
+		 function,
+		 owner_identifier );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_cache_arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads data from the block of a specific owner at a specific offset
+ * The data is copied so that the block can be evicted by other owners
+ * once the mutex is released. A block in the frequent queue becomes the
+ * most recently used, a block in the recent queue retains its position
+ * so that repeated reads of the same block are not counted as reuse
+ * Returns 1 if successful, 0 if no such block or -1 on error
+ */
+int libvsmbr_cache_arena_read_block(
+     libvsmbr_cache_arena_t *cache_arena,
+     uint32_t owner_identifier,
+     off64_t offset,
+     size_t data_offset,
+     uint8_t *buffer,
+     size_t buffer_size,
+     size_t *read_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_cache_arena_block_t *cache_arena_block       = NULL;
+	libvsmbr_internal_cache_arena_t *internal_cache_arena = NULL;
+	static char *function                                 = "libvsmbr_cache_arena_read_block";
+	size_t data_size                                      = 0;
+	int result                                            = 0;
+
+	if( cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_arena = (libvsmbr_internal_cache_arena_t *) cache_arena;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_cache_arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libvsmbr_internal_cache_arena_get_block(
+	          internal_cache_arena,
+	          owner_identifier,
+	          offset,
+	          &cache_arena_block,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		goto on_error;
+	}
+	else if( ( result != 0 )
+	      && ( cache_arena_block->queue == LIBVSMBR_CACHE_ARENA_QUEUE_GHOST ) )
+	{
+		/* Only the identifier of the block is retained
+		 */
+		result = 0;
+	}
+	else if( result != 0 )
+	{
+		if( data_offset >= cache_arena_block->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data offset value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		data_size = cache_arena_block->data_size - data_offset;
+
+		if( data_size > buffer_size )
+		{
+			data_size = buffer_size;
+		}
+		if( memory_copy(
+		     buffer,
+		     &( cache_arena_block->data[ data_offset ] ),
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy block data.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( cache_arena_block->queue == LIBVSMBR_CACHE_ARENA_QUEUE_FREQUENT )
+		 && ( cache_arena_block != internal_cache_arena->first_blocks[ LIBVSMBR_CACHE_ARENA_QUEUE_FREQUENT ] ) )
+		{
+			if( libvsmbr_internal_cache_arena_unlink_block(
+			     internal_cache_arena,
+			     cache_arena_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to unlink block.",
+				 function );
+
+				goto on_error;
+			}
+			if( libvsmbr_internal_cache_arena_link_block(
+			     internal_cache_arena,
+			     cache_arena_block,
+			     LIBVSMBR_CACHE_ARENA_QUEUE_FREQUENT,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to link block.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		*read_size = data_size;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_cache_arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 internal_cache_arena->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Inserts a copy of the data of a block of a specific owner at a specific offset
+ * Blocks of all owners are evicted according to the replacement policy when
+ * needed to stay within the maximum size. A block that is larger than the
+ * maximum size is not cached
+ *
+ * A block that is inserted with the low priority flag, such as a block read by
+ * a scan, is not a reference. It does not replace a block that is already cached
+ * or retained in the ghost queue and it is appended as the block of its queue
+ * that is evicted first, so that it does not flush the blocks that are in use
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_cache_arena_insert_block(
+     libvsmbr_cache_arena_t *cache_arena,
+     uint32_t owner_identifier,
+     off64_t offset,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t insert_flags,
+     uint8_t *evicted_blocks,
+     libcerror_error_t **error )
+{
+	libvsmbr_cache_arena_block_t *cache_arena_block       = NULL;
+	libvsmbr_internal_cache_arena_t *internal_cache_arena = NULL;
+	static char *function                                 = "libvsmbr_cache_arena_insert_block";
+	size64_t block_size                                   = 0;
+	uint8_t queue                                         = LIBVSMBR_CACHE_ARENA_QUEUE_FREQUENT;
+	int bucket_index                                      = 0;
+	int number_of_evicted_blocks                          = 0;
+	int result                                            = 0;
+
+	if( cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_arena = (libvsmbr_internal_cache_arena_t *) cache_arena;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( insert_flags & ~( LIBVSMBR_CACHE_ARENA_INSERT_FLAG_LOW_PRIORITY ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported insert flags: 0x%02" PRIx8 ".",
+		 function,
+		 insert_flags );
+
+		return( -1 );
+	}
+	if( evicted_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid evicted blocks.",
+		 function );
+
+		return( -1 );
+	}
+	block_size = sizeof( libvsmbr_cache_arena_block_t ) + data_size;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_cache_arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*evicted_blocks = 0;
+
+	if( internal_cache_arena->replacement_policy == LIBVSMBR_CACHE_REPLACEMENT_POLICY_TWO_QUEUE )
+	{
+		queue = LIBVSMBR_CACHE_ARENA_QUEUE_RECENT;
+	}
+	result = libvsmbr_internal_cache_arena_get_block(
+	          internal_cache_arena,
+	          owner_identifier,
+	          offset,
+	          &cache_arena_block,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		goto on_error;
+	}
+	else if( ( result != 0 )
+	      && ( ( insert_flags & LIBVSMBR_CACHE_ARENA_INSERT_FLAG_LOW_PRIORITY ) != 0 ) )
+	{
+		/* The cached block or its retained identifier is left as is
+		 * and no block is inserted
+		 */
+		block_size = 0;
+	}
+	else if( result != 0 )
+	{
+		/* A block that was evicted from the recent queue and is referenced
+		 * again is kept in the frequent queue, a block that is replaced
+		 * retains its queue
+		 */
+		if( cache_arena_block->queue != LIBVSMBR_CACHE_ARENA_QUEUE_RECENT )
+		{
+			queue = LIBVSMBR_CACHE_ARENA_QUEUE_FREQUENT;
+		}
+		/* Replace the block so the most recent data is cached
+		 */
+		if( libvsmbr_internal_cache_arena_remove_block(
+		     internal_cache_arena,
+		     cache_arena_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			cache_arena_block = NULL;
+
+			goto on_error;
+		}
+		cache_arena_block = NULL;
+	}
+	if( ( block_size > 0 )
+	 && ( block_size <= internal_cache_arena->maximum_size ) )
+	{
+		if( libvsmbr_internal_cache_arena_evict_blocks(
+		     internal_cache_arena,
+		     block_size,
+		     &number_of_evicted_blocks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to evict blocks.",
+			 function );
+
+			goto on_error;
+		}
+		if( libvsmbr_cache_arena_block_initialize(
+		     &cache_arena_block,
+		     owner_identifier,
+		     offset,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create block.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     cache_arena_block->data,
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy block data.",
+			 function );
+
+			goto on_error;
+		}
+		bucket_index = libvsmbr_cache_arena_get_bucket_index(
+		                owner_identifier,
+		                offset );
+
+		if( ( insert_flags & LIBVSMBR_CACHE_ARENA_INSERT_FLAG_LOW_PRIORITY ) != 0 )
+		{
+			result = libvsmbr_internal_cache_arena_append_block(
+			          internal_cache_arena,
+			          cache_arena_block,
+			          queue,
+			          error );
+		}
+		else
+		{
+			result = libvsmbr_internal_cache_arena_link_block(
+			          internal_cache_arena,
+			          cache_arena_block,
+			          queue,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to link block.",
+			 function );
+
+			goto on_error;
+		}
+		cache_arena_block->next_in_bucket = internal_cache_arena->buckets[ bucket_index ];
+
+		internal_cache_arena->buckets[ bucket_index ] = cache_arena_block;
+
+		internal_cache_arena->size             += block_size;
+		internal_cache_arena->number_of_blocks += 1;
+
+		*evicted_blocks = (uint8_t) ( number_of_evicted_blocks > 0 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_cache_arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( cache_arena_block != NULL )
+	{
+		libvsmbr_cache_arena_block_free(
+		 &cache_arena_block,
+		 NULL );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 internal_cache_arena->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
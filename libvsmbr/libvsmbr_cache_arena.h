@@ -0,0 +1,245 @@
+/*
+ * Cache arena functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSMBR_CACHE_ARENA_H )
+#define _LIBVSMBR_CACHE_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsmbr_cache_arena_block.h"
+#include "libvsmbr_definitions.h"
+#include "libvsmbr_extern.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_libcthreads.h"
+#include "libvsmbr_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsmbr_internal_cache_arena libvsmbr_internal_cache_arena_t;
+
+/* The cache arena holds the cached sector data of the partitions of all
+ * volumes it is set on, within a single byte budget. When the budget is
+ * exceeded blocks are evicted according to the replacement policy,
+ * regardless of the partition they belong to
+ *
+ * With the least recently used policy all blocks are kept in the frequent
+ * queue. With the two queue (2Q) policy a block that is inserted is kept
+ * in the recent queue, which is evicted first in FIFO order once it exceeds
+ * its share of the budget. The identifier of a block that is evicted from
+ * the recent queue is retained in the ghost queue. A block that is inserted
+ * while it is in the ghost queue was referenced again and is kept in the
+ * frequent queue, which is evicted in least recently used order. A single
+ * sequential pass therefore does not evict the blocks in the frequent queue
+ */
+struct libvsmbr_internal_cache_arena
+{
+	/* The maximum size in bytes
+	 */
+	size64_t maximum_size;
+
+	/* The size in bytes of the cached blocks, including their bookkeeping
+	 */
+	size64_t size;
+
+	/* The replacement policy
+	 */
+	int replacement_policy;
+
+	/* The hash buckets of the blocks
+	 */
+	libvsmbr_cache_arena_block_t **buckets;
+
+	/* The most recently used block of each queue
+	 */
+	libvsmbr_cache_arena_block_t *first_blocks[ LIBVSMBR_CACHE_ARENA_NUMBER_OF_QUEUES ];
+
+	/* The least recently used block of each queue
+	 */
+	libvsmbr_cache_arena_block_t *last_blocks[ LIBVSMBR_CACHE_ARENA_NUMBER_OF_QUEUES ];
+
+	/* The size in bytes of the blocks of each queue, including their bookkeeping
+	 */
+	size64_t queue_sizes[ LIBVSMBR_CACHE_ARENA_NUMBER_OF_QUEUES ];
+
+	/* The number of blocks of each queue
+	 */
+	int queue_number_of_blocks[ LIBVSMBR_CACHE_ARENA_NUMBER_OF_QUEUES ];
+
+	/* The number of blocks, not including the blocks in the ghost queue
+	 */
+	int number_of_blocks;
+
+	/* The number of registered owners
+	 */
+	int number_of_owners;
+
+	/* The identifier of the next owner that is registered
+	 */
+	uint32_t next_owner_identifier;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+LIBVSMBR_EXTERN \
+int libvsmbr_cache_arena_initialize(
+     libvsmbr_cache_arena_t **cache_arena,
+     size64_t maximum_size,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_cache_arena_free(
+     libvsmbr_cache_arena_t **cache_arena,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_cache_arena_get_maximum_size(
+     libvsmbr_cache_arena_t *cache_arena,
+     size64_t *maximum_size,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_cache_arena_set_maximum_size(
+     libvsmbr_cache_arena_t *cache_arena,
+     size64_t maximum_size,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_cache_arena_get_size(
+     libvsmbr_cache_arena_t *cache_arena,
+     size64_t *size,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_cache_arena_get_number_of_blocks(
+     libvsmbr_cache_arena_t *cache_arena,
+     int *number_of_blocks,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_cache_arena_get_replacement_policy(
+     libvsmbr_cache_arena_t *cache_arena,
+     int *replacement_policy,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_cache_arena_set_replacement_policy(
+     libvsmbr_cache_arena_t *cache_arena,
+     int replacement_policy,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_cache_arena_unlink_block(
+     libvsmbr_internal_cache_arena_t *internal_cache_arena,
+     libvsmbr_cache_arena_block_t *cache_arena_block,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_cache_arena_link_block(
+     libvsmbr_internal_cache_arena_t *internal_cache_arena,
+     libvsmbr_cache_arena_block_t *cache_arena_block,
+     uint8_t queue,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_cache_arena_append_block(
+     libvsmbr_internal_cache_arena_t *internal_cache_arena,
+     libvsmbr_cache_arena_block_t *cache_arena_block,
+     uint8_t queue,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_cache_arena_get_block(
+     libvsmbr_internal_cache_arena_t *internal_cache_arena,
+     uint32_t owner_identifier,
+     off64_t offset,
+     libvsmbr_cache_arena_block_t **cache_arena_block,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_cache_arena_remove_block(
+     libvsmbr_internal_cache_arena_t *internal_cache_arena,
+     libvsmbr_cache_arena_block_t *cache_arena_block,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_cache_arena_demote_block(
+     libvsmbr_internal_cache_arena_t *internal_cache_arena,
+     libvsmbr_cache_arena_block_t *cache_arena_block,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_cache_arena_remove_queue_blocks(
+     libvsmbr_internal_cache_arena_t *internal_cache_arena,
+     uint8_t queue,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_cache_arena_evict_blocks(
+     libvsmbr_internal_cache_arena_t *internal_cache_arena,
+     size64_t required_size,
+     int *number_of_evicted_blocks,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_cache_arena_remove_owner_blocks(
+     libvsmbr_internal_cache_arena_t *internal_cache_arena,
+     uint32_t owner_identifier,
+     libcerror_error_t **error );
+
+int libvsmbr_cache_arena_register_owner(
+     libvsmbr_cache_arena_t *cache_arena,
+     uint32_t *owner_identifier,
+     libcerror_error_t **error );
+
+int libvsmbr_cache_arena_unregister_owner(
+     libvsmbr_cache_arena_t *cache_arena,
+     uint32_t owner_identifier,
+     libcerror_error_t **error );
+
+int libvsmbr_cache_arena_remove_owner_blocks(
+     libvsmbr_cache_arena_t *cache_arena,
+     uint32_t owner_identifier,
+     libcerror_error_t **error );
+
+int libvsmbr_cache_arena_read_block(
+     libvsmbr_cache_arena_t *cache_arena,
+     uint32_t owner_identifier,
+     off64_t offset,
+     size_t data_offset,
+     uint8_t *buffer,
+     size_t buffer_size,
+     size_t *read_size,
+     libcerror_error_t **error );
+
+int libvsmbr_cache_arena_insert_block(
+     libvsmbr_cache_arena_t *cache_arena,
+     uint32_t owner_identifier,
+     off64_t offset,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t insert_flags,
+     uint8_t *evicted_blocks,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSMBR_CACHE_ARENA_H ) */
+
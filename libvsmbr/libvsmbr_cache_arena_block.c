@@ -0,0 +1,187 @@
+/*
+ * Cache arena block functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsmbr_cache_arena_block.h"
+#include "libvsmbr_libcerror.h"
+
+/* Creates a cache arena block
+ * Make sure the value cache_arena_block is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_cache_arena_block_initialize(
+     libvsmbr_cache_arena_block_t **cache_arena_block,
+     uint32_t owner_identifier,
+     off64_t offset,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_cache_arena_block_initialize";
+
+	if( cache_arena_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena block.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_arena_block != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cache arena block value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*cache_arena_block = memory_allocate_structure(
+	                      libvsmbr_cache_arena_block_t );
+
+	if( *cache_arena_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache arena block.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *cache_arena_block,
+	     0,
+	     sizeof( libvsmbr_cache_arena_block_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache arena block.",
+		 function );
+
+		memory_free(
+		 *cache_arena_block );
+
+		*cache_arena_block = NULL;
+
+		return( -1 );
+	}
+	( *cache_arena_block )->data = (uint8_t *) memory_allocate(
+	                                            sizeof( uint8_t ) * data_size );
+
+	if( ( *cache_arena_block )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	( *cache_arena_block )->owner_identifier = owner_identifier;
+	( *cache_arena_block )->offset           = offset;
+	( *cache_arena_block )->data_size        = data_size;
+
+	return( 1 );
+
+on_error:
+	if( *cache_arena_block != NULL )
+	{
+		memory_free(
+		 *cache_arena_block );
+
+		*cache_arena_block = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a cache arena block
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_cache_arena_block_free(
+     libvsmbr_cache_arena_block_t **cache_arena_block,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_cache_arena_block_free";
+
+	if( cache_arena_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena block.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_arena_block != NULL )
+	{
+		/* The data of a block that is retained after eviction has been freed
+		 */
+		if( ( *cache_arena_block )->data != NULL )
+		{
+			memory_free(
+			 ( *cache_arena_block )->data );
+		}
+		memory_free(
+		 *cache_arena_block );
+
+		*cache_arena_block = NULL;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,87 @@
+/*
+ * Cache arena block functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSMBR_CACHE_ARENA_BLOCK_H )
+#define _LIBVSMBR_CACHE_ARENA_BLOCK_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsmbr_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsmbr_cache_arena_block libvsmbr_cache_arena_block_t;
+
+struct libvsmbr_cache_arena_block
+{
+	/* The identifier of the owner of the block
+	 */
+	uint32_t owner_identifier;
+
+	/* The offset of the block relative to the start of the owner
+	 */
+	off64_t offset;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The queue that contains the block
+	 */
+	uint8_t queue;
+
+	/* The next block in the same hash bucket
+	 */
+	libvsmbr_cache_arena_block_t *next_in_bucket;
+
+	/* The previous (more recently used) block in the same queue
+	 */
+	libvsmbr_cache_arena_block_t *previous_block;
+
+	/* The next (less recently used) block in the same queue
+	 */
+	libvsmbr_cache_arena_block_t *next_block;
+};
+
+int libvsmbr_cache_arena_block_initialize(
+     libvsmbr_cache_arena_block_t **cache_arena_block,
+     uint32_t owner_identifier,
+     off64_t offset,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libvsmbr_cache_arena_block_free(
+     libvsmbr_cache_arena_block_t **cache_arena_block,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSMBR_CACHE_ARENA_BLOCK_H ) */
+
@@ -0,0 +1,1033 @@
+/*
+ * Chunk reader functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsmbr_chunk_reader.h"
+#include "libvsmbr_definitions.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_libcthreads.h"
+#include "libvsmbr_partition.h"
+#include "libvsmbr_types.h"
+
+/* Creates a chunk reader
+ * Make sure the value chunk_reader is referencing, is set to NULL
+ * The chunks are read into a ring of number_of_buffers buffers, if multi-threading
+ * is supported and more than 1 buffer is used a thread reads ahead
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_chunk_reader_initialize(
+     libvsmbr_chunk_reader_t **chunk_reader,
+     libvsmbr_partition_t *partition,
+     size_t chunk_size,
+     int number_of_buffers,
+     off64_t start_offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_chunk_reader_t *internal_chunk_reader = NULL;
+	static char *function                                   = "libvsmbr_chunk_reader_initialize";
+	size64_t partition_size                                 = 0;
+	int buffer_index                                        = 0;
+
+	if( chunk_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_reader != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk reader value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_size == 0 )
+	 || ( chunk_size > (size_t) LIBVSMBR_MAXIMUM_CHUNK_READER_CHUNK_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported chunk size: %" PRIzd ".",
+		 function,
+		 chunk_size );
+
+		return( -1 );
+	}
+	if( ( number_of_buffers < 1 )
+	 || ( number_of_buffers > LIBVSMBR_MAXIMUM_CHUNK_READER_NUMBER_OF_BUFFERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of buffers: %d.",
+		 function,
+		 number_of_buffers );
+
+		return( -1 );
+	}
+	if( ( start_offset < 0 )
+	 || ( size > (size64_t) ( INT64_MAX - start_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid start offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_partition_get_size(
+	     partition,
+	     &partition_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition size.",
+		 function );
+
+		return( -1 );
+	}
+	internal_chunk_reader = memory_allocate_structure(
+	                         libvsmbr_internal_chunk_reader_t );
+
+	if( internal_chunk_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_chunk_reader,
+	     0,
+	     sizeof( libvsmbr_internal_chunk_reader_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk reader.",
+		 function );
+
+		memory_free(
+		 internal_chunk_reader );
+
+		return( -1 );
+	}
+	internal_chunk_reader->buffers = (uint8_t **) memory_allocate(
+	                                               sizeof( uint8_t * ) * (size_t) number_of_buffers );
+
+	if( internal_chunk_reader->buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_chunk_reader->buffers,
+	     0,
+	     sizeof( uint8_t * ) * (size_t) number_of_buffers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffers.",
+		 function );
+
+		goto on_error;
+	}
+	/* The buffers are allocated separately so that the buffer held by the caller
+	 * can be detached
+	 */
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		internal_chunk_reader->buffers[ buffer_index ] = (uint8_t *) memory_allocate(
+		                                                              sizeof( uint8_t ) * chunk_size );
+
+		if( internal_chunk_reader->buffers[ buffer_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+	}
+	internal_chunk_reader->data_sizes = (size_t *) memory_allocate(
+	                                                sizeof( size_t ) * (size_t) number_of_buffers );
+
+	if( internal_chunk_reader->data_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data sizes.",
+		 function );
+
+		goto on_error;
+	}
+	internal_chunk_reader->partition         = partition;
+	internal_chunk_reader->chunk_size        = chunk_size;
+	internal_chunk_reader->number_of_buffers = number_of_buffers;
+	internal_chunk_reader->read_offset       = start_offset;
+	internal_chunk_reader->end_offset        = start_offset + (off64_t) size;
+	internal_chunk_reader->error_offset      = -1;
+
+	if( (size64_t) internal_chunk_reader->end_offset > partition_size )
+	{
+		internal_chunk_reader->end_offset = (off64_t) partition_size;
+	}
+	if( internal_chunk_reader->read_offset > internal_chunk_reader->end_offset )
+	{
+		internal_chunk_reader->read_offset = internal_chunk_reader->end_offset;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	/* A single buffer is held by the caller, which leaves no buffer to read ahead into
+	 */
+	if( number_of_buffers > 1 )
+	{
+		if( libcthreads_mutex_initialize(
+		     &( internal_chunk_reader->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_condition_initialize(
+		     &( internal_chunk_reader->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize condition.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_thread_create(
+		     &( internal_chunk_reader->read_ahead_thread ),
+		     NULL,
+		     (int (*)(void *)) &libvsmbr_internal_chunk_reader_read_ahead_callback,
+		     (void *) internal_chunk_reader,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read-ahead thread.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	*chunk_reader = (libvsmbr_chunk_reader_t *) internal_chunk_reader;
+
+	return( 1 );
+
+on_error:
+	if( internal_chunk_reader != NULL )
+	{
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+		if( internal_chunk_reader->condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( internal_chunk_reader->condition ),
+			 NULL );
+		}
+		if( internal_chunk_reader->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_chunk_reader->mutex ),
+			 NULL );
+		}
+#endif
+		if( internal_chunk_reader->data_sizes != NULL )
+		{
+			memory_free(
+			 internal_chunk_reader->data_sizes );
+		}
+		if( internal_chunk_reader->buffers != NULL )
+		{
+			for( buffer_index = 0;
+			     buffer_index < number_of_buffers;
+			     buffer_index++ )
+			{
+				if( internal_chunk_reader->buffers[ buffer_index ] != NULL )
+				{
+					memory_free(
+					 internal_chunk_reader->buffers[ buffer_index ] );
+				}
+			}
+			memory_free(
+			 internal_chunk_reader->buffers );
+		}
+		memory_free(
+		 internal_chunk_reader );
+	}
+	return( -1 );
+}
+
+/* Frees a chunk reader
+ * Stops and joins the read-ahead thread
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_chunk_reader_free(
+     libvsmbr_chunk_reader_t **chunk_reader,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_chunk_reader_t *internal_chunk_reader = NULL;
+	static char *function                                   = "libvsmbr_chunk_reader_free";
+	int buffer_index                                        = 0;
+	int result                                              = 1;
+
+	if( chunk_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_reader != NULL )
+	{
+		internal_chunk_reader = (libvsmbr_internal_chunk_reader_t *) *chunk_reader;
+		*chunk_reader         = NULL;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+		if( internal_chunk_reader->read_ahead_thread != NULL )
+		{
+			if( libcthreads_mutex_grab(
+			     internal_chunk_reader->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab mutex.",
+				 function );
+
+				return( -1 );
+			}
+			internal_chunk_reader->abort = 1;
+
+			if( libcthreads_condition_broadcast(
+			     internal_chunk_reader->condition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to broadcast condition.",
+				 function );
+
+				result = -1;
+			}
+			if( libcthreads_mutex_release(
+			     internal_chunk_reader->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release mutex.",
+				 function );
+
+				return( -1 );
+			}
+			/* A failed join signals that the read-ahead thread
+			 * ended with an error, the thread has ended regardless
+			 */
+			if( libcthreads_thread_join(
+			     &( internal_chunk_reader->read_ahead_thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join read-ahead thread.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_chunk_reader->condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( internal_chunk_reader->condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_chunk_reader->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( internal_chunk_reader->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( internal_chunk_reader->read_error != NULL )
+		{
+			libcerror_error_free(
+			 &( internal_chunk_reader->read_error ) );
+		}
+		memory_free(
+		 internal_chunk_reader->data_sizes );
+
+		for( buffer_index = 0;
+		     buffer_index < internal_chunk_reader->number_of_buffers;
+		     buffer_index++ )
+		{
+			memory_free(
+			 internal_chunk_reader->buffers[ buffer_index ] );
+		}
+		memory_free(
+		 internal_chunk_reader->buffers );
+
+		memory_free(
+		 internal_chunk_reader );
+	}
+	return( result );
+}
+
+/* Reads a chunk into a specific buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_chunk_reader_read_chunk(
+     libvsmbr_internal_chunk_reader_t *internal_chunk_reader,
+     int buffer_index,
+     off64_t chunk_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_internal_chunk_reader_read_chunk";
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+
+	if( internal_chunk_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_index < 0 )
+	 || ( buffer_index >= internal_chunk_reader->number_of_buffers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_offset < 0 )
+	 || ( chunk_offset >= internal_chunk_reader->end_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_size = internal_chunk_reader->chunk_size;
+
+	if( (size64_t) read_size > (size64_t) ( internal_chunk_reader->end_offset - chunk_offset ) )
+	{
+		read_size = (size_t) ( internal_chunk_reader->end_offset - chunk_offset );
+	}
+	/* The current offset of the partition is not changed so that
+	 * the chunks can be read alongside other reads of the partition
+	 */
+	read_count = libvsmbr_internal_partition_read_buffer_at_offset(
+	              (libvsmbr_internal_partition_t *) internal_chunk_reader->partition,
+	              internal_chunk_reader->buffers[ buffer_index ],
+	              read_size,
+	              chunk_offset,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 chunk_offset,
+		 chunk_offset );
+
+		return( -1 );
+	}
+	internal_chunk_reader->data_sizes[ buffer_index ] = read_size;
+
+	return( 1 );
+}
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+
+/* Reads chunks ahead into the free buffers of the ring
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_chunk_reader_read_ahead_callback(
+     libvsmbr_internal_chunk_reader_t *internal_chunk_reader )
+{
+	off64_t chunk_offset = 0;
+	int buffer_index     = 0;
+	int result           = 1;
+
+	if( internal_chunk_reader == NULL )
+	{
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_chunk_reader->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	while( ( result == 1 )
+	    && ( internal_chunk_reader->abort == 0 )
+	    && ( internal_chunk_reader->read_offset < internal_chunk_reader->end_offset ) )
+	{
+		/* The buffer held by the caller cannot be reused
+		 */
+		if( ( internal_chunk_reader->number_of_filled_buffers + internal_chunk_reader->has_held_buffer ) >= internal_chunk_reader->number_of_buffers )
+		{
+			if( libcthreads_condition_wait(
+			     internal_chunk_reader->condition,
+			     internal_chunk_reader->mutex,
+			     NULL ) != 1 )
+			{
+				result = -1;
+			}
+			continue;
+		}
+		buffer_index = internal_chunk_reader->fill_index;
+		chunk_offset = internal_chunk_reader->read_offset;
+
+		if( libcthreads_mutex_release(
+		     internal_chunk_reader->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		result = libvsmbr_internal_chunk_reader_read_chunk(
+		          internal_chunk_reader,
+		          buffer_index,
+		          chunk_offset,
+		          &( internal_chunk_reader->read_error ) );
+
+		if( libcthreads_mutex_grab(
+		     internal_chunk_reader->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		/* The read error is passed on by libvsmbr_chunk_reader_get_next_chunk
+		 * and is not considered a failure of the thread
+		 */
+		if( result != 1 )
+		{
+			internal_chunk_reader->error_offset = chunk_offset;
+
+			result = 1;
+
+			break;
+		}
+		internal_chunk_reader->fill_index   = ( buffer_index + 1 ) % internal_chunk_reader->number_of_buffers;
+		internal_chunk_reader->read_offset += (off64_t) internal_chunk_reader->data_sizes[ buffer_index ];
+
+		internal_chunk_reader->number_of_filled_buffers += 1;
+
+		if( libcthreads_condition_broadcast(
+		     internal_chunk_reader->condition,
+		     NULL ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( ( result != 1 )
+	 && ( internal_chunk_reader->error_offset == -1 ) )
+	{
+		internal_chunk_reader->error_offset = internal_chunk_reader->read_offset;
+	}
+	internal_chunk_reader->is_finished = 1;
+
+	if( libcthreads_condition_broadcast(
+	     internal_chunk_reader->condition,
+	     NULL ) != 1 )
+	{
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     internal_chunk_reader->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT ) */
+
+/* Retrieves the next chunk
+ * The data remains valid until the next call or until the chunk reader is freed
+ * Returns 1 if successful, 0 if no more chunks are available or -1 on error
+ */
+int libvsmbr_chunk_reader_get_next_chunk(
+     libvsmbr_chunk_reader_t *chunk_reader,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_chunk_reader_t *internal_chunk_reader = NULL;
+	static char *function                                   = "libvsmbr_chunk_reader_get_next_chunk";
+	off64_t error_offset                                    = -1;
+	int buffer_index                                        = 0;
+	int result                                              = 0;
+
+	if( chunk_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk reader.",
+		 function );
+
+		return( -1 );
+	}
+	internal_chunk_reader = (libvsmbr_internal_chunk_reader_t *) chunk_reader;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( internal_chunk_reader->read_ahead_thread != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     internal_chunk_reader->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+		/* Hand the buffer of the previous chunk back to the read-ahead thread
+		 */
+		internal_chunk_reader->has_held_buffer = 0;
+
+		if( libcthreads_condition_broadcast(
+		     internal_chunk_reader->condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			result = -1;
+		}
+		while( ( result == 0 )
+		    && ( internal_chunk_reader->number_of_filled_buffers == 0 )
+		    && ( internal_chunk_reader->is_finished == 0 ) )
+		{
+			if( libcthreads_condition_wait(
+			     internal_chunk_reader->condition,
+			     internal_chunk_reader->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( result == 0 )
+		{
+			if( internal_chunk_reader->number_of_filled_buffers > 0 )
+			{
+				buffer_index = internal_chunk_reader->consume_index;
+
+				internal_chunk_reader->consume_index = ( buffer_index + 1 ) % internal_chunk_reader->number_of_buffers;
+
+				internal_chunk_reader->number_of_filled_buffers -= 1;
+				internal_chunk_reader->has_held_buffer           = 1;
+				internal_chunk_reader->held_buffer_index         = buffer_index;
+
+				*data      = internal_chunk_reader->buffers[ buffer_index ];
+				*data_size = internal_chunk_reader->data_sizes[ buffer_index ];
+
+				result = 1;
+			}
+			else if( internal_chunk_reader->error_offset != -1 )
+			{
+				error_offset = internal_chunk_reader->error_offset;
+
+				/* Pass the error of the read-ahead thread on to the caller
+				 */
+				if( ( error != NULL )
+				 && ( *error == NULL ) )
+				{
+					*error = internal_chunk_reader->read_error;
+
+					internal_chunk_reader->read_error = NULL;
+				}
+				result = -1;
+			}
+		}
+		if( libcthreads_mutex_release(
+		     internal_chunk_reader->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+		if( error_offset != -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 error_offset,
+			 error_offset );
+		}
+		return( result );
+	}
+#endif /* defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT ) */
+
+	internal_chunk_reader->has_held_buffer = 0;
+
+	if( internal_chunk_reader->read_offset >= internal_chunk_reader->end_offset )
+	{
+		return( 0 );
+	}
+	if( libvsmbr_internal_chunk_reader_read_chunk(
+	     internal_chunk_reader,
+	     0,
+	     internal_chunk_reader->read_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 internal_chunk_reader->read_offset,
+		 internal_chunk_reader->read_offset );
+
+		return( -1 );
+	}
+	internal_chunk_reader->read_offset += (off64_t) internal_chunk_reader->data_sizes[ 0 ];
+
+	internal_chunk_reader->has_held_buffer   = 1;
+	internal_chunk_reader->held_buffer_index = 0;
+
+	*data      = internal_chunk_reader->buffers[ 0 ];
+	*data_size = internal_chunk_reader->data_sizes[ 0 ];
+
+	return( 1 );
+}
+
+/* Detaches the data of the chunk that was last retrieved
+ * The chunk reader continues with a newly allocated buffer, which allows the data
+ * to remain valid after the next call, free the data with libvsmbr_chunk_reader_free_chunk_data
+ * Returns 1 if successful, 0 if no chunk was retrieved or -1 on error
+ */
+int libvsmbr_chunk_reader_detach_chunk_data(
+     libvsmbr_chunk_reader_t *chunk_reader,
+     uint8_t **data,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_chunk_reader_t *internal_chunk_reader = NULL;
+	uint8_t *buffer                                         = NULL;
+	static char *function                                   = "libvsmbr_chunk_reader_detach_chunk_data";
+	int result                                              = 0;
+
+	if( chunk_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk reader.",
+		 function );
+
+		return( -1 );
+	}
+	internal_chunk_reader = (libvsmbr_internal_chunk_reader_t *) chunk_reader;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * internal_chunk_reader->chunk_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( internal_chunk_reader->read_ahead_thread != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     internal_chunk_reader->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			memory_free(
+			 buffer );
+
+			return( -1 );
+		}
+	}
+#endif
+	/* The read-ahead thread does not read into the buffer held by the caller
+	 */
+	if( internal_chunk_reader->has_held_buffer != 0 )
+	{
+		*data = internal_chunk_reader->buffers[ internal_chunk_reader->held_buffer_index ];
+
+		internal_chunk_reader->buffers[ internal_chunk_reader->held_buffer_index ] = buffer;
+		internal_chunk_reader->has_held_buffer                                      = 0;
+
+		buffer = NULL;
+		result = 1;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( internal_chunk_reader->read_ahead_thread != NULL )
+	{
+		if( libcthreads_condition_broadcast(
+		     internal_chunk_reader->condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_release(
+		     internal_chunk_reader->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( result );
+}
+
+/* Frees the data of a chunk detached by libvsmbr_chunk_reader_detach_chunk_data
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_chunk_reader_free_chunk_data(
+     uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_chunk_reader_free_chunk_data";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data != NULL )
+	{
+		memory_free(
+		 *data );
+
+		*data = NULL;
+	}
+	return( 1 );
+}
+
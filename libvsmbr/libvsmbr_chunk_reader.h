@@ -0,0 +1,171 @@
+/*
+ * Chunk reader functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSMBR_CHUNK_READER_H )
+#define _LIBVSMBR_CHUNK_READER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsmbr_extern.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_libcthreads.h"
+#include "libvsmbr_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsmbr_internal_chunk_reader libvsmbr_internal_chunk_reader_t;
+
+struct libvsmbr_internal_chunk_reader
+{
+	/* The partition
+	 */
+	libvsmbr_partition_t *partition;
+
+	/* The chunk size
+	 */
+	size_t chunk_size;
+
+	/* The number of buffers in the ring
+	 */
+	int number_of_buffers;
+
+	/* The buffers, number_of_buffers buffers of chunk size
+	 */
+	uint8_t **buffers;
+
+	/* The data sizes of the chunks in the buffers
+	 */
+	size_t *data_sizes;
+
+	/* The offset of the next chunk to read
+	 */
+	off64_t read_offset;
+
+	/* The end offset
+	 */
+	off64_t end_offset;
+
+	/* The index of the buffer the next chunk is read into
+	 */
+	int fill_index;
+
+	/* The index of the buffer of the next chunk returned
+	 */
+	int consume_index;
+
+	/* The number of read chunks that have not been returned
+	 */
+	int number_of_filled_buffers;
+
+	/* Value to indicate a buffer is held by the caller
+	 */
+	uint8_t has_held_buffer;
+
+	/* The index of the buffer held by the caller
+	 */
+	int held_buffer_index;
+
+	/* Value to indicate all chunks have been read
+	 */
+	uint8_t is_finished;
+
+	/* Value to indicate the read-ahead thread should stop
+	 */
+	uint8_t abort;
+
+	/* The offset of the chunk that failed to read or -1 if none
+	 */
+	off64_t error_offset;
+
+	/* The error of the read-ahead thread
+	 */
+	libcerror_error_t *read_error;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	/* The read-ahead thread
+	 */
+	libcthreads_thread_t *read_ahead_thread;
+
+	/* The mutex that protects the ring state
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that signals changes of the ring state
+	 */
+	libcthreads_condition_t *condition;
+#endif
+};
+
+LIBVSMBR_EXTERN \
+int libvsmbr_chunk_reader_initialize(
+     libvsmbr_chunk_reader_t **chunk_reader,
+     libvsmbr_partition_t *partition,
+     size_t chunk_size,
+     int number_of_buffers,
+     off64_t start_offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_chunk_reader_free(
+     libvsmbr_chunk_reader_t **chunk_reader,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_chunk_reader_read_chunk(
+     libvsmbr_internal_chunk_reader_t *internal_chunk_reader,
+     int buffer_index,
+     off64_t chunk_offset,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+
+int libvsmbr_internal_chunk_reader_read_ahead_callback(
+     libvsmbr_internal_chunk_reader_t *internal_chunk_reader );
+
+#endif
+
+LIBVSMBR_EXTERN \
+int libvsmbr_chunk_reader_get_next_chunk(
+     libvsmbr_chunk_reader_t *chunk_reader,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_chunk_reader_detach_chunk_data(
+     libvsmbr_chunk_reader_t *chunk_reader,
+     uint8_t **data,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_chunk_reader_free_chunk_data(
+     uint8_t **data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSMBR_CHUNK_READER_H ) */
+
@@ -0,0 +1,2384 @@
+/*
+ * Compressed image IO handle functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsmbr_checksum.h"
+#include "libvsmbr_compressed_io_handle.h"
+#include "libvsmbr_definitions.h"
+#include "libvsmbr_deflate.h"
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_libcthreads.h"
+#include "libvsmbr_unused.h"
+
+#include "vsmbr_gzip_member.h"
+
+/* The maximum supported size of the extra field of a member header
+ */
+#define LIBVSMBR_COMPRESSED_MAXIMUM_EXTRA_FIELD_SIZE	256
+
+/* Retrieves the index of the cache entry that contains a frame
+ * Returns the index of the cache entry or -1 if the frame is not cached
+ */
+static int libvsmbr_compressed_io_handle_get_cached_frame(
+            libvsmbr_compressed_io_handle_t *compressed_io_handle,
+            int frame_index )
+{
+	int cache_index = 0;
+
+	for( cache_index = 0;
+	     cache_index < LIBVSMBR_COMPRESSED_NUMBER_OF_CACHED_FRAMES;
+	     cache_index++ )
+	{
+		if( compressed_io_handle->cached_frames[ cache_index ].frame_index == frame_index )
+		{
+			return( cache_index );
+		}
+	}
+	return( -1 );
+}
+
+/* Creates a compressed IO handle
+ * Make sure the value compressed_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_compressed_io_handle_initialize(
+     libvsmbr_compressed_io_handle_t **compressed_io_handle,
+     libbfio_handle_t *base_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_compressed_io_handle_initialize";
+	int cache_index       = 0;
+
+	if( compressed_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compressed IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*compressed_io_handle = memory_allocate_structure(
+	                         libvsmbr_compressed_io_handle_t );
+
+	if( *compressed_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *compressed_io_handle,
+	     0,
+	     sizeof( libvsmbr_compressed_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear compressed IO handle.",
+		 function );
+
+		memory_free(
+		 *compressed_io_handle );
+
+		*compressed_io_handle = NULL;
+
+		return( -1 );
+	}
+	for( cache_index = 0;
+	     cache_index < LIBVSMBR_COMPRESSED_NUMBER_OF_CACHED_FRAMES;
+	     cache_index++ )
+	{
+		( *compressed_io_handle )->cached_frames[ cache_index ].frame_index = -1;
+	}
+	( *compressed_io_handle )->base_file_io_handle = base_file_io_handle;
+	( *compressed_io_handle )->last_frame_index    = -1;
+
+	return( 1 );
+}
+
+/* Creates a compressed handle
+ * Reads are served from the decompressed data of the BGZF compressed image
+ * in the base file IO handle
+ * The handle does not take over management of the base file IO handle
+ * Make sure the value handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_compressed_initialize(
+     libbfio_handle_t **handle,
+     libbfio_handle_t *base_file_io_handle,
+     libcerror_error_t **error )
+{
+	libvsmbr_compressed_io_handle_t *compressed_io_handle = NULL;
+	static char *function                                 = "libvsmbr_compressed_initialize";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_compressed_io_handle_initialize(
+	     &compressed_io_handle,
+	     base_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressed IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     handle,
+	     (intptr_t *) compressed_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libvsmbr_compressed_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libvsmbr_compressed_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libvsmbr_compressed_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libvsmbr_compressed_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libvsmbr_compressed_io_handle_read,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libvsmbr_compressed_io_handle_write,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libvsmbr_compressed_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libvsmbr_compressed_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libvsmbr_compressed_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libvsmbr_compressed_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( compressed_io_handle != NULL )
+	{
+		libvsmbr_compressed_io_handle_free(
+		 &compressed_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a compressed IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_compressed_io_handle_free(
+     libvsmbr_compressed_io_handle_t **compressed_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_compressed_io_handle_free";
+	int result            = 1;
+
+	if( compressed_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_io_handle != NULL )
+	{
+		if( ( *compressed_io_handle )->is_open != 0 )
+		{
+			if( libvsmbr_compressed_io_handle_close(
+			     *compressed_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close compressed IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *compressed_io_handle );
+
+		*compressed_io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the compressed IO handle
+ * This is not supported since the base file IO handle would be shared
+ * Returns -1 on error
+ */
+int libvsmbr_compressed_io_handle_clone(
+     libvsmbr_compressed_io_handle_t **destination_compressed_io_handle,
+     libvsmbr_compressed_io_handle_t *source_compressed_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_compressed_io_handle_clone";
+
+	LIBVSMBR_UNREFERENCED_PARAMETER( destination_compressed_io_handle )
+	LIBVSMBR_UNREFERENCED_PARAMETER( source_compressed_io_handle )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: cloning a compressed IO handle is not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Frees a frame index chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_compressed_frame_chunk_free(
+     libvsmbr_compressed_frame_chunk_t **frame_chunk,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_compressed_frame_chunk_free";
+
+	if( frame_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frame chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( *frame_chunk != NULL )
+	{
+		memory_free(
+		 *frame_chunk );
+
+		*frame_chunk = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a frame to the frame index
+ * The uncompressed data of the frame directly follows that of the last frame
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_compressed_io_handle_append_frame(
+     libvsmbr_compressed_io_handle_t *compressed_io_handle,
+     off64_t member_offset,
+     size_t member_size,
+     size_t member_header_size,
+     size_t uncompressed_size,
+     uint32_t checksum,
+     libcerror_error_t **error )
+{
+	libvsmbr_compressed_frame_chunk_t *frame_chunk       = NULL;
+	libvsmbr_compressed_frame_index_entry_t *frame_entry = NULL;
+	static char *function                                = "libvsmbr_compressed_io_handle_append_frame";
+	int chunk_index                                      = 0;
+	int entry_index                                      = 0;
+
+	if( compressed_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_io_handle->frame_chunks_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compressed IO handle - missing frame chunks array.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_io_handle->number_of_frames == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed IO handle - number of frames value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( member_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid member offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( member_size == 0 )
+	 || ( member_size > ( (size_t) UINT16_MAX + 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid member size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( member_header_size >= member_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid member header size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_size == 0 )
+	 || ( uncompressed_size > LIBVSMBR_COMPRESSED_MAXIMUM_FRAME_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_index = compressed_io_handle->number_of_frames / LIBVSMBR_COMPRESSED_NUMBER_OF_FRAMES_PER_CHUNK;
+	entry_index = compressed_io_handle->number_of_frames % LIBVSMBR_COMPRESSED_NUMBER_OF_FRAMES_PER_CHUNK;
+
+	if( entry_index == 0 )
+	{
+		frame_chunk = memory_allocate_structure(
+		               libvsmbr_compressed_frame_chunk_t );
+
+		if( frame_chunk == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create frame chunk.",
+			 function );
+
+			return( -1 );
+		}
+		frame_chunk->uncompressed_offset = (off64_t) compressed_io_handle->size;
+		frame_chunk->number_of_entries   = 0;
+
+		if( libcdata_array_append_entry(
+		     compressed_io_handle->frame_chunks_array,
+		     &chunk_index,
+		     (intptr_t *) frame_chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append frame chunk to array.",
+			 function );
+
+			memory_free(
+			 frame_chunk );
+
+			return( -1 );
+		}
+	}
+	else if( libcdata_array_get_entry_by_index(
+	          compressed_io_handle->frame_chunks_array,
+	          chunk_index,
+	          (intptr_t **) &frame_chunk,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve frame chunk: %d from array.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	if( frame_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing frame chunk: %d.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	frame_entry = &( frame_chunk->entries[ entry_index ] );
+
+	frame_entry->member_offset             = (uint64_t) member_offset;
+	frame_entry->uncompressed_chunk_offset = (uint32_t) ( compressed_io_handle->size - frame_chunk->uncompressed_offset );
+	frame_entry->checksum                  = checksum;
+	frame_entry->block_size                = (uint16_t) ( member_size - 1 );
+	frame_entry->member_header_size        = (uint16_t) member_header_size;
+	frame_entry->uncompressed_size         = (uint16_t) ( uncompressed_size - 1 );
+
+	frame_chunk->number_of_entries += 1;
+
+	compressed_io_handle->number_of_frames += 1;
+	compressed_io_handle->size             += uncompressed_size;
+
+	return( 1 );
+}
+
+/* Retrieves the values of a specific frame from the frame index
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_compressed_io_handle_get_frame_by_index(
+     libvsmbr_compressed_io_handle_t *compressed_io_handle,
+     int frame_index,
+     libvsmbr_compressed_frame_t *frame,
+     libcerror_error_t **error )
+{
+	libvsmbr_compressed_frame_chunk_t *frame_chunk       = NULL;
+	libvsmbr_compressed_frame_index_entry_t *frame_entry = NULL;
+	static char *function                                = "libvsmbr_compressed_io_handle_get_frame_by_index";
+	int chunk_index                                      = 0;
+
+	if( compressed_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( frame_index < 0 )
+	 || ( frame_index >= compressed_io_handle->number_of_frames ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid frame index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( frame == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frame.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_index = frame_index / LIBVSMBR_COMPRESSED_NUMBER_OF_FRAMES_PER_CHUNK;
+
+	if( libcdata_array_get_entry_by_index(
+	     compressed_io_handle->frame_chunks_array,
+	     chunk_index,
+	     (intptr_t **) &frame_chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve frame chunk: %d from array.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	if( frame_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing frame chunk: %d.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	frame_entry = &( frame_chunk->entries[ frame_index % LIBVSMBR_COMPRESSED_NUMBER_OF_FRAMES_PER_CHUNK ] );
+
+	frame->member_offset          = (off64_t) frame_entry->member_offset;
+	frame->member_size            = (size_t) frame_entry->block_size + 1;
+	frame->compressed_data_offset = (size_t) frame_entry->member_header_size;
+	frame->compressed_data_size   = frame->member_size - frame->compressed_data_offset - sizeof( vsmbr_gzip_member_footer_t );
+	frame->uncompressed_offset    = frame_chunk->uncompressed_offset + frame_entry->uncompressed_chunk_offset;
+	frame->uncompressed_size      = (size_t) frame_entry->uncompressed_size + 1;
+	frame->checksum               = frame_entry->checksum;
+
+	return( 1 );
+}
+
+/* Reads the frame index
+ * The index is built by reading the header and footer of every member,
+ * members without uncompressed data, such as the BGZF end-of-file marker,
+ * are not part of the index. The compressed image is read in large reads
+ * that contain many members, since the size of a member is at most 64 KiB
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_compressed_io_handle_read_frame_index(
+     libvsmbr_compressed_io_handle_t *compressed_io_handle,
+     size64_t compressed_size,
+     libcerror_error_t **error )
+{
+	uint8_t *index_data           = NULL;
+	uint8_t *member_data          = NULL;
+	static char *function         = "libvsmbr_compressed_io_handle_read_frame_index";
+	size_t extra_field_end_offset = 0;
+	size_t extra_field_offset     = 0;
+	size_t index_data_size        = 0;
+	size_t member_header_size     = 0;
+	size_t member_size            = 0;
+	size_t read_size              = 0;
+	ssize_t read_count            = 0;
+	off64_t index_data_offset     = 0;
+	off64_t member_offset         = 0;
+	uint32_t checksum             = 0;
+	uint32_t uncompressed_size    = 0;
+	uint16_t block_size           = 0;
+	uint16_t extra_field_size     = 0;
+	uint16_t subfield_data_size   = 0;
+	int has_block_size            = 0;
+
+	if( compressed_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_io_handle->frame_chunks_array != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compressed IO handle - frame chunks array value already set.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_io_handle->number_of_frames = 0;
+	compressed_io_handle->size             = 0;
+
+	if( libcdata_array_initialize(
+	     &( compressed_io_handle->frame_chunks_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create frame chunks array.",
+		 function );
+
+		goto on_error;
+	}
+	index_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * LIBVSMBR_COMPRESSED_INDEX_READ_SIZE );
+
+	if( index_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index data.",
+		 function );
+
+		goto on_error;
+	}
+	while( (size64_t) member_offset < compressed_size )
+	{
+		/* The index data is read again when it does not contain the largest
+		 * possible member, or the remainder of the image, at the member offset
+		 */
+		read_size = (size_t) UINT16_MAX + 1;
+
+		if( (size64_t) read_size > ( compressed_size - member_offset ) )
+		{
+			read_size = (size_t) ( compressed_size - member_offset );
+		}
+		if( ( member_offset + (off64_t) read_size ) > ( index_data_offset + (off64_t) index_data_size ) )
+		{
+			read_size = LIBVSMBR_COMPRESSED_INDEX_READ_SIZE;
+
+			if( (size64_t) read_size > ( compressed_size - member_offset ) )
+			{
+				read_size = (size_t) ( compressed_size - member_offset );
+			}
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              compressed_io_handle->base_file_io_handle,
+			              index_data,
+			              read_size,
+			              member_offset,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read index data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 member_offset,
+				 member_offset );
+
+				goto on_error;
+			}
+			compressed_io_handle->number_of_compressed_reads += 1;
+
+			index_data_offset = member_offset;
+			index_data_size   = read_size;
+		}
+		member_data = &( index_data[ member_offset - index_data_offset ] );
+		read_size   = index_data_size - (size_t) ( member_offset - index_data_offset );
+
+		if( read_size < ( sizeof( vsmbr_gzip_member_header_t ) + sizeof( vsmbr_gzip_member_footer_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid member at offset: %" PRIi64 " (0x%08" PRIx64 ") - data too small.",
+			 function,
+			 member_offset,
+			 member_offset );
+
+			goto on_error;
+		}
+		if( ( ( (vsmbr_gzip_member_header_t *) member_data )->signature[ 0 ] != 0x1f )
+		 || ( ( (vsmbr_gzip_member_header_t *) member_data )->signature[ 1 ] != 0x8b ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+			 "%s: unsupported member signature at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 member_offset,
+			 member_offset );
+
+			goto on_error;
+		}
+		if( ( (vsmbr_gzip_member_header_t *) member_data )->compression_method != 8 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported compression method: %" PRIu8 ".",
+			 function,
+			 ( (vsmbr_gzip_member_header_t *) member_data )->compression_method );
+
+			goto on_error;
+		}
+		/* A BGZF member has the extra field flag (0x04) set and the text flag (0x01)
+		 * is ignored, members with a name, comment or header checksum are not supported
+		 */
+		if( ( ( (vsmbr_gzip_member_header_t *) member_data )->flags & 0xfe ) != 0x04 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported member flags: 0x%02" PRIx8 ".",
+			 function,
+			 ( (vsmbr_gzip_member_header_t *) member_data )->flags );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (vsmbr_gzip_member_header_t *) member_data )->extra_field_size,
+		 extra_field_size );
+
+		member_header_size = sizeof( vsmbr_gzip_member_header_t ) + extra_field_size;
+
+		if( ( extra_field_size > LIBVSMBR_COMPRESSED_MAXIMUM_EXTRA_FIELD_SIZE )
+		 || ( member_header_size > read_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported extra field size: %" PRIu16 ".",
+			 function,
+			 extra_field_size );
+
+			goto on_error;
+		}
+		extra_field_offset     = sizeof( vsmbr_gzip_member_header_t );
+		extra_field_end_offset = member_header_size;
+		has_block_size         = 0;
+
+		while( ( extra_field_offset + sizeof( vsmbr_gzip_extra_subfield_header_t ) ) <= extra_field_end_offset )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 ( (vsmbr_gzip_extra_subfield_header_t *) &( member_data[ extra_field_offset ] ) )->data_size,
+			 subfield_data_size );
+
+			if( (size_t) subfield_data_size > ( extra_field_end_offset - extra_field_offset - sizeof( vsmbr_gzip_extra_subfield_header_t ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid extra subfield data size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( ( (vsmbr_gzip_extra_subfield_header_t *) &( member_data[ extra_field_offset ] ) )->identifier[ 0 ] == (uint8_t) 'B' )
+			 && ( ( (vsmbr_gzip_extra_subfield_header_t *) &( member_data[ extra_field_offset ] ) )->identifier[ 1 ] == (uint8_t) 'C' )
+			 && ( subfield_data_size == 2 ) )
+			{
+				byte_stream_copy_to_uint16_little_endian(
+				 &( member_data[ extra_field_offset + sizeof( vsmbr_gzip_extra_subfield_header_t ) ] ),
+				 block_size );
+
+				has_block_size = 1;
+			}
+			extra_field_offset += sizeof( vsmbr_gzip_extra_subfield_header_t ) + subfield_data_size;
+		}
+		if( has_block_size == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing BGZF block size in member at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 member_offset,
+			 member_offset );
+
+			goto on_error;
+		}
+		member_size = (size_t) block_size + 1;
+
+		if( ( member_size < ( member_header_size + sizeof( vsmbr_gzip_member_footer_t ) ) )
+		 || ( member_size > read_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid member size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (vsmbr_gzip_member_footer_t *) &( member_data[ member_size - sizeof( vsmbr_gzip_member_footer_t ) ] ) )->checksum,
+		 checksum );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (vsmbr_gzip_member_footer_t *) &( member_data[ member_size - sizeof( vsmbr_gzip_member_footer_t ) ] ) )->uncompressed_data_size,
+		 uncompressed_size );
+
+		if( uncompressed_size > LIBVSMBR_COMPRESSED_MAXIMUM_FRAME_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid member uncompressed data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( uncompressed_size > 0 )
+		{
+			if( libvsmbr_compressed_io_handle_append_frame(
+			     compressed_io_handle,
+			     member_offset,
+			     member_size,
+			     member_header_size,
+			     (size_t) uncompressed_size,
+			     checksum,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append frame of member at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 member_offset,
+				 member_offset );
+
+				goto on_error;
+			}
+		}
+		member_offset += member_size;
+	}
+	memory_free(
+	 index_data );
+
+	return( 1 );
+
+on_error:
+	if( index_data != NULL )
+	{
+		memory_free(
+		 index_data );
+	}
+	if( compressed_io_handle->frame_chunks_array != NULL )
+	{
+		libcdata_array_free(
+		 &( compressed_io_handle->frame_chunks_array ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libvsmbr_compressed_frame_chunk_free,
+		 NULL );
+	}
+	compressed_io_handle->number_of_frames = 0;
+	compressed_io_handle->size             = 0;
+
+	return( -1 );
+}
+
+/* Opens the compressed IO handle
+ * The base file IO handle is opened if needed and the frame index is read
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_compressed_io_handle_open(
+     libvsmbr_compressed_io_handle_t *compressed_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function      = "libvsmbr_compressed_io_handle_open";
+	size64_t compressed_size   = 0;
+	int cache_index            = 0;
+	int file_io_handle_is_open = 0;
+
+	if( compressed_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_io_handle->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compressed IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	 || ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          compressed_io_handle->base_file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if base file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     compressed_io_handle->base_file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open base file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		compressed_io_handle->base_file_io_handle_opened_in_library = 1;
+	}
+	if( libbfio_handle_get_size(
+	     compressed_io_handle->base_file_io_handle,
+	     &compressed_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve base file size.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	/* The thread pool decompresses all read-ahead frames apart from the first
+	 * frame, which is decompressed by the calling thread
+	 */
+	if( libcthreads_mutex_initialize(
+	     &( compressed_io_handle->decompression_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decompression mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( compressed_io_handle->decompression_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decompression condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_pool_create(
+	     &( compressed_io_handle->thread_pool ),
+	     NULL,
+	     LIBVSMBR_COMPRESSED_NUMBER_OF_READ_AHEAD_FRAMES - 1,
+	     LIBVSMBR_COMPRESSED_NUMBER_OF_READ_AHEAD_FRAMES,
+	     (int (*)(intptr_t *, void *)) &libvsmbr_compressed_io_handle_decompress_frame_thread_callback,
+	     (void *) compressed_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	compressed_io_handle->number_of_pending_decompressions = 0;
+#endif
+	compressed_io_handle->number_of_compressed_reads    = 0;
+	compressed_io_handle->number_of_decompressed_frames = 0;
+
+	if( libvsmbr_compressed_io_handle_read_frame_index(
+	     compressed_io_handle,
+	     compressed_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read frame index.",
+		 function );
+
+		goto on_error;
+	}
+	for( cache_index = 0;
+	     cache_index < LIBVSMBR_COMPRESSED_NUMBER_OF_CACHED_FRAMES;
+	     cache_index++ )
+	{
+		compressed_io_handle->cached_frames[ cache_index ].frame_index     = -1;
+		compressed_io_handle->cached_frames[ cache_index ].sequence_number = 0;
+	}
+	compressed_io_handle->next_sequence_number = 1;
+	compressed_io_handle->last_frame_index     = -1;
+	compressed_io_handle->current_offset       = 0;
+	compressed_io_handle->is_open              = 1;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( compressed_io_handle->thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &( compressed_io_handle->thread_pool ),
+		 NULL );
+	}
+	if( compressed_io_handle->decompression_condition != NULL )
+	{
+		libcthreads_condition_free(
+		 &( compressed_io_handle->decompression_condition ),
+		 NULL );
+	}
+	if( compressed_io_handle->decompression_mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( compressed_io_handle->decompression_mutex ),
+		 NULL );
+	}
+#endif
+	if( compressed_io_handle->base_file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 compressed_io_handle->base_file_io_handle,
+		 NULL );
+
+		compressed_io_handle->base_file_io_handle_opened_in_library = 0;
+	}
+	return( -1 );
+}
+
+/* Closes the compressed IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int libvsmbr_compressed_io_handle_close(
+     libvsmbr_compressed_io_handle_t *compressed_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_compressed_io_handle_close";
+	int cache_index       = 0;
+	int result            = 0;
+
+	if( compressed_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compressed IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( compressed_io_handle->thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( compressed_io_handle->thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( compressed_io_handle->decompression_condition != NULL )
+	{
+		if( libcthreads_condition_free(
+		     &( compressed_io_handle->decompression_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free decompression condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( compressed_io_handle->decompression_mutex != NULL )
+	{
+		if( libcthreads_mutex_free(
+		     &( compressed_io_handle->decompression_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free decompression mutex.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	if( compressed_io_handle->base_file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     compressed_io_handle->base_file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close base file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		compressed_io_handle->base_file_io_handle_opened_in_library = 0;
+	}
+	for( cache_index = 0;
+	     cache_index < LIBVSMBR_COMPRESSED_NUMBER_OF_CACHED_FRAMES;
+	     cache_index++ )
+	{
+		if( compressed_io_handle->cached_frames[ cache_index ].data != NULL )
+		{
+			memory_free(
+			 compressed_io_handle->cached_frames[ cache_index ].data );
+
+			compressed_io_handle->cached_frames[ cache_index ].data = NULL;
+		}
+		compressed_io_handle->cached_frames[ cache_index ].frame_index = -1;
+	}
+	if( compressed_io_handle->compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_io_handle->compressed_data );
+
+		compressed_io_handle->compressed_data = NULL;
+	}
+	compressed_io_handle->compressed_data_size = 0;
+
+	if( libcdata_array_free(
+	     &( compressed_io_handle->frame_chunks_array ),
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libvsmbr_compressed_frame_chunk_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free frame chunks array.",
+		 function );
+
+		result = -1;
+	}
+	compressed_io_handle->number_of_frames = 0;
+	compressed_io_handle->last_frame_index = -1;
+	compressed_io_handle->is_open          = 0;
+
+	return( result );
+}
+
+/* Retrieves the frame that contains a specific offset
+ * The chunk that contains the frame is searched for first,
+ * followed by the entry of the frame within the chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_compressed_io_handle_get_frame_at_offset(
+     libvsmbr_compressed_io_handle_t *compressed_io_handle,
+     off64_t offset,
+     int *frame_index,
+     size_t *frame_offset,
+     libcerror_error_t **error )
+{
+	libvsmbr_compressed_frame_chunk_t *frame_chunk = NULL;
+	static char *function                          = "libvsmbr_compressed_io_handle_get_frame_at_offset";
+	off64_t chunk_offset                           = 0;
+	int first_index                                = 0;
+	int last_index                                 = 0;
+	int middle_index                               = 0;
+	int number_of_chunks                           = 0;
+
+	if( compressed_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( (size64_t) offset >= compressed_io_handle->size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( frame_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frame index.",
+		 function );
+
+		return( -1 );
+	}
+	if( frame_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frame offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     compressed_io_handle->frame_chunks_array,
+	     &number_of_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of frame chunks.",
+		 function );
+
+		return( -1 );
+	}
+	last_index = number_of_chunks - 1;
+
+	while( first_index < last_index )
+	{
+		middle_index = first_index + ( ( last_index - first_index + 1 ) / 2 );
+
+		if( libcdata_array_get_entry_by_index(
+		     compressed_io_handle->frame_chunks_array,
+		     middle_index,
+		     (intptr_t **) &frame_chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve frame chunk: %d from array.",
+			 function,
+			 middle_index );
+
+			return( -1 );
+		}
+		if( frame_chunk->uncompressed_offset <= offset )
+		{
+			first_index = middle_index;
+		}
+		else
+		{
+			last_index = middle_index - 1;
+		}
+	}
+	if( libcdata_array_get_entry_by_index(
+	     compressed_io_handle->frame_chunks_array,
+	     first_index,
+	     (intptr_t **) &frame_chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve frame chunk: %d from array.",
+		 function,
+		 first_index );
+
+		return( -1 );
+	}
+	if( ( frame_chunk == NULL )
+	 || ( frame_chunk->number_of_entries <= 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing frame chunk: %d.",
+		 function,
+		 first_index );
+
+		return( -1 );
+	}
+	*frame_index = first_index * LIBVSMBR_COMPRESSED_NUMBER_OF_FRAMES_PER_CHUNK;
+	chunk_offset = offset - frame_chunk->uncompressed_offset;
+
+	first_index = 0;
+	last_index  = frame_chunk->number_of_entries - 1;
+
+	while( first_index < last_index )
+	{
+		middle_index = first_index + ( ( last_index - first_index + 1 ) / 2 );
+
+		if( (off64_t) frame_chunk->entries[ middle_index ].uncompressed_chunk_offset <= chunk_offset )
+		{
+			first_index = middle_index;
+		}
+		else
+		{
+			last_index = middle_index - 1;
+		}
+	}
+	*frame_index += first_index;
+	*frame_offset = (size_t) ( chunk_offset - frame_chunk->entries[ first_index ].uncompressed_chunk_offset );
+
+	return( 1 );
+}
+
+/* Decompresses the data of a frame and verifies its size and checksum
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_compressed_io_handle_decompress_frame(
+     libvsmbr_compressed_frame_decompression_t *frame_decompression )
+{
+	static char *function = "libvsmbr_compressed_io_handle_decompress_frame";
+	size_t data_size      = 0;
+	uint32_t checksum     = 0;
+
+	if( frame_decompression == NULL )
+	{
+		return( -1 );
+	}
+	frame_decompression->result = -1;
+
+	data_size = frame_decompression->frame->uncompressed_size;
+
+	if( libvsmbr_deflate_decompress(
+	     &( frame_decompression->member_data[ frame_decompression->frame->compressed_data_offset ] ),
+	     frame_decompression->frame->compressed_data_size,
+	     frame_decompression->data,
+	     &data_size,
+	     &( frame_decompression->error ) ) != 1 )
+	{
+		libcerror_error_set(
+		 &( frame_decompression->error ),
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress frame data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size != frame_decompression->frame->uncompressed_size )
+	{
+		libcerror_error_set(
+		 &( frame_decompression->error ),
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in uncompressed data size (stored: %" PRIzd ", calculated: %" PRIzd ").",
+		 function,
+		 frame_decompression->frame->uncompressed_size,
+		 data_size );
+
+		return( -1 );
+	}
+	if( libvsmbr_checksum_calculate_crc32(
+	     &checksum,
+	     frame_decompression->data,
+	     data_size,
+	     0,
+	     &( frame_decompression->error ) ) != 1 )
+	{
+		libcerror_error_set(
+		 &( frame_decompression->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum != frame_decompression->frame->checksum )
+	{
+		libcerror_error_set(
+		 &( frame_decompression->error ),
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in checksum (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+		 function,
+		 frame_decompression->frame->checksum,
+		 checksum );
+
+		return( -1 );
+	}
+	frame_decompression->result = 1;
+
+	return( 1 );
+}
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+
+/* Callback of the thread pool that decompresses a frame
+ * A failure to decompress is reported by the result of the frame decompression,
+ * since libcthreads_thread_pool_join fails for a callback that does not return 1
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_compressed_io_handle_decompress_frame_thread_callback(
+     libvsmbr_compressed_frame_decompression_t *frame_decompression,
+     libvsmbr_compressed_io_handle_t *compressed_io_handle )
+{
+	int result = 1;
+
+	if( ( frame_decompression == NULL )
+	 || ( compressed_io_handle == NULL ) )
+	{
+		return( -1 );
+	}
+	libvsmbr_compressed_io_handle_decompress_frame(
+	 frame_decompression );
+
+	if( libcthreads_mutex_grab(
+	     compressed_io_handle->decompression_mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	compressed_io_handle->number_of_pending_decompressions -= 1;
+
+	if( libcthreads_condition_broadcast(
+	     compressed_io_handle->decompression_condition,
+	     NULL ) != 1 )
+	{
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     compressed_io_handle->decompression_mutex,
+	     NULL ) != 1 )
+	{
+		result = -1;
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT ) */
+
+/* Reads and decompresses consecutive frames into the frame cache
+ * The members of the frames are read with a single read and,
+ * if multi-threading is supported, the frames are decompressed concurrently
+ * The frames are stored in the least recently used entries of the frame cache
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_compressed_io_handle_read_frames(
+     libvsmbr_compressed_io_handle_t *compressed_io_handle,
+     int first_frame_index,
+     int number_of_frames,
+     libcerror_error_t **error )
+{
+	libvsmbr_compressed_frame_decompression_t frame_decompressions[ LIBVSMBR_COMPRESSED_NUMBER_OF_READ_AHEAD_FRAMES ];
+	libvsmbr_compressed_frame_t frames[ LIBVSMBR_COMPRESSED_NUMBER_OF_READ_AHEAD_FRAMES ];
+	int cache_indexes[ LIBVSMBR_COMPRESSED_NUMBER_OF_READ_AHEAD_FRAMES ];
+
+	libvsmbr_compressed_cached_frame_t *cached_frame = NULL;
+	libvsmbr_compressed_frame_t *first_frame         = NULL;
+	libvsmbr_compressed_frame_t *last_frame          = NULL;
+	uint8_t *compressed_data                         = NULL;
+	static char *function                            = "libvsmbr_compressed_io_handle_read_frames";
+	size_t read_size                                 = 0;
+	ssize_t read_count                               = 0;
+	int cache_index                                  = 0;
+	int frame_number                                 = 0;
+	int least_recently_used_index                    = 0;
+	int result                                       = 0;
+
+	if( compressed_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_frame_index < 0 )
+	 || ( first_frame_index >= compressed_io_handle->number_of_frames ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first frame index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_frames <= 0 )
+	 || ( number_of_frames > LIBVSMBR_COMPRESSED_NUMBER_OF_READ_AHEAD_FRAMES )
+	 || ( number_of_frames > ( compressed_io_handle->number_of_frames - first_frame_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of frames value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( frame_number = 0;
+	     frame_number < number_of_frames;
+	     frame_number++ )
+	{
+		if( libvsmbr_compressed_io_handle_get_frame_by_index(
+		     compressed_io_handle,
+		     first_frame_index + frame_number,
+		     &( frames[ frame_number ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve frame: %d.",
+			 function,
+			 first_frame_index + frame_number );
+
+			return( -1 );
+		}
+	}
+	first_frame = &( frames[ 0 ] );
+	last_frame  = &( frames[ number_of_frames - 1 ] );
+
+	/* The members of consecutive frames are stored adjacent to each other
+	 * in the compressed image, apart from members without uncompressed data
+	 */
+	read_size = (size_t) ( last_frame->member_offset - first_frame->member_offset ) + last_frame->member_size;
+
+	if( read_size > compressed_io_handle->compressed_data_size )
+	{
+		if( read_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid read size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		compressed_data = (uint8_t *) memory_reallocate(
+		                               compressed_io_handle->compressed_data,
+		                               sizeof( uint8_t ) * read_size );
+
+		if( compressed_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		compressed_io_handle->compressed_data      = compressed_data;
+		compressed_io_handle->compressed_data_size = read_size;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              compressed_io_handle->base_file_io_handle,
+	              compressed_io_handle->compressed_data,
+	              read_size,
+	              first_frame->member_offset,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 first_frame->member_offset,
+		 first_frame->member_offset );
+
+		return( -1 );
+	}
+	compressed_io_handle->number_of_compressed_reads += 1;
+
+	for( frame_number = 0;
+	     frame_number < number_of_frames;
+	     frame_number++ )
+	{
+		least_recently_used_index = 0;
+
+		for( cache_index = 0;
+		     cache_index < LIBVSMBR_COMPRESSED_NUMBER_OF_CACHED_FRAMES;
+		     cache_index++ )
+		{
+			if( compressed_io_handle->cached_frames[ cache_index ].frame_index == -1 )
+			{
+				least_recently_used_index = cache_index;
+
+				break;
+			}
+			if( compressed_io_handle->cached_frames[ cache_index ].sequence_number < compressed_io_handle->cached_frames[ least_recently_used_index ].sequence_number )
+			{
+				least_recently_used_index = cache_index;
+			}
+		}
+		cached_frame = &( compressed_io_handle->cached_frames[ least_recently_used_index ] );
+
+		if( cached_frame->data == NULL )
+		{
+			cached_frame->data = (uint8_t *) memory_allocate(
+			                                  sizeof( uint8_t ) * LIBVSMBR_COMPRESSED_MAXIMUM_FRAME_SIZE );
+
+			if( cached_frame->data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create cached frame data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* The entry is claimed before the frame is decompressed so that
+		 * it is not selected again for one of the other frames
+		 */
+		cached_frame->frame_index     = first_frame_index + frame_number;
+		cached_frame->sequence_number = compressed_io_handle->next_sequence_number++;
+
+		cache_indexes[ frame_number ] = least_recently_used_index;
+
+		frame_decompressions[ frame_number ].frame       = &( frames[ frame_number ] );
+		frame_decompressions[ frame_number ].member_data = &( compressed_io_handle->compressed_data[ frames[ frame_number ].member_offset - first_frame->member_offset ] );
+		frame_decompressions[ frame_number ].data        = cached_frame->data;
+		frame_decompressions[ frame_number ].result      = 0;
+		frame_decompressions[ frame_number ].error       = NULL;
+	}
+	result = 1;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	/* The first frame is decompressed by the calling thread and the other frames
+	 * by the thread pool, a frame is decompressed by the calling thread as well
+	 * if it cannot be pushed onto the thread pool queue
+	 */
+	if( compressed_io_handle->thread_pool != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     compressed_io_handle->decompression_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab decompression mutex.",
+			 function );
+
+			frame_number = number_of_frames;
+
+			goto on_error;
+		}
+		compressed_io_handle->number_of_pending_decompressions = number_of_frames - 1;
+
+		if( libcthreads_mutex_release(
+		     compressed_io_handle->decompression_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release decompression mutex.",
+			 function );
+
+			frame_number = number_of_frames;
+
+			goto on_error;
+		}
+		for( frame_number = 1;
+		     frame_number < number_of_frames;
+		     frame_number++ )
+		{
+			if( libcthreads_thread_pool_push(
+			     compressed_io_handle->thread_pool,
+			     (intptr_t *) &( frame_decompressions[ frame_number ] ),
+			     NULL ) != 1 )
+			{
+				libvsmbr_compressed_io_handle_decompress_frame_thread_callback(
+				 &( frame_decompressions[ frame_number ] ),
+				 compressed_io_handle );
+			}
+		}
+	}
+	else
+	{
+		for( frame_number = 1;
+		     frame_number < number_of_frames;
+		     frame_number++ )
+		{
+			libvsmbr_compressed_io_handle_decompress_frame(
+			 &( frame_decompressions[ frame_number ] ) );
+		}
+	}
+	libvsmbr_compressed_io_handle_decompress_frame(
+	 &( frame_decompressions[ 0 ] ) );
+
+	/* The frame decompressions are stored on the stack of the calling thread
+	 * hence all pushed decompressions must have completed before returning
+	 */
+	if( compressed_io_handle->thread_pool != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     compressed_io_handle->decompression_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab decompression mutex.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			while( compressed_io_handle->number_of_pending_decompressions > 0 )
+			{
+				if( libcthreads_condition_wait(
+				     compressed_io_handle->decompression_condition,
+				     compressed_io_handle->decompression_mutex,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to wait for decompression condition.",
+					 function );
+
+					result = -1;
+
+					break;
+				}
+			}
+			if( libcthreads_mutex_release(
+			     compressed_io_handle->decompression_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release decompression mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#else
+	for( frame_number = 0;
+	     frame_number < number_of_frames;
+	     frame_number++ )
+	{
+		libvsmbr_compressed_io_handle_decompress_frame(
+		 &( frame_decompressions[ frame_number ] ) );
+	}
+#endif
+	compressed_io_handle->number_of_decompressed_frames += number_of_frames;
+
+	/* Only a failure of the first frame, which was requested, fails the read,
+	 * the entries of read-ahead frames that failed are released so that
+	 * the failure is reported when these frames are requested
+	 */
+	for( frame_number = 0;
+	     frame_number < number_of_frames;
+	     frame_number++ )
+	{
+		if( frame_decompressions[ frame_number ].result != 1 )
+		{
+			if( frame_number == 0 )
+			{
+				if( ( result == 1 )
+				 && ( error != NULL )
+				 && ( *error == NULL ) )
+				{
+					*error = frame_decompressions[ frame_number ].error;
+
+					frame_decompressions[ frame_number ].error = NULL;
+				}
+				result = -1;
+			}
+			else
+			{
+				compressed_io_handle->cached_frames[ cache_indexes[ frame_number ] ].frame_index     = -1;
+				compressed_io_handle->cached_frames[ cache_indexes[ frame_number ] ].sequence_number = 0;
+			}
+		}
+		if( frame_decompressions[ frame_number ].error != NULL )
+		{
+			libcerror_error_free(
+			 &( frame_decompressions[ frame_number ].error ) );
+		}
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress frames.",
+		 function );
+
+		frame_number = number_of_frames;
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	/* Release the entries that were claimed, since their data is not valid
+	 */
+	while( frame_number > 0 )
+	{
+		frame_number--;
+
+		compressed_io_handle->cached_frames[ cache_indexes[ frame_number ] ].frame_index     = -1;
+		compressed_io_handle->cached_frames[ cache_indexes[ frame_number ] ].sequence_number = 0;
+	}
+	return( -1 );
+}
+
+/* Reads a buffer from the compressed IO handle
+ * A frame that is not cached is read together with up to the number of
+ * read-ahead frames that follow it if the read is sequential or spans
+ * multiple frames
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libvsmbr_compressed_io_handle_read(
+         libvsmbr_compressed_io_handle_t *compressed_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	libvsmbr_compressed_frame_t frame;
+
+	libvsmbr_compressed_cached_frame_t *cached_frame = NULL;
+	static char *function                            = "libvsmbr_compressed_io_handle_read";
+	size_t buffer_offset                             = 0;
+	size_t frame_offset                              = 0;
+	size_t read_size                                 = 0;
+	int cache_index                                  = 0;
+	int frame_index                                  = 0;
+	int number_of_frames                             = 0;
+
+	if( compressed_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compressed IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) compressed_io_handle->current_offset >= compressed_io_handle->size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) size > ( compressed_io_handle->size - compressed_io_handle->current_offset ) )
+	{
+		size = (size_t) ( compressed_io_handle->size - compressed_io_handle->current_offset );
+	}
+	while( buffer_offset < size )
+	{
+		if( libvsmbr_compressed_io_handle_get_frame_at_offset(
+		     compressed_io_handle,
+		     compressed_io_handle->current_offset,
+		     &frame_index,
+		     &frame_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve frame at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 compressed_io_handle->current_offset,
+			 compressed_io_handle->current_offset );
+
+			return( -1 );
+		}
+		if( libvsmbr_compressed_io_handle_get_frame_by_index(
+		     compressed_io_handle,
+		     frame_index,
+		     &frame,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve frame: %d.",
+			 function,
+			 frame_index );
+
+			return( -1 );
+		}
+		read_size = frame.uncompressed_size - frame_offset;
+
+		if( read_size > ( size - buffer_offset ) )
+		{
+			read_size = size - buffer_offset;
+		}
+		cache_index = libvsmbr_compressed_io_handle_get_cached_frame(
+		               compressed_io_handle,
+		               frame_index );
+
+		if( cache_index == -1 )
+		{
+			number_of_frames = 1;
+
+			if( ( frame_index == ( compressed_io_handle->last_frame_index + 1 ) )
+			 || ( read_size < ( size - buffer_offset ) ) )
+			{
+				while( ( number_of_frames < LIBVSMBR_COMPRESSED_NUMBER_OF_READ_AHEAD_FRAMES )
+				    && ( number_of_frames < ( compressed_io_handle->number_of_frames - frame_index ) ) )
+				{
+					if( libvsmbr_compressed_io_handle_get_cached_frame(
+					     compressed_io_handle,
+					     frame_index + number_of_frames ) != -1 )
+					{
+						break;
+					}
+					number_of_frames++;
+				}
+			}
+			if( libvsmbr_compressed_io_handle_read_frames(
+			     compressed_io_handle,
+			     frame_index,
+			     number_of_frames,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read frame: %d.",
+				 function,
+				 frame_index );
+
+				return( -1 );
+			}
+			cache_index = libvsmbr_compressed_io_handle_get_cached_frame(
+			               compressed_io_handle,
+			               frame_index );
+
+			if( cache_index == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing cached frame: %d.",
+				 function,
+				 frame_index );
+
+				return( -1 );
+			}
+		}
+		cached_frame = &( compressed_io_handle->cached_frames[ cache_index ] );
+
+		cached_frame->sequence_number = compressed_io_handle->next_sequence_number++;
+
+		if( memory_copy(
+		     &( buffer[ buffer_offset ] ),
+		     &( cached_frame->data[ frame_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy frame data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		compressed_io_handle->last_frame_index = frame_index;
+		compressed_io_handle->current_offset  += read_size;
+		buffer_offset                         += read_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Writes a buffer to the compressed IO handle
+ * This is not supported since the compressed image is read-only
+ * Returns -1 on error
+ */
+ssize_t libvsmbr_compressed_io_handle_write(
+         libvsmbr_compressed_io_handle_t *compressed_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_compressed_io_handle_write";
+
+	LIBVSMBR_UNREFERENCED_PARAMETER( compressed_io_handle )
+	LIBVSMBR_UNREFERENCED_PARAMETER( buffer )
+	LIBVSMBR_UNREFERENCED_PARAMETER( size )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: writing to a compressed IO handle is not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Seeks a certain offset within the compressed IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libvsmbr_compressed_io_handle_seek_offset(
+         libvsmbr_compressed_io_handle_t *compressed_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_compressed_io_handle_seek_offset";
+
+	if( compressed_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += compressed_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) compressed_io_handle->size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if the compressed image exists
+ * Returns 1 if the base file IO handle exists, 0 if not or -1 on error
+ */
+int libvsmbr_compressed_io_handle_exists(
+     libvsmbr_compressed_io_handle_t *compressed_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_compressed_io_handle_exists";
+	int result            = 0;
+
+	if( compressed_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_exists(
+	          compressed_io_handle->base_file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if base file IO handle exists.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Check if the compressed IO handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libvsmbr_compressed_io_handle_is_open(
+     libvsmbr_compressed_io_handle_t *compressed_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_compressed_io_handle_is_open";
+
+	if( compressed_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_io_handle->is_open == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the uncompressed image
+ * The size is only known after the frame index was read when the handle was opened
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_compressed_io_handle_get_size(
+     libvsmbr_compressed_io_handle_t *compressed_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_compressed_io_handle_get_size";
+
+	if( compressed_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compressed IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = compressed_io_handle->size;
+
+	return( 1 );
+}
+
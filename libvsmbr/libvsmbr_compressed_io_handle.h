@@ -0,0 +1,366 @@
+/*
+ * Compressed image IO handle functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSMBR_COMPRESSED_IO_HANDLE_H )
+#define _LIBVSMBR_COMPRESSED_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsmbr_definitions.h"
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcdata.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsmbr_compressed_frame libvsmbr_compressed_frame_t;
+
+/* A frame, which is a gzip member that is decompressed independently
+ * The values of a frame are retrieved from its entry in the frame index
+ */
+struct libvsmbr_compressed_frame
+{
+	/* The offset of the member in the compressed image
+	 */
+	off64_t member_offset;
+
+	/* The size of the member
+	 */
+	size_t member_size;
+
+	/* The offset of the deflate compressed data relative to the start of the member
+	 */
+	size_t compressed_data_offset;
+
+	/* The size of the deflate compressed data
+	 */
+	size_t compressed_data_size;
+
+	/* The offset of the uncompressed data in the image
+	 */
+	off64_t uncompressed_offset;
+
+	/* The size of the uncompressed data
+	 */
+	size_t uncompressed_size;
+
+	/* The CRC-32 of the uncompressed data
+	 */
+	uint32_t checksum;
+};
+
+typedef struct libvsmbr_compressed_frame_index_entry libvsmbr_compressed_frame_index_entry_t;
+
+/* The compact entry of a frame in the frame index
+ */
+struct libvsmbr_compressed_frame_index_entry
+{
+	/* The offset of the member in the compressed image
+	 */
+	uint64_t member_offset;
+
+	/* The offset of the uncompressed data relative to the start of the frame chunk
+	 */
+	uint32_t uncompressed_chunk_offset;
+
+	/* The CRC-32 of the uncompressed data
+	 */
+	uint32_t checksum;
+
+	/* The BGZF block size, which is the size of the member minus 1
+	 */
+	uint16_t block_size;
+
+	/* The size of the member header
+	 */
+	uint16_t member_header_size;
+
+	/* The size of the uncompressed data minus 1
+	 */
+	uint16_t uncompressed_size;
+};
+
+typedef struct libvsmbr_compressed_frame_chunk libvsmbr_compressed_frame_chunk_t;
+
+/* A chunk of the frame index, which contains the entries of consecutive frames
+ */
+struct libvsmbr_compressed_frame_chunk
+{
+	/* The offset of the uncompressed data of the first frame in the image
+	 */
+	off64_t uncompressed_offset;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The entries
+	 */
+	libvsmbr_compressed_frame_index_entry_t entries[ LIBVSMBR_COMPRESSED_NUMBER_OF_FRAMES_PER_CHUNK ];
+};
+
+typedef struct libvsmbr_compressed_cached_frame libvsmbr_compressed_cached_frame_t;
+
+/* A decompressed frame in the frame cache
+ */
+struct libvsmbr_compressed_cached_frame
+{
+	/* The frame index, where -1 represents an unused entry
+	 */
+	int frame_index;
+
+	/* The uncompressed data
+	 */
+	uint8_t *data;
+
+	/* The sequence number of the last access
+	 */
+	uint64_t sequence_number;
+};
+
+typedef struct libvsmbr_compressed_frame_decompression libvsmbr_compressed_frame_decompression_t;
+
+/* A decompression of a single frame
+ */
+struct libvsmbr_compressed_frame_decompression
+{
+	/* The frame
+	 */
+	libvsmbr_compressed_frame_t *frame;
+
+	/* The compressed member data
+	 */
+	const uint8_t *member_data;
+
+	/* The uncompressed data
+	 */
+	uint8_t *data;
+
+	/* The decompression result
+	 */
+	int result;
+
+	/* The decompression error
+	 */
+	libcerror_error_t *error;
+};
+
+typedef struct libvsmbr_compressed_io_handle libvsmbr_compressed_io_handle_t;
+
+/* The compressed IO handle provides random access to the uncompressed data
+ * of a BGZF compressed image, which consists of gzip members of at most 64 KiB
+ * of uncompressed data, by an index of the members that is read on open
+ */
+struct libvsmbr_compressed_io_handle
+{
+	/* The base file IO handle, which contains the compressed image
+	 */
+	libbfio_handle_t *base_file_io_handle;
+
+	/* Value to indicate if the base file IO handle was opened inside the library
+	 */
+	uint8_t base_file_io_handle_opened_in_library;
+
+	/* The frame index chunks array
+	 */
+	libcdata_array_t *frame_chunks_array;
+
+	/* The number of frames
+	 */
+	int number_of_frames;
+
+	/* The decompressed frames cache
+	 */
+	libvsmbr_compressed_cached_frame_t cached_frames[ LIBVSMBR_COMPRESSED_NUMBER_OF_CACHED_FRAMES ];
+
+	/* The next sequence number
+	 */
+	uint64_t next_sequence_number;
+
+	/* The index of the last frame that was read, where -1 represents none
+	 */
+	int last_frame_index;
+
+	/* The compressed data, which contains the members of frames that are read together
+	 */
+	uint8_t *compressed_data;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* The size, which is the size of the uncompressed image
+	 */
+	size64_t size;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The number of reads of compressed data from the base file IO handle
+	 */
+	uint64_t number_of_compressed_reads;
+
+	/* The number of frames that were decompressed
+	 */
+	uint64_t number_of_decompressed_frames;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	/* The thread pool that decompresses the read-ahead frames
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The mutex that protects the number of pending decompressions
+	 */
+	libcthreads_mutex_t *decompression_mutex;
+
+	/* The condition that is signalled when a decompression has completed
+	 */
+	libcthreads_condition_t *decompression_condition;
+
+	/* The number of decompressions that were pushed onto the thread pool
+	 * and have not yet completed
+	 */
+	int number_of_pending_decompressions;
+#endif
+
+	/* Value to indicate if the compressed IO handle is open
+	 */
+	uint8_t is_open;
+};
+
+int libvsmbr_compressed_io_handle_initialize(
+     libvsmbr_compressed_io_handle_t **compressed_io_handle,
+     libbfio_handle_t *base_file_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_compressed_initialize(
+     libbfio_handle_t **handle,
+     libbfio_handle_t *base_file_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_compressed_io_handle_free(
+     libvsmbr_compressed_io_handle_t **compressed_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_compressed_io_handle_clone(
+     libvsmbr_compressed_io_handle_t **destination_compressed_io_handle,
+     libvsmbr_compressed_io_handle_t *source_compressed_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_compressed_frame_chunk_free(
+     libvsmbr_compressed_frame_chunk_t **frame_chunk,
+     libcerror_error_t **error );
+
+int libvsmbr_compressed_io_handle_append_frame(
+     libvsmbr_compressed_io_handle_t *compressed_io_handle,
+     off64_t member_offset,
+     size_t member_size,
+     size_t member_header_size,
+     size_t uncompressed_size,
+     uint32_t checksum,
+     libcerror_error_t **error );
+
+int libvsmbr_compressed_io_handle_get_frame_by_index(
+     libvsmbr_compressed_io_handle_t *compressed_io_handle,
+     int frame_index,
+     libvsmbr_compressed_frame_t *frame,
+     libcerror_error_t **error );
+
+int libvsmbr_compressed_io_handle_read_frame_index(
+     libvsmbr_compressed_io_handle_t *compressed_io_handle,
+     size64_t compressed_size,
+     libcerror_error_t **error );
+
+int libvsmbr_compressed_io_handle_open(
+     libvsmbr_compressed_io_handle_t *compressed_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libvsmbr_compressed_io_handle_close(
+     libvsmbr_compressed_io_handle_t *compressed_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_compressed_io_handle_get_frame_at_offset(
+     libvsmbr_compressed_io_handle_t *compressed_io_handle,
+     off64_t offset,
+     int *frame_index,
+     size_t *frame_offset,
+     libcerror_error_t **error );
+
+int libvsmbr_compressed_io_handle_decompress_frame(
+     libvsmbr_compressed_frame_decompression_t *frame_decompression );
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+
+int libvsmbr_compressed_io_handle_decompress_frame_thread_callback(
+     libvsmbr_compressed_frame_decompression_t *frame_decompression,
+     libvsmbr_compressed_io_handle_t *compressed_io_handle );
+
+#endif
+
+int libvsmbr_compressed_io_handle_read_frames(
+     libvsmbr_compressed_io_handle_t *compressed_io_handle,
+     int first_frame_index,
+     int number_of_frames,
+     libcerror_error_t **error );
+
+ssize_t libvsmbr_compressed_io_handle_read(
+         libvsmbr_compressed_io_handle_t *compressed_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libvsmbr_compressed_io_handle_write(
+         libvsmbr_compressed_io_handle_t *compressed_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libvsmbr_compressed_io_handle_seek_offset(
+         libvsmbr_compressed_io_handle_t *compressed_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libvsmbr_compressed_io_handle_exists(
+     libvsmbr_compressed_io_handle_t *compressed_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_compressed_io_handle_is_open(
+     libvsmbr_compressed_io_handle_t *compressed_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_compressed_io_handle_get_size(
+     libvsmbr_compressed_io_handle_t *compressed_io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSMBR_COMPRESSED_IO_HANDLE_H ) */
+
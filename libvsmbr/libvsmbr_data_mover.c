@@ -0,0 +1,1805 @@
+/*
+ * Data mover functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsmbr_data_mover.h"
+#include "libvsmbr_definitions.h"
+#include "libvsmbr_io_handle.h"
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_libcthreads.h"
+#include "libvsmbr_move_journal.h"
+
+/* Creates a data mover
+ * Make sure the value data_mover is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_data_mover_initialize(
+     libvsmbr_data_mover_t **data_mover,
+     libvsmbr_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     size_t block_size,
+     size64_t checkpoint_size,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_data_mover_initialize";
+
+	if( data_mover == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data mover.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_mover != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data mover value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid checkpoint size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	/* A batch of which the source and destination overlap is buffered
+	 * in memory and in the journal file
+	 */
+	if( ( checkpoint_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( checkpoint_size > (size64_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid checkpoint size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > LIBVSMBR_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of threads: %d.",
+		 function,
+		 number_of_threads );
+
+		return( -1 );
+	}
+	*data_mover = memory_allocate_structure(
+	               libvsmbr_data_mover_t );
+
+	if( *data_mover == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data mover.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *data_mover,
+	     0,
+	     sizeof( libvsmbr_data_mover_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data mover.",
+		 function );
+
+		memory_free(
+		 *data_mover );
+
+		*data_mover = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *data_mover )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *data_mover )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *data_mover )->io_handle         = io_handle;
+	( *data_mover )->file_io_handle    = file_io_handle;
+	( *data_mover )->block_size        = block_size;
+	( *data_mover )->checkpoint_size   = checkpoint_size;
+	( *data_mover )->number_of_threads = number_of_threads;
+	( *data_mover )->write_result      = 1;
+
+	return( 1 );
+
+on_error:
+	if( *data_mover != NULL )
+	{
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+		if( ( *data_mover )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *data_mover )->mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 *data_mover );
+
+		*data_mover = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a data mover
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_data_mover_free(
+     libvsmbr_data_mover_t **data_mover,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_data_mover_free";
+	int result            = 1;
+
+	if( data_mover == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data mover.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_mover != NULL )
+	{
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+		if( ( *data_mover )->thread_pool != NULL )
+		{
+			if( libvsmbr_data_mover_stop_threads(
+			     *data_mover,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to stop threads.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcthreads_condition_free(
+		     &( ( *data_mover )->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *data_mover )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *data_mover )->batch_data != NULL )
+		{
+			memory_free(
+			 ( *data_mover )->batch_data );
+		}
+		/* The IO handle and file IO handle are referenced and freed elsewhere
+		 */
+		memory_free(
+		 *data_mover );
+
+		*data_mover = NULL;
+	}
+	return( result );
+}
+
+/* Creates a data mover block
+ * Make sure the value data_mover_block is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_data_mover_block_initialize(
+     libvsmbr_data_mover_block_t **data_mover_block,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_data_mover_block_t *safe_data_mover_block = NULL;
+	static char *function                              = "libvsmbr_data_mover_block_initialize";
+
+	if( data_mover_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data mover block.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_mover_block != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data mover block value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_mover_block = memory_allocate_structure(
+	                         libvsmbr_data_mover_block_t );
+
+	if( safe_data_mover_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data mover block.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_data_mover_block,
+	     0,
+	     sizeof( libvsmbr_data_mover_block_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data mover block.",
+		 function );
+
+		goto on_error;
+	}
+	safe_data_mover_block->data = (uint8_t *) memory_allocate(
+	                                           sizeof( uint8_t ) * block_size );
+
+	if( safe_data_mover_block->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	*data_mover_block = safe_data_mover_block;
+
+	return( 1 );
+
+on_error:
+	if( safe_data_mover_block != NULL )
+	{
+		memory_free(
+		 safe_data_mover_block );
+	}
+	return( -1 );
+}
+
+/* Frees a data mover block
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_data_mover_block_free(
+     libvsmbr_data_mover_block_t **data_mover_block,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_data_mover_block_free";
+
+	if( data_mover_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data mover block.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_mover_block != NULL )
+	{
+		if( ( *data_mover_block )->data != NULL )
+		{
+			memory_free(
+			 ( *data_mover_block )->data );
+		}
+		memory_free(
+		 *data_mover_block );
+
+		*data_mover_block = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the data of a data mover block from its source
+ * The data is read by the calling thread using the file IO handle of the data mover
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_data_mover_read_block(
+     libvsmbr_data_mover_t *data_mover,
+     libvsmbr_data_mover_block_t *data_mover_block,
+     off64_t source_offset,
+     size_t read_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_data_mover_read_block";
+	ssize_t read_count    = 0;
+
+	if( data_mover == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data mover.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_mover_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data mover block.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_size > data_mover->block_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              data_mover->file_io_handle,
+	              data_mover_block->data,
+	              read_size,
+	              source_offset,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 source_offset,
+		 source_offset );
+
+		return( -1 );
+	}
+	data_mover_block->data_size = read_size;
+
+	return( 1 );
+}
+
+/* Writes the data of a data mover block to its destination
+ * The file IO handle is either the file IO handle of the data mover
+ * or a write file IO handle that is used by a single worker thread
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_data_mover_write_block(
+     libvsmbr_data_mover_t *data_mover,
+     libbfio_handle_t *file_io_handle,
+     libvsmbr_data_mover_block_t *data_mover_block,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_data_mover_write_block";
+	ssize_t write_count   = 0;
+
+	if( data_mover == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data mover.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_mover_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data mover block.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               file_io_handle,
+	               data_mover_block->data,
+	               data_mover_block->data_size,
+	               data_mover_block->destination_offset,
+	               error );
+
+	if( write_count != (ssize_t) data_mover_block->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 data_mover_block->destination_offset,
+		 data_mover_block->destination_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Flushes the file IO handle and the write file IO handles
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_data_mover_flush(
+     libvsmbr_data_mover_t *data_mover,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_data_mover_flush";
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	int handle_index      = 0;
+#endif
+
+	if( data_mover == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data mover.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	for( handle_index = 0;
+	     handle_index < data_mover->number_of_write_file_io_handles;
+	     handle_index++ )
+	{
+		if( libbfio_handle_flush(
+		     data_mover->write_file_io_handles[ handle_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write file IO handle: %d.",
+			 function,
+			 handle_index );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( libbfio_handle_flush(
+	     data_mover->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+
+/* Starts the worker threads
+ * Every worker thread writes using its own clone of the file IO handle, so that
+ * the writes do not have to be serialized with the reads of the calling thread.
+ * If the file IO handle cannot be cloned, for example when it is an overlay,
+ * no worker threads are started and the data is copied by the calling thread
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_data_mover_start_threads(
+     libvsmbr_data_mover_t *data_mover,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *write_file_io_handle = NULL;
+	static char *function                  = "libvsmbr_data_mover_start_threads";
+	int handle_index                       = 0;
+
+	if( data_mover == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data mover.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_mover->thread_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data mover - thread pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_mover->number_of_threads <= 1 )
+	{
+		return( 1 );
+	}
+	for( handle_index = 0;
+	     handle_index < data_mover->number_of_threads;
+	     handle_index++ )
+	{
+		write_file_io_handle = NULL;
+
+		if( libbfio_handle_clone(
+		     &write_file_io_handle,
+		     data_mover->file_io_handle,
+		     NULL ) != 1 )
+		{
+			if( write_file_io_handle != NULL )
+			{
+				libbfio_handle_free(
+				 &write_file_io_handle,
+				 NULL );
+			}
+			break;
+		}
+		data_mover->write_file_io_handles[ handle_index ]           = write_file_io_handle;
+		data_mover->available_write_file_io_handles[ handle_index ] = write_file_io_handle;
+	}
+	data_mover->number_of_write_file_io_handles           = handle_index;
+	data_mover->number_of_available_write_file_io_handles = handle_index;
+	data_mover->number_of_pending_writes                  = 0;
+
+	if( handle_index < data_mover->number_of_threads )
+	{
+		if( libvsmbr_data_mover_stop_threads(
+		     data_mover,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free write file IO handles.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	/* The queue holds 2 blocks per thread, which bounds the memory used
+	 * by blocks that have been read but not yet written
+	 */
+	if( libcthreads_thread_pool_create(
+	     &( data_mover->thread_pool ),
+	     NULL,
+	     data_mover->number_of_threads,
+	     data_mover->number_of_threads * 2,
+	     (int (*)(intptr_t *, void *)) &libvsmbr_data_mover_write_block_callback,
+	     (void *) data_mover,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		libvsmbr_data_mover_stop_threads(
+		 data_mover,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Stops the worker threads
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_data_mover_stop_threads(
+     libvsmbr_data_mover_t *data_mover,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_data_mover_stop_threads";
+	int handle_index      = 0;
+	int result            = 1;
+
+	if( data_mover == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data mover.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_mover->thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( data_mover->thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			result = -1;
+		}
+	}
+	for( handle_index = 0;
+	     handle_index < data_mover->number_of_write_file_io_handles;
+	     handle_index++ )
+	{
+		if( libbfio_handle_close(
+		     data_mover->write_file_io_handles[ handle_index ],
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close write file IO handle: %d.",
+			 function,
+			 handle_index );
+
+			result = -1;
+		}
+		if( libbfio_handle_free(
+		     &( data_mover->write_file_io_handles[ handle_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free write file IO handle: %d.",
+			 function,
+			 handle_index );
+
+			result = -1;
+		}
+		data_mover->available_write_file_io_handles[ handle_index ] = NULL;
+	}
+	data_mover->number_of_write_file_io_handles           = 0;
+	data_mover->number_of_available_write_file_io_handles = 0;
+
+	return( result );
+}
+
+/* Waits until the blocks that were pushed onto the thread pool have been written
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_data_mover_wait_for_writes(
+     libvsmbr_data_mover_t *data_mover,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_data_mover_wait_for_writes";
+	int result            = 1;
+
+	if( data_mover == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data mover.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     data_mover->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_mover->number_of_pending_writes > 0 )
+	{
+		if( libcthreads_condition_wait(
+		     data_mover->condition,
+		     data_mover->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     data_mover->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Writes the data of a data mover block in a worker thread
+ * The block is written using one of the available write file IO handles,
+ * a failed write is recorded in the write result of the data mover
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_data_mover_write_block_callback(
+     libvsmbr_data_mover_block_t *data_mover_block,
+     libvsmbr_data_mover_t *data_mover )
+{
+	libbfio_handle_t *write_file_io_handle = NULL;
+	int result                             = 1;
+
+	if( data_mover == NULL )
+	{
+		libvsmbr_data_mover_block_free(
+		 &data_mover_block,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     data_mover->mutex,
+	     NULL ) != 1 )
+	{
+		result = -1;
+	}
+	else
+	{
+		/* There are as many write file IO handles as worker threads
+		 */
+		if( data_mover->number_of_available_write_file_io_handles > 0 )
+		{
+			data_mover->number_of_available_write_file_io_handles -= 1;
+
+			write_file_io_handle = data_mover->available_write_file_io_handles[ data_mover->number_of_available_write_file_io_handles ];
+		}
+		if( libcthreads_mutex_release(
+		     data_mover->mutex,
+		     NULL ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( write_file_io_handle == NULL )
+	{
+		result = -1;
+	}
+	else if( libvsmbr_data_mover_write_block(
+	          data_mover,
+	          write_file_io_handle,
+	          data_mover_block,
+	          NULL ) != 1 )
+	{
+		result = -1;
+	}
+	if( libvsmbr_data_mover_block_free(
+	     &data_mover_block,
+	     NULL ) != 1 )
+	{
+		result = -1;
+	}
+	if( libcthreads_mutex_grab(
+	     data_mover->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( write_file_io_handle != NULL )
+	{
+		data_mover->available_write_file_io_handles[ data_mover->number_of_available_write_file_io_handles ] = write_file_io_handle;
+
+		data_mover->number_of_available_write_file_io_handles += 1;
+	}
+	if( result != 1 )
+	{
+		data_mover->write_result = -1;
+	}
+	data_mover->number_of_pending_writes -= 1;
+
+	if( libcthreads_condition_broadcast(
+	     data_mover->condition,
+	     NULL ) != 1 )
+	{
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     data_mover->mutex,
+	     NULL ) != 1 )
+	{
+		result = -1;
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT ) */
+
+/* Copies a range of data
+ * The source and destination ranges must not overlap, the data is read by
+ * the calling thread and written by the worker threads if they were started,
+ * so that reads and writes overlap. If the worker threads were not started
+ * by libvsmbr_data_mover_copy they are started for the range.
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_data_mover_copy_range(
+     libvsmbr_data_mover_t *data_mover,
+     off64_t source_offset,
+     off64_t destination_offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libvsmbr_data_mover_block_t *data_mover_block = NULL;
+	static char *function                         = "libvsmbr_data_mover_copy_range";
+	size64_t range_offset                         = 0;
+	size_t read_size                              = 0;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	uint8_t threads_started                       = 0;
+#endif
+
+	if( data_mover == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data mover.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( source_offset < 0 )
+	 || ( size > (size64_t) ( INT64_MAX - source_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( destination_offset < 0 )
+	 || ( size > (size64_t) ( INT64_MAX - destination_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid destination offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( source_offset < destination_offset )
+	  &&  ( (size64_t) ( destination_offset - source_offset ) < size ) )
+	 || ( ( destination_offset < source_offset )
+	  &&  ( (size64_t) ( source_offset - destination_offset ) < size ) )
+	 || ( ( source_offset == destination_offset )
+	  &&  ( size > 0 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source and destination ranges overlap.",
+		 function );
+
+		return( -1 );
+	}
+	data_mover->write_result = 1;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( ( data_mover->thread_pool == NULL )
+	 && ( data_mover->number_of_threads > 1 )
+	 && ( size > (size64_t) data_mover->block_size ) )
+	{
+		if( libvsmbr_data_mover_start_threads(
+		     data_mover,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to start threads.",
+			 function );
+
+			goto on_error;
+		}
+		threads_started = 1;
+	}
+#endif
+	while( range_offset < size )
+	{
+		if( data_mover_block == NULL )
+		{
+			if( libvsmbr_data_mover_block_initialize(
+			     &data_mover_block,
+			     data_mover->block_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create data mover block.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		read_size = data_mover->block_size;
+
+		if( (size64_t) read_size > ( size - range_offset ) )
+		{
+			read_size = (size_t) ( size - range_offset );
+		}
+		if( libvsmbr_data_mover_read_block(
+		     data_mover,
+		     data_mover_block,
+		     source_offset + (off64_t) range_offset,
+		     read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block.",
+			 function );
+
+			goto on_error;
+		}
+		data_mover_block->destination_offset = destination_offset + (off64_t) range_offset;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+		if( data_mover->thread_pool != NULL )
+		{
+			if( libcthreads_mutex_grab(
+			     data_mover->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab mutex.",
+				 function );
+
+				goto on_error;
+			}
+			data_mover->number_of_pending_writes += 1;
+
+			if( libcthreads_mutex_release(
+			     data_mover->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release mutex.",
+				 function );
+
+				goto on_error;
+			}
+			if( libcthreads_thread_pool_push(
+			     data_mover->thread_pool,
+			     (intptr_t *) data_mover_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push block onto thread pool queue.",
+				 function );
+
+				if( libcthreads_mutex_grab(
+				     data_mover->mutex,
+				     NULL ) == 1 )
+				{
+					data_mover->number_of_pending_writes -= 1;
+
+					libcthreads_mutex_release(
+					 data_mover->mutex,
+					 NULL );
+				}
+				goto on_error;
+			}
+			/* The worker thread takes over the ownership of the block
+			 */
+			data_mover_block = NULL;
+		}
+		else
+#endif
+		if( libvsmbr_data_mover_write_block(
+		     data_mover,
+		     data_mover->file_io_handle,
+		     data_mover_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write block.",
+			 function );
+
+			goto on_error;
+		}
+		range_offset += read_size;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( data_mover->thread_pool != NULL )
+	{
+		if( libvsmbr_data_mover_wait_for_writes(
+		     data_mover,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to wait for writes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( threads_started != 0 )
+	{
+		threads_started = 0;
+
+		if( libvsmbr_data_mover_stop_threads(
+		     data_mover,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to stop threads.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( data_mover->write_result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write one or more blocks.",
+		 function );
+
+		goto on_error;
+	}
+	if( data_mover_block != NULL )
+	{
+		if( libvsmbr_data_mover_block_free(
+		     &data_mover_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data mover block.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( data_mover->thread_pool != NULL )
+	{
+		libvsmbr_data_mover_wait_for_writes(
+		 data_mover,
+		 NULL );
+	}
+	if( threads_started != 0 )
+	{
+		libvsmbr_data_mover_stop_threads(
+		 data_mover,
+		 NULL );
+	}
+#endif
+	if( data_mover_block != NULL )
+	{
+		libvsmbr_data_mover_block_free(
+		 &data_mover_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Copies a batch of which the source and destination overlap
+ * The data of the batch is read into the batch data before it is written,
+ * hence the source data is not overwritten before it has been read.
+ * If a journal file IO handle is provided the data of the batch is stored
+ * in the journal file before the destination is written, so that a batch
+ * that was interrupted is redone from the journal file instead of
+ * the partially overwritten source.
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_data_mover_copy_buffered(
+     libvsmbr_data_mover_t *data_mover,
+     libvsmbr_move_journal_t *move_journal,
+     libbfio_handle_t *journal_file_io_handle,
+     size64_t batch_offset,
+     size_t batch_size,
+     libcerror_error_t **error )
+{
+	uint8_t *batch_data   = NULL;
+	static char *function = "libvsmbr_data_mover_copy_buffered";
+	ssize_t read_count    = 0;
+	ssize_t write_count   = 0;
+
+	if( data_mover == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data mover.",
+		 function );
+
+		return( -1 );
+	}
+	if( move_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid move journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( batch_size == 0 )
+	 || ( (size64_t) batch_size > data_mover->checkpoint_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid batch size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_size > data_mover->batch_data_size )
+	{
+		batch_data = (uint8_t *) memory_reallocate(
+		                          data_mover->batch_data,
+		                          sizeof( uint8_t ) * batch_size );
+
+		if( batch_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize batch data.",
+			 function );
+
+			return( -1 );
+		}
+		data_mover->batch_data      = batch_data;
+		data_mover->batch_data_size = batch_size;
+	}
+	/* A batch of which the data is buffered in the journal file
+	 * is redone from the journal file
+	 */
+	if( move_journal->buffered_size != 0 )
+	{
+		if( journal_file_io_handle == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid journal file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+		if( (size_t) move_journal->buffered_size != batch_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid move journal - buffered size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              journal_file_io_handle,
+		              data_mover->batch_data,
+		              batch_size,
+		              LIBVSMBR_MOVE_JOURNAL_BUFFERED_DATA_OFFSET,
+		              error );
+
+		if( read_count != (ssize_t) batch_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffered data from journal.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              data_mover->file_io_handle,
+		              data_mover->batch_data,
+		              batch_size,
+		              move_journal->source_offset + (off64_t) batch_offset,
+		              error );
+
+		if( read_count != (ssize_t) batch_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read batch at offset: %" PRIu64 ".",
+			 function,
+			 batch_offset );
+
+			return( -1 );
+		}
+		if( journal_file_io_handle != NULL )
+		{
+			write_count = libbfio_handle_write_buffer_at_offset(
+			               journal_file_io_handle,
+			               data_mover->batch_data,
+			               batch_size,
+			               LIBVSMBR_MOVE_JOURNAL_BUFFERED_DATA_OFFSET,
+			               error );
+
+			if( write_count != (ssize_t) batch_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write buffered data to journal.",
+				 function );
+
+				return( -1 );
+			}
+			/* The buffered data must be stored before the journal refers to it
+			 */
+			if( libbfio_handle_flush(
+			     journal_file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush journal.",
+				 function );
+
+				return( -1 );
+			}
+			move_journal->buffered_size = (uint32_t) batch_size;
+
+			if( libvsmbr_data_mover_write_checkpoint(
+			     data_mover,
+			     move_journal,
+			     journal_file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write checkpoint.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               data_mover->file_io_handle,
+	               data_mover->batch_data,
+	               batch_size,
+	               move_journal->destination_offset + (off64_t) batch_offset,
+	               error );
+
+	if( write_count != (ssize_t) batch_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write batch at offset: %" PRIu64 ".",
+		 function,
+		 batch_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a checkpoint to the journal file
+ * The copied data is flushed before the journal is written, so that the journal
+ * never refers to data that has not been stored, and the journal is flushed after
+ * it was written, so that the checkpoint is stored before the copy continues
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_data_mover_write_checkpoint(
+     libvsmbr_data_mover_t *data_mover,
+     libvsmbr_move_journal_t *move_journal,
+     libbfio_handle_t *journal_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_data_mover_write_checkpoint";
+
+	if( libvsmbr_data_mover_flush(
+	     data_mover,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush data mover.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_move_journal_write_file_io_handle(
+	     move_journal,
+	     journal_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write move journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_flush(
+	     journal_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush journal.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies the data described by a move journal
+ * The data is copied in batches of the checkpoint size, after each batch the
+ * copied size is stored in the journal, if a journal file IO handle is provided,
+ * so that an interrupted copy can be resumed.
+ *
+ * If the source and destination ranges overlap the data is copied front to
+ * back when the destination precedes the source and back to front otherwise.
+ * A batch that is not larger than the distance between the source and the
+ * destination never overwrites source data that has not been copied yet and
+ * is copied by the worker threads. A larger batch is copied using the batch
+ * data, which is stored in the journal file before the destination is written.
+ * Hence a batch that was interrupted can always be redone.
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_data_mover_copy(
+     libvsmbr_data_mover_t *data_mover,
+     libvsmbr_move_journal_t *move_journal,
+     libbfio_handle_t *journal_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function   = "libvsmbr_data_mover_copy";
+	size64_t batch_offset   = 0;
+	size64_t batch_size     = 0;
+	size64_t distance       = 0;
+	size64_t remaining_size = 0;
+	int result              = 0;
+
+	if( data_mover == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data mover.",
+		 function );
+
+		return( -1 );
+	}
+	if( move_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid move journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( move_journal->source_offset < 0 )
+	 || ( move_journal->destination_offset < 0 )
+	 || ( move_journal->copied_size > move_journal->data_size )
+	 || ( (size64_t) move_journal->buffered_size > ( move_journal->data_size - move_journal->copied_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid move journal values out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( move_journal->source_offset == move_journal->destination_offset )
+	{
+		move_journal->copied_size   = move_journal->data_size;
+		move_journal->buffered_size = 0;
+
+		return( 1 );
+	}
+	if( move_journal->source_offset < move_journal->destination_offset )
+	{
+		distance = (size64_t) ( move_journal->destination_offset - move_journal->source_offset );
+	}
+	else
+	{
+		distance = (size64_t) ( move_journal->source_offset - move_journal->destination_offset );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	/* The worker threads are started once for all batches
+	 */
+	if( data_mover->thread_pool == NULL )
+	{
+		if( libvsmbr_data_mover_start_threads(
+		     data_mover,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to start threads.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	while( move_journal->copied_size < move_journal->data_size )
+	{
+		if( data_mover->io_handle->abort != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
+
+			goto on_error;
+		}
+		remaining_size = move_journal->data_size - move_journal->copied_size;
+
+		/* A batch that was interrupted while its data was buffered
+		 * is redone with the same size
+		 */
+		if( move_journal->buffered_size != 0 )
+		{
+			batch_size = (size64_t) move_journal->buffered_size;
+		}
+		else
+		{
+			batch_size = data_mover->checkpoint_size;
+
+			if( batch_size > remaining_size )
+			{
+				batch_size = remaining_size;
+			}
+		}
+		if( move_journal->destination_offset < move_journal->source_offset )
+		{
+			batch_offset = move_journal->copied_size;
+		}
+		else
+		{
+			batch_offset = remaining_size - batch_size;
+		}
+		if( ( move_journal->buffered_size != 0 )
+		 || ( batch_size > distance ) )
+		{
+			result = libvsmbr_data_mover_copy_buffered(
+			          data_mover,
+			          move_journal,
+			          journal_file_io_handle,
+			          batch_offset,
+			          (size_t) batch_size,
+			          error );
+		}
+		else
+		{
+			result = libvsmbr_data_mover_copy_range(
+			          data_mover,
+			          move_journal->source_offset + (off64_t) batch_offset,
+			          move_journal->destination_offset + (off64_t) batch_offset,
+			          batch_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to copy data at offset: %" PRIu64 ".",
+			 function,
+			 batch_offset );
+
+			goto on_error;
+		}
+		move_journal->copied_size  += batch_size;
+		move_journal->buffered_size = 0;
+
+		if( journal_file_io_handle != NULL )
+		{
+			if( libvsmbr_data_mover_write_checkpoint(
+			     data_mover,
+			     move_journal,
+			     journal_file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write checkpoint.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( data_mover->thread_pool != NULL )
+	{
+		if( libvsmbr_data_mover_stop_threads(
+		     data_mover,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to stop threads.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( data_mover->thread_pool != NULL )
+	{
+		libvsmbr_data_mover_stop_threads(
+		 data_mover,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
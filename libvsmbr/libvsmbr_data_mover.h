@@ -0,0 +1,222 @@
+/*
+ * Data mover functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSMBR_DATA_MOVER_H )
+#define _LIBVSMBR_DATA_MOVER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsmbr_definitions.h"
+#include "libvsmbr_io_handle.h"
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_libcthreads.h"
+#include "libvsmbr_move_journal.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsmbr_data_mover libvsmbr_data_mover_t;
+
+struct libvsmbr_data_mover
+{
+	/* The IO handle
+	 */
+	libvsmbr_io_handle_t *io_handle;
+
+	/* The file IO handle, which is used by the calling thread
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The checkpoint size
+	 */
+	size64_t checkpoint_size;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The batch data, which contains the data of a batch
+	 * of which the source and destination overlap
+	 */
+	uint8_t *batch_data;
+
+	/* The batch data size
+	 */
+	size_t batch_data_size;
+
+	/* The result of the writes of the worker threads
+	 */
+	int write_result;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	/* The write file IO handles, which are clones of the file IO handle
+	 * that are used by the worker threads
+	 */
+	libbfio_handle_t *write_file_io_handles[ LIBVSMBR_MAXIMUM_NUMBER_OF_THREADS ];
+
+	/* The number of write file IO handles
+	 */
+	int number_of_write_file_io_handles;
+
+	/* The write file IO handles that are not in use by a worker thread
+	 */
+	libbfio_handle_t *available_write_file_io_handles[ LIBVSMBR_MAXIMUM_NUMBER_OF_THREADS ];
+
+	/* The number of available write file IO handles
+	 */
+	int number_of_available_write_file_io_handles;
+
+	/* The thread pool of the worker threads
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The number of blocks that were pushed onto the thread pool
+	 * and have not yet been written
+	 */
+	int number_of_pending_writes;
+
+	/* The mutex that protects the available write file IO handles,
+	 * the number of pending writes and the write result
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is signalled when a block has been written
+	 */
+	libcthreads_condition_t *condition;
+#endif
+};
+
+typedef struct libvsmbr_data_mover_block libvsmbr_data_mover_block_t;
+
+struct libvsmbr_data_mover_block
+{
+	/* The destination offset
+	 */
+	off64_t destination_offset;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+int libvsmbr_data_mover_initialize(
+     libvsmbr_data_mover_t **data_mover,
+     libvsmbr_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     size_t block_size,
+     size64_t checkpoint_size,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int libvsmbr_data_mover_free(
+     libvsmbr_data_mover_t **data_mover,
+     libcerror_error_t **error );
+
+int libvsmbr_data_mover_block_initialize(
+     libvsmbr_data_mover_block_t **data_mover_block,
+     size_t block_size,
+     libcerror_error_t **error );
+
+int libvsmbr_data_mover_block_free(
+     libvsmbr_data_mover_block_t **data_mover_block,
+     libcerror_error_t **error );
+
+int libvsmbr_data_mover_read_block(
+     libvsmbr_data_mover_t *data_mover,
+     libvsmbr_data_mover_block_t *data_mover_block,
+     off64_t source_offset,
+     size_t read_size,
+     libcerror_error_t **error );
+
+int libvsmbr_data_mover_write_block(
+     libvsmbr_data_mover_t *data_mover,
+     libbfio_handle_t *file_io_handle,
+     libvsmbr_data_mover_block_t *data_mover_block,
+     libcerror_error_t **error );
+
+int libvsmbr_data_mover_flush(
+     libvsmbr_data_mover_t *data_mover,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+
+int libvsmbr_data_mover_start_threads(
+     libvsmbr_data_mover_t *data_mover,
+     libcerror_error_t **error );
+
+int libvsmbr_data_mover_stop_threads(
+     libvsmbr_data_mover_t *data_mover,
+     libcerror_error_t **error );
+
+int libvsmbr_data_mover_wait_for_writes(
+     libvsmbr_data_mover_t *data_mover,
+     libcerror_error_t **error );
+
+int libvsmbr_data_mover_write_block_callback(
+     libvsmbr_data_mover_block_t *data_mover_block,
+     libvsmbr_data_mover_t *data_mover );
+
+#endif /* defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT ) */
+
+int libvsmbr_data_mover_copy_range(
+     libvsmbr_data_mover_t *data_mover,
+     off64_t source_offset,
+     off64_t destination_offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libvsmbr_data_mover_copy_buffered(
+     libvsmbr_data_mover_t *data_mover,
+     libvsmbr_move_journal_t *move_journal,
+     libbfio_handle_t *journal_file_io_handle,
+     size64_t batch_offset,
+     size_t batch_size,
+     libcerror_error_t **error );
+
+int libvsmbr_data_mover_write_checkpoint(
+     libvsmbr_data_mover_t *data_mover,
+     libvsmbr_move_journal_t *move_journal,
+     libbfio_handle_t *journal_file_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_data_mover_copy(
+     libvsmbr_data_mover_t *data_mover,
+     libvsmbr_move_journal_t *move_journal,
+     libbfio_handle_t *journal_file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSMBR_DATA_MOVER_H ) */
+
@@ -0,0 +1,1339 @@
+/*
+ * Deflate (zlib) decompression functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsmbr_deflate.h"
+#include "libvsmbr_libcerror.h"
+
+/* The order of the code sizes of the code sizes Huffman table
+ */
+static const uint8_t libvsmbr_deflate_code_sizes_sequence[ 19 ] = {
+	16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+/* The base values of the literal codes 257 - 285
+ */
+static const uint16_t libvsmbr_deflate_literal_codes_base[ 29 ] = {
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+	35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+
+/* The number of extra bits of the literal codes 257 - 285
+ */
+static const uint8_t libvsmbr_deflate_literal_codes_number_of_extra_bits[ 29 ] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+	3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+
+/* The base values of the distance codes 0 - 29
+ */
+static const uint16_t libvsmbr_deflate_distance_codes_base[ 30 ] = {
+	1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+	257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+
+/* The number of extra bits of the distance codes 0 - 29
+ */
+static const uint8_t libvsmbr_deflate_distance_codes_number_of_extra_bits[ 30 ] = {
+	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+	7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+/* Retrieves a value from the bit stream
+ * The bits are read least significant bit first
+ * Returns 1 on success or -1 on error
+ */
+int libvsmbr_deflate_bit_stream_get_value(
+     libvsmbr_deflate_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     uint32_t *value_32bit,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_deflate_bit_stream_get_value";
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits > 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of bits value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 32-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	while( bit_stream->bit_buffer_size < number_of_bits )
+	{
+		if( bit_stream->byte_stream_offset >= bit_stream->byte_stream_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid byte stream offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		bit_stream->bit_buffer |= (uint32_t) bit_stream->byte_stream[ bit_stream->byte_stream_offset ] << bit_stream->bit_buffer_size;
+
+		bit_stream->byte_stream_offset += 1;
+		bit_stream->bit_buffer_size    += 8;
+	}
+	if( number_of_bits == 0 )
+	{
+		*value_32bit = 0;
+	}
+	else
+	{
+		*value_32bit = bit_stream->bit_buffer & ( ( (uint32_t) 1UL << number_of_bits ) - 1 );
+
+		bit_stream->bit_buffer      >>= number_of_bits;
+		bit_stream->bit_buffer_size  -= number_of_bits;
+	}
+	return( 1 );
+}
+
+/* Builds a Huffman table from the code sizes of the symbols
+ * Returns 1 on success or -1 on error
+ */
+int libvsmbr_deflate_build_huffman_table(
+     libvsmbr_deflate_huffman_table_t *huffman_table,
+     const uint8_t *code_sizes,
+     int number_of_code_sizes,
+     libcerror_error_t **error )
+{
+	int symbol_offsets[ LIBVSMBR_DEFLATE_MAXIMUM_CODE_SIZE + 1 ];
+
+	static char *function = "libvsmbr_deflate_build_huffman_table";
+	uint32_t reversed_code = 0;
+	uint16_t code          = 0;
+	uint16_t entry_index   = 0;
+	uint8_t code_size      = 0;
+	int bit_index          = 0;
+	int left_value         = 0;
+	int symbol             = 0;
+	int symbol_index       = 0;
+
+	if( huffman_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman table.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_code_sizes < 0 )
+	 || ( number_of_code_sizes > 288 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of code sizes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     huffman_table,
+	     0,
+	     sizeof( libvsmbr_deflate_huffman_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear Huffman table.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol = 0;
+	     symbol < number_of_code_sizes;
+	     symbol++ )
+	{
+		code_size = code_sizes[ symbol ];
+
+		if( code_size > LIBVSMBR_DEFLATE_MAXIMUM_CODE_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid code size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		huffman_table->code_size_counts[ code_size ] += 1;
+	}
+	/* Codes without a size are not part of the table
+	 */
+	huffman_table->code_size_counts[ 0 ] = 0;
+
+	/* Check if the code sizes describe an over-subscribed set of codes
+	 * an incomplete set of codes is allowed
+	 */
+	left_value = 1;
+
+	for( bit_index = 1;
+	     bit_index <= LIBVSMBR_DEFLATE_MAXIMUM_CODE_SIZE;
+	     bit_index++ )
+	{
+		left_value <<= 1;
+		left_value  -= huffman_table->code_size_counts[ bit_index ];
+
+		if( left_value < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: code sizes are over-subscribed.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	symbol_offsets[ 0 ] = 0;
+	symbol_offsets[ 1 ] = 0;
+
+	for( bit_index = 1;
+	     bit_index < LIBVSMBR_DEFLATE_MAXIMUM_CODE_SIZE;
+	     bit_index++ )
+	{
+		symbol_offsets[ bit_index + 1 ] = symbol_offsets[ bit_index ] + huffman_table->code_size_counts[ bit_index ];
+	}
+	for( symbol = 0;
+	     symbol < number_of_code_sizes;
+	     symbol++ )
+	{
+		code_size = code_sizes[ symbol ];
+
+		if( code_size != 0 )
+		{
+			symbol_index = symbol_offsets[ code_size ];
+
+			huffman_table->symbols[ symbol_index ] = (uint16_t) symbol;
+
+			symbol_offsets[ code_size ] += 1;
+		}
+	}
+	/* Fill the lookup table with the canonical codes that fit in it
+	 * the codes are stored bit reversed since the bit stream is read
+	 * least significant bit first
+	 */
+	code         = 0;
+	symbol_index = 0;
+
+	for( code_size = 1;
+	     code_size <= LIBVSMBR_DEFLATE_LOOKUP_TABLE_BITS;
+	     code_size++ )
+	{
+		for( symbol = 0;
+		     symbol < huffman_table->code_size_counts[ code_size ];
+		     symbol++ )
+		{
+			reversed_code = 0;
+
+			for( bit_index = 0;
+			     bit_index < (int) code_size;
+			     bit_index++ )
+			{
+				reversed_code <<= 1;
+				reversed_code  |= ( code >> bit_index ) & 0x0001;
+			}
+			for( entry_index = (uint16_t) reversed_code;
+			     entry_index < ( 1 << LIBVSMBR_DEFLATE_LOOKUP_TABLE_BITS );
+			     entry_index += (uint16_t) ( 1 << code_size ) )
+			{
+				huffman_table->lookup_table[ entry_index ] = (uint16_t) ( ( huffman_table->symbols[ symbol_index ] << 4 ) | code_size );
+			}
+			code         += 1;
+			symbol_index += 1;
+		}
+		code <<= 1;
+	}
+	return( 1 );
+}
+
+/* Retrieves a Huffman encoded value from the bit stream
+ * Returns 1 on success or -1 on error
+ */
+int libvsmbr_deflate_bit_stream_get_huffman_encoded_value(
+     libvsmbr_deflate_bit_stream_t *bit_stream,
+     libvsmbr_deflate_huffman_table_t *huffman_table,
+     uint16_t *value_16bit,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_deflate_bit_stream_get_huffman_encoded_value";
+	uint32_t value_32bit  = 0;
+	uint16_t entry        = 0;
+	uint8_t code_size     = 0;
+	int code              = 0;
+	int code_size_count   = 0;
+	int first_code        = 0;
+	int first_index       = 0;
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( huffman_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman table.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_16bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 16-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	/* Fill the bit buffer with as many bits as are available for a lookup
+	 */
+	while( ( bit_stream->bit_buffer_size < LIBVSMBR_DEFLATE_LOOKUP_TABLE_BITS )
+	    && ( bit_stream->byte_stream_offset < bit_stream->byte_stream_size ) )
+	{
+		bit_stream->bit_buffer |= (uint32_t) bit_stream->byte_stream[ bit_stream->byte_stream_offset ] << bit_stream->bit_buffer_size;
+
+		bit_stream->byte_stream_offset += 1;
+		bit_stream->bit_buffer_size    += 8;
+	}
+	entry     = huffman_table->lookup_table[ bit_stream->bit_buffer & ( ( 1 << LIBVSMBR_DEFLATE_LOOKUP_TABLE_BITS ) - 1 ) ];
+	code_size = (uint8_t) ( entry & 0x000f );
+
+	if( ( code_size != 0 )
+	 && ( code_size <= bit_stream->bit_buffer_size ) )
+	{
+		bit_stream->bit_buffer      >>= code_size;
+		bit_stream->bit_buffer_size  -= code_size;
+
+		*value_16bit = entry >> 4;
+
+		return( 1 );
+	}
+	/* Decode codes that are not in the lookup table one bit at a time
+	 */
+	for( code_size = 1;
+	     code_size <= LIBVSMBR_DEFLATE_MAXIMUM_CODE_SIZE;
+	     code_size++ )
+	{
+		if( libvsmbr_deflate_bit_stream_get_value(
+		     bit_stream,
+		     1,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from bit stream.",
+			 function );
+
+			return( -1 );
+		}
+		code           |= (int) value_32bit;
+		code_size_count = huffman_table->code_size_counts[ code_size ];
+
+		if( ( code - code_size_count ) < first_code )
+		{
+			*value_16bit = huffman_table->symbols[ first_index + ( code - first_code ) ];
+
+			return( 1 );
+		}
+		first_index += code_size_count;
+		first_code  += code_size_count;
+		first_code <<= 1;
+		code       <<= 1;
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+	 "%s: invalid Huffman encoded value.",
+	 function );
+
+	return( -1 );
+}
+
+/* Builds the fixed Huffman tables
+ * Returns 1 on success or -1 on error
+ */
+int libvsmbr_deflate_build_fixed_huffman_tables(
+     libvsmbr_deflate_huffman_table_t *literals_huffman_table,
+     libvsmbr_deflate_huffman_table_t *distances_huffman_table,
+     libcerror_error_t **error )
+{
+	uint8_t code_sizes[ 288 ];
+
+	static char *function = "libvsmbr_deflate_build_fixed_huffman_tables";
+	int symbol            = 0;
+
+	for( symbol = 0;
+	     symbol < 288;
+	     symbol++ )
+	{
+		if( symbol < 144 )
+		{
+			code_sizes[ symbol ] = 8;
+		}
+		else if( symbol < 256 )
+		{
+			code_sizes[ symbol ] = 9;
+		}
+		else if( symbol < 280 )
+		{
+			code_sizes[ symbol ] = 7;
+		}
+		else
+		{
+			code_sizes[ symbol ] = 8;
+		}
+	}
+	if( libvsmbr_deflate_build_huffman_table(
+	     literals_huffman_table,
+	     code_sizes,
+	     288,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build literals Huffman table.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol = 0;
+	     symbol < 30;
+	     symbol++ )
+	{
+		code_sizes[ symbol ] = 5;
+	}
+	if( libvsmbr_deflate_build_huffman_table(
+	     distances_huffman_table,
+	     code_sizes,
+	     30,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build distances Huffman table.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Builds the dynamic Huffman tables from the bit stream
+ * Returns 1 on success or -1 on error
+ */
+int libvsmbr_deflate_build_dynamic_huffman_tables(
+     libvsmbr_deflate_bit_stream_t *bit_stream,
+     libvsmbr_deflate_huffman_table_t *literals_huffman_table,
+     libvsmbr_deflate_huffman_table_t *distances_huffman_table,
+     libcerror_error_t **error )
+{
+	libvsmbr_deflate_huffman_table_t code_sizes_huffman_table;
+
+	uint8_t code_sizes[ 286 + 30 ];
+
+	static char *function             = "libvsmbr_deflate_build_dynamic_huffman_tables";
+	uint32_t code_size_index          = 0;
+	uint32_t number_of_code_sizes     = 0;
+	uint32_t number_of_distance_codes = 0;
+	uint32_t number_of_literal_codes  = 0;
+	uint32_t times_to_repeat          = 0;
+	uint32_t value_32bit              = 0;
+	uint16_t code_size_symbol         = 0;
+	uint8_t code_size                 = 0;
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_deflate_bit_stream_get_value(
+	     bit_stream,
+	     5,
+	     &number_of_literal_codes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of literal codes from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_literal_codes += 257;
+
+	if( libvsmbr_deflate_bit_stream_get_value(
+	     bit_stream,
+	     5,
+	     &number_of_distance_codes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of distance codes from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_distance_codes += 1;
+
+	if( libvsmbr_deflate_bit_stream_get_value(
+	     bit_stream,
+	     4,
+	     &number_of_code_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of code sizes from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_code_sizes += 4;
+
+	if( ( number_of_literal_codes > 286 )
+	 || ( number_of_distance_codes > 30 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of literal or distance codes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     code_sizes,
+	     0,
+	     sizeof( uint8_t ) * ( 286 + 30 ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	for( code_size_index = 0;
+	     code_size_index < number_of_code_sizes;
+	     code_size_index++ )
+	{
+		if( libvsmbr_deflate_bit_stream_get_value(
+		     bit_stream,
+		     3,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve code size: %" PRIu32 " from bit stream.",
+			 function,
+			 code_size_index );
+
+			return( -1 );
+		}
+		code_sizes[ libvsmbr_deflate_code_sizes_sequence[ code_size_index ] ] = (uint8_t) value_32bit;
+	}
+	if( libvsmbr_deflate_build_huffman_table(
+	     &code_sizes_huffman_table,
+	     code_sizes,
+	     19,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build code sizes Huffman table.",
+		 function );
+
+		return( -1 );
+	}
+	code_size_index = 0;
+
+	while( code_size_index < ( number_of_literal_codes + number_of_distance_codes ) )
+	{
+		if( libvsmbr_deflate_bit_stream_get_huffman_encoded_value(
+		     bit_stream,
+		     &code_sizes_huffman_table,
+		     &code_size_symbol,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve code size symbol from bit stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( code_size_symbol < 16 )
+		{
+			code_sizes[ code_size_index++ ] = (uint8_t) code_size_symbol;
+
+			continue;
+		}
+		code_size = 0;
+
+		if( code_size_symbol == 16 )
+		{
+			if( code_size_index == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid code size index value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			code_size = code_sizes[ code_size_index - 1 ];
+
+			if( libvsmbr_deflate_bit_stream_get_value(
+			     bit_stream,
+			     2,
+			     &times_to_repeat,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve times to repeat from bit stream.",
+				 function );
+
+				return( -1 );
+			}
+			times_to_repeat += 3;
+		}
+		else if( code_size_symbol == 17 )
+		{
+			if( libvsmbr_deflate_bit_stream_get_value(
+			     bit_stream,
+			     3,
+			     &times_to_repeat,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve times to repeat from bit stream.",
+				 function );
+
+				return( -1 );
+			}
+			times_to_repeat += 3;
+		}
+		else if( code_size_symbol == 18 )
+		{
+			if( libvsmbr_deflate_bit_stream_get_value(
+			     bit_stream,
+			     7,
+			     &times_to_repeat,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve times to repeat from bit stream.",
+				 function );
+
+				return( -1 );
+			}
+			times_to_repeat += 11;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid code size symbol: %" PRIu16 ".",
+			 function,
+			 code_size_symbol );
+
+			return( -1 );
+		}
+		if( times_to_repeat > ( ( number_of_literal_codes + number_of_distance_codes ) - code_size_index ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid times to repeat value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		while( times_to_repeat > 0 )
+		{
+			code_sizes[ code_size_index++ ] = code_size;
+
+			times_to_repeat--;
+		}
+	}
+	/* The end-of-block code is required
+	 */
+	if( code_sizes[ 256 ] == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing end-of-block code.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_deflate_build_huffman_table(
+	     literals_huffman_table,
+	     code_sizes,
+	     (int) number_of_literal_codes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build literals Huffman table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_deflate_build_huffman_table(
+	     distances_huffman_table,
+	     &( code_sizes[ number_of_literal_codes ] ),
+	     (int) number_of_distance_codes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build distances Huffman table.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decodes a Huffman compressed block
+ * Returns 1 on success or -1 on error
+ */
+int libvsmbr_deflate_decode_huffman(
+     libvsmbr_deflate_bit_stream_t *bit_stream,
+     libvsmbr_deflate_huffman_table_t *literals_huffman_table,
+     libvsmbr_deflate_huffman_table_t *distances_huffman_table,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_deflate_decode_huffman";
+	size_t data_offset    = 0;
+	uint32_t distance     = 0;
+	uint32_t length       = 0;
+	uint32_t value_32bit  = 0;
+	uint16_t symbol       = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = *uncompressed_data_offset;
+
+	do
+	{
+		if( libvsmbr_deflate_bit_stream_get_huffman_encoded_value(
+		     bit_stream,
+		     literals_huffman_table,
+		     &symbol,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve literal symbol from bit stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( symbol < 256 )
+		{
+			if( data_offset >= uncompressed_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid uncompressed data value too small.",
+				 function );
+
+				return( -1 );
+			}
+			uncompressed_data[ data_offset++ ] = (uint8_t) symbol;
+		}
+		else if( symbol > 256 )
+		{
+			symbol -= 257;
+
+			if( symbol >= 29 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid literal symbol value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( libvsmbr_deflate_bit_stream_get_value(
+			     bit_stream,
+			     libvsmbr_deflate_literal_codes_number_of_extra_bits[ symbol ],
+			     &value_32bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve length extra bits from bit stream.",
+				 function );
+
+				return( -1 );
+			}
+			length = libvsmbr_deflate_literal_codes_base[ symbol ] + value_32bit;
+
+			if( libvsmbr_deflate_bit_stream_get_huffman_encoded_value(
+			     bit_stream,
+			     distances_huffman_table,
+			     &symbol,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve distance symbol from bit stream.",
+				 function );
+
+				return( -1 );
+			}
+			if( symbol >= 30 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid distance symbol value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( libvsmbr_deflate_bit_stream_get_value(
+			     bit_stream,
+			     libvsmbr_deflate_distance_codes_number_of_extra_bits[ symbol ],
+			     &value_32bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve distance extra bits from bit stream.",
+				 function );
+
+				return( -1 );
+			}
+			distance = libvsmbr_deflate_distance_codes_base[ symbol ] + value_32bit;
+
+			if( (size_t) distance > data_offset )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid distance value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( (size_t) length > ( uncompressed_data_size - data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid uncompressed data value too small.",
+				 function );
+
+				return( -1 );
+			}
+			/* The source and destination can overlap, hence the byte by byte copy
+			 */
+			while( length > 0 )
+			{
+				uncompressed_data[ data_offset ] = uncompressed_data[ data_offset - distance ];
+
+				data_offset++;
+				length--;
+			}
+		}
+	}
+	while( symbol != 256 );
+
+	*uncompressed_data_offset = data_offset;
+
+	return( 1 );
+}
+
+/* Decompresses raw deflate (RFC 1951) compressed data
+ * On return uncompressed_data_size contains the size of the uncompressed data
+ * Returns 1 on success or -1 on error
+ */
+int libvsmbr_deflate_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_deflate_bit_stream_t bit_stream;
+	libvsmbr_deflate_huffman_table_t distances_huffman_table;
+	libvsmbr_deflate_huffman_table_t literals_huffman_table;
+
+	static char *function         = "libvsmbr_deflate_decompress";
+	size_t safe_uncompressed_size = 0;
+	size_t uncompressed_offset    = 0;
+	uint32_t block_size           = 0;
+	uint32_t block_size_copy      = 0;
+	uint32_t block_type           = 0;
+	uint32_t last_block_flag      = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_size = *uncompressed_data_size;
+
+	if( safe_uncompressed_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream.byte_stream        = compressed_data;
+	bit_stream.byte_stream_size   = compressed_data_size;
+	bit_stream.byte_stream_offset = 0;
+	bit_stream.bit_buffer         = 0;
+	bit_stream.bit_buffer_size    = 0;
+
+	do
+	{
+		if( libvsmbr_deflate_bit_stream_get_value(
+		     &bit_stream,
+		     1,
+		     &last_block_flag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve last block flag from bit stream.",
+			 function );
+
+			goto on_error;
+		}
+		if( libvsmbr_deflate_bit_stream_get_value(
+		     &bit_stream,
+		     2,
+		     &block_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve block type from bit stream.",
+			 function );
+
+			goto on_error;
+		}
+		switch( block_type )
+		{
+			case 0:
+				/* Skip the remaining bits of the current byte
+				 */
+				bit_stream.bit_buffer      >>= bit_stream.bit_buffer_size & 0x07;
+				bit_stream.bit_buffer_size  -= bit_stream.bit_buffer_size & 0x07;
+
+				if( libvsmbr_deflate_bit_stream_get_value(
+				     &bit_stream,
+				     16,
+				     &block_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve block size from bit stream.",
+					 function );
+
+					goto on_error;
+				}
+				if( libvsmbr_deflate_bit_stream_get_value(
+				     &bit_stream,
+				     16,
+				     &block_size_copy,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve block size copy from bit stream.",
+					 function );
+
+					goto on_error;
+				}
+				/* The copy of the block size is stored as its ones' complement
+				 */
+				block_size_copy ^= 0x0000ffffUL;
+
+				if( block_size != block_size_copy )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_INPUT,
+					 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+					 "%s: mismatch in block size (%" PRIu32 ") and copy (%" PRIu32 ").",
+					 function,
+					 block_size,
+					 block_size_copy );
+
+					goto on_error;
+				}
+				/* Return the whole bytes that remain in the bit buffer to the byte stream
+				 */
+				bit_stream.byte_stream_offset -= bit_stream.bit_buffer_size / 8;
+				bit_stream.bit_buffer          = 0;
+				bit_stream.bit_buffer_size     = 0;
+
+				if( (size_t) block_size > ( compressed_data_size - bit_stream.byte_stream_offset ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid block size value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
+				if( (size_t) block_size > ( safe_uncompressed_size - uncompressed_offset ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid uncompressed data value too small.",
+					 function );
+
+					goto on_error;
+				}
+				if( memory_copy(
+				     &( uncompressed_data[ uncompressed_offset ] ),
+				     &( compressed_data[ bit_stream.byte_stream_offset ] ),
+				     (size_t) block_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy stored block data.",
+					 function );
+
+					goto on_error;
+				}
+				bit_stream.byte_stream_offset += block_size;
+				uncompressed_offset           += block_size;
+
+				break;
+
+			case 1:
+				if( libvsmbr_deflate_build_fixed_huffman_tables(
+				     &literals_huffman_table,
+				     &distances_huffman_table,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to build fixed Huffman tables.",
+					 function );
+
+					goto on_error;
+				}
+				if( libvsmbr_deflate_decode_huffman(
+				     &bit_stream,
+				     &literals_huffman_table,
+				     &distances_huffman_table,
+				     uncompressed_data,
+				     safe_uncompressed_size,
+				     &uncompressed_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+					 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+					 "%s: unable to decode fixed Huffman encoded block.",
+					 function );
+
+					goto on_error;
+				}
+				break;
+
+			case 2:
+				if( libvsmbr_deflate_build_dynamic_huffman_tables(
+				     &bit_stream,
+				     &literals_huffman_table,
+				     &distances_huffman_table,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to build dynamic Huffman tables.",
+					 function );
+
+					goto on_error;
+				}
+				if( libvsmbr_deflate_decode_huffman(
+				     &bit_stream,
+				     &literals_huffman_table,
+				     &distances_huffman_table,
+				     uncompressed_data,
+				     safe_uncompressed_size,
+				     &uncompressed_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+					 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+					 "%s: unable to decode dynamic Huffman encoded block.",
+					 function );
+
+					goto on_error;
+				}
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported block type: %" PRIu32 ".",
+				 function,
+				 block_type );
+
+				goto on_error;
+		}
+	}
+	while( last_block_flag == 0 );
+
+	*uncompressed_data_size = uncompressed_offset;
+
+	return( 1 );
+
+on_error:
+	return( -1 );
+}
+
@@ -0,0 +1,134 @@
+/*
+ * Deflate (zlib) decompression functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSMBR_DEFLATE_H )
+#define _LIBVSMBR_DEFLATE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsmbr_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of bits of the code that is used to look up a symbol
+ * in a single step, longer codes are decoded one bit at a time
+ */
+#define LIBVSMBR_DEFLATE_LOOKUP_TABLE_BITS	9
+
+#define LIBVSMBR_DEFLATE_MAXIMUM_CODE_SIZE	15
+
+typedef struct libvsmbr_deflate_bit_stream libvsmbr_deflate_bit_stream_t;
+
+struct libvsmbr_deflate_bit_stream
+{
+	/* The byte stream
+	 */
+	const uint8_t *byte_stream;
+
+	/* The byte stream size
+	 */
+	size_t byte_stream_size;
+
+	/* The byte stream offset
+	 */
+	size_t byte_stream_offset;
+
+	/* The bit buffer, of which the least significant bit is the next bit
+	 */
+	uint32_t bit_buffer;
+
+	/* The number of bits in the bit buffer
+	 */
+	uint8_t bit_buffer_size;
+};
+
+typedef struct libvsmbr_deflate_huffman_table libvsmbr_deflate_huffman_table_t;
+
+struct libvsmbr_deflate_huffman_table
+{
+	/* The number of codes per code size
+	 */
+	int code_size_counts[ LIBVSMBR_DEFLATE_MAXIMUM_CODE_SIZE + 1 ];
+
+	/* The symbols in order of their code
+	 */
+	uint16_t symbols[ 288 ];
+
+	/* The lookup table, that contains the symbol shifted by 4 bits
+	 * and the code size or 0 if the code is not in the lookup table
+	 */
+	uint16_t lookup_table[ 1 << LIBVSMBR_DEFLATE_LOOKUP_TABLE_BITS ];
+};
+
+int libvsmbr_deflate_bit_stream_get_value(
+     libvsmbr_deflate_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     uint32_t *value_32bit,
+     libcerror_error_t **error );
+
+int libvsmbr_deflate_build_huffman_table(
+     libvsmbr_deflate_huffman_table_t *huffman_table,
+     const uint8_t *code_sizes,
+     int number_of_code_sizes,
+     libcerror_error_t **error );
+
+int libvsmbr_deflate_bit_stream_get_huffman_encoded_value(
+     libvsmbr_deflate_bit_stream_t *bit_stream,
+     libvsmbr_deflate_huffman_table_t *huffman_table,
+     uint16_t *value_16bit,
+     libcerror_error_t **error );
+
+int libvsmbr_deflate_build_fixed_huffman_tables(
+     libvsmbr_deflate_huffman_table_t *literals_huffman_table,
+     libvsmbr_deflate_huffman_table_t *distances_huffman_table,
+     libcerror_error_t **error );
+
+int libvsmbr_deflate_build_dynamic_huffman_tables(
+     libvsmbr_deflate_bit_stream_t *bit_stream,
+     libvsmbr_deflate_huffman_table_t *literals_huffman_table,
+     libvsmbr_deflate_huffman_table_t *distances_huffman_table,
+     libcerror_error_t **error );
+
+int libvsmbr_deflate_decode_huffman(
+     libvsmbr_deflate_bit_stream_t *bit_stream,
+     libvsmbr_deflate_huffman_table_t *literals_huffman_table,
+     libvsmbr_deflate_huffman_table_t *distances_huffman_table,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error );
+
+int libvsmbr_deflate_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSMBR_DEFLATE_H ) */
+
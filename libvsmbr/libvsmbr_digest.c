@@ -0,0 +1,199 @@
+/*
+ * Digest functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsmbr_definitions.h"
+#include "libvsmbr_digest.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_libhmac.h"
+
+/* Calculates the 64-bit Fowler-Noll-Vo (FNV-1a) hash of the data
+ */
+static void libvsmbr_digest_fnv1a_64_calculate(
+             const uint8_t *data,
+             size_t data_size,
+             uint8_t *digest )
+{
+	uint64_t hash_value = 0xcbf29ce484222325ULL;
+	size_t data_offset  = 0;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		hash_value ^= data[ data_offset ];
+		hash_value *= 0x00000100000001b3ULL;
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 digest,
+	 hash_value );
+}
+
+/* Retrieves the size of a digest of a specific type
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_digest_get_size(
+     int digest_type,
+     size_t *digest_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_digest_get_size";
+
+	if( digest_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest size.",
+		 function );
+
+		return( -1 );
+	}
+	switch( digest_type )
+	{
+		case LIBVSMBR_DIGEST_TYPE_FNV1A_64:
+			*digest_size = LIBVSMBR_DIGEST_FNV1A_64_SIZE;
+			break;
+
+		case LIBVSMBR_DIGEST_TYPE_SHA256:
+			*digest_size = LIBVSMBR_DIGEST_SHA256_SIZE;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported digest type: %d.",
+			 function,
+			 digest_type );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Calculates a digest of a specific type
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_digest_calculate(
+     int digest_type,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *digest,
+     size_t digest_size,
+     libcerror_error_t **error )
+{
+	static char *function        = "libvsmbr_digest_calculate";
+	size_t required_digest_size = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_digest_get_size(
+	     digest_type,
+	     &required_digest_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve digest size.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_size < required_digest_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid digest size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_type == LIBVSMBR_DIGEST_TYPE_FNV1A_64 )
+	{
+		libvsmbr_digest_fnv1a_64_calculate(
+		 data,
+		 data_size,
+		 digest );
+	}
+	else
+	{
+		if( libhmac_sha256_calculate(
+		     data,
+		     data_size,
+		     digest,
+		     digest_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate SHA-256.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
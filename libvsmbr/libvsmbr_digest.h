@@ -0,0 +1,57 @@
+/*
+ * Digest functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSMBR_DIGEST_H )
+#define _LIBVSMBR_DIGEST_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsmbr_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define LIBVSMBR_DIGEST_FNV1A_64_SIZE		8
+#define LIBVSMBR_DIGEST_SHA256_SIZE		32
+
+#define LIBVSMBR_DIGEST_MAXIMUM_SIZE		32
+
+int libvsmbr_digest_get_size(
+     int digest_type,
+     size_t *digest_size,
+     libcerror_error_t **error );
+
+int libvsmbr_digest_calculate(
+     int digest_type,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *digest,
+     size_t digest_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSMBR_DIGEST_H ) */
+
@@ -0,0 +1,225 @@
+/*
+ * Dirty block functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsmbr_dirty_block.h"
+#include "libvsmbr_libcdata.h"
+#include "libvsmbr_libcerror.h"
+
+/* Creates a dirty block
+ * Make sure the value dirty_block is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_dirty_block_initialize(
+     libvsmbr_dirty_block_t **dirty_block,
+     off64_t offset,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_dirty_block_initialize";
+
+	if( dirty_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dirty block.",
+		 function );
+
+		return( -1 );
+	}
+	if( *dirty_block != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid dirty block value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*dirty_block = memory_allocate_structure(
+	                libvsmbr_dirty_block_t );
+
+	if( *dirty_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create dirty block.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *dirty_block,
+	     0,
+	     sizeof( libvsmbr_dirty_block_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear dirty block.",
+		 function );
+
+		memory_free(
+		 *dirty_block );
+
+		*dirty_block = NULL;
+
+		return( -1 );
+	}
+	( *dirty_block )->data = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * data_size );
+
+	if( ( *dirty_block )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	( *dirty_block )->offset    = offset;
+	( *dirty_block )->data_size = data_size;
+
+	return( 1 );
+
+on_error:
+	if( *dirty_block != NULL )
+	{
+		memory_free(
+		 *dirty_block );
+
+		*dirty_block = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a dirty block
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_dirty_block_free(
+     libvsmbr_dirty_block_t **dirty_block,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_dirty_block_free";
+
+	if( dirty_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dirty block.",
+		 function );
+
+		return( -1 );
+	}
+	if( *dirty_block != NULL )
+	{
+		memory_free(
+		 ( *dirty_block )->data );
+
+		memory_free(
+		 *dirty_block );
+
+		*dirty_block = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares two dirty blocks by their offset
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libvsmbr_dirty_block_compare(
+     libvsmbr_dirty_block_t *first_dirty_block,
+     libvsmbr_dirty_block_t *second_dirty_block,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_dirty_block_compare";
+
+	if( first_dirty_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first dirty block.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_dirty_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second dirty block.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_dirty_block->offset < second_dirty_block->offset )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_dirty_block->offset > second_dirty_block->offset )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
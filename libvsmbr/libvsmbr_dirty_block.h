@@ -0,0 +1,71 @@
+/*
+ * Dirty block functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSMBR_DIRTY_BLOCK_H )
+#define _LIBVSMBR_DIRTY_BLOCK_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsmbr_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsmbr_dirty_block libvsmbr_dirty_block_t;
+
+struct libvsmbr_dirty_block
+{
+	/* The offset of the block relative to the start of the volume
+	 */
+	off64_t offset;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+int libvsmbr_dirty_block_initialize(
+     libvsmbr_dirty_block_t **dirty_block,
+     off64_t offset,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libvsmbr_dirty_block_free(
+     libvsmbr_dirty_block_t **dirty_block,
+     libcerror_error_t **error );
+
+int libvsmbr_dirty_block_compare(
+     libvsmbr_dirty_block_t *first_dirty_block,
+     libvsmbr_dirty_block_t *second_dirty_block,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSMBR_DIRTY_BLOCK_H ) */
+
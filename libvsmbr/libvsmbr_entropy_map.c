@@ -0,0 +1,1598 @@
+/*
+ * Entropy map functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsmbr_definitions.h"
+#include "libvsmbr_entropy_map.h"
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_libcthreads.h"
+#include "libvsmbr_partition.h"
+#include "libvsmbr_types.h"
+
+/* Calculates the base-2 logarithm of a non-zero value
+ * The fractional part is determined by repeated squaring, with 24 bits
+ * of precision, which is sufficient for a single-precision result
+ */
+static double libvsmbr_entropy_map_log2(
+               uint32_t value )
+{
+	double fraction       = 0.0;
+	double fraction_bit   = 0.5;
+	double result         = 0.0;
+	uint32_t integer_part = 0;
+	uint32_t safe_value   = value;
+	int bit_index         = 0;
+
+	while( safe_value > 1 )
+	{
+		safe_value >>= 1;
+		integer_part++;
+	}
+	fraction = (double) value / (double) ( (uint32_t) 1 << integer_part );
+	result   = (double) integer_part;
+
+	for( bit_index = 0;
+	     bit_index < 24;
+	     bit_index++ )
+	{
+		fraction *= fraction;
+
+		if( fraction >= 2.0 )
+		{
+			fraction /= 2.0;
+			result   += fraction_bit;
+		}
+		fraction_bit /= 2.0;
+	}
+	return( result );
+}
+
+/* Creates an entropy map
+ * Make sure the value entropy_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_entropy_map_initialize(
+     libvsmbr_entropy_map_t **entropy_map,
+     uint32_t block_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_entropy_map_t *internal_entropy_map = NULL;
+	static char *function                                 = "libvsmbr_entropy_map_initialize";
+
+	if( entropy_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entropy map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entropy_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid entropy map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( ( block_size % 512 ) != 0 )
+	 || ( block_size > LIBVSMBR_MAXIMUM_ENTROPY_MAP_BLOCK_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported block size: %" PRIu32 ".",
+		 function,
+		 block_size );
+
+		return( -1 );
+	}
+	internal_entropy_map = memory_allocate_structure(
+	                        libvsmbr_internal_entropy_map_t );
+
+	if( internal_entropy_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entropy map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_entropy_map,
+	     0,
+	     sizeof( libvsmbr_internal_entropy_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entropy map.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_entropy_map->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_entropy_map->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_entropy_map->block_size = block_size;
+
+	*entropy_map = (libvsmbr_entropy_map_t *) internal_entropy_map;
+
+	return( 1 );
+
+on_error:
+	if( internal_entropy_map != NULL )
+	{
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+		if( internal_entropy_map->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( internal_entropy_map->read_write_lock ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 internal_entropy_map );
+	}
+	return( -1 );
+}
+
+/* Frees an entropy map
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_entropy_map_free(
+     libvsmbr_entropy_map_t **entropy_map,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_entropy_map_t *internal_entropy_map = NULL;
+	static char *function                                 = "libvsmbr_entropy_map_free";
+	int result                                            = 1;
+
+	if( entropy_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entropy map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entropy_map != NULL )
+	{
+		internal_entropy_map = (libvsmbr_internal_entropy_map_t *) *entropy_map;
+		*entropy_map         = NULL;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_entropy_map->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_entropy_map->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( internal_entropy_map->entropies != NULL )
+		{
+			memory_free(
+			 internal_entropy_map->entropies );
+		}
+		memory_free(
+		 internal_entropy_map );
+	}
+	return( result );
+}
+
+/* Sets the data size and (re)allocates the entropies
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_entropy_map_set_data_size(
+     libvsmbr_internal_entropy_map_t *internal_entropy_map,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libvsmbr_internal_entropy_map_set_data_size";
+	uint64_t number_of_blocks = 0;
+	size_t entropies_size     = 0;
+
+	if( internal_entropy_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entropy map.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_entropy_map->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid entropy map - missing block size.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_blocks = data_size / internal_entropy_map->block_size;
+
+	if( ( data_size % internal_entropy_map->block_size ) != 0 )
+	{
+		number_of_blocks += 1;
+	}
+	if( number_of_blocks > (uint64_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( float ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of blocks value exceeds maximum, use a larger block size.",
+		 function );
+
+		return( -1 );
+	}
+	entropies_size = (size_t) number_of_blocks * sizeof( float );
+
+	if( internal_entropy_map->entropies != NULL )
+	{
+		memory_free(
+		 internal_entropy_map->entropies );
+
+		internal_entropy_map->entropies = NULL;
+	}
+	internal_entropy_map->data_size        = 0;
+	internal_entropy_map->number_of_blocks = 0;
+
+	if( entropies_size > 0 )
+	{
+		internal_entropy_map->entropies = (float *) memory_allocate(
+		                                             entropies_size );
+
+		if( internal_entropy_map->entropies == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entropies.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     internal_entropy_map->entropies,
+		     0,
+		     entropies_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entropies.",
+			 function );
+
+			memory_free(
+			 internal_entropy_map->entropies );
+
+			internal_entropy_map->entropies = NULL;
+
+			return( -1 );
+		}
+	}
+	internal_entropy_map->data_size        = data_size;
+	internal_entropy_map->number_of_blocks = number_of_blocks;
+
+	return( 1 );
+}
+
+/* Creates an entropy map block
+ * Make sure the value entropy_map_block is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_entropy_map_block_initialize(
+     libvsmbr_entropy_map_block_t **entropy_map_block,
+     uint32_t block_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_entropy_map_block_t *safe_entropy_map_block = NULL;
+	static char *function                                = "libvsmbr_entropy_map_block_initialize";
+
+	if( entropy_map_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entropy map block.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entropy_map_block != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid entropy map block value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > LIBVSMBR_MAXIMUM_ENTROPY_MAP_BLOCK_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_entropy_map_block = memory_allocate_structure(
+	                          libvsmbr_entropy_map_block_t );
+
+	if( safe_entropy_map_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entropy map block.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_entropy_map_block,
+	     0,
+	     sizeof( libvsmbr_entropy_map_block_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entropy map block.",
+		 function );
+
+		goto on_error;
+	}
+	safe_entropy_map_block->data = (uint8_t *) memory_allocate(
+	                                            sizeof( uint8_t ) * block_size );
+
+	if( safe_entropy_map_block->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	*entropy_map_block = safe_entropy_map_block;
+
+	return( 1 );
+
+on_error:
+	if( safe_entropy_map_block != NULL )
+	{
+		memory_free(
+		 safe_entropy_map_block );
+	}
+	return( -1 );
+}
+
+/* Frees an entropy map block
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_entropy_map_block_free(
+     libvsmbr_entropy_map_block_t **entropy_map_block,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_entropy_map_block_free";
+
+	if( entropy_map_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entropy map block.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entropy_map_block != NULL )
+	{
+		if( ( *entropy_map_block )->data != NULL )
+		{
+			memory_free(
+			 ( *entropy_map_block )->data );
+		}
+		memory_free(
+		 *entropy_map_block );
+
+		*entropy_map_block = NULL;
+	}
+	return( 1 );
+}
+
+/* Calculates the Shannon entropy of the byte values in data
+ * The entropy is expressed in bits per byte, in the range 0.0 to 8.0
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_entropy_map_calculate_entropy(
+     const uint8_t *data,
+     size_t data_size,
+     float *entropy,
+     libcerror_error_t **error )
+{
+	uint32_t histograms[ 4 ][ 256 ];
+
+	static char *function      = "libvsmbr_entropy_map_calculate_entropy";
+	double sum_of_counts_log2  = 0.0;
+	double safe_entropy        = 0.0;
+	size_t data_offset         = 0;
+	uint32_t byte_count        = 0;
+	uint16_t byte_value        = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( entropy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entropy.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		*entropy = 0.0f;
+
+		return( 1 );
+	}
+	if( memory_set(
+	     histograms,
+	     0,
+	     sizeof( uint32_t ) * 4 * 256 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear histograms.",
+		 function );
+
+		return( -1 );
+	}
+	/* Consecutive bytes are counted in separate histograms so that runs of
+	 * the same byte value do not serialize on a single counter
+	 */
+	while( ( data_size - data_offset ) >= 4 )
+	{
+		histograms[ 0 ][ data[ data_offset ] ] += 1;
+		histograms[ 1 ][ data[ data_offset + 1 ] ] += 1;
+		histograms[ 2 ][ data[ data_offset + 2 ] ] += 1;
+		histograms[ 3 ][ data[ data_offset + 3 ] ] += 1;
+
+		data_offset += 4;
+	}
+	while( data_offset < data_size )
+	{
+		histograms[ 0 ][ data[ data_offset ] ] += 1;
+
+		data_offset += 1;
+	}
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		byte_count = histograms[ 0 ][ byte_value ]
+		           + histograms[ 1 ][ byte_value ]
+		           + histograms[ 2 ][ byte_value ]
+		           + histograms[ 3 ][ byte_value ];
+
+		if( byte_count > 0 )
+		{
+			sum_of_counts_log2 += (double) byte_count * libvsmbr_entropy_map_log2(
+			                                             byte_count );
+		}
+	}
+	/* H = -sum( p * log2( p ) ) with p = count / size
+	 *   = log2( size ) - sum( count * log2( count ) ) / size
+	 */
+	safe_entropy = libvsmbr_entropy_map_log2(
+	                (uint32_t) data_size );
+
+	safe_entropy -= sum_of_counts_log2 / (double) data_size;
+
+	if( safe_entropy < 0.0 )
+	{
+		safe_entropy = 0.0;
+	}
+	*entropy = (float) safe_entropy;
+
+	return( 1 );
+}
+
+/* Calculates the entropy of a block and stores it in the entropy map
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_entropy_map_calculate_block(
+     libvsmbr_internal_entropy_map_t *internal_entropy_map,
+     libvsmbr_entropy_map_block_t *entropy_map_block,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_internal_entropy_map_calculate_block";
+
+	if( internal_entropy_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entropy map.",
+		 function );
+
+		return( -1 );
+	}
+	if( entropy_map_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entropy map block.",
+		 function );
+
+		return( -1 );
+	}
+	if( entropy_map_block->block_index >= internal_entropy_map->number_of_blocks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entropy map block - block index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_entropy_map_calculate_entropy(
+	     entropy_map_block->data,
+	     entropy_map_block->data_size,
+	     &( internal_entropy_map->entropies[ entropy_map_block->block_index ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate entropy of block: %" PRIu64 ".",
+		 function,
+		 entropy_map_block->block_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+
+/* Calculates the entropy of a block in a worker thread
+ * The worker threads store the entropies of different blocks, hence they
+ * do not need to synchronize with each other, a failed calculation
+ * is recorded in the calculate result of the entropy map
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_entropy_map_calculate_block_callback(
+     libvsmbr_entropy_map_block_t *entropy_map_block,
+     libvsmbr_internal_entropy_map_t *internal_entropy_map )
+{
+	int result = 1;
+
+	if( internal_entropy_map == NULL )
+	{
+		libvsmbr_entropy_map_block_free(
+		 &entropy_map_block,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libvsmbr_internal_entropy_map_calculate_block(
+	     internal_entropy_map,
+	     entropy_map_block,
+	     NULL ) != 1 )
+	{
+		result = -1;
+	}
+	if( libvsmbr_entropy_map_block_free(
+	     &entropy_map_block,
+	     NULL ) != 1 )
+	{
+		result = -1;
+	}
+	if( result != 1 )
+	{
+		if( libcthreads_mutex_grab(
+		     internal_entropy_map->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		internal_entropy_map->calculate_result = -1;
+
+		if( libcthreads_mutex_release(
+		     internal_entropy_map->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT ) */
+
+/* Builds the entropy map from data read with a read buffer at offset function
+ * The data is read by the calling thread and the entropies are calculated
+ * by number_of_threads worker threads if multi-threading is supported
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_entropy_map_build(
+     libvsmbr_internal_entropy_map_t *internal_entropy_map,
+     intptr_t *data_handle,
+     ssize_t (*read_buffer_at_offset)(
+              intptr_t *data_handle,
+              uint8_t *buffer,
+              size_t buffer_size,
+              off64_t offset,
+              libcerror_error_t **error ),
+     off64_t data_offset,
+     size64_t data_size,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libvsmbr_entropy_map_block_t *entropy_map_block = NULL;
+	static char *function                           = "libvsmbr_internal_entropy_map_build";
+	size_t read_size                                = 0;
+	ssize_t read_count                              = 0;
+	off64_t block_offset                            = 0;
+	uint64_t block_index                            = 0;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool          = NULL;
+#endif
+
+	if( internal_entropy_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entropy map.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_buffer_at_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read buffer at offset function.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_offset < 0 )
+	 || ( data_size > (size64_t) ( INT64_MAX - data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > LIBVSMBR_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of threads: %d.",
+		 function,
+		 number_of_threads );
+
+		return( -1 );
+	}
+	if( libvsmbr_internal_entropy_map_set_data_size(
+	     internal_entropy_map,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	internal_entropy_map->calculate_result = 1;
+
+	if( number_of_threads > 1 )
+	{
+		/* The queue holds 2 blocks per thread, which bounds the memory used
+		 * by blocks that have been read but not yet processed
+		 */
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_threads,
+		     number_of_threads * 2,
+		     (int (*)(intptr_t *, void *)) &libvsmbr_internal_entropy_map_calculate_block_callback,
+		     (void *) internal_entropy_map,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	for( block_index = 0;
+	     block_index < internal_entropy_map->number_of_blocks;
+	     block_index++ )
+	{
+		if( entropy_map_block == NULL )
+		{
+			if( libvsmbr_entropy_map_block_initialize(
+			     &entropy_map_block,
+			     internal_entropy_map->block_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create entropy map block.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		read_size = internal_entropy_map->block_size;
+
+		if( (size64_t) read_size > ( data_size - (size64_t) block_offset ) )
+		{
+			read_size = (size_t) ( data_size - (size64_t) block_offset );
+		}
+		read_count = read_buffer_at_offset(
+		              data_handle,
+		              entropy_map_block->data,
+		              read_size,
+		              data_offset + block_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 block_index,
+			 data_offset + block_offset,
+			 data_offset + block_offset );
+
+			goto on_error;
+		}
+		entropy_map_block->block_index = block_index;
+		entropy_map_block->data_size   = read_size;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+		if( thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) entropy_map_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push block: %" PRIu64 " onto thread pool queue.",
+				 function,
+				 block_index );
+
+				goto on_error;
+			}
+			/* The worker thread takes over the ownership of the block
+			 */
+			entropy_map_block = NULL;
+		}
+		else
+#endif
+		if( libvsmbr_internal_entropy_map_calculate_block(
+		     internal_entropy_map,
+		     entropy_map_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate entropy of block: %" PRIu64 ".",
+			 function,
+			 block_index );
+
+			goto on_error;
+		}
+		block_offset += read_size;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		/* The worker threads have finished, hence the calculate result
+		 * no longer changes
+		 */
+		if( internal_entropy_map->calculate_result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate entropy of one or more blocks.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( entropy_map_block != NULL )
+	{
+		if( libvsmbr_entropy_map_block_free(
+		     &entropy_map_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entropy map block.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	if( entropy_map_block != NULL )
+	{
+		libvsmbr_entropy_map_block_free(
+		 &entropy_map_block,
+		 NULL );
+	}
+	/* Do not leave a partially built map behind
+	 */
+	libvsmbr_internal_entropy_map_set_data_size(
+	 internal_entropy_map,
+	 0,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Builds the entropy map from the data of a partition
+ * Any previously calculated entropies are replaced
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_entropy_map_build_from_partition(
+     libvsmbr_entropy_map_t *entropy_map,
+     libvsmbr_partition_t *partition,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_entropy_map_t *internal_entropy_map = NULL;
+	static char *function                                 = "libvsmbr_entropy_map_build_from_partition";
+	size64_t partition_size                               = 0;
+	int result                                            = 1;
+
+	if( entropy_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entropy map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_entropy_map = (libvsmbr_internal_entropy_map_t *) entropy_map;
+
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_partition_get_size(
+	     partition,
+	     &partition_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_entropy_map->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libvsmbr_internal_entropy_map_build(
+	     internal_entropy_map,
+	     (intptr_t *) partition,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) &libvsmbr_partition_read_buffer_at_offset,
+	     0,
+	     partition_size,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to build entropy map.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_entropy_map->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Builds the entropy map from a range of the data of a file IO handle
+ * This allows to map the unpartitioned space of a volume
+ * Any previously calculated entropies are replaced
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_entropy_map_build_from_file_io_handle(
+     libvsmbr_entropy_map_t *entropy_map,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     size64_t size,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_entropy_map_t *internal_entropy_map = NULL;
+	static char *function                                 = "libvsmbr_entropy_map_build_from_file_io_handle";
+	int result                                            = 1;
+
+	if( entropy_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entropy map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_entropy_map = (libvsmbr_internal_entropy_map_t *) entropy_map;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_entropy_map->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libvsmbr_internal_entropy_map_build(
+	     internal_entropy_map,
+	     (intptr_t *) file_io_handle,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) &libbfio_handle_read_buffer_at_offset,
+	     offset,
+	     size,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to build entropy map.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_entropy_map->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the block size
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_entropy_map_get_block_size(
+     libvsmbr_entropy_map_t *entropy_map,
+     uint32_t *block_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_entropy_map_t *internal_entropy_map = NULL;
+	static char *function                                 = "libvsmbr_entropy_map_get_block_size";
+
+	if( entropy_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entropy map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_entropy_map = (libvsmbr_internal_entropy_map_t *) entropy_map;
+
+	if( block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The block size is not changed after initialization
+	 */
+	*block_size = internal_entropy_map->block_size;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the data the entropy map was built of
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_entropy_map_get_data_size(
+     libvsmbr_entropy_map_t *entropy_map,
+     size64_t *data_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_entropy_map_t *internal_entropy_map = NULL;
+	static char *function                                 = "libvsmbr_entropy_map_get_data_size";
+
+	if( entropy_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entropy map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_entropy_map = (libvsmbr_internal_entropy_map_t *) entropy_map;
+
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_entropy_map->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*data_size = internal_entropy_map->data_size;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_entropy_map->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of blocks
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_entropy_map_get_number_of_blocks(
+     libvsmbr_entropy_map_t *entropy_map,
+     uint64_t *number_of_blocks,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_entropy_map_t *internal_entropy_map = NULL;
+	static char *function                                 = "libvsmbr_entropy_map_get_number_of_blocks";
+
+	if( entropy_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entropy map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_entropy_map = (libvsmbr_internal_entropy_map_t *) entropy_map;
+
+	if( number_of_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_entropy_map->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_blocks = internal_entropy_map->number_of_blocks;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_entropy_map->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the entropy of a specific block
+ * The entropy is expressed in bits per byte, in the range 0.0 to 8.0
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_entropy_map_get_entropy(
+     libvsmbr_entropy_map_t *entropy_map,
+     uint64_t block_index,
+     float *entropy,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_entropy_map_t *internal_entropy_map = NULL;
+	static char *function                                 = "libvsmbr_entropy_map_get_entropy";
+	int result                                            = 1;
+
+	if( entropy_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entropy map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_entropy_map = (libvsmbr_internal_entropy_map_t *) entropy_map;
+
+	if( entropy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entropy.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_entropy_map->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( block_index >= internal_entropy_map->number_of_blocks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block index value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		*entropy = internal_entropy_map->entropies[ block_index ];
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_entropy_map->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the entropies of all blocks
+ * The number of entropies must be equal or greater than the number of blocks
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_entropy_map_get_entropies(
+     libvsmbr_entropy_map_t *entropy_map,
+     float *entropies,
+     uint64_t number_of_entropies,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_entropy_map_t *internal_entropy_map = NULL;
+	static char *function                                 = "libvsmbr_entropy_map_get_entropies";
+	int result                                            = 1;
+
+	if( entropy_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entropy map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_entropy_map = (libvsmbr_internal_entropy_map_t *) entropy_map;
+
+	if( entropies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entropies.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_entropy_map->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( number_of_entropies < internal_entropy_map->number_of_blocks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of entropies value too small.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_entropy_map->number_of_blocks > 0 )
+	{
+		if( memory_copy(
+		     entropies,
+		     internal_entropy_map->entropies,
+		     (size_t) internal_entropy_map->number_of_blocks * sizeof( float ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy entropies.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_entropy_map->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,201 @@
+/*
+ * Entropy map functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSMBR_ENTROPY_MAP_H )
+#define _LIBVSMBR_ENTROPY_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsmbr_extern.h"
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_libcthreads.h"
+#include "libvsmbr_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsmbr_internal_entropy_map libvsmbr_internal_entropy_map_t;
+
+struct libvsmbr_internal_entropy_map
+{
+	/* The block size
+	 */
+	uint32_t block_size;
+
+	/* The data size
+	 */
+	size64_t data_size;
+
+	/* The number of blocks
+	 */
+	uint64_t number_of_blocks;
+
+	/* The entropies
+	 */
+	float *entropies;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The result of the entropy calculations of the worker threads
+	 */
+	int calculate_result;
+
+	/* The mutex that protects the calculate result
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+typedef struct libvsmbr_entropy_map_block libvsmbr_entropy_map_block_t;
+
+struct libvsmbr_entropy_map_block
+{
+	/* The block index
+	 */
+	uint64_t block_index;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+LIBVSMBR_EXTERN \
+int libvsmbr_entropy_map_initialize(
+     libvsmbr_entropy_map_t **entropy_map,
+     uint32_t block_size,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_entropy_map_free(
+     libvsmbr_entropy_map_t **entropy_map,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_entropy_map_set_data_size(
+     libvsmbr_internal_entropy_map_t *internal_entropy_map,
+     size64_t data_size,
+     libcerror_error_t **error );
+
+int libvsmbr_entropy_map_block_initialize(
+     libvsmbr_entropy_map_block_t **entropy_map_block,
+     uint32_t block_size,
+     libcerror_error_t **error );
+
+int libvsmbr_entropy_map_block_free(
+     libvsmbr_entropy_map_block_t **entropy_map_block,
+     libcerror_error_t **error );
+
+int libvsmbr_entropy_map_calculate_entropy(
+     const uint8_t *data,
+     size_t data_size,
+     float *entropy,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_entropy_map_calculate_block(
+     libvsmbr_internal_entropy_map_t *internal_entropy_map,
+     libvsmbr_entropy_map_block_t *entropy_map_block,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+
+int libvsmbr_internal_entropy_map_calculate_block_callback(
+     libvsmbr_entropy_map_block_t *entropy_map_block,
+     libvsmbr_internal_entropy_map_t *internal_entropy_map );
+
+#endif /* defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT ) */
+
+int libvsmbr_internal_entropy_map_build(
+     libvsmbr_internal_entropy_map_t *internal_entropy_map,
+     intptr_t *data_handle,
+     ssize_t (*read_buffer_at_offset)(
+              intptr_t *data_handle,
+              uint8_t *buffer,
+              size_t buffer_size,
+              off64_t offset,
+              libcerror_error_t **error ),
+     off64_t data_offset,
+     size64_t data_size,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_entropy_map_build_from_partition(
+     libvsmbr_entropy_map_t *entropy_map,
+     libvsmbr_partition_t *partition,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_entropy_map_build_from_file_io_handle(
+     libvsmbr_entropy_map_t *entropy_map,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     size64_t size,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_entropy_map_get_block_size(
+     libvsmbr_entropy_map_t *entropy_map,
+     uint32_t *block_size,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_entropy_map_get_data_size(
+     libvsmbr_entropy_map_t *entropy_map,
+     size64_t *data_size,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_entropy_map_get_number_of_blocks(
+     libvsmbr_entropy_map_t *entropy_map,
+     uint64_t *number_of_blocks,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_entropy_map_get_entropy(
+     libvsmbr_entropy_map_t *entropy_map,
+     uint64_t block_index,
+     float *entropy,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_entropy_map_get_entropies(
+     libvsmbr_entropy_map_t *entropy_map,
+     float *entropies,
+     uint64_t number_of_entropies,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSMBR_ENTROPY_MAP_H ) */
+
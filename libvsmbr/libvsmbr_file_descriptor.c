@@ -0,0 +1,839 @@
+/*
+ * File descriptor functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* copy_file_range, fallocate, SEEK_DATA and SEEK_HOLE are GNU extensions
+ */
+#if defined( __linux__ ) && !defined( _GNU_SOURCE )
+#define _GNU_SOURCE
+#endif
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_SENDFILE_H )
+#include <sys/sendfile.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libvsmbr_file_descriptor.h"
+#include "libvsmbr_libcerror.h"
+
+#if !defined( WINAPI ) || defined( __CYGWIN__ )
+
+/* The maximum number of bytes copied by a single kernel-side copy
+ */
+#define LIBVSMBR_FILE_DESCRIPTOR_MAXIMUM_COPY_SIZE	( 1024 * 1024 * 1024 )
+
+/* Opens a file for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_file_descriptor_open_read(
+     int *file_descriptor,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_file_descriptor_open_read";
+	int flags             = O_RDONLY;
+
+	if( file_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( O_CLOEXEC )
+	flags |= O_CLOEXEC;
+#endif
+	*file_descriptor = open(
+	                    filename,
+	                    flags );
+
+	if( *file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes a file
+ * Returns 0 if successful or -1 on error
+ */
+int libvsmbr_file_descriptor_close(
+     int *file_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_file_descriptor_close";
+
+	if( file_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	if( close(
+	     *file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file.",
+		 function );
+
+		*file_descriptor = -1;
+
+		return( -1 );
+	}
+	*file_descriptor = -1;
+
+	return( 0 );
+}
+
+/* Determines if a file descriptor refers to a regular file
+ * Returns 1 if a regular file, 0 if not or -1 on error
+ */
+int libvsmbr_file_descriptor_is_regular_file(
+     int file_descriptor,
+     libcerror_error_t **error )
+{
+	struct stat file_statistics;
+
+	static char *function = "libvsmbr_file_descriptor_is_regular_file";
+
+	if( file_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( S_ISREG( file_statistics.st_mode ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Writes a buffer at a specific offset
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_file_descriptor_write_buffer_at_offset(
+     int file_descriptor,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_file_descriptor_write_buffer_at_offset";
+	size_t buffer_offset  = 0;
+	ssize_t write_count   = 0;
+
+	if( file_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_PWRITE )
+	if( lseek(
+	     file_descriptor,
+	     (off_t) offset,
+	     SEEK_SET ) == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 errno,
+		 "%s: unable to seek offset: %" PRIi64 ".",
+		 function,
+		 offset );
+
+		return( -1 );
+	}
+#endif
+	while( buffer_offset < buffer_size )
+	{
+#if defined( HAVE_PWRITE )
+		write_count = pwrite(
+		               file_descriptor,
+		               &( buffer[ buffer_offset ] ),
+		               buffer_size - buffer_offset,
+		               (off_t) ( offset + buffer_offset ) );
+#else
+		write_count = write(
+		               file_descriptor,
+		               &( buffer[ buffer_offset ] ),
+		               buffer_size - buffer_offset );
+#endif
+		if( write_count == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 errno,
+			 "%s: unable to write buffer at offset: %" PRIi64 ".",
+			 function,
+			 offset + buffer_offset );
+
+			return( -1 );
+		}
+		if( write_count == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write buffer at offset: %" PRIi64 ".",
+			 function,
+			 offset + buffer_offset );
+
+			return( -1 );
+		}
+		buffer_offset += (size_t) write_count;
+	}
+	return( 1 );
+}
+
+/* Deallocates a range of a file, leaving a hole that reads back as zero bytes
+ * The size of the file is not changed
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libvsmbr_file_descriptor_punch_hole(
+     int file_descriptor,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_file_descriptor_punch_hole";
+
+	if( file_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_FALLOCATE ) && defined( FALLOC_FL_PUNCH_HOLE ) && defined( FALLOC_FL_KEEP_SIZE )
+	if( fallocate(
+	     file_descriptor,
+	     FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+	     (off_t) offset,
+	     (off_t) size ) == 0 )
+	{
+		return( 1 );
+	}
+	if( ( errno == EOPNOTSUPP )
+	 || ( errno == ENOSYS ) )
+	{
+		return( 0 );
+	}
+	libcerror_system_set_error(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 errno,
+	 "%s: unable to punch hole at offset: %" PRIi64 " of size: %" PRIu64 ".",
+	 function,
+	 offset,
+	 size );
+
+	return( -1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Retrieves the first range that contains data within a range of a file
+ * Ranges that do not contain data are holes that read back as zero bytes
+ * If the file system does not report holes the entire range is considered data
+ * Returns 1 if successful, 0 if the range contains no data or -1 on error
+ */
+int libvsmbr_file_descriptor_get_data_range(
+     int file_descriptor,
+     off64_t offset,
+     size64_t size,
+     off64_t *data_offset,
+     size64_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "libvsmbr_file_descriptor_get_data_range";
+	off64_t end_offset      = 0;
+	off64_t safe_end_offset = 0;
+	off64_t safe_offset     = 0;
+
+	if( file_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) ( INT64_MAX - offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	end_offset      = offset + (off64_t) size;
+	safe_offset     = offset;
+	safe_end_offset = end_offset;
+
+	if( size == 0 )
+	{
+		return( 0 );
+	}
+#if defined( SEEK_DATA ) && defined( SEEK_HOLE )
+	safe_offset = (off64_t) lseek(
+	                         file_descriptor,
+	                         (off_t) offset,
+	                         SEEK_DATA );
+
+	if( safe_offset == -1 )
+	{
+		if( errno == ENXIO )
+		{
+			/* There is no data after offset
+			 */
+			return( 0 );
+		}
+		if( errno != EINVAL )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 errno,
+			 "%s: unable to seek data from offset: %" PRIi64 ".",
+			 function,
+			 offset );
+
+			return( -1 );
+		}
+		/* The file system does not support seeking data and holes
+		 */
+		safe_offset = offset;
+	}
+	else if( safe_offset >= end_offset )
+	{
+		return( 0 );
+	}
+	else
+	{
+		safe_end_offset = (off64_t) lseek(
+		                             file_descriptor,
+		                             (off_t) safe_offset,
+		                             SEEK_HOLE );
+
+		if( safe_end_offset == -1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 errno,
+			 "%s: unable to seek hole from offset: %" PRIi64 ".",
+			 function,
+			 safe_offset );
+
+			return( -1 );
+		}
+		if( safe_end_offset > end_offset )
+		{
+			safe_end_offset = end_offset;
+		}
+	}
+#endif /* defined( SEEK_DATA ) && defined( SEEK_HOLE ) */
+
+	*data_offset = safe_offset;
+	*data_size   = (size64_t) ( safe_end_offset - safe_offset );
+
+	return( 1 );
+}
+
+/* Copies a range of one file into another without passing the data through user space
+ * A kernel-side copy is only considered unsupported if no data was copied yet
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libvsmbr_file_descriptor_copy_range(
+     int source_file_descriptor,
+     off64_t source_offset,
+     int destination_file_descriptor,
+     off64_t destination_offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libvsmbr_file_descriptor_copy_range";
+	size64_t copied_size      = 0;
+	ssize_t copy_count        = 0;
+	size_t copy_size          = 0;
+	int use_copy_file_range   = 0;
+	int use_sendfile          = 0;
+
+#if defined( HAVE_COPY_FILE_RANGE )
+	loff_t copy_destination_offset = 0;
+	loff_t copy_source_offset      = 0;
+#endif
+#if defined( HAVE_SENDFILE )
+	off_t sendfile_source_offset   = 0;
+#endif
+
+	if( source_file_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid source offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( destination_file_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( destination_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid destination offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_COPY_FILE_RANGE )
+	use_copy_file_range = 1;
+#endif
+#if defined( HAVE_SENDFILE )
+	use_sendfile = 1;
+#endif
+	while( copied_size < size )
+	{
+		if( ( use_copy_file_range == 0 )
+		 && ( use_sendfile == 0 ) )
+		{
+			return( 0 );
+		}
+		copy_size = LIBVSMBR_FILE_DESCRIPTOR_MAXIMUM_COPY_SIZE;
+
+		if( copy_size > ( size - copied_size ) )
+		{
+			copy_size = (size_t) ( size - copied_size );
+		}
+#if defined( HAVE_COPY_FILE_RANGE )
+		if( use_copy_file_range != 0 )
+		{
+			copy_source_offset      = (loff_t) ( source_offset + copied_size );
+			copy_destination_offset = (loff_t) ( destination_offset + copied_size );
+
+			copy_count = copy_file_range(
+			              source_file_descriptor,
+			              &copy_source_offset,
+			              destination_file_descriptor,
+			              &copy_destination_offset,
+			              copy_size,
+			              0 );
+
+			if( copy_count == -1 )
+			{
+				if( errno == EINTR )
+				{
+					continue;
+				}
+				/* Older kernels do not support copying across file systems
+				 */
+				if( ( copied_size == 0 )
+				 && ( ( errno == ENOSYS )
+				  ||  ( errno == EXDEV )
+				  ||  ( errno == EINVAL )
+				  ||  ( errno == EOPNOTSUPP ) ) )
+				{
+					use_copy_file_range = 0;
+
+					continue;
+				}
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 errno,
+				 "%s: unable to copy range at offset: %" PRIi64 ".",
+				 function,
+				 source_offset + copied_size );
+
+				return( -1 );
+			}
+		}
+		else
+#endif /* defined( HAVE_COPY_FILE_RANGE ) */
+		{
+#if defined( HAVE_SENDFILE )
+			/* sendfile writes at the current offset of the destination
+			 */
+			if( lseek(
+			     destination_file_descriptor,
+			     (off_t) ( destination_offset + copied_size ),
+			     SEEK_SET ) == -1 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 errno,
+				 "%s: unable to seek destination offset: %" PRIi64 ".",
+				 function,
+				 destination_offset + copied_size );
+
+				return( -1 );
+			}
+			sendfile_source_offset = (off_t) ( source_offset + copied_size );
+
+			copy_count = sendfile(
+			              destination_file_descriptor,
+			              source_file_descriptor,
+			              &sendfile_source_offset,
+			              copy_size );
+
+			if( copy_count == -1 )
+			{
+				if( errno == EINTR )
+				{
+					continue;
+				}
+				if( ( copied_size == 0 )
+				 && ( ( errno == ENOSYS )
+				  ||  ( errno == EINVAL ) ) )
+				{
+					use_sendfile = 0;
+
+					continue;
+				}
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 errno,
+				 "%s: unable to send range at offset: %" PRIi64 ".",
+				 function,
+				 source_offset + copied_size );
+
+				return( -1 );
+			}
+#else
+			use_sendfile = 0;
+
+			continue;
+#endif /* defined( HAVE_SENDFILE ) */
+		}
+		if( copy_count == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unexpected end of source at offset: %" PRIi64 ".",
+			 function,
+			 source_offset + copied_size );
+
+			return( -1 );
+		}
+		copied_size += (size64_t) copy_count;
+	}
+	return( 1 );
+}
+
+/* Extends the size of a regular file if it is smaller than the size
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_file_descriptor_extend_size(
+     int file_descriptor,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	struct stat file_statistics;
+
+	static char *function = "libvsmbr_file_descriptor_extend_size";
+
+	if( file_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( !S_ISREG( file_statistics.st_mode )
+	 || ( (size64_t) file_statistics.st_size >= size ) )
+	{
+		return( 1 );
+	}
+	if( ftruncate(
+	     file_descriptor,
+	     (off_t) size ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 errno,
+		 "%s: unable to resize file to: %" PRIu64 ".",
+		 function,
+		 size );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* !defined( WINAPI ) || defined( __CYGWIN__ ) */
+
@@ -0,0 +1,90 @@
+/*
+ * File descriptor functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSMBR_FILE_DESCRIPTOR_H )
+#define _LIBVSMBR_FILE_DESCRIPTOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsmbr_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( WINAPI ) || defined( __CYGWIN__ )
+
+int libvsmbr_file_descriptor_open_read(
+     int *file_descriptor,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libvsmbr_file_descriptor_close(
+     int *file_descriptor,
+     libcerror_error_t **error );
+
+int libvsmbr_file_descriptor_is_regular_file(
+     int file_descriptor,
+     libcerror_error_t **error );
+
+int libvsmbr_file_descriptor_write_buffer_at_offset(
+     int file_descriptor,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int libvsmbr_file_descriptor_punch_hole(
+     int file_descriptor,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libvsmbr_file_descriptor_get_data_range(
+     int file_descriptor,
+     off64_t offset,
+     size64_t size,
+     off64_t *data_offset,
+     size64_t *data_size,
+     libcerror_error_t **error );
+
+int libvsmbr_file_descriptor_copy_range(
+     int source_file_descriptor,
+     off64_t source_offset,
+     int destination_file_descriptor,
+     off64_t destination_offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libvsmbr_file_descriptor_extend_size(
+     int file_descriptor,
+     size64_t size,
+     libcerror_error_t **error );
+
+#endif /* !defined( WINAPI ) || defined( __CYGWIN__ ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSMBR_FILE_DESCRIPTOR_H ) */
+
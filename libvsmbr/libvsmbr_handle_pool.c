@@ -0,0 +1,2034 @@
+/*
+ * Handle pool functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsmbr_handle_pool.h"
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_libcthreads.h"
+#include "libvsmbr_pooled_io_handle.h"
+#include "libvsmbr_types.h"
+
+/* Creates a handle pool
+ * A maximum number of open handles of 0 represents no limit
+ * Make sure the value handle_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_handle_pool_initialize(
+     libvsmbr_handle_pool_t **handle_pool,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_handle_pool_t *internal_handle_pool = NULL;
+	static char *function                                 = "libvsmbr_handle_pool_initialize";
+
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_open_handles < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of open handles value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle_pool = memory_allocate_structure(
+	                        libvsmbr_internal_handle_pool_t );
+
+	if( internal_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create handle pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_handle_pool,
+	     0,
+	     sizeof( libvsmbr_internal_handle_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear handle pool.",
+		 function );
+
+		memory_free(
+		 internal_handle_pool );
+
+		return( -1 );
+	}
+	/* The file IO pool does not limit the number of open handles
+	 * since the handle pool opens and closes the handles itself
+	 */
+	if( libbfio_pool_initialize(
+	     &( internal_handle_pool->file_io_pool ),
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO pool.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_handle_pool->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_handle_pool->maximum_number_of_open_handles = maximum_number_of_open_handles;
+
+	*handle_pool = (libvsmbr_handle_pool_t *) internal_handle_pool;
+
+	return( 1 );
+
+on_error:
+	if( internal_handle_pool != NULL )
+	{
+		if( internal_handle_pool->file_io_pool != NULL )
+		{
+			libbfio_pool_free(
+			 &( internal_handle_pool->file_io_pool ),
+			 NULL );
+		}
+		memory_free(
+		 internal_handle_pool );
+	}
+	return( -1 );
+}
+
+/* Frees a handle pool
+ * The volumes opened through the handle pool must be closed before it is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_handle_pool_free(
+     libvsmbr_handle_pool_t **handle_pool,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_handle_pool_t *internal_handle_pool = NULL;
+	static char *function                                 = "libvsmbr_handle_pool_free";
+	int result                                            = 1;
+
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle_pool != NULL )
+	{
+		internal_handle_pool = (libvsmbr_internal_handle_pool_t *) *handle_pool;
+
+		if( internal_handle_pool->number_of_registered_handles != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid handle pool - handles still registered.",
+			 function );
+
+			return( -1 );
+		}
+		*handle_pool = NULL;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_handle_pool->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( libbfio_pool_free(
+		     &( internal_handle_pool->file_io_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO pool.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_handle_pool->entries != NULL )
+		{
+			memory_free(
+			 internal_handle_pool->entries );
+		}
+		if( internal_handle_pool->free_entries != NULL )
+		{
+			memory_free(
+			 internal_handle_pool->free_entries );
+		}
+		memory_free(
+		 internal_handle_pool );
+	}
+	return( result );
+}
+
+/* Retrieves the maximum number of open handles
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_handle_pool_get_maximum_number_of_open_handles(
+     libvsmbr_handle_pool_t *handle_pool,
+     int *maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_handle_pool_t *internal_handle_pool = NULL;
+	static char *function                                 = "libvsmbr_handle_pool_get_maximum_number_of_open_handles";
+
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle_pool = (libvsmbr_internal_handle_pool_t *) handle_pool;
+
+	if( maximum_number_of_open_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of open handles.",
+		 function );
+
+		return( -1 );
+	}
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*maximum_number_of_open_handles = internal_handle_pool->maximum_number_of_open_handles;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum number of open handles
+ * A maximum number of open handles of 0 represents no limit
+ * Files that are not in use are closed until the maximum is no longer exceeded
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_handle_pool_set_maximum_number_of_open_handles(
+     libvsmbr_handle_pool_t *handle_pool,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_handle_pool_t *internal_handle_pool = NULL;
+	static char *function                                 = "libvsmbr_handle_pool_set_maximum_number_of_open_handles";
+	int result                                            = 1;
+
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle_pool = (libvsmbr_internal_handle_pool_t *) handle_pool;
+
+	if( maximum_number_of_open_handles < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of open handles value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_handle_pool->maximum_number_of_open_handles = maximum_number_of_open_handles;
+
+	while( ( maximum_number_of_open_handles > 0 )
+	    && ( internal_handle_pool->number_of_open_handles > maximum_number_of_open_handles ) )
+	{
+		result = libvsmbr_internal_handle_pool_close_least_recently_used(
+		          internal_handle_pool,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close least recently used file IO handle.",
+			 function );
+
+			break;
+		}
+		else if( result == 0 )
+		{
+			/* The remaining files are closed when they are no longer in use
+			 */
+			result = 1;
+
+			break;
+		}
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of registered handles
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_handle_pool_get_number_of_handles(
+     libvsmbr_handle_pool_t *handle_pool,
+     int *number_of_handles,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_handle_pool_t *internal_handle_pool = NULL;
+	static char *function                                 = "libvsmbr_handle_pool_get_number_of_handles";
+
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle_pool = (libvsmbr_internal_handle_pool_t *) handle_pool;
+
+	if( number_of_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of handles.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_handles = internal_handle_pool->number_of_registered_handles;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Appends an entry to the free entries of the handle pool
+ * The caller must hold the read/write lock for writing
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_handle_pool_append_free_entry(
+     libvsmbr_internal_handle_pool_t *internal_handle_pool,
+     int entry,
+     libcerror_error_t **error )
+{
+	static char *function                = "libvsmbr_internal_handle_pool_append_free_entry";
+	void *reallocation                   = NULL;
+	int number_of_allocated_free_entries = 0;
+
+	if( internal_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle_pool->number_of_free_entries == internal_handle_pool->number_of_allocated_free_entries )
+	{
+		number_of_allocated_free_entries = internal_handle_pool->number_of_allocated_free_entries + 16;
+
+		reallocation = memory_reallocate(
+		                internal_handle_pool->free_entries,
+		                sizeof( int ) * number_of_allocated_free_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize free entries.",
+			 function );
+
+			return( -1 );
+		}
+		internal_handle_pool->free_entries                     = (int *) reallocation;
+		internal_handle_pool->number_of_allocated_free_entries = number_of_allocated_free_entries;
+	}
+	internal_handle_pool->free_entries[ internal_handle_pool->number_of_free_entries ] = entry;
+
+	internal_handle_pool->number_of_free_entries += 1;
+
+	return( 1 );
+}
+
+/* Closes the least recently used file IO handle that is open and not in use
+ * The caller must hold the read/write lock for writing
+ * Returns 1 if successful, 0 if every open file IO handle is in use or -1 on error
+ */
+int libvsmbr_internal_handle_pool_close_least_recently_used(
+     libvsmbr_internal_handle_pool_t *internal_handle_pool,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libvsmbr_internal_handle_pool_close_least_recently_used";
+	uint64_t last_used               = 0;
+	int entry                        = 0;
+	int least_recently_used_entry    = -1;
+
+	if( internal_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry = 0;
+	     entry < internal_handle_pool->number_of_allocated_entries;
+	     entry++ )
+	{
+		if( ( internal_handle_pool->entries[ entry ].is_open == 0 )
+		 || ( internal_handle_pool->entries[ entry ].number_of_users > 0 ) )
+		{
+			continue;
+		}
+		if( ( least_recently_used_entry == -1 )
+		 || ( internal_handle_pool->entries[ entry ].last_used < last_used ) )
+		{
+			least_recently_used_entry = entry;
+			last_used                 = internal_handle_pool->entries[ entry ].last_used;
+		}
+	}
+	if( least_recently_used_entry == -1 )
+	{
+		return( 0 );
+	}
+	if( libbfio_pool_get_handle(
+	     internal_handle_pool->file_io_pool,
+	     least_recently_used_entry,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle: %d from file IO pool.",
+		 function,
+		 least_recently_used_entry );
+
+		return( -1 );
+	}
+	internal_handle_pool->entries[ least_recently_used_entry ].is_open = 0;
+
+	internal_handle_pool->number_of_open_handles -= 1;
+
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle: %d.",
+		 function,
+		 least_recently_used_entry );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Grabs an entry of the handle pool for a read or write
+ * The file is reopened if it was closed to make room for another file, if every
+ * other open file is in use the maximum number of open handles is exceeded
+ * until one of them is released
+ * The file IO handle is not closed until the entry is released
+ * The caller must hold the read/write lock for writing
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_handle_pool_grab_entry(
+     libvsmbr_internal_handle_pool_t *internal_handle_pool,
+     int entry,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *safe_file_io_handle = NULL;
+	static char *function                 = "libvsmbr_internal_handle_pool_grab_entry";
+	int access_flags                      = 0;
+	int result                            = 0;
+
+	if( internal_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry < 0 )
+	 || ( entry >= internal_handle_pool->number_of_allocated_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_pool_get_handle(
+	     internal_handle_pool->file_io_pool,
+	     entry,
+	     &safe_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle: %d from file IO pool.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	if( safe_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing file IO handle: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	if( internal_handle_pool->entries[ entry ].is_open == 0 )
+	{
+		while( ( internal_handle_pool->maximum_number_of_open_handles > 0 )
+		    && ( internal_handle_pool->number_of_open_handles >= internal_handle_pool->maximum_number_of_open_handles ) )
+		{
+			result = libvsmbr_internal_handle_pool_close_least_recently_used(
+			          internal_handle_pool,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close least recently used file IO handle.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
+		access_flags = internal_handle_pool->entries[ entry ].access_flags;
+
+		if( access_flags == 0 )
+		{
+			access_flags = LIBBFIO_OPEN_READ;
+		}
+		if( libbfio_handle_open(
+		     safe_file_io_handle,
+		     access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle: %d.",
+			 function,
+			 entry );
+
+			return( -1 );
+		}
+		internal_handle_pool->entries[ entry ].is_open = 1;
+
+		internal_handle_pool->number_of_open_handles += 1;
+	}
+	internal_handle_pool->use_counter += 1;
+
+	internal_handle_pool->entries[ entry ].number_of_users += 1;
+	internal_handle_pool->entries[ entry ].last_used        = internal_handle_pool->use_counter;
+
+	*file_io_handle = safe_file_io_handle;
+
+	return( 1 );
+}
+
+/* Releases an entry of the handle pool that was grabbed for a read or write
+ * Files are closed when the maximum number of open handles was exceeded
+ * while they were in use
+ * The caller must hold the read/write lock for writing
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_handle_pool_release_entry(
+     libvsmbr_internal_handle_pool_t *internal_handle_pool,
+     int entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_internal_handle_pool_release_entry";
+	int result            = 1;
+
+	if( internal_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry < 0 )
+	 || ( entry >= internal_handle_pool->number_of_allocated_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle_pool->entries[ entry ].number_of_users <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry: %d - not in use.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	internal_handle_pool->entries[ entry ].number_of_users -= 1;
+
+	while( ( internal_handle_pool->maximum_number_of_open_handles > 0 )
+	    && ( internal_handle_pool->number_of_open_handles > internal_handle_pool->maximum_number_of_open_handles ) )
+	{
+		result = libvsmbr_internal_handle_pool_close_least_recently_used(
+		          internal_handle_pool,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close least recently used file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+	}
+	return( 1 );
+}
+
+/* Registers a file IO handle in the handle pool
+ * The file IO handle is not opened until the pooled IO handle is opened
+ * On success the handle pool takes over management of the file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_handle_pool_register_handle(
+     libvsmbr_internal_handle_pool_t *internal_handle_pool,
+     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t **pooled_io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *removed_file_io_handle = NULL;
+	static char *function                    = "libvsmbr_internal_handle_pool_register_handle";
+	void *reallocation                       = NULL;
+	int entry                                = -1;
+	int number_of_allocated_entries          = 0;
+	int number_of_entries                    = 0;
+	int result                               = 1;
+
+	if( internal_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pooled_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pooled IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_handle_pool->number_of_free_entries > 0 )
+	{
+		entry = internal_handle_pool->free_entries[ internal_handle_pool->number_of_free_entries - 1 ];
+
+		if( libbfio_pool_set_handle(
+		     internal_handle_pool->file_io_pool,
+		     entry,
+		     file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set file IO handle: %d in file IO pool.",
+			 function,
+			 entry );
+
+			result = -1;
+		}
+		else
+		{
+			internal_handle_pool->number_of_free_entries -= 1;
+		}
+	}
+	else if( libbfio_pool_get_number_of_handles(
+	          internal_handle_pool->file_io_pool,
+	          &number_of_entries,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles from file IO pool.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		if( number_of_entries >= internal_handle_pool->number_of_allocated_entries )
+		{
+			number_of_allocated_entries = number_of_entries + 16;
+
+			reallocation = memory_reallocate(
+			                internal_handle_pool->entries,
+			                sizeof( libvsmbr_handle_pool_entry_t ) * number_of_allocated_entries );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize entries.",
+				 function );
+
+				result = -1;
+			}
+			else
+			{
+				internal_handle_pool->entries = (libvsmbr_handle_pool_entry_t *) reallocation;
+
+				/* Clear the new entries so that they are not considered open
+				 */
+				if( memory_set(
+				     &( internal_handle_pool->entries[ internal_handle_pool->number_of_allocated_entries ] ),
+				     0,
+				     sizeof( libvsmbr_handle_pool_entry_t ) * ( number_of_allocated_entries - internal_handle_pool->number_of_allocated_entries ) ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to clear entries.",
+					 function );
+
+					result = -1;
+				}
+				internal_handle_pool->number_of_allocated_entries = number_of_allocated_entries;
+			}
+		}
+		if( result == 1 )
+		{
+			if( libbfio_pool_append_handle(
+			     internal_handle_pool->file_io_pool,
+			     &entry,
+			     file_io_handle,
+			     LIBBFIO_OPEN_READ,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append file IO handle to file IO pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		internal_handle_pool->entries[ entry ].access_flags    = 0;
+		internal_handle_pool->entries[ entry ].is_open         = 0;
+		internal_handle_pool->entries[ entry ].number_of_users = 0;
+		internal_handle_pool->entries[ entry ].last_used       = 0;
+
+		internal_handle_pool->number_of_registered_handles += 1;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	if( libvsmbr_pooled_initialize(
+	     pooled_io_handle,
+	     (libvsmbr_handle_pool_t *) internal_handle_pool,
+	     entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create pooled IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	/* Hand the file IO handle back to the caller
+	 */
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle_pool->read_write_lock,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+#endif
+	if( libbfio_pool_remove_handle(
+	     internal_handle_pool->file_io_pool,
+	     entry,
+	     &removed_file_io_handle,
+	     NULL ) == 1 )
+	{
+		internal_handle_pool->number_of_registered_handles -= 1;
+
+		/* Return the entry to the free entries so that it is reused
+		 * by the next registration
+		 */
+		libvsmbr_internal_handle_pool_append_free_entry(
+		 internal_handle_pool,
+		 entry,
+		 NULL );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_handle_pool->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Registers a file in the handle pool
+ * The file is not opened until the pooled IO handle is opened
+ * Make sure the value pooled_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_handle_pool_register_file(
+     libvsmbr_handle_pool_t *handle_pool,
+     const char *filename,
+     size_t filename_length,
+     libbfio_handle_t **pooled_io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libvsmbr_handle_pool_register_file";
+
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_internal_handle_pool_register_handle(
+	     (libvsmbr_internal_handle_pool_t *) handle_pool,
+	     file_io_handle,
+	     pooled_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to register file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Registers a file in the handle pool
+ * The file is not opened until the pooled IO handle is opened
+ * Make sure the value pooled_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_handle_pool_register_file_wide(
+     libvsmbr_handle_pool_t *handle_pool,
+     const wchar_t *filename,
+     size_t filename_length,
+     libbfio_handle_t **pooled_io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libvsmbr_handle_pool_register_file_wide";
+
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_internal_handle_pool_register_handle(
+	     (libvsmbr_internal_handle_pool_t *) handle_pool,
+	     file_io_handle,
+	     pooled_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to register file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Unregisters an entry from the handle pool
+ * The file IO handle of the entry is closed and freed
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_handle_pool_unregister_entry(
+     libvsmbr_handle_pool_t *handle_pool,
+     int entry,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle                      = NULL;
+	libvsmbr_internal_handle_pool_t *internal_handle_pool = NULL;
+	static char *function                                 = "libvsmbr_handle_pool_unregister_entry";
+	int result                                            = 1;
+
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle_pool = (libvsmbr_internal_handle_pool_t *) handle_pool;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( entry < 0 )
+	 || ( entry >= internal_handle_pool->number_of_allocated_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else if( libvsmbr_internal_handle_pool_append_free_entry(
+	          internal_handle_pool,
+	          entry,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append entry: %d to free entries.",
+		 function,
+		 entry );
+
+		result = -1;
+	}
+	else if( libbfio_pool_remove_handle(
+	          internal_handle_pool->file_io_pool,
+	          entry,
+	          &file_io_handle,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove file IO handle: %d from file IO pool.",
+		 function,
+		 entry );
+
+		internal_handle_pool->number_of_free_entries -= 1;
+
+		result = -1;
+	}
+	else
+	{
+		if( internal_handle_pool->entries[ entry ].is_open != 0 )
+		{
+			internal_handle_pool->number_of_open_handles -= 1;
+		}
+		internal_handle_pool->entries[ entry ].access_flags    = 0;
+		internal_handle_pool->entries[ entry ].is_open         = 0;
+		internal_handle_pool->entries[ entry ].number_of_users = 0;
+		internal_handle_pool->entries[ entry ].last_used       = 0;
+
+		internal_handle_pool->number_of_registered_handles -= 1;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( file_io_handle != NULL )
+	{
+		if( libbfio_handle_is_open(
+		     file_io_handle,
+		     NULL ) == 1 )
+		{
+			if( libbfio_handle_close(
+			     file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libbfio_handle_free(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Opens an entry of the handle pool
+ * The least recently used file that is not in use is closed when the maximum
+ * number of open handles is reached
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_handle_pool_open_entry(
+     libvsmbr_handle_pool_t *handle_pool,
+     int entry,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle                      = NULL;
+	libvsmbr_internal_handle_pool_t *internal_handle_pool = NULL;
+	static char *function                                 = "libvsmbr_handle_pool_open_entry";
+	int result                                            = 1;
+
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle_pool = (libvsmbr_internal_handle_pool_t *) handle_pool;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( entry < 0 )
+	 || ( entry >= internal_handle_pool->number_of_allocated_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		/* The access flags are retained to reopen the file on demand
+		 */
+		internal_handle_pool->entries[ entry ].access_flags = access_flags;
+
+		if( libvsmbr_internal_handle_pool_grab_entry(
+		     internal_handle_pool,
+		     entry,
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle: %d.",
+			 function,
+			 entry );
+
+			result = -1;
+		}
+		else if( libvsmbr_internal_handle_pool_release_entry(
+		          internal_handle_pool,
+		          entry,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release entry: %d.",
+			 function,
+			 entry );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Closes an entry of the handle pool
+ * Returns 0 if successful or -1 on error
+ */
+int libvsmbr_handle_pool_close_entry(
+     libvsmbr_handle_pool_t *handle_pool,
+     int entry,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle                      = NULL;
+	libvsmbr_internal_handle_pool_t *internal_handle_pool = NULL;
+	static char *function                                 = "libvsmbr_handle_pool_close_entry";
+	int result                                            = 0;
+
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle_pool = (libvsmbr_internal_handle_pool_t *) handle_pool;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( entry < 0 )
+	 || ( entry >= internal_handle_pool->number_of_allocated_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_handle_pool->entries[ entry ].number_of_users > 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid entry: %d - still in use.",
+		 function,
+		 entry );
+
+		result = -1;
+	}
+	/* The file can already have been closed to make room for another file
+	 */
+	else if( internal_handle_pool->entries[ entry ].is_open != 0 )
+	{
+		if( libbfio_pool_get_handle(
+		     internal_handle_pool->file_io_pool,
+		     entry,
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file IO handle: %d from file IO pool.",
+			 function,
+			 entry );
+
+			result = -1;
+		}
+		else
+		{
+			internal_handle_pool->entries[ entry ].is_open = 0;
+
+			internal_handle_pool->number_of_open_handles -= 1;
+
+			if( libbfio_handle_close(
+			     file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle: %d.",
+				 function,
+				 entry );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file IO handle of an entry of the handle pool for a read or write
+ * The lock of the handle pool is only held while the entry is grabbed, the read
+ * or write itself uses the file IO handle of the entry, so that reads and writes
+ * of different entries do not wait on each other
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_handle_pool_get_entry_file_io_handle(
+     libvsmbr_internal_handle_pool_t *internal_handle_pool,
+     int entry,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_internal_handle_pool_get_entry_file_io_handle";
+	int result            = 1;
+
+	if( internal_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libvsmbr_internal_handle_pool_grab_entry(
+	     internal_handle_pool,
+	     entry,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab entry: %d.",
+		 function,
+		 entry );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Releases the file IO handle of an entry of the handle pool after a read or write
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_handle_pool_release_entry_file_io_handle(
+     libvsmbr_internal_handle_pool_t *internal_handle_pool,
+     int entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_internal_handle_pool_release_entry_file_io_handle";
+	int result            = 1;
+
+	if( internal_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libvsmbr_internal_handle_pool_release_entry(
+	     internal_handle_pool,
+	     entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release entry: %d.",
+		 function,
+		 entry );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads a buffer from an entry of the handle pool at a specific offset
+ * The file is reopened on demand if it was closed to make room for another file
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libvsmbr_handle_pool_read_entry_at_offset(
+         libvsmbr_handle_pool_t *handle_pool,
+         int entry,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle                      = NULL;
+	libvsmbr_internal_handle_pool_t *internal_handle_pool = NULL;
+	static char *function                                 = "libvsmbr_handle_pool_read_entry_at_offset";
+	ssize_t read_count                                    = 0;
+
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle_pool = (libvsmbr_internal_handle_pool_t *) handle_pool;
+
+	if( libvsmbr_internal_handle_pool_get_entry_file_io_handle(
+	     internal_handle_pool,
+	     entry,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              size,
+	              offset,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer from file IO handle: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 entry,
+		 offset,
+		 offset );
+	}
+	if( libvsmbr_internal_handle_pool_release_entry_file_io_handle(
+	     internal_handle_pool,
+	     entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Writes a buffer to an entry of the handle pool at a specific offset
+ * The file is reopened on demand if it was closed to make room for another file
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libvsmbr_handle_pool_write_entry_at_offset(
+         libvsmbr_handle_pool_t *handle_pool,
+         int entry,
+         const uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle                      = NULL;
+	libvsmbr_internal_handle_pool_t *internal_handle_pool = NULL;
+	static char *function                                 = "libvsmbr_handle_pool_write_entry_at_offset";
+	ssize_t write_count                                   = 0;
+
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle_pool = (libvsmbr_internal_handle_pool_t *) handle_pool;
+
+	if( libvsmbr_internal_handle_pool_get_entry_file_io_handle(
+	     internal_handle_pool,
+	     entry,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               file_io_handle,
+	               buffer,
+	               size,
+	               offset,
+	               error );
+
+	if( write_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer to file IO handle: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 entry,
+		 offset,
+		 offset );
+	}
+	if( libvsmbr_internal_handle_pool_release_entry_file_io_handle(
+	     internal_handle_pool,
+	     entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	return( write_count );
+}
+
+/* Retrieves the size of an entry of the handle pool
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_handle_pool_get_entry_size(
+     libvsmbr_handle_pool_t *handle_pool,
+     int entry,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle                      = NULL;
+	libvsmbr_internal_handle_pool_t *internal_handle_pool = NULL;
+	static char *function                                 = "libvsmbr_handle_pool_get_entry_size";
+	int result                                            = 1;
+
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle_pool = (libvsmbr_internal_handle_pool_t *) handle_pool;
+
+	if( libvsmbr_internal_handle_pool_get_entry_file_io_handle(
+	     internal_handle_pool,
+	     entry,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of file IO handle: %d.",
+		 function,
+		 entry );
+
+		result = -1;
+	}
+	if( libvsmbr_internal_handle_pool_release_entry_file_io_handle(
+	     internal_handle_pool,
+	     entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	return( result );
+}
+
@@ -0,0 +1,245 @@
+/*
+ * Handle pool functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSMBR_HANDLE_POOL_H )
+#define _LIBVSMBR_HANDLE_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsmbr_extern.h"
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_libcthreads.h"
+#include "libvsmbr_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsmbr_handle_pool_entry libvsmbr_handle_pool_entry_t;
+
+/* The state of an entry of the handle pool
+ */
+struct libvsmbr_handle_pool_entry
+{
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* Value to indicate the file IO handle is open
+	 */
+	uint8_t is_open;
+
+	/* The number of reads and writes that are using the file IO handle,
+	 * a file IO handle that is in use is not closed to make room for another file
+	 */
+	int number_of_users;
+
+	/* The value of the use counter when the file IO handle was last used
+	 */
+	uint64_t last_used;
+};
+
+typedef struct libvsmbr_internal_handle_pool libvsmbr_internal_handle_pool_t;
+
+/* The handle pool bounds the number of files that are kept open
+ * by the volumes that are opened through it
+ */
+struct libvsmbr_internal_handle_pool
+{
+	/* The file IO pool that contains a handle per registered file,
+	 * the handles are opened and closed by the handle pool itself
+	 */
+	libbfio_pool_t *file_io_pool;
+
+	/* The state of the entries in the file IO pool
+	 */
+	libvsmbr_handle_pool_entry_t *entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The maximum number of open handles, 0 represents no limit
+	 */
+	int maximum_number_of_open_handles;
+
+	/* The number of open handles
+	 */
+	int number_of_open_handles;
+
+	/* The use counter, which orders the entries by when they were last used
+	 */
+	uint64_t use_counter;
+
+	/* The number of registered handles
+	 */
+	int number_of_registered_handles;
+
+	/* The entries in the file IO pool of unregistered handles
+	 * which are reused by the next registration
+	 */
+	int *free_entries;
+
+	/* The number of free entries
+	 */
+	int number_of_free_entries;
+
+	/* The number of allocated free entries
+	 */
+	int number_of_allocated_free_entries;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+LIBVSMBR_EXTERN \
+int libvsmbr_handle_pool_initialize(
+     libvsmbr_handle_pool_t **handle_pool,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_handle_pool_free(
+     libvsmbr_handle_pool_t **handle_pool,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_handle_pool_get_maximum_number_of_open_handles(
+     libvsmbr_handle_pool_t *handle_pool,
+     int *maximum_number_of_open_handles,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_handle_pool_set_maximum_number_of_open_handles(
+     libvsmbr_handle_pool_t *handle_pool,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_handle_pool_get_number_of_handles(
+     libvsmbr_handle_pool_t *handle_pool,
+     int *number_of_handles,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_handle_pool_append_free_entry(
+     libvsmbr_internal_handle_pool_t *internal_handle_pool,
+     int entry,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_handle_pool_close_least_recently_used(
+     libvsmbr_internal_handle_pool_t *internal_handle_pool,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_handle_pool_grab_entry(
+     libvsmbr_internal_handle_pool_t *internal_handle_pool,
+     int entry,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_handle_pool_release_entry(
+     libvsmbr_internal_handle_pool_t *internal_handle_pool,
+     int entry,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_handle_pool_register_handle(
+     libvsmbr_internal_handle_pool_t *internal_handle_pool,
+     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t **pooled_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_handle_pool_register_file(
+     libvsmbr_handle_pool_t *handle_pool,
+     const char *filename,
+     size_t filename_length,
+     libbfio_handle_t **pooled_io_handle,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int libvsmbr_handle_pool_register_file_wide(
+     libvsmbr_handle_pool_t *handle_pool,
+     const wchar_t *filename,
+     size_t filename_length,
+     libbfio_handle_t **pooled_io_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+int libvsmbr_handle_pool_unregister_entry(
+     libvsmbr_handle_pool_t *handle_pool,
+     int entry,
+     libcerror_error_t **error );
+
+int libvsmbr_handle_pool_open_entry(
+     libvsmbr_handle_pool_t *handle_pool,
+     int entry,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libvsmbr_handle_pool_close_entry(
+     libvsmbr_handle_pool_t *handle_pool,
+     int entry,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_handle_pool_get_entry_file_io_handle(
+     libvsmbr_internal_handle_pool_t *internal_handle_pool,
+     int entry,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_handle_pool_release_entry_file_io_handle(
+     libvsmbr_internal_handle_pool_t *internal_handle_pool,
+     int entry,
+     libcerror_error_t **error );
+
+ssize_t libvsmbr_handle_pool_read_entry_at_offset(
+         libvsmbr_handle_pool_t *handle_pool,
+         int entry,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+ssize_t libvsmbr_handle_pool_write_entry_at_offset(
+         libvsmbr_handle_pool_t *handle_pool,
+         int entry,
+         const uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libvsmbr_handle_pool_get_entry_size(
+     libvsmbr_handle_pool_t *handle_pool,
+     int entry,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSMBR_HANDLE_POOL_H ) */
+
@@ -0,0 +1,1705 @@
+/*
+ * Image builder functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "libvsmbr_definitions.h"
+#include "libvsmbr_image_builder.h"
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcdata.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_libcthreads.h"
+#include "libvsmbr_partition_entry.h"
+#include "libvsmbr_partition_values.h"
+#include "libvsmbr_types.h"
+
+#include "vsmbr_boot_record.h"
+#include "vsmbr_partition_entry.h"
+
+/* Creates an image builder
+ * Make sure the value image_builder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_image_builder_initialize(
+     libvsmbr_image_builder_t **image_builder,
+     uint32_t bytes_per_sector,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_image_builder_t *internal_image_builder = NULL;
+	static char *function                                     = "libvsmbr_image_builder_initialize";
+
+	if( image_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *image_builder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid image builder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bytes_per_sector != 512 )
+	 && ( bytes_per_sector != 1024 )
+	 && ( bytes_per_sector != 2048 )
+	 && ( bytes_per_sector != 4096 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported bytes per sector: %" PRIu32 ".",
+		 function,
+		 bytes_per_sector );
+
+		return( -1 );
+	}
+	internal_image_builder = memory_allocate_structure(
+	                          libvsmbr_internal_image_builder_t );
+
+	if( internal_image_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create image builder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_image_builder,
+	     0,
+	     sizeof( libvsmbr_internal_image_builder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear image builder.",
+		 function );
+
+		memory_free(
+		 internal_image_builder );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_image_builder->primary_partitions_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create primary partitions array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_image_builder->logical_partitions_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create logical partitions array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_image_builder->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_image_builder->bytes_per_sector = bytes_per_sector;
+
+	*image_builder = (libvsmbr_image_builder_t *) internal_image_builder;
+
+	return( 1 );
+
+on_error:
+	if( internal_image_builder != NULL )
+	{
+		if( internal_image_builder->logical_partitions_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_image_builder->logical_partitions_array ),
+			 NULL,
+			 NULL );
+		}
+		if( internal_image_builder->primary_partitions_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_image_builder->primary_partitions_array ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 internal_image_builder );
+	}
+	return( -1 );
+}
+
+/* Frees an image builder
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_image_builder_free(
+     libvsmbr_image_builder_t **image_builder,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_image_builder_t *internal_image_builder = NULL;
+	static char *function                                     = "libvsmbr_image_builder_free";
+	int result                                                = 1;
+
+	if( image_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *image_builder != NULL )
+	{
+		internal_image_builder = (libvsmbr_internal_image_builder_t *) *image_builder;
+		*image_builder         = NULL;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_image_builder->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( libcdata_array_free(
+		     &( internal_image_builder->logical_partitions_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libvsmbr_partition_values_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free logical partitions array.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_array_free(
+		     &( internal_image_builder->primary_partitions_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libvsmbr_partition_values_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free primary partitions array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_image_builder );
+	}
+	return( result );
+}
+
+/* Sets the disk identity
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_image_builder_set_disk_identity(
+     libvsmbr_image_builder_t *image_builder,
+     uint32_t disk_identity,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_image_builder_t *internal_image_builder = NULL;
+	static char *function                                     = "libvsmbr_image_builder_set_disk_identity";
+
+	if( image_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_image_builder = (libvsmbr_internal_image_builder_t *) image_builder;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_image_builder->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_image_builder->disk_identity = disk_identity;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_image_builder->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the media size
+ * The image is extended to the media size if the partition table does not extend beyond it
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_image_builder_set_media_size(
+     libvsmbr_image_builder_t *image_builder,
+     size64_t media_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_image_builder_t *internal_image_builder = NULL;
+	static char *function                                     = "libvsmbr_image_builder_set_media_size";
+
+	if( image_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_image_builder = (libvsmbr_internal_image_builder_t *) image_builder;
+
+	if( media_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid media size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_image_builder->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_image_builder->media_size = media_size;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_image_builder->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Checks the values of a partition before it is appended
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_image_builder_check_partition(
+     libvsmbr_internal_image_builder_t *internal_image_builder,
+     uint8_t type,
+     uint32_t sector_number,
+     uint32_t number_of_sectors,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_internal_image_builder_check_partition";
+
+	if( internal_image_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image builder.",
+		 function );
+
+		return( -1 );
+	}
+	/* The extended partition types are reserved for the chain of extended boot records
+	 */
+	if( ( type == 0x00 )
+	 || ( type == 0x05 )
+	 || ( type == 0x0f ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported partition type: 0x%02" PRIx8 ".",
+		 function,
+		 type );
+
+		return( -1 );
+	}
+	if( sector_number == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_sectors == 0 )
+	 || ( number_of_sectors > ( (uint32_t) UINT32_MAX - sector_number ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of sectors value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a primary partition
+ * The sector number is relative to the start of the volume
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_image_builder_append_primary_partition(
+     libvsmbr_image_builder_t *image_builder,
+     uint8_t type,
+     uint32_t sector_number,
+     uint32_t number_of_sectors,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_image_builder_t *internal_image_builder = NULL;
+	libvsmbr_partition_values_t *partition_values             = NULL;
+	static char *function                                     = "libvsmbr_image_builder_append_primary_partition";
+	int entry_index                                           = 0;
+	int number_of_partitions                                  = 0;
+
+	if( image_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_image_builder = (libvsmbr_internal_image_builder_t *) image_builder;
+
+	if( libvsmbr_internal_image_builder_check_partition(
+	     internal_image_builder,
+	     type,
+	     sector_number,
+	     number_of_sectors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported partition.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_image_builder->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libvsmbr_partition_values_initialize(
+	     &partition_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create partition values.",
+		 function );
+
+		goto on_error;
+	}
+	partition_values->type              = type;
+	partition_values->sector_number     = sector_number;
+	partition_values->number_of_sectors = number_of_sectors;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_image_builder->primary_partitions_array,
+	     &number_of_partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of primary partitions.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_partitions >= 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of primary partitions value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     internal_image_builder->primary_partitions_array,
+	     &entry_index,
+	     (intptr_t *) partition_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append primary partition to array.",
+		 function );
+
+		goto on_error;
+	}
+	partition_values = NULL;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_image_builder->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( partition_values != NULL )
+	{
+		libvsmbr_partition_values_free(
+		 &partition_values,
+		 NULL );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_image_builder->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Appends a logical partition to the chain of extended boot records
+ * The extended boot record sector and the sector number are relative to the start of the volume
+ * The extended boot record of the first logical partition marks the start of the extended partition
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_image_builder_append_logical_partition(
+     libvsmbr_image_builder_t *image_builder,
+     uint32_t extended_boot_record_sector,
+     uint8_t type,
+     uint32_t sector_number,
+     uint32_t number_of_sectors,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_image_builder_t *internal_image_builder = NULL;
+	libvsmbr_partition_values_t *existing_partition_values    = NULL;
+	libvsmbr_partition_values_t *partition_values             = NULL;
+	static char *function                                     = "libvsmbr_image_builder_append_logical_partition";
+	off64_t partition_record_offset                           = 0;
+	int entry_index                                           = 0;
+	int number_of_partitions                                  = 0;
+	int partition_index                                       = 0;
+
+	if( image_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_image_builder = (libvsmbr_internal_image_builder_t *) image_builder;
+
+	if( extended_boot_record_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extended boot record sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_internal_image_builder_check_partition(
+	     internal_image_builder,
+	     type,
+	     sector_number,
+	     number_of_sectors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_number <= extended_boot_record_sector )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	partition_record_offset = (off64_t) extended_boot_record_sector * internal_image_builder->bytes_per_sector;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_image_builder->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libvsmbr_partition_values_initialize(
+	     &partition_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create partition values.",
+		 function );
+
+		goto on_error;
+	}
+	partition_values->type                    = type;
+	partition_values->partition_record_offset = partition_record_offset;
+	partition_values->sector_number           = sector_number - extended_boot_record_sector;
+	partition_values->number_of_sectors       = number_of_sectors;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_image_builder->logical_partitions_array,
+	     &number_of_partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of logical partitions.",
+		 function );
+
+		goto on_error;
+	}
+	/* The extended boot records of the subsequent logical partitions are stored
+	 * relative to the first, and must be unique to prevent a loop in the chain
+	 */
+	for( partition_index = 0;
+	     partition_index < number_of_partitions;
+	     partition_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_image_builder->logical_partitions_array,
+		     partition_index,
+		     (intptr_t **) &existing_partition_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		if( existing_partition_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing logical partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		if( ( ( partition_index == 0 )
+		  &&  ( partition_record_offset < existing_partition_values->partition_record_offset ) )
+		 || ( partition_record_offset == existing_partition_values->partition_record_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid extended boot record sector value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdata_array_append_entry(
+	     internal_image_builder->logical_partitions_array,
+	     &entry_index,
+	     (intptr_t *) partition_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append logical partition to array.",
+		 function );
+
+		goto on_error;
+	}
+	partition_values = NULL;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_image_builder->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( partition_values != NULL )
+	{
+		libvsmbr_partition_values_free(
+		 &partition_values,
+		 NULL );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_image_builder->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Writes the image to a file
+ * An existing file is overwritten
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_image_builder_write_file(
+     libvsmbr_image_builder_t *image_builder,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libvsmbr_image_builder_write_file";
+	size_t filename_length           = 0;
+
+	if( image_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_image_builder_write_file_io_handle(
+	     image_builder,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write image: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Writes the image to a file
+ * An existing file is overwritten
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_image_builder_write_file_wide(
+     libvsmbr_image_builder_t *image_builder,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libvsmbr_image_builder_write_file_wide";
+	size_t filename_length           = 0;
+
+	if( image_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_image_builder_write_file_io_handle(
+	     image_builder,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write image: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Writes a boot record sector
+ * The partition entries must already be stored in the sector data
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_image_builder_write_boot_record(
+     libvsmbr_internal_image_builder_t *internal_image_builder,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint8_t *sector_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_internal_image_builder_write_boot_record";
+	ssize_t write_count   = 0;
+
+	if( internal_image_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data.",
+		 function );
+
+		return( -1 );
+	}
+	( (vsmbr_boot_record_classical_t *) sector_data )->boot_signature[ 0 ] = 0x55;
+	( (vsmbr_boot_record_classical_t *) sector_data )->boot_signature[ 1 ] = 0xaa;
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               file_io_handle,
+	               sector_data,
+	               (size_t) internal_image_builder->bytes_per_sector,
+	               file_offset,
+	               error );
+
+	if( write_count != (ssize_t) internal_image_builder->bytes_per_sector )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write boot record at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the image using a Basic File IO (bfio) handle
+ * Only the master and extended boot record sectors are written, the remainder
+ * of the image is left as a hole
+ * This function is not multi-thread safe acquire read lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_image_builder_write_file_io_handle(
+     libvsmbr_internal_image_builder_t *internal_image_builder,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libvsmbr_partition_entry_t *partition_entry        = NULL;
+	libvsmbr_partition_values_t *next_partition_values = NULL;
+	libvsmbr_partition_values_t *partition_values      = NULL;
+	uint8_t *sector_data                               = NULL;
+	static char *function                              = "libvsmbr_internal_image_builder_write_file_io_handle";
+	size64_t image_size                                = 0;
+	size64_t partition_end_offset                      = 0;
+	size64_t written_size                              = 0;
+	ssize_t write_count                                = 0;
+	off64_t first_extended_boot_record_offset          = 0;
+	uint64_t extended_partition_end_sector             = 0;
+	uint64_t partition_end_sector                      = 0;
+	uint32_t first_extended_boot_record_sector         = 0;
+	uint32_t next_extended_boot_record_sector          = 0;
+	int entry_index                                    = 0;
+	int number_of_logical_partitions                   = 0;
+	int number_of_primary_partitions                   = 0;
+	int partition_index                                = 0;
+
+	if( internal_image_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_image_builder->primary_partitions_array,
+	     &number_of_primary_partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of primary partitions.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_image_builder->logical_partitions_array,
+	     &number_of_logical_partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of logical partitions.",
+		 function );
+
+		goto on_error;
+	}
+	/* The extended partition requires a primary partition entry
+	 */
+	if( ( number_of_logical_partitions > 0 )
+	 && ( number_of_primary_partitions >= 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of primary partitions value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	sector_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * internal_image_builder->bytes_per_sector );
+
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sector data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_partition_entry_initialize(
+	     &partition_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create partition entry.",
+		 function );
+
+		goto on_error;
+	}
+	/* Determine the extent of the extended partition
+	 */
+	for( partition_index = 0;
+	     partition_index < number_of_logical_partitions;
+	     partition_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_image_builder->logical_partitions_array,
+		     partition_index,
+		     (intptr_t **) &partition_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		if( partition_index == 0 )
+		{
+			first_extended_boot_record_offset = partition_values->partition_record_offset;
+			first_extended_boot_record_sector = (uint32_t) ( first_extended_boot_record_offset / internal_image_builder->bytes_per_sector );
+		}
+		partition_end_sector = (uint64_t) ( partition_values->partition_record_offset / internal_image_builder->bytes_per_sector )
+		                     + partition_values->sector_number
+		                     + partition_values->number_of_sectors;
+
+		if( partition_end_sector > extended_partition_end_sector )
+		{
+			extended_partition_end_sector = partition_end_sector;
+		}
+	}
+	/* Write the master boot record
+	 */
+	if( memory_set(
+	     sector_data,
+	     0,
+	     internal_image_builder->bytes_per_sector ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sector data.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (vsmbr_boot_record_modern_t *) sector_data )->disk_identity,
+	 internal_image_builder->disk_identity );
+
+	for( entry_index = 0;
+	     entry_index < number_of_primary_partitions;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_image_builder->primary_partitions_array,
+		     entry_index,
+		     (intptr_t **) &partition_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve primary partition: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		partition_entry->type              = partition_values->type;
+		partition_entry->start_address_lba = partition_values->sector_number;
+		partition_entry->number_of_sectors = partition_values->number_of_sectors;
+
+		partition_end_offset = ( (size64_t) partition_values->sector_number + partition_values->number_of_sectors )
+		                     * internal_image_builder->bytes_per_sector;
+
+		if( partition_end_offset > image_size )
+		{
+			image_size = partition_end_offset;
+		}
+		if( libvsmbr_partition_entry_write_data(
+		     partition_entry,
+		     &( ( ( (vsmbr_boot_record_classical_t *) sector_data )->partition_entries )[ entry_index * sizeof( vsmbr_partition_entry_t ) ] ),
+		     sizeof( vsmbr_partition_entry_t ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write primary partition entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	if( number_of_logical_partitions > 0 )
+	{
+		partition_entry->type              = 0x0f;
+		partition_entry->start_address_lba = first_extended_boot_record_sector;
+		partition_entry->number_of_sectors = (uint32_t) ( extended_partition_end_sector - first_extended_boot_record_sector );
+
+		if( libvsmbr_partition_entry_write_data(
+		     partition_entry,
+		     &( ( ( (vsmbr_boot_record_classical_t *) sector_data )->partition_entries )[ entry_index * sizeof( vsmbr_partition_entry_t ) ] ),
+		     sizeof( vsmbr_partition_entry_t ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write extended partition entry.",
+			 function );
+
+			goto on_error;
+		}
+		partition_end_offset = (size64_t) extended_partition_end_sector * internal_image_builder->bytes_per_sector;
+
+		if( partition_end_offset > image_size )
+		{
+			image_size = partition_end_offset;
+		}
+	}
+	if( libvsmbr_internal_image_builder_write_boot_record(
+	     internal_image_builder,
+	     file_io_handle,
+	     0,
+	     sector_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write master boot record.",
+		 function );
+
+		goto on_error;
+	}
+	written_size = internal_image_builder->bytes_per_sector;
+
+	/* Write the chain of extended boot records, the first entry of an extended boot record
+	 * contains the logical partition relative to the extended boot record and the second
+	 * entry the next extended boot record relative to the first extended boot record
+	 */
+	for( partition_index = 0;
+	     partition_index < number_of_logical_partitions;
+	     partition_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_image_builder->logical_partitions_array,
+		     partition_index,
+		     (intptr_t **) &partition_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     sector_data,
+		     0,
+		     internal_image_builder->bytes_per_sector ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear sector data.",
+			 function );
+
+			goto on_error;
+		}
+		partition_entry->type              = partition_values->type;
+		partition_entry->start_address_lba = partition_values->sector_number;
+		partition_entry->number_of_sectors = partition_values->number_of_sectors;
+
+		if( libvsmbr_partition_entry_write_data(
+		     partition_entry,
+		     ( (vsmbr_boot_record_classical_t *) sector_data )->partition_entries,
+		     sizeof( vsmbr_partition_entry_t ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write logical partition entry: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		if( ( partition_index + 1 ) < number_of_logical_partitions )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_image_builder->logical_partitions_array,
+			     partition_index + 1,
+			     (intptr_t **) &next_partition_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve logical partition: %d.",
+				 function,
+				 partition_index + 1 );
+
+				goto on_error;
+			}
+			next_extended_boot_record_sector = (uint32_t) ( next_partition_values->partition_record_offset / internal_image_builder->bytes_per_sector );
+
+			partition_entry->type              = 0x05;
+			partition_entry->start_address_lba = next_extended_boot_record_sector - first_extended_boot_record_sector;
+			partition_entry->number_of_sectors = next_partition_values->sector_number + next_partition_values->number_of_sectors;
+
+			if( libvsmbr_partition_entry_write_data(
+			     partition_entry,
+			     &( ( ( (vsmbr_boot_record_classical_t *) sector_data )->partition_entries )[ sizeof( vsmbr_partition_entry_t ) ] ),
+			     sizeof( vsmbr_partition_entry_t ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write extended partition entry: %d.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+		}
+		if( libvsmbr_internal_image_builder_write_boot_record(
+		     internal_image_builder,
+		     file_io_handle,
+		     partition_values->partition_record_offset,
+		     sector_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write extended boot record: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		partition_end_offset = (size64_t) partition_values->partition_record_offset + internal_image_builder->bytes_per_sector;
+
+		if( partition_end_offset > written_size )
+		{
+			written_size = partition_end_offset;
+		}
+	}
+	if( internal_image_builder->media_size > image_size )
+	{
+		image_size = internal_image_builder->media_size;
+	}
+	/* Write the last byte of the image to extend it to its full size
+	 * without writing the data in between
+	 */
+	if( image_size > written_size )
+	{
+		sector_data[ 0 ] = 0;
+
+		write_count = libbfio_handle_write_buffer_at_offset(
+		               file_io_handle,
+		               sector_data,
+		               1,
+		               (off64_t) ( image_size - 1 ),
+		               error );
+
+		if( write_count != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write last byte of image.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libvsmbr_partition_entry_free(
+	     &partition_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free partition entry.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 sector_data );
+
+	return( 1 );
+
+on_error:
+	if( partition_entry != NULL )
+	{
+		libvsmbr_partition_entry_free(
+		 &partition_entry,
+		 NULL );
+	}
+	if( sector_data != NULL )
+	{
+		memory_free(
+		 sector_data );
+	}
+	return( -1 );
+}
+
+/* Writes the image using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_image_builder_write_file_io_handle(
+     libvsmbr_image_builder_t *image_builder,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_image_builder_t *internal_image_builder = NULL;
+	static char *function                                     = "libvsmbr_image_builder_write_file_io_handle";
+	int file_io_handle_is_open                                = 0;
+	int file_io_handle_opened_in_library                      = 0;
+	int result                                                = 1;
+
+	if( image_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_image_builder = (libvsmbr_internal_image_builder_t *) image_builder;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		return( -1 );
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_WRITE_TRUNCATE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_image_builder->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libvsmbr_internal_image_builder_write_file_io_handle(
+	     internal_image_builder,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write image.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_image_builder->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		file_io_handle_opened_in_library = 0;
+
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
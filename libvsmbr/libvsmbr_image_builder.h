@@ -0,0 +1,158 @@
+/*
+ * Image builder functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSMBR_IMAGE_BUILDER_H )
+#define _LIBVSMBR_IMAGE_BUILDER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsmbr_extern.h"
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcdata.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_libcthreads.h"
+#include "libvsmbr_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsmbr_internal_image_builder libvsmbr_internal_image_builder_t;
+
+struct libvsmbr_internal_image_builder
+{
+	/* The number of bytes per sector
+	 */
+	uint32_t bytes_per_sector;
+
+	/* The disk identity
+	 */
+	uint32_t disk_identity;
+
+	/* The media size
+	 */
+	size64_t media_size;
+
+	/* The primary partitions array
+	 */
+	libcdata_array_t *primary_partitions_array;
+
+	/* The logical partitions array
+	 * The partition record offset of a logical partition is the offset of its extended boot record
+	 * and the sector number is relative to the extended boot record
+	 */
+	libcdata_array_t *logical_partitions_array;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+LIBVSMBR_EXTERN \
+int libvsmbr_image_builder_initialize(
+     libvsmbr_image_builder_t **image_builder,
+     uint32_t bytes_per_sector,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_image_builder_free(
+     libvsmbr_image_builder_t **image_builder,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_image_builder_set_disk_identity(
+     libvsmbr_image_builder_t *image_builder,
+     uint32_t disk_identity,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_image_builder_set_media_size(
+     libvsmbr_image_builder_t *image_builder,
+     size64_t media_size,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_image_builder_check_partition(
+     libvsmbr_internal_image_builder_t *internal_image_builder,
+     uint8_t type,
+     uint32_t sector_number,
+     uint32_t number_of_sectors,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_image_builder_append_primary_partition(
+     libvsmbr_image_builder_t *image_builder,
+     uint8_t type,
+     uint32_t sector_number,
+     uint32_t number_of_sectors,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_image_builder_append_logical_partition(
+     libvsmbr_image_builder_t *image_builder,
+     uint32_t extended_boot_record_sector,
+     uint8_t type,
+     uint32_t sector_number,
+     uint32_t number_of_sectors,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_image_builder_write_file(
+     libvsmbr_image_builder_t *image_builder,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBVSMBR_EXTERN \
+int libvsmbr_image_builder_write_file_wide(
+     libvsmbr_image_builder_t *image_builder,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+int libvsmbr_internal_image_builder_write_boot_record(
+     libvsmbr_internal_image_builder_t *internal_image_builder,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint8_t *sector_data,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_image_builder_write_file_io_handle(
+     libvsmbr_internal_image_builder_t *internal_image_builder,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_image_builder_write_file_io_handle(
+     libvsmbr_image_builder_t *image_builder,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSMBR_IMAGE_BUILDER_H ) */
+
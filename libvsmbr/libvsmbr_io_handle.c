@@ -86,6 +86,32 @@ int libvsmbr_io_handle_initialize(
 
 		goto on_error;
 	}
+	if( libvsmbr_trace_initialize(
+	     &( ( *io_handle )->trace ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create trace.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_write_cache_initialize(
+	     &( ( *io_handle )->write_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create write cache.",
+		 function );
+
+		goto on_error;
+	}
 	( *io_handle )->bytes_per_sector = 512;
 
 	return( 1 );
@@ -93,6 +119,12 @@ int libvsmbr_io_handle_initialize(
 on_error:
 	if( *io_handle != NULL )
 	{
+		if( ( *io_handle )->trace != NULL )
+		{
+			libvsmbr_trace_free(
+			 &( ( *io_handle )->trace ),
+			 NULL );
+		}
 		memory_free(
 		 *io_handle );
 
@@ -109,6 +141,7 @@ int libvsmbr_io_handle_free(
      libcerror_error_t **error )
 {
 	static char *function = "libvsmbr_io_handle_free";
+	int result            = 1;
 
 	if( io_handle == NULL )
 	{
@@ -123,12 +156,38 @@ int libvsmbr_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+		if( libvsmbr_trace_free(
+		     &( ( *io_handle )->trace ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free trace.",
+			 function );
+
+			result = -1;
+		}
+		if( libvsmbr_write_cache_free(
+		     &( ( *io_handle )->write_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free write cache.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *io_handle );
 
 		*io_handle = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Clears the IO handle
@@ -138,7 +197,9 @@ int libvsmbr_io_handle_clear(
      libvsmbr_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libvsmbr_io_handle_clear";
+	libvsmbr_trace_t *trace             = NULL;
+	libvsmbr_write_cache_t *write_cache = NULL;
+	static char *function               = "libvsmbr_io_handle_clear";
 
 	if( io_handle == NULL )
 	{
@@ -151,6 +212,12 @@ int libvsmbr_io_handle_clear(
 
 		return( -1 );
 	}
+	/* The trace recorder and write cache are preserved since they are
+	 * owned by the IO handle
+	 */
+	trace       = io_handle->trace;
+	write_cache = io_handle->write_cache;
+
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -166,6 +233,8 @@ int libvsmbr_io_handle_clear(
 		return( -1 );
 	}
 	io_handle->bytes_per_sector = 512;
+	io_handle->trace            = trace;
+	io_handle->write_cache      = write_cache;
 
 	return( 1 );
 }
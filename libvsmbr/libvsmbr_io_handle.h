@@ -28,6 +28,9 @@
 #include "libvsmbr_libbfio.h"
 #include "libvsmbr_libcdata.h"
 #include "libvsmbr_libcerror.h"
+#include "libvsmbr_statistics.h"
+#include "libvsmbr_trace.h"
+#include "libvsmbr_write_cache.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -41,6 +44,23 @@ struct libvsmbr_io_handle
 	 */
 	size_t bytes_per_sector;
 
+	/* The statistics of the volume, which include the statistics
+	 * of all its partitions
+	 */
+	libvsmbr_internal_statistics_t statistics;
+
+	/* The trace recorder of the volume
+	 */
+	libvsmbr_trace_t *trace;
+
+	/* The write-back cache of the volume
+	 */
+	libvsmbr_write_cache_t *write_cache;
+
+	/* The access flags
+	 */
+	int access_flags;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -0,0 +1,438 @@
+/*
+ * Partition move journal functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsmbr_definitions.h"
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_move_journal.h"
+
+#include "vsmbr_move_journal.h"
+
+const uint8_t vsmbr_move_journal_signature[ 8 ] = {
+	'V', 'S', 'M', 'B', 'R', 'M', 'V', 'J' };
+
+/* Creates a move journal
+ * Make sure the value move_journal is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_move_journal_initialize(
+     libvsmbr_move_journal_t **move_journal,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_move_journal_initialize";
+
+	if( move_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid move journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( *move_journal != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid move journal value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*move_journal = memory_allocate_structure(
+	                 libvsmbr_move_journal_t );
+
+	if( *move_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create move journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *move_journal,
+	     0,
+	     sizeof( libvsmbr_move_journal_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear move journal.",
+		 function );
+
+		memory_free(
+		 *move_journal );
+
+		*move_journal = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees a move journal
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_move_journal_free(
+     libvsmbr_move_journal_t **move_journal,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_move_journal_free";
+
+	if( move_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid move journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( *move_journal != NULL )
+	{
+		memory_free(
+		 *move_journal );
+
+		*move_journal = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads a move journal using a Basic File IO (bfio) handle
+ * Returns 1 if successful, 0 if the journal is empty or -1 on error
+ */
+int libvsmbr_move_journal_read_file_io_handle(
+     libvsmbr_move_journal_t *move_journal,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	vsmbr_move_journal_t journal_data;
+
+	static char *function          = "libvsmbr_move_journal_read_file_io_handle";
+	size64_t file_size             = 0;
+	ssize_t read_count             = 0;
+	uint64_t value_64bit           = 0;
+	uint32_t format_version        = 0;
+	uint32_t partition_entry_index = 0;
+
+	if( move_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid move journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve journal size.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_size == 0 )
+	{
+		return( 0 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &journal_data,
+	              sizeof( vsmbr_move_journal_t ),
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( vsmbr_move_journal_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read journal data at offset: 0 (0x00000000).",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     journal_data.signature,
+	     vsmbr_move_journal_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 journal_data.format_version,
+	 format_version );
+
+	if( format_version != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 journal_data.state,
+	 move_journal->state );
+
+	if( ( move_journal->state != LIBVSMBR_MOVE_JOURNAL_STATE_COPYING )
+	 && ( move_journal->state != LIBVSMBR_MOVE_JOURNAL_STATE_COPIED )
+	 && ( move_journal->state != LIBVSMBR_MOVE_JOURNAL_STATE_COMPLETED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported state: %" PRIu32 ".",
+		 function,
+		 move_journal->state );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 journal_data.partition_record_offset,
+	 value_64bit );
+
+	move_journal->partition_record_offset = (off64_t) value_64bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 journal_data.partition_entry_index,
+	 partition_entry_index );
+
+	if( partition_entry_index > 3 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	move_journal->partition_entry_index = (uint8_t) partition_entry_index;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 journal_data.sector_number,
+	 move_journal->sector_number );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 journal_data.number_of_sectors,
+	 move_journal->number_of_sectors );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 journal_data.source_offset,
+	 value_64bit );
+
+	move_journal->source_offset = (off64_t) value_64bit;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 journal_data.destination_offset,
+	 value_64bit );
+
+	move_journal->destination_offset = (off64_t) value_64bit;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 journal_data.data_size,
+	 move_journal->data_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 journal_data.copied_size,
+	 move_journal->copied_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 journal_data.buffered_size,
+	 move_journal->buffered_size );
+
+	if( ( move_journal->source_offset < 0 )
+	 || ( move_journal->destination_offset < 0 )
+	 || ( move_journal->partition_record_offset < 0 )
+	 || ( move_journal->copied_size > move_journal->data_size )
+	 || ( (size64_t) move_journal->buffered_size > ( move_journal->data_size - move_journal->copied_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid journal values out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a move journal using a Basic File IO (bfio) handle
+ * The journal is written with a single write so that a checkpoint is
+ * either stored entirely or not at all
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_move_journal_write_file_io_handle(
+     libvsmbr_move_journal_t *move_journal,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	vsmbr_move_journal_t journal_data;
+
+	static char *function = "libvsmbr_move_journal_write_file_io_handle";
+	ssize_t write_count   = 0;
+
+	if( move_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid move journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &journal_data,
+	     0,
+	     sizeof( vsmbr_move_journal_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear journal data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     journal_data.signature,
+	     vsmbr_move_journal_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 journal_data.format_version,
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 journal_data.state,
+	 move_journal->state );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 journal_data.partition_record_offset,
+	 (uint64_t) move_journal->partition_record_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 journal_data.partition_entry_index,
+	 (uint32_t) move_journal->partition_entry_index );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 journal_data.sector_number,
+	 move_journal->sector_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 journal_data.number_of_sectors,
+	 move_journal->number_of_sectors );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 journal_data.buffered_size,
+	 move_journal->buffered_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 journal_data.source_offset,
+	 (uint64_t) move_journal->source_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 journal_data.destination_offset,
+	 (uint64_t) move_journal->destination_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 journal_data.data_size,
+	 move_journal->data_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 journal_data.copied_size,
+	 move_journal->copied_size );
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               file_io_handle,
+	               (uint8_t *) &journal_data,
+	               sizeof( vsmbr_move_journal_t ),
+	               0,
+	               error );
+
+	if( write_count != (ssize_t) sizeof( vsmbr_move_journal_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write journal data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,106 @@
+/*
+ * Partition move journal functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSMBR_MOVE_JOURNAL_H )
+#define _LIBVSMBR_MOVE_JOURNAL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsmbr_move_journal libvsmbr_move_journal_t;
+
+struct libvsmbr_move_journal
+{
+	/* The state
+	 */
+	uint32_t state;
+
+	/* The offset of the partition record that contains the partition entry
+	 */
+	off64_t partition_record_offset;
+
+	/* The partition entry index
+	 */
+	uint8_t partition_entry_index;
+
+	/* The destination sector number
+	 */
+	uint32_t sector_number;
+
+	/* The destination number of sectors
+	 */
+	uint32_t number_of_sectors;
+
+	/* The source offset
+	 */
+	off64_t source_offset;
+
+	/* The destination offset
+	 */
+	off64_t destination_offset;
+
+	/* The data size
+	 */
+	size64_t data_size;
+
+	/* The size of the data that has been copied
+	 * When the destination is after the source the data is copied
+	 * backwards and the copied size is relative to the end of the data
+	 */
+	size64_t copied_size;
+
+	/* The size of the data of the batch that is being copied, which is stored
+	 * in the journal file after the journal, or 0 if no data is buffered
+	 */
+	uint32_t buffered_size;
+};
+
+int libvsmbr_move_journal_initialize(
+     libvsmbr_move_journal_t **move_journal,
+     libcerror_error_t **error );
+
+int libvsmbr_move_journal_free(
+     libvsmbr_move_journal_t **move_journal,
+     libcerror_error_t **error );
+
+int libvsmbr_move_journal_read_file_io_handle(
+     libvsmbr_move_journal_t *move_journal,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_move_journal_write_file_io_handle(
+     libvsmbr_move_journal_t *move_journal,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSMBR_MOVE_JOURNAL_H ) */
+
@@ -0,0 +1,1324 @@
+/*
+ * Overlay IO handle functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsmbr_definitions.h"
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_overlay_io_handle.h"
+#include "libvsmbr_unused.h"
+
+/* Creates an overlay IO handle
+ * Make sure the value overlay_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_overlay_io_handle_initialize(
+     libvsmbr_overlay_io_handle_t **overlay_io_handle,
+     libbfio_handle_t *base_file_io_handle,
+     libbfio_handle_t *overlay_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_overlay_io_handle_initialize";
+
+	if( overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *overlay_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid overlay IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( overlay_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*overlay_io_handle = memory_allocate_structure(
+	                      libvsmbr_overlay_io_handle_t );
+
+	if( *overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create overlay IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *overlay_io_handle,
+	     0,
+	     sizeof( libvsmbr_overlay_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear overlay IO handle.",
+		 function );
+
+		memory_free(
+		 *overlay_io_handle );
+
+		*overlay_io_handle = NULL;
+
+		return( -1 );
+	}
+	( *overlay_io_handle )->base_file_io_handle    = base_file_io_handle;
+	( *overlay_io_handle )->overlay_file_io_handle = overlay_file_io_handle;
+	( *overlay_io_handle )->block_size             = LIBVSMBR_OVERLAY_BLOCK_SIZE;
+
+	return( 1 );
+
+on_error:
+	if( *overlay_io_handle != NULL )
+	{
+		memory_free(
+		 *overlay_io_handle );
+
+		*overlay_io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Creates an overlay handle
+ * Reads are served from the overlay file for blocks that were written
+ * and from the base file IO handle otherwise
+ * The handle does not take over management of the base and overlay file IO handles
+ * Make sure the value handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_overlay_initialize(
+     libbfio_handle_t **handle,
+     libbfio_handle_t *base_file_io_handle,
+     libbfio_handle_t *overlay_file_io_handle,
+     libcerror_error_t **error )
+{
+	libvsmbr_overlay_io_handle_t *overlay_io_handle = NULL;
+	static char *function                           = "libvsmbr_overlay_initialize";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_overlay_io_handle_initialize(
+	     &overlay_io_handle,
+	     base_file_io_handle,
+	     overlay_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create overlay IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     handle,
+	     (intptr_t *) overlay_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libvsmbr_overlay_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libvsmbr_overlay_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libvsmbr_overlay_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libvsmbr_overlay_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libvsmbr_overlay_io_handle_read,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libvsmbr_overlay_io_handle_write,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libvsmbr_overlay_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libvsmbr_overlay_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libvsmbr_overlay_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libvsmbr_overlay_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( overlay_io_handle != NULL )
+	{
+		libvsmbr_overlay_io_handle_free(
+		 &overlay_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees an overlay IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_overlay_io_handle_free(
+     libvsmbr_overlay_io_handle_t **overlay_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_overlay_io_handle_free";
+	int result            = 1;
+
+	if( overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *overlay_io_handle != NULL )
+	{
+		if( ( *overlay_io_handle )->is_open != 0 )
+		{
+			if( libvsmbr_overlay_io_handle_close(
+			     *overlay_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close overlay IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *overlay_io_handle );
+
+		*overlay_io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the overlay IO handle
+ * This is not supported since the overlay data would no longer be shared
+ * Returns -1 on error
+ */
+int libvsmbr_overlay_io_handle_clone(
+     libvsmbr_overlay_io_handle_t **destination_overlay_io_handle,
+     libvsmbr_overlay_io_handle_t *source_overlay_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_overlay_io_handle_clone";
+
+	LIBVSMBR_UNREFERENCED_PARAMETER( destination_overlay_io_handle )
+	LIBVSMBR_UNREFERENCED_PARAMETER( source_overlay_io_handle )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: cloning an overlay IO handle is not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Opens the overlay IO handle
+ * The overlay file IO handle is opened and truncated if it is not open
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_overlay_io_handle_open(
+     libvsmbr_overlay_io_handle_t *overlay_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function       = "libvsmbr_overlay_io_handle_open";
+	uint64_t number_of_blocks   = 0;
+	uint64_t number_of_segments = 0;
+	int file_io_handle_is_open  = 0;
+
+	if( overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( overlay_io_handle->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid overlay IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     overlay_io_handle->base_file_io_handle,
+	     &( overlay_io_handle->size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve base file size.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_blocks = overlay_io_handle->size / overlay_io_handle->block_size;
+
+	if( ( overlay_io_handle->size % overlay_io_handle->block_size ) != 0 )
+	{
+		number_of_blocks++;
+	}
+	number_of_segments = number_of_blocks / LIBVSMBR_OVERLAY_BLOCK_TABLE_SEGMENT_SIZE;
+
+	if( ( number_of_blocks % LIBVSMBR_OVERLAY_BLOCK_TABLE_SEGMENT_SIZE ) != 0 )
+	{
+		number_of_segments++;
+	}
+	if( number_of_segments > ( (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( off64_t * ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of block table segments value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_segments > 0 )
+	{
+		overlay_io_handle->block_table_segments = (off64_t **) memory_allocate(
+		                                                        sizeof( off64_t * ) * (size_t) number_of_segments );
+
+		if( overlay_io_handle->block_table_segments == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create block table segments.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     overlay_io_handle->block_table_segments,
+		     0,
+		     sizeof( off64_t * ) * (size_t) number_of_segments ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear block table segments.",
+			 function );
+
+			memory_free(
+			 overlay_io_handle->block_table_segments );
+
+			overlay_io_handle->block_table_segments = NULL;
+
+			goto on_error;
+		}
+		overlay_io_handle->number_of_block_table_segments = (size_t) number_of_segments;
+	}
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		overlay_io_handle->block_data = (uint8_t *) memory_allocate(
+		                                             sizeof( uint8_t ) * overlay_io_handle->block_size );
+
+		if( overlay_io_handle->block_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create block data.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_is_open = libbfio_handle_is_open(
+		                          overlay_io_handle->overlay_file_io_handle,
+		                          error );
+
+		if( file_io_handle_is_open == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to determine if overlay file IO handle is open.",
+			 function );
+
+			goto on_error;
+		}
+		else if( file_io_handle_is_open == 0 )
+		{
+			if( libbfio_handle_open(
+			     overlay_io_handle->overlay_file_io_handle,
+			     LIBBFIO_OPEN_READ_WRITE_TRUNCATE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open overlay file IO handle.",
+				 function );
+
+				goto on_error;
+			}
+			overlay_io_handle->overlay_file_io_handle_opened_in_library = 1;
+		}
+	}
+	overlay_io_handle->access_flags      = access_flags;
+	overlay_io_handle->overlay_data_size = 0;
+	overlay_io_handle->current_offset    = 0;
+	overlay_io_handle->is_open           = 1;
+
+	return( 1 );
+
+on_error:
+	if( overlay_io_handle->block_data != NULL )
+	{
+		memory_free(
+		 overlay_io_handle->block_data );
+
+		overlay_io_handle->block_data = NULL;
+	}
+	if( overlay_io_handle->block_table_segments != NULL )
+	{
+		memory_free(
+		 overlay_io_handle->block_table_segments );
+
+		overlay_io_handle->block_table_segments = NULL;
+	}
+	overlay_io_handle->number_of_block_table_segments = 0;
+
+	return( -1 );
+}
+
+/* Closes the overlay IO handle
+ * The blocks stored in the overlay file are no longer accessible afterwards
+ * Returns 0 if successful or -1 on error
+ */
+int libvsmbr_overlay_io_handle_close(
+     libvsmbr_overlay_io_handle_t *overlay_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_overlay_io_handle_close";
+	size_t segment_index  = 0;
+	int result            = 0;
+
+	if( overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( overlay_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid overlay IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( overlay_io_handle->overlay_file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     overlay_io_handle->overlay_file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close overlay file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		overlay_io_handle->overlay_file_io_handle_opened_in_library = 0;
+	}
+	if( overlay_io_handle->block_data != NULL )
+	{
+		memory_free(
+		 overlay_io_handle->block_data );
+
+		overlay_io_handle->block_data = NULL;
+	}
+	if( overlay_io_handle->block_table_segments != NULL )
+	{
+		for( segment_index = 0;
+		     segment_index < overlay_io_handle->number_of_block_table_segments;
+		     segment_index++ )
+		{
+			if( overlay_io_handle->block_table_segments[ segment_index ] != NULL )
+			{
+				memory_free(
+				 overlay_io_handle->block_table_segments[ segment_index ] );
+			}
+		}
+		memory_free(
+		 overlay_io_handle->block_table_segments );
+
+		overlay_io_handle->block_table_segments = NULL;
+	}
+	overlay_io_handle->number_of_block_table_segments = 0;
+	overlay_io_handle->overlay_data_size              = 0;
+	overlay_io_handle->is_open                        = 0;
+
+	return( result );
+}
+
+/* Retrieves the offset of the data of a specific block in the overlay file
+ * Returns 1 if successful, 0 if the block is not in the overlay file or -1 on error
+ */
+int libvsmbr_overlay_io_handle_get_block_overlay_offset(
+     libvsmbr_overlay_io_handle_t *overlay_io_handle,
+     uint64_t block_number,
+     off64_t *overlay_offset,
+     libcerror_error_t **error )
+{
+	off64_t *segment       = NULL;
+	static char *function  = "libvsmbr_overlay_io_handle_get_block_overlay_offset";
+	uint64_t segment_index = 0;
+
+	if( overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( overlay_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay offset.",
+		 function );
+
+		return( -1 );
+	}
+	segment_index = block_number / LIBVSMBR_OVERLAY_BLOCK_TABLE_SEGMENT_SIZE;
+
+	if( segment_index >= (uint64_t) overlay_io_handle->number_of_block_table_segments )
+	{
+		return( 0 );
+	}
+	segment = overlay_io_handle->block_table_segments[ segment_index ];
+
+	if( segment == NULL )
+	{
+		return( 0 );
+	}
+	if( segment[ block_number % LIBVSMBR_OVERLAY_BLOCK_TABLE_SEGMENT_SIZE ] < 0 )
+	{
+		return( 0 );
+	}
+	*overlay_offset = segment[ block_number % LIBVSMBR_OVERLAY_BLOCK_TABLE_SEGMENT_SIZE ];
+
+	return( 1 );
+}
+
+/* Sets the offset of the data of a specific block in the overlay file
+ * The segment that contains the block is allocated if needed
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_overlay_io_handle_set_block_overlay_offset(
+     libvsmbr_overlay_io_handle_t *overlay_io_handle,
+     uint64_t block_number,
+     off64_t overlay_offset,
+     libcerror_error_t **error )
+{
+	off64_t *segment       = NULL;
+	static char *function  = "libvsmbr_overlay_io_handle_set_block_overlay_offset";
+	uint64_t segment_index = 0;
+	int entry_index        = 0;
+
+	if( overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( overlay_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid overlay offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	segment_index = block_number / LIBVSMBR_OVERLAY_BLOCK_TABLE_SEGMENT_SIZE;
+
+	if( segment_index >= (uint64_t) overlay_io_handle->number_of_block_table_segments )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	segment = overlay_io_handle->block_table_segments[ segment_index ];
+
+	if( segment == NULL )
+	{
+		segment = (off64_t *) memory_allocate(
+		                       sizeof( off64_t ) * LIBVSMBR_OVERLAY_BLOCK_TABLE_SEGMENT_SIZE );
+
+		if( segment == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create block table segment.",
+			 function );
+
+			return( -1 );
+		}
+		/* A negative offset marks a block that is not in the overlay file
+		 */
+		for( entry_index = 0;
+		     entry_index < LIBVSMBR_OVERLAY_BLOCK_TABLE_SEGMENT_SIZE;
+		     entry_index++ )
+		{
+			segment[ entry_index ] = -1;
+		}
+		overlay_io_handle->block_table_segments[ segment_index ] = segment;
+	}
+	segment[ block_number % LIBVSMBR_OVERLAY_BLOCK_TABLE_SEGMENT_SIZE ] = overlay_offset;
+
+	return( 1 );
+}
+
+/* Reads a buffer from the overlay IO handle
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libvsmbr_overlay_io_handle_read(
+         libvsmbr_overlay_io_handle_t *overlay_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function    = "libvsmbr_overlay_io_handle_read";
+	size_t block_data_offset = 0;
+	size_t buffer_offset     = 0;
+	size_t read_size         = 0;
+	size_t remaining_size    = 0;
+	ssize_t read_count       = 0;
+	uint64_t block_number    = 0;
+	off64_t overlay_offset   = 0;
+	int result               = 0;
+
+	if( overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( overlay_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid overlay IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) overlay_io_handle->current_offset >= overlay_io_handle->size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) size > ( overlay_io_handle->size - overlay_io_handle->current_offset ) )
+	{
+		size = (size_t) ( overlay_io_handle->size - overlay_io_handle->current_offset );
+	}
+	while( buffer_offset < size )
+	{
+		block_number      = (uint64_t) overlay_io_handle->current_offset / overlay_io_handle->block_size;
+		block_data_offset = (size_t) ( overlay_io_handle->current_offset % overlay_io_handle->block_size );
+
+		read_size = overlay_io_handle->block_size - block_data_offset;
+
+		if( read_size > ( size - buffer_offset ) )
+		{
+			read_size = size - buffer_offset;
+		}
+		result = libvsmbr_overlay_io_handle_get_block_overlay_offset(
+		          overlay_io_handle,
+		          block_number,
+		          &overlay_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve overlay offset of block: %" PRIu64 ".",
+			 function,
+			 block_number );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              overlay_io_handle->overlay_file_io_handle,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              overlay_offset + block_data_offset,
+			              error );
+		}
+		else
+		{
+			/* Consecutive blocks that are not in the overlay file are read
+			 * from the base file IO handle at once
+			 */
+			remaining_size = size - buffer_offset - read_size;
+
+			while( remaining_size > 0 )
+			{
+				block_number++;
+
+				result = libvsmbr_overlay_io_handle_get_block_overlay_offset(
+				          overlay_io_handle,
+				          block_number,
+				          &overlay_offset,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve overlay offset of block: %" PRIu64 ".",
+					 function,
+					 block_number );
+
+					return( -1 );
+				}
+				else if( result != 0 )
+				{
+					break;
+				}
+				if( remaining_size > overlay_io_handle->block_size )
+				{
+					read_size      += overlay_io_handle->block_size;
+					remaining_size -= overlay_io_handle->block_size;
+				}
+				else
+				{
+					read_size     += remaining_size;
+					remaining_size = 0;
+				}
+			}
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              overlay_io_handle->base_file_io_handle,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              overlay_io_handle->current_offset,
+			              error );
+		}
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 overlay_io_handle->current_offset,
+			 overlay_io_handle->current_offset );
+
+			return( -1 );
+		}
+		overlay_io_handle->current_offset += read_size;
+		buffer_offset                     += read_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Writes a buffer to the overlay IO handle
+ * A block that is written for the first time is copied from the base
+ * file IO handle and appended to the overlay file
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libvsmbr_overlay_io_handle_write(
+         libvsmbr_overlay_io_handle_t *overlay_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function    = "libvsmbr_overlay_io_handle_write";
+	size_t block_data_offset = 0;
+	size_t buffer_offset     = 0;
+	size_t read_size         = 0;
+	size_t write_size        = 0;
+	ssize_t read_count       = 0;
+	ssize_t write_count      = 0;
+	uint64_t block_number    = 0;
+	off64_t block_offset     = 0;
+	off64_t overlay_offset   = 0;
+	int result               = 0;
+
+	if( overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( overlay_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid overlay IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( overlay_io_handle->access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid overlay IO handle - not opened for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The overlay cannot extend the base
+	 */
+	if( (size64_t) overlay_io_handle->current_offset >= overlay_io_handle->size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) size > ( overlay_io_handle->size - overlay_io_handle->current_offset ) )
+	{
+		size = (size_t) ( overlay_io_handle->size - overlay_io_handle->current_offset );
+	}
+	while( buffer_offset < size )
+	{
+		block_number      = (uint64_t) overlay_io_handle->current_offset / overlay_io_handle->block_size;
+		block_data_offset = (size_t) ( overlay_io_handle->current_offset % overlay_io_handle->block_size );
+
+		write_size = overlay_io_handle->block_size - block_data_offset;
+
+		if( write_size > ( size - buffer_offset ) )
+		{
+			write_size = size - buffer_offset;
+		}
+		result = libvsmbr_overlay_io_handle_get_block_overlay_offset(
+		          overlay_io_handle,
+		          block_number,
+		          &overlay_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve overlay offset of block: %" PRIu64 ".",
+			 function,
+			 block_number );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			write_count = libbfio_handle_write_buffer_at_offset(
+			               overlay_io_handle->overlay_file_io_handle,
+			               &( buffer[ buffer_offset ] ),
+			               write_size,
+			               overlay_offset + block_data_offset,
+			               error );
+
+			if( write_count != (ssize_t) write_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write block: %" PRIu64 " to overlay file.",
+				 function,
+				 block_number );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			/* A block that is only partially overwritten is copied from
+			 * the base first, the part beyond the end of the base is zero
+			 */
+			if( write_size < overlay_io_handle->block_size )
+			{
+				block_offset = (off64_t) ( block_number * overlay_io_handle->block_size );
+				read_size    = overlay_io_handle->block_size;
+
+				if( (size64_t) read_size > ( overlay_io_handle->size - block_offset ) )
+				{
+					read_size = (size_t) ( overlay_io_handle->size - block_offset );
+				}
+				read_count = libbfio_handle_read_buffer_at_offset(
+				              overlay_io_handle->base_file_io_handle,
+				              overlay_io_handle->block_data,
+				              read_size,
+				              block_offset,
+				              error );
+
+				if( read_count != (ssize_t) read_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read block: %" PRIu64 " from base.",
+					 function,
+					 block_number );
+
+					return( -1 );
+				}
+				if( read_size < overlay_io_handle->block_size )
+				{
+					if( memory_set(
+					     &( overlay_io_handle->block_data[ read_size ] ),
+					     0,
+					     overlay_io_handle->block_size - read_size ) == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+						 "%s: unable to clear block data.",
+						 function );
+
+						return( -1 );
+					}
+				}
+			}
+			if( memory_copy(
+			     &( overlay_io_handle->block_data[ block_data_offset ] ),
+			     &( buffer[ buffer_offset ] ),
+			     write_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data to block data.",
+				 function );
+
+				return( -1 );
+			}
+			write_count = libbfio_handle_write_buffer_at_offset(
+			               overlay_io_handle->overlay_file_io_handle,
+			               overlay_io_handle->block_data,
+			               overlay_io_handle->block_size,
+			               (off64_t) overlay_io_handle->overlay_data_size,
+			               error );
+
+			if( write_count != (ssize_t) overlay_io_handle->block_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write block: %" PRIu64 " to overlay file.",
+				 function,
+				 block_number );
+
+				return( -1 );
+			}
+			if( libvsmbr_overlay_io_handle_set_block_overlay_offset(
+			     overlay_io_handle,
+			     block_number,
+			     (off64_t) overlay_io_handle->overlay_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set overlay offset of block: %" PRIu64 ".",
+				 function,
+				 block_number );
+
+				return( -1 );
+			}
+			overlay_io_handle->overlay_data_size += overlay_io_handle->block_size;
+		}
+		overlay_io_handle->current_offset += write_size;
+		buffer_offset                     += write_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Seeks a certain offset within the overlay IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libvsmbr_overlay_io_handle_seek_offset(
+         libvsmbr_overlay_io_handle_t *overlay_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_overlay_io_handle_seek_offset";
+
+	if( overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += overlay_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) overlay_io_handle->size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	overlay_io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if the overlay exists
+ * Returns 1 if the base file IO handle exists, 0 if not or -1 on error
+ */
+int libvsmbr_overlay_io_handle_exists(
+     libvsmbr_overlay_io_handle_t *overlay_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_overlay_io_handle_exists";
+	int result            = 0;
+
+	if( overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_exists(
+	          overlay_io_handle->base_file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if base file IO handle exists.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Check if the overlay IO handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libvsmbr_overlay_io_handle_is_open(
+     libvsmbr_overlay_io_handle_t *overlay_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_overlay_io_handle_is_open";
+
+	if( overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( overlay_io_handle->is_open == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the overlay, which is the size of the base
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_overlay_io_handle_get_size(
+     libvsmbr_overlay_io_handle_t *overlay_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_overlay_io_handle_get_size";
+
+	if( overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( overlay_io_handle->is_open == 0 )
+	{
+		if( libbfio_handle_get_size(
+		     overlay_io_handle->base_file_io_handle,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve base file size.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		*size = overlay_io_handle->size;
+	}
+	return( 1 );
+}
+
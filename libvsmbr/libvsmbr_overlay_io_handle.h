@@ -0,0 +1,172 @@
+/*
+ * Overlay IO handle functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSMBR_OVERLAY_IO_HANDLE_H )
+#define _LIBVSMBR_OVERLAY_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsmbr_overlay_io_handle libvsmbr_overlay_io_handle_t;
+
+/* The overlay IO handle redirects writes to an overlay file so that
+ * the base file IO handle is never written, data is stored in the overlay
+ * file per block in order of first write
+ */
+struct libvsmbr_overlay_io_handle
+{
+	/* The base file IO handle
+	 */
+	libbfio_handle_t *base_file_io_handle;
+
+	/* The overlay file IO handle
+	 */
+	libbfio_handle_t *overlay_file_io_handle;
+
+	/* Value to indicate if the overlay file IO handle was opened inside the library
+	 */
+	uint8_t overlay_file_io_handle_opened_in_library;
+
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The size, which is the size of the base
+	 */
+	size64_t size;
+
+	/* The block table segments, which map the block number to the offset
+	 * of the block data in the overlay file, a segment is only allocated
+	 * when one of its blocks is written
+	 */
+	off64_t **block_table_segments;
+
+	/* The number of block table segments
+	 */
+	size_t number_of_block_table_segments;
+
+	/* The size of the data stored in the overlay file
+	 */
+	size64_t overlay_data_size;
+
+	/* The block data used to copy a partially written block
+	 */
+	uint8_t *block_data;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* Value to indicate if the overlay IO handle is open
+	 */
+	uint8_t is_open;
+};
+
+int libvsmbr_overlay_io_handle_initialize(
+     libvsmbr_overlay_io_handle_t **overlay_io_handle,
+     libbfio_handle_t *base_file_io_handle,
+     libbfio_handle_t *overlay_file_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_overlay_initialize(
+     libbfio_handle_t **handle,
+     libbfio_handle_t *base_file_io_handle,
+     libbfio_handle_t *overlay_file_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_overlay_io_handle_free(
+     libvsmbr_overlay_io_handle_t **overlay_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_overlay_io_handle_clone(
+     libvsmbr_overlay_io_handle_t **destination_overlay_io_handle,
+     libvsmbr_overlay_io_handle_t *source_overlay_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_overlay_io_handle_open(
+     libvsmbr_overlay_io_handle_t *overlay_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libvsmbr_overlay_io_handle_close(
+     libvsmbr_overlay_io_handle_t *overlay_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_overlay_io_handle_get_block_overlay_offset(
+     libvsmbr_overlay_io_handle_t *overlay_io_handle,
+     uint64_t block_number,
+     off64_t *overlay_offset,
+     libcerror_error_t **error );
+
+int libvsmbr_overlay_io_handle_set_block_overlay_offset(
+     libvsmbr_overlay_io_handle_t *overlay_io_handle,
+     uint64_t block_number,
+     off64_t overlay_offset,
+     libcerror_error_t **error );
+
+ssize_t libvsmbr_overlay_io_handle_read(
+         libvsmbr_overlay_io_handle_t *overlay_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libvsmbr_overlay_io_handle_write(
+         libvsmbr_overlay_io_handle_t *overlay_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libvsmbr_overlay_io_handle_seek_offset(
+         libvsmbr_overlay_io_handle_t *overlay_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libvsmbr_overlay_io_handle_exists(
+     libvsmbr_overlay_io_handle_t *overlay_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_overlay_io_handle_is_open(
+     libvsmbr_overlay_io_handle_t *overlay_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_overlay_io_handle_get_size(
+     libvsmbr_overlay_io_handle_t *overlay_io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSMBR_OVERLAY_IO_HANDLE_H ) */
+
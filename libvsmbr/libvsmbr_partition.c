@@ -21,9 +21,12 @@
 
 #include <common.h>
 #include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
+#include "libvsmbr_cache_arena.h"
 #include "libvsmbr_definitions.h"
+#include "libvsmbr_file_descriptor.h"
 #include "libvsmbr_io_handle.h"
 #include "libvsmbr_libbfio.h"
 #include "libvsmbr_libcerror.h"
@@ -32,8 +35,12 @@
 #include "libvsmbr_libfdata.h"
 #include "libvsmbr_partition.h"
 #include "libvsmbr_sector_data.h"
+#include "libvsmbr_sparse_map.h"
+#include "libvsmbr_statistics.h"
+#include "libvsmbr_trace.h"
 #include "libvsmbr_types.h"
 #include "libvsmbr_unused.h"
+#include "libvsmbr_write_cache.h"
 
 /* Creates a partition
  * Make sure the value partition is referencing, is set to NULL
@@ -51,6 +58,7 @@ int libvsmbr_partition_initialize(
 	size64_t partition_size                           = 0;
 	off64_t partition_offset                          = 0;
 	int element_index                                 = 0;
+	int number_of_dirty_blocks                        = 0;
 
 	if( partition == NULL )
 	{
@@ -157,10 +165,24 @@ int libvsmbr_partition_initialize(
 	}
 	partition_size *= io_handle->bytes_per_sector;
 
+	if( libvsmbr_statistics_initialize(
+	     &( internal_partition->statistics ),
+	     (libvsmbr_statistics_t *) &( io_handle->statistics ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create statistics.",
+		 function );
+
+		goto on_error;
+	}
 	if( libfdata_vector_initialize(
 	     &( internal_partition->sectors_vector ),
 	     io_handle->bytes_per_sector,
-	     NULL,
+	     (intptr_t *) internal_partition,
 	     NULL,
 	     NULL,
 	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libvsmbr_partition_read_element_data,
@@ -209,6 +231,21 @@ int libvsmbr_partition_initialize(
 
 		goto on_error;
 	}
+	if( libvsmbr_write_cache_get_state(
+	     io_handle->write_cache,
+	     &( internal_partition->write_cache_generation ),
+	     &number_of_dirty_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve write cache state.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_initialize(
 	     &( internal_partition->read_write_lock ),
@@ -224,10 +261,12 @@ int libvsmbr_partition_initialize(
 		goto on_error;
 	}
 #endif
+	internal_partition->io_handle        = io_handle;
 	internal_partition->file_io_handle   = file_io_handle;
 	internal_partition->partition_values = partition_values;
 	internal_partition->offset           = partition_offset;
 	internal_partition->size             = partition_size;
+	internal_partition->partition_index  = -1;
 
 	*partition = (libvsmbr_partition_t *) internal_partition;
 
@@ -236,6 +275,24 @@ int libvsmbr_partition_initialize(
 on_error:
 	if( internal_partition != NULL )
 	{
+		if( internal_partition->sectors_cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( internal_partition->sectors_cache ),
+			 NULL );
+		}
+		if( internal_partition->sectors_vector != NULL )
+		{
+			libfdata_vector_free(
+			 &( internal_partition->sectors_vector ),
+			 NULL );
+		}
+		if( internal_partition->statistics != NULL )
+		{
+			libvsmbr_statistics_free(
+			 &( internal_partition->statistics ),
+			 NULL );
+		}
 		memory_free(
 		 internal_partition );
 	}
@@ -297,6 +354,52 @@ int libvsmbr_partition_free(
 
 			result = -1;
 		}
+		if( internal_partition->cache_arena != NULL )
+		{
+			if( libvsmbr_cache_arena_unregister_owner(
+			     internal_partition->cache_arena,
+			     internal_partition->cache_arena_owner_identifier,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to unregister partition from cache arena.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_partition->sparse_map != NULL )
+		{
+			if( libvsmbr_sparse_map_free(
+			     &( internal_partition->sparse_map ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sparse map.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libvsmbr_statistics_free(
+		     &( internal_partition->statistics ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free statistics.",
+			 function );
+
+			result = -1;
+		}
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
 		if( libcthreads_read_write_lock_free(
 		     &( internal_partition->read_write_lock ),
@@ -318,19 +421,22 @@ int libvsmbr_partition_free(
 	return( result );
 }
 
-/* Retrieves the partition type
+/* Reads sector data from a file IO handle
+ * The read is added to the statistics and recorded by the trace if active
  * Returns 1 if successful or -1 on error
  */
-int libvsmbr_partition_get_type(
-     libvsmbr_partition_t *partition,
-     uint8_t *type,
+int libvsmbr_internal_partition_read_sector_data(
+     libvsmbr_internal_partition_t *internal_partition,
+     libbfio_handle_t *file_io_handle,
+     libvsmbr_sector_data_t *sector_data,
+     off64_t sector_offset,
      libcerror_error_t **error )
 {
-	libvsmbr_internal_partition_t *internal_partition = NULL;
-	static char *function                             = "libvsmbr_partition_get_type";
-	int result                                        = 1;
+	static char *function = "libvsmbr_internal_partition_read_sector_data";
+	uint64_t end_time     = 0;
+	uint64_t start_time   = 0;
 
-	if( partition == NULL )
+	if( internal_partition == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -341,67 +447,132 @@ int libvsmbr_partition_get_type(
 
 		return( -1 );
 	}
-	internal_partition = (libvsmbr_internal_partition_t *) partition;
-
-#if defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_partition->read_write_lock,
-	     error ) != 1 )
+	if( internal_partition->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid partition - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( libvsmbr_partition_values_get_type(
-	     internal_partition->partition_values,
-	     type,
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_partition->statistics != NULL )
+	{
+		if( libvsmbr_statistics_get_current_time(
+		     &start_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve start time.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libvsmbr_trace_append_record(
+	     internal_partition->io_handle->trace,
+	     LIBVSMBR_TRACE_RECORD_TYPE_BACKING_READ,
+	     (uint32_t) internal_partition->partition_index,
+	     (uint64_t) sector_offset,
+	     sector_data->data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve type.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append trace record.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_partition->read_write_lock,
+	if( libvsmbr_sector_data_read_file_io_handle(
+	     sector_data,
+	     file_io_handle,
+	     sector_offset,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sector data.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( result );
+	if( internal_partition->statistics != NULL )
+	{
+		if( libvsmbr_statistics_get_current_time(
+		     &end_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve end time.",
+			 function );
+
+			return( -1 );
+		}
+		if( end_time < start_time )
+		{
+			end_time = start_time;
+		}
+		if( libvsmbr_statistics_add_backing_read(
+		     internal_partition->statistics,
+		     sector_data->data_size,
+		     end_time - start_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update statistics.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
 }
 
-/* Retrieves the partition offset relative to the start of the volume
+/* Reads data from a file IO handle without using the sector cache
+ * The read is added to the statistics and recorded by the trace if active
  * Returns 1 if successful or -1 on error
  */
-int libvsmbr_partition_get_volume_offset(
-     libvsmbr_partition_t *partition,
-     off64_t *volume_offset,
+int libvsmbr_internal_partition_read_data_from_file_io_handle(
+     libvsmbr_internal_partition_t *internal_partition,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *data,
+     size_t data_size,
+     off64_t data_offset,
      libcerror_error_t **error )
 {
-	libvsmbr_internal_partition_t *internal_partition = NULL;
-	static char *function                             = "libvsmbr_partition_get_volume_offset";
+	static char *function = "libvsmbr_internal_partition_read_data_from_file_io_handle";
+	ssize_t read_count    = 0;
+	uint64_t end_time     = 0;
+	uint64_t start_time   = 0;
 
-	if( partition == NULL )
+	if( internal_partition == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -412,71 +583,162 @@ int libvsmbr_partition_get_volume_offset(
 
 		return( -1 );
 	}
-	internal_partition = (libvsmbr_internal_partition_t *) partition;
+	if( internal_partition->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid partition - missing IO handle.",
+		 function );
 
-	if( volume_offset == NULL )
+		return( -1 );
+	}
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume offset.",
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_partition->read_write_lock,
-	     error ) != 1 )
+	if( data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	*volume_offset = internal_partition->offset;
+	if( internal_partition->statistics != NULL )
+	{
+		if( libvsmbr_statistics_get_current_time(
+		     &start_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve start time.",
+			 function );
 
-#if defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_partition->read_write_lock,
+			return( -1 );
+		}
+	}
+	if( libvsmbr_trace_append_record(
+	     internal_partition->io_handle->trace,
+	     LIBVSMBR_TRACE_RECORD_TYPE_BACKING_READ,
+	     (uint32_t) internal_partition->partition_index,
+	     (uint64_t) data_offset,
+	     data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append trace record.",
 		 function );
 
 		return( -1 );
 	}
-#endif
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              data,
+	              data_size,
+	              data_offset,
+	              error );
+
+	if( read_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 data_offset,
+		 data_offset );
+
+		return( -1 );
+	}
+	if( internal_partition->statistics != NULL )
+	{
+		if( libvsmbr_statistics_get_current_time(
+		     &end_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve end time.",
+			 function );
+
+			return( -1 );
+		}
+		if( end_time < start_time )
+		{
+			end_time = start_time;
+		}
+		if( libvsmbr_statistics_add_backing_read(
+		     internal_partition->statistics,
+		     data_size,
+		     end_time - start_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update statistics.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
-/* Reads (partition) data at the current offset into a buffer using a Basic File IO (bfio) handle
- * This function is not multi-thread safe acquire write lock before call
- * Returns the number of bytes read or -1 on error
+/* Reads sector data
+ * Callback function for the sector data vector
+ * The read and the resulting cache miss are added to the statistics and
+ * the read is recorded by the trace if active
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libvsmbr_internal_partition_read_buffer_from_file_io_handle(
-         libvsmbr_internal_partition_t *internal_partition,
-         libbfio_handle_t *file_io_handle,
-         void *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libvsmbr_partition_read_element_data(
+     libvsmbr_internal_partition_t *internal_partition,
+     libbfio_handle_t *file_io_handle,
+     libfdata_vector_t *vector,
+     libfdata_cache_t *cache,
+     int element_index,
+     int element_data_file_index LIBVSMBR_ATTRIBUTE_UNUSED,
+     off64_t element_data_offset,
+     size64_t element_data_size,
+     uint32_t element_data_flags LIBVSMBR_ATTRIBUTE_UNUSED,
+     uint8_t read_flags LIBVSMBR_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
 {
-	libvsmbr_sector_data_t *sector_data = NULL;
-	static char *function               = "libvsmbr_internal_partition_read_buffer_from_file_io_handle";
-	off64_t current_offset              = 0;
-	off64_t element_data_offset         = 0;
-	size_t buffer_offset                = 0;
-	size_t read_size                    = 0;
+	libfcache_cache_value_t *cache_value = NULL;
+	libvsmbr_sector_data_t *sector_data  = NULL;
+	intptr_t *cache_value_data           = NULL;
+	static char *function                = "libvsmbr_partition_read_element_data";
+	off64_t cache_value_offset           = 0;
+	int64_t cache_value_timestamp        = 0;
+	uint8_t evicted_value                = 0;
+	int cache_value_file_index           = 0;
+	int number_of_cache_entries          = 0;
+
+	LIBVSMBR_UNREFERENCED_PARAMETER( element_data_file_index );
+	LIBVSMBR_UNREFERENCED_PARAMETER( element_data_flags );
+	LIBVSMBR_UNREFERENCED_PARAMETER( read_flags );
 
 	if( internal_partition == NULL )
 	{
@@ -489,128 +751,207 @@ ssize_t libvsmbr_internal_partition_read_buffer_from_file_io_handle(
 
 		return( -1 );
 	}
-	if( internal_partition->current_offset < 0 )
+	if( internal_partition->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid partition - current offset value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid partition - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( buffer == NULL )
+	if( element_data_size > (size64_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid element data size value exceeds maximum.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( buffer_size > (size_t) SSIZE_MAX )
+	if( libvsmbr_sector_data_initialize(
+	     &sector_data,
+	     (size_t) element_data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid buffer size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sector data.",
 		 function );
 
-		return( -1 );
-	}
-	if( buffer_size == 0 )
-	{
-		return( 0 );
+		goto on_error;
 	}
-	if( (size64_t) internal_partition->current_offset >= internal_partition->size )
+	if( libvsmbr_internal_partition_read_sector_data(
+	     internal_partition,
+	     file_io_handle,
+	     sector_data,
+	     element_data_offset,
+	     error ) != 1 )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sector data.",
+		 function );
+
+		goto on_error;
 	}
-	if( (size64_t) buffer_size > ( internal_partition->size - internal_partition->current_offset ) )
+	if( internal_partition->statistics != NULL )
 	{
-		buffer_size = (size_t) ( internal_partition->size - internal_partition->current_offset );
-	}
-	current_offset = internal_partition->current_offset;
-
-	while( buffer_size > 0 )
-	{
-		if( libfdata_vector_get_element_value_at_offset(
-		     internal_partition->sectors_vector,
-		     (intptr_t *) file_io_handle,
-		     (libfdata_cache_t *) internal_partition->sectors_cache,
-		     current_offset,
-		     &element_data_offset,
-		     (intptr_t **) &sector_data,
-		     0,
+		if( libfcache_cache_get_number_of_entries(
+		     (libfcache_cache_t *) cache,
+		     &number_of_cache_entries,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-			 function,
-			 current_offset,
-			 current_offset );
+			 "%s: unable to retrieve number of cache entries.",
+			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( sector_data == NULL )
+		if( number_of_cache_entries <= 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing sector data.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of cache entries value out of bounds.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		read_size = sector_data->data_size - (size_t) element_data_offset;
+		/* The vector stores the sector data in the cache entry of the element index
+		 * modulo the number of cache entries. The sector data only replaces the data
+		 * of another sector if that entry holds a value with a different offset,
+		 * a value of the same sector that was invalidated is not an eviction
+		 */
+		if( libfcache_cache_get_value_by_index(
+		     (libfcache_cache_t *) cache,
+		     element_index % number_of_cache_entries,
+		     &cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value: %d.",
+			 function,
+			 element_index % number_of_cache_entries );
 
-		if( buffer_size < read_size )
+			goto on_error;
+		}
+		if( cache_value != NULL )
 		{
-			read_size = buffer_size;
+			if( libfcache_cache_value_get_value(
+			     cache_value,
+			     &cache_value_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve cache value data.",
+				 function );
+
+				goto on_error;
+			}
 		}
-		if( memory_copy(
-		     &( ( (uint8_t *) buffer )[ buffer_offset ] ),
-		     &( sector_data->data[ element_data_offset ] ),
-		     read_size ) == NULL )
+		if( cache_value_data != NULL )
+		{
+			if( libfcache_cache_value_get_identifier(
+			     cache_value,
+			     &cache_value_file_index,
+			     &cache_value_offset,
+			     &cache_value_timestamp,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve cache value identifier.",
+				 function );
+
+				goto on_error;
+			}
+			evicted_value = (uint8_t) ( cache_value_offset != element_data_offset );
+		}
+	}
+	if( libfdata_vector_set_element_value_by_index(
+	     vector,
+	     (intptr_t *) file_io_handle,
+	     cache,
+	     element_index,
+	     (intptr_t *) sector_data,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libvsmbr_sector_data_free,
+	     LIBFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set sector data as element value.",
+		 function );
+
+		goto on_error;
+	}
+	/* The sector data is now managed by the cache
+	 */
+	sector_data = NULL;
+
+	if( internal_partition->statistics != NULL )
+	{
+		if( libvsmbr_statistics_add_cache_miss(
+		     internal_partition->statistics,
+		     evicted_value,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy sector data.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update statistics.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		current_offset += read_size;
-		buffer_offset  += read_size;
-		buffer_size    -= read_size;
 	}
-	internal_partition->current_offset = current_offset;
+	return( 1 );
 
-	return( (ssize_t) buffer_offset );
+on_error:
+	if( sector_data != NULL )
+	{
+		libvsmbr_sector_data_free(
+		 &sector_data,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Reads (partition) data at the current offset into a buffer
- * Returns the number of bytes read or -1 on error
+/* Retrieves the partition type
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libvsmbr_partition_read_buffer(
-         libvsmbr_partition_t *partition,
-         void *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libvsmbr_partition_get_type(
+     libvsmbr_partition_t *partition,
+     uint8_t *type,
+     libcerror_error_t **error )
 {
 	libvsmbr_internal_partition_t *internal_partition = NULL;
-	static char *function                             = "libvsmbr_partition_read_buffer";
-	ssize_t read_count                                = 0;
+	static char *function                             = "libvsmbr_partition_get_type";
+	int result                                        = 1;
 
 	if( partition == NULL )
 	{
@@ -626,7 +967,7 @@ ssize_t libvsmbr_partition_read_buffer(
 	internal_partition = (libvsmbr_internal_partition_t *) partition;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_partition->read_write_lock,
 	     error ) != 1 )
 	{
@@ -634,32 +975,28 @@ ssize_t libvsmbr_partition_read_buffer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	read_count = libvsmbr_internal_partition_read_buffer_from_file_io_handle(
-		      internal_partition,
-		      internal_partition->file_io_handle,
-		      buffer,
-		      buffer_size,
-		      error );
-
-	if( read_count == -1 )
+	if( libvsmbr_partition_values_get_type(
+	     internal_partition->partition_values,
+	     type,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer from partition.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve type.",
 		 function );
 
-		read_count = -1;
+		result = -1;
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_partition->read_write_lock,
 	     error ) != 1 )
 	{
@@ -667,28 +1004,25 @@ ssize_t libvsmbr_partition_read_buffer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( read_count );
+	return( result );
 }
 
-/* Reads (partition) data at a specific offset
- * Returns the number of bytes read or -1 on error
+/* Retrieves the partition offset relative to the start of the volume
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libvsmbr_partition_read_buffer_at_offset(
-         libvsmbr_partition_t *partition,
-         void *buffer,
-         size_t buffer_size,
-         off64_t offset,
-         libcerror_error_t **error )
+int libvsmbr_partition_get_volume_offset(
+     libvsmbr_partition_t *partition,
+     off64_t *volume_offset,
+     libcerror_error_t **error )
 {
 	libvsmbr_internal_partition_t *internal_partition = NULL;
-	static char *function                             = "libvsmbr_partition_read_buffer_at_offset";
-	ssize_t read_count                                = 0;
+	static char *function                             = "libvsmbr_partition_get_volume_offset";
 
 	if( partition == NULL )
 	{
@@ -703,56 +1037,36 @@ ssize_t libvsmbr_partition_read_buffer_at_offset(
 	}
 	internal_partition = (libvsmbr_internal_partition_t *) partition;
 
-#if defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_partition->read_write_lock,
-	     error ) != 1 )
+	if( volume_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume offset.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( libvsmbr_internal_partition_seek_offset(
-	     internal_partition,
-	     offset,
-	     SEEK_SET,
-	     error ) == -1 )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_partition->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	read_count = libvsmbr_internal_partition_read_buffer_from_file_io_handle(
-		      internal_partition,
-		      internal_partition->file_io_handle,
-		      buffer,
-		      buffer_size,
-		      error );
-
-	if( read_count == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer.",
-		 function );
+#endif
+	*volume_offset = internal_partition->offset;
 
-		goto on_error;
-	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_partition->read_write_lock,
 	     error ) != 1 )
 	{
@@ -760,34 +1074,28 @@ ssize_t libvsmbr_partition_read_buffer_at_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( read_count );
-
-on_error:
-#if defined( HAVE_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_partition->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
+	return( 1 );
 }
 
-/* Seeks a certain offset of the (partition) data
+/* Sets the cache arena in which the sector data is cached
+ * The sector data is cached in the cache arena instead of the sectors cache
+ * of the partition, the cache arena must remain available until the partition
+ * is freed
  * This function is not multi-thread safe acquire write lock before call
- * Returns the offset if seek is successful or -1 on error
+ * Returns 1 if successful or -1 on error
  */
-off64_t libvsmbr_internal_partition_seek_offset(
-         libvsmbr_internal_partition_t *internal_partition,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
+int libvsmbr_internal_partition_set_cache_arena(
+     libvsmbr_internal_partition_t *internal_partition,
+     libvsmbr_cache_arena_t *cache_arena,
+     libcerror_error_t **error )
 {
-	static char *function = "libvsmbr_internal_partition_seek_offset";
+	static char *function = "libvsmbr_internal_partition_set_cache_arena";
 
 	if( internal_partition == NULL )
 	{
@@ -800,56 +1108,51 @@ off64_t libvsmbr_internal_partition_seek_offset(
 
 		return( -1 );
 	}
-	if( ( whence != SEEK_CUR )
-	 && ( whence != SEEK_END )
-	 && ( whence != SEEK_SET ) )
+	if( internal_partition->cache_arena != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported whence.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid partition - cache arena value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( whence == SEEK_CUR )
-	{
-		offset += internal_partition->current_offset;
-	}
-	else if( whence == SEEK_END )
-	{
-		offset += (off64_t) internal_partition->size;
-	}
-	if( offset < 0 )
+	if( libvsmbr_cache_arena_register_owner(
+	     cache_arena,
+	     &( internal_partition->cache_arena_owner_identifier ),
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid offset value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to register partition in cache arena.",
 		 function );
 
 		return( -1 );
 	}
-	internal_partition->current_offset = offset;
+	internal_partition->cache_arena = cache_arena;
 
-	return( offset );
+	return( 1 );
 }
 
-/* Seeks a certain offset of the (partition) data
- * Returns the offset if seek is successful or -1 on error
+/* Synchronizes the partition with the write cache of the volume
+ * The cached sector data and sparse map are emptied when dirty blocks were
+ * flushed since they were filled
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
  */
-off64_t libvsmbr_partition_seek_offset(
-         libvsmbr_partition_t *partition,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
+int libvsmbr_internal_partition_synchronize_write_cache(
+     libvsmbr_internal_partition_t *internal_partition,
+     int *number_of_dirty_blocks,
+     libcerror_error_t **error )
 {
-	libvsmbr_internal_partition_t *internal_partition = NULL;
-	static char *function                             = "libvsmbr_partition_seek_offset";
+	static char *function           = "libvsmbr_internal_partition_synchronize_write_cache";
+	uint32_t write_cache_generation = 0;
 
-	if( partition == NULL )
+	if( internal_partition == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -860,39 +1163,2154 @@ off64_t libvsmbr_partition_seek_offset(
 
 		return( -1 );
 	}
-	internal_partition = (libvsmbr_internal_partition_t *) partition;
+	if( internal_partition->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid partition - missing IO handle.",
+		 function );
 
-#if defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_partition->read_write_lock,
+		return( -1 );
+	}
+	if( libvsmbr_write_cache_get_state(
+	     internal_partition->io_handle->write_cache,
+	     &write_cache_generation,
+	     number_of_dirty_blocks,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve write cache state.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	offset = libvsmbr_internal_partition_seek_offset(
-	          internal_partition,
-	          offset,
-	          whence,
+	if( write_cache_generation == internal_partition->write_cache_generation )
+	{
+		return( 1 );
+	}
+	if( internal_partition->cache_arena != NULL )
+	{
+		if( libvsmbr_cache_arena_remove_owner_blocks(
+		     internal_partition->cache_arena,
+		     internal_partition->cache_arena_owner_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove sector data from cache arena.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( libfcache_cache_empty(
+	          internal_partition->sectors_cache,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty sectors cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_partition->sparse_map != NULL )
+	{
+		if( libvsmbr_sparse_map_free(
+		     &( internal_partition->sparse_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sparse map.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_partition->write_cache_generation = write_cache_generation;
+
+	return( 1 );
+}
+
+/* Reads data of the sector at a specific offset using the cache arena
+ * At most the data up to the end of the sector is read, a sector that is not
+ * in the cache arena is read from the file IO handle and added to it
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_partition_read_from_cache_arena(
+     libvsmbr_internal_partition_t *internal_partition,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     uint8_t *buffer,
+     size_t buffer_size,
+     size_t *read_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_sector_data_t *sector_data = NULL;
+	static char *function               = "libvsmbr_internal_partition_read_from_cache_arena";
+	off64_t sector_offset               = 0;
+	size_t data_offset                  = 0;
+	size_t data_size                    = 0;
+	uint8_t evicted_blocks              = 0;
+	int result                          = 0;
+
+	if( internal_partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_partition->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid partition - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_partition->cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid partition - missing cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( (size64_t) offset >= internal_partition->size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read size.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset   = (size_t) ( offset % internal_partition->io_handle->bytes_per_sector );
+	sector_offset = offset - data_offset;
+
+	result = libvsmbr_cache_arena_read_block(
+	          internal_partition->cache_arena,
+	          internal_partition->cache_arena_owner_identifier,
+	          sector_offset,
+	          data_offset,
+	          buffer,
+	          buffer_size,
+	          read_size,
 	          error );
 
-	if( offset == -1 )
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read sector data at offset: %" PRIi64 " (0x%08" PRIx64 ") from cache arena.",
+		 function,
+		 sector_offset,
+		 sector_offset );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		return( 1 );
+	}
+	if( libvsmbr_sector_data_initialize(
+	     &sector_data,
+	     internal_partition->io_handle->bytes_per_sector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sector data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_internal_partition_read_sector_data(
+	     internal_partition,
+	     file_io_handle,
+	     sector_data,
+	     internal_partition->offset + sector_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sector data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_cache_arena_insert_block(
+	     internal_partition->cache_arena,
+	     internal_partition->cache_arena_owner_identifier,
+	     sector_offset,
+	     sector_data->data,
+	     sector_data->data_size,
+	     0,
+	     &evicted_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert sector data in cache arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_partition->statistics != NULL )
+	{
+		/* If blocks were evicted to make room for the sector data
+		 * it replaced the data of another sector
+		 */
+		if( libvsmbr_statistics_add_cache_miss(
+		     internal_partition->statistics,
+		     evicted_blocks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update statistics.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	data_size = sector_data->data_size - data_offset;
+
+	if( data_size > buffer_size )
+	{
+		data_size = buffer_size;
+	}
+	if( memory_copy(
+	     buffer,
+	     &( sector_data->data[ data_offset ] ),
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy sector data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_sector_data_free(
+	     &sector_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free sector data.",
+		 function );
+
+		goto on_error;
+	}
+	*read_size = data_size;
+
+	return( 1 );
+
+on_error:
+	if( sector_data != NULL )
+	{
+		libvsmbr_sector_data_free(
+		 &sector_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads (partition) data at a specific offset into a buffer using a Basic File IO (bfio) handle
+ * The current offset of the partition is not changed
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libvsmbr_internal_partition_read_buffer_at_offset_from_file_io_handle(
+         libvsmbr_internal_partition_t *internal_partition,
+         libbfio_handle_t *file_io_handle,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libvsmbr_sector_data_t *sector_data = NULL;
+	static char *function               = "libvsmbr_internal_partition_read_buffer_at_offset_from_file_io_handle";
+	size64_t sparse_range_size          = 0;
+	off64_t current_offset              = 0;
+	off64_t element_data_offset         = 0;
+	off64_t sparse_range_offset         = 0;
+	uint64_t number_of_cache_lookups    = 0;
+	size_t block_read_size              = 0;
+	size_t buffer_offset                = 0;
+	size_t read_size                    = 0;
+	int number_of_dirty_blocks          = 0;
+	int result                          = 0;
+
+	if( internal_partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == 0 )
+	{
+		return( 0 );
+	}
+	if( (size64_t) offset >= internal_partition->size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( internal_partition->size - offset ) )
+	{
+		buffer_size = (size_t) ( internal_partition->size - offset );
+	}
+	current_offset = offset;
+
+	if( libvsmbr_trace_append_record(
+	     internal_partition->io_handle->trace,
+	     LIBVSMBR_TRACE_RECORD_TYPE_REQUEST,
+	     (uint32_t) internal_partition->partition_index,
+	     (uint64_t) current_offset,
+	     buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append trace record.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_internal_partition_synchronize_write_cache(
+	     internal_partition,
+	     &number_of_dirty_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to synchronize with write cache.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_size > 0 )
+	{
+		block_read_size = buffer_size;
+
+		/* Dirty blocks that have not been flushed take precedence over
+		 * the data in the file IO handle
+		 */
+		if( number_of_dirty_blocks > 0 )
+		{
+			result = libvsmbr_write_cache_read_buffer(
+			          internal_partition->io_handle->write_cache,
+			          internal_partition->offset + current_offset,
+			          &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+			          buffer_size,
+			          &read_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to read dirty data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 current_offset,
+				 current_offset );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				current_offset += read_size;
+				buffer_offset  += read_size;
+				buffer_size    -= read_size;
+
+				continue;
+			}
+			/* Do not read past the start of the next block since it could be dirty
+			 */
+			block_read_size = internal_partition->io_handle->bytes_per_sector
+			                - (size_t) ( ( internal_partition->offset + current_offset ) % internal_partition->io_handle->bytes_per_sector );
+
+			if( block_read_size > buffer_size )
+			{
+				block_read_size = buffer_size;
+			}
+		}
+		/* Data in a range that a previous scan found to be sparse
+		 * does not need to be read again
+		 */
+		if( internal_partition->sparse_map != NULL )
+		{
+			result = libvsmbr_sparse_map_get_range_at_offset(
+			          internal_partition->sparse_map,
+			          current_offset,
+			          &sparse_range_offset,
+			          &sparse_range_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sparse range at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 current_offset,
+				 current_offset );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				sparse_range_size -= (size64_t) ( current_offset - sparse_range_offset );
+
+				read_size = block_read_size;
+
+				if( (size64_t) read_size > sparse_range_size )
+				{
+					read_size = (size_t) sparse_range_size;
+				}
+				if( memory_set(
+				     &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+				     0,
+				     read_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to set sparse data.",
+					 function );
+
+					return( -1 );
+				}
+				current_offset += read_size;
+				buffer_offset  += read_size;
+				buffer_size    -= read_size;
+
+				continue;
+			}
+		}
+		if( internal_partition->cache_arena != NULL )
+		{
+			if( libvsmbr_internal_partition_read_from_cache_arena(
+			     internal_partition,
+			     file_io_handle,
+			     current_offset,
+			     &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+			     block_read_size,
+			     &read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to read sector data at offset: %" PRIi64 " (0x%08" PRIx64 ") using cache arena.",
+				 function,
+				 current_offset,
+				 current_offset );
+
+				return( -1 );
+			}
+			number_of_cache_lookups++;
+
+			current_offset += read_size;
+			buffer_offset  += read_size;
+			buffer_size    -= read_size;
+
+			continue;
+		}
+		if( libfdata_vector_get_element_value_at_offset(
+		     internal_partition->sectors_vector,
+		     (intptr_t *) file_io_handle,
+		     (libfdata_cache_t *) internal_partition->sectors_cache,
+		     current_offset,
+		     &element_data_offset,
+		     (intptr_t **) &sector_data,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 current_offset,
+			 current_offset );
+
+			return( -1 );
+		}
+		number_of_cache_lookups++;
+
+		if( sector_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing sector data.",
+			 function );
+
+			return( -1 );
+		}
+		read_size = sector_data->data_size - (size_t) element_data_offset;
+
+		if( block_read_size < read_size )
+		{
+			read_size = block_read_size;
+		}
+		if( memory_copy(
+		     &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+		     &( sector_data->data[ element_data_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sector data.",
+			 function );
+
+			return( -1 );
+		}
+		current_offset += read_size;
+		buffer_offset  += read_size;
+		buffer_size    -= read_size;
+	}
+	/* The counters are updated once per read to keep the cost of
+	 * the statistics independent of the number of sectors read
+	 */
+	if( libvsmbr_statistics_add_delivered(
+	     internal_partition->statistics,
+	     number_of_cache_lookups,
+	     buffer_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Reads (partition) data at the current offset into a buffer using a Basic File IO (bfio) handle
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libvsmbr_internal_partition_read_buffer_from_file_io_handle(
+         libvsmbr_internal_partition_t *internal_partition,
+         libbfio_handle_t *file_io_handle,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_internal_partition_read_buffer_from_file_io_handle";
+	ssize_t read_count    = 0;
+
+	if( internal_partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_partition->current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition - current offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libvsmbr_internal_partition_read_buffer_at_offset_from_file_io_handle(
+	              internal_partition,
+	              file_io_handle,
+	              buffer,
+	              buffer_size,
+	              internal_partition->current_offset,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 internal_partition->current_offset,
+		 internal_partition->current_offset );
+
+		return( -1 );
+	}
+	internal_partition->current_offset += (off64_t) read_count;
+
+	return( read_count );
+}
+
+/* Reads (partition) data at a specific offset into a buffer
+ * Unlike libvsmbr_partition_read_buffer_at_offset the current offset of the partition
+ * is not changed, which allows reading alongside a caller of the partition
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libvsmbr_internal_partition_read_buffer_at_offset(
+         libvsmbr_internal_partition_t *internal_partition,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_internal_partition_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	if( internal_partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_partition->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_count = libvsmbr_internal_partition_read_buffer_at_offset_from_file_io_handle(
+	              internal_partition,
+	              internal_partition->file_io_handle,
+	              buffer,
+	              buffer_size,
+	              offset,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_partition->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Reads (partition) data at the current offset into a buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libvsmbr_partition_read_buffer(
+         libvsmbr_partition_t *partition,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libvsmbr_internal_partition_t *internal_partition = NULL;
+	static char *function                             = "libvsmbr_partition_read_buffer";
+	ssize_t read_count                                = 0;
+
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	internal_partition = (libvsmbr_internal_partition_t *) partition;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_partition->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_count = libvsmbr_internal_partition_read_buffer_from_file_io_handle(
+		      internal_partition,
+		      internal_partition->file_io_handle,
+		      buffer,
+		      buffer_size,
+		      error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer from partition.",
+		 function );
+
+		read_count = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_partition->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Reads (partition) data at a specific offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libvsmbr_partition_read_buffer_at_offset(
+         libvsmbr_partition_t *partition,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libvsmbr_internal_partition_t *internal_partition = NULL;
+	static char *function                             = "libvsmbr_partition_read_buffer_at_offset";
+	ssize_t read_count                                = 0;
+
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	internal_partition = (libvsmbr_internal_partition_t *) partition;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_partition->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libvsmbr_internal_partition_seek_offset(
+	     internal_partition,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libvsmbr_internal_partition_read_buffer_from_file_io_handle(
+		      internal_partition,
+		      internal_partition->file_io_handle,
+		      buffer,
+		      buffer_size,
+		      error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_partition->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_partition->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Writes (partition) data at the current offset from a buffer using a Basic File IO (bfio) handle
+ * The data is stored in the write cache of the volume until it is flushed
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libvsmbr_internal_partition_write_buffer_to_file_io_handle(
+         libvsmbr_internal_partition_t *internal_partition,
+         libbfio_handle_t *file_io_handle,
+         const void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_internal_partition_write_buffer_to_file_io_handle";
+
+	if( internal_partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_partition->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid partition - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_partition->io_handle->access_flags & LIBVSMBR_ACCESS_FLAG_WRITE ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid partition - volume not opened for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_partition->current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition - current offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == 0 )
+	{
+		return( 0 );
+	}
+	/* Data is never written beyond the end of the partition
+	 */
+	if( (size64_t) internal_partition->current_offset >= internal_partition->size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( internal_partition->size - internal_partition->current_offset ) )
+	{
+		buffer_size = (size_t) ( internal_partition->size - internal_partition->current_offset );
+	}
+	if( libvsmbr_write_cache_write_buffer(
+	     internal_partition->io_handle->write_cache,
+	     file_io_handle,
+	     internal_partition->io_handle->bytes_per_sector,
+	     internal_partition->offset + internal_partition->current_offset,
+	     (const uint8_t *) buffer,
+	     buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data to write cache.",
+		 function );
+
+		return( -1 );
+	}
+	/* The sparse map no longer reflects the data
+	 */
+	if( internal_partition->sparse_map != NULL )
+	{
+		if( libvsmbr_sparse_map_free(
+		     &( internal_partition->sparse_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sparse map.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_partition->current_offset += (off64_t) buffer_size;
+
+	return( (ssize_t) buffer_size );
+}
+
+/* Writes (partition) data at the current offset from a buffer
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libvsmbr_partition_write_buffer(
+         libvsmbr_partition_t *partition,
+         const void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libvsmbr_internal_partition_t *internal_partition = NULL;
+	static char *function                             = "libvsmbr_partition_write_buffer";
+	ssize_t write_count                               = 0;
+
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	internal_partition = (libvsmbr_internal_partition_t *) partition;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_partition->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	write_count = libvsmbr_internal_partition_write_buffer_to_file_io_handle(
+		       internal_partition,
+		       internal_partition->file_io_handle,
+		       buffer,
+		       buffer_size,
+		       error );
+
+	if( write_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer to partition.",
+		 function );
+
+		write_count = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_partition->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( write_count );
+}
+
+/* Writes (partition) data at a specific offset
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libvsmbr_partition_write_buffer_at_offset(
+         libvsmbr_partition_t *partition,
+         const void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libvsmbr_internal_partition_t *internal_partition = NULL;
+	static char *function                             = "libvsmbr_partition_write_buffer_at_offset";
+	ssize_t write_count                               = 0;
+
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	internal_partition = (libvsmbr_internal_partition_t *) partition;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_partition->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libvsmbr_internal_partition_seek_offset(
+	     internal_partition,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = libvsmbr_internal_partition_write_buffer_to_file_io_handle(
+		       internal_partition,
+		       internal_partition->file_io_handle,
+		       buffer,
+		       buffer_size,
+		       error );
+
+	if( write_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_partition->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( write_count );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_partition->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Flushes the written (partition) data
+ * The dirty blocks of the volume are written in order of offset, where
+ * adjacent blocks are merged into a single write
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_partition_flush(
+     libvsmbr_partition_t *partition,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_partition_t *internal_partition = NULL;
+	static char *function                             = "libvsmbr_partition_flush";
+
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	internal_partition = (libvsmbr_internal_partition_t *) partition;
+
+	/* The file IO handle of the partition does not change after
+	 * initialization and the write cache has its own lock
+	 */
+	if( ( internal_partition->io_handle->access_flags & LIBVSMBR_ACCESS_FLAG_WRITE ) == 0 )
+	{
+		return( 1 );
+	}
+	if( libvsmbr_write_cache_flush(
+	     internal_partition->io_handle->write_cache,
+	     internal_partition->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush write cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Seeks a certain offset of the (partition) data
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libvsmbr_internal_partition_seek_offset(
+         libvsmbr_internal_partition_t *internal_partition,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_internal_partition_seek_offset";
+
+	if( internal_partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += internal_partition->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) internal_partition->size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_partition->current_offset = offset;
+
+	return( offset );
+}
+
+/* Seeks a certain offset of the (partition) data
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libvsmbr_partition_seek_offset(
+         libvsmbr_partition_t *partition,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libvsmbr_internal_partition_t *internal_partition = NULL;
+	static char *function                             = "libvsmbr_partition_seek_offset";
+
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	internal_partition = (libvsmbr_internal_partition_t *) partition;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_partition->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	offset = libvsmbr_internal_partition_seek_offset(
+	          internal_partition,
+	          offset,
+	          whence,
+	          error );
+
+	if( offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		offset = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_partition->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( offset );
+}
+
+/* Retrieves the current offset
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_partition_get_offset(
+     libvsmbr_partition_t *partition,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_partition_t *internal_partition = NULL;
+	static char *function                             = "libvsmbr_partition_get_offset";
+
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	internal_partition = (libvsmbr_internal_partition_t *) partition;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_partition->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*offset = internal_partition->current_offset;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_partition->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the partition size
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_partition_get_size(
+     libvsmbr_partition_t *partition,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_partition_t *internal_partition = NULL;
+	static char *function                             = "libvsmbr_partition_get_size";
+
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	internal_partition = (libvsmbr_internal_partition_t *) partition;
+
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_partition->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*size = internal_partition->size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_partition->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Adds the sectors of a block that was read by a scan to the cache arena
+ * The sectors are inserted with low priority so that the scan does not evict
+ * the sectors that are in use, sectors that are already cached are not replaced
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_partition_insert_block_in_cache_arena(
+     libvsmbr_internal_partition_t *internal_partition,
+     off64_t block_offset,
+     const uint8_t *block_data,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	static char *function  = "libvsmbr_internal_partition_insert_block_in_cache_arena";
+	off64_t block_end      = 0;
+	off64_t sector_offset  = 0;
+	uint32_t sector_size   = 0;
+	uint8_t evicted_blocks = 0;
+
+	if( internal_partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_partition->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid partition - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_partition->cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid partition - missing cache arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block data.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid block size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	sector_size = internal_partition->io_handle->bytes_per_sector;
+
+	if( sector_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition - bytes per sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	block_end = block_offset + (off64_t) block_size;
+
+	/* Only the sectors that are fully contained in the block are cached
+	 */
+	sector_offset = block_offset;
+
+	if( ( sector_offset % sector_size ) != 0 )
+	{
+		sector_offset += sector_size - ( sector_offset % sector_size );
+	}
+	while( ( sector_offset + sector_size ) <= block_end )
+	{
+		if( libvsmbr_cache_arena_insert_block(
+		     internal_partition->cache_arena,
+		     internal_partition->cache_arena_owner_identifier,
+		     sector_offset,
+		     &( block_data[ sector_offset - block_offset ] ),
+		     (size_t) sector_size,
+		     LIBVSMBR_CACHE_ARENA_INSERT_FLAG_LOW_PRIORITY,
+		     &evicted_blocks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert sector data at offset: %" PRIi64 " (0x%08" PRIx64 ") in cache arena.",
+			 function,
+			 sector_offset,
+			 sector_offset );
+
+			return( -1 );
+		}
+		sector_offset += sector_size;
+	}
+	return( 1 );
+}
+
+/* Scans the (partition) data for blocks that only contain 0-byte values
+ * Blocks that are within a range of the sparse map of a previous scan are not read again
+ * The blocks are read directly from the file IO handle, like the entropy map does,
+ * so that the scan does not evict the sector cache, unless there are dirty blocks
+ * in the write cache that take precedence over the data in the file IO handle
+ * If a cache arena is set the sectors of the blocks that contain data are added
+ * to it with low priority, so that a subsequent read of that data is a cache hit
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_partition_scan_sparse_map(
+     libvsmbr_internal_partition_t *internal_partition,
+     uint32_t block_size,
+     libvsmbr_sparse_map_t **sparse_map,
+     libcerror_error_t **error )
+{
+	libvsmbr_sparse_map_t *safe_sparse_map = NULL;
+	uint8_t *block_data                    = NULL;
+	static char *function                  = "libvsmbr_internal_partition_scan_sparse_map";
+	size64_t sparse_range_size             = 0;
+	size_t read_size                       = 0;
+	ssize_t read_count                     = 0;
+	off64_t block_offset                   = 0;
+	off64_t sparse_range_offset            = 0;
+	int number_of_dirty_blocks             = 0;
+	int result                             = 0;
+
+	if( internal_partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( sparse_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sparse map.",
+		 function );
+
+		return( -1 );
+	}
+	/* Synchronize first since this empties the sparse map of a previous scan
+	 * if dirty blocks were flushed since it was created
+	 */
+	if( libvsmbr_internal_partition_synchronize_write_cache(
+	     internal_partition,
+	     &number_of_dirty_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to synchronize with write cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_sparse_map_initialize(
+	     &safe_sparse_map,
+	     block_size,
+	     internal_partition->size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sparse map.",
+		 function );
+
+		return( -1 );
+	}
+	block_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * block_size );
+
+	if( block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block data.",
+		 function );
+
+		goto on_error;
+	}
+	while( (size64_t) block_offset < internal_partition->size )
+	{
+		read_size = (size_t) block_size;
+
+		if( (size64_t) read_size > ( internal_partition->size - (size64_t) block_offset ) )
+		{
+			read_size = (size_t) ( internal_partition->size - (size64_t) block_offset );
+		}
+		result = 0;
+
+		if( internal_partition->sparse_map != NULL )
+		{
+			result = libvsmbr_sparse_map_get_range_at_offset(
+			          internal_partition->sparse_map,
+			          block_offset,
+			          &sparse_range_offset,
+			          &sparse_range_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sparse range at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 block_offset,
+				 block_offset );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				/* The block is only known to be sparse if the range covers all of it
+				 */
+				sparse_range_size -= (size64_t) ( block_offset - sparse_range_offset );
+
+				if( sparse_range_size < (size64_t) read_size )
+				{
+					result = 0;
+				}
+			}
+		}
+		if( result == 0 )
+		{
+			if( number_of_dirty_blocks == 0 )
+			{
+				if( libvsmbr_internal_partition_read_data_from_file_io_handle(
+				     internal_partition,
+				     internal_partition->file_io_handle,
+				     block_data,
+				     read_size,
+				     internal_partition->offset + block_offset,
+				     error ) != 1 )
+				{
+					read_count = -1;
+				}
+				else
+				{
+					read_count = (ssize_t) read_size;
+				}
+			}
+			else
+			{
+				read_count = libvsmbr_internal_partition_read_buffer_at_offset_from_file_io_handle(
+				              internal_partition,
+				              internal_partition->file_io_handle,
+				              block_data,
+				              read_size,
+				              block_offset,
+				              error );
+			}
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 block_offset,
+				 block_offset );
+
+				goto on_error;
+			}
+			result = libvsmbr_sparse_map_data_is_zero(
+			          block_data,
+			          read_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to determine if block at offset: %" PRIi64 " (0x%08" PRIx64 ") is sparse.",
+				 function,
+				 block_offset,
+				 block_offset );
+
+				goto on_error;
+			}
+			/* The data read with dirty blocks in the write cache does not
+			 * correspond with the file IO handle and is not cached
+			 */
+			if( ( result == 0 )
+			 && ( number_of_dirty_blocks == 0 )
+			 && ( internal_partition->cache_arena != NULL ) )
+			{
+				if( libvsmbr_internal_partition_insert_block_in_cache_arena(
+				     internal_partition,
+				     block_offset,
+				     block_data,
+				     read_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to insert block at offset: %" PRIi64 " (0x%08" PRIx64 ") in cache arena.",
+					 function,
+					 block_offset,
+					 block_offset );
+
+					goto on_error;
+				}
+			}
+		}
+		if( result != 0 )
+		{
+			if( libvsmbr_sparse_map_append_range(
+			     safe_sparse_map,
+			     block_offset,
+			     (size64_t) read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append sparse range at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 block_offset,
+				 block_offset );
+
+				goto on_error;
+			}
+		}
+		block_offset += read_size;
+	}
+	memory_free(
+	 block_data );
+
+	*sparse_map = safe_sparse_map;
+
+	return( 1 );
+
+on_error:
+	if( block_data != NULL )
+	{
+		memory_free(
+		 block_data );
+	}
+	if( safe_sparse_map != NULL )
+	{
+		libvsmbr_sparse_map_free(
+		 &safe_sparse_map,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the sparse map of the partition
+ * The sparse map contains the ranges of blocks that only contain 0-byte values
+ * The partition retains the result of the most recent scan, so that a repeated
+ * request with the same block size does not scan the data again
+ * If a cache arena is set the data that is scanned and not sparse is added to it
+ * with low priority, other caches are not populated by the scan
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_partition_get_sparse_map(
+     libvsmbr_partition_t *partition,
+     uint32_t block_size,
+     libvsmbr_sparse_map_t **sparse_map,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_partition_t *internal_partition = NULL;
+	libvsmbr_sparse_map_t *scanned_sparse_map         = NULL;
+	static char *function                             = "libvsmbr_partition_get_sparse_map";
+	uint32_t sparse_map_block_size                    = 0;
+	int number_of_dirty_blocks                        = 0;
+
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	internal_partition = (libvsmbr_internal_partition_t *) partition;
+
+	if( sparse_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sparse map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sparse_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sparse map value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_partition->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libvsmbr_internal_partition_synchronize_write_cache(
+	     internal_partition,
+	     &number_of_dirty_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to synchronize with write cache.",
+		 function );
+
+		goto on_error;
+	}
+	/* A retained sparse map could predate dirty blocks written using
+	 * another partition of the volume
+	 */
+	if( ( internal_partition->sparse_map != NULL )
+	 && ( number_of_dirty_blocks == 0 ) )
+	{
+		if( libvsmbr_sparse_map_get_block_size(
+		     internal_partition->sparse_map,
+		     &sparse_map_block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sparse map block size.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( internal_partition->sparse_map == NULL )
+	 || ( sparse_map_block_size != block_size ) )
+	{
+		if( libvsmbr_internal_partition_scan_sparse_map(
+		     internal_partition,
+		     block_size,
+		     &scanned_sparse_map,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan sparse map.",
+			 function );
+
+			goto on_error;
+		}
+		if( internal_partition->sparse_map != NULL )
+		{
+			if( libvsmbr_sparse_map_free(
+			     &( internal_partition->sparse_map ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sparse map.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		internal_partition->sparse_map = scanned_sparse_map;
+		scanned_sparse_map             = NULL;
+	}
+	if( libvsmbr_sparse_map_clone(
+	     sparse_map,
+	     internal_partition->sparse_map,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sparse map.",
 		 function );
 
-		offset = -1;
+		goto on_error;
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -906,24 +3324,46 @@ off64_t libvsmbr_partition_seek_offset(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
+		libvsmbr_sparse_map_free(
+		 sparse_map,
+		 NULL );
+
 		return( -1 );
 	}
 #endif
-	return( offset );
+	return( 1 );
+
+on_error:
+	if( scanned_sparse_map != NULL )
+	{
+		libvsmbr_sparse_map_free(
+		 &scanned_sparse_map,
+		 NULL );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_partition->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Retrieves the current offset
- * Returns 1 if successful or -1 on error
+#if !defined( WINAPI ) || defined( __CYGWIN__ )
+
+/* Opens a separate file descriptor of the file that contains the partition
+ * This is only possible if the volume was opened by filename
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libvsmbr_partition_get_offset(
-     libvsmbr_partition_t *partition,
-     off64_t *offset,
+int libvsmbr_internal_partition_open_source_file_descriptor(
+     libvsmbr_internal_partition_t *internal_partition,
+     int *file_descriptor,
      libcerror_error_t **error )
 {
-	libvsmbr_internal_partition_t *internal_partition = NULL;
-	static char *function                             = "libvsmbr_partition_get_offset";
+	char *filename        = NULL;
+	static char *function = "libvsmbr_internal_partition_open_source_file_descriptor";
+	size_t filename_size  = 0;
 
-	if( partition == NULL )
+	if( internal_partition == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -934,64 +3374,141 @@ int libvsmbr_partition_get_offset(
 
 		return( -1 );
 	}
-	internal_partition = (libvsmbr_internal_partition_t *) partition;
-
-	if( offset == NULL )
+	if( file_descriptor == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offset.",
+		 "%s: invalid file descriptor.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_partition->read_write_lock,
+	*file_descriptor = -1;
+
+	if( ( internal_partition->file_io_handle == NULL )
+	 || ( internal_partition->file_io_handle_is_file == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libbfio_file_get_name_size(
+	     internal_partition->file_io_handle,
+	     &filename_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename size.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	*offset = internal_partition->current_offset;
+	if( ( filename_size == 0 )
+	 || ( filename_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename size value out of bounds.",
+		 function );
 
-#if defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_partition->read_write_lock,
+		goto on_error;
+	}
+	filename = narrow_string_allocate(
+	            filename_size );
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_get_name(
+	     internal_partition->file_io_handle,
+	     filename,
+	     filename_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
+	if( libvsmbr_file_descriptor_open_read(
+	     file_descriptor,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open source file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 filename );
+
 	return( 1 );
+
+on_error:
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	return( -1 );
 }
 
-/* Retrieves the partition size
+#endif /* !defined( WINAPI ) || defined( __CYGWIN__ ) */
+
+/* Exports the partition data to a file descriptor at a specific file offset
+ * If the file descriptor refers to a regular file ranges of all-zero blocks are
+ * written as holes and, if the volume was opened by filename, data is copied by
+ * the kernel. Otherwise the data is copied using large aligned buffered reads
  * Returns 1 if successful or -1 on error
  */
-int libvsmbr_partition_get_size(
+int libvsmbr_partition_export_to_file_descriptor(
      libvsmbr_partition_t *partition,
-     size64_t *size,
+     int file_descriptor,
+     off64_t file_offset,
      libcerror_error_t **error )
 {
+	static char *function                             = "libvsmbr_partition_export_to_file_descriptor";
+
+#if !defined( WINAPI ) || defined( __CYGWIN__ )
 	libvsmbr_internal_partition_t *internal_partition = NULL;
-	static char *function                             = "libvsmbr_partition_get_size";
+	uint8_t *buffer                                   = NULL;
+	size64_t data_size                                = 0;
+	size_t block_offset                               = 0;
+	size_t block_size                                 = 0;
+	size_t read_size                                  = 0;
+	size_t run_offset                                 = 0;
+	ssize_t read_count                                = 0;
+	off64_t data_offset                               = 0;
+	off64_t export_offset                             = 0;
+	off64_t source_offset                             = 0;
+	int block_is_zero                                 = 0;
+	int is_regular_file                               = 0;
+	int result                                        = 0;
+	int run_is_zero                                   = 0;
+	int source_file_descriptor                        = -1;
+#endif
 
 	if( partition == NULL )
 	{
@@ -1004,51 +3521,453 @@ int libvsmbr_partition_get_size(
 
 		return( -1 );
 	}
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: file descriptors are not supported on this platform.",
+	 function );
+
+	return( -1 );
+#else
 	internal_partition = (libvsmbr_internal_partition_t *) partition;
 
-	if( size == NULL )
+	if( internal_partition->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid partition - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_descriptor < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid size.",
+		 "%s: invalid file descriptor.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_partition->read_write_lock,
-	     error ) != 1 )
+	if( ( file_offset < 0 )
+	 || ( internal_partition->size > (size64_t) ( INT64_MAX - file_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The data is exported directly from the file IO handle
+	 * so dirty blocks are written first
+	 */
+	if( ( internal_partition->io_handle->access_flags & LIBVSMBR_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		if( libvsmbr_write_cache_flush(
+		     internal_partition->io_handle->write_cache,
+		     internal_partition->file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	is_regular_file = libvsmbr_file_descriptor_is_regular_file(
+	                   file_descriptor,
+	                   error );
+
+	if( is_regular_file == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file descriptor is a regular file.",
+		 function );
+
+		goto on_error;
+	}
+	/* The offset and size of the partition and its file IO handle do not change
+	 * after initialization so no lock is held while exporting
+	 */
+	if( is_regular_file != 0 )
+	{
+		/* If the source file cannot be opened separately the buffered copy is used
+		 */
+		if( libvsmbr_internal_partition_open_source_file_descriptor(
+		     internal_partition,
+		     &source_file_descriptor,
+		     NULL ) != 1 )
+		{
+			source_file_descriptor = -1;
+		}
+	}
+	while( (size64_t) export_offset < internal_partition->size )
+	{
+		if( internal_partition->io_handle->abort != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
+
+			goto on_error;
+		}
+		source_offset = internal_partition->offset + export_offset;
+
+		if( source_file_descriptor != -1 )
+		{
+			result = libvsmbr_file_descriptor_get_data_range(
+			          source_file_descriptor,
+			          source_offset,
+			          internal_partition->size - export_offset,
+			          &data_offset,
+			          &data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data range at offset: %" PRIi64 ".",
+				 function,
+				 source_offset );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				data_offset = internal_partition->offset + (off64_t) internal_partition->size;
+				data_size   = 0;
+			}
+			/* Holes in the source file are punched in the destination file
+			 */
+			if( data_offset > source_offset )
+			{
+				result = libvsmbr_file_descriptor_punch_hole(
+				          file_descriptor,
+				          file_offset + export_offset,
+				          (size64_t) ( data_offset - source_offset ),
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to punch hole at offset: %" PRIi64 ".",
+					 function,
+					 file_offset + export_offset );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					libvsmbr_file_descriptor_close(
+					 &source_file_descriptor,
+					 NULL );
+
+					continue;
+				}
+				export_offset += data_offset - source_offset;
+			}
+			if( data_size > 0 )
+			{
+				result = libvsmbr_file_descriptor_copy_range(
+				          source_file_descriptor,
+				          data_offset,
+				          file_descriptor,
+				          file_offset + export_offset,
+				          data_size,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to copy data at offset: %" PRIi64 ".",
+					 function,
+					 data_offset );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					libvsmbr_file_descriptor_close(
+					 &source_file_descriptor,
+					 NULL );
+
+					continue;
+				}
+				export_offset += (off64_t) data_size;
+			}
+			continue;
+		}
+		if( buffer == NULL )
+		{
+			buffer = (uint8_t *) memory_allocate(
+			                      sizeof( uint8_t ) * LIBVSMBR_EXPORT_BUFFER_SIZE );
+
+			if( buffer == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create buffer.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* Align the reads to the buffer size so that all but the first read
+		 * are aligned on the source
+		 */
+		read_size = LIBVSMBR_EXPORT_BUFFER_SIZE - (size_t) ( source_offset % LIBVSMBR_EXPORT_BUFFER_SIZE );
+
+		if( (size64_t) read_size > ( internal_partition->size - export_offset ) )
+		{
+			read_size = (size_t) ( internal_partition->size - export_offset );
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              internal_partition->file_io_handle,
+		              buffer,
+		              read_size,
+		              source_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 source_offset,
+			 source_offset );
+
+			goto on_error;
+		}
+		/* Write runs of blocks that are either all-zero or not
+		 */
+		run_offset  = 0;
+		run_is_zero = 0;
+
+		for( block_offset = 0;
+		     block_offset <= read_size;
+		     block_offset += block_size )
+		{
+			block_is_zero = 0;
+			block_size    = LIBVSMBR_EXPORT_SPARSE_BLOCK_SIZE;
+
+			if( block_offset < read_size )
+			{
+				if( block_size > ( read_size - block_offset ) )
+				{
+					block_size = read_size - block_offset;
+				}
+				if( is_regular_file != 0 )
+				{
+					block_is_zero = libvsmbr_sparse_map_data_is_zero(
+					                 &( buffer[ block_offset ] ),
+					                 block_size,
+					                 error );
+
+					if( block_is_zero == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to determine if block is all-zero.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				if( block_offset == 0 )
+				{
+					run_is_zero = block_is_zero;
+				}
+			}
+			if( ( block_offset > run_offset )
+			 && ( ( block_offset == read_size )
+			  ||  ( block_is_zero != run_is_zero ) ) )
+			{
+				result = 0;
+
+				if( run_is_zero != 0 )
+				{
+					result = libvsmbr_file_descriptor_punch_hole(
+					          file_descriptor,
+					          file_offset + export_offset + run_offset,
+					          (size64_t) ( block_offset - run_offset ),
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_WRITE_FAILED,
+						 "%s: unable to punch hole at offset: %" PRIi64 ".",
+						 function,
+						 file_offset + export_offset + run_offset );
+
+						goto on_error;
+					}
+				}
+				if( result == 0 )
+				{
+					if( libvsmbr_file_descriptor_write_buffer_at_offset(
+					     file_descriptor,
+					     &( buffer[ run_offset ] ),
+					     block_offset - run_offset,
+					     file_offset + export_offset + run_offset,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_WRITE_FAILED,
+						 "%s: unable to write data at offset: %" PRIi64 ".",
+						 function,
+						 file_offset + export_offset + run_offset );
+
+						goto on_error;
+					}
+				}
+				run_offset  = block_offset;
+				run_is_zero = block_is_zero;
+			}
+			if( block_offset == read_size )
+			{
+				break;
+			}
+		}
+		export_offset += (off64_t) read_size;
+	}
+	/* Holes at the end of a regular file are only retained if the file is large enough
+	 */
+	if( is_regular_file != 0 )
+	{
+		if( libvsmbr_file_descriptor_extend_size(
+		     file_descriptor,
+		     (size64_t) file_offset + internal_partition->size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to extend file size.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( source_file_descriptor != -1 )
+	{
+		if( libvsmbr_file_descriptor_close(
+		     &source_file_descriptor,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close source file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( source_file_descriptor != -1 )
+	{
+		libvsmbr_file_descriptor_close(
+		 &source_file_descriptor,
+		 NULL );
+	}
+	return( -1 );
+#endif /* defined( WINAPI ) && !defined( __CYGWIN__ ) */
+}
+
+/* Retrieves a snapshot of the statistics of the partition
+ * The counters are updated atomically hence the read/write lock is not
+ * grabbed and a concurrent read is not blocked
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_partition_get_statistics(
+     libvsmbr_partition_t *partition,
+     libvsmbr_statistics_t **statistics,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_partition_t *internal_partition = NULL;
+	static char *function                             = "libvsmbr_partition_get_statistics";
+
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	*size = internal_partition->size;
+	internal_partition = (libvsmbr_internal_partition_t *) partition;
 
-#if defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_partition->read_write_lock,
+	if( libvsmbr_statistics_clone(
+	     statistics,
+	     internal_partition->statistics,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics.",
 		 function );
 
 		return( -1 );
 	}
-#endif
 	return( 1 );
 }
 
@@ -33,6 +33,9 @@
 #include "libvsmbr_libfcache.h"
 #include "libvsmbr_libfdata.h"
 #include "libvsmbr_partition_values.h"
+#include "libvsmbr_sector_data.h"
+#include "libvsmbr_sparse_map.h"
+#include "libvsmbr_statistics.h"
 #include "libvsmbr_types.h"
 
 #if defined( __cplusplus )
@@ -43,10 +46,18 @@ typedef struct libvsmbr_internal_partition libvsmbr_internal_partition_t;
 
 struct libvsmbr_internal_partition
 {
+	/* The IO handle
+	 */
+	libvsmbr_io_handle_t *io_handle;
+
 	/* The file IO handle
 	 */
 	libbfio_handle_t *file_io_handle;
 
+	/* Value to indicate the file IO handle is a file created by the volume
+	 */
+	uint8_t file_io_handle_is_file;
+
 	/* The partition values
 	 */
 	libvsmbr_partition_values_t *partition_values;
@@ -59,6 +70,14 @@ struct libvsmbr_internal_partition
 	 */
 	libfcache_cache_t *sectors_cache;
 
+	/* The cache arena, which is used instead of the sectors cache if set
+	 */
+	libvsmbr_cache_arena_t *cache_arena;
+
+	/* The identifier of the partition in the cache arena
+	 */
+	uint32_t cache_arena_owner_identifier;
+
 	/* The current offset
 	 */
 	off64_t current_offset;
@@ -71,6 +90,24 @@ struct libvsmbr_internal_partition
 	 */
 	size64_t size;
 
+	/* The sparse map of the most recent scan
+	 */
+	libvsmbr_sparse_map_t *sparse_map;
+
+	/* The statistics
+	 */
+	libvsmbr_statistics_t *statistics;
+
+	/* The index of the partition in the volume, which identifies
+	 * the partition in trace records
+	 */
+	int partition_index;
+
+	/* The generation of the write cache the sectors cache and sparse map
+	 * correspond with
+	 */
+	uint32_t write_cache_generation;
+
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -90,6 +127,34 @@ int libvsmbr_partition_free(
      libvsmbr_partition_t **partition,
      libcerror_error_t **error );
 
+int libvsmbr_internal_partition_read_sector_data(
+     libvsmbr_internal_partition_t *internal_partition,
+     libbfio_handle_t *file_io_handle,
+     libvsmbr_sector_data_t *sector_data,
+     off64_t sector_offset,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_partition_read_data_from_file_io_handle(
+     libvsmbr_internal_partition_t *internal_partition,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *data,
+     size_t data_size,
+     off64_t data_offset,
+     libcerror_error_t **error );
+
+int libvsmbr_partition_read_element_data(
+     libvsmbr_internal_partition_t *internal_partition,
+     libbfio_handle_t *file_io_handle,
+     libfdata_vector_t *vector,
+     libfdata_cache_t *cache,
+     int element_index,
+     int element_data_file_index,
+     off64_t element_data_offset,
+     size64_t element_data_size,
+     uint32_t element_data_flags,
+     uint8_t read_flags,
+     libcerror_error_t **error );
+
 LIBVSMBR_EXTERN \
 int libvsmbr_partition_get_type(
      libvsmbr_partition_t *partition,
@@ -102,6 +167,33 @@ int libvsmbr_partition_get_volume_offset(
      off64_t *volume_offset,
      libcerror_error_t **error );
 
+int libvsmbr_internal_partition_set_cache_arena(
+     libvsmbr_internal_partition_t *internal_partition,
+     libvsmbr_cache_arena_t *cache_arena,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_partition_synchronize_write_cache(
+     libvsmbr_internal_partition_t *internal_partition,
+     int *number_of_dirty_blocks,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_partition_read_from_cache_arena(
+     libvsmbr_internal_partition_t *internal_partition,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     uint8_t *buffer,
+     size_t buffer_size,
+     size_t *read_size,
+     libcerror_error_t **error );
+
+ssize_t libvsmbr_internal_partition_read_buffer_at_offset_from_file_io_handle(
+         libvsmbr_internal_partition_t *internal_partition,
+         libbfio_handle_t *file_io_handle,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 ssize_t libvsmbr_internal_partition_read_buffer_from_file_io_handle(
          libvsmbr_internal_partition_t *internal_partition,
          libbfio_handle_t *file_io_handle,
@@ -109,6 +201,13 @@ ssize_t libvsmbr_internal_partition_read_buffer_from_file_io_handle(
          size_t buffer_size,
          libcerror_error_t **error );
 
+ssize_t libvsmbr_internal_partition_read_buffer_at_offset(
+         libvsmbr_internal_partition_t *internal_partition,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 LIBVSMBR_EXTERN \
 ssize_t libvsmbr_partition_read_buffer(
          libvsmbr_partition_t *partition,
@@ -124,6 +223,33 @@ ssize_t libvsmbr_partition_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+ssize_t libvsmbr_internal_partition_write_buffer_to_file_io_handle(
+         libvsmbr_internal_partition_t *internal_partition,
+         libbfio_handle_t *file_io_handle,
+         const void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+ssize_t libvsmbr_partition_write_buffer(
+         libvsmbr_partition_t *partition,
+         const void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+ssize_t libvsmbr_partition_write_buffer_at_offset(
+         libvsmbr_partition_t *partition,
+         const void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_partition_flush(
+     libvsmbr_partition_t *partition,
+     libcerror_error_t **error );
+
 off64_t libvsmbr_internal_partition_seek_offset(
          libvsmbr_internal_partition_t *internal_partition,
          off64_t offset,
@@ -149,6 +275,48 @@ int libvsmbr_partition_get_size(
      size64_t *size,
      libcerror_error_t **error );
 
+int libvsmbr_internal_partition_insert_block_in_cache_arena(
+     libvsmbr_internal_partition_t *internal_partition,
+     off64_t block_offset,
+     const uint8_t *block_data,
+     size_t block_size,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_partition_scan_sparse_map(
+     libvsmbr_internal_partition_t *internal_partition,
+     uint32_t block_size,
+     libvsmbr_sparse_map_t **sparse_map,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_partition_get_sparse_map(
+     libvsmbr_partition_t *partition,
+     uint32_t block_size,
+     libvsmbr_sparse_map_t **sparse_map,
+     libcerror_error_t **error );
+
+#if !defined( WINAPI ) || defined( __CYGWIN__ )
+
+int libvsmbr_internal_partition_open_source_file_descriptor(
+     libvsmbr_internal_partition_t *internal_partition,
+     int *file_descriptor,
+     libcerror_error_t **error );
+
+#endif /* !defined( WINAPI ) || defined( __CYGWIN__ ) */
+
+LIBVSMBR_EXTERN \
+int libvsmbr_partition_export_to_file_descriptor(
+     libvsmbr_partition_t *partition,
+     int file_descriptor,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_partition_get_statistics(
+     libvsmbr_partition_t *partition,
+     libvsmbr_statistics_t **statistics,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
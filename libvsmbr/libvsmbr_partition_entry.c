@@ -348,3 +348,129 @@ on_error:
 #endif
 }
 
+/* Writes a partition entry
+ * The CHS addresses are derived from the LBA using a geometry of 255 heads
+ * and 63 sectors per track, addresses beyond 1023 cylinders are stored as
+ * the maximum CHS address
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_partition_entry_write_data(
+     libvsmbr_partition_entry_t *partition_entry,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *chs_address_data = NULL;
+	static char *function     = "libvsmbr_partition_entry_write_data";
+	uint64_t cylinder         = 0;
+	uint64_t lba              = 0;
+	uint32_t head             = 0;
+	uint32_t sector           = 0;
+	int address_index         = 0;
+
+	if( partition_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size != sizeof( vsmbr_partition_entry_t) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     data,
+	     0,
+	     sizeof( vsmbr_partition_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_entry->type == 0 )
+	{
+		/* An unused partition entry is stored as all zero bytes
+		 */
+		return( 1 );
+	}
+	( (vsmbr_partition_entry_t *) data )->flags = partition_entry->flags;
+
+	( (vsmbr_partition_entry_t *) data )->type = partition_entry->type;
+
+	for( address_index = 0;
+	     address_index < 2;
+	     address_index++ )
+	{
+		if( address_index == 0 )
+		{
+			chs_address_data = ( (vsmbr_partition_entry_t *) data )->start_address_chs;
+
+			lba = (uint64_t) partition_entry->start_address_lba;
+		}
+		else
+		{
+			chs_address_data = ( (vsmbr_partition_entry_t *) data )->end_address_chs;
+
+			lba = (uint64_t) partition_entry->start_address_lba + partition_entry->number_of_sectors;
+
+			if( lba > 0 )
+			{
+				lba -= 1;
+			}
+		}
+		cylinder = lba / ( 255 * 63 );
+		head     = (uint32_t) ( ( lba / 63 ) % 255 );
+		sector   = (uint32_t) ( lba % 63 ) + 1;
+
+		if( cylinder > 1023 )
+		{
+			chs_address_data[ 0 ] = 0xfe;
+			chs_address_data[ 1 ] = 0xff;
+			chs_address_data[ 2 ] = 0xff;
+		}
+		else
+		{
+			chs_address_data[ 0 ] = (uint8_t) head;
+			chs_address_data[ 1 ] = (uint8_t) ( ( ( cylinder >> 2 ) & 0xc0 ) | sector );
+			chs_address_data[ 2 ] = (uint8_t) ( cylinder & 0xff );
+		}
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (vsmbr_partition_entry_t *) data )->start_address_lba,
+	 partition_entry->start_address_lba );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (vsmbr_partition_entry_t *) data )->number_of_sectors,
+	 partition_entry->number_of_sectors );
+
+	return( 1 );
+}
+
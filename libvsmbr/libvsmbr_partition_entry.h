@@ -70,6 +70,12 @@ int libvsmbr_partition_entry_read_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int libvsmbr_partition_entry_write_data(
+     libvsmbr_partition_entry_t *partition_entry,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
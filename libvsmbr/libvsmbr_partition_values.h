@@ -43,6 +43,10 @@ struct libvsmbr_partition_values
 	 */
 	off64_t partition_record_offset;
 
+	/* The index of the partition entry in the partition record
+	 */
+	uint8_t partition_entry_index;
+
 	/* The sector number
 	 */
 	uint32_t sector_number;
@@ -0,0 +1,790 @@
+/*
+ * Pooled IO handle functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsmbr_handle_pool.h"
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_pooled_io_handle.h"
+#include "libvsmbr_types.h"
+#include "libvsmbr_unused.h"
+
+/* Creates a pooled IO handle
+ * Make sure the value pooled_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_pooled_io_handle_initialize(
+     libvsmbr_pooled_io_handle_t **pooled_io_handle,
+     libvsmbr_handle_pool_t *handle_pool,
+     int pool_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_pooled_io_handle_initialize";
+
+	if( pooled_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pooled IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pooled_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pooled IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( pool_entry < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid pool entry value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	*pooled_io_handle = memory_allocate_structure(
+	                     libvsmbr_pooled_io_handle_t );
+
+	if( *pooled_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pooled IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *pooled_io_handle,
+	     0,
+	     sizeof( libvsmbr_pooled_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear pooled IO handle.",
+		 function );
+
+		memory_free(
+		 *pooled_io_handle );
+
+		*pooled_io_handle = NULL;
+
+		return( -1 );
+	}
+	( *pooled_io_handle )->handle_pool = handle_pool;
+	( *pooled_io_handle )->pool_entry  = pool_entry;
+
+	return( 1 );
+}
+
+/* Creates a pooled handle
+ * The pooled handle takes over management of the entry in the handle pool
+ * which is unregistered when the pooled handle is freed
+ * Make sure the value handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_pooled_initialize(
+     libbfio_handle_t **handle,
+     libvsmbr_handle_pool_t *handle_pool,
+     int pool_entry,
+     libcerror_error_t **error )
+{
+	libvsmbr_pooled_io_handle_t *pooled_io_handle = NULL;
+	static char *function                         = "libvsmbr_pooled_initialize";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_pooled_io_handle_initialize(
+	     &pooled_io_handle,
+	     handle_pool,
+	     pool_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create pooled IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     handle,
+	     (intptr_t *) pooled_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libvsmbr_pooled_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libvsmbr_pooled_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libvsmbr_pooled_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libvsmbr_pooled_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libvsmbr_pooled_io_handle_read,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libvsmbr_pooled_io_handle_write,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libvsmbr_pooled_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libvsmbr_pooled_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libvsmbr_pooled_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libvsmbr_pooled_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	/* The entry remains registered and is removed by the caller
+	 */
+	if( pooled_io_handle != NULL )
+	{
+		memory_free(
+		 pooled_io_handle );
+	}
+	return( -1 );
+}
+
+/* Frees a pooled IO handle
+ * The entry of the pooled IO handle is unregistered from the handle pool
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_pooled_io_handle_free(
+     libvsmbr_pooled_io_handle_t **pooled_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_pooled_io_handle_free";
+	int result            = 1;
+
+	if( pooled_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pooled IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pooled_io_handle != NULL )
+	{
+		if( ( *pooled_io_handle )->is_open != 0 )
+		{
+			if( libvsmbr_pooled_io_handle_close(
+			     *pooled_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close pooled IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libvsmbr_handle_pool_unregister_entry(
+		     ( *pooled_io_handle )->handle_pool,
+		     ( *pooled_io_handle )->pool_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to unregister entry: %d from handle pool.",
+			 function,
+			 ( *pooled_io_handle )->pool_entry );
+
+			result = -1;
+		}
+		memory_free(
+		 *pooled_io_handle );
+
+		*pooled_io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the pooled IO handle
+ * This is not supported since an entry can only be registered once
+ * Returns -1 on error
+ */
+int libvsmbr_pooled_io_handle_clone(
+     libvsmbr_pooled_io_handle_t **destination_pooled_io_handle,
+     libvsmbr_pooled_io_handle_t *source_pooled_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_pooled_io_handle_clone";
+
+	LIBVSMBR_UNREFERENCED_PARAMETER( destination_pooled_io_handle )
+	LIBVSMBR_UNREFERENCED_PARAMETER( source_pooled_io_handle )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: cloning a pooled IO handle is not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Opens the pooled IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_pooled_io_handle_open(
+     libvsmbr_pooled_io_handle_t *pooled_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_pooled_io_handle_open";
+
+	if( pooled_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pooled IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pooled_io_handle->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pooled IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_handle_pool_open_entry(
+	     pooled_io_handle->handle_pool,
+	     pooled_io_handle->pool_entry,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open entry: %d in handle pool.",
+		 function,
+		 pooled_io_handle->pool_entry );
+
+		return( -1 );
+	}
+	/* The size is retained so that it can be determined without reopening the file
+	 */
+	if( libvsmbr_handle_pool_get_entry_size(
+	     pooled_io_handle->handle_pool,
+	     pooled_io_handle->pool_entry,
+	     &( pooled_io_handle->size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of entry: %d in handle pool.",
+		 function,
+		 pooled_io_handle->pool_entry );
+
+		goto on_error;
+	}
+	pooled_io_handle->access_flags   = access_flags;
+	pooled_io_handle->current_offset = 0;
+	pooled_io_handle->is_open        = 1;
+
+	return( 1 );
+
+on_error:
+	libvsmbr_handle_pool_close_entry(
+	 pooled_io_handle->handle_pool,
+	 pooled_io_handle->pool_entry,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Closes the pooled IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int libvsmbr_pooled_io_handle_close(
+     libvsmbr_pooled_io_handle_t *pooled_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_pooled_io_handle_close";
+
+	if( pooled_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pooled IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pooled_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pooled IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	pooled_io_handle->is_open = 0;
+
+	if( libvsmbr_handle_pool_close_entry(
+	     pooled_io_handle->handle_pool,
+	     pooled_io_handle->pool_entry,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close entry: %d in handle pool.",
+		 function,
+		 pooled_io_handle->pool_entry );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Reads a buffer from the pooled IO handle
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libvsmbr_pooled_io_handle_read(
+         libvsmbr_pooled_io_handle_t *pooled_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_pooled_io_handle_read";
+	ssize_t read_count    = 0;
+
+	if( pooled_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pooled IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pooled_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pooled IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) pooled_io_handle->current_offset >= pooled_io_handle->size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) size > ( pooled_io_handle->size - pooled_io_handle->current_offset ) )
+	{
+		size = (size_t) ( pooled_io_handle->size - pooled_io_handle->current_offset );
+	}
+	read_count = libvsmbr_handle_pool_read_entry_at_offset(
+	              pooled_io_handle->handle_pool,
+	              pooled_io_handle->pool_entry,
+	              buffer,
+	              size,
+	              pooled_io_handle->current_offset,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer from entry: %d in handle pool.",
+		 function,
+		 pooled_io_handle->pool_entry );
+
+		return( -1 );
+	}
+	pooled_io_handle->current_offset += read_count;
+
+	return( read_count );
+}
+
+/* Writes a buffer to the pooled IO handle
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libvsmbr_pooled_io_handle_write(
+         libvsmbr_pooled_io_handle_t *pooled_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_pooled_io_handle_write";
+	ssize_t write_count   = 0;
+
+	if( pooled_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pooled IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pooled_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pooled IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pooled_io_handle->access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid pooled IO handle - not opened for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = libvsmbr_handle_pool_write_entry_at_offset(
+	               pooled_io_handle->handle_pool,
+	               pooled_io_handle->pool_entry,
+	               buffer,
+	               size,
+	               pooled_io_handle->current_offset,
+	               error );
+
+	if( write_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer to entry: %d in handle pool.",
+		 function,
+		 pooled_io_handle->pool_entry );
+
+		return( -1 );
+	}
+	pooled_io_handle->current_offset += write_count;
+
+	if( (size64_t) pooled_io_handle->current_offset > pooled_io_handle->size )
+	{
+		pooled_io_handle->size = (size64_t) pooled_io_handle->current_offset;
+	}
+	return( write_count );
+}
+
+/* Seeks a certain offset within the pooled IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libvsmbr_pooled_io_handle_seek_offset(
+         libvsmbr_pooled_io_handle_t *pooled_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_pooled_io_handle_seek_offset";
+
+	if( pooled_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pooled IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += pooled_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) pooled_io_handle->size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	pooled_io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if a file exists
+ * Returns 1 if file exists, 0 if not or -1 on error
+ */
+int libvsmbr_pooled_io_handle_exists(
+     libvsmbr_pooled_io_handle_t *pooled_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_pooled_io_handle_exists";
+
+	if( pooled_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pooled IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The file of a registered entry is checked when it is opened
+	 */
+	return( 1 );
+}
+
+/* Check if the pooled IO handle is open
+ * The underlying file can be closed by the handle pool while the pooled IO handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libvsmbr_pooled_io_handle_is_open(
+     libvsmbr_pooled_io_handle_t *pooled_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_pooled_io_handle_is_open";
+
+	if( pooled_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pooled IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pooled_io_handle->is_open == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_pooled_io_handle_get_size(
+     libvsmbr_pooled_io_handle_t *pooled_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_pooled_io_handle_get_size";
+
+	if( pooled_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pooled IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( pooled_io_handle->is_open != 0 )
+	{
+		*size = pooled_io_handle->size;
+
+		return( 1 );
+	}
+	if( libvsmbr_handle_pool_get_entry_size(
+	     pooled_io_handle->handle_pool,
+	     pooled_io_handle->pool_entry,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of entry: %d in handle pool.",
+		 function,
+		 pooled_io_handle->pool_entry );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,135 @@
+/*
+ * Pooled IO handle functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSMBR_POOLED_IO_HANDLE_H )
+#define _LIBVSMBR_POOLED_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsmbr_pooled_io_handle libvsmbr_pooled_io_handle_t;
+
+/* The pooled IO handle provides access to a file that is registered
+ * in a handle pool, the file can be closed by the handle pool while
+ * the pooled IO handle is open and is reopened on demand
+ */
+struct libvsmbr_pooled_io_handle
+{
+	/* The handle pool
+	 */
+	libvsmbr_handle_pool_t *handle_pool;
+
+	/* The entry in the file IO pool of the handle pool
+	 */
+	int pool_entry;
+
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* Value to indicate if the pooled IO handle is open
+	 */
+	uint8_t is_open;
+};
+
+int libvsmbr_pooled_io_handle_initialize(
+     libvsmbr_pooled_io_handle_t **pooled_io_handle,
+     libvsmbr_handle_pool_t *handle_pool,
+     int pool_entry,
+     libcerror_error_t **error );
+
+int libvsmbr_pooled_initialize(
+     libbfio_handle_t **handle,
+     libvsmbr_handle_pool_t *handle_pool,
+     int pool_entry,
+     libcerror_error_t **error );
+
+int libvsmbr_pooled_io_handle_free(
+     libvsmbr_pooled_io_handle_t **pooled_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_pooled_io_handle_clone(
+     libvsmbr_pooled_io_handle_t **destination_pooled_io_handle,
+     libvsmbr_pooled_io_handle_t *source_pooled_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_pooled_io_handle_open(
+     libvsmbr_pooled_io_handle_t *pooled_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libvsmbr_pooled_io_handle_close(
+     libvsmbr_pooled_io_handle_t *pooled_io_handle,
+     libcerror_error_t **error );
+
+ssize_t libvsmbr_pooled_io_handle_read(
+         libvsmbr_pooled_io_handle_t *pooled_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libvsmbr_pooled_io_handle_write(
+         libvsmbr_pooled_io_handle_t *pooled_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libvsmbr_pooled_io_handle_seek_offset(
+         libvsmbr_pooled_io_handle_t *pooled_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libvsmbr_pooled_io_handle_exists(
+     libvsmbr_pooled_io_handle_t *pooled_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_pooled_io_handle_is_open(
+     libvsmbr_pooled_io_handle_t *pooled_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_pooled_io_handle_get_size(
+     libvsmbr_pooled_io_handle_t *pooled_io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSMBR_POOLED_IO_HANDLE_H ) */
+
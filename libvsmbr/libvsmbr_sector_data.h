@@ -61,19 +61,6 @@ int libvsmbr_sector_data_read_file_io_handle(
      off64_t sector_offset,
      libcerror_error_t **error );
 
-int libvsmbr_partition_read_element_data(
-     intptr_t *data_handle,
-     libbfio_handle_t *file_io_handle,
-     libfdata_vector_t *vector,
-     libfdata_cache_t *cache,
-     int element_index,
-     int element_data_file_index,
-     off64_t element_data_offset,
-     size64_t element_data_size,
-     uint32_t element_data_flags,
-     uint8_t read_flags,
-     libcerror_error_t **error );
-
 #if defined( __cplusplus )
 }
 #endif
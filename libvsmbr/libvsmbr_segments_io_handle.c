@@ -0,0 +1,1385 @@
+/*
+ * Segments IO handle functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsmbr_definitions.h"
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_libcthreads.h"
+#include "libvsmbr_segments_io_handle.h"
+#include "libvsmbr_unused.h"
+
+/* Creates a segments IO handle
+ * Make sure the value segments_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_segments_io_handle_initialize(
+     libvsmbr_segments_io_handle_t **segments_io_handle,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_segments_io_handle_initialize";
+
+	if( segments_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segments IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segments_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segments IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	*segments_io_handle = memory_allocate_structure(
+	                       libvsmbr_segments_io_handle_t );
+
+	if( *segments_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segments IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *segments_io_handle,
+	     0,
+	     sizeof( libvsmbr_segments_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear segments IO handle.",
+		 function );
+
+		memory_free(
+		 *segments_io_handle );
+
+		*segments_io_handle = NULL;
+
+		return( -1 );
+	}
+	( *segments_io_handle )->file_io_pool = file_io_pool;
+
+	return( 1 );
+}
+
+/* Creates a segments handle
+ * The segments in the file IO pool are read as a single contiguous image
+ * in order of their entry in the pool
+ * The handle does not take over management of the file IO pool
+ * Make sure the value handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_segments_initialize(
+     libbfio_handle_t **handle,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error )
+{
+	libvsmbr_segments_io_handle_t *segments_io_handle = NULL;
+	static char *function                             = "libvsmbr_segments_initialize";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_segments_io_handle_initialize(
+	     &segments_io_handle,
+	     file_io_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create segments IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     handle,
+	     (intptr_t *) segments_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libvsmbr_segments_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libvsmbr_segments_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libvsmbr_segments_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libvsmbr_segments_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libvsmbr_segments_io_handle_read,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libvsmbr_segments_io_handle_write,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libvsmbr_segments_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libvsmbr_segments_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libvsmbr_segments_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libvsmbr_segments_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( segments_io_handle != NULL )
+	{
+		libvsmbr_segments_io_handle_free(
+		 &segments_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a segments IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_segments_io_handle_free(
+     libvsmbr_segments_io_handle_t **segments_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_segments_io_handle_free";
+	int result            = 1;
+
+	if( segments_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segments IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segments_io_handle != NULL )
+	{
+		if( ( *segments_io_handle )->is_open != 0 )
+		{
+			if( libvsmbr_segments_io_handle_close(
+			     *segments_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close segments IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *segments_io_handle );
+
+		*segments_io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the segments IO handle
+ * This is not supported since the segment file IO handles are not shared
+ * Returns -1 on error
+ */
+int libvsmbr_segments_io_handle_clone(
+     libvsmbr_segments_io_handle_t **destination_segments_io_handle,
+     libvsmbr_segments_io_handle_t *source_segments_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_segments_io_handle_clone";
+
+	LIBVSMBR_UNREFERENCED_PARAMETER( destination_segments_io_handle )
+	LIBVSMBR_UNREFERENCED_PARAMETER( source_segments_io_handle )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: cloning a segments IO handle is not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Opens the segments IO handle
+ * The segment file IO handles are kept open while the segments IO handle is open,
+ * so that a read that spans multiple segments can read them concurrently,
+ * which is not possible through the file IO pool since it serializes access
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_segments_io_handle_open(
+     libvsmbr_segments_io_handle_t *segments_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libvsmbr_segments_io_handle_open";
+	size64_t segment_size            = 0;
+	int file_io_handle_is_open       = 0;
+	int number_of_segments           = 0;
+	int segment_index                = 0;
+
+	if( segments_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segments IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segments_io_handle->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segments IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_pool_get_number_of_handles(
+	     segments_io_handle->file_io_pool,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles in file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_segments <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of segments value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	segments_io_handle->segment_file_io_handles = (libbfio_handle_t **) memory_allocate(
+	                                                                     sizeof( libbfio_handle_t * ) * number_of_segments );
+
+	if( segments_io_handle->segment_file_io_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment file IO handles.",
+		 function );
+
+		goto on_error;
+	}
+	segments_io_handle->segment_file_io_handles_opened_in_library = (uint8_t *) memory_allocate(
+	                                                                             sizeof( uint8_t ) * number_of_segments );
+
+	if( segments_io_handle->segment_file_io_handles_opened_in_library == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment file IO handles opened in library.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     segments_io_handle->segment_file_io_handles_opened_in_library,
+	     0,
+	     sizeof( uint8_t ) * number_of_segments ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear segment file IO handles opened in library.",
+		 function );
+
+		goto on_error;
+	}
+	segments_io_handle->segment_offsets = (off64_t *) memory_allocate(
+	                                                   sizeof( off64_t ) * number_of_segments );
+
+	if( segments_io_handle->segment_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment offsets.",
+		 function );
+
+		goto on_error;
+	}
+	segments_io_handle->segment_sizes = (size64_t *) memory_allocate(
+	                                                  sizeof( size64_t ) * number_of_segments );
+
+	if( segments_io_handle->segment_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment sizes.",
+		 function );
+
+		goto on_error;
+	}
+	segments_io_handle->number_of_segments = number_of_segments;
+	segments_io_handle->size               = 0;
+
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		file_io_handle = NULL;
+
+		if( libbfio_pool_get_handle(
+		     segments_io_handle->file_io_pool,
+		     segment_index,
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file IO handle: %d from pool.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		if( file_io_handle == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing file IO handle: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		segments_io_handle->segment_file_io_handles[ segment_index ] = file_io_handle;
+
+		file_io_handle_is_open = libbfio_handle_is_open(
+		                          file_io_handle,
+		                          error );
+
+		if( file_io_handle_is_open == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to determine if file IO handle: %d is open.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		else if( file_io_handle_is_open == 0 )
+		{
+			if( libbfio_handle_open(
+			     file_io_handle,
+			     access_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open file IO handle: %d.",
+				 function,
+				 segment_index );
+
+				goto on_error;
+			}
+			segments_io_handle->segment_file_io_handles_opened_in_library[ segment_index ] = 1;
+		}
+		if( libbfio_handle_get_size(
+		     file_io_handle,
+		     &segment_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of segment: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		if( segment_size > (size64_t) ( INT64_MAX - segments_io_handle->size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid segment: %d size value out of bounds.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		segments_io_handle->segment_offsets[ segment_index ] = (off64_t) segments_io_handle->size;
+		segments_io_handle->segment_sizes[ segment_index ]   = segment_size;
+
+		segments_io_handle->size += segment_size;
+	}
+	segments_io_handle->access_flags   = access_flags;
+	segments_io_handle->current_offset = 0;
+	segments_io_handle->is_open        = 1;
+
+	return( 1 );
+
+on_error:
+	if( segments_io_handle->segment_file_io_handles_opened_in_library != NULL )
+	{
+		while( segment_index >= 0 )
+		{
+			if( ( segment_index < number_of_segments )
+			 && ( segments_io_handle->segment_file_io_handles_opened_in_library[ segment_index ] != 0 ) )
+			{
+				libbfio_handle_close(
+				 segments_io_handle->segment_file_io_handles[ segment_index ],
+				 NULL );
+			}
+			segment_index--;
+		}
+		memory_free(
+		 segments_io_handle->segment_file_io_handles_opened_in_library );
+
+		segments_io_handle->segment_file_io_handles_opened_in_library = NULL;
+	}
+	if( segments_io_handle->segment_sizes != NULL )
+	{
+		memory_free(
+		 segments_io_handle->segment_sizes );
+
+		segments_io_handle->segment_sizes = NULL;
+	}
+	if( segments_io_handle->segment_offsets != NULL )
+	{
+		memory_free(
+		 segments_io_handle->segment_offsets );
+
+		segments_io_handle->segment_offsets = NULL;
+	}
+	if( segments_io_handle->segment_file_io_handles != NULL )
+	{
+		memory_free(
+		 segments_io_handle->segment_file_io_handles );
+
+		segments_io_handle->segment_file_io_handles = NULL;
+	}
+	segments_io_handle->number_of_segments = 0;
+	segments_io_handle->size               = 0;
+
+	return( -1 );
+}
+
+/* Closes the segments IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int libvsmbr_segments_io_handle_close(
+     libvsmbr_segments_io_handle_t *segments_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_segments_io_handle_close";
+	int result            = 0;
+	int segment_index     = 0;
+
+	if( segments_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segments IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segments_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segments IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	for( segment_index = 0;
+	     segment_index < segments_io_handle->number_of_segments;
+	     segment_index++ )
+	{
+		if( segments_io_handle->segment_file_io_handles_opened_in_library[ segment_index ] != 0 )
+		{
+			if( libbfio_handle_close(
+			     segments_io_handle->segment_file_io_handles[ segment_index ],
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle: %d.",
+				 function,
+				 segment_index );
+
+				result = -1;
+			}
+		}
+	}
+	memory_free(
+	 segments_io_handle->segment_file_io_handles_opened_in_library );
+
+	segments_io_handle->segment_file_io_handles_opened_in_library = NULL;
+
+	memory_free(
+	 segments_io_handle->segment_sizes );
+
+	segments_io_handle->segment_sizes = NULL;
+
+	memory_free(
+	 segments_io_handle->segment_offsets );
+
+	segments_io_handle->segment_offsets = NULL;
+
+	memory_free(
+	 segments_io_handle->segment_file_io_handles );
+
+	segments_io_handle->segment_file_io_handles = NULL;
+	segments_io_handle->number_of_segments      = 0;
+	segments_io_handle->size                    = 0;
+	segments_io_handle->is_open                 = 0;
+
+	return( result );
+}
+
+/* Retrieves the segment that contains a specific offset
+ * Returns 1 if successful, 0 if the offset is beyond the last segment or -1 on error
+ */
+int libvsmbr_segments_io_handle_get_segment_at_offset(
+     libvsmbr_segments_io_handle_t *segments_io_handle,
+     off64_t offset,
+     int *segment_index,
+     off64_t *segment_offset,
+     libcerror_error_t **error )
+{
+	static char *function   = "libvsmbr_segments_io_handle_get_segment_at_offset";
+	int first_segment_index = 0;
+	int last_segment_index  = 0;
+	int middle_index        = 0;
+
+	if( segments_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segments IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segments_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segments IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= segments_io_handle->size )
+	{
+		return( 0 );
+	}
+	/* Search for the last segment that starts at or before the offset,
+	 * which skips empty segments since they start at the same offset
+	 * as the segment that follows them
+	 */
+	first_segment_index = 0;
+	last_segment_index  = segments_io_handle->number_of_segments - 1;
+
+	while( first_segment_index < last_segment_index )
+	{
+		middle_index = first_segment_index + ( ( last_segment_index - first_segment_index + 1 ) / 2 );
+
+		if( segments_io_handle->segment_offsets[ middle_index ] <= offset )
+		{
+			first_segment_index = middle_index;
+		}
+		else
+		{
+			last_segment_index = middle_index - 1;
+		}
+	}
+	*segment_index  = first_segment_index;
+	*segment_offset = offset - segments_io_handle->segment_offsets[ first_segment_index ];
+
+	return( 1 );
+}
+
+/* Reads the buffer of a segment read
+ * This function is used as the callback of the threads that read a segment
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_segments_io_handle_read_segment(
+     libvsmbr_segment_read_t *segment_read )
+{
+	if( segment_read == NULL )
+	{
+		return( -1 );
+	}
+	segment_read->read_count = libbfio_handle_read_buffer_at_offset(
+	                            segment_read->file_io_handle,
+	                            segment_read->buffer,
+	                            segment_read->size,
+	                            segment_read->offset,
+	                            &( segment_read->read_error ) );
+
+	if( segment_read->read_count != (ssize_t) segment_read->size )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a buffer from the segments IO handle
+ * If multi-threading is supported, the parts of a read that spans multiple
+ * segments are read concurrently
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libvsmbr_segments_io_handle_read(
+         libvsmbr_segments_io_handle_t *segments_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	libvsmbr_segment_read_t segment_reads[ LIBVSMBR_MAXIMUM_NUMBER_OF_SEGMENT_READS ];
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_t *threads[ LIBVSMBR_MAXIMUM_NUMBER_OF_SEGMENT_READS ];
+#endif
+
+	static char *function       = "libvsmbr_segments_io_handle_read";
+	size_t buffer_offset        = 0;
+	size_t read_size            = 0;
+	off64_t segment_offset      = 0;
+	int number_of_segment_reads = 0;
+	int read_index              = 0;
+	int result                  = 0;
+	int segment_index           = 0;
+
+	if( segments_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segments IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segments_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segments IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) segments_io_handle->current_offset >= segments_io_handle->size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) size > ( segments_io_handle->size - segments_io_handle->current_offset ) )
+	{
+		size = (size_t) ( segments_io_handle->size - segments_io_handle->current_offset );
+	}
+	while( buffer_offset < size )
+	{
+		/* Split the read in parts per segment
+		 */
+		for( number_of_segment_reads = 0;
+		     number_of_segment_reads < LIBVSMBR_MAXIMUM_NUMBER_OF_SEGMENT_READS;
+		     number_of_segment_reads++ )
+		{
+			if( buffer_offset >= size )
+			{
+				break;
+			}
+			if( libvsmbr_segments_io_handle_get_segment_at_offset(
+			     segments_io_handle,
+			     segments_io_handle->current_offset,
+			     &segment_index,
+			     &segment_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve segment at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 segments_io_handle->current_offset,
+				 segments_io_handle->current_offset );
+
+				return( -1 );
+			}
+			read_size = size - buffer_offset;
+
+			if( (size64_t) read_size > ( segments_io_handle->segment_sizes[ segment_index ] - segment_offset ) )
+			{
+				read_size = (size_t) ( segments_io_handle->segment_sizes[ segment_index ] - segment_offset );
+			}
+			segment_reads[ number_of_segment_reads ].file_io_handle = segments_io_handle->segment_file_io_handles[ segment_index ];
+			segment_reads[ number_of_segment_reads ].buffer         = &( buffer[ buffer_offset ] );
+			segment_reads[ number_of_segment_reads ].size           = read_size;
+			segment_reads[ number_of_segment_reads ].offset         = segment_offset;
+			segment_reads[ number_of_segment_reads ].read_count     = 0;
+			segment_reads[ number_of_segment_reads ].read_error     = NULL;
+
+			segments_io_handle->current_offset += read_size;
+			buffer_offset                      += read_size;
+		}
+		result = 1;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+		/* The first part is read by the calling thread and the other parts
+		 * by a thread per part, a part is read by the calling thread as well
+		 * if its thread cannot be created
+		 */
+		for( read_index = 1;
+		     read_index < number_of_segment_reads;
+		     read_index++ )
+		{
+			threads[ read_index ] = NULL;
+
+			if( libcthreads_thread_create(
+			     &( threads[ read_index ] ),
+			     NULL,
+			     (int (*)(void *)) &libvsmbr_segments_io_handle_read_segment,
+			     (void *) &( segment_reads[ read_index ] ),
+			     NULL ) != 1 )
+			{
+				threads[ read_index ] = NULL;
+			}
+		}
+#endif
+		for( read_index = 0;
+		     read_index < number_of_segment_reads;
+		     read_index++ )
+		{
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+			if( ( read_index > 0 )
+			 && ( threads[ read_index ] != NULL ) )
+			{
+				if( libcthreads_thread_join(
+				     &( threads[ read_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join segment read thread.",
+					 function );
+
+					result = -1;
+				}
+				continue;
+			}
+#endif
+			libvsmbr_segments_io_handle_read_segment(
+			 &( segment_reads[ read_index ] ) );
+		}
+		for( read_index = 0;
+		     read_index < number_of_segment_reads;
+		     read_index++ )
+		{
+			if( segment_reads[ read_index ].read_count != (ssize_t) segment_reads[ read_index ].size )
+			{
+				if( ( result == 1 )
+				 && ( error != NULL )
+				 && ( *error == NULL ) )
+				{
+					*error = segment_reads[ read_index ].read_error;
+
+					segment_reads[ read_index ].read_error = NULL;
+				}
+				result = -1;
+			}
+			if( segment_reads[ read_index ].read_error != NULL )
+			{
+				libcerror_error_free(
+				 &( segment_reads[ read_index ].read_error ) );
+			}
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data from segments.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Writes a buffer to the segments IO handle
+ * The segments are not extended, a write is limited to the size of the image
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libvsmbr_segments_io_handle_write(
+         libvsmbr_segments_io_handle_t *segments_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function  = "libvsmbr_segments_io_handle_write";
+	size_t buffer_offset   = 0;
+	size_t write_size      = 0;
+	ssize_t write_count    = 0;
+	off64_t segment_offset = 0;
+	int segment_index      = 0;
+
+	if( segments_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segments IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segments_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segments IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( segments_io_handle->access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid segments IO handle - not opened for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) segments_io_handle->current_offset >= segments_io_handle->size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) size > ( segments_io_handle->size - segments_io_handle->current_offset ) )
+	{
+		size = (size_t) ( segments_io_handle->size - segments_io_handle->current_offset );
+	}
+	while( buffer_offset < size )
+	{
+		if( libvsmbr_segments_io_handle_get_segment_at_offset(
+		     segments_io_handle,
+		     segments_io_handle->current_offset,
+		     &segment_index,
+		     &segment_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 segments_io_handle->current_offset,
+			 segments_io_handle->current_offset );
+
+			return( -1 );
+		}
+		write_size = size - buffer_offset;
+
+		if( (size64_t) write_size > ( segments_io_handle->segment_sizes[ segment_index ] - segment_offset ) )
+		{
+			write_size = (size_t) ( segments_io_handle->segment_sizes[ segment_index ] - segment_offset );
+		}
+		write_count = libbfio_handle_write_buffer_at_offset(
+		               segments_io_handle->segment_file_io_handles[ segment_index ],
+		               &( buffer[ buffer_offset ] ),
+		               write_size,
+		               segment_offset,
+		               error );
+
+		if( write_count != (ssize_t) write_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data to segment: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 segment_index,
+			 segment_offset,
+			 segment_offset );
+
+			return( -1 );
+		}
+		segments_io_handle->current_offset += write_size;
+		buffer_offset                      += write_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Seeks a certain offset within the segments IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libvsmbr_segments_io_handle_seek_offset(
+         libvsmbr_segments_io_handle_t *segments_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_segments_io_handle_seek_offset";
+
+	if( segments_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segments IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += segments_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) segments_io_handle->size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	segments_io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if the segments exist
+ * Returns 1 if all segment file IO handles exist, 0 if not or -1 on error
+ */
+int libvsmbr_segments_io_handle_exists(
+     libvsmbr_segments_io_handle_t *segments_io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libvsmbr_segments_io_handle_exists";
+	int number_of_segments           = 0;
+	int result                       = 0;
+	int segment_index                = 0;
+
+	if( segments_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segments IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_pool_get_number_of_handles(
+	     segments_io_handle->file_io_pool,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles in file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_segments <= 0 )
+	{
+		return( 0 );
+	}
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		file_io_handle = NULL;
+
+		if( libbfio_pool_get_handle(
+		     segments_io_handle->file_io_pool,
+		     segment_index,
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file IO handle: %d from pool.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		result = libbfio_handle_exists(
+		          file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if file IO handle: %d exists.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+	}
+	return( result );
+}
+
+/* Check if the segments IO handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libvsmbr_segments_io_handle_is_open(
+     libvsmbr_segments_io_handle_t *segments_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_segments_io_handle_is_open";
+
+	if( segments_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segments IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segments_io_handle->is_open == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the segments, which is the sum of the segment sizes
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_segments_io_handle_get_size(
+     libvsmbr_segments_io_handle_t *segments_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function  = "libvsmbr_segments_io_handle_get_size";
+	size64_t segment_size  = 0;
+	size64_t safe_size     = 0;
+	int number_of_segments = 0;
+	int segment_index      = 0;
+
+	if( segments_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segments IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( segments_io_handle->is_open != 0 )
+	{
+		*size = segments_io_handle->size;
+
+		return( 1 );
+	}
+	if( libbfio_pool_get_number_of_handles(
+	     segments_io_handle->file_io_pool,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles in file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		if( libbfio_pool_get_size(
+		     segments_io_handle->file_io_pool,
+		     segment_index,
+		     &segment_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of segment: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		safe_size += segment_size;
+	}
+	*size = safe_size;
+
+	return( 1 );
+}
+
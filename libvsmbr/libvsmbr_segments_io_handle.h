@@ -0,0 +1,188 @@
+/*
+ * Segments IO handle functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSMBR_SEGMENTS_IO_HANDLE_H )
+#define _LIBVSMBR_SEGMENTS_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsmbr_segment_read libvsmbr_segment_read_t;
+
+/* A read of a part of a buffer from a single segment
+ */
+struct libvsmbr_segment_read
+{
+	/* The segment file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The size of the buffer
+	 */
+	size_t size;
+
+	/* The offset within the segment
+	 */
+	off64_t offset;
+
+	/* The read count
+	 */
+	ssize_t read_count;
+
+	/* The read error
+	 */
+	libcerror_error_t *read_error;
+};
+
+typedef struct libvsmbr_segments_io_handle libvsmbr_segments_io_handle_t;
+
+/* The segments IO handle concatenates the segment files of a split image
+ * that are stored in a file IO pool into a single contiguous image
+ */
+struct libvsmbr_segments_io_handle
+{
+	/* The file IO pool that contains a handle per segment
+	 */
+	libbfio_pool_t *file_io_pool;
+
+	/* The number of segments
+	 */
+	int number_of_segments;
+
+	/* The segment file IO handles
+	 */
+	libbfio_handle_t **segment_file_io_handles;
+
+	/* Values to indicate if the segment file IO handles were opened inside the library
+	 */
+	uint8_t *segment_file_io_handles_opened_in_library;
+
+	/* The offsets of the segments within the image
+	 */
+	off64_t *segment_offsets;
+
+	/* The sizes of the segments
+	 */
+	size64_t *segment_sizes;
+
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* The size, which is the sum of the segment sizes
+	 */
+	size64_t size;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* Value to indicate if the segments IO handle is open
+	 */
+	uint8_t is_open;
+};
+
+int libvsmbr_segments_io_handle_initialize(
+     libvsmbr_segments_io_handle_t **segments_io_handle,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error );
+
+int libvsmbr_segments_initialize(
+     libbfio_handle_t **handle,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error );
+
+int libvsmbr_segments_io_handle_free(
+     libvsmbr_segments_io_handle_t **segments_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_segments_io_handle_clone(
+     libvsmbr_segments_io_handle_t **destination_segments_io_handle,
+     libvsmbr_segments_io_handle_t *source_segments_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_segments_io_handle_open(
+     libvsmbr_segments_io_handle_t *segments_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libvsmbr_segments_io_handle_close(
+     libvsmbr_segments_io_handle_t *segments_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_segments_io_handle_get_segment_at_offset(
+     libvsmbr_segments_io_handle_t *segments_io_handle,
+     off64_t offset,
+     int *segment_index,
+     off64_t *segment_offset,
+     libcerror_error_t **error );
+
+int libvsmbr_segments_io_handle_read_segment(
+     libvsmbr_segment_read_t *segment_read );
+
+ssize_t libvsmbr_segments_io_handle_read(
+         libvsmbr_segments_io_handle_t *segments_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libvsmbr_segments_io_handle_write(
+         libvsmbr_segments_io_handle_t *segments_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libvsmbr_segments_io_handle_seek_offset(
+         libvsmbr_segments_io_handle_t *segments_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libvsmbr_segments_io_handle_exists(
+     libvsmbr_segments_io_handle_t *segments_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_segments_io_handle_is_open(
+     libvsmbr_segments_io_handle_t *segments_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_segments_io_handle_get_size(
+     libvsmbr_segments_io_handle_t *segments_io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSMBR_SEGMENTS_IO_HANDLE_H ) */
+
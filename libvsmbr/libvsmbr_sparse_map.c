@@ -0,0 +1,937 @@
+/*
+ * Sparse map functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsmbr_definitions.h"
+#include "libvsmbr_libcdata.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_section_values.h"
+#include "libvsmbr_sparse_map.h"
+#include "libvsmbr_types.h"
+
+/* Creates a sparse map
+ * Make sure the value sparse_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_sparse_map_initialize(
+     libvsmbr_sparse_map_t **sparse_map,
+     uint32_t block_size,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_sparse_map_t *internal_sparse_map = NULL;
+	static char *function                               = "libvsmbr_sparse_map_initialize";
+
+	if( sparse_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sparse map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sparse_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sparse map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( ( block_size % 512 ) != 0 )
+	 || ( block_size > LIBVSMBR_MAXIMUM_SPARSE_MAP_BLOCK_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported block size: %" PRIu32 ".",
+		 function,
+		 block_size );
+
+		return( -1 );
+	}
+	if( data_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sparse_map = memory_allocate_structure(
+	                       libvsmbr_internal_sparse_map_t );
+
+	if( internal_sparse_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sparse map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_sparse_map,
+	     0,
+	     sizeof( libvsmbr_internal_sparse_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sparse map.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_sparse_map->ranges_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create ranges array.",
+		 function );
+
+		goto on_error;
+	}
+	internal_sparse_map->block_size = block_size;
+	internal_sparse_map->data_size  = data_size;
+
+	*sparse_map = (libvsmbr_sparse_map_t *) internal_sparse_map;
+
+	return( 1 );
+
+on_error:
+	if( internal_sparse_map != NULL )
+	{
+		memory_free(
+		 internal_sparse_map );
+	}
+	return( -1 );
+}
+
+/* Frees a sparse map
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_sparse_map_free(
+     libvsmbr_sparse_map_t **sparse_map,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_sparse_map_t *internal_sparse_map = NULL;
+	static char *function                               = "libvsmbr_sparse_map_free";
+	int result                                          = 1;
+
+	if( sparse_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sparse map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sparse_map != NULL )
+	{
+		internal_sparse_map = (libvsmbr_internal_sparse_map_t *) *sparse_map;
+		*sparse_map         = NULL;
+
+		if( libcdata_array_free(
+		     &( internal_sparse_map->ranges_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libvsmbr_section_values_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free ranges array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_sparse_map );
+	}
+	return( result );
+}
+
+/* Clones a sparse map
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_sparse_map_clone(
+     libvsmbr_sparse_map_t **destination_sparse_map,
+     libvsmbr_sparse_map_t *source_sparse_map,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_sparse_map_t *internal_source_sparse_map = NULL;
+	libvsmbr_section_values_t *section_values                  = NULL;
+	libvsmbr_sparse_map_t *safe_destination_sparse_map         = NULL;
+	static char *function                                      = "libvsmbr_sparse_map_clone";
+	int number_of_ranges                                       = 0;
+	int range_index                                            = 0;
+
+	if( destination_sparse_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination sparse map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_sparse_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination sparse map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_sparse_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source sparse map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_source_sparse_map = (libvsmbr_internal_sparse_map_t *) source_sparse_map;
+
+	if( libvsmbr_sparse_map_initialize(
+	     &safe_destination_sparse_map,
+	     internal_source_sparse_map->block_size,
+	     internal_source_sparse_map->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination sparse map.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_source_sparse_map->ranges_array,
+	     &number_of_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of ranges.",
+		 function );
+
+		goto on_error;
+	}
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_source_sparse_map->ranges_array,
+		     range_index,
+		     (intptr_t **) &section_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve range: %d.",
+			 function,
+			 range_index );
+
+			goto on_error;
+		}
+		if( section_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing range: %d.",
+			 function,
+			 range_index );
+
+			goto on_error;
+		}
+		if( libvsmbr_sparse_map_append_range(
+		     safe_destination_sparse_map,
+		     section_values->offset,
+		     section_values->size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append range: %d.",
+			 function,
+			 range_index );
+
+			goto on_error;
+		}
+	}
+	*destination_sparse_map = safe_destination_sparse_map;
+
+	return( 1 );
+
+on_error:
+	if( safe_destination_sparse_map != NULL )
+	{
+		libvsmbr_sparse_map_free(
+		 &safe_destination_sparse_map,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines if data only contains 0-byte values
+ * The bulk of the data is tested 4 words at a time, since the words are
+ * combined with a bitwise OR the compiler can vectorize the test
+ * Returns 1 if the data only contains 0-byte values, 0 if not or -1 on error
+ */
+int libvsmbr_sparse_map_data_is_zero(
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	const uint64_t *aligned_data = NULL;
+	static char *function        = "libvsmbr_sparse_map_data_is_zero";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Test the bytes before the first 64-bit aligned word
+	 */
+	while( ( data_size > 0 )
+	    && ( ( (intptr_t) data % sizeof( uint64_t ) ) != 0 ) )
+	{
+		if( *data != 0 )
+		{
+			return( 0 );
+		}
+		data      += 1;
+		data_size -= 1;
+	}
+	aligned_data = (const uint64_t *) data;
+
+	while( data_size >= ( 4 * sizeof( uint64_t ) ) )
+	{
+		if( ( aligned_data[ 0 ] | aligned_data[ 1 ] | aligned_data[ 2 ] | aligned_data[ 3 ] ) != 0 )
+		{
+			return( 0 );
+		}
+		aligned_data += 4;
+		data_size    -= 4 * sizeof( uint64_t );
+	}
+	while( data_size >= sizeof( uint64_t ) )
+	{
+		if( *aligned_data != 0 )
+		{
+			return( 0 );
+		}
+		aligned_data += 1;
+		data_size    -= sizeof( uint64_t );
+	}
+	data = (const uint8_t *) aligned_data;
+
+	/* Test the bytes after the last 64-bit aligned word
+	 */
+	while( data_size > 0 )
+	{
+		if( *data != 0 )
+		{
+			return( 0 );
+		}
+		data      += 1;
+		data_size -= 1;
+	}
+	return( 1 );
+}
+
+/* Appends a sparse range
+ * The range is merged with the last range if they are adjacent
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_sparse_map_append_range(
+     libvsmbr_sparse_map_t *sparse_map,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_sparse_map_t *internal_sparse_map = NULL;
+	libvsmbr_section_values_t *section_values           = NULL;
+	static char *function                               = "libvsmbr_sparse_map_append_range";
+	off64_t last_range_end_offset                       = 0;
+	int entry_index                                     = 0;
+	int number_of_ranges                                = 0;
+
+	if( sparse_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sparse map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sparse_map = (libvsmbr_internal_sparse_map_t *) sparse_map;
+
+	if( ( range_offset < 0 )
+	 || ( range_size == 0 )
+	 || ( (size64_t) range_offset > internal_sparse_map->data_size )
+	 || ( range_size > ( internal_sparse_map->data_size - (size64_t) range_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_sparse_map->ranges_array,
+	     &number_of_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_ranges > 0 )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_sparse_map->ranges_array,
+		     number_of_ranges - 1,
+		     (intptr_t **) &section_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve last range.",
+			 function );
+
+			return( -1 );
+		}
+		if( section_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing last range.",
+			 function );
+
+			return( -1 );
+		}
+		last_range_end_offset = section_values->offset + (off64_t) section_values->size;
+
+		/* The ranges are stored in order so they can be searched
+		 */
+		if( range_offset < last_range_end_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid range offset value overlaps with last range.",
+			 function );
+
+			return( -1 );
+		}
+		if( range_offset == last_range_end_offset )
+		{
+			section_values->size             += range_size;
+			internal_sparse_map->sparse_size += range_size;
+
+			return( 1 );
+		}
+		section_values = NULL;
+	}
+	if( libvsmbr_section_values_initialize(
+	     &section_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create range.",
+		 function );
+
+		return( -1 );
+	}
+	section_values->offset = range_offset;
+	section_values->size   = range_size;
+
+	if( libcdata_array_append_entry(
+	     internal_sparse_map->ranges_array,
+	     &entry_index,
+	     (intptr_t *) section_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append range.",
+		 function );
+
+		libvsmbr_section_values_free(
+		 &section_values,
+		 NULL );
+
+		return( -1 );
+	}
+	internal_sparse_map->sparse_size += range_size;
+
+	return( 1 );
+}
+
+/* Retrieves the sparse range that contains a specific offset
+ * Returns 1 if successful, 0 if the offset is not within a sparse range or -1 on error
+ */
+int libvsmbr_sparse_map_get_range_at_offset(
+     libvsmbr_sparse_map_t *sparse_map,
+     off64_t offset,
+     off64_t *range_offset,
+     size64_t *range_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_sparse_map_t *internal_sparse_map = NULL;
+	libvsmbr_section_values_t *section_values           = NULL;
+	static char *function                               = "libvsmbr_sparse_map_get_range_at_offset";
+	int first_range_index                               = 0;
+	int last_range_index                                = 0;
+	int number_of_ranges                                = 0;
+	int range_index                                     = 0;
+
+	if( sparse_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sparse map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sparse_map = (libvsmbr_internal_sparse_map_t *) sparse_map;
+
+	if( range_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_sparse_map->ranges_array,
+	     &number_of_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of ranges.",
+		 function );
+
+		return( -1 );
+	}
+	first_range_index = 0;
+	last_range_index  = number_of_ranges - 1;
+
+	while( first_range_index <= last_range_index )
+	{
+		range_index = first_range_index + ( ( last_range_index - first_range_index ) / 2 );
+
+		if( libcdata_array_get_entry_by_index(
+		     internal_sparse_map->ranges_array,
+		     range_index,
+		     (intptr_t **) &section_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve range: %d.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+		if( section_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing range: %d.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+		if( offset < section_values->offset )
+		{
+			last_range_index = range_index - 1;
+		}
+		else if( (size64_t) ( offset - section_values->offset ) >= section_values->size )
+		{
+			first_range_index = range_index + 1;
+		}
+		else
+		{
+			*range_offset = section_values->offset;
+			*range_size   = section_values->size;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the block size
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_sparse_map_get_block_size(
+     libvsmbr_sparse_map_t *sparse_map,
+     uint32_t *block_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_sparse_map_t *internal_sparse_map = NULL;
+	static char *function                               = "libvsmbr_sparse_map_get_block_size";
+
+	if( sparse_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sparse map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sparse_map = (libvsmbr_internal_sparse_map_t *) sparse_map;
+
+	if( block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block size.",
+		 function );
+
+		return( -1 );
+	}
+	*block_size = internal_sparse_map->block_size;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the data the sparse map was created of
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_sparse_map_get_data_size(
+     libvsmbr_sparse_map_t *sparse_map,
+     size64_t *data_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_sparse_map_t *internal_sparse_map = NULL;
+	static char *function                               = "libvsmbr_sparse_map_get_data_size";
+
+	if( sparse_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sparse map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sparse_map = (libvsmbr_internal_sparse_map_t *) sparse_map;
+
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = internal_sparse_map->data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the total size of the sparse ranges
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_sparse_map_get_sparse_size(
+     libvsmbr_sparse_map_t *sparse_map,
+     size64_t *sparse_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_sparse_map_t *internal_sparse_map = NULL;
+	static char *function                               = "libvsmbr_sparse_map_get_sparse_size";
+
+	if( sparse_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sparse map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sparse_map = (libvsmbr_internal_sparse_map_t *) sparse_map;
+
+	if( sparse_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sparse size.",
+		 function );
+
+		return( -1 );
+	}
+	*sparse_size = internal_sparse_map->sparse_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of sparse ranges
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_sparse_map_get_number_of_ranges(
+     libvsmbr_sparse_map_t *sparse_map,
+     int *number_of_ranges,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_sparse_map_t *internal_sparse_map = NULL;
+	static char *function                               = "libvsmbr_sparse_map_get_number_of_ranges";
+
+	if( sparse_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sparse map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sparse_map = (libvsmbr_internal_sparse_map_t *) sparse_map;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_sparse_map->ranges_array,
+	     number_of_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of ranges.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific sparse range
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_sparse_map_get_range_by_index(
+     libvsmbr_sparse_map_t *sparse_map,
+     int range_index,
+     off64_t *range_offset,
+     size64_t *range_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_sparse_map_t *internal_sparse_map = NULL;
+	libvsmbr_section_values_t *section_values           = NULL;
+	static char *function                               = "libvsmbr_sparse_map_get_range_by_index";
+
+	if( sparse_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sparse map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sparse_map = (libvsmbr_internal_sparse_map_t *) sparse_map;
+
+	if( range_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_sparse_map->ranges_array,
+	     range_index,
+	     (intptr_t **) &section_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve range: %d.",
+		 function,
+		 range_index );
+
+		return( -1 );
+	}
+	if( section_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing range: %d.",
+		 function,
+		 range_index );
+
+		return( -1 );
+	}
+	*range_offset = section_values->offset;
+	*range_size   = section_values->size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,132 @@
+/*
+ * Sparse map functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSMBR_SPARSE_MAP_H )
+#define _LIBVSMBR_SPARSE_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsmbr_extern.h"
+#include "libvsmbr_libcdata.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsmbr_internal_sparse_map libvsmbr_internal_sparse_map_t;
+
+/* The sparse map is not modified after it has been handed out
+ * hence it does not need a read/write lock
+ */
+struct libvsmbr_internal_sparse_map
+{
+	/* The block size
+	 */
+	uint32_t block_size;
+
+	/* The data size
+	 */
+	size64_t data_size;
+
+	/* The sparse size
+	 */
+	size64_t sparse_size;
+
+	/* The ranges array
+	 */
+	libcdata_array_t *ranges_array;
+};
+
+int libvsmbr_sparse_map_initialize(
+     libvsmbr_sparse_map_t **sparse_map,
+     uint32_t block_size,
+     size64_t data_size,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_sparse_map_free(
+     libvsmbr_sparse_map_t **sparse_map,
+     libcerror_error_t **error );
+
+int libvsmbr_sparse_map_clone(
+     libvsmbr_sparse_map_t **destination_sparse_map,
+     libvsmbr_sparse_map_t *source_sparse_map,
+     libcerror_error_t **error );
+
+int libvsmbr_sparse_map_data_is_zero(
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libvsmbr_sparse_map_append_range(
+     libvsmbr_sparse_map_t *sparse_map,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error );
+
+int libvsmbr_sparse_map_get_range_at_offset(
+     libvsmbr_sparse_map_t *sparse_map,
+     off64_t offset,
+     off64_t *range_offset,
+     size64_t *range_size,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_sparse_map_get_block_size(
+     libvsmbr_sparse_map_t *sparse_map,
+     uint32_t *block_size,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_sparse_map_get_data_size(
+     libvsmbr_sparse_map_t *sparse_map,
+     size64_t *data_size,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_sparse_map_get_sparse_size(
+     libvsmbr_sparse_map_t *sparse_map,
+     size64_t *sparse_size,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_sparse_map_get_number_of_ranges(
+     libvsmbr_sparse_map_t *sparse_map,
+     int *number_of_ranges,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_sparse_map_get_range_by_index(
+     libvsmbr_sparse_map_t *sparse_map,
+     int range_index,
+     off64_t *range_offset,
+     size64_t *range_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSMBR_SPARSE_MAP_H ) */
+
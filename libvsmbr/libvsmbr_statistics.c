@@ -0,0 +1,720 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#endif
+
+#if defined( HAVE_TIME_H )
+#include <time.h>
+#endif
+
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_statistics.h"
+#include "libvsmbr_types.h"
+
+/* Creates statistics
+ * Make sure the value statistics is referencing, is set to NULL
+ * Every update of the statistics is also applied to the parent statistics if set
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_statistics_initialize(
+     libvsmbr_statistics_t **statistics,
+     libvsmbr_statistics_t *parent_statistics,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_statistics_t *internal_statistics = NULL;
+	static char *function                               = "libvsmbr_statistics_initialize";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( *statistics != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid statistics value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_statistics = memory_allocate_structure(
+	                       libvsmbr_internal_statistics_t );
+
+	if( internal_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_statistics,
+	     0,
+	     sizeof( libvsmbr_internal_statistics_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
+
+		goto on_error;
+	}
+	internal_statistics->parent_statistics = (libvsmbr_internal_statistics_t *) parent_statistics;
+
+	*statistics = (libvsmbr_statistics_t *) internal_statistics;
+
+	return( 1 );
+
+on_error:
+	if( internal_statistics != NULL )
+	{
+		memory_free(
+		 internal_statistics );
+	}
+	return( -1 );
+}
+
+/* Frees statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_statistics_free(
+     libvsmbr_statistics_t **statistics,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_statistics_t *internal_statistics = NULL;
+	static char *function                               = "libvsmbr_statistics_free";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( *statistics != NULL )
+	{
+		internal_statistics = (libvsmbr_internal_statistics_t *) *statistics;
+		*statistics         = NULL;
+
+		memory_free(
+		 internal_statistics );
+	}
+	return( 1 );
+}
+
+/* Clones statistics
+ * The destination statistics are a snapshot of the counters of the source
+ * statistics and have no parent statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_statistics_clone(
+     libvsmbr_statistics_t **destination_statistics,
+     libvsmbr_statistics_t *source_statistics,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_statistics_t *internal_destination_statistics = NULL;
+	libvsmbr_internal_statistics_t *internal_source_statistics      = NULL;
+	libvsmbr_statistics_t *safe_destination_statistics              = NULL;
+	static char *function                                           = "libvsmbr_statistics_clone";
+
+	if( destination_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_statistics != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination statistics value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_source_statistics = (libvsmbr_internal_statistics_t *) source_statistics;
+
+	if( libvsmbr_statistics_initialize(
+	     &safe_destination_statistics,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_destination_statistics = (libvsmbr_internal_statistics_t *) safe_destination_statistics;
+
+	/* The cache misses are read before the cache lookups, since the lookups
+	 * are counted after the misses they caused, the number of misses cannot
+	 * exceed the number of lookups in the snapshot
+	 */
+	internal_destination_statistics->number_of_cache_misses    = libvsmbr_statistics_atomic_load( &( internal_source_statistics->number_of_cache_misses ) );
+	internal_destination_statistics->number_of_cache_evictions = libvsmbr_statistics_atomic_load( &( internal_source_statistics->number_of_cache_evictions ) );
+	internal_destination_statistics->number_of_cache_lookups   = libvsmbr_statistics_atomic_load( &( internal_source_statistics->number_of_cache_lookups ) );
+	internal_destination_statistics->number_of_backing_reads   = libvsmbr_statistics_atomic_load( &( internal_source_statistics->number_of_backing_reads ) );
+	internal_destination_statistics->backing_bytes_read        = libvsmbr_statistics_atomic_load( &( internal_source_statistics->backing_bytes_read ) );
+	internal_destination_statistics->bytes_delivered           = libvsmbr_statistics_atomic_load( &( internal_source_statistics->bytes_delivered ) );
+	internal_destination_statistics->io_wait_time              = libvsmbr_statistics_atomic_load( &( internal_source_statistics->io_wait_time ) );
+
+	*destination_statistics = safe_destination_statistics;
+
+	return( 1 );
+}
+
+/* Retrieves the current time of a monotonic clock in nano seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_statistics_get_current_time(
+     uint64_t *current_time,
+     libcerror_error_t **error )
+{
+	static char *function   = "libvsmbr_statistics_get_current_time";
+
+#if defined( WINAPI )
+	LARGE_INTEGER counter   = { 0 };
+	LARGE_INTEGER frequency = { 0 };
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+#elif defined( HAVE_GETTIMEOFDAY )
+	struct timeval time_value;
+
+#endif
+
+	if( current_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( QueryPerformanceCounter(
+	       &counter ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve performance counter.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = ( (uint64_t) ( counter.QuadPart / frequency.QuadPart ) * 1000000000UL )
+	              + ( (uint64_t) ( counter.QuadPart % frequency.QuadPart ) * 1000000000UL / (uint64_t) frequency.QuadPart );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve monotonic clock time.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec;
+
+#elif defined( HAVE_GETTIMEOFDAY )
+	if( gettimeofday(
+	     &time_value,
+	     NULL ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve time of day.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = ( (uint64_t) time_value.tv_sec * 1000000000UL ) + ( (uint64_t) time_value.tv_usec * 1000 );
+
+#else
+	/* Without a clock the time blocked in IO is not measured
+	 */
+	*current_time = 0;
+
+#endif
+	return( 1 );
+}
+
+/* Adds a read of the backing file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_statistics_add_backing_read(
+     libvsmbr_statistics_t *statistics,
+     size_t read_size,
+     uint64_t io_wait_time,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_statistics_t *internal_statistics = NULL;
+	static char *function                               = "libvsmbr_statistics_add_backing_read";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	for( internal_statistics = (libvsmbr_internal_statistics_t *) statistics;
+	     internal_statistics != NULL;
+	     internal_statistics = internal_statistics->parent_statistics )
+	{
+		libvsmbr_statistics_atomic_add( &( internal_statistics->number_of_backing_reads ), 1 );
+		libvsmbr_statistics_atomic_add( &( internal_statistics->backing_bytes_read ), (uint64_t) read_size );
+		libvsmbr_statistics_atomic_add( &( internal_statistics->io_wait_time ), io_wait_time );
+	}
+	return( 1 );
+}
+
+/* Adds a sector cache miss
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_statistics_add_cache_miss(
+     libvsmbr_statistics_t *statistics,
+     uint8_t is_eviction,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_statistics_t *internal_statistics = NULL;
+	static char *function                               = "libvsmbr_statistics_add_cache_miss";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	for( internal_statistics = (libvsmbr_internal_statistics_t *) statistics;
+	     internal_statistics != NULL;
+	     internal_statistics = internal_statistics->parent_statistics )
+	{
+		libvsmbr_statistics_atomic_add( &( internal_statistics->number_of_cache_misses ), 1 );
+
+		if( is_eviction != 0 )
+		{
+			libvsmbr_statistics_atomic_add( &( internal_statistics->number_of_cache_evictions ), 1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Adds data delivered to a caller
+ * The number of sector cache lookups is added once per read, after the
+ * misses of the read have been added
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_statistics_add_delivered(
+     libvsmbr_statistics_t *statistics,
+     uint64_t number_of_cache_lookups,
+     size_t bytes_delivered,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_statistics_t *internal_statistics = NULL;
+	static char *function                               = "libvsmbr_statistics_add_delivered";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	for( internal_statistics = (libvsmbr_internal_statistics_t *) statistics;
+	     internal_statistics != NULL;
+	     internal_statistics = internal_statistics->parent_statistics )
+	{
+		libvsmbr_statistics_atomic_add( &( internal_statistics->number_of_cache_lookups ), number_of_cache_lookups );
+		libvsmbr_statistics_atomic_add( &( internal_statistics->bytes_delivered ), (uint64_t) bytes_delivered );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of reads issued to the backing file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_statistics_get_number_of_backing_reads(
+     libvsmbr_statistics_t *statistics,
+     uint64_t *number_of_backing_reads,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_statistics_t *internal_statistics = NULL;
+	static char *function                               = "libvsmbr_statistics_get_number_of_backing_reads";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_statistics = (libvsmbr_internal_statistics_t *) statistics;
+
+	if( number_of_backing_reads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of backing reads.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_backing_reads = libvsmbr_statistics_atomic_load( &( internal_statistics->number_of_backing_reads ) );
+
+	return( 1 );
+}
+
+/* Retrieves the number of bytes read from the backing file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_statistics_get_backing_bytes_read(
+     libvsmbr_statistics_t *statistics,
+     uint64_t *backing_bytes_read,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_statistics_t *internal_statistics = NULL;
+	static char *function                               = "libvsmbr_statistics_get_backing_bytes_read";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_statistics = (libvsmbr_internal_statistics_t *) statistics;
+
+	if( backing_bytes_read == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid backing bytes read.",
+		 function );
+
+		return( -1 );
+	}
+	*backing_bytes_read = libvsmbr_statistics_atomic_load( &( internal_statistics->backing_bytes_read ) );
+
+	return( 1 );
+}
+
+/* Retrieves the number of bytes delivered to callers
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_statistics_get_bytes_delivered(
+     libvsmbr_statistics_t *statistics,
+     uint64_t *bytes_delivered,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_statistics_t *internal_statistics = NULL;
+	static char *function                               = "libvsmbr_statistics_get_bytes_delivered";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_statistics = (libvsmbr_internal_statistics_t *) statistics;
+
+	if( bytes_delivered == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bytes delivered.",
+		 function );
+
+		return( -1 );
+	}
+	*bytes_delivered = libvsmbr_statistics_atomic_load( &( internal_statistics->bytes_delivered ) );
+
+	return( 1 );
+}
+
+/* Retrieves the number of sector cache hits
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_statistics_get_number_of_cache_hits(
+     libvsmbr_statistics_t *statistics,
+     uint64_t *number_of_cache_hits,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_statistics_t *internal_statistics = NULL;
+	static char *function                               = "libvsmbr_statistics_get_number_of_cache_hits";
+	uint64_t number_of_cache_lookups                    = 0;
+	uint64_t number_of_cache_misses                     = 0;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_statistics = (libvsmbr_internal_statistics_t *) statistics;
+
+	if( number_of_cache_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of cache hits.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every sector cache lookup that did not miss was a hit
+	 */
+	number_of_cache_misses  = libvsmbr_statistics_atomic_load( &( internal_statistics->number_of_cache_misses ) );
+	number_of_cache_lookups = libvsmbr_statistics_atomic_load( &( internal_statistics->number_of_cache_lookups ) );
+
+	if( number_of_cache_lookups > number_of_cache_misses )
+	{
+		*number_of_cache_hits = number_of_cache_lookups - number_of_cache_misses;
+	}
+	else
+	{
+		*number_of_cache_hits = 0;
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of sector cache misses
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_statistics_get_number_of_cache_misses(
+     libvsmbr_statistics_t *statistics,
+     uint64_t *number_of_cache_misses,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_statistics_t *internal_statistics = NULL;
+	static char *function                               = "libvsmbr_statistics_get_number_of_cache_misses";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_statistics = (libvsmbr_internal_statistics_t *) statistics;
+
+	if( number_of_cache_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of cache misses.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_cache_misses = libvsmbr_statistics_atomic_load( &( internal_statistics->number_of_cache_misses ) );
+
+	return( 1 );
+}
+
+/* Retrieves the number of sector cache evictions
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_statistics_get_number_of_cache_evictions(
+     libvsmbr_statistics_t *statistics,
+     uint64_t *number_of_cache_evictions,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_statistics_t *internal_statistics = NULL;
+	static char *function                               = "libvsmbr_statistics_get_number_of_cache_evictions";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_statistics = (libvsmbr_internal_statistics_t *) statistics;
+
+	if( number_of_cache_evictions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of cache evictions.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_cache_evictions = libvsmbr_statistics_atomic_load( &( internal_statistics->number_of_cache_evictions ) );
+
+	return( 1 );
+}
+
+/* Retrieves the cumulative time blocked in reads of the backing file IO handle
+ * The time is in nano seconds and 0 if no clock is available
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_statistics_get_io_wait_time(
+     libvsmbr_statistics_t *statistics,
+     uint64_t *io_wait_time,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_statistics_t *internal_statistics = NULL;
+	static char *function                               = "libvsmbr_statistics_get_io_wait_time";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_statistics = (libvsmbr_internal_statistics_t *) statistics;
+
+	if( io_wait_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO wait time.",
+		 function );
+
+		return( -1 );
+	}
+	*io_wait_time = libvsmbr_statistics_atomic_load( &( internal_statistics->io_wait_time ) );
+
+	return( 1 );
+}
+
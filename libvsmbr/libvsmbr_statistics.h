@@ -0,0 +1,186 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSMBR_STATISTICS_H )
+#define _LIBVSMBR_STATISTICS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsmbr_extern.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The counters are updated by concurrent readers without holding a lock
+ * relaxed atomic operations are sufficient since the counters do not
+ * order any other memory access
+ */
+#if defined( __ATOMIC_RELAXED )
+#define libvsmbr_statistics_atomic_add( value, increment ) \
+	__atomic_fetch_add( value, increment, __ATOMIC_RELAXED )
+
+#define libvsmbr_statistics_atomic_load( value ) \
+	__atomic_load_n( value, __ATOMIC_RELAXED )
+
+#elif defined( WINAPI ) && defined( _WIN64 )
+#define libvsmbr_statistics_atomic_add( value, increment ) \
+	InterlockedExchangeAdd64( (volatile LONG64 *) value, (LONG64) increment )
+
+#define libvsmbr_statistics_atomic_load( value ) \
+	( *( (volatile uint64_t *) ( value ) ) )
+
+#else
+/* Without atomic operations concurrent updates of the counters can be lost
+ */
+#define libvsmbr_statistics_atomic_add( value, increment ) \
+	*( value ) += ( increment )
+
+#define libvsmbr_statistics_atomic_load( value ) \
+	( *( (volatile uint64_t *) ( value ) ) )
+
+#endif /* defined( __ATOMIC_RELAXED ) */
+
+typedef struct libvsmbr_internal_statistics libvsmbr_internal_statistics_t;
+
+struct libvsmbr_internal_statistics
+{
+	/* The parent statistics, which also receive every update
+	 */
+	libvsmbr_internal_statistics_t *parent_statistics;
+
+	/* The number of reads issued to the backing file IO handle
+	 */
+	uint64_t number_of_backing_reads;
+
+	/* The number of bytes read from the backing file IO handle
+	 */
+	uint64_t backing_bytes_read;
+
+	/* The number of bytes delivered to callers
+	 */
+	uint64_t bytes_delivered;
+
+	/* The number of sector cache lookups
+	 */
+	uint64_t number_of_cache_lookups;
+
+	/* The number of sector cache misses
+	 */
+	uint64_t number_of_cache_misses;
+
+	/* The number of sector cache evictions
+	 */
+	uint64_t number_of_cache_evictions;
+
+	/* The cumulative time blocked in reads of the backing file IO handle
+	 * in nano seconds
+	 */
+	uint64_t io_wait_time;
+};
+
+int libvsmbr_statistics_initialize(
+     libvsmbr_statistics_t **statistics,
+     libvsmbr_statistics_t *parent_statistics,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_statistics_free(
+     libvsmbr_statistics_t **statistics,
+     libcerror_error_t **error );
+
+int libvsmbr_statistics_clone(
+     libvsmbr_statistics_t **destination_statistics,
+     libvsmbr_statistics_t *source_statistics,
+     libcerror_error_t **error );
+
+int libvsmbr_statistics_get_current_time(
+     uint64_t *current_time,
+     libcerror_error_t **error );
+
+int libvsmbr_statistics_add_backing_read(
+     libvsmbr_statistics_t *statistics,
+     size_t read_size,
+     uint64_t io_wait_time,
+     libcerror_error_t **error );
+
+int libvsmbr_statistics_add_cache_miss(
+     libvsmbr_statistics_t *statistics,
+     uint8_t is_eviction,
+     libcerror_error_t **error );
+
+int libvsmbr_statistics_add_delivered(
+     libvsmbr_statistics_t *statistics,
+     uint64_t number_of_cache_lookups,
+     size_t bytes_delivered,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_statistics_get_number_of_backing_reads(
+     libvsmbr_statistics_t *statistics,
+     uint64_t *number_of_backing_reads,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_statistics_get_backing_bytes_read(
+     libvsmbr_statistics_t *statistics,
+     uint64_t *backing_bytes_read,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_statistics_get_bytes_delivered(
+     libvsmbr_statistics_t *statistics,
+     uint64_t *bytes_delivered,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_statistics_get_number_of_cache_hits(
+     libvsmbr_statistics_t *statistics,
+     uint64_t *number_of_cache_hits,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_statistics_get_number_of_cache_misses(
+     libvsmbr_statistics_t *statistics,
+     uint64_t *number_of_cache_misses,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_statistics_get_number_of_cache_evictions(
+     libvsmbr_statistics_t *statistics,
+     uint64_t *number_of_cache_evictions,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_statistics_get_io_wait_time(
+     libvsmbr_statistics_t *statistics,
+     uint64_t *io_wait_time,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSMBR_STATISTICS_H ) */
+
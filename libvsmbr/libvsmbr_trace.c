@@ -0,0 +1,796 @@
+/*
+ * Trace functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "libvsmbr_definitions.h"
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_libcthreads.h"
+#include "libvsmbr_statistics.h"
+#include "libvsmbr_trace.h"
+
+#include "vsmbr_trace.h"
+
+const uint8_t vsmbr_trace_signature[ 8 ] = {
+	'V', 'S', 'M', 'B', 'R', 'T', 'R', 'C' };
+
+/* Creates a trace
+ * Make sure the value trace is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_trace_initialize(
+     libvsmbr_trace_t **trace,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_trace_initialize";
+
+	if( trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace.",
+		 function );
+
+		return( -1 );
+	}
+	if( *trace != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid trace value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*trace = memory_allocate_structure(
+	          libvsmbr_trace_t );
+
+	if( *trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create trace.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *trace,
+	     0,
+	     sizeof( libvsmbr_trace_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear trace.",
+		 function );
+
+		memory_free(
+		 *trace );
+
+		*trace = NULL;
+
+		return( -1 );
+	}
+	( *trace )->buffer = (uint8_t *) memory_allocate(
+	                                  sizeof( uint8_t ) * LIBVSMBR_TRACE_BUFFER_SIZE );
+
+	if( ( *trace )->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *trace )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *trace != NULL )
+	{
+		if( ( *trace )->buffer != NULL )
+		{
+			memory_free(
+			 ( *trace )->buffer );
+		}
+		memory_free(
+		 *trace );
+
+		*trace = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a trace
+ * An active trace is stopped first
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_trace_free(
+     libvsmbr_trace_t **trace,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_trace_free";
+	int result            = 1;
+
+	if( trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace.",
+		 function );
+
+		return( -1 );
+	}
+	if( *trace != NULL )
+	{
+		if( libvsmbr_trace_stop(
+		     *trace,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to stop trace.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *trace )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 ( *trace )->buffer );
+
+		memory_free(
+		 *trace );
+
+		*trace = NULL;
+	}
+	return( result );
+}
+
+/* Starts the trace
+ * The file header is written at the start of the file IO handle, which
+ * is opened for writing if it is not open
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_trace_start(
+     libvsmbr_trace_t *trace,
+     libbfio_handle_t *file_io_handle,
+     uint8_t file_io_handle_created_in_library,
+     uint32_t bytes_per_sector,
+     libcerror_error_t **error )
+{
+	vsmbr_trace_file_header_t file_header;
+
+	static char *function      = "libvsmbr_trace_start";
+	ssize_t write_count        = 0;
+	int file_io_handle_is_open = 0;
+	int result                 = 1;
+
+	if( trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     trace->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( trace->is_active != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid trace - already active.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_WRITE_TRUNCATE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		trace->file_io_handle_opened_in_library = 1;
+	}
+	if( memory_set(
+	     &file_header,
+	     0,
+	     sizeof( vsmbr_trace_file_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     file_header.signature,
+	     vsmbr_trace_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.format_version,
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.record_size,
+	 (uint32_t) sizeof( vsmbr_trace_record_t ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.bytes_per_sector,
+	 bytes_per_sector );
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               file_io_handle,
+	               (uint8_t *) &file_header,
+	               sizeof( vsmbr_trace_file_header_t ),
+	               0,
+	               error );
+
+	if( write_count != (ssize_t) sizeof( vsmbr_trace_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_statistics_get_current_time(
+	     &( trace->start_time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve start time.",
+		 function );
+
+		goto on_error;
+	}
+	trace->file_io_handle                    = file_io_handle;
+	trace->file_io_handle_created_in_library = file_io_handle_created_in_library;
+	trace->file_offset                       = (off64_t) sizeof( vsmbr_trace_file_header_t );
+	trace->buffer_data_size                  = 0;
+	trace->is_active                         = 1;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     trace->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+	if( trace->file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+
+		trace->file_io_handle_opened_in_library = 0;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 trace->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Stops the trace
+ * The buffered records are written and the file IO handle is closed
+ * if it was opened in the library
+ * Returns 1 if successful, 0 if the trace was not active or -1 on error
+ */
+int libvsmbr_trace_stop(
+     libvsmbr_trace_t *trace,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_trace_stop";
+	int result            = 1;
+
+	if( trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     trace->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( trace->is_active == 0 )
+	{
+		result = 0;
+	}
+	else
+	{
+		trace->is_active = 0;
+
+		if( libvsmbr_trace_flush(
+		     trace,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush trace.",
+			 function );
+
+			result = -1;
+		}
+		if( trace->file_io_handle_opened_in_library != 0 )
+		{
+			if( libbfio_handle_close(
+			     trace->file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle.",
+				 function );
+
+				result = -1;
+			}
+			trace->file_io_handle_opened_in_library = 0;
+		}
+		if( trace->file_io_handle_created_in_library != 0 )
+		{
+			if( libbfio_handle_free(
+			     &( trace->file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle.",
+				 function );
+
+				result = -1;
+			}
+			trace->file_io_handle_created_in_library = 0;
+		}
+		trace->file_io_handle = NULL;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     trace->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Writes the buffered records to the file IO handle
+ * This function is not multi-thread safe acquire mutex before call
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_trace_flush(
+     libvsmbr_trace_t *trace,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_trace_flush";
+	ssize_t write_count   = 0;
+
+	if( trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace.",
+		 function );
+
+		return( -1 );
+	}
+	if( trace->buffer_data_size == 0 )
+	{
+		return( 1 );
+	}
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               trace->file_io_handle,
+	               trace->buffer,
+	               trace->buffer_data_size,
+	               trace->file_offset,
+	               error );
+
+	if( write_count != (ssize_t) trace->buffer_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write records at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 trace->file_offset,
+		 trace->file_offset );
+
+		return( -1 );
+	}
+	trace->file_offset     += (off64_t) trace->buffer_data_size;
+	trace->buffer_data_size = 0;
+
+	return( 1 );
+}
+
+/* Retrieves an identifier of the current thread
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_trace_get_thread_identifier(
+     uint32_t *thread_identifier,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	pthread_t thread          = pthread_self();
+	uint64_t thread_value     = 0;
+	size_t byte_index         = 0;
+#endif
+	static char *function     = "libvsmbr_trace_get_thread_identifier";
+
+	if( thread_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread identifier.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	*thread_identifier = (uint32_t) GetCurrentThreadId();
+
+#elif defined( HAVE_PTHREAD_H )
+	/* The pthread_t type is opaque hence its bytes are folded
+	 */
+	for( byte_index = 0;
+	     byte_index < sizeof( pthread_t );
+	     byte_index++ )
+	{
+		thread_value = ( thread_value * 31 ) + ( (uint8_t *) &thread )[ byte_index ];
+	}
+	*thread_identifier = (uint32_t) ( thread_value ^ ( thread_value >> 32 ) );
+
+#else
+	*thread_identifier = 0;
+
+#endif
+	return( 1 );
+}
+
+/* Appends a record to the trace
+ * The record is only appended if the trace is active
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_trace_append_record(
+     libvsmbr_trace_t *trace,
+     uint8_t record_type,
+     uint32_t partition_index,
+     uint64_t offset,
+     size_t size,
+     libcerror_error_t **error )
+{
+	vsmbr_trace_record_t *record = NULL;
+	static char *function        = "libvsmbr_trace_append_record";
+	uint64_t current_time        = 0;
+	uint32_t thread_identifier   = 0;
+	int result                   = 1;
+
+	if( trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace.",
+		 function );
+
+		return( -1 );
+	}
+	if( trace->is_active == 0 )
+	{
+		return( 1 );
+	}
+	if( libvsmbr_trace_get_thread_identifier(
+	     &thread_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve thread identifier.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     trace->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The trace could have been stopped while waiting for the mutex
+	 */
+	if( trace->is_active != 0 )
+	{
+		/* The time is retrieved while holding the mutex so that
+		 * the timestamps of the records are in order
+		 */
+		if( libvsmbr_statistics_get_current_time(
+		     &current_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve current time.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			if( current_time < trace->start_time )
+			{
+				current_time = trace->start_time;
+			}
+			if( size > (size_t) UINT32_MAX )
+			{
+				size = (size_t) UINT32_MAX;
+			}
+			record = (vsmbr_trace_record_t *) &( trace->buffer[ trace->buffer_data_size ] );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 record->timestamp,
+			 current_time - trace->start_time );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 record->offset,
+			 offset );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 record->size,
+			 (uint32_t) size );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 record->thread_identifier,
+			 thread_identifier );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 record->partition_index,
+			 partition_index );
+
+			record->record_type = record_type;
+
+			record->unknown1[ 0 ] = 0;
+			record->unknown1[ 1 ] = 0;
+			record->unknown1[ 2 ] = 0;
+
+			trace->buffer_data_size += sizeof( vsmbr_trace_record_t );
+
+			if( ( trace->buffer_data_size + sizeof( vsmbr_trace_record_t ) ) > LIBVSMBR_TRACE_BUFFER_SIZE )
+			{
+				if( libvsmbr_trace_flush(
+				     trace,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to flush trace.",
+					 function );
+
+					result = -1;
+				}
+			}
+		}
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     trace->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,121 @@
+/*
+ * Trace functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSMBR_TRACE_H )
+#define _LIBVSMBR_TRACE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsmbr_trace libvsmbr_trace_t;
+
+struct libvsmbr_trace
+{
+	/* The file IO handle the trace is written to
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* Value to indicate if the file IO handle was created inside the library
+	 */
+	uint8_t file_io_handle_created_in_library;
+
+	/* Value to indicate if the file IO handle was opened inside the library
+	 */
+	uint8_t file_io_handle_opened_in_library;
+
+	/* The offset of the next write in the file IO handle
+	 */
+	off64_t file_offset;
+
+	/* The start time of the trace in nano seconds
+	 */
+	uint64_t start_time;
+
+	/* The records buffer
+	 */
+	uint8_t *buffer;
+
+	/* The size of the records in the buffer
+	 */
+	size_t buffer_data_size;
+
+	/* Value to indicate if the trace is active
+	 * The value is read without holding the mutex, similar to the abort
+	 * value, so that an inactive trace does not add locking to the read path
+	 */
+	uint8_t is_active;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libvsmbr_trace_initialize(
+     libvsmbr_trace_t **trace,
+     libcerror_error_t **error );
+
+int libvsmbr_trace_free(
+     libvsmbr_trace_t **trace,
+     libcerror_error_t **error );
+
+int libvsmbr_trace_start(
+     libvsmbr_trace_t *trace,
+     libbfio_handle_t *file_io_handle,
+     uint8_t file_io_handle_created_in_library,
+     uint32_t bytes_per_sector,
+     libcerror_error_t **error );
+
+int libvsmbr_trace_stop(
+     libvsmbr_trace_t *trace,
+     libcerror_error_t **error );
+
+int libvsmbr_trace_flush(
+     libvsmbr_trace_t *trace,
+     libcerror_error_t **error );
+
+int libvsmbr_trace_get_thread_identifier(
+     uint32_t *thread_identifier,
+     libcerror_error_t **error );
+
+int libvsmbr_trace_append_record(
+     libvsmbr_trace_t *trace,
+     uint8_t record_type,
+     uint32_t partition_index,
+     uint64_t offset,
+     size_t size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSMBR_TRACE_H ) */
+
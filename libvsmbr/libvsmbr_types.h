@@ -34,11 +34,27 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
-typedef struct libvsmbr_partition {}	libvsmbr_partition_t;
-typedef struct libvsmbr_volume {}	libvsmbr_volume_t;
+typedef struct libvsmbr_block_hash_index {}	libvsmbr_block_hash_index_t;
+typedef struct libvsmbr_cache_arena {}		libvsmbr_cache_arena_t;
+typedef struct libvsmbr_chunk_reader {}		libvsmbr_chunk_reader_t;
+typedef struct libvsmbr_entropy_map {}		libvsmbr_entropy_map_t;
+typedef struct libvsmbr_handle_pool {}		libvsmbr_handle_pool_t;
+typedef struct libvsmbr_image_builder {}	libvsmbr_image_builder_t;
+typedef struct libvsmbr_partition {}		libvsmbr_partition_t;
+typedef struct libvsmbr_sparse_map {}		libvsmbr_sparse_map_t;
+typedef struct libvsmbr_statistics {}		libvsmbr_statistics_t;
+typedef struct libvsmbr_volume {}		libvsmbr_volume_t;
 
 #else
+typedef intptr_t libvsmbr_block_hash_index_t;
+typedef intptr_t libvsmbr_cache_arena_t;
+typedef intptr_t libvsmbr_chunk_reader_t;
+typedef intptr_t libvsmbr_entropy_map_t;
+typedef intptr_t libvsmbr_handle_pool_t;
+typedef intptr_t libvsmbr_image_builder_t;
 typedef intptr_t libvsmbr_partition_t;
+typedef intptr_t libvsmbr_sparse_map_t;
+typedef intptr_t libvsmbr_statistics_t;
 typedef intptr_t libvsmbr_volume_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
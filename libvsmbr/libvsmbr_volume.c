@@ -25,19 +25,31 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "libvsmbr_block_cache_io_handle.h"
 #include "libvsmbr_boot_record.h"
+#include "libvsmbr_compressed_io_handle.h"
+#include "libvsmbr_data_mover.h"
 #include "libvsmbr_debug.h"
 #include "libvsmbr_definitions.h"
+#include "libvsmbr_handle_pool.h"
 #include "libvsmbr_volume.h"
 #include "libvsmbr_io_handle.h"
 #include "libvsmbr_libbfio.h"
 #include "libvsmbr_libcerror.h"
 #include "libvsmbr_libcnotify.h"
+#include "libvsmbr_move_journal.h"
+#include "libvsmbr_overlay_io_handle.h"
 #include "libvsmbr_partition.h"
 #include "libvsmbr_partition_entry.h"
 #include "libvsmbr_partition_values.h"
 #include "libvsmbr_section_values.h"
+#include "libvsmbr_segments_io_handle.h"
+#include "libvsmbr_statistics.h"
+#include "libvsmbr_trace.h"
 #include "libvsmbr_types.h"
+#include "libvsmbr_write_cache.h"
+
+#include "vsmbr_boot_record.h"
 
 /* Creates a volume
  * Make sure the value volume is referencing, is set to NULL
@@ -208,6 +220,38 @@ int libvsmbr_volume_free(
 		}
 		*volume = NULL;
 
+		if( internal_volume->overlay_file_io_handle_created_in_library != 0 )
+		{
+			if( libbfio_handle_free(
+			     &( internal_volume->overlay_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free overlay file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_volume->block_cache_file_io_handle_created_in_library != 0 )
+		{
+			if( libbfio_handle_free(
+			     &( internal_volume->block_cache_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free block cache file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
 #if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
 		if( libcthreads_read_write_lock_free(
 		     &( internal_volume->read_write_lock ),
@@ -308,6 +352,7 @@ int libvsmbr_volume_open(
 	libvsmbr_internal_volume_t *internal_volume = NULL;
 	static char *function                       = "libvsmbr_volume_open";
 	size_t filename_length                      = 0;
+	uint8_t file_io_handle_is_file              = 0;
 
 	if( volume == NULL )
 	{
@@ -345,29 +390,73 @@ int libvsmbr_volume_open(
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBVSMBR_ACCESS_FLAG_WRITE ) != 0 )
+	if( ( access_flags & LIBVSMBR_ACCESS_FLAG_READ ) == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 "%s: write access without read access currently not supported.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( internal_volume->handle_pool != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
-		 function );
+		/* The file is opened on demand by the handle pool
+		 */
+		if( libvsmbr_handle_pool_register_file(
+		     internal_volume->handle_pool,
+		     filename,
+		     filename_length,
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to register file in handle pool.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libbfio_file_initialize(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_is_file = 1;
+
+		if( libbfio_file_set_name(
+		     file_io_handle,
+		     filename,
+		     filename_length + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libbfio_handle_set_track_offsets_read(
@@ -385,24 +474,6 @@ int libvsmbr_volume_open(
 		goto on_error;
 	}
 #endif
-	filename_length = narrow_string_length(
-	                   filename );
-
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set filename in file IO handle.",
-		 function );
-
-		goto on_error;
-	}
 	if( libvsmbr_volume_open_file_io_handle(
 	     volume,
 	     file_io_handle,
@@ -435,6 +506,7 @@ int libvsmbr_volume_open(
 	}
 #endif
 	internal_volume->file_io_handle_created_in_library = 1;
+	internal_volume->file_io_handle_is_file            = file_io_handle_is_file;
 
 #if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -478,6 +550,7 @@ int libvsmbr_volume_open_wide(
 	libvsmbr_internal_volume_t *internal_volume = NULL;
 	static char *function                       = "libvsmbr_volume_open_wide";
 	size_t filename_length                      = 0;
+	uint8_t file_io_handle_is_file              = 0;
 
 	if( volume == NULL )
 	{
@@ -515,29 +588,73 @@ int libvsmbr_volume_open_wide(
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBVSMBR_ACCESS_FLAG_WRITE ) != 0 )
+	if( ( access_flags & LIBVSMBR_ACCESS_FLAG_READ ) == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 "%s: write access without read access currently not supported.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( internal_volume->handle_pool != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
-		 function );
+		/* The file is opened on demand by the handle pool
+		 */
+		if( libvsmbr_handle_pool_register_file_wide(
+		     internal_volume->handle_pool,
+		     filename,
+		     filename_length,
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to register file in handle pool.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libbfio_file_initialize(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_is_file = 1;
+
+		if( libbfio_file_set_name_wide(
+		     file_io_handle,
+		     filename,
+		     filename_length + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libbfio_handle_set_track_offsets_read(
@@ -555,24 +672,6 @@ int libvsmbr_volume_open_wide(
 		goto on_error;
 	}
 #endif
-	filename_length = wide_string_length(
-	                   filename );
-
-	if( libbfio_file_set_name_wide(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set filename in file IO handle.",
-		 function );
-
-		goto on_error;
-	}
 	if( libvsmbr_volume_open_file_io_handle(
 	     volume,
 	     file_io_handle,
@@ -605,6 +704,7 @@ int libvsmbr_volume_open_wide(
 	}
 #endif
 	internal_volume->file_io_handle_created_in_library = 1;
+	internal_volume->file_io_handle_is_file            = file_io_handle_is_file;
 
 #if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -644,6 +744,8 @@ int libvsmbr_volume_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *block_cache_io_handle     = NULL;
+	libbfio_handle_t *overlay_io_handle         = NULL;
 	libvsmbr_internal_volume_t *internal_volume = NULL;
 	static char *function                       = "libvsmbr_volume_open_file_io_handle";
 	uint8_t file_io_handle_opened_in_library    = 0;
@@ -697,13 +799,29 @@ int libvsmbr_volume_open_file_io_handle(
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBVSMBR_ACCESS_FLAG_WRITE ) != 0 )
+	if( ( access_flags & LIBVSMBR_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access without read access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	/* The block cache is only used when the volume file is not written,
+	 * which is the case when writes are redirected to an overlay
+	 */
+	if( ( ( access_flags & LIBVSMBR_ACCESS_FLAG_WRITE ) != 0 )
+	 && ( internal_volume->block_cache_file_io_handle != NULL )
+	 && ( internal_volume->overlay_file_io_handle == NULL ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 "%s: write access with block cache currently not supported.",
 		 function );
 
 		return( -1 );
@@ -712,6 +830,13 @@ int libvsmbr_volume_open_file_io_handle(
 	{
 		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
 	}
+	/* Writes are redirected to the overlay file IO handle if set
+	 */
+	if( ( ( access_flags & LIBVSMBR_ACCESS_FLAG_WRITE ) != 0 )
+	 && ( internal_volume->overlay_file_io_handle == NULL ) )
+	{
+		bfio_access_flags |= LIBBFIO_ACCESS_FLAG_WRITE;
+	}
 	file_io_handle_is_open = libbfio_handle_is_open(
 	                          file_io_handle,
 	                          error );
@@ -745,9 +870,45 @@ int libvsmbr_volume_open_file_io_handle(
 		}
 		file_io_handle_opened_in_library = 1;
 	}
+	/* The partition table is read through the block cache so that
+	 * it is also read from the block cache file in a later session
+	 */
+	if( internal_volume->block_cache_file_io_handle != NULL )
+	{
+		if( libvsmbr_block_cache_initialize(
+		     &block_cache_io_handle,
+		     file_io_handle,
+		     internal_volume->block_cache_file_io_handle,
+		     internal_volume->maximum_block_cache_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create block cache IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_handle_open(
+		     block_cache_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open block cache IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( libvsmbr_internal_volume_open_read(
 	     internal_volume,
-	     file_io_handle,
+	     ( block_cache_io_handle != NULL ) ? block_cache_io_handle : file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -759,6 +920,42 @@ int libvsmbr_volume_open_file_io_handle(
 
 		goto on_error;
 	}
+	if( ( ( access_flags & LIBVSMBR_ACCESS_FLAG_WRITE ) != 0 )
+	 && ( internal_volume->overlay_file_io_handle != NULL ) )
+	{
+		/* The overlay is stacked on the block cache so that the blocks
+		 * that are not overlaid are still read from the block cache
+		 */
+		if( libvsmbr_overlay_initialize(
+		     &overlay_io_handle,
+		     ( block_cache_io_handle != NULL ) ? block_cache_io_handle : file_io_handle,
+		     internal_volume->overlay_file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create overlay IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_handle_open(
+		     overlay_io_handle,
+		     LIBBFIO_OPEN_READ_WRITE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open overlay IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
 #if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
@@ -774,8 +971,23 @@ int libvsmbr_volume_open_file_io_handle(
 		return( -1 );
 	}
 #endif
-	internal_volume->file_io_handle                   = file_io_handle;
+	if( overlay_io_handle != NULL )
+	{
+		internal_volume->base_file_io_handle   = file_io_handle;
+		internal_volume->block_cache_io_handle = block_cache_io_handle;
+		internal_volume->file_io_handle        = overlay_io_handle;
+	}
+	else if( block_cache_io_handle != NULL )
+	{
+		internal_volume->base_file_io_handle = file_io_handle;
+		internal_volume->file_io_handle      = block_cache_io_handle;
+	}
+	else
+	{
+		internal_volume->file_io_handle = file_io_handle;
+	}
 	internal_volume->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+	internal_volume->io_handle->access_flags          = access_flags;
 
 #if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -795,6 +1007,18 @@ int libvsmbr_volume_open_file_io_handle(
 	return( 1 );
 
 on_error:
+	if( overlay_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &overlay_io_handle,
+		 NULL );
+	}
+	if( block_cache_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &block_cache_io_handle,
+		 NULL );
+	}
 	if( file_io_handle_opened_in_library != 0 )
 	{
 		libbfio_handle_close(
@@ -804,16 +1028,25 @@ on_error:
 	return( -1 );
 }
 
-/* Closes a volume
- * Returns 0 if successful or -1 on error
+/* Opens a volume that is split in multiple segment files
+ * The segment files are concatenated in the order they are provided
+ * Returns 1 if successful or -1 on error
  */
-int libvsmbr_volume_close(
+int libvsmbr_volume_open_multiple(
      libvsmbr_volume_t *volume,
+     char * const filenames[],
+     int number_of_filenames,
+     int access_flags,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle            = NULL;
+	libbfio_pool_t *file_io_pool                = NULL;
 	libvsmbr_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libvsmbr_volume_close";
-	int result                                  = 0;
+	static char *function                       = "libvsmbr_volume_open_multiple";
+	size_t filename_length                      = 0;
+	int bfio_access_flags                       = 0;
+	int file_io_pool_entry                      = 0;
+	int filename_index                          = 0;
 
 	if( volume == NULL )
 	{
@@ -828,116 +1061,172 @@ int libvsmbr_volume_close(
 	}
 	internal_volume = (libvsmbr_internal_volume_t *) volume;
 
-	if( internal_volume->file_io_handle == NULL )
+	if( filenames == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( number_of_filenames <= 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of filenames value zero or less.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( ( ( access_flags & LIBVSMBR_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBVSMBR_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
-		if( internal_volume->file_io_handle_created_in_library != 0 )
-		{
-			if( libvsmbr_debug_print_read_offsets(
-			     internal_volume->file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
 
-				result = -1;
-			}
-		}
+		return( -1 );
 	}
-#endif
-	if( internal_volume->file_io_handle_opened_in_library != 0 )
+	if( ( access_flags & LIBVSMBR_ACCESS_FLAG_READ ) == 0 )
 	{
-		if( libbfio_handle_close(
-		     internal_volume->file_io_handle,
-		     error ) != 0 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access without read access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+
+	if( ( access_flags & LIBVSMBR_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		bfio_access_flags |= LIBBFIO_ACCESS_FLAG_WRITE;
+	}
+	if( libbfio_pool_initialize(
+	     &file_io_pool,
+	     0,
+	     LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO pool.",
+		 function );
+
+		goto on_error;
+	}
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
+	{
+		if( filenames[ filename_index ] == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close file IO handle.",
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid filename: %d.",
+			 function,
+			 filename_index );
+
+			goto on_error;
+		}
+		if( libbfio_file_initialize(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
-		internal_volume->file_io_handle_opened_in_library = 0;
-	}
-	if( internal_volume->file_io_handle_created_in_library != 0 )
-	{
-		if( libbfio_handle_free(
-		     &( internal_volume->file_io_handle ),
+		filename_length = narrow_string_length(
+		                   filenames[ filename_index ] );
+
+		if( libbfio_file_set_name(
+		     file_io_handle,
+		     filenames[ filename_index ],
+		     filename_length + 1,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file IO handle.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in file IO handle.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
-		internal_volume->file_io_handle_created_in_library = 0;
-	}
-	internal_volume->file_io_handle = NULL;
+		if( libbfio_pool_append_handle(
+		     file_io_pool,
+		     &file_io_pool_entry,
+		     file_io_handle,
+		     bfio_access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file IO handle to pool.",
+			 function );
 
-	if( libvsmbr_io_handle_clear(
-	     internal_volume->io_handle,
+			goto on_error;
+		}
+		/* The file IO pool takes over management of the file IO handle
+		 */
+		file_io_handle = NULL;
+	}
+	if( libvsmbr_volume_open_file_io_pool(
+	     volume,
+	     file_io_pool,
+	     access_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear the IO handle.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume: %s.",
+		 function,
+		 filenames[ 0 ] );
 
-		result = -1;
+		goto on_error;
 	}
-	if( libcdata_array_empty(
-	     internal_volume->partitions,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libvsmbr_partition_values_free,
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable to empty the partitions array.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
+#endif
+	internal_volume->file_io_pool_created_in_library = 1;
+
 #if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
@@ -953,417 +1242,3767 @@ int libvsmbr_volume_close(
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Opens a volume for reading
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a volume that is split in multiple segment files
+ * The segment files are concatenated in the order they are provided
  * Returns 1 if successful or -1 on error
  */
-int libvsmbr_internal_volume_open_read(
-     libvsmbr_internal_volume_t *internal_volume,
-     libbfio_handle_t *file_io_handle,
+int libvsmbr_volume_open_multiple_wide(
+     libvsmbr_volume_t *volume,
+     wchar_t * const filenames[],
+     int number_of_filenames,
+     int access_flags,
      libcerror_error_t **error )
 {
-	libvsmbr_boot_record_t *master_boot_record = NULL;
-	static char *function                      = "libvsmbr_internal_volume_open_read";
+	libbfio_handle_t *file_io_handle            = NULL;
+	libbfio_pool_t *file_io_pool                = NULL;
+	libvsmbr_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsmbr_volume_open_multiple_wide";
+	size_t filename_length                      = 0;
+	int bfio_access_flags                       = 0;
+	int file_io_pool_entry                      = 0;
+	int filename_index                          = 0;
 
-	if( internal_volume == NULL )
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal volume.",
+		 "%s: invalid volume.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_handle_get_size(
-	     file_io_handle,
-	     &( internal_volume->size ),
-	     error ) != 1 )
+	internal_volume = (libvsmbr_internal_volume_t *) volume;
+
+	if( filenames == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve size from file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
 		 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: reading Master Boot Record (MBR).\n",
-		 function );
+		return( -1 );
 	}
-#endif
-	if( libvsmbr_boot_record_initialize(
-	     &master_boot_record,
-	     error ) != 1 )
+	if( number_of_filenames <= 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create master boot record.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of filenames value zero or less.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libvsmbr_boot_record_read_file_io_handle(
-	     master_boot_record,
-	     file_io_handle,
-	     0,
-	     error ) != 1 )
+	if( ( ( access_flags & LIBVSMBR_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBVSMBR_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read master boot record.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_volume->disk_identity = master_boot_record->disk_identity;
-
-	if( libvsmbr_internal_volume_read_partition_entries(
-	     internal_volume,
-	     file_io_handle,
-	     0,
-	     master_boot_record,
-	     1,
-	     0,
-	     0,
-	     error ) != 1 )
+	if( ( access_flags & LIBVSMBR_ACCESS_FLAG_READ ) == 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read partition entries.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access without read access currently not supported.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libvsmbr_boot_record_free(
-	     &master_boot_record,
+	bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+
+	if( ( access_flags & LIBVSMBR_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		bfio_access_flags |= LIBBFIO_ACCESS_FLAG_WRITE;
+	}
+	if( libbfio_pool_initialize(
+	     &file_io_pool,
+	     0,
+	     LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free master boot record.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO pool.",
 		 function );
 
 		goto on_error;
 	}
-	return( 1 );
-
-on_error:
-	if( master_boot_record != NULL )
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
 	{
-		libvsmbr_boot_record_free(
-		 &master_boot_record,
-		 NULL );
-	}
-	return( -1 );
-}
-
-/* Reads partition entries in a master boot record or extended partition record
- * Returns 1 if successful or -1 on error
- */
-int libvsmbr_internal_volume_read_partition_entries(
-     libvsmbr_internal_volume_t *internal_volume,
-     libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
-     libvsmbr_boot_record_t *boot_record,
-     uint8_t is_master_boot_record,
-     off64_t first_extended_boot_record_offset,
-     int recursion_depth,
-     libcerror_error_t **error )
-{
-	libvsmbr_boot_record_t *extended_partition_record = NULL;
-	libvsmbr_partition_entry_t *partition_entry       = NULL;
-	libvsmbr_partition_values_t *partition_values     = NULL;
-	static char *function                             = "libvsmbr_internal_volume_read_partition_entries";
-	off64_t extended_partition_record_offset          = 0;
-	int entry_index                                   = 0;
-	int partition_entry_index                         = 0;
-	int result                                        = 0;
+		if( filenames[ filename_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid filename: %d.",
+			 function,
+			 filename_index );
 
-	if( internal_volume == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal volume.",
-		 function );
+			goto on_error;
+		}
+		if( libbfio_file_initialize(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
+			 function );
 
-		return( -1 );
-	}
-	if( ( recursion_depth < 0 )
-	 || ( recursion_depth > LIBVSMBR_MAXIMUM_RECURSION_DEPTH ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid recursion depth value out of bounds.",
-		 function );
+			goto on_error;
+		}
+		filename_length = wide_string_length(
+		                   filenames[ filename_index ] );
 
-		return( -1 );
-	}
-	for( partition_entry_index = 0;
-	     partition_entry_index < 4;
-	     partition_entry_index++ )
-	{
-		if( libvsmbr_boot_record_get_partition_entry_by_index(
-		     boot_record,
-		     partition_entry_index,
-		     &partition_entry,
+		if( libbfio_file_set_name_wide(
+		     file_io_handle,
+		     filenames[ filename_index ],
+		     filename_length + 1,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve partition entry: %d.",
-			 function,
-			 partition_entry_index );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in file IO handle.",
+			 function );
 
 			goto on_error;
 		}
-		if( partition_entry == NULL )
+		if( libbfio_pool_append_handle(
+		     file_io_pool,
+		     &file_io_pool_entry,
+		     file_io_handle,
+		     bfio_access_flags,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing partition entry: %" PRIu8 ".",
-			 function,
-			 partition_entry_index );
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file IO handle to pool.",
+			 function );
 
 			goto on_error;
 		}
-		/* Ignore empty partition entries
+		/* The file IO pool takes over management of the file IO handle
 		 */
-		if( partition_entry->type == 0 )
-		{
-			continue;
-		}
-		if( ( partition_entry->type == 0x05 )
-		 || ( ( is_master_boot_record != 0 )
-		  &&  ( partition_entry->type == 0x0f ) ) )
-		{
-			if( extended_partition_record != NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: more than 1 extended partition entry per table is not supported.",
-				 function );
+		file_io_handle = NULL;
+	}
+	if( libvsmbr_volume_open_file_io_pool(
+	     volume,
+	     file_io_pool,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume: %ls.",
+		 function,
+		 filenames[ 0 ] );
 
-				goto on_error;
-			}
-			extended_partition_record_offset = first_extended_boot_record_offset + ( (off64_t) partition_entry->start_address_lba * internal_volume->io_handle->bytes_per_sector );
+		goto on_error;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: reading Extended Partition Record (EPR) at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
-				 function,
-				 extended_partition_record_offset,
-				 extended_partition_record_offset );
-			}
+		return( -1 );
+	}
 #endif
-			if( libvsmbr_boot_record_initialize(
-			     &extended_partition_record,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create extended partition record.",
-				 function );
+	internal_volume->file_io_pool_created_in_library = 1;
 
-				goto on_error;
-			}
-			result = libvsmbr_boot_record_read_file_io_handle(
-				  extended_partition_record,
-				  file_io_handle,
-				  extended_partition_record_offset,
-				  error );
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
-			/* Linux fdisk supports sector sizes of: 512, 1024, 2048, 4096
-			 */
-			while( ( result != 1 )
-			    && ( is_master_boot_record != 0 )
-			    && ( internal_volume->io_handle->bytes_per_sector < 4096 ) )
-			{
-				libcerror_error_free(
-				 error );
+		return( -1 );
+	}
+#endif
+	return( 1 );
 
-				internal_volume->io_handle->bytes_per_sector *= 2;
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	return( -1 );
+}
 
-				extended_partition_record_offset = first_extended_boot_record_offset + ( (off64_t) partition_entry->start_address_lba * internal_volume->io_handle->bytes_per_sector );
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: reading Extended Partition Record (EPR) at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
-					 function,
-					 extended_partition_record_offset,
-					 extended_partition_record_offset );
-				}
-#endif
-				result = libvsmbr_boot_record_read_file_io_handle(
-					  extended_partition_record,
-					  file_io_handle,
-					  extended_partition_record_offset,
-					  error );
-			}
-			if( result != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read extended partition record.",
-				 function );
+/* Opens a volume that is split in multiple segment files using a Basic File IO (bfio) pool
+ * The segment files are concatenated in the order of their entries in the pool
+ * The segment file IO handles are opened and kept open until the volume is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_volume_open_file_io_pool(
+     libvsmbr_volume_t *volume,
+     libbfio_pool_t *file_io_pool,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle            = NULL;
+	libvsmbr_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsmbr_volume_open_file_io_pool";
 
-				goto on_error;
-			}
-			internal_volume->bytes_per_sector_set_by_library = 1;
-		}
-		else
-		{
-/* TODO do bytes per sector check for known volume types and GPT */
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
 
-			if( libvsmbr_partition_values_initialize(
-			     &partition_values,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create partition values.",
-				 function );
+		return( -1 );
+	}
+	internal_volume = (libvsmbr_internal_volume_t *) volume;
 
-				goto on_error;
-			}
-			partition_values->type                    = partition_entry->type;
-			partition_values->partition_record_offset = file_offset;
-			partition_values->sector_number           = partition_entry->start_address_lba;
-			partition_values->number_of_sectors       = partition_entry->number_of_sectors;
+	if( internal_volume->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file IO handle value already set.",
+		 function );
 
-			if( libcdata_array_append_entry(
-			     internal_volume->partitions,
-			     &entry_index,
-			     (intptr_t *) partition_values,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append partition to array.",
-				 function );
+		return( -1 );
+	}
+	if( file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool.",
+		 function );
 
-				goto on_error;
+		return( -1 );
+	}
+	if( libvsmbr_segments_initialize(
+	     &file_io_handle,
+	     file_io_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create segments IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_volume_open_file_io_handle(
+	     volume,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->file_io_handle_created_in_library = 1;
+	internal_volume->file_io_pool                      = file_io_pool;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens a volume from a BGZF compressed image using a Basic File IO (bfio) handle
+ * The file IO handle is wrapped in a compressed IO handle that indexes
+ * the members of the image and decompresses them on demand
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_volume_open_compressed_file_io_handle(
+     libvsmbr_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *compressed_io_handle      = NULL;
+	libvsmbr_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsmbr_volume_open_compressed_file_io_handle";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libvsmbr_internal_volume_t *) volume;
+
+	if( internal_volume->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBVSMBR_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access to a compressed image is not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_compressed_initialize(
+	     &compressed_io_handle,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressed IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_volume_open_file_io_handle(
+	     volume,
+	     compressed_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->file_io_handle_created_in_library = 1;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( compressed_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &compressed_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes a volume
+ * Returns 0 if successful or -1 on error
+ */
+int libvsmbr_volume_close(
+     libvsmbr_volume_t *volume,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsmbr_volume_close";
+	int result                                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libvsmbr_internal_volume_t *) volume;
+
+	if( internal_volume->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( internal_volume->file_io_handle_created_in_library != 0 )
+		{
+			if( libvsmbr_debug_print_read_offsets(
+			     internal_volume->file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#endif
+	/* Dirty blocks are written before the file IO handle is closed
+	 * and discarded if this fails since the handle is closed regardless
+	 */
+	if( ( internal_volume->io_handle->access_flags & LIBVSMBR_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		if( libvsmbr_write_cache_flush(
+		     internal_volume->io_handle->write_cache,
+		     internal_volume->file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write cache.",
+			 function );
+
+			result = -1;
+		}
+		if( libvsmbr_write_cache_discard(
+		     internal_volume->io_handle->write_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to discard write cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->base_file_io_handle != NULL )
+	{
+		if( libbfio_handle_close(
+		     internal_volume->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close overlay or block cache IO handle.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_free(
+		     &( internal_volume->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free overlay or block cache IO handle.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_volume->block_cache_io_handle != NULL )
+		{
+			if( libbfio_handle_close(
+			     internal_volume->block_cache_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close block cache IO handle.",
+				 function );
+
+				result = -1;
+			}
+			if( libbfio_handle_free(
+			     &( internal_volume->block_cache_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free block cache IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		internal_volume->file_io_handle      = internal_volume->base_file_io_handle;
+		internal_volume->base_file_io_handle = NULL;
+	}
+	if( internal_volume->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_volume->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_volume->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_volume->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_free(
+		     &( internal_volume->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_volume->file_io_handle_created_in_library = 0;
+	}
+	internal_volume->file_io_handle = NULL;
+
+	if( internal_volume->file_io_pool_created_in_library != 0 )
+	{
+		if( libbfio_pool_free(
+		     &( internal_volume->file_io_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO pool.",
+			 function );
+
+			result = -1;
+		}
+		internal_volume->file_io_pool_created_in_library = 0;
+	}
+	internal_volume->file_io_pool           = NULL;
+	internal_volume->file_io_handle_is_file = 0;
+
+	if( libvsmbr_io_handle_clear(
+	     internal_volume->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear the IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( libcdata_array_empty(
+	     internal_volume->partitions,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libvsmbr_partition_values_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty the partitions array.",
+		 function );
+
+		result = -1;
+	}
+	internal_volume->extended_partition_sector_number     = 0;
+	internal_volume->extended_partition_number_of_sectors = 0;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Writes the dirty blocks of the volume and its partitions
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_volume_flush(
+     libvsmbr_volume_t *volume,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsmbr_volume_flush";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libvsmbr_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	else if( ( internal_volume->io_handle->access_flags & LIBVSMBR_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		if( libvsmbr_write_cache_flush(
+		     internal_volume->io_handle->write_cache,
+		     internal_volume->file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the overlay file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_volume_set_overlay(
+     libvsmbr_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     uint8_t file_io_handle_created_in_library,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_internal_volume_set_overlay";
+	int result            = 1;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file IO handle value already set.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_volume->overlay_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - overlay file IO handle value already set.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		internal_volume->overlay_file_io_handle                    = file_io_handle;
+		internal_volume->overlay_file_io_handle_created_in_library = file_io_handle_created_in_library;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets an overlay file to which writes are redirected
+ * Must be called before the volume is opened, the volume file is then only
+ * opened for reading and an existing overlay file is overwritten
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_volume_set_overlay(
+     libvsmbr_volume_t *volume,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libvsmbr_volume_set_overlay";
+	size_t filename_length           = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The volume takes over the file IO handle
+	 */
+	if( libvsmbr_internal_volume_set_overlay(
+	     (libvsmbr_internal_volume_t *) volume,
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set overlay: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets an overlay file to which writes are redirected
+ * Must be called before the volume is opened, the volume file is then only
+ * opened for reading and an existing overlay file is overwritten
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_volume_set_overlay_wide(
+     libvsmbr_volume_t *volume,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libvsmbr_volume_set_overlay_wide";
+	size_t filename_length           = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The volume takes over the file IO handle
+	 */
+	if( libvsmbr_internal_volume_set_overlay(
+	     (libvsmbr_internal_volume_t *) volume,
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set overlay: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Sets an overlay file to which writes are redirected using a Basic File IO (bfio) handle
+ * The file IO handle is opened for writing if it is not open and
+ * must remain available until the volume is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_volume_set_overlay_file_io_handle(
+     libvsmbr_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_volume_set_overlay_file_io_handle";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_internal_volume_set_overlay(
+	     (libvsmbr_internal_volume_t *) volume,
+	     file_io_handle,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set overlay.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the block cache file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_volume_set_block_cache(
+     libvsmbr_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     uint8_t file_io_handle_created_in_library,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_internal_volume_set_block_cache";
+	int result            = 1;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_size < LIBVSMBR_BLOCK_CACHE_MINIMUM_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid maximum cache size value too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file IO handle value already set.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_volume->block_cache_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - block cache file IO handle value already set.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		internal_volume->block_cache_file_io_handle                    = file_io_handle;
+		internal_volume->block_cache_file_io_handle_created_in_library = file_io_handle_created_in_library;
+		internal_volume->maximum_block_cache_size                      = maximum_cache_size;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets a block cache file in which blocks read from the volume file are stored
+ * Must be called before the volume is opened for reading, blocks stored in
+ * an existing block cache file by an earlier session are read from it instead
+ * of the volume file. The block cache file does not exceed the maximum cache size
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_volume_set_block_cache(
+     libvsmbr_volume_t *volume,
+     const char *filename,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libvsmbr_volume_set_block_cache";
+	size_t filename_length           = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The volume takes over the file IO handle
+	 */
+	if( libvsmbr_internal_volume_set_block_cache(
+	     (libvsmbr_internal_volume_t *) volume,
+	     file_io_handle,
+	     1,
+	     maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set block cache: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets a block cache file in which blocks read from the volume file are stored
+ * Must be called before the volume is opened for reading, blocks stored in
+ * an existing block cache file by an earlier session are read from it instead
+ * of the volume file. The block cache file does not exceed the maximum cache size
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_volume_set_block_cache_wide(
+     libvsmbr_volume_t *volume,
+     const wchar_t *filename,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libvsmbr_volume_set_block_cache_wide";
+	size_t filename_length           = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The volume takes over the file IO handle
+	 */
+	if( libvsmbr_internal_volume_set_block_cache(
+	     (libvsmbr_internal_volume_t *) volume,
+	     file_io_handle,
+	     1,
+	     maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set block cache: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Sets a block cache file in which blocks read from the volume file are stored using a Basic File IO (bfio) handle
+ * The file IO handle is opened for reading and writing if it is not open and
+ * must remain available until the volume is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_volume_set_block_cache_file_io_handle(
+     libvsmbr_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_volume_set_block_cache_file_io_handle";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_internal_volume_set_block_cache(
+	     (libvsmbr_internal_volume_t *) volume,
+	     file_io_handle,
+	     0,
+	     maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set block cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the handle pool through which the volume file is opened
+ * Must be called before the volume is opened using a filename, the file
+ * can be closed by the handle pool while the volume is open and is
+ * reopened on demand. The handle pool must remain available until
+ * the volume is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_volume_set_handle_pool(
+     libvsmbr_volume_t *volume,
+     libvsmbr_handle_pool_t *handle_pool,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsmbr_volume_set_handle_pool";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libvsmbr_internal_volume_t *) volume;
+
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file IO handle value already set.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		internal_volume->handle_pool = handle_pool;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the cache arena in which the sector data of the partitions is cached
+ * The cache arena applies to the partitions that are retrieved after it was set,
+ * instead of a sectors cache per partition. The cache arena can be shared by
+ * multiple volumes and must remain available until their partitions are freed
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_volume_set_cache_arena(
+     libvsmbr_volume_t *volume,
+     libvsmbr_cache_arena_t *cache_arena,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsmbr_volume_set_cache_arena";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libvsmbr_internal_volume_t *) volume;
+
+	if( cache_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache arena.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->cache_arena = cache_arena;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Opens a volume for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_volume_open_read(
+     libvsmbr_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libvsmbr_boot_record_t *master_boot_record = NULL;
+	static char *function                      = "libvsmbr_internal_volume_open_read";
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &( internal_volume->size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size from file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading Master Boot Record (MBR).\n",
+		 function );
+	}
+#endif
+	if( libvsmbr_boot_record_initialize(
+	     &master_boot_record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create master boot record.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_internal_volume_read_boot_record(
+	     internal_volume,
+	     file_io_handle,
+	     0,
+	     master_boot_record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read master boot record.",
+		 function );
+
+		goto on_error;
+	}
+	internal_volume->disk_identity = master_boot_record->disk_identity;
+
+	if( libvsmbr_internal_volume_read_partition_entries(
+	     internal_volume,
+	     file_io_handle,
+	     0,
+	     master_boot_record,
+	     1,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read partition entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_boot_record_free(
+	     &master_boot_record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free master boot record.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( master_boot_record != NULL )
+	{
+		libvsmbr_boot_record_free(
+		 &master_boot_record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads partition entries in a master boot record or extended partition record
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_volume_read_partition_entries(
+     libvsmbr_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libvsmbr_boot_record_t *boot_record,
+     uint8_t is_master_boot_record,
+     off64_t first_extended_boot_record_offset,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libvsmbr_boot_record_t *extended_partition_record = NULL;
+	libvsmbr_partition_entry_t *partition_entry       = NULL;
+	libvsmbr_partition_values_t *partition_values     = NULL;
+	static char *function                             = "libvsmbr_internal_volume_read_partition_entries";
+	off64_t extended_partition_record_offset          = 0;
+	int entry_index                                   = 0;
+	int partition_entry_index                         = 0;
+	int result                                        = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBVSMBR_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( partition_entry_index = 0;
+	     partition_entry_index < 4;
+	     partition_entry_index++ )
+	{
+		if( libvsmbr_boot_record_get_partition_entry_by_index(
+		     boot_record,
+		     partition_entry_index,
+		     &partition_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition entry: %d.",
+			 function,
+			 partition_entry_index );
+
+			goto on_error;
+		}
+		if( partition_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing partition entry: %" PRIu8 ".",
+			 function,
+			 partition_entry_index );
+
+			goto on_error;
+		}
+		/* Ignore empty partition entries
+		 */
+		if( partition_entry->type == 0 )
+		{
+			continue;
+		}
+		if( ( partition_entry->type == 0x05 )
+		 || ( ( is_master_boot_record != 0 )
+		  &&  ( partition_entry->type == 0x0f ) ) )
+		{
+			if( extended_partition_record != NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: more than 1 extended partition entry per table is not supported.",
+				 function );
+
+				goto on_error;
+			}
+			extended_partition_record_offset = first_extended_boot_record_offset + ( (off64_t) partition_entry->start_address_lba * internal_volume->io_handle->bytes_per_sector );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: reading Extended Partition Record (EPR) at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+				 function,
+				 extended_partition_record_offset,
+				 extended_partition_record_offset );
+			}
+#endif
+			if( libvsmbr_boot_record_initialize(
+			     &extended_partition_record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create extended partition record.",
+				 function );
+
+				goto on_error;
+			}
+			result = libvsmbr_internal_volume_read_boot_record(
+				  internal_volume,
+				  file_io_handle,
+				  extended_partition_record_offset,
+				  extended_partition_record,
+				  error );
+
+			/* Linux fdisk supports sector sizes of: 512, 1024, 2048, 4096
+			 */
+			while( ( result != 1 )
+			    && ( is_master_boot_record != 0 )
+			    && ( internal_volume->io_handle->bytes_per_sector < 4096 ) )
+			{
+				libcerror_error_free(
+				 error );
+
+				internal_volume->io_handle->bytes_per_sector *= 2;
+
+				extended_partition_record_offset = first_extended_boot_record_offset + ( (off64_t) partition_entry->start_address_lba * internal_volume->io_handle->bytes_per_sector );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: reading Extended Partition Record (EPR) at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+					 function,
+					 extended_partition_record_offset,
+					 extended_partition_record_offset );
+				}
+#endif
+				result = libvsmbr_internal_volume_read_boot_record(
+					  internal_volume,
+					  file_io_handle,
+					  extended_partition_record_offset,
+					  extended_partition_record,
+					  error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read extended partition record.",
+				 function );
+
+				goto on_error;
+			}
+			internal_volume->bytes_per_sector_set_by_library = 1;
+
+			/* The extent of the extended partition is retained so that
+			 * a partition move keeps the logical partitions inside it
+			 */
+			if( is_master_boot_record != 0 )
+			{
+				internal_volume->extended_partition_sector_number     = partition_entry->start_address_lba;
+				internal_volume->extended_partition_number_of_sectors = partition_entry->number_of_sectors;
+			}
+		}
+		else
+		{
+/* TODO do bytes per sector check for known volume types and GPT */
+
+			if( libvsmbr_partition_values_initialize(
+			     &partition_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create partition values.",
+				 function );
+
+				goto on_error;
+			}
+			partition_values->type                    = partition_entry->type;
+			partition_values->partition_record_offset = file_offset;
+			partition_values->partition_entry_index   = (uint8_t) partition_entry_index;
+			partition_values->sector_number           = partition_entry->start_address_lba;
+			partition_values->number_of_sectors       = partition_entry->number_of_sectors;
+
+			if( libcdata_array_append_entry(
+			     internal_volume->partitions,
+			     &entry_index,
+			     (intptr_t *) partition_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append partition to array.",
+				 function );
+
+				goto on_error;
+			}
+			partition_values = NULL;
+		}
+	}
+	if( extended_partition_record != NULL )
+	{
+		if( ( extended_partition_record_offset == 0 )
+		 || ( extended_partition_record_offset == file_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: unsupported extended partition record offset.",
+			 function );
+
+			goto on_error;
+		}
+		if( is_master_boot_record != 0 )
+		{
+			first_extended_boot_record_offset = extended_partition_record_offset;
+		}
+		if( libvsmbr_internal_volume_read_partition_entries(
+		     internal_volume,
+		     file_io_handle,
+		     extended_partition_record_offset,
+		     extended_partition_record,
+		     0,
+		     first_extended_boot_record_offset,
+		     recursion_depth + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read partition entries.",
+			 function );
+
+			goto on_error;
+		}
+		if( libvsmbr_boot_record_free(
+		     &extended_partition_record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free extended partition record.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( partition_values != NULL )
+	{
+		libvsmbr_partition_values_free(
+		 &partition_values,
+		 NULL );
+	}
+	if( extended_partition_record != NULL )
+	{
+		libvsmbr_boot_record_free(
+		 &extended_partition_record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a boot record, adds the read to the statistics and records
+ * the read by the trace if active
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_volume_read_boot_record(
+     libvsmbr_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libvsmbr_boot_record_t *boot_record,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_internal_volume_read_boot_record";
+	uint64_t end_time     = 0;
+	uint64_t start_time   = 0;
+	int result            = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_statistics_get_current_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve start time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_trace_append_record(
+	     internal_volume->io_handle->trace,
+	     LIBVSMBR_TRACE_RECORD_TYPE_BACKING_READ,
+	     0xffffffffUL,
+	     (uint64_t) file_offset,
+	     sizeof( vsmbr_boot_record_classical_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append trace record.",
+		 function );
+
+		return( -1 );
+	}
+	result = libvsmbr_boot_record_read_file_io_handle(
+	          boot_record,
+	          file_io_handle,
+	          file_offset,
+	          error );
+
+	/* A boot record that fails to validate was still read
+	 */
+	if( libvsmbr_statistics_get_current_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end time.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_time < start_time )
+	{
+		end_time = start_time;
+	}
+	if( libvsmbr_statistics_add_backing_read(
+	     (libvsmbr_statistics_t *) &( internal_volume->io_handle->statistics ),
+	     sizeof( vsmbr_boot_record_classical_t ),
+	     end_time - start_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the number of bytes per sector
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_volume_get_bytes_per_sector(
+     libvsmbr_volume_t *volume,
+     uint32_t *bytes_per_sector,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsmbr_volume_get_bytes_per_sector";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libvsmbr_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bytes_per_sector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*bytes_per_sector = internal_volume->io_handle->bytes_per_sector;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the number of bytes per sector
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_volume_set_bytes_per_sector(
+     libvsmbr_volume_t *volume,
+     uint32_t bytes_per_sector,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsmbr_volume_set_bytes_per_sector";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libvsmbr_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->bytes_per_sector_set_by_library != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: bytes per sector value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bytes_per_sector != 512 )
+	 && ( bytes_per_sector != 1024 )
+	 && ( bytes_per_sector != 2048 )
+	 && ( bytes_per_sector != 4096 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->io_handle->bytes_per_sector = bytes_per_sector;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the disk identity (or disk identifier)
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libvsmbr_volume_get_disk_identity(
+     libvsmbr_volume_t *volume,
+     uint32_t *disk_identity,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsmbr_volume_get_disk_identity";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libvsmbr_internal_volume_t *) volume;
+
+	if( disk_identity == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk identity.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+
+/* TODO add support to return 0 if not available */
+
+	*disk_identity = internal_volume->disk_identity;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of partitions
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_volume_get_number_of_partitions(
+     libvsmbr_volume_t *volume,
+     int *number_of_partitions,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsmbr_volume_get_number_of_partitions";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libvsmbr_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     internal_volume->partitions,
+	     number_of_partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of partitions from array.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific partition
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_volume_get_partition_by_index(
+     libvsmbr_volume_t *volume,
+     int partition_index,
+     libvsmbr_partition_t **partition,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_volume_t *internal_volume   = NULL;
+	libvsmbr_partition_values_t *partition_values = NULL;
+	static char *function                         = "libvsmbr_volume_get_partition_by_index";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libvsmbr_internal_volume_t *) volume;
+
+	if( partition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition.",
+		 function );
+
+		return( -1 );
+	}
+	if( *partition != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid partition value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_entry_by_index(
+	     internal_volume->partitions,
+	     partition_index,
+	     (intptr_t **) &partition_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition values: %d from array.",
+		 function,
+		 partition_index );
+
+		goto on_error;
+	}
+	if( libvsmbr_partition_initialize(
+	     partition,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     partition_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create partition: %d.",
+		 function,
+		 partition_index );
+
+		goto on_error;
+	}
+	/* Only a libbfio file IO handle created by the volume is known to be a file,
+	 * which is not the case for a handle of a handle pool, a split image or
+	 * a compressed image, or when the handle is stacked on an overlay or
+	 * block cache
+	 */
+	if( internal_volume->base_file_io_handle == NULL )
+	{
+		( (libvsmbr_internal_partition_t *) *partition )->file_io_handle_is_file = internal_volume->file_io_handle_is_file;
+	}
+	( (libvsmbr_internal_partition_t *) *partition )->partition_index = partition_index;
+
+	if( internal_volume->cache_arena != NULL )
+	{
+		if( libvsmbr_internal_partition_set_cache_arena(
+		     (libvsmbr_internal_partition_t *) *partition,
+		     internal_volume->cache_arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set cache arena in partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *partition != NULL )
+	{
+		libvsmbr_partition_free(
+		 partition,
+		 NULL );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Writes the start address and number of sectors of a partition into its partition entry
+ * The sector number is relative to the start of the volume
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_volume_write_partition_entry(
+     libvsmbr_internal_volume_t *internal_volume,
+     libvsmbr_partition_values_t *partition_values,
+     uint32_t sector_number,
+     uint32_t number_of_sectors,
+     libcerror_error_t **error )
+{
+	vsmbr_boot_record_classical_t boot_record_data;
+
+	libvsmbr_partition_entry_t *partition_entry = NULL;
+	static char *function                       = "libvsmbr_internal_volume_write_partition_entry";
+	size_t partition_entry_offset               = 0;
+	ssize_t read_count                          = 0;
+	ssize_t write_count                         = 0;
+	uint32_t partition_record_sector            = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - invalid IO handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition values.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_values->partition_entry_index > 3 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition values - partition entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	partition_record_sector = (uint32_t) ( partition_values->partition_record_offset / internal_volume->io_handle->bytes_per_sector );
+
+	if( sector_number <= partition_record_sector )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              internal_volume->file_io_handle,
+	              (uint8_t *) &boot_record_data,
+	              sizeof( vsmbr_boot_record_classical_t ),
+	              partition_values->partition_record_offset,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( vsmbr_boot_record_classical_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read partition record at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 partition_values->partition_record_offset,
+		 partition_values->partition_record_offset );
+
+		goto on_error;
+	}
+	if( libvsmbr_partition_entry_initialize(
+	     &partition_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create partition entry.",
+		 function );
+
+		goto on_error;
+	}
+	partition_entry_offset = (size_t) partition_values->partition_entry_index * 16;
+
+	if( libvsmbr_partition_entry_read_data(
+	     partition_entry,
+	     &( boot_record_data.partition_entries[ partition_entry_offset ] ),
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read partition entry: %" PRIu8 ".",
+		 function,
+		 partition_values->partition_entry_index );
+
+		goto on_error;
+	}
+	/* The start address of a logical partition is relative to its extended boot record
+	 */
+	partition_entry->start_address_lba = sector_number - partition_record_sector;
+	partition_entry->number_of_sectors = number_of_sectors;
+
+	if( libvsmbr_partition_entry_write_data(
+	     partition_entry,
+	     &( boot_record_data.partition_entries[ partition_entry_offset ] ),
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write partition entry: %" PRIu8 ".",
+		 function,
+		 partition_values->partition_entry_index );
+
+		goto on_error;
+	}
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               internal_volume->file_io_handle,
+	               (uint8_t *) &boot_record_data,
+	               sizeof( vsmbr_boot_record_classical_t ),
+	               partition_values->partition_record_offset,
+	               error );
+
+	if( write_count != (ssize_t) sizeof( vsmbr_boot_record_classical_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write partition record at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 partition_values->partition_record_offset,
+		 partition_values->partition_record_offset );
+
+		goto on_error;
+	}
+	partition_values->sector_number     = partition_entry->start_address_lba;
+	partition_values->number_of_sectors = partition_entry->number_of_sectors;
+
+	if( libvsmbr_partition_entry_free(
+	     &partition_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free partition entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( partition_entry != NULL )
+	{
+		libvsmbr_partition_entry_free(
+		 &partition_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines if a range of sectors is available for a partition
+ * The range must not overlap with the boot records or the other partitions,
+ * a logical partition must stay inside the extended partition and a primary
+ * partition must stay outside of it
+ * Returns 1 if available, 0 if not or -1 on error
+ */
+int libvsmbr_internal_volume_is_sector_range_available(
+     libvsmbr_internal_volume_t *internal_volume,
+     int partition_index,
+     uint64_t sector_number,
+     uint64_t number_of_sectors,
+     libcerror_error_t **error )
+{
+	libvsmbr_partition_values_t *partition_values = NULL;
+	static char *function                         = "libvsmbr_internal_volume_is_sector_range_available";
+	uint64_t extended_partition_end_sector        = 0;
+	uint64_t partition_record_sector              = 0;
+	uint64_t partition_sector_number              = 0;
+	int number_of_partitions                      = 0;
+	int other_partition_index                     = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - invalid IO handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	/* Sector 0 contains the master boot record
+	 */
+	if( sector_number == 0 )
+	{
+		return( 0 );
+	}
+	if( internal_volume->extended_partition_number_of_sectors > 0 )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_volume->partitions,
+		     partition_index,
+		     (intptr_t **) &partition_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition values: %d from array.",
+			 function,
+			 partition_index );
+
+			return( -1 );
+		}
+		if( partition_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing partition values: %d.",
+			 function,
+			 partition_index );
+
+			return( -1 );
+		}
+		extended_partition_end_sector = internal_volume->extended_partition_sector_number
+		                              + internal_volume->extended_partition_number_of_sectors;
+
+		/* A logical partition is stored in an extended boot record
+		 */
+		if( partition_values->partition_record_offset != 0 )
+		{
+			if( ( sector_number <= internal_volume->extended_partition_sector_number )
+			 || ( ( sector_number + number_of_sectors ) > extended_partition_end_sector ) )
+			{
+				return( 0 );
+			}
+		}
+		else if( ( sector_number < extended_partition_end_sector )
+		      && ( internal_volume->extended_partition_sector_number < ( sector_number + number_of_sectors ) ) )
+		{
+			return( 0 );
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_volume->partitions,
+	     &number_of_partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of partitions.",
+		 function );
+
+		return( -1 );
+	}
+	for( other_partition_index = 0;
+	     other_partition_index < number_of_partitions;
+	     other_partition_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_volume->partitions,
+		     other_partition_index,
+		     (intptr_t **) &partition_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition values: %d from array.",
+			 function,
+			 other_partition_index );
+
+			return( -1 );
+		}
+		if( partition_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing partition values: %d.",
+			 function,
+			 other_partition_index );
+
+			return( -1 );
+		}
+		partition_record_sector = (uint64_t) partition_values->partition_record_offset / internal_volume->io_handle->bytes_per_sector;
+
+		/* The extended boot record sectors cannot be used by any partition
+		 */
+		if( ( partition_record_sector >= sector_number )
+		 && ( partition_record_sector < ( sector_number + number_of_sectors ) ) )
+		{
+			return( 0 );
+		}
+		if( other_partition_index == partition_index )
+		{
+			continue;
+		}
+		partition_sector_number = partition_record_sector + partition_values->sector_number;
+
+		if( ( sector_number < ( partition_sector_number + partition_values->number_of_sectors ) )
+		 && ( partition_sector_number < ( sector_number + number_of_sectors ) ) )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Moves and/or resizes a partition
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_internal_volume_move_partition(
+     libvsmbr_internal_volume_t *internal_volume,
+     int partition_index,
+     uint32_t sector_number,
+     uint32_t number_of_sectors,
+     int number_of_threads,
+     libbfio_handle_t *journal_file_io_handle,
+     libcerror_error_t **error )
+{
+	libvsmbr_data_mover_t *data_mover             = NULL;
+	libvsmbr_move_journal_t *move_journal         = NULL;
+	libvsmbr_partition_values_t *partition_values = NULL;
+	static char *function                         = "libvsmbr_internal_volume_move_partition";
+	off64_t source_offset                         = 0;
+	uint64_t source_sector_number                 = 0;
+	uint32_t copy_number_of_sectors               = 0;
+	int result                                    = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - invalid IO handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sectors == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of sectors value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( (uint64_t) sector_number + number_of_sectors > (uint64_t) UINT32_MAX + 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of sectors value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( internal_volume->io_handle->access_flags & LIBVSMBR_ACCESS_FLAG_WRITE ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: volume not opened for writing.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_volume->partitions,
+	     partition_index,
+	     (intptr_t **) &partition_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition values: %d from array.",
+		 function,
+		 partition_index );
+
+		goto on_error;
+	}
+	if( partition_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing partition values: %d.",
+		 function,
+		 partition_index );
+
+		goto on_error;
+	}
+	if( ( (uint64_t) sector_number + number_of_sectors ) > ( internal_volume->size / internal_volume->io_handle->bytes_per_sector ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector range exceeds volume size.",
+		 function );
+
+		goto on_error;
+	}
+	if( sector_number <= (uint32_t) ( partition_values->partition_record_offset / internal_volume->io_handle->bytes_per_sector ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector number value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	result = libvsmbr_internal_volume_is_sector_range_available(
+	          internal_volume,
+	          partition_index,
+	          (uint64_t) sector_number,
+	          (uint64_t) number_of_sectors,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if sector range is available.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector range overlaps with a boot record, another partition or the extended partition bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The data is moved directly in the file, hence pending writes are stored first
+	 */
+	if( libvsmbr_write_cache_flush(
+	     internal_volume->io_handle->write_cache,
+	     internal_volume->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush write cache.",
+		 function );
+
+		goto on_error;
+	}
+	source_sector_number = ( (uint64_t) partition_values->partition_record_offset / internal_volume->io_handle->bytes_per_sector )
+	                     + partition_values->sector_number;
+	source_offset        = (off64_t) ( source_sector_number * internal_volume->io_handle->bytes_per_sector );
+
+	copy_number_of_sectors = partition_values->number_of_sectors;
+
+	if( copy_number_of_sectors > number_of_sectors )
+	{
+		copy_number_of_sectors = number_of_sectors;
+	}
+	if( libvsmbr_move_journal_initialize(
+	     &move_journal,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create move journal.",
+		 function );
+
+		goto on_error;
+	}
+	result = 0;
+
+	if( journal_file_io_handle != NULL )
+	{
+		result = libvsmbr_move_journal_read_file_io_handle(
+		          move_journal,
+		          journal_file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read move journal.",
+			 function );
+
+			goto on_error;
+		}
+		else if( ( result != 0 )
+		      && ( move_journal->state == LIBVSMBR_MOVE_JOURNAL_STATE_COMPLETED ) )
+		{
+			result = 0;
+		}
+	}
+	if( result != 0 )
+	{
+		/* An interrupted move can only be resumed with the same arguments
+		 */
+		if( ( move_journal->partition_record_offset != partition_values->partition_record_offset )
+		 || ( move_journal->partition_entry_index != partition_values->partition_entry_index )
+		 || ( move_journal->sector_number != sector_number )
+		 || ( move_journal->number_of_sectors != number_of_sectors )
+		 || ( move_journal->destination_offset != (off64_t) sector_number * internal_volume->io_handle->bytes_per_sector ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: move journal does not match partition move.",
+			 function );
+
+			goto on_error;
+		}
+		/* When the partition entry was rewritten before the move was marked
+		 * completed the partition is already at its destination
+		 */
+		if( ( move_journal->source_offset != source_offset )
+		 && ( ( move_journal->state != LIBVSMBR_MOVE_JOURNAL_STATE_COPIED )
+		  ||  ( source_sector_number != sector_number )
+		  ||  ( partition_values->number_of_sectors != number_of_sectors ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: move journal does not match partition move.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		move_journal->state                   = LIBVSMBR_MOVE_JOURNAL_STATE_COPYING;
+		move_journal->partition_record_offset = partition_values->partition_record_offset;
+		move_journal->partition_entry_index   = partition_values->partition_entry_index;
+		move_journal->sector_number           = sector_number;
+		move_journal->number_of_sectors       = number_of_sectors;
+		move_journal->source_offset           = source_offset;
+		move_journal->destination_offset      = (off64_t) sector_number * internal_volume->io_handle->bytes_per_sector;
+		move_journal->data_size               = (size64_t) copy_number_of_sectors * internal_volume->io_handle->bytes_per_sector;
+		move_journal->copied_size             = 0;
+		move_journal->buffered_size           = 0;
+
+		if( journal_file_io_handle != NULL )
+		{
+			if( libvsmbr_move_journal_write_file_io_handle(
+			     move_journal,
+			     journal_file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write move journal.",
+				 function );
+
+				goto on_error;
 			}
-			partition_values = NULL;
 		}
 	}
-	if( extended_partition_record != NULL )
+	if( move_journal->state == LIBVSMBR_MOVE_JOURNAL_STATE_COPYING )
+	{
+		if( libvsmbr_data_mover_initialize(
+		     &data_mover,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     LIBVSMBR_MOVE_BLOCK_SIZE,
+		     LIBVSMBR_MOVE_CHECKPOINT_SIZE,
+		     number_of_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data mover.",
+			 function );
+
+			goto on_error;
+		}
+		if( libvsmbr_data_mover_copy(
+		     data_mover,
+		     move_journal,
+		     journal_file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to copy partition data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libvsmbr_data_mover_free(
+		     &data_mover,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data mover.",
+			 function );
+
+			goto on_error;
+		}
+		move_journal->state = LIBVSMBR_MOVE_JOURNAL_STATE_COPIED;
+
+		if( journal_file_io_handle != NULL )
+		{
+			if( libvsmbr_move_journal_write_file_io_handle(
+			     move_journal,
+			     journal_file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write move journal.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libvsmbr_internal_volume_write_partition_entry(
+	     internal_volume,
+	     partition_values,
+	     sector_number,
+	     number_of_sectors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write partition entry.",
+		 function );
+
+		goto on_error;
+	}
+	move_journal->state = LIBVSMBR_MOVE_JOURNAL_STATE_COMPLETED;
+
+	if( journal_file_io_handle != NULL )
+	{
+		if( libvsmbr_move_journal_write_file_io_handle(
+		     move_journal,
+		     journal_file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write move journal.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libvsmbr_move_journal_free(
+	     &move_journal,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free move journal.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( data_mover != NULL )
+	{
+		libvsmbr_data_mover_free(
+		 &data_mover,
+		 NULL );
+	}
+	if( move_journal != NULL )
+	{
+		libvsmbr_move_journal_free(
+		 &move_journal,
+		 NULL );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Moves and/or resizes a partition
+ * The sector number is relative to the start of the volume
+ * The data is copied by number_of_threads threads
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_volume_move_partition(
+     libvsmbr_volume_t *volume,
+     int partition_index,
+     uint32_t sector_number,
+     uint32_t number_of_sectors,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_volume_move_partition";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_internal_volume_move_partition(
+	     (libvsmbr_internal_volume_t *) volume,
+	     partition_index,
+	     sector_number,
+	     number_of_sectors,
+	     number_of_threads,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to move partition: %d.",
+		 function,
+		 partition_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Moves and/or resizes a partition using a journal file
+ * An interrupted move is resumed when called again with the same journal file and arguments
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_volume_move_partition_with_journal(
+     libvsmbr_volume_t *volume,
+     int partition_index,
+     uint32_t sector_number,
+     uint32_t number_of_sectors,
+     int number_of_threads,
+     const char *journal_filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libvsmbr_volume_move_partition_with_journal";
+	size_t filename_length           = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( journal_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   journal_filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     journal_filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_volume_move_partition_with_journal_file_io_handle(
+	     volume,
+	     partition_index,
+	     sector_number,
+	     number_of_sectors,
+	     number_of_threads,
+	     file_io_handle,
+	     error ) != 1 )
 	{
-		if( ( extended_partition_record_offset == 0 )
-		 || ( extended_partition_record_offset == file_offset ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: unsupported extended partition record offset.",
-			 function );
-
-			goto on_error;
-		}
-		if( is_master_boot_record != 0 )
-		{
-			first_extended_boot_record_offset = extended_partition_record_offset;
-		}
-		if( libvsmbr_internal_volume_read_partition_entries(
-		     internal_volume,
-		     file_io_handle,
-		     extended_partition_record_offset,
-		     extended_partition_record,
-		     0,
-		     first_extended_boot_record_offset,
-		     recursion_depth + 1,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read partition entries.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to move partition: %d with journal: %s.",
+		 function,
+		 partition_index,
+		 journal_filename );
 
-			goto on_error;
-		}
-		if( libvsmbr_boot_record_free(
-		     &extended_partition_record,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free extended partition record.",
-			 function );
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
 	return( 1 );
 
 on_error:
-	if( partition_values != NULL )
-	{
-		libvsmbr_partition_values_free(
-		 &partition_values,
-		 NULL );
-	}
-	if( extended_partition_record != NULL )
+	if( file_io_handle != NULL )
 	{
-		libvsmbr_boot_record_free(
-		 &extended_partition_record,
+		libbfio_handle_free(
+		 &file_io_handle,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Retrieves the number of bytes per sector
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Moves and/or resizes a partition using a journal file
+ * An interrupted move is resumed when called again with the same journal file and arguments
  * Returns 1 if successful or -1 on error
  */
-int libvsmbr_volume_get_bytes_per_sector(
+int libvsmbr_volume_move_partition_with_journal_wide(
      libvsmbr_volume_t *volume,
-     uint32_t *bytes_per_sector,
+     int partition_index,
+     uint32_t sector_number,
+     uint32_t number_of_sectors,
+     int number_of_threads,
+     const wchar_t *journal_filename,
      libcerror_error_t **error )
 {
-	libvsmbr_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libvsmbr_volume_get_bytes_per_sector";
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libvsmbr_volume_move_partition_with_journal_wide";
+	size_t filename_length           = 0;
 
 	if( volume == NULL )
 	{
@@ -1376,75 +5015,112 @@ int libvsmbr_volume_get_bytes_per_sector(
 
 		return( -1 );
 	}
-	internal_volume = (libvsmbr_internal_volume_t *) volume;
-
-	if( internal_volume->io_handle == NULL )
+	if( journal_filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( bytes_per_sector == NULL )
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid bytes per sector.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
+	filename_length = wide_string_length(
+	                   journal_filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     journal_filename,
+	     filename_length + 1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to set filename in file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	*bytes_per_sector = internal_volume->io_handle->bytes_per_sector;
-
-#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_volume->read_write_lock,
+	if( libvsmbr_volume_move_partition_with_journal_file_io_handle(
+	     volume,
+	     partition_index,
+	     sector_number,
+	     number_of_sectors,
+	     number_of_threads,
+	     file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to move partition: %d with journal: %ls.",
+		 function,
+		 partition_index,
+		 journal_filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
 	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Sets the number of bytes per sector
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Moves and/or resizes a partition using a journal Basic File IO (bfio) handle
+ * The journal file IO handle is opened for reading and writing if it is not open
  * Returns 1 if successful or -1 on error
  */
-int libvsmbr_volume_set_bytes_per_sector(
+int libvsmbr_volume_move_partition_with_journal_file_io_handle(
      libvsmbr_volume_t *volume,
-     uint32_t bytes_per_sector,
+     int partition_index,
+     uint32_t sector_number,
+     uint32_t number_of_sectors,
+     int number_of_threads,
+     libbfio_handle_t *journal_file_io_handle,
      libcerror_error_t **error )
 {
-	libvsmbr_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libvsmbr_volume_set_bytes_per_sector";
+	static char *function                = "libvsmbr_volume_move_partition_with_journal_file_io_handle";
+	int file_io_handle_is_open           = 0;
+	int file_io_handle_opened_in_library = 0;
+	int result                           = 1;
 
 	if( volume == NULL )
 	{
@@ -1457,92 +5133,157 @@ int libvsmbr_volume_set_bytes_per_sector(
 
 		return( -1 );
 	}
-	internal_volume = (libvsmbr_internal_volume_t *) volume;
-
-	if( internal_volume->io_handle == NULL )
+	if( journal_file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_volume->bytes_per_sector_set_by_library != 0 )
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          journal_file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: bytes per sector value already set.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if journal file IO handle is open.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( bytes_per_sector != 512 )
-	 && ( bytes_per_sector != 1024 )
-	 && ( bytes_per_sector != 2048 )
-	 && ( bytes_per_sector != 4096 ) )
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     journal_file_io_handle,
+		     LIBBFIO_OPEN_READ_WRITE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open journal file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+	if( libvsmbr_internal_volume_move_partition(
+	     (libvsmbr_internal_volume_t *) volume,
+	     partition_index,
+	     sector_number,
+	     number_of_sectors,
+	     number_of_threads,
+	     journal_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to move partition: %d.",
+		 function,
+		 partition_index );
+
+		result = -1;
+	}
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     journal_file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close journal file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Retrieves a snapshot of the statistics of the volume
+ * The statistics of the volume include those of all its partitions
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_volume_get_statistics(
+     libvsmbr_volume_t *volume,
+     libvsmbr_statistics_t **statistics,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsmbr_volume_get_statistics";
+
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported bytes per sector.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	internal_volume = (libvsmbr_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	internal_volume->io_handle->bytes_per_sector = bytes_per_sector;
-
-#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_volume->read_write_lock,
+	/* The counters are updated atomically hence the read/write lock
+	 * is not grabbed
+	 */
+	if( libvsmbr_statistics_clone(
+	     statistics,
+	     (libvsmbr_statistics_t *) &( internal_volume->io_handle->statistics ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics.",
 		 function );
 
 		return( -1 );
 	}
-#endif
 	return( 1 );
 }
 
-/* Retrieves the disk identity (or disk identifier)
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Starts recording a trace of the reads
+ * Returns 1 if successful or -1 on error
  */
-int libvsmbr_volume_get_disk_identity(
-     libvsmbr_volume_t *volume,
-     uint32_t *disk_identity,
+int libvsmbr_internal_volume_start_trace(
+     libvsmbr_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     uint8_t file_io_handle_created_in_library,
      libcerror_error_t **error )
 {
-	libvsmbr_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libvsmbr_volume_get_disk_identity";
-	int result                                  = 1;
+	static char *function = "libvsmbr_internal_volume_start_trace";
+	int result            = 1;
 
-	if( volume == NULL )
+	if( internal_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1553,15 +5294,13 @@ int libvsmbr_volume_get_disk_identity(
 
 		return( -1 );
 	}
-	internal_volume = (libvsmbr_internal_volume_t *) volume;
-
-	if( disk_identity == NULL )
+	if( internal_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid disk identity.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
 		 function );
 
 		return( -1 );
@@ -1581,11 +5320,22 @@ int libvsmbr_volume_get_disk_identity(
 		return( -1 );
 	}
 #endif
+	if( libvsmbr_trace_start(
+	     internal_volume->io_handle->trace,
+	     file_io_handle,
+	     file_io_handle_created_in_library,
+	     (uint32_t) internal_volume->io_handle->bytes_per_sector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start trace.",
+		 function );
 
-/* TODO add support to return 0 if not available */
-
-	*disk_identity = internal_volume->disk_identity;
-
+		result = -1;
+	}
 #if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
@@ -1604,17 +5354,18 @@ int libvsmbr_volume_get_disk_identity(
 	return( result );
 }
 
-/* Retrieves the number of partitions
+/* Starts recording a trace of the reads to a file
+ * An existing file is overwritten
  * Returns 1 if successful or -1 on error
  */
-int libvsmbr_volume_get_number_of_partitions(
+int libvsmbr_volume_start_trace(
      libvsmbr_volume_t *volume,
-     int *number_of_partitions,
+     const char *filename,
      libcerror_error_t **error )
 {
-	libvsmbr_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libvsmbr_volume_get_number_of_partitions";
-	int result                                  = 1;
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libvsmbr_volume_start_trace";
+	size_t filename_length           = 0;
 
 	if( volume == NULL )
 	{
@@ -1627,67 +5378,92 @@ int libvsmbr_volume_get_number_of_partitions(
 
 		return( -1 );
 	}
-	internal_volume = (libvsmbr_internal_volume_t *) volume;
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
 
-#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	if( libcdata_array_get_number_of_entries(
-	     internal_volume->partitions,
-	     number_of_partitions,
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of partitions from array.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_volume->read_write_lock,
+	/* The trace takes over the file IO handle
+	 */
+	if( libvsmbr_internal_volume_start_trace(
+	     (libvsmbr_internal_volume_t *) volume,
+	     file_io_handle,
+	     1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		 "%s: unable to start trace: %s.",
+		 function,
+		 filename );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	return( result );
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves a specific partition
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Starts recording a trace of the reads to a file
+ * An existing file is overwritten
  * Returns 1 if successful or -1 on error
  */
-int libvsmbr_volume_get_partition_by_index(
+int libvsmbr_volume_start_trace_wide(
      libvsmbr_volume_t *volume,
-     int partition_index,
-     libvsmbr_partition_t **partition,
+     const wchar_t *filename,
      libcerror_error_t **error )
 {
-	libvsmbr_internal_volume_t *internal_volume   = NULL;
-	libvsmbr_partition_values_t *partition_values = NULL;
-	static char *function                         = "libvsmbr_volume_get_partition_by_index";
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libvsmbr_volume_start_trace_wide";
+	size_t filename_length           = 0;
 
 	if( volume == NULL )
 	{
@@ -1700,101 +5476,171 @@ int libvsmbr_volume_get_partition_by_index(
 
 		return( -1 );
 	}
-	internal_volume = (libvsmbr_internal_volume_t *) volume;
-
-	if( partition == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid partition.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( *partition != NULL )
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid partition value already set.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to set filename in file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	if( libcdata_array_get_entry_by_index(
-	     internal_volume->partitions,
-	     partition_index,
-	     (intptr_t **) &partition_values,
+	/* The trace takes over the file IO handle
+	 */
+	if( libvsmbr_internal_volume_start_trace(
+	     (libvsmbr_internal_volume_t *) volume,
+	     file_io_handle,
+	     1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve partition values: %d from array.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start trace: %ls.",
 		 function,
-		 partition_index );
+		 filename );
 
 		goto on_error;
 	}
-	if( libvsmbr_partition_initialize(
-	     partition,
-	     internal_volume->io_handle,
-	     internal_volume->file_io_handle,
-	     partition_values,
-	     error ) != 1 )
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Starts recording a trace of the reads using a Basic File IO (bfio) handle
+ * The file IO handle is opened for writing if it is not open and
+ * must remain available until the trace is stopped
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_volume_start_trace_file_io_handle(
+     libvsmbr_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_volume_start_trace_file_io_handle";
+
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create partition: %d.",
-		 function,
-		 partition_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_volume->read_write_lock,
+	if( libvsmbr_internal_volume_start_trace(
+	     (libvsmbr_internal_volume_t *) volume,
+	     file_io_handle,
+	     0,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to start trace.",
 		 function );
 
 		return( -1 );
 	}
-#endif
 	return( 1 );
+}
 
-on_error:
-#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_read(
-	 internal_volume->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
+/* Stops recording the trace
+ * Returns 1 if successful, 0 if no trace was active or -1 on error
+ */
+int libvsmbr_volume_stop_trace(
+     libvsmbr_volume_t *volume,
+     libcerror_error_t **error )
+{
+	libvsmbr_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libvsmbr_volume_stop_trace";
+	int result                                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libvsmbr_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libvsmbr_trace_stop(
+	          internal_volume->io_handle->trace,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to stop trace.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
 }
 
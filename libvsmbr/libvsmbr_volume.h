@@ -32,6 +32,7 @@
 #include "libvsmbr_libcdata.h"
 #include "libvsmbr_libcerror.h"
 #include "libvsmbr_libcthreads.h"
+#include "libvsmbr_partition_values.h"
 #include "libvsmbr_types.h"
 
 #if defined( __cplusplus )
@@ -54,6 +55,14 @@ struct libvsmbr_internal_volume
 	 */
 	libcdata_array_t *partitions;
 
+	/* The sector number of the extended partition that contains the logical partitions
+	 */
+	uint64_t extended_partition_sector_number;
+
+	/* The number of sectors of the extended partition, 0 if there is none
+	 */
+	uint64_t extended_partition_number_of_sectors;
+
 	/* The IO handle
 	 */
 	libvsmbr_io_handle_t *io_handle;
@@ -70,6 +79,59 @@ struct libvsmbr_internal_volume
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
+	/* Value to indicate if the file IO handle is a libbfio file IO handle
+	 * that was created by the volume from a filename
+	 */
+	uint8_t file_io_handle_is_file;
+
+	/* The file IO pool, which is set when the volume was opened
+	 * from the segment files of a split image
+	 */
+	libbfio_pool_t *file_io_pool;
+
+	/* Value to indicate if the file IO pool was created inside the library
+	 */
+	uint8_t file_io_pool_created_in_library;
+
+	/* The base file IO handle, which is set when the file IO handle
+	 * redirects writes to the overlay file IO handle or serves reads
+	 * from the block cache file IO handle
+	 */
+	libbfio_handle_t *base_file_io_handle;
+
+	/* The block cache IO handle, which is set when the overlay IO handle
+	 * is stacked on the block cache IO handle
+	 */
+	libbfio_handle_t *block_cache_io_handle;
+
+	/* The overlay file IO handle
+	 */
+	libbfio_handle_t *overlay_file_io_handle;
+
+	/* Value to indicate if the overlay file IO handle was created inside the library
+	 */
+	uint8_t overlay_file_io_handle_created_in_library;
+
+	/* The block cache file IO handle
+	 */
+	libbfio_handle_t *block_cache_file_io_handle;
+
+	/* Value to indicate if the block cache file IO handle was created inside the library
+	 */
+	uint8_t block_cache_file_io_handle_created_in_library;
+
+	/* The maximum size of the block cache file
+	 */
+	size64_t maximum_block_cache_size;
+
+	/* The handle pool through which the volume file is opened
+	 */
+	libvsmbr_handle_pool_t *handle_pool;
+
+	/* The cache arena in which the sector data of the partitions is cached
+	 */
+	libvsmbr_cache_arena_t *cache_arena;
+
 	/* Value to indicate if bytes per sector was set by library
 	 */
 	uint8_t bytes_per_sector_set_by_library;
@@ -121,11 +183,122 @@ int libvsmbr_volume_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBVSMBR_EXTERN \
+int libvsmbr_volume_open_multiple(
+     libvsmbr_volume_t *volume,
+     char * const filenames[],
+     int number_of_filenames,
+     int access_flags,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBVSMBR_EXTERN \
+int libvsmbr_volume_open_multiple_wide(
+     libvsmbr_volume_t *volume,
+     wchar_t * const filenames[],
+     int number_of_filenames,
+     int access_flags,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBVSMBR_EXTERN \
+int libvsmbr_volume_open_file_io_pool(
+     libvsmbr_volume_t *volume,
+     libbfio_pool_t *file_io_pool,
+     int access_flags,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_volume_open_compressed_file_io_handle(
+     libvsmbr_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
 LIBVSMBR_EXTERN \
 int libvsmbr_volume_close(
      libvsmbr_volume_t *volume,
      libcerror_error_t **error );
 
+LIBVSMBR_EXTERN \
+int libvsmbr_volume_flush(
+     libvsmbr_volume_t *volume,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_volume_set_overlay(
+     libvsmbr_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     uint8_t file_io_handle_created_in_library,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_volume_set_overlay(
+     libvsmbr_volume_t *volume,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBVSMBR_EXTERN \
+int libvsmbr_volume_set_overlay_wide(
+     libvsmbr_volume_t *volume,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBVSMBR_EXTERN \
+int libvsmbr_volume_set_overlay_file_io_handle(
+     libvsmbr_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_volume_set_block_cache(
+     libvsmbr_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     uint8_t file_io_handle_created_in_library,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_volume_set_block_cache(
+     libvsmbr_volume_t *volume,
+     const char *filename,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBVSMBR_EXTERN \
+int libvsmbr_volume_set_block_cache_wide(
+     libvsmbr_volume_t *volume,
+     const wchar_t *filename,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBVSMBR_EXTERN \
+int libvsmbr_volume_set_block_cache_file_io_handle(
+     libvsmbr_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_volume_set_handle_pool(
+     libvsmbr_volume_t *volume,
+     libvsmbr_handle_pool_t *handle_pool,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_volume_set_cache_arena(
+     libvsmbr_volume_t *volume,
+     libvsmbr_cache_arena_t *cache_arena,
+     libcerror_error_t **error );
+
 int libvsmbr_internal_volume_open_read(
      libvsmbr_internal_volume_t *internal_volume,
      libbfio_handle_t *file_io_handle,
@@ -141,6 +314,13 @@ int libvsmbr_internal_volume_read_partition_entries(
      int recursion_depth,
      libcerror_error_t **error );
 
+int libvsmbr_internal_volume_read_boot_record(
+     libvsmbr_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libvsmbr_boot_record_t *boot_record,
+     libcerror_error_t **error );
+
 LIBVSMBR_EXTERN \
 int libvsmbr_volume_get_bytes_per_sector(
      libvsmbr_volume_t *volume,
@@ -172,6 +352,111 @@ int libvsmbr_volume_get_partition_by_index(
      libvsmbr_partition_t **partition,
      libcerror_error_t **error );
 
+int libvsmbr_internal_volume_write_partition_entry(
+     libvsmbr_internal_volume_t *internal_volume,
+     libvsmbr_partition_values_t *partition_values,
+     uint32_t sector_number,
+     uint32_t number_of_sectors,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_volume_is_sector_range_available(
+     libvsmbr_internal_volume_t *internal_volume,
+     int partition_index,
+     uint64_t sector_number,
+     uint64_t number_of_sectors,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_volume_move_partition(
+     libvsmbr_internal_volume_t *internal_volume,
+     int partition_index,
+     uint32_t sector_number,
+     uint32_t number_of_sectors,
+     int number_of_threads,
+     libbfio_handle_t *journal_file_io_handle,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_volume_move_partition(
+     libvsmbr_volume_t *volume,
+     int partition_index,
+     uint32_t sector_number,
+     uint32_t number_of_sectors,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_volume_move_partition_with_journal(
+     libvsmbr_volume_t *volume,
+     int partition_index,
+     uint32_t sector_number,
+     uint32_t number_of_sectors,
+     int number_of_threads,
+     const char *journal_filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBVSMBR_EXTERN \
+int libvsmbr_volume_move_partition_with_journal_wide(
+     libvsmbr_volume_t *volume,
+     int partition_index,
+     uint32_t sector_number,
+     uint32_t number_of_sectors,
+     int number_of_threads,
+     const wchar_t *journal_filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBVSMBR_EXTERN \
+int libvsmbr_volume_move_partition_with_journal_file_io_handle(
+     libvsmbr_volume_t *volume,
+     int partition_index,
+     uint32_t sector_number,
+     uint32_t number_of_sectors,
+     int number_of_threads,
+     libbfio_handle_t *journal_file_io_handle,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_volume_get_statistics(
+     libvsmbr_volume_t *volume,
+     libvsmbr_statistics_t **statistics,
+     libcerror_error_t **error );
+
+int libvsmbr_internal_volume_start_trace(
+     libvsmbr_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     uint8_t file_io_handle_created_in_library,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_volume_start_trace(
+     libvsmbr_volume_t *volume,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBVSMBR_EXTERN \
+int libvsmbr_volume_start_trace_wide(
+     libvsmbr_volume_t *volume,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBVSMBR_EXTERN \
+int libvsmbr_volume_start_trace_file_io_handle(
+     libvsmbr_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBVSMBR_EXTERN \
+int libvsmbr_volume_stop_trace(
+     libvsmbr_volume_t *volume,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
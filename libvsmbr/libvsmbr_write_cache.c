@@ -0,0 +1,1201 @@
+/*
+ * Write cache functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libvsmbr_definitions.h"
+#include "libvsmbr_dirty_block.h"
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcdata.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_libcthreads.h"
+#include "libvsmbr_write_cache.h"
+
+/* Creates a write cache
+ * Make sure the value write_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_write_cache_initialize(
+     libvsmbr_write_cache_t **write_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_write_cache_initialize";
+
+	if( write_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *write_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid write cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*write_cache = memory_allocate_structure(
+	                libvsmbr_write_cache_t );
+
+	if( *write_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create write cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *write_cache,
+	     0,
+	     sizeof( libvsmbr_write_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear write cache.",
+		 function );
+
+		memory_free(
+		 *write_cache );
+
+		*write_cache = NULL;
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( ( *write_cache )->blocks_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create blocks array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *write_cache )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *write_cache != NULL )
+	{
+		if( ( *write_cache )->blocks_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *write_cache )->blocks_array ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 *write_cache );
+
+		*write_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a write cache
+ * Dirty blocks that were not flushed are discarded
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_write_cache_free(
+     libvsmbr_write_cache_t **write_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_write_cache_free";
+	int result            = 1;
+
+	if( write_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *write_cache != NULL )
+	{
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *write_cache )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( libcdata_array_free(
+		     &( ( *write_cache )->blocks_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libvsmbr_dirty_block_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free blocks array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *write_cache );
+
+		*write_cache = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the dirty block at a specific block offset
+ * This function is not multi-thread safe acquire mutex before call
+ * Returns 1 if successful, 0 if no such block or -1 on error
+ */
+int libvsmbr_write_cache_get_block_at_offset(
+     libvsmbr_write_cache_t *write_cache,
+     off64_t block_offset,
+     libvsmbr_dirty_block_t **dirty_block,
+     libcerror_error_t **error )
+{
+	libvsmbr_dirty_block_t *safe_dirty_block = NULL;
+	static char *function                    = "libvsmbr_write_cache_get_block_at_offset";
+	int block_index                          = 0;
+	int first_block_index                    = 0;
+	int last_block_index                     = 0;
+	int number_of_blocks                     = 0;
+
+	if( write_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( dirty_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dirty block.",
+		 function );
+
+		return( -1 );
+	}
+	*dirty_block = NULL;
+
+	if( libcdata_array_get_number_of_entries(
+	     write_cache->blocks_array,
+	     &number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+	first_block_index = 0;
+	last_block_index  = number_of_blocks - 1;
+
+	while( first_block_index <= last_block_index )
+	{
+		block_index = first_block_index + ( ( last_block_index - first_block_index ) / 2 );
+
+		if( libcdata_array_get_entry_by_index(
+		     write_cache->blocks_array,
+		     block_index,
+		     (intptr_t **) &safe_dirty_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve block: %d.",
+			 function,
+			 block_index );
+
+			return( -1 );
+		}
+		if( safe_dirty_block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing block: %d.",
+			 function,
+			 block_index );
+
+			return( -1 );
+		}
+		if( block_offset < safe_dirty_block->offset )
+		{
+			last_block_index = block_index - 1;
+		}
+		else if( block_offset > safe_dirty_block->offset )
+		{
+			first_block_index = block_index + 1;
+		}
+		else
+		{
+			*dirty_block = safe_dirty_block;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the generation and the number of dirty blocks
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_write_cache_get_state(
+     libvsmbr_write_cache_t *write_cache,
+     uint32_t *generation,
+     int *number_of_blocks,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_write_cache_get_state";
+	int result            = 1;
+
+	if( write_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( generation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generation.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     write_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*generation = write_cache->generation;
+
+	if( libcdata_array_get_number_of_entries(
+	     write_cache->blocks_array,
+	     number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of blocks.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     write_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads data at a specific volume offset from the dirty blocks
+ * At most the data up to the end of the dirty block is read
+ * Returns 1 if successful, 0 if the offset is not in a dirty block or -1 on error
+ */
+int libvsmbr_write_cache_read_buffer(
+     libvsmbr_write_cache_t *write_cache,
+     off64_t offset,
+     uint8_t *buffer,
+     size_t buffer_size,
+     size_t *read_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_dirty_block_t *dirty_block = NULL;
+	static char *function               = "libvsmbr_write_cache_read_buffer";
+	size_t block_data_offset            = 0;
+	size_t safe_read_size               = 0;
+	int result                          = 0;
+
+	if( write_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     write_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( write_cache->block_size != 0 )
+	{
+		block_data_offset = (size_t) ( offset % write_cache->block_size );
+
+		result = libvsmbr_write_cache_get_block_at_offset(
+		          write_cache,
+		          offset - block_data_offset,
+		          &dirty_block,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+		}
+		else if( result != 0 )
+		{
+			safe_read_size = dirty_block->data_size - block_data_offset;
+
+			if( safe_read_size > buffer_size )
+			{
+				safe_read_size = buffer_size;
+			}
+			if( memory_copy(
+			     buffer,
+			     &( dirty_block->data[ block_data_offset ] ),
+			     safe_read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy block data.",
+				 function );
+
+				result = -1;
+			}
+			*read_size = safe_read_size;
+		}
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     write_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Writes data at a specific volume offset into dirty blocks
+ * The part of a new dirty block that is not overwritten is read from the file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_write_cache_write_buffer(
+     libvsmbr_write_cache_t *write_cache,
+     libbfio_handle_t *file_io_handle,
+     size_t block_size,
+     off64_t offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_dirty_block_t *dirty_block = NULL;
+	libvsmbr_dirty_block_t *new_block   = NULL;
+	static char *function               = "libvsmbr_write_cache_write_buffer";
+	size_t block_data_offset            = 0;
+	size_t buffer_offset                = 0;
+	size_t write_size                   = 0;
+	ssize_t read_count                  = 0;
+	off64_t block_offset                = 0;
+	int block_index                     = 0;
+	int number_of_blocks                = 0;
+	int result                          = 0;
+
+	if( write_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     write_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     write_cache->blocks_array,
+	     &number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of blocks.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_blocks == 0 )
+	{
+		write_cache->block_size = block_size;
+	}
+	else if( block_size != write_cache->block_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_CONFLICTING_VALUE,
+		 "%s: invalid block size value does not match size of dirty blocks.",
+		 function );
+
+		goto on_error;
+	}
+	while( buffer_offset < buffer_size )
+	{
+		block_data_offset = (size_t) ( offset % block_size );
+		block_offset      = offset - block_data_offset;
+
+		write_size = block_size - block_data_offset;
+
+		if( write_size > ( buffer_size - buffer_offset ) )
+		{
+			write_size = buffer_size - buffer_offset;
+		}
+		result = libvsmbr_write_cache_get_block_at_offset(
+		          write_cache,
+		          block_offset,
+		          &dirty_block,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 block_offset,
+			 block_offset );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			/* Bound the memory used by the dirty blocks by writing them
+			 * before a new one would exceed the maximum
+			 */
+			if( number_of_blocks >= LIBVSMBR_MAXIMUM_WRITE_CACHE_NUMBER_OF_BLOCKS )
+			{
+				if( libvsmbr_write_cache_flush_blocks(
+				     write_cache,
+				     file_io_handle,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to flush dirty blocks.",
+					 function );
+
+					goto on_error;
+				}
+				number_of_blocks = 0;
+			}
+			if( libvsmbr_dirty_block_initialize(
+			     &new_block,
+			     block_offset,
+			     block_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create dirty block.",
+				 function );
+
+				goto on_error;
+			}
+			/* A block that is only partially overwritten is read first
+			 * the part beyond the end of the file IO handle is zero
+			 */
+			if( write_size < block_size )
+			{
+				read_count = libbfio_handle_read_buffer_at_offset(
+				              file_io_handle,
+				              new_block->data,
+				              block_size,
+				              block_offset,
+				              error );
+
+				if( read_count < 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 block_offset,
+					 block_offset );
+
+					goto on_error;
+				}
+				if( (size_t) read_count < block_size )
+				{
+					if( memory_set(
+					     &( new_block->data[ read_count ] ),
+					     0,
+					     block_size - (size_t) read_count ) == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+						 "%s: unable to clear block data.",
+						 function );
+
+						goto on_error;
+					}
+				}
+			}
+			if( libcdata_array_insert_entry(
+			     write_cache->blocks_array,
+			     &block_index,
+			     (intptr_t *) new_block,
+			     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libvsmbr_dirty_block_compare,
+			     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert dirty block.",
+				 function );
+
+				goto on_error;
+			}
+			dirty_block = new_block;
+			new_block   = NULL;
+
+			number_of_blocks++;
+		}
+		if( memory_copy(
+		     &( dirty_block->data[ block_data_offset ] ),
+		     &( buffer[ buffer_offset ] ),
+		     write_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to dirty block.",
+			 function );
+
+			goto on_error;
+		}
+		offset        += write_size;
+		buffer_offset += write_size;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     write_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( new_block != NULL )
+	{
+		libvsmbr_dirty_block_free(
+		 &new_block,
+		 NULL );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 write_cache->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Writes the dirty blocks to the file IO handle
+ * The blocks are written in order of offset and adjacent blocks are merged
+ * into a single write, the blocks remain dirty if a write fails
+ * This function is not multi-thread safe acquire mutex before call
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_write_cache_flush_blocks(
+     libvsmbr_write_cache_t *write_cache,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libvsmbr_dirty_block_t *dirty_block = NULL;
+	uint8_t *run_data                   = NULL;
+	static char *function               = "libvsmbr_write_cache_flush_blocks";
+	size_t maximum_run_size             = 0;
+	size_t run_size                     = 0;
+	ssize_t write_count                 = 0;
+	off64_t run_offset                  = 0;
+	int block_index                     = 0;
+	int number_of_blocks                = 0;
+
+	if( write_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     write_cache->blocks_array,
+	     &number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of blocks.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_blocks == 0 )
+	{
+		return( 1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	maximum_run_size = LIBVSMBR_MAXIMUM_WRITE_CACHE_FLUSH_SIZE;
+
+	if( maximum_run_size < write_cache->block_size )
+	{
+		maximum_run_size = write_cache->block_size;
+	}
+	if( (size_t) number_of_blocks < ( maximum_run_size / write_cache->block_size ) )
+	{
+		maximum_run_size = (size_t) number_of_blocks * write_cache->block_size;
+	}
+	run_data = (uint8_t *) memory_allocate(
+	                        sizeof( uint8_t ) * maximum_run_size );
+
+	if( run_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create run data.",
+		 function );
+
+		goto on_error;
+	}
+	for( block_index = 0;
+	     block_index <= number_of_blocks;
+	     block_index++ )
+	{
+		dirty_block = NULL;
+
+		if( block_index < number_of_blocks )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     write_cache->blocks_array,
+			     block_index,
+			     (intptr_t **) &dirty_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve block: %d.",
+				 function,
+				 block_index );
+
+				goto on_error;
+			}
+			if( dirty_block == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing block: %d.",
+				 function,
+				 block_index );
+
+				goto on_error;
+			}
+		}
+		/* Write the current run when the next block does not extend it
+		 */
+		if( ( run_size > 0 )
+		 && ( ( dirty_block == NULL )
+		  || ( dirty_block->offset != ( run_offset + (off64_t) run_size ) )
+		  || ( ( run_size + dirty_block->data_size ) > maximum_run_size ) ) )
+		{
+			write_count = libbfio_handle_write_buffer_at_offset(
+			               file_io_handle,
+			               run_data,
+			               run_size,
+			               run_offset,
+			               error );
+
+			if( write_count != (ssize_t) run_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write blocks at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 run_offset,
+				 run_offset );
+
+				goto on_error;
+			}
+			run_size = 0;
+		}
+		if( dirty_block != NULL )
+		{
+			if( run_size == 0 )
+			{
+				run_offset = dirty_block->offset;
+			}
+			if( memory_copy(
+			     &( run_data[ run_size ] ),
+			     dirty_block->data,
+			     dirty_block->data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy block data.",
+				 function );
+
+				goto on_error;
+			}
+			run_size += dirty_block->data_size;
+		}
+	}
+	memory_free(
+	 run_data );
+
+	run_data = NULL;
+
+	if( libcdata_array_empty(
+	     write_cache->blocks_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libvsmbr_dirty_block_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty blocks array.",
+		 function );
+
+		goto on_error;
+	}
+	write_cache->generation += 1;
+
+	return( 1 );
+
+on_error:
+	if( run_data != NULL )
+	{
+		memory_free(
+		 run_data );
+	}
+	return( -1 );
+}
+
+/* Writes the dirty blocks to the file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_write_cache_flush(
+     libvsmbr_write_cache_t *write_cache,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_write_cache_flush";
+	int result            = 1;
+
+	if( write_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     write_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libvsmbr_write_cache_flush_blocks(
+	     write_cache,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush dirty blocks.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     write_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Discards the dirty blocks without writing them
+ * Returns 1 if successful or -1 on error
+ */
+int libvsmbr_write_cache_discard(
+     libvsmbr_write_cache_t *write_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libvsmbr_write_cache_discard";
+	int result            = 1;
+
+	if( write_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     write_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_empty(
+	     write_cache->blocks_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libvsmbr_dirty_block_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty blocks array.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     write_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
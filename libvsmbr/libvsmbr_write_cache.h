@@ -0,0 +1,121 @@
+/*
+ * Write cache functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBVSMBR_WRITE_CACHE_H )
+#define _LIBVSMBR_WRITE_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libvsmbr_dirty_block.h"
+#include "libvsmbr_libbfio.h"
+#include "libvsmbr_libcdata.h"
+#include "libvsmbr_libcerror.h"
+#include "libvsmbr_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libvsmbr_write_cache libvsmbr_write_cache_t;
+
+/* The write cache is shared by all partitions of a volume so that
+ * they see the same data, the blocks are keyed by their volume offset
+ */
+struct libvsmbr_write_cache
+{
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The dirty blocks array, sorted by offset
+	 */
+	libcdata_array_t *blocks_array;
+
+	/* The generation, which is incremented every time dirty blocks
+	 * are written so that readers can invalidate the data they cached
+	 */
+	uint32_t generation;
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libvsmbr_write_cache_initialize(
+     libvsmbr_write_cache_t **write_cache,
+     libcerror_error_t **error );
+
+int libvsmbr_write_cache_free(
+     libvsmbr_write_cache_t **write_cache,
+     libcerror_error_t **error );
+
+int libvsmbr_write_cache_get_block_at_offset(
+     libvsmbr_write_cache_t *write_cache,
+     off64_t block_offset,
+     libvsmbr_dirty_block_t **dirty_block,
+     libcerror_error_t **error );
+
+int libvsmbr_write_cache_get_state(
+     libvsmbr_write_cache_t *write_cache,
+     uint32_t *generation,
+     int *number_of_blocks,
+     libcerror_error_t **error );
+
+int libvsmbr_write_cache_read_buffer(
+     libvsmbr_write_cache_t *write_cache,
+     off64_t offset,
+     uint8_t *buffer,
+     size_t buffer_size,
+     size_t *read_size,
+     libcerror_error_t **error );
+
+int libvsmbr_write_cache_write_buffer(
+     libvsmbr_write_cache_t *write_cache,
+     libbfio_handle_t *file_io_handle,
+     size_t block_size,
+     off64_t offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int libvsmbr_write_cache_flush_blocks(
+     libvsmbr_write_cache_t *write_cache,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_write_cache_flush(
+     libvsmbr_write_cache_t *write_cache,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libvsmbr_write_cache_discard(
+     libvsmbr_write_cache_t *write_cache,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBVSMBR_WRITE_CACHE_H ) */
+
@@ -0,0 +1,103 @@
+/*
+ * Block cache file definitions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _VSMBR_BLOCK_CACHE_H )
+#define _VSMBR_BLOCK_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct vsmbr_block_cache_file_header vsmbr_block_cache_file_header_t;
+
+struct vsmbr_block_cache_file_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains "VSMBRBCF"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The block size
+	 * Consists of 4 bytes
+	 */
+	uint8_t block_size[ 4 ];
+
+	/* The number of sets
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_sets[ 4 ];
+
+	/* The number of entries per set
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_ways[ 4 ];
+
+	/* The offset of the block data
+	 * Consists of 8 bytes
+	 */
+	uint8_t data_offset[ 8 ];
+};
+
+/* The file header is stored in the first 512 bytes and followed by
+ * number of sets x number of ways index entries, the block data starts
+ * at the data offset and contains a block per index entry
+ */
+
+typedef struct vsmbr_block_cache_entry vsmbr_block_cache_entry_t;
+
+struct vsmbr_block_cache_entry
+{
+	/* The image identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t image_identifier[ 8 ];
+
+	/* The block offset in the image
+	 * Consists of 8 bytes
+	 */
+	uint8_t block_offset[ 8 ];
+
+	/* The sequence number of the last access, where 0 represents an unused entry
+	 * Consists of 8 bytes
+	 */
+	uint8_t sequence_number[ 8 ];
+
+	/* The FNV-1a 64-bit checksum of the block data
+	 * Consists of 8 bytes
+	 */
+	uint8_t checksum[ 8 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _VSMBR_BLOCK_CACHE_H ) */
+
@@ -0,0 +1,81 @@
+/*
+ * Block hash index file definitions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _VSMBR_BLOCK_HASH_INDEX_H )
+#define _VSMBR_BLOCK_HASH_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct vsmbr_block_hash_index_file_header vsmbr_block_hash_index_file_header_t;
+
+struct vsmbr_block_hash_index_file_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains "VSMBRBHI"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The digest type
+	 * Consists of 4 bytes
+	 */
+	uint8_t digest_type[ 4 ];
+
+	/* The block size
+	 * Consists of 4 bytes
+	 */
+	uint8_t block_size[ 4 ];
+
+	/* The digest size
+	 * Consists of 4 bytes
+	 */
+	uint8_t digest_size[ 4 ];
+
+	/* The data size
+	 * Consists of 8 bytes
+	 */
+	uint8_t data_size[ 8 ];
+
+	/* The number of blocks
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_blocks[ 8 ];
+};
+
+/* The header is followed by number of blocks x digest size bytes of digests
+ */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _VSMBR_BLOCK_HASH_INDEX_H ) */
+
@@ -0,0 +1,114 @@
+/*
+ * Gzip member definitions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _VSMBR_GZIP_MEMBER_H )
+#define _VSMBR_GZIP_MEMBER_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct vsmbr_gzip_member_header vsmbr_gzip_member_header_t;
+
+struct vsmbr_gzip_member_header
+{
+	/* The signature
+	 * Consists of 2 bytes
+	 * Contains 0x1f 0x8b
+	 */
+	uint8_t signature[ 2 ];
+
+	/* The compression method
+	 * Consists of 1 byte
+	 * Contains 8 (deflate)
+	 */
+	uint8_t compression_method;
+
+	/* The flags
+	 * Consists of 1 byte
+	 */
+	uint8_t flags;
+
+	/* The modification time
+	 * Consists of 4 bytes
+	 */
+	uint8_t modification_time[ 4 ];
+
+	/* The compression flags
+	 * Consists of 1 byte
+	 */
+	uint8_t compression_flags;
+
+	/* The operating system
+	 * Consists of 1 byte
+	 */
+	uint8_t operating_system;
+
+	/* The extra field size
+	 * Consists of 2 bytes
+	 */
+	uint8_t extra_field_size[ 2 ];
+};
+
+/* The member header is followed by the extra field, that consists of
+ * subfields, a BGZF member contains a subfield with identifier "BC"
+ * and 2 bytes of data that contain the member size minus 1
+ */
+
+typedef struct vsmbr_gzip_extra_subfield_header vsmbr_gzip_extra_subfield_header_t;
+
+struct vsmbr_gzip_extra_subfield_header
+{
+	/* The identifier
+	 * Consists of 2 bytes
+	 */
+	uint8_t identifier[ 2 ];
+
+	/* The data size
+	 * Consists of 2 bytes
+	 */
+	uint8_t data_size[ 2 ];
+};
+
+typedef struct vsmbr_gzip_member_footer vsmbr_gzip_member_footer_t;
+
+struct vsmbr_gzip_member_footer
+{
+	/* The CRC-32 of the uncompressed data
+	 * Consists of 4 bytes
+	 */
+	uint8_t checksum[ 4 ];
+
+	/* The uncompressed data size, modulo 2^32
+	 * Consists of 4 bytes
+	 */
+	uint8_t uncompressed_data_size[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _VSMBR_GZIP_MEMBER_H ) */
+
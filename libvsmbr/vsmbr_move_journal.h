@@ -0,0 +1,103 @@
+/*
+ * Partition move journal file definitions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _VSMBR_MOVE_JOURNAL_H )
+#define _VSMBR_MOVE_JOURNAL_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct vsmbr_move_journal vsmbr_move_journal_t;
+
+struct vsmbr_move_journal
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains "VSMBRMVJ"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The state
+	 * Consists of 4 bytes
+	 */
+	uint8_t state[ 4 ];
+
+	/* The offset of the partition record that contains the partition entry
+	 * Consists of 8 bytes
+	 */
+	uint8_t partition_record_offset[ 8 ];
+
+	/* The partition entry index
+	 * Consists of 4 bytes
+	 */
+	uint8_t partition_entry_index[ 4 ];
+
+	/* The destination sector number
+	 * Consists of 4 bytes
+	 */
+	uint8_t sector_number[ 4 ];
+
+	/* The destination number of sectors
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_sectors[ 4 ];
+
+	/* The size of the buffered data
+	 * Consists of 4 bytes
+	 */
+	uint8_t buffered_size[ 4 ];
+
+	/* The source offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t source_offset[ 8 ];
+
+	/* The destination offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t destination_offset[ 8 ];
+
+	/* The data size
+	 * Consists of 8 bytes
+	 */
+	uint8_t data_size[ 8 ];
+
+	/* The size of the data that has been copied
+	 * Consists of 8 bytes
+	 */
+	uint8_t copied_size[ 8 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _VSMBR_MOVE_JOURNAL_H ) */
+
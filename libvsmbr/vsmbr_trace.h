@@ -0,0 +1,115 @@
+/*
+ * Trace file definitions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _VSMBR_TRACE_H )
+#define _VSMBR_TRACE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct vsmbr_trace_file_header vsmbr_trace_file_header_t;
+
+struct vsmbr_trace_file_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains "VSMBRTRC"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The record size
+	 * Consists of 4 bytes
+	 */
+	uint8_t record_size[ 4 ];
+
+	/* The number of bytes per sector of the volume
+	 * Consists of 4 bytes
+	 */
+	uint8_t bytes_per_sector[ 4 ];
+
+	/* Unknown (reserved)
+	 * Consists of 12 bytes
+	 */
+	uint8_t unknown1[ 12 ];
+};
+
+typedef struct vsmbr_trace_record vsmbr_trace_record_t;
+
+struct vsmbr_trace_record
+{
+	/* The timestamp
+	 * Consists of 8 bytes
+	 * Contains the number of nano seconds since the start of the trace
+	 */
+	uint8_t timestamp[ 8 ];
+
+	/* The offset
+	 * Consists of 8 bytes
+	 * Contains the offset relative to the start of the partition for
+	 * a request or the offset in the storage media for a backing read
+	 */
+	uint8_t offset[ 8 ];
+
+	/* The size
+	 * Consists of 4 bytes
+	 */
+	uint8_t size[ 4 ];
+
+	/* The thread identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t thread_identifier[ 4 ];
+
+	/* The partition index
+	 * Consists of 4 bytes
+	 * Contains 0xffffffff for reads of the volume itself
+	 */
+	uint8_t partition_index[ 4 ];
+
+	/* The record type
+	 * Consists of 1 byte
+	 */
+	uint8_t record_type;
+
+	/* Unknown (reserved)
+	 * Consists of 3 bytes
+	 */
+	uint8_t unknown1[ 3 ];
+};
+
+/* The header is followed by records until the end of the file
+ */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _VSMBR_TRACE_H ) */
+
@@ -65,10 +65,12 @@ AC_DEFUN([AX_LIBBFIO_CHECK_LIB],
           [libbfio],
           [bfio],
           [[libbfio_get_version],
+           [libbfio_handle_clone],
            [libbfio_handle_free],
            [libbfio_handle_open],
            [libbfio_handle_close],
            [libbfio_handle_exists],
+           [libbfio_handle_flush],
            [libbfio_handle_read_buffer],
            [libbfio_handle_read_buffer_at_offset],
            [libbfio_handle_write_buffer],
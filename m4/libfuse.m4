@@ -0,0 +1,277 @@
+dnl Checks for libfuse required headers and functions
+dnl
+dnl Version: 20260601
+
+dnl Function to detect if libfuse is available
+dnl ac_libfuse_dummy is used to prevent AC_CHECK_LIB adding unnecessary -l<library> arguments
+AC_DEFUN([AX_LIBFUSE_CHECK_LIB],
+  [AS_IF(
+    [test "x$ac_cv_enable_shared_libs" = xno || test "x$ac_cv_with_libfuse" = xno],
+    [ac_cv_libfuse=no],
+    [ac_cv_libfuse=check
+    dnl Check if the directory provided as parameter exists
+    dnl For both --with-libfuse which returns "yes" and --with-libfuse= which returns ""
+    dnl treat them as auto-detection.
+    AS_IF(
+      [test "x$ac_cv_with_libfuse" != x && test "x$ac_cv_with_libfuse" != xauto-detect && test "x$ac_cv_with_libfuse" != xyes],
+      [AX_CHECK_LIB_DIRECTORY_EXISTS([libfuse])],
+      [dnl Check for a pkg-config file
+      AS_IF(
+        [test "x$cross_compiling" != "xyes" && test "x$PKGCONFIG" != "x"],
+        [PKG_CHECK_MODULES(
+          [fuse3],
+          [fuse3 >= 3.0],
+          [ac_cv_libfuse=libfuse3],
+          [ac_cv_libfuse=check])
+
+        AS_IF(
+          [test "x$ac_cv_libfuse" = xcheck],
+          [PKG_CHECK_MODULES(
+            [fuse],
+            [fuse >= 2.6],
+            [ac_cv_libfuse=libfuse],
+            [ac_cv_libfuse=check])
+          ])
+        ])
+      AS_IF(
+        [test "x$ac_cv_libfuse" = xlibfuse3],
+        [ac_cv_libfuse_CPPFLAGS="$pkg_cv_fuse3_CFLAGS"
+        ac_cv_libfuse_LIBADD="$pkg_cv_fuse3_LIBS"])
+      AS_IF(
+        [test "x$ac_cv_libfuse" = xlibfuse],
+        [ac_cv_libfuse_CPPFLAGS="$pkg_cv_fuse_CFLAGS"
+        ac_cv_libfuse_LIBADD="$pkg_cv_fuse_LIBS"])
+      ])
+
+    AS_IF(
+      [test "x$ac_cv_libfuse" = xcheck],
+      [dnl Check for headers
+
+      dnl Headers included in libfuse require _FILE_OFFSET_BITS to be set
+      BACKUP_CPPFLAGS="$CPPFLAGS"
+      CPPFLAGS="$CPPFLAGS -D_FILE_OFFSET_BITS=64"
+
+      AC_CHECK_HEADERS([fuse.h])
+
+      AS_IF(
+        [test "x$ac_cv_header_fuse_h" = xyes],
+        [ac_cv_libfuse=libfuse],
+        [AC_CHECK_HEADERS([osxfuse/fuse.h])
+
+        AS_IF(
+          [test "x$ac_cv_header_osxfuse_fuse_h" = xyes],
+          [ac_cv_libfuse=libosxfuse],
+          [ac_cv_libfuse=no])
+        ])
+
+      AS_IF(
+        [test "x$ac_cv_libfuse" = xlibfuse],
+        [dnl Check for the individual functions
+        ac_cv_libfuse_dummy=yes
+
+        AC_CHECK_LIB(
+          fuse,
+          fuse_daemonize,
+          [ac_cv_libfuse_dummy=yes],
+          [ac_cv_libfuse=no])
+        AC_CHECK_LIB(
+          fuse,
+          fuse_destroy,
+          [ac_cv_libfuse_dummy=yes],
+          [ac_cv_libfuse=no])
+        AC_CHECK_LIB(
+          fuse,
+          fuse_mount,
+          [ac_cv_libfuse_dummy=yes],
+          [ac_cv_libfuse=no])
+        AC_CHECK_LIB(
+          fuse,
+          fuse_new,
+          [ac_cv_libfuse_dummy=yes],
+          [ac_cv_libfuse=no])
+        AC_CHECK_LIB(
+          fuse,
+          fuse_loop_mt,
+          [ac_cv_libfuse_dummy=yes],
+          [ac_cv_libfuse=no])
+        AC_CHECK_LIB(
+          fuse,
+          fuse_opt_add_arg,
+          [ac_cv_libfuse_dummy=yes],
+          [ac_cv_libfuse=no])
+        AC_CHECK_LIB(
+          fuse,
+          fuse_opt_free_args,
+          [ac_cv_libfuse_dummy=yes],
+          [ac_cv_libfuse=no])
+        AC_CHECK_LIB(
+          fuse,
+          fuse_unmount,
+          [ac_cv_libfuse_dummy=yes],
+          [ac_cv_libfuse=no])
+
+        ac_cv_libfuse_CPPFLAGS="-D_FILE_OFFSET_BITS=64"
+        ac_cv_libfuse_LIBADD="-lfuse"])
+
+      AS_IF(
+        [test "x$ac_cv_libfuse" = xlibosxfuse],
+        [dnl Check for the individual functions
+        ac_cv_libfuse_dummy=yes
+
+        AC_CHECK_LIB(
+          osxfuse,
+          fuse_daemonize,
+          [ac_cv_libfuse_dummy=yes],
+          [ac_cv_libfuse=no])
+        AC_CHECK_LIB(
+          osxfuse,
+          fuse_destroy,
+          [ac_cv_libfuse_dummy=yes],
+          [ac_cv_libfuse=no])
+        AC_CHECK_LIB(
+          osxfuse,
+          fuse_mount,
+          [ac_cv_libfuse_dummy=yes],
+          [ac_cv_libfuse=no])
+        AC_CHECK_LIB(
+          osxfuse,
+          fuse_new,
+          [ac_cv_libfuse_dummy=yes],
+          [ac_cv_libfuse=no])
+        AC_CHECK_LIB(
+          osxfuse,
+          fuse_loop_mt,
+          [ac_cv_libfuse_dummy=yes],
+          [ac_cv_libfuse=no])
+        AC_CHECK_LIB(
+          osxfuse,
+          fuse_opt_add_arg,
+          [ac_cv_libfuse_dummy=yes],
+          [ac_cv_libfuse=no])
+        AC_CHECK_LIB(
+          osxfuse,
+          fuse_opt_free_args,
+          [ac_cv_libfuse_dummy=yes],
+          [ac_cv_libfuse=no])
+        AC_CHECK_LIB(
+          osxfuse,
+          fuse_unmount,
+          [ac_cv_libfuse_dummy=yes],
+          [ac_cv_libfuse=no])
+
+        ac_cv_libfuse_CPPFLAGS="-D_FILE_OFFSET_BITS=64"
+        ac_cv_libfuse_LIBADD="-losxfuse"])
+
+      CPPFLAGS="$BACKUP_CPPFLAGS"
+      ])
+
+    AX_CHECK_LIB_DIRECTORY_MSG_ON_FAILURE([libfuse])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_libfuse" = xlibfuse3],
+    [AC_DEFINE(
+      [HAVE_LIBFUSE3],
+      [1],
+      [Define to 1 if you have the 'fuse3' library (-lfuse3).])
+    ])
+  AS_IF(
+    [test "x$ac_cv_libfuse" = xlibfuse],
+    [AC_DEFINE(
+      [HAVE_LIBFUSE],
+      [1],
+      [Define to 1 if you have the 'fuse' library (-lfuse).])
+    ])
+  AS_IF(
+    [test "x$ac_cv_libfuse" = xlibosxfuse],
+    [AC_DEFINE(
+      [HAVE_LIBOSXFUSE],
+      [1],
+      [Define to 1 if you have the 'osxfuse' library (-losxfuse).])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_libfuse" != xno],
+    [AC_SUBST(
+      [HAVE_LIBFUSE],
+      [1]) ],
+    [AC_SUBST(
+      [HAVE_LIBFUSE],
+      [0])
+    ])
+  ])
+
+dnl Function to detect if libfuse is available
+AC_DEFUN([AX_LIBFUSE_CHECK_ENABLE],
+  [AX_COMMON_ARG_WITH(
+    [libfuse],
+    [libfuse],
+    [search for libfuse in includedir and libdir or in the specified DIR, or no if not to use libfuse],
+    [auto-detect],
+    [DIR])
+
+  AX_LIBFUSE_CHECK_LIB
+
+  AS_IF(
+    [test "x$ac_cv_libfuse_CPPFLAGS" != "x"],
+    [AC_SUBST(
+      [LIBFUSE_CPPFLAGS],
+      [$ac_cv_libfuse_CPPFLAGS])
+    ])
+  AS_IF(
+    [test "x$ac_cv_libfuse_LIBADD" != "x"],
+    [AC_SUBST(
+      [LIBFUSE_LIBADD],
+      [$ac_cv_libfuse_LIBADD])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_libfuse" = xlibfuse3],
+    [AC_SUBST(
+      [ax_libfuse_pc_libs_private],
+      [-lfuse3])
+    ])
+  AS_IF(
+    [test "x$ac_cv_libfuse" = xlibfuse],
+    [AC_SUBST(
+      [ax_libfuse_pc_libs_private],
+      [-lfuse])
+    ])
+  AS_IF(
+    [test "x$ac_cv_libfuse" = xlibosxfuse],
+    [AC_SUBST(
+      [ax_libfuse_pc_libs_private],
+      [-losxfuse])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_libfuse" = xlibfuse3],
+    [AC_SUBST(
+      [ax_libfuse_spec_requires],
+      [fuse3-libs])
+    AC_SUBST(
+      [ax_libfuse_spec_build_requires],
+      [fuse3-devel])
+    AC_SUBST(
+      [ax_libfuse_static_spec_requires],
+      [fuse3-static])
+    AC_SUBST(
+      [ax_libfuse_static_spec_build_requires],
+      [fuse3-static])
+    ])
+  AS_IF(
+    [test "x$ac_cv_libfuse" = xlibfuse],
+    [AC_SUBST(
+      [ax_libfuse_spec_requires],
+      [fuse-libs])
+    AC_SUBST(
+      [ax_libfuse_spec_build_requires],
+      [fuse-devel])
+    AC_SUBST(
+      [ax_libfuse_static_spec_requires],
+      [fuse-static])
+    AC_SUBST(
+      [ax_libfuse_static_spec_build_requires],
+      [fuse-static])
+    ])
+  ])
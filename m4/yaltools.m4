@@ -75,7 +75,7 @@ dnl Function to detect if vsmbrtools dependencies are available
 AC_DEFUN([AX_VSMBRTOOLS_CHECK_LOCAL],
   [AC_CHECK_HEADERS([signal.h sys/signal.h unistd.h])
 
-  AC_CHECK_FUNCS([close getopt setvbuf])
+  AC_CHECK_FUNCS([close getegid geteuid getopt setvbuf])
 
   AS_IF(
    [test "x$ac_cv_func_close" != xyes],
@@ -28,6 +28,7 @@
 #endif
 
 #include "pyvsmbr.h"
+#include "pyvsmbr_chunks.h"
 #include "pyvsmbr_error.h"
 #include "pyvsmbr_file_object_io_handle.h"
 #include "pyvsmbr_libbfio.h"
@@ -86,6 +87,13 @@ PyMethodDef pyvsmbr_module_methods[] = {
 	  "\n"
 	  "Opens a volume using a file-like object." },
 
+	{ "open_buffer",
+	  (PyCFunction) pyvsmbr_open_new_volume_with_buffer,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "open_buffer(buffer, mode='r') -> Object\n"
+	  "\n"
+	  "Opens a volume using an object that supports the buffer protocol, such as bytes, bytearray or mmap." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -531,6 +539,57 @@ on_error:
 	return( NULL );
 }
 
+/* Creates a new volume object and opens it using an object that supports the buffer protocol
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyvsmbr_open_new_volume_with_buffer(
+           PyObject *self PYVSMBR_ATTRIBUTE_UNUSED,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	pyvsmbr_volume_t *pyvsmbr_volume = NULL;
+	static char *function            = "pyvsmbr_open_new_volume_with_buffer";
+
+	PYVSMBR_UNREFERENCED_PARAMETER( self )
+
+	/* PyObject_New does not invoke tp_init
+	 */
+	pyvsmbr_volume = PyObject_New(
+	                  struct pyvsmbr_volume,
+	                  &pyvsmbr_volume_type_object );
+
+	if( pyvsmbr_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( pyvsmbr_volume_init(
+	     pyvsmbr_volume ) != 0 )
+	{
+		goto on_error;
+	}
+	if( pyvsmbr_volume_open_buffer(
+	     pyvsmbr_volume,
+	     arguments,
+	     keywords ) == NULL )
+	{
+		goto on_error;
+	}
+	return( (PyObject *) pyvsmbr_volume );
+
+on_error:
+	if( pyvsmbr_volume != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyvsmbr_volume );
+	}
+	return( NULL );
+}
+
 #if PY_MAJOR_VERSION >= 3
 
 /* The pyvsmbr module definition
@@ -602,9 +661,34 @@ PyMODINIT_FUNC initpyvsmbr(
 	}
 #if PY_VERSION_HEX < 0x03070000
 	PyEval_InitThreads();
+#endif
+#if defined( Py_GIL_DISABLED )
+	/* The module state is limited to the static type objects, the objects
+	 * protect their own state and libvsmbr is built with multi-thread support
+	 */
+	PyUnstable_Module_SetGIL(
+	 module,
+	 Py_MOD_GIL_NOT_USED );
 #endif
 	gil_state = PyGILState_Ensure();
 
+	/* Setup the chunks type object
+	 */
+	pyvsmbr_chunks_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pyvsmbr_chunks_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyvsmbr_chunks_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "chunks",
+	 (PyObject *) &pyvsmbr_chunks_type_object );
+
 	/* Setup the partition type object
 	 */
 	pyvsmbr_partition_type_object.tp_new = PyType_GenericNew;
@@ -55,6 +55,11 @@ PyObject *pyvsmbr_open_new_volume_with_file_object(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyvsmbr_open_new_volume_with_buffer(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords );
+
 #if PY_MAJOR_VERSION >= 3
 PyMODINIT_FUNC PyInit_pyvsmbr(
                 void );
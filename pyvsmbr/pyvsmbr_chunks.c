@@ -0,0 +1,672 @@
+/*
+ * Python object definition of the iterator object of partition chunks
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyvsmbr_chunks.h"
+#include "pyvsmbr_error.h"
+#include "pyvsmbr_libcerror.h"
+#include "pyvsmbr_libvsmbr.h"
+#include "pyvsmbr_python.h"
+
+#if PY_MAJOR_VERSION >= 3
+
+PyBufferProcs pyvsmbr_chunks_buffer_procs = {
+	/* bf_getbuffer */
+	(getbufferproc) pyvsmbr_chunks_getbuffer,
+	/* bf_releasebuffer */
+	(releasebufferproc) pyvsmbr_chunks_releasebuffer
+};
+
+#endif /* PY_MAJOR_VERSION >= 3 */
+
+PyTypeObject pyvsmbr_chunks_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyvsmbr.chunks",
+	/* tp_basicsize */
+	sizeof( pyvsmbr_chunks_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyvsmbr_chunks_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+#if PY_MAJOR_VERSION >= 3
+	&pyvsmbr_chunks_buffer_procs,
+#else
+	0,
+#endif
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_ITER,
+	/* tp_doc */
+	"pyvsmbr iterator object of partition chunks",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	(getiterfunc) pyvsmbr_chunks_iter,
+	/* tp_iternext */
+	(iternextfunc) pyvsmbr_chunks_iternext,
+	/* tp_methods */
+	0,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	0,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyvsmbr_chunks_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Creates a new chunks iterator object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyvsmbr_chunks_new(
+           libvsmbr_partition_t *partition,
+           PyObject *parent_object,
+           size_t chunk_size,
+           off64_t start_offset,
+           size64_t size )
+{
+	libcerror_error_t *error        = NULL;
+	pyvsmbr_chunks_t *chunks_object = NULL;
+	static char *function           = "pyvsmbr_chunks_new";
+	int result                      = 0;
+
+	if( partition == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid partition.",
+		 function );
+
+		return( NULL );
+	}
+	if( parent_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid parent object.",
+		 function );
+
+		return( NULL );
+	}
+	/* Make sure the chunks values are initialized
+	 */
+	chunks_object = PyObject_New(
+	                 struct pyvsmbr_chunks,
+	                 &pyvsmbr_chunks_type_object );
+
+	if( chunks_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create chunks object.",
+		 function );
+
+		goto on_error;
+	}
+	chunks_object->chunk_reader  = NULL;
+	chunks_object->parent_object = parent_object;
+	chunks_object->chunk_data    = NULL;
+	chunks_object->is_busy       = 0;
+
+	Py_IncRef(
+	 (PyObject *) chunks_object->parent_object );
+
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libvsmbr_chunk_reader_initialize(
+	          &( chunks_object->chunk_reader ),
+	          partition,
+	          chunk_size,
+	          PYVSMBR_CHUNKS_NUMBER_OF_BUFFERS,
+	          start_offset,
+	          size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyvsmbr_error_raise(
+		 error,
+		 PyExc_ValueError,
+		 "%s: unable to initialize chunk reader.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	return( (PyObject *) chunks_object );
+
+on_error:
+	if( chunks_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) chunks_object );
+	}
+	return( NULL );
+}
+
+/* Initializes a chunks iterator object
+ * Returns 0 if successful or -1 on error
+ */
+int pyvsmbr_chunks_init(
+     pyvsmbr_chunks_t *chunks_object )
+{
+	static char *function = "pyvsmbr_chunks_init";
+
+	if( chunks_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid chunks object.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the chunks values are initialized
+	 */
+	chunks_object->chunk_reader  = NULL;
+	chunks_object->parent_object = NULL;
+	chunks_object->chunk_data    = NULL;
+	chunks_object->is_busy       = 0;
+
+	PyErr_Format(
+	 PyExc_NotImplementedError,
+	 "%s: initialize of chunks not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Frees a chunks iterator object
+ */
+void pyvsmbr_chunks_free(
+      pyvsmbr_chunks_t *chunks_object )
+{
+	struct _typeobject *ob_type = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyvsmbr_chunks_free";
+	int result                  = 0;
+
+	if( chunks_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid chunks object.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           chunks_object );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	/* The memory views over the chunk data hold a reference to the chunks
+	 * object hence the data of the current chunk is no longer exported
+	 */
+	if( chunks_object->chunk_data != NULL )
+	{
+		PyMem_Free(
+		 chunks_object->chunk_data );
+
+		chunks_object->chunk_data = NULL;
+	}
+	if( chunks_object->chunk_reader != NULL )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libvsmbr_chunk_reader_free(
+		          &( chunks_object->chunk_reader ),
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyvsmbr_error_raise(
+			 error,
+			 PyExc_MemoryError,
+			 "%s: unable to free chunk reader.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	if( chunks_object->parent_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) chunks_object->parent_object );
+	}
+	ob_type->tp_free(
+	 (PyObject*) chunks_object );
+}
+
+/* The chunks iter() function
+ */
+PyObject *pyvsmbr_chunks_iter(
+           pyvsmbr_chunks_t *chunks_object )
+{
+	static char *function = "pyvsmbr_chunks_iter";
+
+	if( chunks_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid chunks object.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) chunks_object );
+
+	return( (PyObject *) chunks_object );
+}
+
+/* Releases the data of the current chunk before the next chunk is retrieved
+ * Data that is still exported is detached from the chunk reader and freed
+ * when its last buffer is released
+ * Returns 1 if successful or -1 on error
+ */
+int pyvsmbr_chunks_release_chunk_data(
+     pyvsmbr_chunks_t *chunks_object )
+{
+	pyvsmbr_chunk_data_t *chunk_data = NULL;
+	libcerror_error_t *error         = NULL;
+	uint8_t *data                    = NULL;
+	static char *function            = "pyvsmbr_chunks_release_chunk_data";
+	int result                       = 0;
+
+	if( chunks_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid chunks object.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_data = chunks_object->chunk_data;
+
+	if( chunk_data == NULL )
+	{
+		return( 1 );
+	}
+	if( chunk_data->number_of_exports == 0 )
+	{
+		chunks_object->chunk_data = NULL;
+
+		PyMem_Free(
+		 chunk_data );
+
+		return( 1 );
+	}
+	result = libvsmbr_chunk_reader_detach_chunk_data(
+	          chunks_object->chunk_reader,
+	          &data,
+	          &error );
+
+	if( result != 1 )
+	{
+		pyvsmbr_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to detach chunk data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	chunks_object->chunk_data = NULL;
+
+	chunk_data->data        = data;
+	chunk_data->is_detached = 1;
+
+	return( 1 );
+}
+
+/* The chunks iternext() function
+ * The data of the returned memory view remains valid after the next chunk is retrieved
+ */
+PyObject *pyvsmbr_chunks_iternext(
+           pyvsmbr_chunks_t *chunks_object )
+{
+	pyvsmbr_chunk_data_t *chunk_data = NULL;
+	libcerror_error_t *error         = NULL;
+	PyObject *chunk_object           = NULL;
+	const uint8_t *data              = NULL;
+	static char *function            = "pyvsmbr_chunks_iternext";
+	size_t data_size                 = 0;
+	uint8_t is_busy                  = 0;
+	int result                       = 0;
+
+	if( chunks_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid chunks object.",
+		 function );
+
+		return( NULL );
+	}
+	if( chunks_object->chunk_reader == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid chunks object - missing chunk reader.",
+		 function );
+
+		return( NULL );
+	}
+	/* The chunk reader is released while retrieving the next chunk
+	 * hence concurrent iterations over the same chunks object are refused
+	 */
+	Py_BEGIN_CRITICAL_SECTION( chunks_object )
+
+	is_busy = chunks_object->is_busy;
+
+	if( is_busy == 0 )
+	{
+		result = pyvsmbr_chunks_release_chunk_data(
+		          chunks_object );
+
+		if( result == 1 )
+		{
+			chunks_object->is_busy = 1;
+		}
+	}
+	Py_END_CRITICAL_SECTION()
+
+	if( is_busy != 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: chunks iterator already executing.",
+		 function );
+
+		return( NULL );
+	}
+	if( result != 1 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libvsmbr_chunk_reader_get_next_chunk(
+	          chunks_object->chunk_reader,
+	          &data,
+	          &data_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == 1 )
+	{
+		chunk_data = (pyvsmbr_chunk_data_t *) PyMem_Malloc(
+		                                       sizeof( pyvsmbr_chunk_data_t ) );
+
+		if( chunk_data == NULL )
+		{
+			chunks_object->is_busy = 0;
+
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create chunk data.",
+			 function );
+
+			return( NULL );
+		}
+		chunk_data->data              = (uint8_t *) data;
+		chunk_data->data_size         = data_size;
+		chunk_data->number_of_exports = 0;
+		chunk_data->is_detached       = 0;
+
+		chunks_object->chunk_data = chunk_data;
+
+#if PY_MAJOR_VERSION >= 3
+		chunk_object = PyMemoryView_FromObject(
+		                (PyObject *) chunks_object );
+#else
+		chunk_object = PyString_FromStringAndSize(
+		                (char *) data,
+		                (Py_ssize_t) data_size );
+#endif
+	}
+	chunks_object->is_busy = 0;
+
+	if( result == -1 )
+	{
+		pyvsmbr_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve next chunk.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	else if( result == 0 )
+	{
+		PyErr_SetNone(
+		 PyExc_StopIteration );
+
+		return( NULL );
+	}
+	return( chunk_object );
+}
+
+#if PY_MAJOR_VERSION >= 3
+
+/* The chunks getbuffer() function
+ * Exposes the data of the current chunk as a read-only buffer
+ * Returns 0 if successful or -1 on error
+ */
+int pyvsmbr_chunks_getbuffer(
+     pyvsmbr_chunks_t *chunks_object,
+     Py_buffer *buffer,
+     int flags )
+{
+	pyvsmbr_chunk_data_t *chunk_data = NULL;
+	static char *function            = "pyvsmbr_chunks_getbuffer";
+	int result                       = 0;
+
+	if( chunks_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid chunks object.",
+		 function );
+
+		return( -1 );
+	}
+	Py_BEGIN_CRITICAL_SECTION( chunks_object )
+
+	chunk_data = chunks_object->chunk_data;
+
+	if( chunk_data != NULL )
+	{
+		result = PyBuffer_FillInfo(
+		          buffer,
+		          (PyObject *) chunks_object,
+		          (void *) chunk_data->data,
+		          (Py_ssize_t) chunk_data->data_size,
+		          1,
+		          flags );
+
+		if( result == 0 )
+		{
+			buffer->internal = (void *) chunk_data;
+
+			chunk_data->number_of_exports += 1;
+		}
+	}
+	Py_END_CRITICAL_SECTION()
+
+	if( chunk_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_BufferError,
+		 "%s: invalid chunks object - missing current chunk.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* The chunks releasebuffer() function
+ * Frees data that was detached from the chunk reader when its last buffer is released
+ */
+void pyvsmbr_chunks_releasebuffer(
+      pyvsmbr_chunks_t *chunks_object,
+      Py_buffer *buffer )
+{
+	pyvsmbr_chunk_data_t *chunk_data = NULL;
+	uint8_t is_released              = 0;
+
+	if( ( chunks_object == NULL )
+	 || ( buffer == NULL ) )
+	{
+		return;
+	}
+	chunk_data = (pyvsmbr_chunk_data_t *) buffer->internal;
+
+	if( chunk_data == NULL )
+	{
+		return;
+	}
+	Py_BEGIN_CRITICAL_SECTION( chunks_object )
+
+	chunk_data->number_of_exports -= 1;
+
+	if( ( chunk_data->number_of_exports == 0 )
+	 && ( chunk_data->is_detached != 0 ) )
+	{
+		is_released = 1;
+	}
+	Py_END_CRITICAL_SECTION()
+
+	if( is_released != 0 )
+	{
+		libvsmbr_chunk_reader_free_chunk_data(
+		 &( chunk_data->data ),
+		 NULL );
+
+		PyMem_Free(
+		 chunk_data );
+	}
+}
+
+#endif /* PY_MAJOR_VERSION >= 3 */
+
@@ -0,0 +1,127 @@
+/*
+ * Python object definition of the iterator object of partition chunks
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYVSMBR_CHUNKS_H )
+#define _PYVSMBR_CHUNKS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyvsmbr_libvsmbr.h"
+#include "pyvsmbr_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of chunk buffers, one is handed out while the others are read ahead
+ */
+#define PYVSMBR_CHUNKS_NUMBER_OF_BUFFERS	4
+
+typedef struct pyvsmbr_chunk_data pyvsmbr_chunk_data_t;
+
+struct pyvsmbr_chunk_data
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The number of buffers exported of the data
+	 */
+	int number_of_exports;
+
+	/* Value to indicate the data was detached from the chunk reader
+	 */
+	uint8_t is_detached;
+};
+
+typedef struct pyvsmbr_chunks pyvsmbr_chunks_t;
+
+struct pyvsmbr_chunks
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The libvsmbr chunk reader
+	 */
+	libvsmbr_chunk_reader_t *chunk_reader;
+
+	/* The parent object
+	 */
+	PyObject *parent_object;
+
+	/* The data of the current chunk
+	 */
+	pyvsmbr_chunk_data_t *chunk_data;
+
+	/* Value to indicate the next chunk is being retrieved
+	 */
+	uint8_t is_busy;
+};
+
+extern PyTypeObject pyvsmbr_chunks_type_object;
+
+PyObject *pyvsmbr_chunks_new(
+           libvsmbr_partition_t *partition,
+           PyObject *parent_object,
+           size_t chunk_size,
+           off64_t start_offset,
+           size64_t size );
+
+int pyvsmbr_chunks_init(
+     pyvsmbr_chunks_t *chunks_object );
+
+void pyvsmbr_chunks_free(
+      pyvsmbr_chunks_t *chunks_object );
+
+PyObject *pyvsmbr_chunks_iter(
+           pyvsmbr_chunks_t *chunks_object );
+
+int pyvsmbr_chunks_release_chunk_data(
+     pyvsmbr_chunks_t *chunks_object );
+
+PyObject *pyvsmbr_chunks_iternext(
+           pyvsmbr_chunks_t *chunks_object );
+
+#if PY_MAJOR_VERSION >= 3
+
+int pyvsmbr_chunks_getbuffer(
+     pyvsmbr_chunks_t *chunks_object,
+     Py_buffer *buffer,
+     int flags );
+
+void pyvsmbr_chunks_releasebuffer(
+      pyvsmbr_chunks_t *chunks_object,
+      Py_buffer *buffer );
+
+#endif /* PY_MAJOR_VERSION >= 3 */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYVSMBR_CHUNKS_H ) */
+
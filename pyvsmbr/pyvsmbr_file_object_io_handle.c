@@ -23,6 +23,18 @@
 #include <memory.h>
 #include <types.h>
 
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
 #include "pyvsmbr_error.h"
 #include "pyvsmbr_file_object_io_handle.h"
 #include "pyvsmbr_integer.h"
@@ -102,7 +114,8 @@ int pyvsmbr_file_object_io_handle_initialize(
 
 		goto on_error;
 	}
-	( *file_object_io_handle )->file_object = file_object;
+	( *file_object_io_handle )->file_object     = file_object;
+	( *file_object_io_handle )->file_descriptor = -1;
 
 	Py_IncRef(
 	 ( *file_object_io_handle )->file_object );
@@ -229,6 +242,18 @@ int pyvsmbr_file_object_io_handle_free(
 	{
 		gil_state = PyGILState_Ensure();
 
+		if( ( *file_object_io_handle )->has_buffer_view != 0 )
+		{
+			PyBuffer_Release(
+			 &( ( *file_object_io_handle )->buffer_view ) );
+		}
+#if defined( HAVE_PYVSMBR_FILE_OBJECT_FILE_DESCRIPTOR )
+		if( ( *file_object_io_handle )->file_descriptor != -1 )
+		{
+			close(
+			 ( *file_object_io_handle )->file_descriptor );
+		}
+#endif
 		Py_DecRef(
 		 ( *file_object_io_handle )->file_object );
 
@@ -309,7 +334,187 @@ int pyvsmbr_file_object_io_handle_clone(
 	return( 1 );
 }
 
+#if defined( HAVE_PYVSMBR_FILE_OBJECT_FILE_DESCRIPTOR )
+
+/* Retrieves the file descriptor of a file object backed by a regular file
+ * Only the exact io.FileIO, io.BufferedReader and io.BufferedRandom types
+ * are supported, since other file objects, such as gzip.GzipFile, can return
+ * the file descriptor of data they transform
+ * Make sure to hold the GIL state before calling this function
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int pyvsmbr_file_object_get_file_descriptor(
+     PyObject *file_object,
+     int *file_descriptor,
+     libcerror_error_t **error )
+{
+	struct stat file_statistics;
+
+	PyObject *buffered_random_type = NULL;
+	PyObject *buffered_reader_type = NULL;
+	PyObject *file_io_type         = NULL;
+	PyObject *io_module            = NULL;
+	PyObject *method_result        = NULL;
+	PyObject *raw_object           = NULL;
+	static char *function          = "pyvsmbr_file_object_get_file_descriptor";
+	long safe_file_descriptor      = 0;
+	int result                     = 0;
+
+	if( file_object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file object.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	io_module = PyImport_ImportModule(
+	             "io" );
+
+	if( io_module == NULL )
+	{
+		goto on_not_available;
+	}
+	file_io_type = PyObject_GetAttrString(
+	                io_module,
+	                "FileIO" );
+
+	buffered_reader_type = PyObject_GetAttrString(
+	                        io_module,
+	                        "BufferedReader" );
+
+	buffered_random_type = PyObject_GetAttrString(
+	                        io_module,
+	                        "BufferedRandom" );
+
+	if( ( file_io_type == NULL )
+	 || ( buffered_reader_type == NULL )
+	 || ( buffered_random_type == NULL ) )
+	{
+		goto on_not_available;
+	}
+	raw_object = file_object;
+
+	Py_IncRef(
+	 raw_object );
+
+	if( ( (PyObject *) Py_TYPE( raw_object ) == buffered_reader_type )
+	 || ( (PyObject *) Py_TYPE( raw_object ) == buffered_random_type ) )
+	{
+		Py_DecRef(
+		 raw_object );
+
+		raw_object = PyObject_GetAttrString(
+		              file_object,
+		              "raw" );
+
+		if( raw_object == NULL )
+		{
+			goto on_not_available;
+		}
+	}
+	if( (PyObject *) Py_TYPE( raw_object ) != file_io_type )
+	{
+		goto on_not_available;
+	}
+	method_result = PyObject_CallMethod(
+	                 raw_object,
+	                 "fileno",
+	                 NULL );
+
+	if( method_result == NULL )
+	{
+		goto on_not_available;
+	}
+	safe_file_descriptor = PyLong_AsLong(
+	                        method_result );
+
+	if( ( safe_file_descriptor < 0 )
+	 || ( safe_file_descriptor > (long) INT_MAX ) )
+	{
+		goto on_not_available;
+	}
+	/* Sizes of block devices are not reported by fstat
+	 */
+	if( fstat(
+	     (int) safe_file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		goto on_not_available;
+	}
+	if( S_ISREG( file_statistics.st_mode ) == 0 )
+	{
+		goto on_not_available;
+	}
+	/* Use a duplicate so that the file descriptor remains valid
+	 * if Python closes the file object
+	 */
+	*file_descriptor = dup(
+	                    (int) safe_file_descriptor );
+
+	if( *file_descriptor == -1 )
+	{
+		goto on_not_available;
+	}
+	result = 1;
+
+on_not_available:
+	if( result == 0 )
+	{
+		PyErr_Clear();
+	}
+	if( method_result != NULL )
+	{
+		Py_DecRef(
+		 method_result );
+	}
+	if( raw_object != NULL )
+	{
+		Py_DecRef(
+		 raw_object );
+	}
+	if( buffered_random_type != NULL )
+	{
+		Py_DecRef(
+		 buffered_random_type );
+	}
+	if( buffered_reader_type != NULL )
+	{
+		Py_DecRef(
+		 buffered_reader_type );
+	}
+	if( file_io_type != NULL )
+	{
+		Py_DecRef(
+		 file_io_type );
+	}
+	if( io_module != NULL )
+	{
+		Py_DecRef(
+		 io_module );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_PYVSMBR_FILE_OBJECT_FILE_DESCRIPTOR ) */
+
 /* Opens the file object IO handle
+ * File objects that support the buffer protocol, such as mmap.mmap, or that
+ * are backed by a regular file are read without calling the file object methods
  * Returns 1 if successful or -1 on error
  */
 int pyvsmbr_file_object_io_handle_open(
@@ -317,7 +522,9 @@ int pyvsmbr_file_object_io_handle_open(
      int access_flags,
      libcerror_error_t **error )
 {
-	static char *function = "pyvsmbr_file_object_io_handle_open";
+	static char *function      = "pyvsmbr_file_object_io_handle_open";
+	PyGILState_STATE gil_state = 0;
+	int result                 = 0;
 
 	if( file_object_io_handle == NULL )
 	{
@@ -364,9 +571,60 @@ int pyvsmbr_file_object_io_handle_open(
 
 		return( -1 );
 	}
-	/* No need to do anything here, because the file object is already open
+	/* No need to open the file object here, because it is already open
 	 */
-	file_object_io_handle->access_flags = access_flags;
+	if( ( file_object_io_handle->has_buffer_view == 0 )
+	 && ( file_object_io_handle->file_descriptor == -1 ) )
+	{
+		gil_state = PyGILState_Ensure();
+
+		if( PyObject_CheckBuffer(
+		     file_object_io_handle->file_object ) != 0 )
+		{
+			/* The buffer view prevents the buffer from being resized
+			 * or, for mmap.mmap, closed while it is held
+			 */
+			if( PyObject_GetBuffer(
+			     file_object_io_handle->file_object,
+			     &( file_object_io_handle->buffer_view ),
+			     PyBUF_SIMPLE ) == 0 )
+			{
+				file_object_io_handle->has_buffer_view = 1;
+			}
+			else
+			{
+				PyErr_Clear();
+			}
+		}
+#if defined( HAVE_PYVSMBR_FILE_OBJECT_FILE_DESCRIPTOR )
+		if( file_object_io_handle->has_buffer_view == 0 )
+		{
+			result = pyvsmbr_file_object_get_file_descriptor(
+			          file_object_io_handle->file_object,
+			          &( file_object_io_handle->file_descriptor ),
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve file descriptor of file object.",
+				 function );
+
+				PyGILState_Release(
+				 gil_state );
+
+				return( -1 );
+			}
+		}
+#endif
+		PyGILState_Release(
+		 gil_state );
+	}
+	file_object_io_handle->access_flags   = access_flags;
+	file_object_io_handle->current_offset = 0;
 
 	return( 1 );
 }
@@ -378,7 +636,8 @@ int pyvsmbr_file_object_io_handle_close(
      pyvsmbr_file_object_io_handle_t *file_object_io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "pyvsmbr_file_object_io_handle_close";
+	static char *function      = "pyvsmbr_file_object_io_handle_close";
+	PyGILState_STATE gil_state = 0;
 
 	if( file_object_io_handle == NULL )
 	{
@@ -404,6 +663,39 @@ int pyvsmbr_file_object_io_handle_close(
 	}
 	/* Do not close the file object, have Python deal with it
 	 */
+	if( file_object_io_handle->has_buffer_view != 0 )
+	{
+		gil_state = PyGILState_Ensure();
+
+		PyBuffer_Release(
+		 &( file_object_io_handle->buffer_view ) );
+
+		PyGILState_Release(
+		 gil_state );
+
+		file_object_io_handle->has_buffer_view = 0;
+	}
+#if defined( HAVE_PYVSMBR_FILE_OBJECT_FILE_DESCRIPTOR )
+	if( file_object_io_handle->file_descriptor != -1 )
+	{
+		if( close(
+		     file_object_io_handle->file_descriptor ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to close file descriptor.",
+			 function );
+
+			file_object_io_handle->file_descriptor = -1;
+
+			return( -1 );
+		}
+		file_object_io_handle->file_descriptor = -1;
+	}
+#endif
 	file_object_io_handle->access_flags = 0;
 
 	return( 0 );
@@ -637,6 +929,79 @@ ssize_t pyvsmbr_file_object_io_handle_read(
 
 		return( -1 );
 	}
+	if( file_object_io_handle->has_buffer_view != 0 )
+	{
+		/* The buffer view is held, so the buffer can be read without the GIL
+		 */
+		if( file_object_io_handle->current_offset >= (off64_t) file_object_io_handle->buffer_view.len )
+		{
+			return( 0 );
+		}
+		if( size > (size_t) ( file_object_io_handle->buffer_view.len - file_object_io_handle->current_offset ) )
+		{
+			size = (size_t) ( file_object_io_handle->buffer_view.len - file_object_io_handle->current_offset );
+		}
+		if( memory_copy(
+		     buffer,
+		     &( ( (uint8_t *) file_object_io_handle->buffer_view.buf )[ file_object_io_handle->current_offset ] ),
+		     size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data from buffer view.",
+			 function );
+
+			return( -1 );
+		}
+		file_object_io_handle->current_offset += (off64_t) size;
+
+		return( (ssize_t) size );
+	}
+#if defined( HAVE_PYVSMBR_FILE_OBJECT_FILE_DESCRIPTOR )
+	if( file_object_io_handle->file_descriptor != -1 )
+	{
+		if( size > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		do
+		{
+			read_count = pread(
+			              file_object_io_handle->file_descriptor,
+			              buffer,
+			              size,
+			              (off_t) file_object_io_handle->current_offset );
+		}
+		while( ( read_count == -1 )
+		    && ( errno == EINTR ) );
+
+		if( read_count == -1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to read from file descriptor.",
+			 function );
+
+			return( -1 );
+		}
+		file_object_io_handle->current_offset += (off64_t) read_count;
+
+		return( read_count );
+	}
+#endif /* defined( HAVE_PYVSMBR_FILE_OBJECT_FILE_DESCRIPTOR ) */
+
 	gil_state = PyGILState_Ensure();
 
 	read_count = pyvsmbr_file_object_read_buffer(
@@ -1140,6 +1505,7 @@ off64_t pyvsmbr_file_object_io_handle_seek_offset(
 {
 	static char *function      = "pyvsmbr_file_object_io_handle_seek_offset";
 	PyGILState_STATE gil_state = 0;
+	size64_t size              = 0;
 
 	if( file_object_io_handle == NULL )
 	{
@@ -1152,6 +1518,57 @@ off64_t pyvsmbr_file_object_io_handle_seek_offset(
 
 		return( -1 );
 	}
+	if( ( file_object_io_handle->has_buffer_view != 0 )
+	 || ( file_object_io_handle->file_descriptor != -1 ) )
+	{
+		if( whence == SEEK_CUR )
+		{
+			offset += file_object_io_handle->current_offset;
+		}
+		else if( whence == SEEK_END )
+		{
+			if( pyvsmbr_file_object_io_handle_get_size(
+			     file_object_io_handle,
+			     &size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve size.",
+				 function );
+
+				return( -1 );
+			}
+			offset += (off64_t) size;
+		}
+		else if( whence != SEEK_SET )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported whence.",
+			 function );
+
+			return( -1 );
+		}
+		if( offset < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: invalid offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		file_object_io_handle->current_offset = offset;
+
+		return( offset );
+	}
 	gil_state = PyGILState_Ensure();
 
 	if( pyvsmbr_file_object_seek_offset(
@@ -1373,6 +1790,10 @@ int pyvsmbr_file_object_io_handle_get_size(
      size64_t *size,
      libcerror_error_t **error )
 {
+#if defined( HAVE_PYVSMBR_FILE_OBJECT_FILE_DESCRIPTOR )
+	struct stat file_statistics;
+#endif
+
 	PyObject *method_name      = NULL;
 	static char *function      = "pyvsmbr_file_object_io_handle_get_size";
 	PyGILState_STATE gil_state = 0;
@@ -1401,6 +1822,57 @@ int pyvsmbr_file_object_io_handle_get_size(
 
 		return( -1 );
 	}
+	if( file_object_io_handle->has_buffer_view != 0 )
+	{
+		if( size == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid size.",
+			 function );
+
+			return( -1 );
+		}
+		*size = (size64_t) file_object_io_handle->buffer_view.len;
+
+		return( 1 );
+	}
+#if defined( HAVE_PYVSMBR_FILE_OBJECT_FILE_DESCRIPTOR )
+	if( file_object_io_handle->file_descriptor != -1 )
+	{
+		if( size == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid size.",
+			 function );
+
+			return( -1 );
+		}
+		if( fstat(
+		     file_object_io_handle->file_descriptor,
+		     &file_statistics ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 errno,
+			 "%s: unable to retrieve file descriptor statistics.",
+			 function );
+
+			return( -1 );
+		}
+		*size = (size64_t) file_statistics.st_size;
+
+		return( 1 );
+	}
+#endif /* defined( HAVE_PYVSMBR_FILE_OBJECT_FILE_DESCRIPTOR ) */
+
 	gil_state = PyGILState_Ensure();
 
 #if PY_MAJOR_VERSION >= 3
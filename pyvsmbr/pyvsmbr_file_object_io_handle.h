@@ -33,6 +33,13 @@
 extern "C" {
 #endif
 
+/* File objects backed by a regular file are read using pread on a duplicate
+ * of their file descriptor, without holding the GIL
+ */
+#if PY_MAJOR_VERSION >= 3 && defined( HAVE_PREAD ) && defined( HAVE_UNISTD_H ) && defined( HAVE_SYS_STAT_H ) && !defined( WINAPI )
+#define HAVE_PYVSMBR_FILE_OBJECT_FILE_DESCRIPTOR	1
+#endif
+
 typedef struct pyvsmbr_file_object_io_handle pyvsmbr_file_object_io_handle_t;
 
 struct pyvsmbr_file_object_io_handle
@@ -44,6 +51,24 @@ struct pyvsmbr_file_object_io_handle
 	/* The access flags
 	 */
 	int access_flags;
+
+	/* The duplicate file descriptor of a file object backed by a regular file
+	 * or -1 if not available
+	 */
+	int file_descriptor;
+
+	/* The buffer view of a file object that supports the buffer protocol
+	 */
+	Py_buffer buffer_view;
+
+	/* Value to indicate the buffer view is set
+	 */
+	uint8_t has_buffer_view;
+
+	/* The current offset, used when the file object methods are bypassed
+	 * the libbfio handle serializes the IO callbacks that change it
+	 */
+	off64_t current_offset;
 };
 
 int pyvsmbr_file_object_io_handle_initialize(
@@ -65,6 +90,11 @@ int pyvsmbr_file_object_io_handle_clone(
      pyvsmbr_file_object_io_handle_t *source_file_object_io_handle,
      libcerror_error_t **error );
 
+int pyvsmbr_file_object_get_file_descriptor(
+     PyObject *file_object,
+     int *file_descriptor,
+     libcerror_error_t **error );
+
 int pyvsmbr_file_object_io_handle_open(
      pyvsmbr_file_object_io_handle_t *file_object_io_handle,
      int access_flags,
@@ -26,6 +26,7 @@
 #include <stdlib.h>
 #endif
 
+#include "pyvsmbr_chunks.h"
 #include "pyvsmbr_error.h"
 #include "pyvsmbr_integer.h"
 #include "pyvsmbr_libcerror.h"
@@ -64,6 +65,20 @@ PyMethodDef pyvsmbr_partition_object_methods[] = {
 	  "\n"
 	  "Reads a buffer of data at a specific offset." },
 
+	{ "read_buffer_into",
+	  (PyCFunction) pyvsmbr_partition_read_buffer_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffer_into(buffer)-> Integer\n"
+	  "\n"
+	  "Reads data into a writable buffer and returns the number of bytes read." },
+
+	{ "read_buffer_at_offset_into",
+	  (PyCFunction) pyvsmbr_partition_read_buffer_at_offset_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffer_at_offset_into(buffer, offset)-> Integer\n"
+	  "\n"
+	  "Reads data at a specific offset into a writable buffer and returns the number of bytes read." },
+
 	{ "seek_offset",
 	  (PyCFunction) pyvsmbr_partition_seek_offset,
 	  METH_VARARGS | METH_KEYWORDS,
@@ -85,6 +100,13 @@ PyMethodDef pyvsmbr_partition_object_methods[] = {
 	  "\n"
 	  "Reads a buffer of data." },
 
+	{ "readinto",
+	  (PyCFunction) pyvsmbr_partition_read_buffer_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "readinto(buffer)-> Integer\n"
+	  "\n"
+	  "Reads data into a writable buffer and returns the number of bytes read." },
+
 	{ "seek",
 	  (PyCFunction) pyvsmbr_partition_seek_offset,
 	  METH_VARARGS | METH_KEYWORDS,
@@ -106,6 +128,23 @@ PyMethodDef pyvsmbr_partition_object_methods[] = {
 	  "\n"
 	  "Retrieves the size." },
 
+	{ "get_entropy_map",
+	  (PyCFunction) pyvsmbr_partition_get_entropy_map,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_entropy_map(block_size, number_of_threads=1) -> Bytes\n"
+	  "\n"
+	  "Calculates the Shannon entropy per block of the partition data.\n"
+	  "The entropies are returned as an array of 32-bit floating-point values in native byte order." },
+
+	{ "iter_chunks",
+	  (PyCFunction) pyvsmbr_partition_iter_chunks,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "iter_chunks(size, start=0, end=None) -> Iterator\n"
+	  "\n"
+	  "Iterates over the data from start to end in chunks of size.\n"
+	  "The chunks are read ahead into a small ring of buffers and returned as read-only memory views,\n"
+	  "the data of a memory view that is still referenced when the next chunk is retrieved is detached from the ring." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -926,6 +965,172 @@ PyObject *pyvsmbr_partition_read_buffer_at_offset(
 	return( string_object );
 }
 
+/* Reads data at the current offset into a writable buffer object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyvsmbr_partition_read_buffer_into(
+           pyvsmbr_partition_t *pyvsmbr_partition,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffer;
+
+	PyObject *integer_object    = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyvsmbr_partition_read_buffer_into";
+	static char *keyword_list[] = { "buffer", NULL };
+	ssize_t read_count          = 0;
+
+	if( pyvsmbr_partition == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid partition.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "w*",
+	     keyword_list,
+	     &buffer ) == 0 )
+	{
+		return( NULL );
+	}
+	if( buffer.len == 0 )
+	{
+		PyBuffer_Release(
+		 &buffer );
+
+		return( pyvsmbr_integer_signed_new_from_64bit(
+		         0 ) );
+	}
+	/* The buffer is written directly, without the GIL, the buffer object
+	 * cannot be resized while the buffer view is held
+	 */
+	Py_BEGIN_ALLOW_THREADS
+
+	read_count = libvsmbr_partition_read_buffer(
+	              pyvsmbr_partition->partition,
+	              (uint8_t *) buffer.buf,
+	              (size_t) buffer.len,
+	              &error );
+
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(
+	 &buffer );
+
+	if( read_count == -1 )
+	{
+		pyvsmbr_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = pyvsmbr_integer_signed_new_from_64bit(
+	                  (int64_t) read_count );
+
+	return( integer_object );
+}
+
+/* Reads data at a specific offset into a writable buffer object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyvsmbr_partition_read_buffer_at_offset_into(
+           pyvsmbr_partition_t *pyvsmbr_partition,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffer;
+
+	PyObject *integer_object    = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyvsmbr_partition_read_buffer_at_offset_into";
+	static char *keyword_list[] = { "buffer", "offset", NULL };
+	ssize_t read_count          = 0;
+	off64_t read_offset         = 0;
+
+	if( pyvsmbr_partition == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid partition.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "w*L",
+	     keyword_list,
+	     &buffer,
+	     &read_offset ) == 0 )
+	{
+		return( NULL );
+	}
+	if( read_offset < 0 )
+	{
+		PyBuffer_Release(
+		 &buffer );
+
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid read offset value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	if( buffer.len == 0 )
+	{
+		PyBuffer_Release(
+		 &buffer );
+
+		return( pyvsmbr_integer_signed_new_from_64bit(
+		         0 ) );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	read_count = libvsmbr_partition_read_buffer_at_offset(
+	              pyvsmbr_partition->partition,
+	              (uint8_t *) buffer.buf,
+	              (size_t) buffer.len,
+	              read_offset,
+	              &error );
+
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(
+	 &buffer );
+
+	if( read_count == -1 )
+	{
+		pyvsmbr_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = pyvsmbr_integer_signed_new_from_64bit(
+	                  (int64_t) read_count );
+
+	return( integer_object );
+}
+
 /* Seeks a certain offset
  * Returns a Python object if successful or NULL on error
  */
@@ -1099,3 +1304,293 @@ PyObject *pyvsmbr_partition_get_size(
 	return( integer_object );
 }
 
+/* Calculates the Shannon entropy per block of the partition data
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyvsmbr_partition_get_entropy_map(
+           pyvsmbr_partition_t *pyvsmbr_partition,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *bytes_object              = NULL;
+	libcerror_error_t *error            = NULL;
+	libvsmbr_entropy_map_t *entropy_map = NULL;
+	char *buffer                        = NULL;
+	static char *function               = "pyvsmbr_partition_get_entropy_map";
+	static char *keyword_list[]         = { "block_size", "number_of_threads", NULL };
+	uint64_t number_of_blocks           = 0;
+	unsigned int block_size             = 0;
+	int number_of_threads               = 1;
+	int result                          = 0;
+
+	if( pyvsmbr_partition == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid partition.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "I|i",
+	     keyword_list,
+	     &block_size,
+	     &number_of_threads ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libvsmbr_entropy_map_initialize(
+	          &entropy_map,
+	          (uint32_t) block_size,
+	          &error );
+
+	if( result == 1 )
+	{
+		result = libvsmbr_entropy_map_build_from_partition(
+		          entropy_map,
+		          pyvsmbr_partition->partition,
+		          number_of_threads,
+		          &error );
+	}
+	if( result == 1 )
+	{
+		result = libvsmbr_entropy_map_get_number_of_blocks(
+		          entropy_map,
+		          &number_of_blocks,
+		          &error );
+	}
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyvsmbr_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to calculate entropy map.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( number_of_blocks > (uint64_t) ( PY_SSIZE_T_MAX / sizeof( float ) ) )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: invalid number of blocks value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+#if PY_MAJOR_VERSION >= 3
+	bytes_object = PyBytes_FromStringAndSize(
+	                NULL,
+	                (Py_ssize_t) ( number_of_blocks * sizeof( float ) ) );
+#else
+	bytes_object = PyString_FromStringAndSize(
+	                NULL,
+	                (Py_ssize_t) ( number_of_blocks * sizeof( float ) ) );
+#endif
+	if( bytes_object == NULL )
+	{
+		goto on_error;
+	}
+	if( number_of_blocks > 0 )
+	{
+#if PY_MAJOR_VERSION >= 3
+		buffer = PyBytes_AsString(
+		          bytes_object );
+#else
+		buffer = PyString_AsString(
+		          bytes_object );
+#endif
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libvsmbr_entropy_map_get_entropies(
+		          entropy_map,
+		          (float *) buffer,
+		          number_of_blocks,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyvsmbr_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve entropies.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+	}
+	if( libvsmbr_entropy_map_free(
+	     &entropy_map,
+	     &error ) != 1 )
+	{
+		pyvsmbr_error_raise(
+		 error,
+		 PyExc_MemoryError,
+		 "%s: unable to free entropy map.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	return( bytes_object );
+
+on_error:
+	if( bytes_object != NULL )
+	{
+		Py_DecRef(
+		 bytes_object );
+	}
+	if( entropy_map != NULL )
+	{
+		libvsmbr_entropy_map_free(
+		 &entropy_map,
+		 NULL );
+	}
+	return( NULL );
+}
+
+/* Iterates over the partition data in chunks
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyvsmbr_partition_iter_chunks(
+           pyvsmbr_partition_t *pyvsmbr_partition,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *end_object        = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyvsmbr_partition_iter_chunks";
+	static char *keyword_list[] = { "size", "start", "end", NULL };
+	int64_t chunk_size          = 0;
+	int64_t end_offset          = 0;
+	int64_t start_offset        = 0;
+	size64_t size               = 0;
+	int result                  = 0;
+
+	if( pyvsmbr_partition == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid partition.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "L|LO",
+	     keyword_list,
+	     &chunk_size,
+	     &start_offset,
+	     &end_object ) == 0 )
+	{
+		return( NULL );
+	}
+	if( ( chunk_size <= 0 )
+	 || ( (uint64_t) chunk_size > (uint64_t) SSIZE_MAX ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid argument size value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	if( start_offset < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid argument start value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	if( ( end_object == NULL )
+	 || ( end_object == Py_None ) )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libvsmbr_partition_get_size(
+		          pyvsmbr_partition->partition,
+		          &size,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyvsmbr_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve size.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+		end_offset = (int64_t) size;
+	}
+	else
+	{
+		if( pyvsmbr_integer_signed_copy_to_64bit(
+		     end_object,
+		     &end_offset,
+		     &error ) != 1 )
+		{
+			pyvsmbr_error_raise(
+			 error,
+			 PyExc_ValueError,
+			 "%s: unable to convert argument end into 64-bit signed integer.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+		if( end_offset < start_offset )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid argument end value less than start.",
+			 function );
+
+			return( NULL );
+		}
+	}
+	if( end_offset > start_offset )
+	{
+		size = (size64_t) ( end_offset - start_offset );
+	}
+	else
+	{
+		size = 0;
+	}
+	return( pyvsmbr_chunks_new(
+	         pyvsmbr_partition->partition,
+	         (PyObject *) pyvsmbr_partition,
+	         (size_t) chunk_size,
+	         (off64_t) start_offset,
+	         size ) );
+}
+
@@ -80,6 +80,16 @@ PyObject *pyvsmbr_partition_read_buffer_at_offset(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyvsmbr_partition_read_buffer_into(
+           pyvsmbr_partition_t *pyvsmbr_partition,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyvsmbr_partition_read_buffer_at_offset_into(
+           pyvsmbr_partition_t *pyvsmbr_partition,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyvsmbr_partition_seek_offset(
            pyvsmbr_partition_t *pyvsmbr_partition,
            PyObject *arguments,
@@ -93,6 +103,16 @@ PyObject *pyvsmbr_partition_get_size(
            pyvsmbr_partition_t *pyvsmbr_partition,
            PyObject *arguments );
 
+PyObject *pyvsmbr_partition_get_entropy_map(
+           pyvsmbr_partition_t *pyvsmbr_partition,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyvsmbr_partition_iter_chunks(
+           pyvsmbr_partition_t *pyvsmbr_partition,
+           PyObject *arguments,
+           PyObject *keywords );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -395,6 +395,7 @@ PyObject *pyvsmbr_partitions_iternext(
 {
 	PyObject *partition_object = NULL;
 	static char *function      = "pyvsmbr_partitions_iternext";
+	int current_index          = 0;
 
 	if( sequence_object == NULL )
 	{
@@ -432,7 +433,20 @@ PyObject *pyvsmbr_partitions_iternext(
 
 		return( NULL );
 	}
-	if( sequence_object->current_index >= sequence_object->number_of_items )
+	/* Claim the current index so that concurrent iterations over
+	 * the same sequence object do not return the same item twice
+	 */
+	Py_BEGIN_CRITICAL_SECTION( sequence_object )
+
+	current_index = sequence_object->current_index;
+
+	if( current_index < sequence_object->number_of_items )
+	{
+		sequence_object->current_index++;
+	}
+	Py_END_CRITICAL_SECTION()
+
+	if( current_index >= sequence_object->number_of_items )
 	{
 		PyErr_SetNone(
 		 PyExc_StopIteration );
@@ -441,12 +455,8 @@ PyObject *pyvsmbr_partitions_iternext(
 	}
 	partition_object = sequence_object->get_item_by_index(
 	                    sequence_object->parent_object,
-	                    sequence_object->current_index );
+	                    current_index );
 
-	if( partition_object != NULL )
-	{
-		sequence_object->current_index++;
-	}
 	return( partition_object );
 }
 
@@ -79,5 +79,17 @@
 
 #endif /* !defined( Py_TYPE ) */
 
+/* Per-object critical sections were introduced in Python 3.13 for the
+ * free-threaded build, on earlier versions the GIL protects the object
+ */
+#if !defined( Py_BEGIN_CRITICAL_SECTION )
+#define Py_BEGIN_CRITICAL_SECTION( object ) \
+	{
+
+#define Py_END_CRITICAL_SECTION() \
+	}
+
+#endif /* !defined( Py_BEGIN_CRITICAL_SECTION ) */
+
 #endif /* !defined( _PYVSMBR_PYTHON_H ) */
 
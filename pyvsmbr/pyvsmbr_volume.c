@@ -71,6 +71,14 @@ PyMethodDef pyvsmbr_volume_object_methods[] = {
 	  "\n"
 	  "Opens a volume using a file-like object." },
 
+	{ "open_buffer",
+	  (PyCFunction) pyvsmbr_volume_open_buffer,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "open_buffer(buffer, mode='r') -> None\n"
+	  "\n"
+	  "Opens a volume using an object that supports the buffer protocol, such as bytes, bytearray or mmap.\n"
+	  "The data is read directly from the memory of the object, which is referenced until the volume is closed." },
+
 	{ "close",
 	  (PyCFunction) pyvsmbr_volume_close,
 	  METH_NOARGS,
@@ -255,8 +263,9 @@ int pyvsmbr_volume_init(
 	}
 	/* Make sure libvsmbr volume is set to NULL
 	 */
-	pyvsmbr_volume->volume         = NULL;
-	pyvsmbr_volume->file_io_handle = NULL;
+	pyvsmbr_volume->volume          = NULL;
+	pyvsmbr_volume->file_io_handle  = NULL;
+	pyvsmbr_volume->has_buffer_view = 0;
 
 	if( libvsmbr_volume_initialize(
 	     &( pyvsmbr_volume->volume ),
@@ -625,12 +634,13 @@ PyObject *pyvsmbr_volume_open_file_object(
            PyObject *arguments,
            PyObject *keywords )
 {
-	PyObject *file_object       = NULL;
-	libcerror_error_t *error    = NULL;
-	static char *function       = "pyvsmbr_volume_open_file_object";
-	static char *keyword_list[] = { "file_object", "mode", NULL };
-	char *mode                  = NULL;
-	int result                  = 0;
+	PyObject *file_object            = NULL;
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	static char *function            = "pyvsmbr_volume_open_file_object";
+	static char *keyword_list[]      = { "file_object", "mode", NULL };
+	char *mode                       = NULL;
+	int result                       = 0;
 
 	if( pyvsmbr_volume == NULL )
 	{
@@ -703,7 +713,7 @@ PyObject *pyvsmbr_volume_open_file_object(
 		return( NULL );
 	}
 	if( pyvsmbr_file_object_initialize(
-	     &( pyvsmbr_volume->file_io_handle ),
+	     &file_io_handle,
 	     file_object,
 	     &error ) != 1 )
 	{
@@ -718,11 +728,36 @@ PyObject *pyvsmbr_volume_open_file_object(
 
 		goto on_error;
 	}
+	/* Claim the file IO handle of the volume, since without the GIL
+	 * another thread can open the same volume concurrently
+	 */
+	result = 0;
+
+	Py_BEGIN_CRITICAL_SECTION( pyvsmbr_volume )
+
+	if( pyvsmbr_volume->file_io_handle == NULL )
+	{
+		pyvsmbr_volume->file_io_handle = file_io_handle;
+
+		result = 1;
+	}
+	Py_END_CRITICAL_SECTION()
+
+	if( result != 1 )
+	{
+		pyvsmbr_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: invalid volume - file IO handle already set.",
+		 function );
+
+		goto on_error;
+	}
 	Py_BEGIN_ALLOW_THREADS
 
 	result = libvsmbr_volume_open_file_io_handle(
 	          pyvsmbr_volume->volume,
-	          pyvsmbr_volume->file_io_handle,
+	          file_io_handle,
 	          LIBVSMBR_OPEN_READ,
 	          &error );
 
@@ -739,6 +774,12 @@ PyObject *pyvsmbr_volume_open_file_object(
 		libcerror_error_free(
 		 &error );
 
+		Py_BEGIN_CRITICAL_SECTION( pyvsmbr_volume )
+
+		pyvsmbr_volume->file_io_handle = NULL;
+
+		Py_END_CRITICAL_SECTION()
+
 		goto on_error;
 	}
 	Py_IncRef(
@@ -747,12 +788,193 @@ PyObject *pyvsmbr_volume_open_file_object(
 	return( Py_None );
 
 on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( NULL );
+}
+
+/* Opens a volume using an object that supports the buffer protocol
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyvsmbr_volume_open_buffer(
+           pyvsmbr_volume_t *pyvsmbr_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffer_view;
+
+	PyObject *buffer_object          = NULL;
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	static char *function            = "pyvsmbr_volume_open_buffer";
+	static char *keyword_list[]      = { "buffer", "mode", NULL };
+	char *mode                       = NULL;
+	uint8_t has_buffer_view          = 0;
+	int result                       = 0;
+
+	if( pyvsmbr_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O|s",
+	     keyword_list,
+	     &buffer_object,
+	     &mode ) == 0 )
+	{
+		return( NULL );
+	}
+	if( ( mode != NULL )
+	 && ( mode[ 0 ] != 'r' ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: unsupported mode: %s.",
+		 function,
+		 mode );
+
+		return( NULL );
+	}
 	if( pyvsmbr_volume->file_io_handle != NULL )
+	{
+		pyvsmbr_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: invalid volume - file IO handle already set.",
+		 function );
+
+		return( NULL );
+	}
+	/* The buffer view keeps the memory of the object valid and
+	 * prevents it from being resized or closed while the volume is open
+	 */
+	if( PyObject_GetBuffer(
+	     buffer_object,
+	     &buffer_view,
+	     PyBUF_SIMPLE ) != 0 )
+	{
+		return( NULL );
+	}
+	has_buffer_view = 1;
+
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
+	     &error ) != 1 )
+	{
+		pyvsmbr_error_raise(
+		 error,
+		 PyExc_MemoryError,
+		 "%s: unable to initialize file IO handle.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     (uint8_t *) buffer_view.buf,
+	     (size_t) buffer_view.len,
+	     &error ) != 1 )
+	{
+		pyvsmbr_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to set memory range of file IO handle.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	/* Claim the file IO handle of the volume, since without the GIL
+	 * another thread can open the same volume concurrently, the buffer
+	 * view is released by close after the file IO handle has been freed
+	 */
+	result = 0;
+
+	Py_BEGIN_CRITICAL_SECTION( pyvsmbr_volume )
+
+	if( pyvsmbr_volume->file_io_handle == NULL )
+	{
+		pyvsmbr_volume->file_io_handle  = file_io_handle;
+		pyvsmbr_volume->buffer_view     = buffer_view;
+		pyvsmbr_volume->has_buffer_view = 1;
+
+		result = 1;
+	}
+	Py_END_CRITICAL_SECTION()
+
+	if( result != 1 )
+	{
+		pyvsmbr_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: invalid volume - file IO handle already set.",
+		 function );
+
+		goto on_error;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libvsmbr_volume_open_file_io_handle(
+	          pyvsmbr_volume->volume,
+	          file_io_handle,
+	          LIBVSMBR_OPEN_READ,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyvsmbr_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to open volume.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		Py_BEGIN_CRITICAL_SECTION( pyvsmbr_volume )
+
+		pyvsmbr_volume->file_io_handle  = NULL;
+		pyvsmbr_volume->has_buffer_view = 0;
+
+		Py_END_CRITICAL_SECTION()
+
+		goto on_error;
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+
+on_error:
+	if( file_io_handle != NULL )
 	{
 		libbfio_handle_free(
-		 &( pyvsmbr_volume->file_io_handle ),
+		 &file_io_handle,
 		 NULL );
 	}
+	if( has_buffer_view != 0 )
+	{
+		PyBuffer_Release(
+		 &buffer_view );
+	}
 	return( NULL );
 }
 
@@ -763,9 +985,13 @@ PyObject *pyvsmbr_volume_close(
            pyvsmbr_volume_t *pyvsmbr_volume,
            PyObject *arguments PYVSMBR_ATTRIBUTE_UNUSED )
 {
-	libcerror_error_t *error = NULL;
-	static char *function    = "pyvsmbr_volume_close";
-	int result               = 0;
+	Py_buffer buffer_view;
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	static char *function            = "pyvsmbr_volume_close";
+	uint8_t has_buffer_view          = 0;
+	int result                       = 0;
 
 	PYVSMBR_UNREFERENCED_PARAMETER( arguments )
 
@@ -799,16 +1025,41 @@ PyObject *pyvsmbr_volume_close(
 
 		return( NULL );
 	}
-	if( pyvsmbr_volume->file_io_handle != NULL )
+	/* Take the file IO handle of the volume so that only one of
+	 * concurrent calls to close frees it
+	 */
+	Py_BEGIN_CRITICAL_SECTION( pyvsmbr_volume )
+
+	file_io_handle                 = pyvsmbr_volume->file_io_handle;
+	pyvsmbr_volume->file_io_handle = NULL;
+
+	has_buffer_view = pyvsmbr_volume->has_buffer_view;
+
+	if( has_buffer_view != 0 )
+	{
+		buffer_view                     = pyvsmbr_volume->buffer_view;
+		pyvsmbr_volume->has_buffer_view = 0;
+	}
+	Py_END_CRITICAL_SECTION()
+
+	if( file_io_handle != NULL )
 	{
 		Py_BEGIN_ALLOW_THREADS
 
 		result = libbfio_handle_free(
-		          &( pyvsmbr_volume->file_io_handle ),
+		          &file_io_handle,
 		          &error );
 
 		Py_END_ALLOW_THREADS
 
+		/* The memory range of the file IO handle can only be released
+		 * after the file IO handle has been freed
+		 */
+		if( has_buffer_view != 0 )
+		{
+			PyBuffer_Release(
+			 &buffer_view );
+		}
 		if( result != 1 )
 		{
 			pyvsmbr_error_raise(
@@ -48,6 +48,14 @@ struct pyvsmbr_volume
 	/* The libbfio file IO handle
 	 */
 	libbfio_handle_t *file_io_handle;
+
+	/* The buffer view of the object the volume was opened from
+	 */
+	Py_buffer buffer_view;
+
+	/* Value to indicate the buffer view is set
+	 */
+	uint8_t has_buffer_view;
 };
 
 extern PyMethodDef pyvsmbr_volume_object_methods[];
@@ -73,6 +81,11 @@ PyObject *pyvsmbr_volume_open_file_object(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyvsmbr_volume_open_buffer(
+           pyvsmbr_volume_t *pyvsmbr_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyvsmbr_volume_close(
            pyvsmbr_volume_t *pyvsmbr_volume,
            PyObject *arguments );
@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+#
+# Python-bindings read throughput benchmark script
+#
+# Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+#
+# Refer to AUTHORS for acknowledgements.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+import argparse
+import json
+import os
+import sys
+import threading
+import time
+
+import pyvsmbr
+
+
+def ReadPartitionInThreads(
+    source, number_of_threads, buffer_size, number_of_iterations):
+  """Reads the first partition from multiple threads.
+
+  Every thread opens its own volume and reads the same amount of data.
+
+  Args:
+    source (str): path of the source file.
+    number_of_threads (int): number of reading threads.
+    buffer_size (int): size of the read buffer.
+    number_of_iterations (int): number of times every thread reads
+        the partition.
+
+  Returns:
+    tuple[float, int]: elapsed time in seconds and number of bytes read.
+  """
+  barrier = threading.Barrier(number_of_threads + 1)
+  bytes_read = [0] * number_of_threads
+
+  def _ReadThread(thread_index):
+    vsmbr_volume = pyvsmbr.volume()
+    vsmbr_volume.open(source)
+    try:
+      vsmbr_partition = vsmbr_volume.get_partition(0)
+      read_size = min(vsmbr_partition.size, buffer_size)
+
+      barrier.wait()
+
+      for _ in range(number_of_iterations):
+        for offset in range(0, vsmbr_partition.size, read_size):
+          data = vsmbr_partition.read_buffer_at_offset(read_size, offset)
+          bytes_read[thread_index] += len(data)
+
+    finally:
+      vsmbr_volume.close()
+
+  threads = [
+      threading.Thread(target=_ReadThread, args=(thread_index, ))
+      for thread_index in range(number_of_threads)]
+
+  for thread in threads:
+    thread.start()
+
+  barrier.wait()
+  start_time = time.perf_counter()
+
+  for thread in threads:
+    thread.join()
+
+  return time.perf_counter() - start_time, sum(bytes_read)
+
+
+def Main():
+  """The main program function.
+
+  Returns:
+    bool: True if successful or False if not.
+  """
+  argument_parser = argparse.ArgumentParser(description=(
+      "Measures how the read throughput of pyvsmbr scales with the number "
+      "of threads. The results are printed to stdout as one JSON object "
+      "per line."))
+
+  argument_parser.add_argument(
+      "-B", "--buffer_size", dest="buffer_size", type=int, action="store",
+      default=65536, metavar="SIZE", help="size of the read buffer.")
+
+  argument_parser.add_argument(
+      "-i", "--iterations", dest="iterations", type=int, action="store",
+      default=16, metavar="NUMBER", help=(
+          "number of times every thread reads the first partition."))
+
+  argument_parser.add_argument(
+      "-t", "--threads", dest="threads", type=int, action="store",
+      default=min(os.cpu_count() or 1, 4), metavar="NUMBER",
+      help="maximum number of reading threads.")
+
+  argument_parser.add_argument(
+      "source", nargs="?", action="store", metavar="PATH",
+      default=None, help="path of the source file.")
+
+  options = argument_parser.parse_args()
+
+  if not options.source:
+    print("Source value is missing.")
+    print("")
+    argument_parser.print_help()
+    return False
+
+  if options.buffer_size <= 0 or options.iterations <= 0 or options.threads <= 0:
+    print("Invalid buffer size, iterations or threads value.")
+    return False
+
+  is_gil_enabled = getattr(sys, "_is_gil_enabled", None)
+  gil_enabled = not is_gil_enabled or is_gil_enabled()
+
+  single_thread_time = None
+  number_of_threads = 1
+  while number_of_threads <= options.threads:
+    elapsed_time, number_of_bytes_read = ReadPartitionInThreads(
+        options.source, number_of_threads, options.buffer_size,
+        options.iterations)
+
+    if single_thread_time is None:
+      single_thread_time = elapsed_time
+
+    # Every thread does the same amount of work, so with linear scaling
+    # the elapsed time does not depend on the number of threads.
+    speedup = number_of_threads * single_thread_time / max(elapsed_time, 1e-9)
+
+    print(json.dumps({
+        "benchmark": "python_read",
+        "gil_enabled": gil_enabled,
+        "buffer_size": options.buffer_size,
+        "threads": number_of_threads,
+        "bytes": number_of_bytes_read,
+        "microseconds": int(elapsed_time * 1000000),
+        "speedup": round(speedup, 2)}))
+
+    if number_of_threads == options.threads:
+      break
+    number_of_threads = min(number_of_threads * 2, options.threads)
+
+  return True
+
+
+if __name__ == "__main__":
+  if not Main():
+    sys.exit(1)
+  else:
+    sys.exit(0)
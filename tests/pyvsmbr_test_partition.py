@@ -23,6 +23,7 @@ import argparse
 import os
 import random
 import sys
+import threading
 import unittest
 
 import pyvsmbr
@@ -184,6 +185,112 @@ class PartitionTypeTests(unittest.TestCase):
     finally:
       vsmbr_volume.close()
 
+  def test_read_buffer_into(self):
+    """Tests the read_buffer_into function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    vsmbr_volume = pyvsmbr.volume()
+
+    vsmbr_volume.open(test_source)
+
+    try:
+      if not vsmbr_volume.number_of_partitions:
+        raise unittest.SkipTest("missing partitions")
+
+      vsmbr_partition = vsmbr_volume.get_partition(0)
+
+      size = vsmbr_partition.get_size()
+
+      # Test read into a bytearray.
+      vsmbr_partition.seek_offset(0, os.SEEK_SET)
+
+      expected_data = vsmbr_partition.read_buffer(size=4096)
+
+      vsmbr_partition.seek_offset(0, os.SEEK_SET)
+
+      buffer = bytearray(4096)
+      read_count = vsmbr_partition.read_buffer_into(buffer)
+
+      self.assertEqual(read_count, min(size, 4096))
+      self.assertEqual(bytes(buffer[:read_count]), expected_data)
+      self.assertEqual(vsmbr_partition.get_offset(), read_count)
+
+      # Test read into a memoryview.
+      vsmbr_partition.seek_offset(0, os.SEEK_SET)
+
+      buffer = bytearray(8192)
+      read_count = vsmbr_partition.readinto(memoryview(buffer)[4096:])
+
+      self.assertEqual(read_count, min(size, 4096))
+      self.assertEqual(bytes(buffer[4096:4096 + read_count]), expected_data)
+
+      if size > 8:
+        vsmbr_partition.seek_offset(-8, os.SEEK_END)
+
+        # Read buffer on size boundary.
+        read_count = vsmbr_partition.readinto(buffer)
+
+        self.assertEqual(read_count, 8)
+
+        # Read buffer beyond size boundary.
+        read_count = vsmbr_partition.readinto(buffer)
+
+        self.assertEqual(read_count, 0)
+
+      with self.assertRaises(TypeError):
+        vsmbr_partition.readinto(b"read-only")
+
+    finally:
+      vsmbr_volume.close()
+
+  def test_read_buffer_at_offset_into(self):
+    """Tests the read_buffer_at_offset_into function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    vsmbr_volume = pyvsmbr.volume()
+
+    vsmbr_volume.open(test_source)
+
+    try:
+      if not vsmbr_volume.number_of_partitions:
+        raise unittest.SkipTest("missing partitions")
+
+      vsmbr_partition = vsmbr_volume.get_partition(0)
+
+      size = vsmbr_partition.get_size()
+
+      # Test normal read.
+      expected_data = vsmbr_partition.read_buffer_at_offset(4096, 0)
+
+      buffer = bytearray(4096)
+      read_count = vsmbr_partition.read_buffer_at_offset_into(buffer, 0)
+
+      self.assertEqual(read_count, min(size, 4096))
+      self.assertEqual(bytes(buffer[:read_count]), expected_data)
+
+      if size > 8:
+        # Read buffer on size boundary.
+        read_count = vsmbr_partition.read_buffer_at_offset_into(
+            buffer, size - 8)
+
+        self.assertEqual(read_count, 8)
+
+        # Read buffer beyond size boundary.
+        read_count = vsmbr_partition.read_buffer_at_offset_into(
+            buffer, size + 8)
+
+        self.assertEqual(read_count, 0)
+
+      with self.assertRaises(ValueError):
+        vsmbr_partition.read_buffer_at_offset_into(buffer, -1)
+
+    finally:
+      vsmbr_volume.close()
+
   def test_seek_offset(self):
     """Tests the seek_offset function."""
     test_source = getattr(unittest, "source", None)
@@ -317,6 +424,138 @@ class PartitionTypeTests(unittest.TestCase):
     finally:
       vsmbr_volume.close()
 
+  def test_iter_chunks(self):
+    """Tests the iter_chunks function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    vsmbr_volume = pyvsmbr.volume()
+
+    vsmbr_volume.open(test_source)
+
+    try:
+      if not vsmbr_volume.number_of_partitions:
+        raise unittest.SkipTest("missing partitions")
+
+      vsmbr_partition = vsmbr_volume.get_partition(0)
+
+      size = vsmbr_partition.get_size()
+      end = min(size, 256 * 1024)
+
+      expected_data = vsmbr_partition.read_buffer_at_offset(end, 0)
+
+      # Test iterating over a range that does not end on a chunk boundary.
+      chunks = []
+      for chunk in vsmbr_partition.iter_chunks(3000, end=end):
+        self.assertIsInstance(chunk, memoryview)
+        self.assertTrue(chunk.readonly)
+        self.assertLessEqual(len(chunk), 3000)
+
+        chunks.append(bytes(chunk))
+
+      self.assertEqual(b"".join(chunks), expected_data)
+
+      # Test that memory views that are still referenced are not overwritten
+      # by the chunks that are read after them.
+      chunks = list(vsmbr_partition.iter_chunks(3000, end=end))
+      self.assertEqual(b"".join(bytes(chunk) for chunk in chunks), expected_data)
+
+      if end > 8:
+        data = b"".join(
+            bytes(chunk) for chunk in vsmbr_partition.iter_chunks(
+                1024, start=end - 8, end=end))
+        self.assertEqual(data, expected_data[-8:])
+
+      # Test iterating beyond size boundary.
+      chunks = list(vsmbr_partition.iter_chunks(4096, start=size + 8))
+      self.assertEqual(chunks, [])
+
+      with self.assertRaises(ValueError):
+        vsmbr_partition.iter_chunks(0)
+
+      with self.assertRaises(ValueError):
+        vsmbr_partition.iter_chunks(-1)
+
+      with self.assertRaises(ValueError):
+        vsmbr_partition.iter_chunks(4096, start=-1)
+
+      with self.assertRaises(ValueError):
+        vsmbr_partition.iter_chunks(4096, start=16, end=8)
+
+    finally:
+      vsmbr_volume.close()
+
+  def _ReadPartitionInThreads(
+      self, test_source, number_of_threads, number_of_iterations):
+    """Reads the first partition from multiple threads.
+
+    Every thread opens its own volume and reads the same amount of data.
+
+    Returns:
+      list[bytes]: the data read per thread.
+    """
+    barrier = threading.Barrier(number_of_threads + 1)
+    results = [None] * number_of_threads
+
+    def _ReadThread(thread_index):
+      vsmbr_volume = pyvsmbr.volume()
+      vsmbr_volume.open(test_source)
+      try:
+        vsmbr_partition = vsmbr_volume.get_partition(0)
+        read_size = min(vsmbr_partition.size, 65536)
+
+        barrier.wait()
+
+        data = None
+        for _ in range(number_of_iterations):
+          for offset in range(0, vsmbr_partition.size, read_size):
+            data = vsmbr_partition.read_buffer_at_offset(read_size, offset)
+            if offset >= 16 * read_size:
+              break
+
+        results[thread_index] = data
+
+      finally:
+        vsmbr_volume.close()
+
+    threads = [
+        threading.Thread(target=_ReadThread, args=(thread_index, ))
+        for thread_index in range(number_of_threads)]
+
+    for thread in threads:
+      thread.start()
+
+    barrier.wait()
+
+    for thread in threads:
+      thread.join()
+
+    return results
+
+  def test_read_buffer_threads(self):
+    """Tests the read_buffer_at_offset function from multiple threads."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    vsmbr_volume = pyvsmbr.volume()
+
+    vsmbr_volume.open(test_source)
+
+    try:
+      if not vsmbr_volume.number_of_partitions:
+        raise unittest.SkipTest("missing partitions")
+
+    finally:
+      vsmbr_volume.close()
+
+    results = self._ReadPartitionInThreads(test_source, 4, 1)
+
+    self.assertIsNotNone(results[0])
+    for data in results[1:]:
+      self.assertEqual(data, results[0])
+
 
 if __name__ == "__main__":
   argument_parser = argparse.ArgumentParser()
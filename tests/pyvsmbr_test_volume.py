@@ -20,8 +20,10 @@
 # along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 import argparse
+import mmap
 import os
 import sys
+import threading
 import unittest
 
 import pyvsmbr
@@ -83,6 +85,166 @@ class VolumeTypeTests(unittest.TestCase):
       with self.assertRaises(ValueError):
         vsmbr_volume.open_file_object(file_object, mode="w")
 
+  def _ReadPartitions(self, vsmbr_volume):
+    """Reads the start of every partition."""
+    partitions_data = []
+    for partition_index in range(vsmbr_volume.number_of_partitions):
+      partition = vsmbr_volume.get_partition(partition_index)
+      partitions_data.append(partition.read_buffer_at_offset(4096, 0))
+
+    return partitions_data
+
+  def test_open_file_object_fast_paths(self):
+    """Tests the open_file_object function with a file and mmap object."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    if not os.path.isfile(test_source) or not os.path.getsize(test_source):
+      raise unittest.SkipTest("source not a non-empty regular file")
+
+    vsmbr_volume = pyvsmbr.volume()
+
+    vsmbr_volume.open(test_source)
+
+    try:
+      expected_partitions_data = self._ReadPartitions(vsmbr_volume)
+
+    finally:
+      vsmbr_volume.close()
+
+    with open(test_source, "rb") as file_object:
+      vsmbr_volume.open_file_object(file_object)
+
+      try:
+        partitions_data = self._ReadPartitions(vsmbr_volume)
+        self.assertEqual(partitions_data, expected_partitions_data)
+
+      finally:
+        vsmbr_volume.close()
+
+      with mmap.mmap(
+          file_object.fileno(), 0, access=mmap.ACCESS_READ) as mmap_object:
+        vsmbr_volume.open_file_object(mmap_object)
+
+        try:
+          partitions_data = self._ReadPartitions(vsmbr_volume)
+          self.assertEqual(partitions_data, expected_partitions_data)
+
+        finally:
+          vsmbr_volume.close()
+
+  def test_open_buffer(self):
+    """Tests the open_buffer function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    if not os.path.isfile(test_source) or not os.path.getsize(test_source):
+      raise unittest.SkipTest("source not a non-empty regular file")
+
+    vsmbr_volume = pyvsmbr.volume()
+
+    vsmbr_volume.open(test_source)
+
+    try:
+      expected_partitions_data = self._ReadPartitions(vsmbr_volume)
+
+    finally:
+      vsmbr_volume.close()
+
+    with open(test_source, "rb") as file_object:
+      data = file_object.read()
+
+      with mmap.mmap(
+          file_object.fileno(), 0, access=mmap.ACCESS_READ) as mmap_object:
+        for buffer_object in (data, bytearray(data), mmap_object):
+          vsmbr_volume.open_buffer(buffer_object)
+
+          try:
+            partitions_data = self._ReadPartitions(vsmbr_volume)
+            self.assertEqual(partitions_data, expected_partitions_data)
+
+            with self.assertRaises(IOError):
+              vsmbr_volume.open_buffer(buffer_object)
+
+          finally:
+            vsmbr_volume.close()
+
+        # The buffer is referenced until the volume is closed.
+        vsmbr_volume.open_buffer(mmap_object)
+
+        with self.assertRaises(BufferError):
+          mmap_object.close()
+
+        vsmbr_volume.close()
+
+    bytearray_object = bytearray(data)
+
+    vsmbr_volume = pyvsmbr.open_buffer(bytearray_object)
+
+    try:
+      partitions_data = self._ReadPartitions(vsmbr_volume)
+      self.assertEqual(partitions_data, expected_partitions_data)
+
+      with self.assertRaises(BufferError):
+        bytearray_object.append(0)
+
+    finally:
+      vsmbr_volume.close()
+
+    bytearray_object.append(0)
+
+    with self.assertRaises(TypeError):
+      vsmbr_volume.open_buffer(None)
+
+    with self.assertRaises(ValueError):
+      vsmbr_volume.open_buffer(data, mode="w")
+
+  def test_open_file_object_threads(self):
+    """Tests reading a file object from multiple threads."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    if not os.path.isfile(test_source):
+      raise unittest.SkipTest("source not a regular file")
+
+    vsmbr_volume = pyvsmbr.volume()
+
+    vsmbr_volume.open(test_source)
+
+    try:
+      expected_partitions_data = self._ReadPartitions(vsmbr_volume)
+
+    finally:
+      vsmbr_volume.close()
+
+    results = []
+
+    def _ReadThread(file_object):
+      thread_volume = pyvsmbr.volume()
+      thread_volume.open_file_object(file_object)
+      try:
+        for _ in range(16):
+          results.append(self._ReadPartitions(thread_volume))
+      finally:
+        thread_volume.close()
+
+    with open(test_source, "rb") as file_object:
+      threads = [
+          threading.Thread(target=_ReadThread, args=(file_object, ))
+          for _ in range(4)]
+
+      for thread in threads:
+        thread.start()
+      for thread in threads:
+        thread.join()
+
+    self.assertEqual(len(results), 4 * 16)
+    for partitions_data in results:
+      self.assertEqual(partitions_data, expected_partitions_data)
+
   def test_close(self):
     """Tests the close function."""
     test_source = getattr(unittest, "source", None)
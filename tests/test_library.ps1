@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "boot_record chs_address error io_handle notify partition_entry partition_type partition_values section_values sector_data"
+$LibraryTests = "block_cache block_hash_index boot_record cache_arena checksum chs_address chunk_reader compressed data_mover deflate digest entropy_map error handle_pool image_builder io_handle latency move_journal notify overlay partition_entry partition_type partition_values section_values sector_data segments sparse_map statistics trace write_cache"
 $LibraryTestsWithInput = "partition support volume"
 $OptionSets = "" -split " "
 
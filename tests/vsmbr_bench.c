@@ -0,0 +1,2307 @@
+/*
+ * Benchmark program for libvsmbr
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#endif
+
+#if defined( HAVE_TIME_H ) || defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "vsmbr_bench_image.h"
+#include "vsmbr_bench_replay.h"
+#include "vsmbr_test_getopt.h"
+#include "vsmbr_test_latency_io_handle.h"
+#include "vsmbr_test_libbfio.h"
+#include "vsmbr_test_libcerror.h"
+#include "vsmbr_test_libcthreads.h"
+#include "vsmbr_test_libvsmbr.h"
+
+/* The default name of the generated image
+ */
+#define VSMBR_BENCH_DEFAULT_IMAGE_NAME		_SYSTEM_STRING( "vsmbr_bench.raw" )
+
+/* The number of buffers skipped by the strided read pattern
+ */
+#define VSMBR_BENCH_STRIDE			8
+
+/* The maximum number of threads
+ */
+#define VSMBR_BENCH_MAXIMUM_NUMBER_OF_THREADS	64
+
+/* The maximum number of values of a replay configuration list
+ */
+#define VSMBR_BENCH_MAXIMUM_NUMBER_OF_REPLAY_VALUES	16
+
+enum VSMBR_BENCH_PATTERNS
+{
+	VSMBR_BENCH_PATTERN_SEQUENTIAL		= 0x01,
+	VSMBR_BENCH_PATTERN_RANDOM		= 0x02,
+	VSMBR_BENCH_PATTERN_STRIDED		= 0x04,
+
+	VSMBR_BENCH_PATTERN_ALL			= 0x07
+};
+
+typedef struct vsmbr_bench_storage vsmbr_bench_storage_t;
+
+struct vsmbr_bench_storage
+{
+	/* The latency added to every read of the source in nano seconds
+	 */
+	uint64_t latency;
+
+	/* The maximum random latency added on top of the latency in nano seconds
+	 */
+	uint64_t jitter;
+
+	/* The maximum number of bytes per second read from the source,
+	 * where 0 represents unlimited
+	 */
+	uint64_t bytes_per_second;
+};
+
+typedef struct vsmbr_bench_read_context vsmbr_bench_read_context_t;
+
+struct vsmbr_bench_read_context
+{
+	/* The volume
+	 */
+	libvsmbr_volume_t *volume;
+
+	/* The number of partitions
+	 */
+	int number_of_partitions;
+
+	/* The read pattern
+	 */
+	int pattern;
+
+	/* The read buffer size
+	 */
+	size_t buffer_size;
+
+	/* The index of the thread
+	 */
+	int thread_index;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The number of read calls
+	 */
+	uint64_t number_of_reads;
+
+	/* The number of bytes read
+	 */
+	uint64_t number_of_bytes_read;
+
+	/* The error
+	 */
+	libcerror_error_t *error;
+};
+
+/* Prints usage information
+ */
+void vsmbr_bench_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use vsmbr_bench to measure the performance of libvsmbr.\n\n" );
+
+	fprintf( stream, "Usage: vsmbr_bench [ -A read_ahead ] [ -b bytes_per_sector ]\n"
+	                 "                   [ -B buffer_size ] [ -C cache_entries ]\n"
+	                 "                   [ -e number_of_logical_partitions ]\n"
+	                 "                   [ -i iterations ] [ -J jitter ] [ -L latency ]\n"
+	                 "                   [ -o image ] [ -p pattern ] [ -R trace ]\n"
+	                 "                   [ -s partition_size ] [ -S block_sizes ]\n"
+	                 "                   [ -t threads ] [ -T trace ] [ -W bandwidth ]\n"
+	                 "                   [ -hk ] [ source ]\n\n" );
+
+	fprintf( stream, "\tsource: an existing image to benchmark, if not provided a synthetic\n"
+	                 "\t        image is generated\n\n" );
+
+	fprintf( stream, "\t-A:     comma separated numbers of blocks read ahead on a cache miss\n"
+	                 "\t        to simulate when replaying a trace (default is 0,1,8)\n" );
+	fprintf( stream, "\t-b:     number of bytes per sector of the generated image (default is 512)\n"
+	                 "\t        also used to override the bytes per sector of the source\n" );
+	fprintf( stream, "\t-B:     size of the read buffer (default is 65536), K, M and G suffixes\n"
+	                 "\t        are supported\n" );
+	fprintf( stream, "\t-C:     comma separated numbers of cache entries to simulate when\n"
+	                 "\t        replaying a trace (default is 16,256,4096)\n" );
+	fprintf( stream, "\t-e:     number of logical partitions, which is the length of the\n"
+	                 "\t        extended boot record chain, of the generated image (default is 8)\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     number of iterations of the open latency benchmark (default is 100)\n" );
+	fprintf( stream, "\t-J:     maximum random latency in micro seconds added on top of\n"
+	                 "\t        the latency of every read of the source (default is 0)\n" );
+	fprintf( stream, "\t-k:     keep the generated image\n" );
+	fprintf( stream, "\t-L:     latency in micro seconds added to every read of the source\n"
+	                 "\t        to simulate slow storage (default is 0)\n" );
+	fprintf( stream, "\t-o:     path of the generated image (default is vsmbr_bench.raw)\n" );
+	fprintf( stream, "\t-p:     read pattern, options: all (default), random, sequential, strided\n" );
+	fprintf( stream, "\t-R:     replay a trace instead of running the benchmarks, the requests\n"
+	                 "\t        are simulated for every combination of block size, number of\n"
+	                 "\t        cache entries and read ahead and, if a source is provided,\n"
+	                 "\t        replayed against the source\n" );
+	fprintf( stream, "\t-s:     size of every partition of the generated image (default is 4M)\n" );
+	fprintf( stream, "\t-S:     comma separated block sizes to simulate when replaying a trace\n"
+	                 "\t        (default is 512,4096,65536), K, M and G suffixes are supported\n" );
+	fprintf( stream, "\t-t:     number of reading threads (default is 1)\n" );
+	fprintf( stream, "\t-T:     record a trace of the reads of the read throughput benchmark\n" );
+	fprintf( stream, "\t-W:     maximum number of bytes per second read from the source\n"
+	                 "\t        (default is unlimited), K, M and G suffixes are supported\n" );
+
+	fprintf( stream, "\nThe results are printed to stdout as one JSON object per line.\n" );
+}
+
+/* Copies a decimal string with an optional K, M or G suffix to a 64-bit value
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_copy_size_from_string(
+     const system_character_t *string,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function = "vsmbr_bench_copy_size_from_string";
+	size_t string_index   = 0;
+	uint64_t multiplier   = 1;
+	uint64_t value        = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( string[ string_index ] >= (system_character_t) '0' )
+	    && ( string[ string_index ] <= (system_character_t) '9' ) )
+	{
+		if( value > ( ( (uint64_t) UINT64_MAX - 9 ) / 10 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		value *= 10;
+		value += (uint64_t) ( string[ string_index ] - (system_character_t) '0' );
+
+		string_index++;
+	}
+	if( string_index == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string value.",
+		 function );
+
+		return( -1 );
+	}
+	switch( string[ string_index ] )
+	{
+		case (system_character_t) 'K':
+		case (system_character_t) 'k':
+			multiplier = 1024;
+			string_index++;
+			break;
+
+		case (system_character_t) 'M':
+		case (system_character_t) 'm':
+			multiplier = 1024 * 1024;
+			string_index++;
+			break;
+
+		case (system_character_t) 'G':
+		case (system_character_t) 'g':
+			multiplier = 1024 * 1024 * 1024;
+			string_index++;
+			break;
+
+		default:
+			break;
+	}
+	if( string[ string_index ] != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value > ( (uint64_t) UINT64_MAX / multiplier ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*value_64bit = value * multiplier;
+
+	return( 1 );
+}
+
+/* Copies a comma separated list of decimal strings with an optional K, M or G suffix
+ * to 64-bit values
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_copy_sizes_from_string(
+     const system_character_t *string,
+     uint64_t *values,
+     int maximum_number_of_values,
+     int *number_of_values,
+     libcerror_error_t **error )
+{
+	system_character_t value_string[ 32 ];
+
+	static char *function     = "vsmbr_bench_copy_sizes_from_string";
+	size_t string_index       = 0;
+	size_t value_string_index = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of values.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_values = 0;
+
+	do
+	{
+		if( ( string[ string_index ] == (system_character_t) ',' )
+		 || ( string[ string_index ] == 0 ) )
+		{
+			if( *number_of_values >= maximum_number_of_values )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of values exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			value_string[ value_string_index ] = 0;
+
+			if( vsmbr_bench_copy_size_from_string(
+			     value_string,
+			     &( values[ *number_of_values ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy value: %d.",
+				 function,
+				 *number_of_values );
+
+				return( -1 );
+			}
+			*number_of_values += 1;
+
+			value_string_index = 0;
+		}
+		else
+		{
+			if( value_string_index >= ( 32 - 1 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_LARGE,
+				 "%s: invalid value string too large.",
+				 function );
+
+				return( -1 );
+			}
+			value_string[ value_string_index++ ] = string[ string_index ];
+		}
+	}
+	while( string[ string_index++ ] != 0 );
+
+	return( 1 );
+}
+
+/* Retrieves the current time in micro seconds
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_get_current_time(
+     int64_t *current_time,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_GETTIMEOFDAY )
+	struct timeval time_value;
+#else
+	time_t time_value     = 0;
+#endif
+
+	static char *function = "vsmbr_bench_get_current_time";
+
+	if( current_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_GETTIMEOFDAY )
+	if( gettimeofday(
+	     &time_value,
+	     NULL ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve time of day.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = ( (int64_t) time_value.tv_sec * 1000000 ) + (int64_t) time_value.tv_usec;
+#else
+	time_value = time(
+	              NULL );
+
+	if( time_value == (time_t) -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve time.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = (int64_t) time_value * 1000000;
+#endif
+	return( 1 );
+}
+
+/* Compares 2 samples, used to sort the samples
+ * Returns -1 if first is less than second, 0 if equal or 1 if greater
+ */
+int vsmbr_bench_compare_samples(
+     const void *first_sample,
+     const void *second_sample )
+{
+	int64_t first_value  = *( (const int64_t *) first_sample );
+	int64_t second_value = *( (const int64_t *) second_sample );
+
+	if( first_value < second_value )
+	{
+		return( -1 );
+	}
+	else if( first_value > second_value )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Prints the latency samples of a benchmark
+ * The samples are sorted in place
+ */
+void vsmbr_bench_latency_fprint(
+      FILE *stream,
+      const char *benchmark,
+      int64_t *samples,
+      int number_of_samples )
+{
+	int64_t total_time = 0;
+	int sample_index   = 0;
+
+	if( ( stream == NULL )
+	 || ( benchmark == NULL )
+	 || ( samples == NULL )
+	 || ( number_of_samples <= 0 ) )
+	{
+		return;
+	}
+	qsort(
+	 samples,
+	 (size_t) number_of_samples,
+	 sizeof( int64_t ),
+	 &vsmbr_bench_compare_samples );
+
+	for( sample_index = 0;
+	     sample_index < number_of_samples;
+	     sample_index++ )
+	{
+		total_time += samples[ sample_index ];
+	}
+	fprintf(
+	 stream,
+	 "{\"benchmark\": \"%s\", \"iterations\": %d, \"minimum_microseconds\": %" PRIi64 ", \"median_microseconds\": %" PRIi64 ", \"p95_microseconds\": %" PRIi64 ", \"maximum_microseconds\": %" PRIi64 ", \"mean_microseconds\": %" PRIi64 "}\n",
+	 benchmark,
+	 number_of_samples,
+	 samples[ 0 ],
+	 samples[ number_of_samples / 2 ],
+	 samples[ ( ( ( number_of_samples * 95 ) + 99 ) / 100 ) - 1 ],
+	 samples[ number_of_samples - 1 ],
+	 total_time / number_of_samples );
+}
+
+/* Opens a volume
+ * If the storage adds latency or limits the bandwidth the volume is opened
+ * using a file IO handle that delays every read
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_open_volume(
+     libvsmbr_volume_t **volume,
+     libbfio_handle_t **file_io_handle,
+     const system_character_t *filename,
+     uint32_t bytes_per_sector,
+     vsmbr_bench_storage_t *storage,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *source_file_io_handle = NULL;
+	static char *function                   = "vsmbr_bench_open_volume";
+	size_t filename_length                  = 0;
+	int result                              = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( libvsmbr_volume_initialize(
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( bytes_per_sector != 0 )
+	{
+		if( libvsmbr_volume_set_bytes_per_sector(
+		     *volume,
+		     bytes_per_sector,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set bytes per sector.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( storage == NULL )
+	 || ( ( storage->latency == 0 )
+	  &&  ( storage->jitter == 0 )
+	  &&  ( storage->bytes_per_second == 0 ) ) )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libvsmbr_volume_open_wide(
+		          *volume,
+		          filename,
+		          LIBVSMBR_OPEN_READ,
+		          error );
+#else
+		result = libvsmbr_volume_open(
+		          *volume,
+		          filename,
+		          LIBVSMBR_OPEN_READ,
+		          error );
+#endif
+	}
+	else
+	{
+		if( libbfio_file_initialize(
+		     &source_file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize source file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		filename_length = system_string_length(
+		                   filename );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbfio_file_set_name_wide(
+		          source_file_io_handle,
+		          filename,
+		          filename_length + 1,
+		          error );
+#else
+		result = libbfio_file_set_name(
+		          source_file_io_handle,
+		          filename,
+		          filename_length + 1,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in source file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( vsmbr_test_latency_initialize(
+		     file_io_handle,
+		     source_file_io_handle,
+		     storage->latency,
+		     storage->jitter,
+		     storage->bytes_per_second,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize latency file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		/* The source file IO handle is now managed by the latency file IO handle
+		 */
+		source_file_io_handle = NULL;
+
+		result = libvsmbr_volume_open_file_io_handle(
+		          *volume,
+		          *file_io_handle,
+		          LIBVSMBR_OPEN_READ,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 file_io_handle,
+		 NULL );
+	}
+	if( source_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &source_file_io_handle,
+		 NULL );
+	}
+	if( *volume != NULL )
+	{
+		libvsmbr_volume_free(
+		 volume,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes a volume and frees the file IO handle it was opened with, if any
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_close_volume(
+     libvsmbr_volume_t **volume,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "vsmbr_bench_close_volume";
+	int result            = 1;
+
+	if( libvsmbr_volume_close(
+	     *volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close volume.",
+		 function );
+
+		result = -1;
+	}
+	if( libvsmbr_volume_free(
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume.",
+		 function );
+
+		result = -1;
+	}
+	if( *file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Measures the latency of opening a volume and of enumerating its partitions
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_open_latency(
+     const system_character_t *filename,
+     uint32_t bytes_per_sector,
+     vsmbr_bench_storage_t *storage,
+     int number_of_iterations,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libvsmbr_partition_t *partition  = NULL;
+	libvsmbr_volume_t *volume        = NULL;
+	int64_t *enumerate_samples       = NULL;
+	int64_t *open_samples            = NULL;
+	static char *function            = "vsmbr_bench_open_latency";
+	size64_t partition_size          = 0;
+	int64_t end_time                 = 0;
+	int64_t start_time               = 0;
+	int iteration                    = 0;
+	int number_of_partitions         = 0;
+	int partition_index              = 0;
+
+	if( number_of_iterations <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of iterations value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	open_samples = (int64_t *) memory_allocate(
+	                            sizeof( int64_t ) * number_of_iterations );
+
+	if( open_samples == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create open samples.",
+		 function );
+
+		goto on_error;
+	}
+	enumerate_samples = (int64_t *) memory_allocate(
+	                                 sizeof( int64_t ) * number_of_iterations );
+
+	if( enumerate_samples == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create enumerate samples.",
+		 function );
+
+		goto on_error;
+	}
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( vsmbr_bench_get_current_time(
+		     &start_time,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( vsmbr_bench_open_volume(
+		     &volume,
+		     &file_io_handle,
+		     filename,
+		     bytes_per_sector,
+		     storage,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( vsmbr_bench_get_current_time(
+		     &end_time,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		open_samples[ iteration ] = end_time - start_time;
+
+		start_time = end_time;
+
+		if( libvsmbr_volume_get_number_of_partitions(
+		     volume,
+		     &number_of_partitions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of partitions.",
+			 function );
+
+			goto on_error;
+		}
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			if( libvsmbr_volume_get_partition_by_index(
+			     volume,
+			     partition_index,
+			     &partition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve partition: %d.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+			if( libvsmbr_partition_get_size(
+			     partition,
+			     &partition_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve partition: %d size.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+			if( libvsmbr_partition_free(
+			     &partition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free partition: %d.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+		}
+		if( vsmbr_bench_get_current_time(
+		     &end_time,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		enumerate_samples[ iteration ] = end_time - start_time;
+
+		if( vsmbr_bench_close_volume(
+		     &volume,
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	vsmbr_bench_latency_fprint(
+	 stream,
+	 "open",
+	 open_samples,
+	 number_of_iterations );
+
+	vsmbr_bench_latency_fprint(
+	 stream,
+	 "enumerate",
+	 enumerate_samples,
+	 number_of_iterations );
+
+	memory_free(
+	 enumerate_samples );
+
+	memory_free(
+	 open_samples );
+
+	return( 1 );
+
+on_error:
+	if( partition != NULL )
+	{
+		libvsmbr_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		vsmbr_bench_close_volume(
+		 &volume,
+		 &file_io_handle,
+		 NULL );
+	}
+	if( enumerate_samples != NULL )
+	{
+		memory_free(
+		 enumerate_samples );
+	}
+	if( open_samples != NULL )
+	{
+		memory_free(
+		 open_samples );
+	}
+	return( -1 );
+}
+
+/* Reads the part of a partition that belongs to the thread using the read pattern
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_read_partition(
+     vsmbr_bench_read_context_t *read_context,
+     libvsmbr_partition_t *partition,
+     uint8_t *buffer,
+     uint64_t *random_value,
+     libcerror_error_t **error )
+{
+	static char *function      = "vsmbr_bench_read_partition";
+	size64_t partition_size    = 0;
+	size_t read_size           = 0;
+	ssize_t read_count         = 0;
+	uint64_t block_index       = 0;
+	uint64_t first_block_index = 0;
+	uint64_t last_block_index  = 0;
+	uint64_t number_of_blocks  = 0;
+	uint64_t read_index        = 0;
+	uint64_t stride_phase      = 0;
+	off64_t read_offset        = 0;
+
+	if( libvsmbr_partition_get_size(
+	     partition,
+	     &partition_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every thread reads a contiguous range of buffer sized blocks of the partition
+	 */
+	number_of_blocks = ( partition_size + read_context->buffer_size - 1 ) / read_context->buffer_size;
+
+	first_block_index = ( number_of_blocks * read_context->thread_index ) / read_context->number_of_threads;
+	last_block_index  = ( number_of_blocks * ( read_context->thread_index + 1 ) ) / read_context->number_of_threads;
+
+	for( read_index = first_block_index;
+	     read_index < last_block_index;
+	     read_index++ )
+	{
+		switch( read_context->pattern )
+		{
+			case VSMBR_BENCH_PATTERN_RANDOM:
+				*random_value ^= *random_value << 13;
+				*random_value ^= *random_value >> 7;
+				*random_value ^= *random_value << 17;
+
+				block_index = first_block_index + ( *random_value % ( last_block_index - first_block_index ) );
+				break;
+
+			case VSMBR_BENCH_PATTERN_STRIDED:
+				/* Every pass reads every VSMBR_BENCH_STRIDE-th block, the next pass
+				 * starts 1 block further so that all the blocks are read once
+				 */
+				if( read_index == first_block_index )
+				{
+					block_index  = first_block_index;
+					stride_phase = 0;
+				}
+				else
+				{
+					block_index += VSMBR_BENCH_STRIDE;
+
+					if( block_index >= last_block_index )
+					{
+						stride_phase++;
+
+						block_index = first_block_index + stride_phase;
+					}
+				}
+				break;
+
+			case VSMBR_BENCH_PATTERN_SEQUENTIAL:
+			default:
+				block_index = read_index;
+				break;
+		}
+		read_offset = (off64_t) ( block_index * read_context->buffer_size );
+		read_size   = read_context->buffer_size;
+
+		if( (size64_t) read_size > ( partition_size - read_offset ) )
+		{
+			read_size = (size_t) ( partition_size - read_offset );
+		}
+		read_count = libvsmbr_partition_read_buffer_at_offset(
+		              partition,
+		              buffer,
+		              read_size,
+		              read_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 ".",
+			 function,
+			 read_offset );
+
+			return( -1 );
+		}
+		read_context->number_of_reads      += 1;
+		read_context->number_of_bytes_read += read_size;
+	}
+	return( 1 );
+}
+
+/* Reads the part of every partition that belongs to the thread
+ * This function is the start function of the reading threads
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_read_thread(
+     void *arguments )
+{
+	libvsmbr_partition_t *partition          = NULL;
+	vsmbr_bench_read_context_t *read_context = NULL;
+	uint8_t *buffer                          = NULL;
+	static char *function                    = "vsmbr_bench_read_thread";
+	uint64_t random_value                    = 0;
+	int partition_index                      = 0;
+
+	read_context = (vsmbr_bench_read_context_t *) arguments;
+
+	if( read_context == NULL )
+	{
+		return( -1 );
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * read_context->buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 &( read_context->error ),
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	random_value = ( (uint64_t) read_context->thread_index + 1 ) * 0x9e3779b97f4a7c15ULL;
+
+	for( partition_index = 0;
+	     partition_index < read_context->number_of_partitions;
+	     partition_index++ )
+	{
+		/* Every thread uses its own partition so that reads of different
+		 * threads are not serialized by the partition
+		 */
+		if( libvsmbr_volume_get_partition_by_index(
+		     read_context->volume,
+		     partition_index,
+		     &partition,
+		     &( read_context->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( read_context->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		if( vsmbr_bench_read_partition(
+		     read_context,
+		     partition,
+		     buffer,
+		     &random_value,
+		     &( read_context->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( read_context->error ),
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		if( libvsmbr_partition_free(
+		     &partition,
+		     &( read_context->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( read_context->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( partition != NULL )
+	{
+		libvsmbr_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+/* Measures the read throughput of a read pattern
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_read_throughput(
+     libvsmbr_volume_t *volume,
+     int pattern,
+     size_t buffer_size,
+     int number_of_threads,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	vsmbr_bench_read_context_t read_contexts[ VSMBR_BENCH_MAXIMUM_NUMBER_OF_THREADS ];
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_t *threads[ VSMBR_BENCH_MAXIMUM_NUMBER_OF_THREADS ];
+#endif
+
+	const char *pattern_string    = NULL;
+	static char *function         = "vsmbr_bench_read_throughput";
+	uint64_t number_of_bytes_read = 0;
+	uint64_t number_of_reads      = 0;
+	int64_t elapsed_time          = 0;
+	int64_t end_time              = 0;
+	int64_t start_time            = 0;
+	int number_of_partitions      = 0;
+	int result                    = 1;
+	int thread_index              = 0;
+
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > VSMBR_BENCH_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: multi-threading not supported.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	switch( pattern )
+	{
+		case VSMBR_BENCH_PATTERN_RANDOM:
+			pattern_string = "random";
+			break;
+
+		case VSMBR_BENCH_PATTERN_SEQUENTIAL:
+			pattern_string = "sequential";
+			break;
+
+		case VSMBR_BENCH_PATTERN_STRIDED:
+			pattern_string = "strided";
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported pattern.",
+			 function );
+
+			return( -1 );
+	}
+	if( libvsmbr_volume_get_number_of_partitions(
+	     volume,
+	     &number_of_partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of partitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     read_contexts,
+	     0,
+	     sizeof( vsmbr_bench_read_context_t ) * VSMBR_BENCH_MAXIMUM_NUMBER_OF_THREADS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read contexts.",
+		 function );
+
+		return( -1 );
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		read_contexts[ thread_index ].volume               = volume;
+		read_contexts[ thread_index ].number_of_partitions = number_of_partitions;
+		read_contexts[ thread_index ].pattern              = pattern;
+		read_contexts[ thread_index ].buffer_size          = buffer_size;
+		read_contexts[ thread_index ].thread_index         = thread_index;
+		read_contexts[ thread_index ].number_of_threads    = number_of_threads;
+	}
+	if( vsmbr_bench_get_current_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			threads[ thread_index ] = NULL;
+
+			if( libcthreads_thread_create(
+			     &( threads[ thread_index ] ),
+			     NULL,
+			     &vsmbr_bench_read_thread,
+			     (void *) &( read_contexts[ thread_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread: %d.",
+				 function,
+				 thread_index );
+
+				result = -1;
+
+				break;
+			}
+		}
+		number_of_threads = thread_index;
+
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( libcthreads_thread_join(
+			     &( threads[ thread_index ] ),
+			     NULL ) != 1 )
+			{
+				result = -1;
+			}
+		}
+	}
+	else
+#endif
+	{
+		vsmbr_bench_read_thread(
+		 (void *) &( read_contexts[ 0 ] ) );
+	}
+	if( vsmbr_bench_get_current_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		result = -1;
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( read_contexts[ thread_index ].error != NULL )
+		{
+			if( ( result == 1 )
+			 && ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error = read_contexts[ thread_index ].error;
+			}
+			else
+			{
+				libcerror_error_free(
+				 &( read_contexts[ thread_index ].error ) );
+			}
+			read_contexts[ thread_index ].error = NULL;
+
+			result = -1;
+		}
+		number_of_reads      += read_contexts[ thread_index ].number_of_reads;
+		number_of_bytes_read += read_contexts[ thread_index ].number_of_bytes_read;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read partitions.",
+		 function );
+
+		return( -1 );
+	}
+	elapsed_time = end_time - start_time;
+
+	if( elapsed_time <= 0 )
+	{
+		elapsed_time = 1;
+	}
+	fprintf(
+	 stream,
+	 "{\"benchmark\": \"read\", \"pattern\": \"%s\", \"buffer_size\": %" PRIzd ", \"threads\": %d, \"reads\": %" PRIu64 ", \"bytes\": %" PRIu64 ", \"microseconds\": %" PRIi64 ", \"bytes_per_second\": %" PRIu64 "}\n",
+	 pattern_string,
+	 buffer_size,
+	 number_of_threads,
+	 number_of_reads,
+	 number_of_bytes_read,
+	 elapsed_time,
+	 (uint64_t) ( ( (double) number_of_bytes_read * 1000000.0 ) / (double) elapsed_time ) );
+
+	return( 1 );
+}
+
+/* Replays a trace
+ * The requests are simulated for every combination of block size, number of
+ * cache entries and read ahead and, if a source is provided, replayed against
+ * the source
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_replay_trace(
+     const system_character_t *trace_filename,
+     const system_character_t *source,
+     uint32_t bytes_per_sector,
+     vsmbr_bench_storage_t *storage,
+     const uint64_t *block_sizes,
+     int number_of_block_sizes,
+     const uint64_t *cache_sizes,
+     int number_of_cache_sizes,
+     const uint64_t *read_aheads,
+     int number_of_read_aheads,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libvsmbr_volume_t *volume        = NULL;
+	vsmbr_bench_replay_t *replay     = NULL;
+	static char *function            = "vsmbr_bench_replay_trace";
+	int64_t end_time                 = 0;
+	int64_t start_time               = 0;
+	int block_size_index             = 0;
+	int cache_size_index             = 0;
+	int read_ahead_index             = 0;
+
+	if( vsmbr_bench_replay_initialize(
+	     &replay,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create replay.",
+		 function );
+
+		goto on_error;
+	}
+	if( vsmbr_bench_replay_read_file(
+	     replay,
+	     trace_filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read trace: %" PRIs_SYSTEM ".",
+		 function,
+		 trace_filename );
+
+		goto on_error;
+	}
+	if( vsmbr_bench_replay_fprint(
+	     replay,
+	     stream,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( block_size_index = 0;
+	     block_size_index < number_of_block_sizes;
+	     block_size_index++ )
+	{
+		for( cache_size_index = 0;
+		     cache_size_index < number_of_cache_sizes;
+		     cache_size_index++ )
+		{
+			for( read_ahead_index = 0;
+			     read_ahead_index < number_of_read_aheads;
+			     read_ahead_index++ )
+			{
+				if( ( block_sizes[ block_size_index ] > (uint64_t) UINT32_MAX )
+				 || ( cache_sizes[ cache_size_index ] > (uint64_t) INT32_MAX )
+				 || ( read_aheads[ read_ahead_index ] > (uint64_t) INT32_MAX ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid replay configuration value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
+				if( vsmbr_bench_replay_simulate(
+				     replay,
+				     (uint32_t) block_sizes[ block_size_index ],
+				     (int) cache_sizes[ cache_size_index ],
+				     (int) read_aheads[ read_ahead_index ],
+				     stream,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to simulate replay.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+	}
+	if( source != NULL )
+	{
+		if( bytes_per_sector == 0 )
+		{
+			bytes_per_sector = replay->bytes_per_sector;
+		}
+		if( vsmbr_bench_open_volume(
+		     &volume,
+		     &file_io_handle,
+		     source,
+		     bytes_per_sector,
+		     storage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open: %" PRIs_SYSTEM ".",
+			 function,
+			 source );
+
+			goto on_error;
+		}
+		if( vsmbr_bench_get_current_time(
+		     &start_time,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( vsmbr_bench_replay_run(
+		     replay,
+		     volume,
+		     stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to replay trace.",
+			 function );
+
+			goto on_error;
+		}
+		if( vsmbr_bench_get_current_time(
+		     &end_time,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		fprintf(
+		 stream,
+		 "{\"replay\": \"duration\", \"microseconds\": %" PRIi64 "}\n",
+		 end_time - start_time );
+
+		if( vsmbr_bench_close_volume(
+		     &volume,
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( vsmbr_bench_replay_free(
+	     &replay,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free replay.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( volume != NULL )
+	{
+		vsmbr_bench_close_volume(
+		 &volume,
+		 &file_io_handle,
+		 NULL );
+	}
+	if( replay != NULL )
+	{
+		vsmbr_bench_replay_free(
+		 &replay,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Removes a file
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_remove_file(
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "vsmbr_bench_remove_file";
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( _wremove(
+	     filename ) != 0 )
+#else
+	if( remove(
+	     filename ) != 0 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+		 "%s: unable to remove: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	uint64_t block_sizes[ VSMBR_BENCH_MAXIMUM_NUMBER_OF_REPLAY_VALUES ];
+	uint64_t cache_sizes[ VSMBR_BENCH_MAXIMUM_NUMBER_OF_REPLAY_VALUES ];
+	uint64_t read_aheads[ VSMBR_BENCH_MAXIMUM_NUMBER_OF_REPLAY_VALUES ];
+
+	vsmbr_bench_storage_t storage;
+
+	libbfio_handle_t *file_io_handle         = NULL;
+	libcerror_error_t *error                 = NULL;
+	libvsmbr_volume_t *volume                = NULL;
+	system_character_t *option_pattern       = NULL;
+	system_character_t *replay_filename      = NULL;
+	system_character_t *source               = NULL;
+	system_character_t *trace_filename       = NULL;
+	vsmbr_bench_image_t *image               = NULL;
+	const system_character_t *image_filename = VSMBR_BENCH_DEFAULT_IMAGE_NAME;
+	size_t buffer_size                       = 65536;
+	system_integer_t option                  = 0;
+	uint64_t value_64bit                     = 0;
+	uint64_t partition_size                  = 4 * 1024 * 1024;
+	uint32_t bytes_per_sector                = 0;
+	int64_t end_time                         = 0;
+	int64_t start_time                       = 0;
+	int expected_number_of_partitions        = 0;
+	int image_generated                      = 0;
+	int keep_image                           = 0;
+	int number_of_block_sizes                = 0;
+	int number_of_cache_sizes                = 0;
+	int number_of_iterations                 = 100;
+	int number_of_logical_partitions         = 8;
+	int number_of_partitions                 = 0;
+	int number_of_read_aheads                = 0;
+	int number_of_threads                    = 1;
+	int pattern                              = 0;
+	int patterns                             = VSMBR_BENCH_PATTERN_ALL;
+	int result                               = 0;
+
+	if( memory_set(
+	     &storage,
+	     0,
+	     sizeof( vsmbr_bench_storage_t ) ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to clear storage.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	while( ( option = vsmbr_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "A:b:B:C:e:hi:J:kL:o:p:R:s:S:t:T:W:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				vsmbr_bench_usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'A':
+			case (system_integer_t) 'C':
+			case (system_integer_t) 'S':
+				if( option == (system_integer_t) 'A' )
+				{
+					result = vsmbr_bench_copy_sizes_from_string(
+					          optarg,
+					          read_aheads,
+					          VSMBR_BENCH_MAXIMUM_NUMBER_OF_REPLAY_VALUES,
+					          &number_of_read_aheads,
+					          &error );
+				}
+				else if( option == (system_integer_t) 'C' )
+				{
+					result = vsmbr_bench_copy_sizes_from_string(
+					          optarg,
+					          cache_sizes,
+					          VSMBR_BENCH_MAXIMUM_NUMBER_OF_REPLAY_VALUES,
+					          &number_of_cache_sizes,
+					          &error );
+				}
+				else
+				{
+					result = vsmbr_bench_copy_sizes_from_string(
+					          optarg,
+					          block_sizes,
+					          VSMBR_BENCH_MAXIMUM_NUMBER_OF_REPLAY_VALUES,
+					          &number_of_block_sizes,
+					          &error );
+				}
+				if( result != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported value: %" PRIs_SYSTEM " for option: -%c.\n",
+					 optarg,
+					 (char) option );
+
+					goto on_error;
+				}
+				break;
+
+			case (system_integer_t) 'b':
+			case (system_integer_t) 'B':
+			case (system_integer_t) 'e':
+			case (system_integer_t) 'i':
+			case (system_integer_t) 'J':
+			case (system_integer_t) 'L':
+			case (system_integer_t) 's':
+			case (system_integer_t) 't':
+			case (system_integer_t) 'W':
+				if( vsmbr_bench_copy_size_from_string(
+				     optarg,
+				     &value_64bit,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported value: %" PRIs_SYSTEM " for option: -%c.\n",
+					 optarg,
+					 (char) option );
+
+					goto on_error;
+				}
+				if( option == (system_integer_t) 'b' )
+				{
+					if( value_64bit > (uint64_t) UINT32_MAX )
+					{
+						value_64bit = 0;
+					}
+					bytes_per_sector = (uint32_t) value_64bit;
+				}
+				else if( option == (system_integer_t) 'B' )
+				{
+					if( value_64bit > (uint64_t) ( 64 * 1024 * 1024 ) )
+					{
+						value_64bit = 0;
+					}
+					buffer_size = (size_t) value_64bit;
+				}
+				else if( ( option == (system_integer_t) 'J' )
+				      || ( option == (system_integer_t) 'L' ) )
+				{
+					if( value_64bit > ( (uint64_t) UINT64_MAX / 1000 ) )
+					{
+						fprintf(
+						 stderr,
+						 "Unsupported value: %" PRIs_SYSTEM " for option: -%c.\n",
+						 optarg,
+						 (char) option );
+
+						goto on_error;
+					}
+					if( option == (system_integer_t) 'J' )
+					{
+						storage.jitter = value_64bit * 1000;
+					}
+					else
+					{
+						storage.latency = value_64bit * 1000;
+					}
+				}
+				else if( option == (system_integer_t) 's' )
+				{
+					partition_size = value_64bit;
+				}
+				else if( option == (system_integer_t) 'W' )
+				{
+					storage.bytes_per_second = value_64bit;
+				}
+				else
+				{
+					if( value_64bit > (uint64_t) INT32_MAX )
+					{
+						value_64bit = 0;
+					}
+					if( option == (system_integer_t) 'e' )
+					{
+						number_of_logical_partitions = (int) value_64bit;
+					}
+					else if( option == (system_integer_t) 'i' )
+					{
+						number_of_iterations = (int) value_64bit;
+					}
+					else
+					{
+						number_of_threads = (int) value_64bit;
+					}
+				}
+				break;
+
+			case (system_integer_t) 'h':
+				vsmbr_bench_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'k':
+				keep_image = 1;
+
+				break;
+
+			case (system_integer_t) 'o':
+				image_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 'p':
+				option_pattern = optarg;
+
+				break;
+
+			case (system_integer_t) 'R':
+				replay_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 'T':
+				trace_filename = optarg;
+
+				break;
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	if( option_pattern != NULL )
+	{
+		if( system_string_compare(
+		     option_pattern,
+		     _SYSTEM_STRING( "all" ),
+		     4 ) == 0 )
+		{
+			patterns = VSMBR_BENCH_PATTERN_ALL;
+		}
+		else if( system_string_compare(
+		          option_pattern,
+		          _SYSTEM_STRING( "random" ),
+		          7 ) == 0 )
+		{
+			patterns = VSMBR_BENCH_PATTERN_RANDOM;
+		}
+		else if( system_string_compare(
+		          option_pattern,
+		          _SYSTEM_STRING( "sequential" ),
+		          11 ) == 0 )
+		{
+			patterns = VSMBR_BENCH_PATTERN_SEQUENTIAL;
+		}
+		else if( system_string_compare(
+		          option_pattern,
+		          _SYSTEM_STRING( "strided" ),
+		          8 ) == 0 )
+		{
+			patterns = VSMBR_BENCH_PATTERN_STRIDED;
+		}
+		else
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported pattern: %" PRIs_SYSTEM ".\n",
+			 option_pattern );
+
+			goto on_error;
+		}
+	}
+	if( buffer_size == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported buffer size.\n" );
+
+		goto on_error;
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > VSMBR_BENCH_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported number of threads.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "{\"benchmark\": \"version\", \"libvsmbr\": \"%s\"}\n",
+	 libvsmbr_get_version() );
+
+	if( ( storage.latency != 0 )
+	 || ( storage.jitter != 0 )
+	 || ( storage.bytes_per_second != 0 ) )
+	{
+		fprintf(
+		 stdout,
+		 "{\"benchmark\": \"storage\", \"latency_nanoseconds\": %" PRIu64 ", \"jitter_nanoseconds\": %" PRIu64 ", \"bytes_per_second\": %" PRIu64 "}\n",
+		 storage.latency,
+		 storage.jitter,
+		 storage.bytes_per_second );
+	}
+
+	if( replay_filename != NULL )
+	{
+		if( number_of_block_sizes == 0 )
+		{
+			block_sizes[ 0 ]      = 512;
+			block_sizes[ 1 ]      = 4096;
+			block_sizes[ 2 ]      = 65536;
+			number_of_block_sizes = 3;
+		}
+		/* The smallest number of cache entries matches the sector cache
+		 * of a partition of the library
+		 */
+		if( number_of_cache_sizes == 0 )
+		{
+			cache_sizes[ 0 ]      = 16;
+			cache_sizes[ 1 ]      = 256;
+			cache_sizes[ 2 ]      = 4096;
+			number_of_cache_sizes = 3;
+		}
+		if( number_of_read_aheads == 0 )
+		{
+			read_aheads[ 0 ]      = 0;
+			read_aheads[ 1 ]      = 1;
+			read_aheads[ 2 ]      = 8;
+			number_of_read_aheads = 3;
+		}
+		if( vsmbr_bench_replay_trace(
+		     replay_filename,
+		     source,
+		     bytes_per_sector,
+		     &storage,
+		     block_sizes,
+		     number_of_block_sizes,
+		     cache_sizes,
+		     number_of_cache_sizes,
+		     read_aheads,
+		     number_of_read_aheads,
+		     stdout,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to replay trace: %" PRIs_SYSTEM ".\n",
+			 replay_filename );
+
+			goto on_error;
+		}
+		return( EXIT_SUCCESS );
+	}
+	if( source == NULL )
+	{
+		if( bytes_per_sector == 0 )
+		{
+			bytes_per_sector = 512;
+		}
+		if( vsmbr_bench_image_initialize(
+		     &image,
+		     bytes_per_sector,
+		     number_of_logical_partitions,
+		     (size64_t) partition_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize image.\n" );
+
+			goto on_error;
+		}
+		if( vsmbr_bench_image_get_number_of_partitions(
+		     image,
+		     &expected_number_of_partitions,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve number of partitions of image.\n" );
+
+			goto on_error;
+		}
+		if( vsmbr_bench_get_current_time(
+		     &start_time,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		image_generated = 1;
+
+		if( vsmbr_bench_image_generate(
+		     image,
+		     image_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to generate image: %" PRIs_SYSTEM ".\n",
+			 image_filename );
+
+			goto on_error;
+		}
+		if( vsmbr_bench_get_current_time(
+		     &end_time,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		fprintf(
+		 stdout,
+		 "{\"benchmark\": \"generate\", \"bytes_per_sector\": %" PRIu32 ", \"partitions\": %d, \"partition_size\": %" PRIu64 ", \"image_size\": %" PRIu64 ", \"microseconds\": %" PRIi64 "}\n",
+		 bytes_per_sector,
+		 expected_number_of_partitions,
+		 partition_size,
+		 image->image_size,
+		 end_time - start_time );
+
+		source = (system_character_t *) image_filename;
+	}
+	if( vsmbr_bench_open_latency(
+	     source,
+	     bytes_per_sector,
+	     &storage,
+	     number_of_iterations,
+	     stdout,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to measure open latency of: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	if( vsmbr_bench_open_volume(
+	     &volume,
+	     &file_io_handle,
+	     source,
+	     bytes_per_sector,
+	     &storage,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	if( image != NULL )
+	{
+		if( libvsmbr_volume_get_number_of_partitions(
+		     volume,
+		     &number_of_partitions,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve number of partitions.\n" );
+
+			goto on_error;
+		}
+		if( number_of_partitions != expected_number_of_partitions )
+		{
+			fprintf(
+			 stderr,
+			 "Mismatch in number of partitions of generated image (%d != %d).\n",
+			 number_of_partitions,
+			 expected_number_of_partitions );
+
+			goto on_error;
+		}
+	}
+	if( trace_filename != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libvsmbr_volume_start_trace_wide(
+		          volume,
+		          trace_filename,
+		          &error );
+#else
+		result = libvsmbr_volume_start_trace(
+		          volume,
+		          trace_filename,
+		          &error );
+#endif
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to start trace: %" PRIs_SYSTEM ".\n",
+			 trace_filename );
+
+			goto on_error;
+		}
+	}
+	for( pattern = VSMBR_BENCH_PATTERN_SEQUENTIAL;
+	     pattern <= VSMBR_BENCH_PATTERN_STRIDED;
+	     pattern <<= 1 )
+	{
+		if( ( patterns & pattern ) == 0 )
+		{
+			continue;
+		}
+		if( vsmbr_bench_read_throughput(
+		     volume,
+		     pattern,
+		     buffer_size,
+		     number_of_threads,
+		     stdout,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to measure read throughput of: %" PRIs_SYSTEM ".\n",
+			 source );
+
+			goto on_error;
+		}
+	}
+	if( trace_filename != NULL )
+	{
+		if( libvsmbr_volume_stop_trace(
+		     volume,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to stop trace: %" PRIs_SYSTEM ".\n",
+			 trace_filename );
+
+			goto on_error;
+		}
+	}
+	if( vsmbr_bench_close_volume(
+	     &volume,
+	     &file_io_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	if( image != NULL )
+	{
+		if( keep_image == 0 )
+		{
+			if( vsmbr_bench_remove_file(
+			     image_filename,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to remove image: %" PRIs_SYSTEM ".\n",
+				 image_filename );
+
+				goto on_error;
+			}
+		}
+		image_generated = 0;
+
+		if( vsmbr_bench_image_free(
+		     &image,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free image.\n" );
+
+			goto on_error;
+		}
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		vsmbr_bench_close_volume(
+		 &volume,
+		 &file_io_handle,
+		 NULL );
+	}
+	if( ( image_generated != 0 )
+	 && ( keep_image == 0 ) )
+	{
+		vsmbr_bench_remove_file(
+		 image_filename,
+		 NULL );
+	}
+	if( image != NULL )
+	{
+		vsmbr_bench_image_free(
+		 &image,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,679 @@
+/*
+ * Synthetic image generator for the benchmark program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsmbr_bench_image.h"
+#include "vsmbr_test_libbfio.h"
+#include "vsmbr_test_libcerror.h"
+#include "vsmbr_test_libvsmbr.h"
+
+/* Creates an image
+ * Make sure the value image is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_image_initialize(
+     vsmbr_bench_image_t **image,
+     uint32_t bytes_per_sector,
+     int number_of_logical_partitions,
+     size64_t partition_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "vsmbr_bench_image_initialize";
+	uint64_t alignment_sectors = 0;
+	uint64_t extended_sectors  = 0;
+	uint64_t number_of_sectors = 0;
+	uint64_t partition_sectors = 0;
+
+	if( image == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image.",
+		 function );
+
+		return( -1 );
+	}
+	if( *image != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid image value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bytes_per_sector != 512 )
+	 && ( bytes_per_sector != 1024 )
+	 && ( bytes_per_sector != 2048 )
+	 && ( bytes_per_sector != 4096 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_logical_partitions < 0 )
+	 || ( number_of_logical_partitions > VSMBR_BENCH_IMAGE_MAXIMUM_NUMBER_OF_LOGICAL_PARTITIONS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of logical partitions value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( partition_size == 0 )
+	 || ( ( partition_size % bytes_per_sector ) != 0 )
+	 || ( ( partition_size / bytes_per_sector ) > (size64_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	partition_sectors = partition_size / bytes_per_sector;
+	alignment_sectors = VSMBR_BENCH_IMAGE_LOGICAL_PARTITION_ALIGNMENT / bytes_per_sector;
+
+	/* The primary partition is followed by the extended partition
+	 */
+	number_of_sectors  = VSMBR_BENCH_IMAGE_FIRST_PARTITION_OFFSET / bytes_per_sector;
+	number_of_sectors += partition_sectors;
+
+	extended_sectors = (uint64_t) number_of_logical_partitions * ( alignment_sectors + partition_sectors );
+
+	if( ( number_of_sectors + extended_sectors ) > (uint64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid image size value exceeds maximum number of sectors.",
+		 function );
+
+		return( -1 );
+	}
+	*image = memory_allocate_structure(
+	          vsmbr_bench_image_t );
+
+	if( *image == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create image.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *image,
+	     0,
+	     sizeof( vsmbr_bench_image_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear image.",
+		 function );
+
+		memory_free(
+		 *image );
+
+		*image = NULL;
+
+		return( -1 );
+	}
+	( *image )->bytes_per_sector             = bytes_per_sector;
+	( *image )->number_of_logical_partitions = number_of_logical_partitions;
+	( *image )->partition_size               = partition_size;
+	( *image )->image_size                   = ( number_of_sectors + extended_sectors ) * bytes_per_sector;
+
+	return( 1 );
+}
+
+/* Frees an image
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_image_free(
+     vsmbr_bench_image_t **image,
+     libcerror_error_t **error )
+{
+	static char *function = "vsmbr_bench_image_free";
+
+	if( image == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image.",
+		 function );
+
+		return( -1 );
+	}
+	if( *image != NULL )
+	{
+		memory_free(
+		 *image );
+
+		*image = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of partitions in the image
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_image_get_number_of_partitions(
+     vsmbr_bench_image_t *image,
+     int *number_of_partitions,
+     libcerror_error_t **error )
+{
+	static char *function = "vsmbr_bench_image_get_number_of_partitions";
+
+	if( image == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_partitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of partitions.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_partitions = 1 + image->number_of_logical_partitions;
+
+	return( 1 );
+}
+
+/* Writes the data of a partition
+ * The data is pseudo random so it cannot be compressed or skipped as sparse
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_image_write_partition_data(
+     vsmbr_bench_image_t *image,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     uint64_t seed,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "vsmbr_bench_image_write_partition_data";
+	size64_t remaining_size = 0;
+	size_t buffer_offset    = 0;
+	size_t write_size       = 0;
+	ssize_t write_count     = 0;
+	uint64_t random_value   = 0;
+
+	if( image == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( ( buffer_size % 8 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* A xorshift generator, the seed must not be 0
+	 */
+	random_value   = seed | 1;
+	remaining_size = image->partition_size;
+
+	while( remaining_size > 0 )
+	{
+		write_size = buffer_size;
+
+		if( (size64_t) write_size > remaining_size )
+		{
+			write_size = (size_t) remaining_size;
+		}
+		for( buffer_offset = 0;
+		     buffer_offset < write_size;
+		     buffer_offset += 8 )
+		{
+			random_value ^= random_value << 13;
+			random_value ^= random_value >> 7;
+			random_value ^= random_value << 17;
+
+			byte_stream_copy_from_uint64_little_endian(
+			 &( buffer[ buffer_offset ] ),
+			 random_value );
+		}
+		write_count = libbfio_handle_write_buffer_at_offset(
+		               file_io_handle,
+		               buffer,
+		               write_size,
+		               offset,
+		               error );
+
+		if( write_count != (ssize_t) write_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write partition data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		offset         += (off64_t) write_size;
+		remaining_size -= write_size;
+	}
+	return( 1 );
+}
+
+/* Generates the image
+ * The image consists of a Master Boot Record (MBR) with a primary partition
+ * and an extended partition that contains a chain of extended boot records (EBR)
+ * each with one logical partition
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_image_generate(
+     vsmbr_bench_image_t *image,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle        = NULL;
+	libvsmbr_image_builder_t *image_builder = NULL;
+	uint8_t *buffer                         = NULL;
+	static char *function                   = "vsmbr_bench_image_generate";
+	size_t buffer_size                      = 1024 * 1024;
+	size_t filename_length                  = 0;
+	uint32_t alignment_sectors              = 0;
+	uint32_t extended_boot_record_sector    = 0;
+	uint32_t logical_sectors                = 0;
+	uint32_t partition_sectors              = 0;
+	uint32_t primary_start_sector           = 0;
+	int partition_index                     = 0;
+	int result                              = 0;
+
+	if( image == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	partition_sectors    = (uint32_t) ( image->partition_size / image->bytes_per_sector );
+	alignment_sectors    = VSMBR_BENCH_IMAGE_LOGICAL_PARTITION_ALIGNMENT / image->bytes_per_sector;
+	primary_start_sector = VSMBR_BENCH_IMAGE_FIRST_PARTITION_OFFSET / image->bytes_per_sector;
+	logical_sectors      = alignment_sectors + partition_sectors;
+
+	if( libvsmbr_image_builder_initialize(
+	     &image_builder,
+	     image->bytes_per_sector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create image builder.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_image_builder_set_media_size(
+	     image_builder,
+	     image->image_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set media size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_image_builder_append_primary_partition(
+	     image_builder,
+	     0x83,
+	     primary_start_sector,
+	     partition_sectors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append primary partition.",
+		 function );
+
+		goto on_error;
+	}
+	/* The extended partition starts directly after the primary partition
+	 * and every logical partition is aligned after its extended boot record
+	 */
+	extended_boot_record_sector = primary_start_sector + partition_sectors;
+
+	for( partition_index = 0;
+	     partition_index < image->number_of_logical_partitions;
+	     partition_index++ )
+	{
+		if( libvsmbr_image_builder_append_logical_partition(
+		     image_builder,
+		     extended_boot_record_sector,
+		     0x83,
+		     extended_boot_record_sector + alignment_sectors,
+		     partition_sectors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append logical partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		extended_boot_record_sector += logical_sectors;
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          filename,
+	          filename_length + 1,
+	          error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          filename,
+	          filename_length + 1,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libvsmbr_image_builder_write_file_io_handle(
+	     image_builder,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write partition table.",
+		 function );
+
+		goto on_error;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( vsmbr_bench_image_write_partition_data(
+	     image,
+	     file_io_handle,
+	     (off64_t) primary_start_sector * image->bytes_per_sector,
+	     1,
+	     buffer,
+	     buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write primary partition data.",
+		 function );
+
+		goto on_error;
+	}
+	extended_boot_record_sector = primary_start_sector + partition_sectors;
+
+	for( partition_index = 0;
+	     partition_index < image->number_of_logical_partitions;
+	     partition_index++ )
+	{
+		if( vsmbr_bench_image_write_partition_data(
+		     image,
+		     file_io_handle,
+		     (off64_t) ( extended_boot_record_sector + alignment_sectors ) * image->bytes_per_sector,
+		     (uint64_t) partition_index + 2,
+		     buffer,
+		     buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write logical partition: %d data.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		extended_boot_record_sector += logical_sectors;
+	}
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_image_builder_free(
+	     &image_builder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free image builder.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( image_builder != NULL )
+	{
+		libvsmbr_image_builder_free(
+		 &image_builder,
+		 NULL );
+	}
+	return( -1 );
+}
@@ -0,0 +1,106 @@
+/*
+ * Synthetic image generator for the benchmark program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _VSMBR_BENCH_IMAGE_H )
+#define _VSMBR_BENCH_IMAGE_H
+
+#include <common.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "vsmbr_test_libbfio.h"
+#include "vsmbr_test_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The offset of the first partition, as used by fdisk
+ */
+#define VSMBR_BENCH_IMAGE_FIRST_PARTITION_OFFSET	( 1024 * 1024 )
+
+/* The distance between an extended boot record and its logical partition
+ */
+#define VSMBR_BENCH_IMAGE_LOGICAL_PARTITION_ALIGNMENT	4096
+
+/* The maximum number of logical partitions, the library follows at most
+ * 256 extended boot records
+ */
+#define VSMBR_BENCH_IMAGE_MAXIMUM_NUMBER_OF_LOGICAL_PARTITIONS	255
+
+typedef struct vsmbr_bench_image vsmbr_bench_image_t;
+
+struct vsmbr_bench_image
+{
+	/* The number of bytes per sector
+	 */
+	uint32_t bytes_per_sector;
+
+	/* The number of logical partitions, which is the length of
+	 * the extended boot record (EBR) chain
+	 */
+	int number_of_logical_partitions;
+
+	/* The size of every partition
+	 */
+	size64_t partition_size;
+
+	/* The image size
+	 */
+	size64_t image_size;
+};
+
+int vsmbr_bench_image_initialize(
+     vsmbr_bench_image_t **image,
+     uint32_t bytes_per_sector,
+     int number_of_logical_partitions,
+     size64_t partition_size,
+     libcerror_error_t **error );
+
+int vsmbr_bench_image_free(
+     vsmbr_bench_image_t **image,
+     libcerror_error_t **error );
+
+int vsmbr_bench_image_get_number_of_partitions(
+     vsmbr_bench_image_t *image,
+     int *number_of_partitions,
+     libcerror_error_t **error );
+
+int vsmbr_bench_image_write_partition_data(
+     vsmbr_bench_image_t *image,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     uint64_t seed,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int vsmbr_bench_image_generate(
+     vsmbr_bench_image_t *image,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _VSMBR_BENCH_IMAGE_H ) */
+
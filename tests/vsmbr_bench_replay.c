@@ -0,0 +1,1235 @@
+/*
+ * Trace replay functions for the benchmark program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsmbr_bench_replay.h"
+#include "vsmbr_test_libcerror.h"
+#include "vsmbr_test_libvsmbr.h"
+
+/* Creates a replay
+ * Make sure the value replay is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_replay_initialize(
+     vsmbr_bench_replay_t **replay,
+     libcerror_error_t **error )
+{
+	static char *function = "vsmbr_bench_replay_initialize";
+
+	if( replay == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid replay.",
+		 function );
+
+		return( -1 );
+	}
+	if( *replay != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid replay value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*replay = memory_allocate_structure(
+	           vsmbr_bench_replay_t );
+
+	if( *replay == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create replay.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *replay,
+	     0,
+	     sizeof( vsmbr_bench_replay_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear replay.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *replay != NULL )
+	{
+		memory_free(
+		 *replay );
+
+		*replay = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a replay
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_replay_free(
+     vsmbr_bench_replay_t **replay,
+     libcerror_error_t **error )
+{
+	static char *function = "vsmbr_bench_replay_free";
+
+	if( replay == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid replay.",
+		 function );
+
+		return( -1 );
+	}
+	if( *replay != NULL )
+	{
+		if( ( *replay )->records != NULL )
+		{
+			memory_free(
+			 ( *replay )->records );
+		}
+		memory_free(
+		 *replay );
+
+		*replay = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the records of a trace file
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_replay_read_file(
+     vsmbr_bench_replay_t *replay,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	uint8_t file_header_data[ VSMBR_BENCH_REPLAY_FILE_HEADER_SIZE ];
+	uint8_t record_data[ VSMBR_BENCH_REPLAY_RECORD_SIZE ];
+
+	vsmbr_bench_replay_record_t *record      = NULL;
+	vsmbr_bench_replay_record_t *new_records = NULL;
+	FILE *stream                             = NULL;
+	static char *function                    = "vsmbr_bench_replay_read_file";
+	size_t read_count                        = 0;
+	uint32_t format_version                  = 0;
+	uint32_t record_size                     = 0;
+	int maximum_number_of_records            = 0;
+
+	if( replay == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid replay.",
+		 function );
+
+		return( -1 );
+	}
+	if( replay->records != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid replay - records value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          L"rb" );
+#else
+	stream = file_stream_open(
+	          filename,
+	          "rb" );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	read_count = file_stream_read(
+	              stream,
+	              file_header_data,
+	              VSMBR_BENCH_REPLAY_FILE_HEADER_SIZE );
+
+	if( read_count != VSMBR_BENCH_REPLAY_FILE_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_compare(
+	     file_header_data,
+	     "VSMBRTRC",
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( file_header_data[ 8 ] ),
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( file_header_data[ 12 ] ),
+	 record_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( file_header_data[ 16 ] ),
+	 replay->bytes_per_sector );
+
+	if( ( format_version != 1 )
+	 || ( record_size != VSMBR_BENCH_REPLAY_RECORD_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		goto on_error;
+	}
+	while( file_stream_read(
+	        stream,
+	        record_data,
+	        VSMBR_BENCH_REPLAY_RECORD_SIZE ) == VSMBR_BENCH_REPLAY_RECORD_SIZE )
+	{
+		if( replay->number_of_records >= maximum_number_of_records )
+		{
+			if( maximum_number_of_records == 0 )
+			{
+				maximum_number_of_records = 4096;
+			}
+			else if( maximum_number_of_records <= ( INT32_MAX / 2 ) )
+			{
+				maximum_number_of_records *= 2;
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of records value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			new_records = (vsmbr_bench_replay_record_t *) memory_reallocate(
+			                                               replay->records,
+			                                               sizeof( vsmbr_bench_replay_record_t ) * maximum_number_of_records );
+
+			if( new_records == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize records.",
+				 function );
+
+				goto on_error;
+			}
+			replay->records = new_records;
+		}
+		record = &( replay->records[ replay->number_of_records ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( record_data[ 0 ] ),
+		 record->timestamp );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( record_data[ 8 ] ),
+		 record->offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( record_data[ 16 ] ),
+		 record->size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( record_data[ 20 ] ),
+		 record->thread_identifier );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( record_data[ 24 ] ),
+		 record->partition_index );
+
+		record->record_type = record_data[ 28 ];
+
+		/* A partially written trace is padded with empty records
+		 */
+		if( record->record_type == 0 )
+		{
+			break;
+		}
+		if( record->record_type == LIBVSMBR_TRACE_RECORD_TYPE_REQUEST )
+		{
+			replay->number_of_requests += 1;
+			replay->bytes_requested    += record->size;
+
+			if( record->size > replay->maximum_request_size )
+			{
+				replay->maximum_request_size = record->size;
+			}
+		}
+		else if( record->record_type == LIBVSMBR_TRACE_RECORD_TYPE_BACKING_READ )
+		{
+			replay->number_of_backing_reads += 1;
+			replay->backing_bytes_read      += record->size;
+		}
+		replay->number_of_records += 1;
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		stream = NULL;
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( replay->records != NULL )
+	{
+		memory_free(
+		 replay->records );
+
+		replay->records = NULL;
+	}
+	replay->number_of_records = 0;
+
+	return( -1 );
+}
+
+/* Prints a summary of the trace
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_replay_fprint(
+     vsmbr_bench_replay_t *replay,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "vsmbr_bench_replay_fprint";
+	uint64_t duration     = 0;
+
+	if( replay == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid replay.",
+		 function );
+
+		return( -1 );
+	}
+	if( replay->number_of_records > 0 )
+	{
+		duration = replay->records[ replay->number_of_records - 1 ].timestamp;
+	}
+	fprintf(
+	 stream,
+	 "{\"replay\": \"trace\", \"bytes_per_sector\": %" PRIu32 ", \"records\": %d, \"requests\": %d, \"bytes_requested\": %" PRIu64 ", \"backing_reads\": %d, \"backing_bytes_read\": %" PRIu64 ", \"nanoseconds\": %" PRIu64 "}\n",
+	 replay->bytes_per_sector,
+	 replay->number_of_records,
+	 replay->number_of_requests,
+	 replay->bytes_requested,
+	 replay->number_of_backing_reads,
+	 replay->backing_bytes_read,
+	 duration );
+
+	return( 1 );
+}
+
+/* Retrieves the values of the statistics of a volume
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_replay_get_statistics_values(
+     libvsmbr_volume_t *volume,
+     uint64_t *values,
+     libcerror_error_t **error )
+{
+	libvsmbr_statistics_t *statistics = NULL;
+	static char *function             = "vsmbr_bench_replay_get_statistics_values";
+	int result                        = 1;
+
+	if( libvsmbr_volume_get_statistics(
+	     volume,
+	     &statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( libvsmbr_statistics_get_number_of_backing_reads(
+	       statistics,
+	       &( values[ 0 ] ),
+	       error ) != 1 )
+	 || ( libvsmbr_statistics_get_backing_bytes_read(
+	       statistics,
+	       &( values[ 1 ] ),
+	       error ) != 1 )
+	 || ( libvsmbr_statistics_get_bytes_delivered(
+	       statistics,
+	       &( values[ 2 ] ),
+	       error ) != 1 )
+	 || ( libvsmbr_statistics_get_number_of_cache_hits(
+	       statistics,
+	       &( values[ 3 ] ),
+	       error ) != 1 )
+	 || ( libvsmbr_statistics_get_number_of_cache_misses(
+	       statistics,
+	       &( values[ 4 ] ),
+	       error ) != 1 )
+	 || ( libvsmbr_statistics_get_number_of_cache_evictions(
+	       statistics,
+	       &( values[ 5 ] ),
+	       error ) != 1 )
+	 || ( libvsmbr_statistics_get_io_wait_time(
+	       statistics,
+	       &( values[ 6 ] ),
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics value.",
+		 function );
+
+		result = -1;
+	}
+	if( libvsmbr_statistics_free(
+	     &statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free statistics.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Replays the requests of the trace against a volume and prints
+ * the resulting statistics of the library
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_replay_run(
+     vsmbr_bench_replay_t *replay,
+     libvsmbr_volume_t *volume,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	uint64_t end_values[ 7 ];
+	uint64_t start_values[ 7 ];
+
+	libvsmbr_partition_t **partitions   = NULL;
+	vsmbr_bench_replay_record_t *record = NULL;
+	uint8_t *buffer                     = NULL;
+	static char *function               = "vsmbr_bench_replay_run";
+	ssize_t read_count                  = 0;
+	int number_of_partitions            = 0;
+	int number_of_skipped_requests      = 0;
+	int partition_index                 = 0;
+	int record_index                    = 0;
+
+	if( replay == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid replay.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_volume_get_number_of_partitions(
+	     volume,
+	     &number_of_partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of partitions.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_partitions > 0 )
+	{
+		partitions = (libvsmbr_partition_t **) memory_allocate(
+		                                        sizeof( libvsmbr_partition_t * ) * number_of_partitions );
+
+		if( partitions == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create partitions.",
+			 function );
+
+			goto on_error;
+		}
+		memory_set(
+		 partitions,
+		 0,
+		 sizeof( libvsmbr_partition_t * ) * number_of_partitions );
+	}
+	if( replay->maximum_request_size > 0 )
+	{
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * replay->maximum_request_size );
+
+		if( buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( vsmbr_bench_replay_get_statistics_values(
+	     volume,
+	     start_values,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( record_index = 0;
+	     record_index < replay->number_of_records;
+	     record_index++ )
+	{
+		record = &( replay->records[ record_index ] );
+
+		if( record->record_type != LIBVSMBR_TRACE_RECORD_TYPE_REQUEST )
+		{
+			continue;
+		}
+		/* Requests of partitions that the volume does not contain
+		 * are not replayed
+		 */
+		if( record->partition_index >= (uint32_t) number_of_partitions )
+		{
+			number_of_skipped_requests++;
+
+			continue;
+		}
+		partition_index = (int) record->partition_index;
+
+		if( partitions[ partition_index ] == NULL )
+		{
+			if( libvsmbr_volume_get_partition_by_index(
+			     volume,
+			     partition_index,
+			     &( partitions[ partition_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve partition: %d.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+		}
+		read_count = libvsmbr_partition_read_buffer_at_offset(
+		              partitions[ partition_index ],
+		              buffer,
+		              (size_t) record->size,
+		              (off64_t) record->offset,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read partition: %d at offset: %" PRIu64 ".",
+			 function,
+			 partition_index,
+			 record->offset );
+
+			goto on_error;
+		}
+	}
+	if( vsmbr_bench_replay_get_statistics_values(
+	     volume,
+	     end_values,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	fprintf(
+	 stream,
+	 "{\"replay\": \"library\", \"requests\": %d, \"skipped_requests\": %d, \"bytes_delivered\": %" PRIu64 ", \"backing_reads\": %" PRIu64 ", \"backing_bytes_read\": %" PRIu64 ", \"cache_hits\": %" PRIu64 ", \"cache_misses\": %" PRIu64 ", \"cache_evictions\": %" PRIu64 ", \"io_wait_nanoseconds\": %" PRIu64 "}\n",
+	 replay->number_of_requests - number_of_skipped_requests,
+	 number_of_skipped_requests,
+	 end_values[ 2 ] - start_values[ 2 ],
+	 end_values[ 0 ] - start_values[ 0 ],
+	 end_values[ 1 ] - start_values[ 1 ],
+	 end_values[ 3 ] - start_values[ 3 ],
+	 end_values[ 4 ] - start_values[ 4 ],
+	 end_values[ 5 ] - start_values[ 5 ],
+	 end_values[ 6 ] - start_values[ 6 ] );
+
+	for( partition_index = 0;
+	     partition_index < number_of_partitions;
+	     partition_index++ )
+	{
+		if( partitions[ partition_index ] != NULL )
+		{
+			if( libvsmbr_partition_free(
+			     &( partitions[ partition_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free partition: %d.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( partitions != NULL )
+	{
+		memory_free(
+		 partitions );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( 1 );
+
+on_error:
+	if( partitions != NULL )
+	{
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			if( partitions[ partition_index ] != NULL )
+			{
+				libvsmbr_partition_free(
+				 &( partitions[ partition_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 partitions );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+/* Creates a simulated cache
+ * Make sure the value cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_replay_cache_initialize(
+     vsmbr_bench_replay_cache_t **cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "vsmbr_bench_replay_cache_initialize";
+	int bucket_index      = 0;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_entries <= 0 )
+	 || ( maximum_number_of_entries > ( 64 * 1024 * 1024 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*cache = memory_allocate_structure(
+	          vsmbr_bench_replay_cache_t );
+
+	if( *cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *cache,
+	     0,
+	     sizeof( vsmbr_bench_replay_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache.",
+		 function );
+
+		memory_free(
+		 *cache );
+
+		*cache = NULL;
+
+		return( -1 );
+	}
+	( *cache )->number_of_buckets = 1;
+
+	while( ( *cache )->number_of_buckets < ( 2 * maximum_number_of_entries ) )
+	{
+		( *cache )->number_of_buckets *= 2;
+	}
+	( *cache )->keys              = (uint64_t *) memory_allocate( sizeof( uint64_t ) * maximum_number_of_entries );
+	( *cache )->previous_entries  = (int *) memory_allocate( sizeof( int ) * maximum_number_of_entries );
+	( *cache )->next_entries      = (int *) memory_allocate( sizeof( int ) * maximum_number_of_entries );
+	( *cache )->hash_next_entries = (int *) memory_allocate( sizeof( int ) * maximum_number_of_entries );
+	( *cache )->buckets           = (int *) memory_allocate( sizeof( int ) * ( *cache )->number_of_buckets );
+
+	if( ( ( *cache )->keys == NULL )
+	 || ( ( *cache )->previous_entries == NULL )
+	 || ( ( *cache )->next_entries == NULL )
+	 || ( ( *cache )->hash_next_entries == NULL )
+	 || ( ( *cache )->buckets == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( bucket_index = 0;
+	     bucket_index < ( *cache )->number_of_buckets;
+	     bucket_index++ )
+	{
+		( *cache )->buckets[ bucket_index ] = -1;
+	}
+	( *cache )->maximum_number_of_entries = maximum_number_of_entries;
+	( *cache )->most_recently_used_entry  = -1;
+	( *cache )->least_recently_used_entry = -1;
+
+	return( 1 );
+
+on_error:
+	if( *cache != NULL )
+	{
+		vsmbr_bench_replay_cache_free(
+		 cache,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a simulated cache
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_replay_cache_free(
+     vsmbr_bench_replay_cache_t **cache,
+     libcerror_error_t **error )
+{
+	static char *function = "vsmbr_bench_replay_cache_free";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache != NULL )
+	{
+		if( ( *cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *cache )->buckets );
+		}
+		if( ( *cache )->hash_next_entries != NULL )
+		{
+			memory_free(
+			 ( *cache )->hash_next_entries );
+		}
+		if( ( *cache )->next_entries != NULL )
+		{
+			memory_free(
+			 ( *cache )->next_entries );
+		}
+		if( ( *cache )->previous_entries != NULL )
+		{
+			memory_free(
+			 ( *cache )->previous_entries );
+		}
+		if( ( *cache )->keys != NULL )
+		{
+			memory_free(
+			 ( *cache )->keys );
+		}
+		memory_free(
+		 *cache );
+
+		*cache = NULL;
+	}
+	return( 1 );
+}
+
+/* Determines the hash bucket of a key
+ */
+#define vsmbr_bench_replay_cache_get_bucket_index( cache, key ) \
+	(int) ( ( ( ( key ) * 0x9e3779b97f4a7c15ULL ) >> 32 ) & (uint64_t) ( ( cache )->number_of_buckets - 1 ) )
+
+/* Retrieves the entry of a key
+ * Returns 1 if the key is cached or 0 if not
+ */
+int vsmbr_bench_replay_cache_get_entry(
+     vsmbr_bench_replay_cache_t *cache,
+     uint64_t key,
+     int *entry_index )
+{
+	int bucket_index = vsmbr_bench_replay_cache_get_bucket_index( cache, key );
+
+	*entry_index = cache->buckets[ bucket_index ];
+
+	while( *entry_index != -1 )
+	{
+		if( cache->keys[ *entry_index ] == key )
+		{
+			return( 1 );
+		}
+		*entry_index = cache->hash_next_entries[ *entry_index ];
+	}
+	return( 0 );
+}
+
+/* Removes an entry from the least recently used order
+ */
+void vsmbr_bench_replay_cache_unlink_entry(
+      vsmbr_bench_replay_cache_t *cache,
+      int entry_index )
+{
+	int next_entry_index     = cache->next_entries[ entry_index ];
+	int previous_entry_index = cache->previous_entries[ entry_index ];
+
+	if( previous_entry_index != -1 )
+	{
+		cache->next_entries[ previous_entry_index ] = next_entry_index;
+	}
+	else
+	{
+		cache->most_recently_used_entry = next_entry_index;
+	}
+	if( next_entry_index != -1 )
+	{
+		cache->previous_entries[ next_entry_index ] = previous_entry_index;
+	}
+	else
+	{
+		cache->least_recently_used_entry = previous_entry_index;
+	}
+}
+
+/* Makes an entry the most recently used entry
+ */
+void vsmbr_bench_replay_cache_link_entry(
+      vsmbr_bench_replay_cache_t *cache,
+      int entry_index )
+{
+	cache->previous_entries[ entry_index ] = -1;
+	cache->next_entries[ entry_index ]     = cache->most_recently_used_entry;
+
+	if( cache->most_recently_used_entry != -1 )
+	{
+		cache->previous_entries[ cache->most_recently_used_entry ] = entry_index;
+	}
+	cache->most_recently_used_entry = entry_index;
+
+	if( cache->least_recently_used_entry == -1 )
+	{
+		cache->least_recently_used_entry = entry_index;
+	}
+}
+
+/* Inserts a key as the most recently used entry
+ * The least recently used entry is replaced if the cache is full
+ * Returns 1 if the key was inserted or 0 if it was already cached
+ */
+int vsmbr_bench_replay_cache_insert_key(
+     vsmbr_bench_replay_cache_t *cache,
+     uint64_t key,
+     uint8_t *is_eviction )
+{
+	int bucket_index = 0;
+	int entry_index  = 0;
+	int *hash_entry  = NULL;
+
+	*is_eviction = 0;
+
+	if( vsmbr_bench_replay_cache_get_entry(
+	     cache,
+	     key,
+	     &entry_index ) == 1 )
+	{
+		return( 0 );
+	}
+	if( cache->number_of_entries < cache->maximum_number_of_entries )
+	{
+		entry_index = cache->number_of_entries;
+
+		cache->number_of_entries += 1;
+	}
+	else
+	{
+		entry_index = cache->least_recently_used_entry;
+
+		vsmbr_bench_replay_cache_unlink_entry(
+		 cache,
+		 entry_index );
+
+		bucket_index = vsmbr_bench_replay_cache_get_bucket_index( cache, cache->keys[ entry_index ] );
+
+		hash_entry = &( cache->buckets[ bucket_index ] );
+
+		while( *hash_entry != entry_index )
+		{
+			hash_entry = &( cache->hash_next_entries[ *hash_entry ] );
+		}
+		*hash_entry = cache->hash_next_entries[ entry_index ];
+
+		*is_eviction = 1;
+	}
+	bucket_index = vsmbr_bench_replay_cache_get_bucket_index( cache, key );
+
+	cache->keys[ entry_index ]              = key;
+	cache->hash_next_entries[ entry_index ] = cache->buckets[ bucket_index ];
+	cache->buckets[ bucket_index ]          = entry_index;
+
+	vsmbr_bench_replay_cache_link_entry(
+	 cache,
+	 entry_index );
+
+	return( 1 );
+}
+
+/* Simulates the requests of the trace with a least recently used cache
+ * of blocks of a specific size and a specific number of blocks read ahead
+ * Every cache miss results in a single backing read of the missing block
+ * and of the blocks that are read ahead
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_bench_replay_simulate(
+     vsmbr_bench_replay_t *replay,
+     uint32_t block_size,
+     int cache_size,
+     int read_ahead,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	vsmbr_bench_replay_cache_t *cache   = NULL;
+	vsmbr_bench_replay_record_t *record = NULL;
+	static char *function               = "vsmbr_bench_replay_simulate";
+	uint64_t backing_bytes_read         = 0;
+	uint64_t block_number               = 0;
+	uint64_t first_block_number         = 0;
+	uint64_t key                        = 0;
+	uint64_t last_block_number          = 0;
+	uint64_t number_of_backing_reads    = 0;
+	uint64_t number_of_evictions        = 0;
+	uint64_t number_of_hits             = 0;
+	uint64_t number_of_lookups          = 0;
+	uint64_t read_ahead_block_number    = 0;
+	uint8_t is_eviction                 = 0;
+	int entry_index                     = 0;
+	int record_index                    = 0;
+
+	if( replay == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid replay.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid block size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_ahead < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid read ahead value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( vsmbr_bench_replay_cache_initialize(
+	     &cache,
+	     cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create cache.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < replay->number_of_records;
+	     record_index++ )
+	{
+		record = &( replay->records[ record_index ] );
+
+		if( ( record->record_type != LIBVSMBR_TRACE_RECORD_TYPE_REQUEST )
+		 || ( record->size == 0 ) )
+		{
+			continue;
+		}
+		first_block_number = record->offset / block_size;
+		last_block_number  = ( record->offset + record->size - 1 ) / block_size;
+
+		for( block_number = first_block_number;
+		     block_number <= last_block_number;
+		     block_number++ )
+		{
+			/* The partition index is stored in the upper 16 bits of the key
+			 */
+			key = ( (uint64_t) ( record->partition_index & 0xffff ) << 48 ) | ( block_number & 0x0000ffffffffffffULL );
+
+			number_of_lookups++;
+
+			if( vsmbr_bench_replay_cache_get_entry(
+			     cache,
+			     key,
+			     &entry_index ) == 1 )
+			{
+				vsmbr_bench_replay_cache_unlink_entry(
+				 cache,
+				 entry_index );
+
+				vsmbr_bench_replay_cache_link_entry(
+				 cache,
+				 entry_index );
+
+				number_of_hits++;
+
+				continue;
+			}
+			number_of_backing_reads++;
+			backing_bytes_read += (uint64_t) block_size * ( 1 + read_ahead );
+
+			/* The blocks read ahead are inserted before the missing block
+			 * so that the missing block is the most recently used
+			 */
+			for( read_ahead_block_number = block_number + read_ahead;
+			     read_ahead_block_number >= block_number;
+			     read_ahead_block_number-- )
+			{
+				vsmbr_bench_replay_cache_insert_key(
+				 cache,
+				 key + ( read_ahead_block_number - block_number ),
+				 &is_eviction );
+
+				if( is_eviction != 0 )
+				{
+					number_of_evictions++;
+				}
+				if( read_ahead_block_number == 0 )
+				{
+					break;
+				}
+			}
+		}
+	}
+	fprintf(
+	 stream,
+	 "{\"replay\": \"simulation\", \"block_size\": %" PRIu32 ", \"cache_entries\": %d, \"read_ahead\": %d, \"lookups\": %" PRIu64 ", \"cache_hits\": %" PRIu64 ", \"cache_misses\": %" PRIu64 ", \"cache_evictions\": %" PRIu64 ", \"backing_reads\": %" PRIu64 ", \"backing_bytes_read\": %" PRIu64 ", \"amplification\": %.3f}\n",
+	 block_size,
+	 cache_size,
+	 read_ahead,
+	 number_of_lookups,
+	 number_of_hits,
+	 number_of_lookups - number_of_hits,
+	 number_of_evictions,
+	 number_of_backing_reads,
+	 backing_bytes_read,
+	 ( replay->bytes_requested > 0 ) ? (double) backing_bytes_read / (double) replay->bytes_requested : 0.0 );
+
+	if( vsmbr_bench_replay_cache_free(
+	     &cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,217 @@
+/*
+ * Trace replay functions for the benchmark program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _VSMBR_BENCH_REPLAY_H )
+#define _VSMBR_BENCH_REPLAY_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "vsmbr_test_libcerror.h"
+#include "vsmbr_test_libvsmbr.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the trace file header and of a trace record
+ */
+#define VSMBR_BENCH_REPLAY_FILE_HEADER_SIZE	32
+#define VSMBR_BENCH_REPLAY_RECORD_SIZE		32
+
+typedef struct vsmbr_bench_replay_record vsmbr_bench_replay_record_t;
+
+struct vsmbr_bench_replay_record
+{
+	/* The timestamp in nano seconds since the start of the trace
+	 */
+	uint64_t timestamp;
+
+	/* The offset, relative to the start of the partition for requests
+	 * and to the start of the volume for backing reads
+	 */
+	uint64_t offset;
+
+	/* The size
+	 */
+	uint32_t size;
+
+	/* The identifier of the thread that issued the read
+	 */
+	uint32_t thread_identifier;
+
+	/* The partition index, 0xffffffff for reads of the volume
+	 */
+	uint32_t partition_index;
+
+	/* The record type
+	 */
+	uint8_t record_type;
+};
+
+typedef struct vsmbr_bench_replay vsmbr_bench_replay_t;
+
+struct vsmbr_bench_replay
+{
+	/* The number of bytes per sector of the traced volume
+	 */
+	uint32_t bytes_per_sector;
+
+	/* The records
+	 */
+	vsmbr_bench_replay_record_t *records;
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The number of request records
+	 */
+	int number_of_requests;
+
+	/* The number of requested bytes
+	 */
+	uint64_t bytes_requested;
+
+	/* The number of backing read records
+	 */
+	int number_of_backing_reads;
+
+	/* The number of bytes of the backing reads
+	 */
+	uint64_t backing_bytes_read;
+
+	/* The largest request size
+	 */
+	uint32_t maximum_request_size;
+};
+
+typedef struct vsmbr_bench_replay_cache vsmbr_bench_replay_cache_t;
+
+struct vsmbr_bench_replay_cache
+{
+	/* The maximum number of entries
+	 */
+	int maximum_number_of_entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The keys of the entries
+	 */
+	uint64_t *keys;
+
+	/* The previous and next entries in least recently used order
+	 */
+	int *previous_entries;
+	int *next_entries;
+
+	/* The next entries in the same hash bucket
+	 */
+	int *hash_next_entries;
+
+	/* The hash buckets
+	 */
+	int *buckets;
+
+	/* The number of hash buckets, which is a power of 2
+	 */
+	int number_of_buckets;
+
+	/* The most and least recently used entries
+	 */
+	int most_recently_used_entry;
+	int least_recently_used_entry;
+};
+
+int vsmbr_bench_replay_initialize(
+     vsmbr_bench_replay_t **replay,
+     libcerror_error_t **error );
+
+int vsmbr_bench_replay_free(
+     vsmbr_bench_replay_t **replay,
+     libcerror_error_t **error );
+
+int vsmbr_bench_replay_read_file(
+     vsmbr_bench_replay_t *replay,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int vsmbr_bench_replay_fprint(
+     vsmbr_bench_replay_t *replay,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int vsmbr_bench_replay_get_statistics_values(
+     libvsmbr_volume_t *volume,
+     uint64_t *values,
+     libcerror_error_t **error );
+
+int vsmbr_bench_replay_run(
+     vsmbr_bench_replay_t *replay,
+     libvsmbr_volume_t *volume,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int vsmbr_bench_replay_cache_initialize(
+     vsmbr_bench_replay_cache_t **cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error );
+
+int vsmbr_bench_replay_cache_free(
+     vsmbr_bench_replay_cache_t **cache,
+     libcerror_error_t **error );
+
+int vsmbr_bench_replay_cache_get_entry(
+     vsmbr_bench_replay_cache_t *cache,
+     uint64_t key,
+     int *entry_index );
+
+void vsmbr_bench_replay_cache_unlink_entry(
+      vsmbr_bench_replay_cache_t *cache,
+      int entry_index );
+
+void vsmbr_bench_replay_cache_link_entry(
+      vsmbr_bench_replay_cache_t *cache,
+      int entry_index );
+
+int vsmbr_bench_replay_cache_insert_key(
+     vsmbr_bench_replay_cache_t *cache,
+     uint64_t key,
+     uint8_t *is_eviction );
+
+int vsmbr_bench_replay_simulate(
+     vsmbr_bench_replay_t *replay,
+     uint32_t block_size,
+     int cache_size,
+     int read_ahead,
+     FILE *stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _VSMBR_BENCH_REPLAY_H ) */
+
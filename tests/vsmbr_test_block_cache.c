@@ -0,0 +1,1776 @@
+/*
+ * Block cache IO handle test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsmbr_test_image.h"
+#include "vsmbr_test_latency_io_handle.h"
+#include "vsmbr_test_libbfio.h"
+#include "vsmbr_test_libcerror.h"
+#include "vsmbr_test_libvsmbr.h"
+#include "vsmbr_test_macros.h"
+#include "vsmbr_test_memory.h"
+#include "vsmbr_test_unused.h"
+
+#include "../libvsmbr/libvsmbr_block_cache_io_handle.h"
+
+/* The test image consists of a MBR with a single partition
+ * of 1343 sectors starting at sector 1, the image consists of
+ * 11 blocks of which the last block is only partially used
+ */
+#define VSMBR_TEST_BLOCK_CACHE_IMAGE_SIZE		( ( 10 * 65536 ) + 32768 )
+
+#define VSMBR_TEST_BLOCK_CACHE_NUMBER_OF_BLOCKS		11
+
+/* The cache file contains a single set of 8 entries
+ */
+#define VSMBR_TEST_BLOCK_CACHE_CACHE_SIZE		( 1024 * 1024 )
+
+#define VSMBR_TEST_BLOCK_CACHE_OVERLAY_SIZE		( 1024 * 1024 )
+
+/* The latency of the slow tier in nano seconds
+ */
+#define VSMBR_TEST_BLOCK_CACHE_LATENCY			100000
+
+uint8_t vsmbr_test_block_cache_image_data[ VSMBR_TEST_BLOCK_CACHE_IMAGE_SIZE ];
+
+uint8_t vsmbr_test_block_cache_cache_data[ VSMBR_TEST_BLOCK_CACHE_CACHE_SIZE ];
+
+uint8_t vsmbr_test_block_cache_overlay_data[ VSMBR_TEST_BLOCK_CACHE_OVERLAY_SIZE ];
+
+/* Creates the file IO handles of the test image, that is read through
+ * a latency file IO handle as a slow tier, and of the cache file
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_block_cache_initialize_file_io_handles(
+     libbfio_handle_t **file_io_handle,
+     vsmbr_test_latency_io_handle_t **latency_io_handle,
+     libbfio_handle_t **cache_file_io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *memory_range_io_handle = NULL;
+
+	if( libbfio_memory_range_initialize(
+	     &memory_range_io_handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     memory_range_io_handle,
+	     vsmbr_test_block_cache_image_data,
+	     VSMBR_TEST_BLOCK_CACHE_IMAGE_SIZE,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( vsmbr_test_latency_initialize(
+	     file_io_handle,
+	     memory_range_io_handle,
+	     VSMBR_TEST_BLOCK_CACHE_LATENCY,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The memory range file IO handle is now managed by the latency file IO handle
+	 */
+	memory_range_io_handle = NULL;
+
+	if( libbfio_handle_get_io_handle(
+	     *file_io_handle,
+	     (intptr_t **) latency_io_handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libbfio_memory_range_initialize(
+	     cache_file_io_handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     *cache_file_io_handle,
+	     vsmbr_test_block_cache_cache_data,
+	     VSMBR_TEST_BLOCK_CACHE_CACHE_SIZE,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *cache_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 cache_file_io_handle,
+		 NULL );
+	}
+	if( *file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 file_io_handle,
+		 NULL );
+	}
+	if( memory_range_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &memory_range_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+/* Tests the libvsmbr_block_cache_io_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_block_cache_io_handle_initialize(
+     void )
+{
+	libbfio_handle_t *cache_file_io_handle                  = NULL;
+	libbfio_handle_t *file_io_handle                        = NULL;
+	libcerror_error_t *error                                = NULL;
+	libvsmbr_block_cache_io_handle_t *block_cache_io_handle = NULL;
+	vsmbr_test_latency_io_handle_t *latency_io_handle       = NULL;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = vsmbr_test_block_cache_initialize_file_io_handles(
+	          &file_io_handle,
+	          &latency_io_handle,
+	          &cache_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_block_cache_io_handle_initialize(
+	          &block_cache_io_handle,
+	          file_io_handle,
+	          cache_file_io_handle,
+	          VSMBR_TEST_BLOCK_CACHE_CACHE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache_io_handle",
+	 block_cache_io_handle );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_block_cache_io_handle_free(
+	          &block_cache_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "block_cache_io_handle",
+	 block_cache_io_handle );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_block_cache_io_handle_initialize(
+	          NULL,
+	          file_io_handle,
+	          cache_file_io_handle,
+	          VSMBR_TEST_BLOCK_CACHE_CACHE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	block_cache_io_handle = (libvsmbr_block_cache_io_handle_t *) 0x12345678UL;
+
+	result = libvsmbr_block_cache_io_handle_initialize(
+	          &block_cache_io_handle,
+	          file_io_handle,
+	          cache_file_io_handle,
+	          VSMBR_TEST_BLOCK_CACHE_CACHE_SIZE,
+	          &error );
+
+	block_cache_io_handle = NULL;
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_block_cache_io_handle_initialize(
+	          &block_cache_io_handle,
+	          NULL,
+	          cache_file_io_handle,
+	          VSMBR_TEST_BLOCK_CACHE_CACHE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_block_cache_io_handle_initialize(
+	          &block_cache_io_handle,
+	          file_io_handle,
+	          NULL,
+	          VSMBR_TEST_BLOCK_CACHE_CACHE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_block_cache_io_handle_initialize(
+	          &block_cache_io_handle,
+	          file_io_handle,
+	          cache_file_io_handle,
+	          65536,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &cache_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache_io_handle != NULL )
+	{
+		libvsmbr_block_cache_io_handle_free(
+		 &block_cache_io_handle,
+		 NULL );
+	}
+	if( cache_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &cache_file_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_block_cache_io_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_block_cache_io_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvsmbr_block_cache_io_handle_free(
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_block_cache_io_handle_read function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_block_cache_io_handle_read(
+     void )
+{
+	uint8_t buffer[ 4096 ];
+
+	libbfio_handle_t *cache_file_io_handle                  = NULL;
+	libbfio_handle_t *file_io_handle                        = NULL;
+	libbfio_handle_t *handle                                = NULL;
+	libcerror_error_t *error                                = NULL;
+	libvsmbr_block_cache_io_handle_t *block_cache_io_handle = NULL;
+	vsmbr_test_latency_io_handle_t *latency_io_handle       = NULL;
+	size_t data_offset                                      = 0;
+	ssize_t read_count                                      = 0;
+	ssize_t write_count                                     = 0;
+	uint64_t number_of_reads                                = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 vsmbr_test_block_cache_cache_data,
+	 0,
+	 VSMBR_TEST_BLOCK_CACHE_CACHE_SIZE );
+
+	result = vsmbr_test_block_cache_initialize_file_io_handles(
+	          &file_io_handle,
+	          &latency_io_handle,
+	          &cache_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_block_cache_initialize(
+	          &handle,
+	          file_io_handle,
+	          cache_file_io_handle,
+	          VSMBR_TEST_BLOCK_CACHE_CACHE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_io_handle(
+	          handle,
+	          (intptr_t **) &block_cache_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache_io_handle",
+	 block_cache_io_handle );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+
+	/* The first session reads every block from the slow tier, the cache file
+	 * contains a single set of 8 entries hence the first 3 blocks are replaced
+	 */
+	result = libbfio_handle_open(
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 0;
+	     data_offset < VSMBR_TEST_BLOCK_CACHE_IMAGE_SIZE;
+	     data_offset += 4096 )
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              handle,
+		              buffer,
+		              4096,
+		              (off64_t) data_offset,
+		              &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 4096 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          buffer,
+		          &( vsmbr_test_block_cache_image_data[ data_offset ] ),
+		          4096 );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "block_cache_io_handle->number_of_misses",
+	 block_cache_io_handle->number_of_misses,
+	 (uint64_t) VSMBR_TEST_BLOCK_CACHE_NUMBER_OF_BLOCKS );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "block_cache_io_handle->number_of_hits",
+	 block_cache_io_handle->number_of_hits,
+	 (uint64_t) 0 );
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               handle,
+	               buffer,
+	               4096,
+	               0,
+	               &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_close(
+	          handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The second session reads the 8 most recently used blocks
+	 * from the cache file and no data from the slow tier
+	 */
+	number_of_reads = latency_io_handle->number_of_reads;
+
+	result = libbfio_handle_open(
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Opening reads the first sector to identify the image
+	 */
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "latency_io_handle->number_of_reads",
+	 latency_io_handle->number_of_reads,
+	 number_of_reads + 1 );
+
+	number_of_reads = latency_io_handle->number_of_reads;
+
+	for( data_offset = 3 * 65536;
+	     data_offset < VSMBR_TEST_BLOCK_CACHE_IMAGE_SIZE;
+	     data_offset += 4096 )
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              handle,
+		              buffer,
+		              4096,
+		              (off64_t) data_offset,
+		              &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 4096 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          buffer,
+		          &( vsmbr_test_block_cache_image_data[ data_offset ] ),
+		          4096 );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "block_cache_io_handle->number_of_hits",
+	 block_cache_io_handle->number_of_hits,
+	 (uint64_t) 8 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "block_cache_io_handle->number_of_misses",
+	 block_cache_io_handle->number_of_misses,
+	 (uint64_t) 0 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "latency_io_handle->number_of_reads",
+	 latency_io_handle->number_of_reads,
+	 number_of_reads );
+
+	/* A block that was replaced is read from the slow tier
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              4096,
+	              0,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4096 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "block_cache_io_handle->number_of_misses",
+	 block_cache_io_handle->number_of_misses,
+	 (uint64_t) 1 );
+
+	result = libbfio_handle_close(
+	          handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A block of which the data in the cache file is corrupted
+	 * is read from the slow tier again
+	 */
+	for( data_offset = 0;
+	     data_offset < VSMBR_TEST_BLOCK_CACHE_CACHE_SIZE - 4096;
+	     data_offset += 65536 )
+	{
+		vsmbr_test_block_cache_cache_data[ 4096 + data_offset ] ^= 0xff;
+	}
+	result = libbfio_handle_open(
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              4096,
+	              5 * 65536,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4096 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( vsmbr_test_block_cache_image_data[ 5 * 65536 ] ),
+	          4096 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "block_cache_io_handle->number_of_hits",
+	 block_cache_io_handle->number_of_hits,
+	 (uint64_t) 0 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "block_cache_io_handle->number_of_misses",
+	 block_cache_io_handle->number_of_misses,
+	 (uint64_t) 1 );
+
+	result = libbfio_handle_close(
+	          handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A different image, with another disk identity, does not use
+	 * the blocks of the first image
+	 */
+	vsmbr_test_block_cache_image_data[ 440 ] ^= 0xff;
+
+	result = libbfio_handle_open(
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              4096,
+	              5 * 65536,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4096 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "block_cache_io_handle->number_of_hits",
+	 block_cache_io_handle->number_of_hits,
+	 (uint64_t) 0 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "block_cache_io_handle->number_of_misses",
+	 block_cache_io_handle->number_of_misses,
+	 (uint64_t) 1 );
+
+	result = libbfio_handle_close(
+	          handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	vsmbr_test_block_cache_image_data[ 440 ] ^= 0xff;
+
+	/* Test error cases
+	 */
+	result = libvsmbr_block_cache_io_handle_read_block(
+	          block_cache_io_handle,
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_block_cache_io_handle_open(
+	          block_cache_io_handle,
+	          LIBBFIO_OPEN_READ_WRITE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &cache_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( cache_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &cache_file_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+/* Tests the libvsmbr_volume_set_block_cache_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_volume_set_block_cache_file_io_handle(
+     void )
+{
+	uint8_t buffer[ 8192 ];
+
+	libbfio_handle_t *cache_file_io_handle            = NULL;
+	libbfio_handle_t *file_io_handle                  = NULL;
+	libcerror_error_t *error                          = NULL;
+	libvsmbr_partition_t *partition                   = NULL;
+	libvsmbr_volume_t *volume                         = NULL;
+	vsmbr_test_latency_io_handle_t *latency_io_handle = NULL;
+	ssize_t read_count                                = 0;
+	uint64_t number_of_reads                          = 0;
+	int result                                        = 0;
+	int session_index                                 = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 vsmbr_test_block_cache_cache_data,
+	 0,
+	 VSMBR_TEST_BLOCK_CACHE_CACHE_SIZE );
+
+	result = vsmbr_test_block_cache_initialize_file_io_handles(
+	          &file_io_handle,
+	          &latency_io_handle,
+	          &cache_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+
+	/* The second session reads the partition table and data from
+	 * the cache file, only the first sector is read from the slow tier
+	 */
+	for( session_index = 0;
+	     session_index < 2;
+	     session_index++ )
+	{
+		number_of_reads = latency_io_handle->number_of_reads;
+
+		result = libvsmbr_volume_initialize(
+		          &volume,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_volume_set_block_cache_file_io_handle(
+		          volume,
+		          cache_file_io_handle,
+		          VSMBR_TEST_BLOCK_CACHE_CACHE_SIZE,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_volume_open_file_io_handle(
+		          volume,
+		          file_io_handle,
+		          LIBVSMBR_OPEN_READ,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_volume_get_partition_by_index(
+		          volume,
+		          0,
+		          &partition,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libvsmbr_partition_read_buffer_at_offset(
+		              partition,
+		              buffer,
+		              8192,
+		              65536,
+		              &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 8192 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          buffer,
+		          &( vsmbr_test_block_cache_image_data[ 512 + 65536 ] ),
+		          8192 );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		if( session_index == 1 )
+		{
+			VSMBR_TEST_ASSERT_EQUAL_UINT64(
+			 "latency_io_handle->number_of_reads",
+			 latency_io_handle->number_of_reads,
+			 number_of_reads + 1 );
+		}
+		result = libvsmbr_partition_free(
+		          &partition,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_volume_close(
+		          volume,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_volume_free(
+		          &volume,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libvsmbr_volume_initialize(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_set_block_cache_file_io_handle(
+	          NULL,
+	          cache_file_io_handle,
+	          VSMBR_TEST_BLOCK_CACHE_CACHE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_volume_set_block_cache_file_io_handle(
+	          volume,
+	          NULL,
+	          VSMBR_TEST_BLOCK_CACHE_CACHE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_volume_set_block_cache_file_io_handle(
+	          volume,
+	          cache_file_io_handle,
+	          65536,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_volume_set_block_cache_file_io_handle(
+	          volume,
+	          cache_file_io_handle,
+	          VSMBR_TEST_BLOCK_CACHE_CACHE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_set_block_cache_file_io_handle(
+	          volume,
+	          cache_file_io_handle,
+	          VSMBR_TEST_BLOCK_CACHE_CACHE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The volume file cannot be written while blocks are cached
+	 */
+	result = libvsmbr_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBVSMBR_OPEN_READ_WRITE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_volume_free(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &cache_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition != NULL )
+	{
+		libvsmbr_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libvsmbr_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( cache_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &cache_file_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_volume_set_block_cache_file_io_handle function with an overlay
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_volume_set_block_cache_file_io_handle_with_overlay(
+     void )
+{
+	uint8_t buffer[ 8192 ];
+	uint8_t expected_data[ 8192 ];
+
+	libbfio_handle_t *cache_file_io_handle            = NULL;
+	libbfio_handle_t *file_io_handle                  = NULL;
+	libbfio_handle_t *overlay_file_io_handle          = NULL;
+	libcerror_error_t *error                          = NULL;
+	libvsmbr_partition_t *partition                   = NULL;
+	libvsmbr_volume_t *volume                         = NULL;
+	vsmbr_test_latency_io_handle_t *latency_io_handle = NULL;
+	ssize_t read_count                                = 0;
+	ssize_t write_count                               = 0;
+	uint64_t number_of_reads                          = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 vsmbr_test_block_cache_cache_data,
+	 0,
+	 VSMBR_TEST_BLOCK_CACHE_CACHE_SIZE );
+
+	result = vsmbr_test_block_cache_initialize_file_io_handles(
+	          &file_io_handle,
+	          &latency_io_handle,
+	          &cache_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_initialize(
+	          &overlay_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          overlay_file_io_handle,
+	          vsmbr_test_block_cache_overlay_data,
+	          VSMBR_TEST_BLOCK_CACHE_OVERLAY_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_initialize(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_volume_set_block_cache_file_io_handle(
+	          volume,
+	          cache_file_io_handle,
+	          VSMBR_TEST_BLOCK_CACHE_CACHE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_set_overlay_file_io_handle(
+	          volume,
+	          overlay_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The volume file is not written when writes are redirected to the overlay
+	 */
+	result = libvsmbr_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBVSMBR_OPEN_READ_WRITE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_get_partition_by_index(
+	          volume,
+	          0,
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libvsmbr_partition_read_buffer_at_offset(
+	              partition,
+	              buffer,
+	              8192,
+	              65536,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8192 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The overlay is stacked on the block cache, hence other data of a block
+	 * that is not overlaid is read from the block cache instead of the slow tier
+	 */
+	number_of_reads = latency_io_handle->number_of_reads;
+
+	read_count = libvsmbr_partition_read_buffer_at_offset(
+	              partition,
+	              buffer,
+	              8192,
+	              65536 + 16384,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8192 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "latency_io_handle->number_of_reads",
+	 latency_io_handle->number_of_reads,
+	 number_of_reads );
+
+	memory_copy(
+	 expected_data,
+	 &( vsmbr_test_block_cache_image_data[ 512 + 65536 ] ),
+	 8192 );
+
+	memory_set(
+	 &( expected_data[ 300 ] ),
+	 0x5a,
+	 1000 );
+
+	memory_set(
+	 buffer,
+	 0x5a,
+	 1000 );
+
+	write_count = libvsmbr_partition_write_buffer_at_offset(
+	               partition,
+	               buffer,
+	               1000,
+	               65536 + 300,
+	               &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 1000 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libvsmbr_partition_read_buffer_at_offset(
+	              partition,
+	              buffer,
+	              8192,
+	              65536,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8192 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          expected_data,
+	          8192 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The volume file is not modified
+	 */
+	result = memory_compare(
+	          &( vsmbr_test_block_cache_image_data[ 512 + 65536 ] ),
+	          expected_data,
+	          8192 );
+
+	VSMBR_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libvsmbr_partition_free(
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_close(
+	          volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_free(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &overlay_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &cache_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition != NULL )
+	{
+		libvsmbr_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libvsmbr_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( overlay_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &overlay_file_io_handle,
+		 NULL );
+	}
+	if( cache_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &cache_file_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argc )
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+	if( vsmbr_test_image_fill(
+	     vsmbr_test_block_cache_image_data,
+	     VSMBR_TEST_BLOCK_CACHE_IMAGE_SIZE,
+	     1,
+	     0x12345678UL,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_block_cache_io_handle_initialize",
+	 vsmbr_test_block_cache_io_handle_initialize );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_block_cache_io_handle_free",
+	 vsmbr_test_block_cache_io_handle_free );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_block_cache_io_handle_read",
+	 vsmbr_test_block_cache_io_handle_read );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_volume_set_block_cache_file_io_handle",
+	 vsmbr_test_volume_set_block_cache_file_io_handle );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_volume_set_block_cache_file_io_handle_with_overlay",
+	 vsmbr_test_volume_set_block_cache_file_io_handle_with_overlay );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
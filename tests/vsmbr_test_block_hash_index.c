@@ -0,0 +1,1362 @@
+/*
+ * Library block_hash_index type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsmbr_test_functions.h"
+#include "vsmbr_test_image.h"
+#include "vsmbr_test_libbfio.h"
+#include "vsmbr_test_libcerror.h"
+#include "vsmbr_test_libvsmbr.h"
+#include "vsmbr_test_macros.h"
+#include "vsmbr_test_memory.h"
+#include "vsmbr_test_unused.h"
+
+#include "../libvsmbr/libvsmbr_block_hash_index.h"
+
+/* The test image consists of a MBR with a single partition
+ * of 127 sectors starting at sector 1
+ */
+#define VSMBR_TEST_BLOCK_HASH_INDEX_IMAGE_SIZE		65536
+#define VSMBR_TEST_BLOCK_HASH_INDEX_PARTITION_SIZE	65024
+#define VSMBR_TEST_BLOCK_HASH_INDEX_BLOCK_SIZE		4096
+
+uint8_t vsmbr_test_block_hash_index_image_data[ VSMBR_TEST_BLOCK_HASH_INDEX_IMAGE_SIZE ];
+
+uint8_t vsmbr_test_block_hash_index_changed_image_data[ VSMBR_TEST_BLOCK_HASH_INDEX_IMAGE_SIZE ];
+
+/* Builds a block hash index of the first partition in image data
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_block_hash_index_build_from_image(
+     libvsmbr_block_hash_index_t *block_hash_index,
+     uint8_t *image_data,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libvsmbr_partition_t *partition  = NULL;
+	libvsmbr_volume_t *volume        = NULL;
+	int result                       = 0;
+
+	if( vsmbr_test_open_file_io_handle(
+	     &file_io_handle,
+	     image_data,
+	     VSMBR_TEST_BLOCK_HASH_INDEX_IMAGE_SIZE,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libvsmbr_volume_initialize(
+	     &volume,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libvsmbr_volume_open_file_io_handle(
+	     volume,
+	     file_io_handle,
+	     LIBVSMBR_OPEN_READ,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libvsmbr_volume_get_partition_by_index(
+	     volume,
+	     0,
+	     &partition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	result = libvsmbr_block_hash_index_build_from_partition(
+	          block_hash_index,
+	          partition,
+	          error );
+
+	if( libvsmbr_partition_free(
+	     &partition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libvsmbr_volume_close(
+	     volume,
+	     error ) != 0 )
+	{
+		goto on_error;
+	}
+	if( libvsmbr_volume_free(
+	     &volume,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( vsmbr_test_close_file_io_handle(
+	     &file_io_handle,
+	     error ) != 0 )
+	{
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( partition != NULL )
+	{
+		libvsmbr_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libvsmbr_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libvsmbr_block_hash_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_block_hash_index_initialize(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libvsmbr_block_hash_index_t *block_hash_index = NULL;
+	int result                                    = 0;
+
+#if defined( HAVE_VSMBR_TEST_MEMORY )
+	int number_of_malloc_fail_tests               = 1;
+	int number_of_memset_fail_tests               = 1;
+	int test_number                               = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_block_hash_index_initialize(
+	          &block_hash_index,
+	          VSMBR_TEST_BLOCK_HASH_INDEX_BLOCK_SIZE,
+	          LIBVSMBR_DIGEST_TYPE_SHA256,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "block_hash_index",
+	 block_hash_index );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_block_hash_index_free(
+	          &block_hash_index,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "block_hash_index",
+	 block_hash_index );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_block_hash_index_initialize(
+	          NULL,
+	          VSMBR_TEST_BLOCK_HASH_INDEX_BLOCK_SIZE,
+	          LIBVSMBR_DIGEST_TYPE_SHA256,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	block_hash_index = (libvsmbr_block_hash_index_t *) 0x12345678UL;
+
+	result = libvsmbr_block_hash_index_initialize(
+	          &block_hash_index,
+	          VSMBR_TEST_BLOCK_HASH_INDEX_BLOCK_SIZE,
+	          LIBVSMBR_DIGEST_TYPE_SHA256,
+	          &error );
+
+	block_hash_index = NULL;
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_block_hash_index_initialize(
+	          &block_hash_index,
+	          1000,
+	          LIBVSMBR_DIGEST_TYPE_SHA256,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "block_hash_index",
+	 block_hash_index );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_block_hash_index_initialize(
+	          &block_hash_index,
+	          VSMBR_TEST_BLOCK_HASH_INDEX_BLOCK_SIZE,
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "block_hash_index",
+	 block_hash_index );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSMBR_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvsmbr_block_hash_index_initialize with malloc failing
+		 */
+		vsmbr_test_malloc_attempts_before_fail = test_number;
+
+		result = libvsmbr_block_hash_index_initialize(
+		          &block_hash_index,
+		          VSMBR_TEST_BLOCK_HASH_INDEX_BLOCK_SIZE,
+		          LIBVSMBR_DIGEST_TYPE_SHA256,
+		          &error );
+
+		if( vsmbr_test_malloc_attempts_before_fail != -1 )
+		{
+			vsmbr_test_malloc_attempts_before_fail = -1;
+
+			if( block_hash_index != NULL )
+			{
+				libvsmbr_block_hash_index_free(
+				 &block_hash_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSMBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSMBR_TEST_ASSERT_IS_NULL(
+			 "block_hash_index",
+			 block_hash_index );
+
+			VSMBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvsmbr_block_hash_index_initialize with memset failing
+		 */
+		vsmbr_test_memset_attempts_before_fail = test_number;
+
+		result = libvsmbr_block_hash_index_initialize(
+		          &block_hash_index,
+		          VSMBR_TEST_BLOCK_HASH_INDEX_BLOCK_SIZE,
+		          LIBVSMBR_DIGEST_TYPE_SHA256,
+		          &error );
+
+		if( vsmbr_test_memset_attempts_before_fail != -1 )
+		{
+			vsmbr_test_memset_attempts_before_fail = -1;
+
+			if( block_hash_index != NULL )
+			{
+				libvsmbr_block_hash_index_free(
+				 &block_hash_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSMBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSMBR_TEST_ASSERT_IS_NULL(
+			 "block_hash_index",
+			 block_hash_index );
+
+			VSMBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_VSMBR_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_hash_index != NULL )
+	{
+		libvsmbr_block_hash_index_free(
+		 &block_hash_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_block_hash_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_block_hash_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvsmbr_block_hash_index_free(
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_block_hash_index_build_from_partition function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_block_hash_index_build_from_partition(
+     void )
+{
+	off64_t block_offset                          = 0;
+	libcerror_error_t *error                      = NULL;
+	libvsmbr_block_hash_index_t *block_hash_index = NULL;
+	size64_t block_size                           = 0;
+	size64_t data_size                            = 0;
+	uint64_t number_of_blocks                     = 0;
+	int result                                    = 0;
+
+	result = libvsmbr_block_hash_index_initialize(
+	          &block_hash_index,
+	          VSMBR_TEST_BLOCK_HASH_INDEX_BLOCK_SIZE,
+	          LIBVSMBR_DIGEST_TYPE_FNV1A_64,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = vsmbr_test_block_hash_index_build_from_image(
+	          block_hash_index,
+	          vsmbr_test_block_hash_index_image_data,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_block_hash_index_get_data_size(
+	          block_hash_index,
+	          &data_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "data_size",
+	 (uint64_t) data_size,
+	 (uint64_t) VSMBR_TEST_BLOCK_HASH_INDEX_PARTITION_SIZE );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_block_hash_index_get_number_of_blocks(
+	          block_hash_index,
+	          &number_of_blocks,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_blocks",
+	 number_of_blocks,
+	 (uint64_t) 16 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The last block only covers the remainder of the partition
+	 */
+	result = libvsmbr_block_hash_index_get_block_range(
+	          block_hash_index,
+	          15,
+	          &block_offset,
+	          &block_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "block_offset",
+	 (int64_t) block_offset,
+	 (int64_t) 61440 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "block_size",
+	 (uint64_t) block_size,
+	 (uint64_t) 3584 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_block_hash_index_build_from_partition(
+	          NULL,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_block_hash_index_build_from_partition(
+	          block_hash_index,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_block_hash_index_get_block_range(
+	          block_hash_index,
+	          16,
+	          &block_offset,
+	          &block_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_block_hash_index_free(
+	          &block_hash_index,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_hash_index != NULL )
+	{
+		libvsmbr_block_hash_index_free(
+		 &block_hash_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_block_hash_index_get_next_changed_block function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_block_hash_index_get_next_changed_block(
+     void )
+{
+	libcerror_error_t *error                              = NULL;
+	libvsmbr_block_hash_index_t *block_hash_index         = NULL;
+	libvsmbr_block_hash_index_t *changed_block_hash_index = NULL;
+	libvsmbr_block_hash_index_t *other_block_hash_index    = NULL;
+	uint64_t block_index                                  = 0;
+	int result                                            = 0;
+
+	result = libvsmbr_block_hash_index_initialize(
+	          &block_hash_index,
+	          VSMBR_TEST_BLOCK_HASH_INDEX_BLOCK_SIZE,
+	          LIBVSMBR_DIGEST_TYPE_SHA256,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_block_hash_index_build_from_image(
+	          block_hash_index,
+	          vsmbr_test_block_hash_index_image_data,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_block_hash_index_initialize(
+	          &changed_block_hash_index,
+	          VSMBR_TEST_BLOCK_HASH_INDEX_BLOCK_SIZE,
+	          LIBVSMBR_DIGEST_TYPE_SHA256,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_block_hash_index_build_from_image(
+	          changed_block_hash_index,
+	          vsmbr_test_block_hash_index_changed_image_data,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_block_hash_index_get_next_changed_block(
+	          block_hash_index,
+	          block_hash_index,
+	          0,
+	          &block_index,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_block_hash_index_get_next_changed_block(
+	          block_hash_index,
+	          changed_block_hash_index,
+	          0,
+	          &block_index,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "block_index",
+	 block_index,
+	 (uint64_t) 5 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_block_hash_index_get_next_changed_block(
+	          block_hash_index,
+	          changed_block_hash_index,
+	          block_index + 1,
+	          &block_index,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_block_hash_index_initialize(
+	          &other_block_hash_index,
+	          VSMBR_TEST_BLOCK_HASH_INDEX_BLOCK_SIZE,
+	          LIBVSMBR_DIGEST_TYPE_FNV1A_64,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_block_hash_index_get_next_changed_block(
+	          block_hash_index,
+	          other_block_hash_index,
+	          0,
+	          &block_index,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_block_hash_index_get_next_changed_block(
+	          NULL,
+	          changed_block_hash_index,
+	          0,
+	          &block_index,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_block_hash_index_get_next_changed_block(
+	          block_hash_index,
+	          NULL,
+	          0,
+	          &block_index,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_block_hash_index_get_next_changed_block(
+	          block_hash_index,
+	          changed_block_hash_index,
+	          0,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_block_hash_index_free(
+	          &other_block_hash_index,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_block_hash_index_free(
+	          &changed_block_hash_index,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_block_hash_index_free(
+	          &block_hash_index,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( other_block_hash_index != NULL )
+	{
+		libvsmbr_block_hash_index_free(
+		 &other_block_hash_index,
+		 NULL );
+	}
+	if( changed_block_hash_index != NULL )
+	{
+		libvsmbr_block_hash_index_free(
+		 &changed_block_hash_index,
+		 NULL );
+	}
+	if( block_hash_index != NULL )
+	{
+		libvsmbr_block_hash_index_free(
+		 &block_hash_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_block_hash_index_write_file_io_handle and libvsmbr_block_hash_index_read_file_io_handle functions
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_block_hash_index_write_and_read_file_io_handle(
+     void )
+{
+	uint8_t file_data[ 40 + ( 16 * 32 ) ];
+	uint8_t digest[ 32 ];
+	uint8_t read_digest[ 32 ];
+
+	libbfio_handle_t *file_io_handle                   = NULL;
+	libcerror_error_t *error                           = NULL;
+	libvsmbr_block_hash_index_t *block_hash_index      = NULL;
+	libvsmbr_block_hash_index_t *read_block_hash_index = NULL;
+	uint64_t block_index                               = 0;
+	uint64_t number_of_blocks                          = 0;
+	uint32_t block_size                                = 0;
+	int digest_type                                    = 0;
+	int result                                         = 0;
+
+	result = libvsmbr_block_hash_index_initialize(
+	          &block_hash_index,
+	          VSMBR_TEST_BLOCK_HASH_INDEX_BLOCK_SIZE,
+	          LIBVSMBR_DIGEST_TYPE_SHA256,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_block_hash_index_build_from_image(
+	          block_hash_index,
+	          vsmbr_test_block_hash_index_image_data,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          file_data,
+	          40 + ( 16 * 32 ),
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_block_hash_index_write_file_io_handle(
+	          block_hash_index,
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_block_hash_index_initialize(
+	          &read_block_hash_index,
+	          512,
+	          LIBVSMBR_DIGEST_TYPE_FNV1A_64,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_block_hash_index_read_file_io_handle(
+	          read_block_hash_index,
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_block_hash_index_get_block_size(
+	          read_block_hash_index,
+	          &block_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "block_size",
+	 block_size,
+	 (uint32_t) VSMBR_TEST_BLOCK_HASH_INDEX_BLOCK_SIZE );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_block_hash_index_get_digest_type(
+	          read_block_hash_index,
+	          &digest_type,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "digest_type",
+	 digest_type,
+	 LIBVSMBR_DIGEST_TYPE_SHA256 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_block_hash_index_get_number_of_blocks(
+	          read_block_hash_index,
+	          &number_of_blocks,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_blocks",
+	 number_of_blocks,
+	 (uint64_t) 16 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( block_index = 0;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		result = libvsmbr_block_hash_index_get_digest(
+		          block_hash_index,
+		          block_index,
+		          digest,
+		          32,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_block_hash_index_get_digest(
+		          read_block_hash_index,
+		          block_index,
+		          read_digest,
+		          32,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          digest,
+		          read_digest,
+		          32 );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = libvsmbr_block_hash_index_get_digest(
+	          read_block_hash_index,
+	          0,
+	          read_digest,
+	          8,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_block_hash_index_write_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_block_hash_index_read_file_io_handle(
+	          read_block_hash_index,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an invalid signature
+	 */
+	file_data[ 0 ] = 0xff;
+
+	result = libvsmbr_block_hash_index_read_file_io_handle(
+	          read_block_hash_index,
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_block_hash_index_free(
+	          &read_block_hash_index,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_block_hash_index_free(
+	          &block_hash_index,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( read_block_hash_index != NULL )
+	{
+		libvsmbr_block_hash_index_free(
+		 &read_block_hash_index,
+		 NULL );
+	}
+	if( block_hash_index != NULL )
+	{
+		libvsmbr_block_hash_index_free(
+		 &block_hash_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argc )
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+	if( vsmbr_test_image_fill(
+	     vsmbr_test_block_hash_index_image_data,
+	     VSMBR_TEST_BLOCK_HASH_INDEX_IMAGE_SIZE,
+	     0,
+	     0,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+
+	if( vsmbr_test_image_fill(
+	     vsmbr_test_block_hash_index_changed_image_data,
+	     VSMBR_TEST_BLOCK_HASH_INDEX_IMAGE_SIZE,
+	     0,
+	     0,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+
+	/* Change a byte in the 6th block of the partition
+	 */
+	vsmbr_test_block_hash_index_changed_image_data[ 512 + ( 5 * VSMBR_TEST_BLOCK_HASH_INDEX_BLOCK_SIZE ) + 100 ] ^= 0xff;
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_block_hash_index_initialize",
+	 vsmbr_test_block_hash_index_initialize );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_block_hash_index_free",
+	 vsmbr_test_block_hash_index_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_block_hash_index_build_from_partition",
+	 vsmbr_test_block_hash_index_build_from_partition );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_block_hash_index_get_next_changed_block",
+	 vsmbr_test_block_hash_index_get_next_changed_block );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_block_hash_index_write_file_io_handle",
+	 vsmbr_test_block_hash_index_write_and_read_file_io_handle );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
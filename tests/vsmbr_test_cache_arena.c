@@ -0,0 +1,1738 @@
+/*
+ * Library cache_arena type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsmbr_test_functions.h"
+#include "vsmbr_test_image.h"
+#include "vsmbr_test_libbfio.h"
+#include "vsmbr_test_libcerror.h"
+#include "vsmbr_test_libvsmbr.h"
+#include "vsmbr_test_macros.h"
+#include "vsmbr_test_memory.h"
+#include "vsmbr_test_unused.h"
+
+#include "../libvsmbr/libvsmbr_cache_arena.h"
+#include "../libvsmbr/libvsmbr_cache_arena_block.h"
+
+/* The test images consist of a MBR with a single partition
+ * of 63 sectors starting at sector 1, the partition data differs per image
+ */
+#define VSMBR_TEST_CACHE_ARENA_IMAGE_SIZE		32768
+
+#define VSMBR_TEST_CACHE_ARENA_NUMBER_OF_VOLUMES	2
+
+uint8_t vsmbr_test_cache_arena_image_data[ VSMBR_TEST_CACHE_ARENA_NUMBER_OF_VOLUMES ][ VSMBR_TEST_CACHE_ARENA_IMAGE_SIZE ];
+
+/* Tests the libvsmbr_cache_arena_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_cache_arena_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libvsmbr_cache_arena_t *cache_arena = NULL;
+	int result                          = 0;
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_cache_arena_initialize(
+	          &cache_arena,
+	          1024 * 1024,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_arena",
+	 cache_arena );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_cache_arena_free(
+	          &cache_arena,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "cache_arena",
+	 cache_arena );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_cache_arena_initialize(
+	          NULL,
+	          1024 * 1024,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	cache_arena = (libvsmbr_cache_arena_t *) 0x12345678UL;
+
+	result = libvsmbr_cache_arena_initialize(
+	          &cache_arena,
+	          1024 * 1024,
+	          &error );
+
+	cache_arena = NULL;
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_cache_arena_initialize(
+	          &cache_arena,
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache_arena != NULL )
+	{
+		libvsmbr_cache_arena_free(
+		 &cache_arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_cache_arena_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_cache_arena_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvsmbr_cache_arena_free(
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_cache_arena_get_maximum_size and
+ * libvsmbr_cache_arena_set_maximum_size functions
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_cache_arena_maximum_size(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libvsmbr_cache_arena_t *cache_arena = NULL;
+	size64_t maximum_size               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libvsmbr_cache_arena_initialize(
+	          &cache_arena,
+	          1024 * 1024,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_cache_arena_get_maximum_size(
+	          cache_arena,
+	          &maximum_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "maximum_size",
+	 maximum_size,
+	 (uint64_t) 1024 * 1024 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_cache_arena_set_maximum_size(
+	          cache_arena,
+	          65536,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_cache_arena_get_maximum_size(
+	          cache_arena,
+	          &maximum_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "maximum_size",
+	 maximum_size,
+	 (uint64_t) 65536 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_cache_arena_get_maximum_size(
+	          NULL,
+	          &maximum_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_cache_arena_get_maximum_size(
+	          cache_arena,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_cache_arena_set_maximum_size(
+	          NULL,
+	          65536,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_cache_arena_set_maximum_size(
+	          cache_arena,
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_cache_arena_free(
+	          &cache_arena,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache_arena != NULL )
+	{
+		libvsmbr_cache_arena_free(
+		 &cache_arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_cache_arena_get_replacement_policy and libvsmbr_cache_arena_set_replacement_policy functions
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_cache_arena_replacement_policy(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libvsmbr_cache_arena_t *cache_arena = NULL;
+	int replacement_policy              = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libvsmbr_cache_arena_initialize(
+	          &cache_arena,
+	          1024 * 1024,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_cache_arena_get_replacement_policy(
+	          cache_arena,
+	          &replacement_policy,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "replacement_policy",
+	 replacement_policy,
+	 LIBVSMBR_CACHE_REPLACEMENT_POLICY_LEAST_RECENTLY_USED );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_cache_arena_set_replacement_policy(
+	          cache_arena,
+	          LIBVSMBR_CACHE_REPLACEMENT_POLICY_TWO_QUEUE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_cache_arena_get_replacement_policy(
+	          cache_arena,
+	          &replacement_policy,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "replacement_policy",
+	 replacement_policy,
+	 LIBVSMBR_CACHE_REPLACEMENT_POLICY_TWO_QUEUE );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_cache_arena_get_replacement_policy(
+	          NULL,
+	          &replacement_policy,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_cache_arena_get_replacement_policy(
+	          cache_arena,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_cache_arena_set_replacement_policy(
+	          NULL,
+	          LIBVSMBR_CACHE_REPLACEMENT_POLICY_TWO_QUEUE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_cache_arena_set_replacement_policy(
+	          cache_arena,
+	          99,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_cache_arena_free(
+	          &cache_arena,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache_arena != NULL )
+	{
+		libvsmbr_cache_arena_free(
+		 &cache_arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+/* Reads a block from the cache arena or inserts it if it is not cached
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_cache_arena_read_or_insert_block(
+     libvsmbr_cache_arena_t *cache_arena,
+     uint32_t owner_identifier,
+     off64_t offset,
+     int *number_of_hits,
+     libcerror_error_t **error )
+{
+	uint8_t block_data[ 512 ];
+	uint8_t data[ 512 ];
+
+	size_t read_size       = 0;
+	uint8_t evicted_blocks = 0;
+	int result             = 0;
+
+	if( memory_set(
+	     block_data,
+	     (int) ( owner_identifier + ( offset / 512 ) ),
+	     512 ) == NULL )
+	{
+		return( -1 );
+	}
+	result = libvsmbr_cache_arena_read_block(
+	          cache_arena,
+	          owner_identifier,
+	          offset,
+	          0,
+	          data,
+	          512,
+	          &read_size,
+	          error );
+
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( ( read_size != 512 )
+		 || ( memory_compare(
+		       data,
+		       block_data,
+		       512 ) != 0 ) )
+		{
+			return( -1 );
+		}
+		*number_of_hits += 1;
+
+		return( 1 );
+	}
+	return( libvsmbr_cache_arena_insert_block(
+	         cache_arena,
+	         owner_identifier,
+	         offset,
+	         block_data,
+	         512,
+	         0,
+	         &evicted_blocks,
+	         error ) );
+}
+
+/* Reads 2 hot blocks of owner 1 interleaved with a sequential scan of owner 2
+ * in a cache arena that can contain 8 blocks
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_cache_arena_run_mixed_workload(
+     libvsmbr_cache_arena_t *cache_arena,
+     int *number_of_hot_hits,
+     libcerror_error_t **error )
+{
+	off64_t offset            = 0;
+	off64_t scan_offset       = 0;
+	int block_index           = 0;
+	int number_of_hits        = 0;
+	int number_of_scan_blocks = 0;
+	int pass                  = 0;
+
+	for( pass = 0;
+	     pass < 3;
+	     pass++ )
+	{
+		number_of_hits = 0;
+
+		for( offset = 0;
+		     offset < 1024;
+		     offset += 512 )
+		{
+			if( vsmbr_test_cache_arena_read_or_insert_block(
+			     cache_arena,
+			     1,
+			     offset,
+			     &number_of_hits,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+		if( pass == 2 )
+		{
+			break;
+		}
+		/* The first scan replaces the hot blocks, the second scan
+		 * is a long sequential pass
+		 */
+		if( pass == 0 )
+		{
+			number_of_scan_blocks = 7;
+		}
+		else
+		{
+			number_of_scan_blocks = 24;
+		}
+		for( block_index = 0;
+		     block_index < number_of_scan_blocks;
+		     block_index++ )
+		{
+			if( vsmbr_test_cache_arena_read_or_insert_block(
+			     cache_arena,
+			     2,
+			     scan_offset,
+			     &number_of_hits,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			scan_offset += 512;
+		}
+	}
+	*number_of_hot_hits = number_of_hits;
+
+	return( 1 );
+}
+
+/* Tests the replacement policies with a mixed workload
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_cache_arena_mixed_workload(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libvsmbr_cache_arena_t *cache_arena = NULL;
+	size64_t size                       = 0;
+	int number_of_blocks                = 0;
+	int number_of_hot_hits              = 0;
+	int result                          = 0;
+
+	/* Test the least recently used policy, of which the scan evicts the hot blocks
+	 */
+	result = libvsmbr_cache_arena_initialize(
+	          &cache_arena,
+	          8 * ( sizeof( libvsmbr_cache_arena_block_t ) + 512 ),
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_cache_arena_run_mixed_workload(
+	          cache_arena,
+	          &number_of_hot_hits,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_hot_hits",
+	 number_of_hot_hits,
+	 0 );
+
+	result = libvsmbr_cache_arena_free(
+	          &cache_arena,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the two queue policy, of which the scan does not evict the hot blocks
+	 */
+	result = libvsmbr_cache_arena_initialize(
+	          &cache_arena,
+	          8 * ( sizeof( libvsmbr_cache_arena_block_t ) + 512 ),
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_cache_arena_set_replacement_policy(
+	          cache_arena,
+	          LIBVSMBR_CACHE_REPLACEMENT_POLICY_TWO_QUEUE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_cache_arena_run_mixed_workload(
+	          cache_arena,
+	          &number_of_hot_hits,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_hot_hits",
+	 number_of_hot_hits,
+	 2 );
+
+	/* Setting the least recently used policy removes the identifiers of evicted blocks
+	 */
+	result = libvsmbr_cache_arena_set_replacement_policy(
+	          cache_arena,
+	          LIBVSMBR_CACHE_REPLACEMENT_POLICY_LEAST_RECENTLY_USED,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_cache_arena_get_number_of_blocks(
+	          cache_arena,
+	          &number_of_blocks,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_cache_arena_get_size(
+	          cache_arena,
+	          &size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 size,
+	 (uint64_t) ( number_of_blocks * ( sizeof( libvsmbr_cache_arena_block_t ) + 512 ) ) );
+
+	/* The hot blocks remain cached
+	 */
+	number_of_hot_hits = 0;
+
+	result = vsmbr_test_cache_arena_read_or_insert_block(
+	          cache_arena,
+	          1,
+	          0,
+	          &number_of_hot_hits,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_hot_hits",
+	 number_of_hot_hits,
+	 1 );
+
+	/* Clean up
+	 */
+	result = libvsmbr_cache_arena_free(
+	          &cache_arena,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache_arena != NULL )
+	{
+		libvsmbr_cache_arena_free(
+		 &cache_arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_cache_arena_insert_block function with the low priority flag
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_cache_arena_insert_block_with_low_priority(
+     void )
+{
+	uint8_t block_data[ 512 ];
+
+	libcerror_error_t *error            = NULL;
+	libvsmbr_cache_arena_t *cache_arena = NULL;
+	off64_t offset                      = 0;
+	uint8_t evicted_blocks              = 0;
+	int number_of_hot_hits              = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libvsmbr_cache_arena_initialize(
+	          &cache_arena,
+	          8 * ( sizeof( libvsmbr_cache_arena_block_t ) + 512 ),
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( offset = 0;
+	     offset < ( 8 * 512 );
+	     offset += 512 )
+	{
+		result = vsmbr_test_cache_arena_read_or_insert_block(
+		          cache_arena,
+		          1,
+		          offset,
+		          &number_of_hot_hits,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( memory_set(
+	     block_data,
+	     0xff,
+	     512 ) == NULL )
+	{
+		goto on_error;
+	}
+
+	/* Test a low priority insert of a block that is cached, which is not replaced
+	 */
+	result = libvsmbr_cache_arena_insert_block(
+	          cache_arena,
+	          1,
+	          512,
+	          block_data,
+	          512,
+	          LIBVSMBR_CACHE_ARENA_INSERT_FLAG_LOW_PRIORITY,
+	          &evicted_blocks,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT8(
+	 "evicted_blocks",
+	 evicted_blocks,
+	 0 );
+
+	/* Test a sequential scan with low priority inserts, of which only
+	 * the first insert evicts a hot block
+	 */
+	for( offset = 0;
+	     offset < ( 24 * 512 );
+	     offset += 512 )
+	{
+		result = libvsmbr_cache_arena_insert_block(
+		          cache_arena,
+		          2,
+		          offset,
+		          block_data,
+		          512,
+		          LIBVSMBR_CACHE_ARENA_INSERT_FLAG_LOW_PRIORITY,
+		          &evicted_blocks,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		VSMBR_TEST_ASSERT_EQUAL_UINT8(
+		 "evicted_blocks",
+		 evicted_blocks,
+		 1 );
+	}
+	number_of_hot_hits = 0;
+
+	for( offset = 512;
+	     offset < ( 8 * 512 );
+	     offset += 512 )
+	{
+		result = vsmbr_test_cache_arena_read_or_insert_block(
+		          cache_arena,
+		          1,
+		          offset,
+		          &number_of_hot_hits,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_hot_hits",
+	 number_of_hot_hits,
+	 7 );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_cache_arena_insert_block(
+	          cache_arena,
+	          2,
+	          0,
+	          block_data,
+	          512,
+	          0xfe,
+	          &evicted_blocks,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_cache_arena_free(
+	          &cache_arena,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache_arena != NULL )
+	{
+		libvsmbr_cache_arena_free(
+		 &cache_arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_volume_set_cache_arena function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_volume_set_cache_arena(
+     void )
+{
+	uint8_t buffer[ 4096 ];
+	uint8_t expected_data[ 512 ];
+
+	libbfio_handle_t *file_io_handles[ VSMBR_TEST_CACHE_ARENA_NUMBER_OF_VOLUMES ] = {
+		NULL, NULL };
+	libvsmbr_partition_t *partitions[ VSMBR_TEST_CACHE_ARENA_NUMBER_OF_VOLUMES ] = {
+		NULL, NULL };
+	libvsmbr_volume_t *volumes[ VSMBR_TEST_CACHE_ARENA_NUMBER_OF_VOLUMES ] = {
+		NULL, NULL };
+
+	libcerror_error_t *error            = NULL;
+	libvsmbr_cache_arena_t *cache_arena = NULL;
+	size64_t block_size                 = 0;
+	size64_t size                       = 0;
+	ssize_t read_count                  = 0;
+	ssize_t write_count                 = 0;
+	int number_of_blocks                = 0;
+	int result                          = 0;
+	int volume_index                    = 0;
+
+	/* Initialize test
+	 * The cache arena has room for 4 sectors of all volumes together
+	 */
+	block_size = sizeof( libvsmbr_cache_arena_block_t ) + 512;
+
+	result = libvsmbr_cache_arena_initialize(
+	          &cache_arena,
+	          4 * block_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( volume_index = 0;
+	     volume_index < VSMBR_TEST_CACHE_ARENA_NUMBER_OF_VOLUMES;
+	     volume_index++ )
+	{
+		result = vsmbr_test_image_fill(
+		          vsmbr_test_cache_arena_image_data[ volume_index ],
+		          VSMBR_TEST_CACHE_ARENA_IMAGE_SIZE,
+		          (uint8_t) ( 1 + volume_index ),
+		          0,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_memory_range_initialize(
+		          &( file_io_handles[ volume_index ] ),
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_memory_range_set(
+		          file_io_handles[ volume_index ],
+		          vsmbr_test_cache_arena_image_data[ volume_index ],
+		          VSMBR_TEST_CACHE_ARENA_IMAGE_SIZE,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_volume_initialize(
+		          &( volumes[ volume_index ] ),
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		result = libvsmbr_volume_set_cache_arena(
+		          volumes[ volume_index ],
+		          cache_arena,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_volume_open_file_io_handle(
+		          volumes[ volume_index ],
+		          file_io_handles[ volume_index ],
+		          LIBVSMBR_OPEN_READ_WRITE,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_volume_get_partition_by_index(
+		          volumes[ volume_index ],
+		          0,
+		          &( partitions[ volume_index ] ),
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Reading 8 sectors of the first partition evicts the 4 least recently used
+	 */
+	read_count = libvsmbr_partition_read_buffer_at_offset(
+	              partitions[ 0 ],
+	              buffer,
+	              4096,
+	              0,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4096 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( vsmbr_test_cache_arena_image_data[ 0 ][ 512 ] ),
+	          4096 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libvsmbr_cache_arena_get_number_of_blocks(
+	          cache_arena,
+	          &number_of_blocks,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_blocks",
+	 number_of_blocks,
+	 4 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_cache_arena_get_size(
+	          cache_arena,
+	          &size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 size,
+	 (uint64_t) 4 * block_size );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The sectors of the second partition evict those of the first partition
+	 */
+	read_count = libvsmbr_partition_read_buffer_at_offset(
+	              partitions[ 1 ],
+	              buffer,
+	              1024,
+	              100,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1024 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( vsmbr_test_cache_arena_image_data[ 1 ][ 612 ] ),
+	          1024 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libvsmbr_cache_arena_get_number_of_blocks(
+	          cache_arena,
+	          &number_of_blocks,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_blocks",
+	 number_of_blocks,
+	 4 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Sector data that is cached is not read again after the data was written
+	 */
+	read_count = libvsmbr_partition_read_buffer_at_offset(
+	              partitions[ 1 ],
+	              buffer,
+	              512,
+	              512,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 expected_data,
+	 0xa5,
+	 512 );
+
+	write_count = libvsmbr_partition_write_buffer_at_offset(
+	               partitions[ 1 ],
+	               expected_data,
+	               512,
+	               512,
+	               &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 512 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_partition_flush(
+	          partitions[ 1 ],
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libvsmbr_partition_read_buffer_at_offset(
+	              partitions[ 1 ],
+	              buffer,
+	              512,
+	              512,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          expected_data,
+	          512 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Reducing the maximum size evicts sector data
+	 */
+	result = libvsmbr_cache_arena_set_maximum_size(
+	          cache_arena,
+	          block_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_cache_arena_get_number_of_blocks(
+	          cache_arena,
+	          &number_of_blocks,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_blocks",
+	 number_of_blocks,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_volume_set_cache_arena(
+	          NULL,
+	          cache_arena,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_volume_set_cache_arena(
+	          volumes[ 0 ],
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The cache arena cannot be freed while partitions use it
+	 */
+	result = libvsmbr_cache_arena_free(
+	          &cache_arena,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_arena",
+	 cache_arena );
+
+	/* Clean up
+	 */
+	for( volume_index = 0;
+	     volume_index < VSMBR_TEST_CACHE_ARENA_NUMBER_OF_VOLUMES;
+	     volume_index++ )
+	{
+		result = libvsmbr_partition_free(
+		          &( partitions[ volume_index ] ),
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_volume_free(
+		          &( volumes[ volume_index ] ),
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_free(
+		          &( file_io_handles[ volume_index ] ),
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The sector data of freed partitions is removed from the cache arena
+	 */
+	result = libvsmbr_cache_arena_get_size(
+	          cache_arena,
+	          &size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 size,
+	 (uint64_t) 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_cache_arena_free(
+	          &cache_arena,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( volume_index = 0;
+	     volume_index < VSMBR_TEST_CACHE_ARENA_NUMBER_OF_VOLUMES;
+	     volume_index++ )
+	{
+		if( partitions[ volume_index ] != NULL )
+		{
+			libvsmbr_partition_free(
+			 &( partitions[ volume_index ] ),
+			 NULL );
+		}
+		if( volumes[ volume_index ] != NULL )
+		{
+			libvsmbr_volume_free(
+			 &( volumes[ volume_index ] ),
+			 NULL );
+		}
+		if( file_io_handles[ volume_index ] != NULL )
+		{
+			libbfio_handle_free(
+			 &( file_io_handles[ volume_index ] ),
+			 NULL );
+		}
+	}
+	if( cache_arena != NULL )
+	{
+		libvsmbr_cache_arena_free(
+		 &cache_arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argc )
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_cache_arena_initialize",
+	 vsmbr_test_cache_arena_initialize );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_cache_arena_free",
+	 vsmbr_test_cache_arena_free );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_cache_arena_maximum_size",
+	 vsmbr_test_cache_arena_maximum_size );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_cache_arena_replacement_policy",
+	 vsmbr_test_cache_arena_replacement_policy );
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_cache_arena_mixed_workload",
+	 vsmbr_test_cache_arena_mixed_workload );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_cache_arena_insert_block_with_low_priority",
+	 vsmbr_test_cache_arena_insert_block_with_low_priority );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_volume_set_cache_arena",
+	 vsmbr_test_volume_set_cache_arena );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
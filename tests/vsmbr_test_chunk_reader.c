@@ -0,0 +1,1209 @@
+/*
+ * Library chunk_reader type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsmbr_test_functions.h"
+#include "vsmbr_test_image.h"
+#include "vsmbr_test_libbfio.h"
+#include "vsmbr_test_libcerror.h"
+#include "vsmbr_test_libvsmbr.h"
+#include "vsmbr_test_macros.h"
+#include "vsmbr_test_memory.h"
+#include "vsmbr_test_unused.h"
+
+#include "../libvsmbr/libvsmbr_chunk_reader.h"
+
+/* The test image consists of a MBR with a single partition
+ * of 127 sectors starting at sector 1
+ */
+#define VSMBR_TEST_CHUNK_READER_IMAGE_SIZE	65536
+#define VSMBR_TEST_CHUNK_READER_PARTITION_SIZE	65024
+
+/* A chunk size that does not divide the partition size
+ */
+#define VSMBR_TEST_CHUNK_READER_CHUNK_SIZE	3000
+
+uint8_t vsmbr_test_chunk_reader_image_data[ VSMBR_TEST_CHUNK_READER_IMAGE_SIZE ];
+
+/* Opens the first partition of the test image
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_chunk_reader_open_partition(
+     libbfio_handle_t **file_io_handle,
+     libvsmbr_volume_t **volume,
+     libvsmbr_partition_t **partition,
+     libcerror_error_t **error )
+{
+	if( vsmbr_test_open_file_io_handle(
+	     file_io_handle,
+	     vsmbr_test_chunk_reader_image_data,
+	     VSMBR_TEST_CHUNK_READER_IMAGE_SIZE,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libvsmbr_volume_initialize(
+	     volume,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libvsmbr_volume_open_file_io_handle(
+	     *volume,
+	     *file_io_handle,
+	     LIBVSMBR_OPEN_READ,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libvsmbr_volume_get_partition_by_index(
+	     *volume,
+	     0,
+	     partition,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the first partition of the test image
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_chunk_reader_close_partition(
+     libbfio_handle_t **file_io_handle,
+     libvsmbr_volume_t **volume,
+     libvsmbr_partition_t **partition,
+     libcerror_error_t **error )
+{
+	int result = 1;
+
+	if( *partition != NULL )
+	{
+		if( libvsmbr_partition_free(
+		     partition,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *volume != NULL )
+	{
+		if( libvsmbr_volume_close(
+		     *volume,
+		     error ) != 0 )
+		{
+			result = -1;
+		}
+		if( libvsmbr_volume_free(
+		     volume,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *file_io_handle != NULL )
+	{
+		if( vsmbr_test_close_file_io_handle(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Reads all chunks and compares them with the test image data
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_chunk_reader_read_all(
+     libvsmbr_partition_t *partition,
+     int number_of_buffers,
+     off64_t start_offset,
+     size64_t size,
+     size64_t expected_size )
+{
+	libcerror_error_t *error              = NULL;
+	libvsmbr_chunk_reader_t *chunk_reader = NULL;
+	const uint8_t *data                   = NULL;
+	size64_t total_size                   = 0;
+	size_t data_size                      = 0;
+	int result                            = 0;
+
+	result = libvsmbr_chunk_reader_initialize(
+	          &chunk_reader,
+	          partition,
+	          VSMBR_TEST_CHUNK_READER_CHUNK_SIZE,
+	          number_of_buffers,
+	          start_offset,
+	          size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	do
+	{
+		result = libvsmbr_chunk_reader_get_next_chunk(
+		          chunk_reader,
+		          &data,
+		          &data_size,
+		          &error );
+
+		VSMBR_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 0 )
+		{
+			break;
+		}
+		VSMBR_TEST_ASSERT_IS_NOT_NULL(
+		 "data",
+		 data );
+
+		VSMBR_TEST_ASSERT_LESS_THAN_UINT64(
+		 "data_size",
+		 (uint64_t) data_size,
+		 (uint64_t) VSMBR_TEST_CHUNK_READER_CHUNK_SIZE + 1 );
+
+		VSMBR_TEST_ASSERT_LESS_THAN_UINT64(
+		 "total_size",
+		 (uint64_t) ( total_size + data_size ),
+		 (uint64_t) expected_size + 1 );
+
+		result = memory_compare(
+		          data,
+		          &( vsmbr_test_chunk_reader_image_data[ 512 + start_offset + total_size ] ),
+		          data_size );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		total_size += data_size;
+	}
+	while( data_size > 0 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "total_size",
+	 (uint64_t) total_size,
+	 (uint64_t) expected_size );
+
+	/* Test that the end of the data remains signalled
+	 */
+	result = libvsmbr_chunk_reader_get_next_chunk(
+	          chunk_reader,
+	          &data,
+	          &data_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_chunk_reader_free(
+	          &chunk_reader,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_reader != NULL )
+	{
+		libvsmbr_chunk_reader_free(
+		 &chunk_reader,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_chunk_reader_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_chunk_reader_initialize(
+     void )
+{
+	libbfio_handle_t *file_io_handle      = NULL;
+	libcerror_error_t *error              = NULL;
+	libvsmbr_chunk_reader_t *chunk_reader = NULL;
+	libvsmbr_partition_t *partition       = NULL;
+	libvsmbr_volume_t *volume             = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = vsmbr_test_chunk_reader_open_partition(
+	          &file_io_handle,
+	          &volume,
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_chunk_reader_initialize(
+	          &chunk_reader,
+	          partition,
+	          VSMBR_TEST_CHUNK_READER_CHUNK_SIZE,
+	          4,
+	          0,
+	          VSMBR_TEST_CHUNK_READER_PARTITION_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_reader",
+	 chunk_reader );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test free while the read-ahead thread is active
+	 */
+	result = libvsmbr_chunk_reader_free(
+	          &chunk_reader,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "chunk_reader",
+	 chunk_reader );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_chunk_reader_initialize(
+	          NULL,
+	          partition,
+	          VSMBR_TEST_CHUNK_READER_CHUNK_SIZE,
+	          4,
+	          0,
+	          VSMBR_TEST_CHUNK_READER_PARTITION_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chunk_reader = (libvsmbr_chunk_reader_t *) 0x12345678UL;
+
+	result = libvsmbr_chunk_reader_initialize(
+	          &chunk_reader,
+	          partition,
+	          VSMBR_TEST_CHUNK_READER_CHUNK_SIZE,
+	          4,
+	          0,
+	          VSMBR_TEST_CHUNK_READER_PARTITION_SIZE,
+	          &error );
+
+	chunk_reader = NULL;
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_chunk_reader_initialize(
+	          &chunk_reader,
+	          NULL,
+	          VSMBR_TEST_CHUNK_READER_CHUNK_SIZE,
+	          4,
+	          0,
+	          VSMBR_TEST_CHUNK_READER_PARTITION_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_chunk_reader_initialize(
+	          &chunk_reader,
+	          partition,
+	          0,
+	          4,
+	          0,
+	          VSMBR_TEST_CHUNK_READER_PARTITION_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_chunk_reader_initialize(
+	          &chunk_reader,
+	          partition,
+	          VSMBR_TEST_CHUNK_READER_CHUNK_SIZE,
+	          0,
+	          0,
+	          VSMBR_TEST_CHUNK_READER_PARTITION_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_chunk_reader_initialize(
+	          &chunk_reader,
+	          partition,
+	          VSMBR_TEST_CHUNK_READER_CHUNK_SIZE,
+	          4,
+	          -1,
+	          VSMBR_TEST_CHUNK_READER_PARTITION_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = vsmbr_test_chunk_reader_close_partition(
+	          &file_io_handle,
+	          &volume,
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_reader != NULL )
+	{
+		libvsmbr_chunk_reader_free(
+		 &chunk_reader,
+		 NULL );
+	}
+	vsmbr_test_chunk_reader_close_partition(
+	 &file_io_handle,
+	 &volume,
+	 &partition,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libvsmbr_chunk_reader_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_chunk_reader_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvsmbr_chunk_reader_free(
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_chunk_reader_get_next_chunk function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_chunk_reader_get_next_chunk(
+     void )
+{
+	libbfio_handle_t *file_io_handle      = NULL;
+	libcerror_error_t *error              = NULL;
+	libvsmbr_chunk_reader_t *chunk_reader = NULL;
+	libvsmbr_partition_t *partition       = NULL;
+	libvsmbr_volume_t *volume             = NULL;
+	const uint8_t *data                   = NULL;
+	size_t data_size                      = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = vsmbr_test_chunk_reader_open_partition(
+	          &file_io_handle,
+	          &volume,
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases without and with read-ahead
+	 */
+	result = vsmbr_test_chunk_reader_read_all(
+	          partition,
+	          1,
+	          100,
+	          60000,
+	          60000 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = vsmbr_test_chunk_reader_read_all(
+	          partition,
+	          4,
+	          100,
+	          60000,
+	          60000 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test that the size is bounded by the partition size
+	 */
+	result = vsmbr_test_chunk_reader_read_all(
+	          partition,
+	          2,
+	          100,
+	          (size64_t) 1024 * 1024,
+	          VSMBR_TEST_CHUNK_READER_PARTITION_SIZE - 100 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = vsmbr_test_chunk_reader_read_all(
+	          partition,
+	          4,
+	          VSMBR_TEST_CHUNK_READER_PARTITION_SIZE + 512,
+	          512,
+	          0 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_chunk_reader_initialize(
+	          &chunk_reader,
+	          partition,
+	          VSMBR_TEST_CHUNK_READER_CHUNK_SIZE,
+	          4,
+	          0,
+	          VSMBR_TEST_CHUNK_READER_PARTITION_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_chunk_reader_get_next_chunk(
+	          NULL,
+	          &data,
+	          &data_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_chunk_reader_get_next_chunk(
+	          chunk_reader,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_chunk_reader_get_next_chunk(
+	          chunk_reader,
+	          &data,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_chunk_reader_free(
+	          &chunk_reader,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_chunk_reader_close_partition(
+	          &file_io_handle,
+	          &volume,
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_reader != NULL )
+	{
+		libvsmbr_chunk_reader_free(
+		 &chunk_reader,
+		 NULL );
+	}
+	vsmbr_test_chunk_reader_close_partition(
+	 &file_io_handle,
+	 &volume,
+	 &partition,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Detaches the first chunk and reads the remaining chunks
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_chunk_reader_detach_first_chunk(
+     libvsmbr_partition_t *partition,
+     int number_of_buffers )
+{
+	libcerror_error_t *error              = NULL;
+	libvsmbr_chunk_reader_t *chunk_reader = NULL;
+	const uint8_t *data                   = NULL;
+	uint8_t *detached_data                = NULL;
+	size_t data_size                      = 0;
+	off64_t offset                        = 0;
+	int result                            = 0;
+
+	/* The chunk reader does not change the current offset of the partition
+	 */
+	offset = libvsmbr_partition_seek_offset(
+	          partition,
+	          1234,
+	          SEEK_SET,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 1234 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_chunk_reader_initialize(
+	          &chunk_reader,
+	          partition,
+	          VSMBR_TEST_CHUNK_READER_CHUNK_SIZE,
+	          number_of_buffers,
+	          0,
+	          VSMBR_TEST_CHUNK_READER_PARTITION_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* No chunk has been retrieved yet
+	 */
+	result = libvsmbr_chunk_reader_detach_chunk_data(
+	          chunk_reader,
+	          &detached_data,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "detached_data",
+	 detached_data );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_chunk_reader_get_next_chunk(
+	          chunk_reader,
+	          &data,
+	          &data_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) VSMBR_TEST_CHUNK_READER_CHUNK_SIZE );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_chunk_reader_detach_chunk_data(
+	          chunk_reader,
+	          &detached_data,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "detached_data",
+	 detached_data );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The detached data is not overwritten by the remaining chunks
+	 */
+	do
+	{
+		result = libvsmbr_chunk_reader_get_next_chunk(
+		          chunk_reader,
+		          &data,
+		          &data_size,
+		          &error );
+
+		VSMBR_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	while( result == 1 );
+
+	result = memory_compare(
+	          detached_data,
+	          &( vsmbr_test_chunk_reader_image_data[ 512 ] ),
+	          VSMBR_TEST_CHUNK_READER_CHUNK_SIZE );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libvsmbr_chunk_reader_free_chunk_data(
+	          &detached_data,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "detached_data",
+	 detached_data );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_chunk_reader_free(
+	          &chunk_reader,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_partition_get_offset(
+	          partition,
+	          &offset,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 1234 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( detached_data != NULL )
+	{
+		libvsmbr_chunk_reader_free_chunk_data(
+		 &detached_data,
+		 NULL );
+	}
+	if( chunk_reader != NULL )
+	{
+		libvsmbr_chunk_reader_free(
+		 &chunk_reader,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_chunk_reader_detach_chunk_data and
+ * libvsmbr_chunk_reader_free_chunk_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_chunk_reader_detach_chunk_data(
+     void )
+{
+	libbfio_handle_t *file_io_handle      = NULL;
+	libcerror_error_t *error              = NULL;
+	libvsmbr_chunk_reader_t *chunk_reader = NULL;
+	libvsmbr_partition_t *partition       = NULL;
+	libvsmbr_volume_t *volume             = NULL;
+	uint8_t *detached_data                = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = vsmbr_test_chunk_reader_open_partition(
+	          &file_io_handle,
+	          &volume,
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases without and with read-ahead
+	 */
+	result = vsmbr_test_chunk_reader_detach_first_chunk(
+	          partition,
+	          1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = vsmbr_test_chunk_reader_detach_first_chunk(
+	          partition,
+	          4 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_chunk_reader_initialize(
+	          &chunk_reader,
+	          partition,
+	          VSMBR_TEST_CHUNK_READER_CHUNK_SIZE,
+	          4,
+	          0,
+	          VSMBR_TEST_CHUNK_READER_PARTITION_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_chunk_reader_detach_chunk_data(
+	          NULL,
+	          &detached_data,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_chunk_reader_detach_chunk_data(
+	          chunk_reader,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_chunk_reader_free_chunk_data(
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_chunk_reader_free(
+	          &chunk_reader,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_chunk_reader_close_partition(
+	          &file_io_handle,
+	          &volume,
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_reader != NULL )
+	{
+		libvsmbr_chunk_reader_free(
+		 &chunk_reader,
+		 NULL );
+	}
+	vsmbr_test_chunk_reader_close_partition(
+	 &file_io_handle,
+	 &volume,
+	 &partition,
+	 NULL );
+
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argc )
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+	if( vsmbr_test_image_fill(
+	     vsmbr_test_chunk_reader_image_data,
+	     VSMBR_TEST_CHUNK_READER_IMAGE_SIZE,
+	     0,
+	     0,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_chunk_reader_initialize",
+	 vsmbr_test_chunk_reader_initialize );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_chunk_reader_free",
+	 vsmbr_test_chunk_reader_free );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_chunk_reader_get_next_chunk",
+	 vsmbr_test_chunk_reader_get_next_chunk );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_chunk_reader_detach_chunk_data",
+	 vsmbr_test_chunk_reader_detach_chunk_data );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
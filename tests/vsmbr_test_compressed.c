@@ -0,0 +1,2820 @@
+/*
+ * Library compressed image functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsmbr_test_image.h"
+#include "vsmbr_test_libbfio.h"
+#include "vsmbr_test_libcerror.h"
+#include "vsmbr_test_libvsmbr.h"
+#include "vsmbr_test_macros.h"
+#include "vsmbr_test_memory.h"
+#include "vsmbr_test_unused.h"
+
+#include "../libvsmbr/libvsmbr_compressed_io_handle.h"
+
+/* The test image consists of a MBR with a single partition
+ * of 584 sectors starting at sector 1
+ */
+#define VSMBR_TEST_COMPRESSED_IMAGE_SIZE		299520
+
+/* The offset of the last 4096 bytes of the image, that contain pseudo random data
+ */
+#define VSMBR_TEST_COMPRESSED_RANDOM_DATA_OFFSET	( VSMBR_TEST_COMPRESSED_IMAGE_SIZE - 4096 )
+
+#define VSMBR_TEST_COMPRESSED_NUMBER_OF_FRAMES		11
+
+/* The offset of the checksum in the footer of the second member
+ */
+#define VSMBR_TEST_COMPRESSED_FRAME1_CHECKSUM_OFFSET	1034
+
+uint8_t vsmbr_test_compressed_image_data[ VSMBR_TEST_COMPRESSED_IMAGE_SIZE ];
+
+uint8_t vsmbr_test_compressed_buffer[ VSMBR_TEST_COMPRESSED_IMAGE_SIZE ];
+
+/* The test image compressed with zlib as BGZF, the first member contains
+ * the MBR as a stored block, the next 9 members contain 32 KiB each of which
+ * the third and sixth use fixed Huffman blocks, the next member contains
+ * the pseudo random data and the last member is the BGZF end-of-file marker
+ */
+uint8_t vsmbr_test_compressed_data[ 8750 ] = {
+	0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x00, 0x42, 0x43, 0x02, 0x00,
+	0x1e, 0x02, 0x01, 0x00, 0x02, 0xff, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+	0x56, 0x34, 0x12, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x83, 0x09, 0x12, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x48, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xaa, 0x81, 0xb0, 0x6d, 0x2b, 0x00, 0x02, 0x00, 0x00, 0x1f,
+	0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x00, 0x42, 0x43, 0x02, 0x00, 0xf2,
+	0x01, 0xed, 0xcf, 0xd7, 0x3a, 0x10, 0x00, 0x00, 0x80, 0xd1, 0xaf, 0x92, 0xac, 0x94, 0xb2, 0x8b,
+	0xd0, 0x52, 0x22, 0x25, 0x91, 0x55, 0x48, 0xa2, 0x21, 0x2d, 0x4a, 0x44, 0x8b, 0xa6, 0x48, 0xa9,
+	0xac, 0x0a, 0x4d, 0x5a, 0x42, 0x19, 0x21, 0x42, 0x45, 0x76, 0xc8, 0x1e, 0x21, 0x23, 0x14, 0xed,
+	0x50, 0xa1, 0x92, 0x8a, 0x52, 0x51, 0x37, 0x5d, 0xf5, 0x16, 0xff, 0x79, 0x83, 0x63, 0xbe, 0x72,
+	0xdd, 0xa6, 0xad, 0xbb, 0xdc, 0x0e, 0xfb, 0x9d, 0x0c, 0xbe, 0x12, 0x79, 0xe3, 0x56, 0x7a, 0x6e,
+	0xf1, 0x83, 0xfa, 0x27, 0x2f, 0xdf, 0x7e, 0xfc, 0xf6, 0x6b, 0xb8, 0xf0, 0x58, 0x19, 0xc5, 0xa9,
+	0xb3, 0xb4, 0xf4, 0x8c, 0x97, 0x5a, 0xad, 0xb7, 0xdf, 0xb6, 0xdb, 0xfd, 0xc8, 0xb1, 0x53, 0xe7,
+	0x43, 0xa3, 0xe2, 0x6f, 0x67, 0xe4, 0x95, 0x54, 0x35, 0xb4, 0xbc, 0x7a, 0xf7, 0xa9, 0xef, 0xf7,
+	0x08, 0x11, 0x09, 0xd9, 0x49, 0xd3, 0xd4, 0xe7, 0xe9, 0x9b, 0x58, 0xac, 0xb2, 0x71, 0xd8, 0xbe,
+	0xe7, 0xc0, 0xd1, 0xe3, 0xa7, 0x2f, 0x84, 0x45, 0x27, 0xdc, 0xc9, 0xcc, 0x2f, 0xad, 0x7e, 0xd4,
+	0xfa, 0xfa, 0x7d, 0x4f, 0xff, 0xa0, 0x80, 0xe8, 0x38, 0x39, 0xa5, 0xe9, 0x1a, 0xda, 0x06, 0xa6,
+	0x96, 0xd6, 0xb6, 0x9b, 0x77, 0xec, 0xf5, 0xf0, 0x3a, 0x71, 0xe6, 0x62, 0xf8, 0xf5, 0x9b, 0x29,
+	0x59, 0xf7, 0xcb, 0x6a, 0x1a, 0x9f, 0xbe, 0xe9, 0xfc, 0xfc, 0x7d, 0x68, 0xa4, 0xd8, 0x78, 0x79,
+	0x65, 0xd5, 0xd9, 0xf3, 0x0d, 0x17, 0x2f, 0x5b, 0xbd, 0xc1, 0xd1, 0x79, 0xdf, 0x41, 0x6f, 0xff,
+	0xb3, 0x97, 0xae, 0xc6, 0x24, 0xa6, 0x66, 0x17, 0x94, 0x3f, 0x6c, 0x7a, 0xd6, 0xd6, 0xd5, 0xfb,
+	0xe3, 0x8f, 0xe0, 0x68, 0xc9, 0x09, 0x2a, 0x33, 0x34, 0x75, 0x8c, 0xcc, 0x96, 0xaf, 0xd9, 0xe8,
+	0xe4, 0xe2, 0x7a, 0xc8, 0x27, 0xe0, 0xdc, 0xe5, 0x6b, 0xb1, 0x49, 0x77, 0x73, 0x0a, 0x2b, 0x6a,
+	0x9b, 0x9f, 0xb7, 0x77, 0x7f, 0x19, 0xf8, 0x3b, 0x4a, 0x5c, 0x6a, 0xe2, 0xe4, 0x99, 0x73, 0x74,
+	0x17, 0x2e, 0x59, 0xb1, 0xd6, 0x6e, 0xcb, 0xce, 0xfd, 0x9e, 0xbe, 0x81, 0x41, 0x21, 0x11, 0x71,
+	0xc9, 0x69, 0xf7, 0x8a, 0x2a, 0xeb, 0x1e, 0xbf, 0xe8, 0xf8, 0xf0, 0xf5, 0xe7, 0x30, 0xa1, 0x31,
+	0xd2, 0x0a, 0x53, 0xd4, 0xe6, 0x2e, 0x58, 0x64, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53,
+	0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4,
+	0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75,
+	0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d,
+	0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7,
+	0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9,
+	0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea,
+	0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a,
+	0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e,
+	0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0xff, 0xaf, 0xff, 0x03, 0x62, 0xbf, 0x81, 0x31, 0x00, 0x80,
+	0x00, 0x00, 0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x00, 0x42, 0x43,
+	0x02, 0x00, 0x52, 0x02, 0x53, 0xd4, 0xd0, 0x37, 0xb3, 0x75, 0xf1, 0x0e, 0x8a, 0x4c, 0x48, 0xcf,
+	0x2b, 0xad, 0x69, 0xee, 0x9a, 0x38, 0x63, 0xfe, 0xb2, 0xb5, 0x5b, 0x76, 0x1f, 0x3a, 0x79, 0xe1,
+	0xfa, 0xbd, 0xa7, 0x6f, 0x3e, 0xff, 0x62, 0xe3, 0x15, 0x91, 0x56, 0xd2, 0x34, 0x30, 0xb7, 0x73,
+	0xf5, 0x09, 0x8e, 0x4a, 0xcc, 0xc8, 0x2f, 0xab, 0x6d, 0xe9, 0x9e, 0x34, 0x73, 0xc1, 0xf2, 0x75,
+	0x5b, 0xf7, 0x1c, 0x3e, 0x75, 0xf1, 0xc6, 0xfd, 0x67, 0x6f, 0xbf, 0xfc, 0x66, 0xe7, 0x13, 0x95,
+	0x51, 0xd6, 0x32, 0xb4, 0xb0, 0x77, 0xf3, 0x0d, 0x89, 0x4e, 0xca, 0x2c, 0x28, 0xaf, 0x6b, 0xed,
+	0x99, 0x3c, 0x6b, 0xe1, 0x8a, 0xf5, 0xdb, 0xf6, 0x1e, 0x39, 0x7d, 0xe9, 0xe6, 0x83, 0xe7, 0xef,
+	0xbe, 0x32, 0x72, 0xf0, 0x8b, 0xc9, 0xaa, 0x68, 0x1b, 0x59, 0x3a, 0xb8, 0xfb, 0x85, 0xc6, 0x24,
+	0x67, 0x15, 0x56, 0xd4, 0xb7, 0xf5, 0x4e, 0x99, 0xbd, 0x68, 0xe5, 0x86, 0xed, 0xfb, 0x8e, 0x9e,
+	0xb9, 0x7c, 0xeb, 0xe1, 0x8b, 0xf7, 0xdf, 0x98, 0x38, 0x05, 0xc4, 0xe5, 0x54, 0x75, 0x8c, 0xad,
+	0x1c, 0x3d, 0xfc, 0xc3, 0x62, 0x53, 0xb2, 0x8b, 0x2a, 0x1b, 0xda, 0xfb, 0xa6, 0xce, 0x59, 0xbc,
+	0x6a, 0xe3, 0x8e, 0xfd, 0xc7, 0xce, 0x5e, 0xb9, 0xfd, 0xe8, 0xe5, 0x87, 0xef, 0xcc, 0x5c, 0x82,
+	0x12, 0xf2, 0x6a, 0xba, 0x26, 0xd6, 0x4e, 0x9e, 0x01, 0xe1, 0x71, 0xa9, 0x39, 0xc5, 0x55, 0x8d,
+	0x1d, 0xfd, 0xd3, 0xe6, 0x2e, 0x59, 0xbd, 0x69, 0xe7, 0x81, 0xe3, 0xe7, 0xae, 0xde, 0x79, 0xfc,
+	0xea, 0xe3, 0x0f, 0x16, 0x6e, 0x21, 0x49, 0x05, 0x75, 0x3d, 0x53, 0x1b, 0x67, 0xaf, 0xc0, 0x88,
+	0xf8, 0xb4, 0xdc, 0x92, 0xea, 0xa6, 0xce, 0x09, 0xd3, 0xe7, 0x2d, 0x5d, 0xb3, 0x79, 0xd7, 0xc1,
+	0x13, 0xe7, 0xaf, 0xdd, 0x7d, 0xf2, 0xfa, 0xd3, 0x4f, 0x56, 0x1e, 0x61, 0x29, 0xc5, 0x51, 0xaf,
+	0x8f, 0x7a, 0x7d, 0xd4, 0xeb, 0xa3, 0x5e, 0x1f, 0xf5, 0xfa, 0xa8, 0xd7, 0x47, 0xbd, 0x3e, 0xea,
+	0xf5, 0x51, 0xaf, 0x8f, 0x7a, 0x7d, 0xd4, 0xeb, 0xa3, 0x5e, 0x1f, 0xf5, 0xfa, 0xa8, 0xd7, 0x47,
+	0xbd, 0x3e, 0xea, 0xf5, 0x51, 0xaf, 0x8f, 0x7a, 0x7d, 0xd4, 0xeb, 0xa3, 0x5e, 0x1f, 0xf5, 0xfa,
+	0xa8, 0xd7, 0x47, 0xbd, 0x3e, 0xea, 0xf5, 0x51, 0xaf, 0x8f, 0x7a, 0x7d, 0xd4, 0xeb, 0xa3, 0x5e,
+	0x1f, 0xf5, 0xfa, 0xa8, 0xd7, 0x47, 0xbd, 0x3e, 0xea, 0xf5, 0x51, 0xaf, 0x8f, 0x7a, 0x7d, 0xd4,
+	0xeb, 0xa3, 0x5e, 0x1f, 0xf5, 0xfa, 0xa8, 0xd7, 0x47, 0xbd, 0x3e, 0xea, 0xf5, 0x51, 0xaf, 0x8f,
+	0x7a, 0x7d, 0xd4, 0xeb, 0xa3, 0x5e, 0x1f, 0xf5, 0xfa, 0xa8, 0xd7, 0x47, 0xbd, 0x3e, 0xea, 0xf5,
+	0x51, 0xaf, 0x8f, 0x7a, 0x7d, 0xd4, 0xeb, 0xa3, 0x5e, 0x1f, 0xf5, 0xfa, 0xa8, 0xd7, 0x47, 0xbd,
+	0x3e, 0xea, 0xf5, 0x51, 0xaf, 0x8f, 0x7a, 0x7d, 0xd4, 0xeb, 0xa3, 0x5e, 0x1f, 0xf5, 0xfa, 0xa8,
+	0xd7, 0x47, 0xbd, 0x3e, 0xea, 0xf5, 0x51, 0xaf, 0x8f, 0x7a, 0x7d, 0xd4, 0xeb, 0xa3, 0x5e, 0x1f,
+	0xf5, 0xfa, 0xa8, 0xd7, 0x47, 0xbd, 0x3e, 0xea, 0xf5, 0x51, 0xaf, 0x8f, 0x7a, 0x7d, 0xd4, 0xeb,
+	0xa3, 0x5e, 0x1f, 0xf5, 0xfa, 0xa8, 0xd7, 0x47, 0xbd, 0x3e, 0xea, 0xf5, 0x51, 0xaf, 0x8f, 0x7a,
+	0x7d, 0xd4, 0xeb, 0xa3, 0x5e, 0x1f, 0xf5, 0xfa, 0xa8, 0xd7, 0x47, 0xbd, 0x3e, 0xea, 0xf5, 0x51,
+	0xaf, 0x8f, 0x7a, 0x7d, 0xd4, 0xeb, 0xa3, 0x5e, 0x1f, 0xf5, 0xfa, 0xa8, 0xd7, 0x47, 0xbd, 0x3e,
+	0xea, 0xf5, 0x51, 0xaf, 0x8f, 0x7a, 0x7d, 0xd4, 0xeb, 0xa3, 0x5e, 0x1f, 0xf5, 0xfa, 0xa8, 0xd7,
+	0x47, 0xbd, 0x3e, 0xea, 0xf5, 0x51, 0xaf, 0x8f, 0x7a, 0x7d, 0xd4, 0xeb, 0xa3, 0x5e, 0x1f, 0xf5,
+	0xfa, 0xa8, 0xd7, 0x47, 0xbd, 0x3e, 0xea, 0xf5, 0x51, 0xaf, 0x8f, 0x7a, 0x7d, 0xd4, 0xeb, 0xa3,
+	0x5e, 0x1f, 0xf5, 0xfa, 0xa8, 0xd7, 0x47, 0xbd, 0x3e, 0xea, 0xf5, 0x51, 0xaf, 0x8f, 0x7a, 0x7d,
+	0xd4, 0xeb, 0xa3, 0x5e, 0x1f, 0xf5, 0xfa, 0xa8, 0xd7, 0x61, 0x5e, 0x07, 0x00, 0x4c, 0x5c, 0x9e,
+	0x7b, 0x00, 0x80, 0x00, 0x00, 0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06,
+	0x00, 0x42, 0x43, 0x02, 0x00, 0xf0, 0x01, 0xed, 0xcf, 0xd7, 0x3a, 0x10, 0x00, 0x00, 0x80, 0xd1,
+	0x2f, 0x95, 0x26, 0x45, 0x8a, 0x4a, 0x65, 0xcf, 0xec, 0x86, 0x06, 0x91, 0x54, 0x2a, 0x84, 0x24,
+	0x7b, 0x85, 0x86, 0x76, 0x49, 0xf6, 0x6a, 0xd3, 0xa0, 0x41, 0x68, 0x67, 0x44, 0x45, 0x52, 0xd9,
+	0x34, 0x8c, 0x50, 0xb4, 0xad, 0xa6, 0x10, 0x25, 0xca, 0x08, 0x37, 0x5d, 0xf5, 0x16, 0xff, 0x79,
+	0x83, 0xd3, 0x27, 0x30, 0x66, 0xa2, 0xf8, 0x4c, 0xf9, 0xd9, 0x3a, 0x0b, 0x0d, 0x57, 0x9a, 0xaf,
+	0x77, 0xdc, 0xb8, 0x75, 0xf7, 0x81, 0x90, 0xc3, 0x27, 0xce, 0x26, 0x5c, 0xbb, 0x99, 0xf9, 0xb0,
+	0xa8, 0xb4, 0xfa, 0x75, 0xc3, 0x97, 0xef, 0x5d, 0xfd, 0xc3, 0xc7, 0x8a, 0x48, 0xcc, 0x52, 0x50,
+	0x9b, 0xb3, 0x68, 0xa9, 0xc9, 0x5a, 0x1b, 0x27, 0x0f, 0xef, 0x3d, 0x7e, 0xa1, 0x47, 0x4e, 0x9e,
+	0x4b, 0xbc, 0x9e, 0x76, 0x37, 0xa7, 0xb8, 0xec, 0xf9, 0x9b, 0xc6, 0xaf, 0xed, 0xdd, 0x7f, 0x47,
+	0x8c, 0x13, 0x9d, 0x2a, 0xa5, 0xa8, 0x3e, 0x77, 0xb1, 0xd1, 0x2a, 0x8b, 0x0d, 0xce, 0x9e, 0xdb,
+	0xf6, 0xfa, 0x87, 0x1d, 0x3d, 0x75, 0xfe, 0xe2, 0x8d, 0xf4, 0xac, 0xdc, 0x92, 0xf2, 0x17, 0x6f,
+	0x9b, 0x9a, 0x3b, 0x7e, 0x0f, 0x8c, 0x1c, 0x3f, 0x69, 0x9a, 0xb4, 0x92, 0xc6, 0x3c, 0xbd, 0x65,
+	0xab, 0x2d, 0x6d, 0x5d, 0xbc, 0xb6, 0xef, 0x0b, 0x08, 0x3f, 0x76, 0x3a, 0xf6, 0x52, 0xd2, 0xad,
+	0x7b, 0x79, 0x8f, 0x2a, 0x6a, 0xde, 0x7d, 0xf8, 0xf6, 0xe3, 0xcf, 0xa0, 0xa0, 0x90, 0xd8, 0x74,
+	0x19, 0x65, 0xcd, 0xf9, 0xfa, 0xc6, 0x6b, 0xac, 0xec, 0x5c, 0x37, 0xed, 0xf0, 0x09, 0x8c, 0x38,
+	0x1e, 0x1d, 0x77, 0x39, 0xf9, 0x76, 0x76, 0xfe, 0xe3, 0x67, 0xb5, 0xef, 0x3f, 0xb6, 0xfc, 0xec,
+	0x19, 0x1a, 0x25, 0x3c, 0x59, 0x52, 0x56, 0x45, 0x4b, 0x77, 0xc9, 0x72, 0xd3, 0x75, 0xf6, 0x6e,
+	0x9b, 0x77, 0xee, 0x0f, 0x3a, 0x18, 0x19, 0x73, 0xe1, 0x4a, 0xca, 0x9d, 0xfb, 0x05, 0x4f, 0x2a,
+	0x5f, 0xd6, 0x7d, 0x6a, 0xed, 0xec, 0x1d, 0x36, 0x7a, 0xc2, 0x94, 0x19, 0x72, 0xaa, 0xda, 0x0b,
+	0x0c, 0x56, 0x98, 0x59, 0x3b, 0xb8, 0x6f, 0xd9, 0xe5, 0x1b, 0x7c, 0x28, 0xea, 0x4c, 0xfc, 0xd5,
+	0xd4, 0x8c, 0x07, 0x85, 0x4f, 0xab, 0x5e, 0xd5, 0x7f, 0x6e, 0xfb, 0xd5, 0x47, 0x9d, 0x3a, 0x75,
+	0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d,
+	0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7,
+	0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9,
+	0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea,
+	0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a,
+	0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e,
+	0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53,
+	0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4,
+	0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0xff, 0xaf, 0xff, 0x03, 0x95, 0xe4,
+	0x66, 0x86, 0x00, 0x80, 0x00, 0x00, 0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0x06, 0x00, 0x42, 0x43, 0x02, 0x00, 0xf0, 0x01, 0xed, 0xcf, 0xd7, 0x5a, 0x08, 0x00, 0x00, 0x80,
+	0xd1, 0x4f, 0xc8, 0x8e, 0x12, 0x25, 0x4a, 0x7b, 0x6a, 0x4b, 0x69, 0x29, 0x09, 0xa1, 0x52, 0x49,
+	0xda, 0x4b, 0xca, 0x4c, 0x89, 0xd0, 0x1e, 0x76, 0x19, 0x65, 0x94, 0xca, 0xd6, 0x50, 0x28, 0x09,
+	0xed, 0x32, 0x1a, 0x0a, 0x45, 0xd9, 0x2a, 0x54, 0x48, 0x28, 0x42, 0x71, 0xe3, 0xca, 0x5b, 0xfc,
+	0xe7, 0x0d, 0x4e, 0xd3, 0xb3, 0xb6, 0xae, 0xde, 0x1f, 0x7f, 0x04, 0x27, 0x88, 0x4e, 0x97, 0x55,
+	0xd1, 0xd2, 0x37, 0xb5, 0x5c, 0xe6, 0xe0, 0xe2, 0x1d, 0x10, 0xb8, 0x2d, 0x22, 0xfe, 0x40, 0x52,
+	0xea, 0x99, 0xac, 0x2b, 0x45, 0x65, 0x77, 0xee, 0x37, 0x3f, 0x6f, 0xef, 0xfe, 0x32, 0xf0, 0x77,
+	0x94, 0xd0, 0x94, 0x19, 0x72, 0xaa, 0xda, 0x06, 0xf3, 0x16, 0x5a, 0xaf, 0x70, 0xf5, 0x59, 0xbb,
+	0x39, 0x34, 0x72, 0x57, 0x42, 0xf2, 0xc9, 0xb3, 0xd9, 0x57, 0x6f, 0x94, 0xdf, 0x6d, 0x78, 0xfc,
+	0xa2, 0xe3, 0xc3, 0xd7, 0x9f, 0xc3, 0x46, 0x4f, 0x9c, 0x2a, 0x29, 0xaf, 0xa6, 0x33, 0xd7, 0x6c,
+	0x91, 0x8d, 0xa3, 0x9b, 0xef, 0xba, 0xa0, 0xed, 0x51, 0xbb, 0x13, 0x8f, 0xa6, 0x9d, 0xcb, 0xc9,
+	0xbf, 0x59, 0x71, 0xaf, 0xf1, 0xc9, 0xcb, 0xb7, 0x1f, 0xbf, 0xfd, 0x12, 0x18, 0x33, 0x49, 0x4c,
+	0x4a, 0x61, 0x96, 0xae, 0xa1, 0xf9, 0x62, 0xdb, 0x95, 0xee, 0xab, 0xd7, 0x07, 0xef, 0x88, 0xde,
+	0x73, 0xf0, 0x58, 0xfa, 0xf9, 0x4b, 0x05, 0xb7, 0x2a, 0x6b, 0x1e, 0xb4, 0xbc, 0x7a, 0xf7, 0xa9,
+	0xef, 0xf7, 0xf0, 0xb1, 0xc2, 0xe2, 0x33, 0x15, 0xd5, 0x67, 0x1b, 0xcd, 0xb7, 0x5a, 0xee, 0xe4,
+	0xe1, 0xb7, 0x61, 0xcb, 0xce, 0x98, 0xbd, 0x87, 0x8e, 0x67, 0x5c, 0xc8, 0xbd, 0x56, 0x5c, 0x55,
+	0xfb, 0xb0, 0xf5, 0xf5, 0xfb, 0x9e, 0xfe, 0xc1, 0x11, 0xe3, 0x44, 0xa6, 0x49, 0x2b, 0x69, 0xe8,
+	0x19, 0x5b, 0x2c, 0xb1, 0x5b, 0xe5, 0xb9, 0x66, 0x63, 0x48, 0x58, 0xec, 0xbe, 0xc3, 0x27, 0x4e,
+	0x5d, 0xcc, 0x2b, 0x2c, 0xa9, 0xae, 0x7b, 0xf4, 0xf4, 0x4d, 0xe7, 0xe7, 0xef, 0x43, 0x23, 0xc7,
+	0x4f, 0x96, 0x90, 0x51, 0xd6, 0x9c, 0x63, 0xb2, 0x60, 0xa9, 0xbd, 0xb3, 0x97, 0xff, 0xa6, 0xad,
+	0xe1, 0x71, 0xfb, 0x8f, 0xa4, 0x9c, 0xce, 0xbc, 0x7c, 0xbd, 0xf4, 0x76, 0x7d, 0x13, 0x75, 0xea,
+	0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a,
+	0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e,
+	0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53,
+	0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4,
+	0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75,
+	0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d,
+	0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7,
+	0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9,
+	0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0xfe, 0xbf, 0xfe, 0x0f, 0xb5,
+	0x26, 0x9f, 0xab, 0x00, 0x80, 0x00, 0x00, 0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0x06, 0x00, 0x42, 0x43, 0x02, 0x00, 0x52, 0x02, 0x5b, 0xb5, 0x71, 0xc7, 0xfe, 0x63, 0x67,
+	0xaf, 0xdc, 0x7e, 0xf4, 0xf2, 0xc3, 0x77, 0x66, 0x2e, 0x41, 0x09, 0x79, 0x35, 0x5d, 0x13, 0x6b,
+	0x27, 0xcf, 0x80, 0xf0, 0xb8, 0xd4, 0x9c, 0xe2, 0xaa, 0xc6, 0x8e, 0xfe, 0x69, 0x73, 0x97, 0xac,
+	0xde, 0xb4, 0xf3, 0xc0, 0xf1, 0x73, 0x57, 0xef, 0x3c, 0x7e, 0xf5, 0xf1, 0x07, 0x0b, 0xb7, 0x90,
+	0xa4, 0x82, 0xba, 0x9e, 0xa9, 0x8d, 0xb3, 0x57, 0x60, 0x44, 0x7c, 0x5a, 0x6e, 0x49, 0x75, 0x53,
+	0xe7, 0x84, 0xe9, 0xf3, 0x96, 0xae, 0xd9, 0xbc, 0xeb, 0xe0, 0x89, 0xf3, 0xd7, 0xee, 0x3e, 0x79,
+	0xfd, 0xe9, 0x27, 0x2b, 0x8f, 0xb0, 0x94, 0xa2, 0x86, 0xbe, 0x99, 0xad, 0x8b, 0x77, 0x50, 0x64,
+	0x42, 0x7a, 0x5e, 0x69, 0x4d, 0x73, 0xd7, 0xc4, 0x19, 0xf3, 0x97, 0xad, 0xdd, 0xb2, 0xfb, 0xd0,
+	0xc9, 0x0b, 0xd7, 0xef, 0x3d, 0x7d, 0xf3, 0xf9, 0x17, 0x1b, 0xaf, 0x88, 0xb4, 0x92, 0xa6, 0x81,
+	0xb9, 0x9d, 0xab, 0x4f, 0x70, 0x54, 0x62, 0x46, 0x7e, 0x59, 0x6d, 0x4b, 0xf7, 0xa4, 0x99, 0x0b,
+	0x96, 0xaf, 0xdb, 0xba, 0xe7, 0xf0, 0xa9, 0x8b, 0x37, 0xee, 0x3f, 0x7b, 0xfb, 0xe5, 0x37, 0x3b,
+	0x9f, 0xa8, 0x8c, 0xb2, 0x96, 0xa1, 0x85, 0xbd, 0x9b, 0x6f, 0x48, 0x74, 0x52, 0x66, 0x41, 0x79,
+	0x5d, 0x6b, 0xcf, 0xe4, 0x59, 0x0b, 0x57, 0xac, 0xdf, 0xb6, 0xf7, 0xc8, 0xe9, 0x4b, 0x37, 0x1f,
+	0x3c, 0x7f, 0xf7, 0x95, 0x91, 0x83, 0x5f, 0x4c, 0x56, 0x45, 0xdb, 0xc8, 0xd2, 0xc1, 0xdd, 0x2f,
+	0x34, 0x26, 0x39, 0xab, 0xb0, 0xa2, 0xbe, 0xad, 0x77, 0xca, 0xec, 0x45, 0x2b, 0x37, 0x6c, 0xdf,
+	0x77, 0xf4, 0xcc, 0xe5, 0x5b, 0x0f, 0x5f, 0xbc, 0xff, 0xc6, 0xc4, 0x29, 0x20, 0x2e, 0xa7, 0xaa,
+	0x63, 0x6c, 0xe5, 0xe8, 0xe1, 0x1f, 0x16, 0x9b, 0x92, 0x5d, 0x54, 0xd9, 0xd0, 0xde, 0x37, 0x75,
+	0xce, 0xe2, 0x55, 0xa3, 0x5e, 0x1f, 0xf5, 0xfa, 0xa8, 0xd7, 0x47, 0xbd, 0x3e, 0xea, 0xf5, 0x51,
+	0xaf, 0x8f, 0x7a, 0x7d, 0xd4, 0xeb, 0xa3, 0x5e, 0x1f, 0xf5, 0xfa, 0xa8, 0xd7, 0x47, 0xbd, 0x3e,
+	0xea, 0xf5, 0x51, 0xaf, 0x8f, 0x7a, 0x7d, 0xd4, 0xeb, 0xa3, 0x5e, 0x1f, 0xf5, 0xfa, 0xa8, 0xd7,
+	0x47, 0xbd, 0x3e, 0xea, 0xf5, 0x51, 0xaf, 0x8f, 0x7a, 0x7d, 0xd4, 0xeb, 0xa3, 0x5e, 0x1f, 0xf5,
+	0xfa, 0xa8, 0xd7, 0x47, 0xbd, 0x3e, 0xea, 0xf5, 0x51, 0xaf, 0x8f, 0x7a, 0x7d, 0xd4, 0xeb, 0xa3,
+	0x5e, 0x1f, 0xf5, 0xfa, 0xa8, 0xd7, 0x47, 0xbd, 0x3e, 0xea, 0xf5, 0x51, 0xaf, 0x8f, 0x7a, 0x7d,
+	0xd4, 0xeb, 0xa3, 0x5e, 0x1f, 0xf5, 0xfa, 0xa8, 0xd7, 0x47, 0xbd, 0x3e, 0xea, 0xf5, 0x51, 0xaf,
+	0x8f, 0x7a, 0x7d, 0xd4, 0xeb, 0xa3, 0x5e, 0x1f, 0xf5, 0xfa, 0xa8, 0xd7, 0x47, 0xbd, 0x3e, 0xea,
+	0xf5, 0x51, 0xaf, 0x8f, 0x7a, 0x7d, 0xd4, 0xeb, 0xa3, 0x5e, 0x1f, 0xf5, 0xfa, 0xa8, 0xd7, 0x47,
+	0xbd, 0x3e, 0xea, 0xf5, 0x51, 0xaf, 0x8f, 0x7a, 0x7d, 0xd4, 0xeb, 0xa3, 0x5e, 0x1f, 0xf5, 0xfa,
+	0xa8, 0xd7, 0x47, 0xbd, 0x3e, 0xea, 0xf5, 0x51, 0xaf, 0x8f, 0x7a, 0x7d, 0xd4, 0xeb, 0xa3, 0x5e,
+	0x1f, 0xf5, 0xfa, 0xa8, 0xd7, 0x47, 0xbd, 0x3e, 0xea, 0xf5, 0x51, 0xaf, 0x8f, 0x7a, 0x7d, 0xd4,
+	0xeb, 0xa3, 0x5e, 0x1f, 0xf5, 0xfa, 0xa8, 0xd7, 0x47, 0xbd, 0x3e, 0xea, 0xf5, 0x51, 0xaf, 0x8f,
+	0x7a, 0x7d, 0xd4, 0xeb, 0xa3, 0x5e, 0x1f, 0xf5, 0xfa, 0xa8, 0xd7, 0x47, 0xbd, 0x3e, 0xea, 0xf5,
+	0x51, 0xaf, 0x8f, 0x7a, 0x7d, 0xd4, 0xeb, 0xa3, 0x5e, 0x1f, 0xf5, 0xfa, 0xa8, 0xd7, 0x47, 0xbd,
+	0x3e, 0xea, 0xf5, 0x51, 0xaf, 0x8f, 0x7a, 0x7d, 0xd4, 0xeb, 0xa3, 0x5e, 0x1f, 0xf5, 0xfa, 0xa8,
+	0xd7, 0x47, 0xbd, 0x3e, 0xea, 0xf5, 0x51, 0xaf, 0x8f, 0x7a, 0x7d, 0xd4, 0xeb, 0xa3, 0x5e, 0x1f,
+	0xf5, 0xfa, 0xa8, 0xd7, 0x47, 0xbd, 0x3e, 0xea, 0xf5, 0x51, 0xaf, 0x8f, 0x7a, 0x7d, 0xd4, 0xeb,
+	0xa3, 0x5e, 0x1f, 0xf5, 0xfa, 0xa8, 0xd7, 0x47, 0xbd, 0x3e, 0xea, 0xf5, 0x51, 0xaf, 0xc3, 0xbc,
+	0x0e, 0x00, 0xde, 0xf7, 0xec, 0x79, 0x00, 0x80, 0x00, 0x00, 0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0x06, 0x00, 0x42, 0x43, 0x02, 0x00, 0xf2, 0x01, 0xed, 0xcf, 0xd7, 0x5a,
+	0x08, 0x00, 0x00, 0x80, 0xd1, 0x0f, 0x89, 0x86, 0xac, 0x36, 0x25, 0x3b, 0x52, 0x22, 0x29, 0x2d,
+	0x1a, 0x46, 0x19, 0xc9, 0x2a, 0x52, 0xca, 0x2a, 0x33, 0x25, 0x42, 0x0b, 0xed, 0x50, 0x48, 0x45,
+	0x43, 0xa5, 0x54, 0x28, 0x6d, 0x95, 0xf6, 0x50, 0x69, 0xa8, 0x28, 0x5b, 0x85, 0x0a, 0x09, 0x45,
+	0x28, 0x6e, 0x5c, 0x79, 0x8b, 0xff, 0xbc, 0xc1, 0xf1, 0x3e, 0x77, 0xf9, 0x5a, 0x6c, 0xd2, 0xdd,
+	0x9c, 0xc2, 0x8a, 0xda, 0xe6, 0xe7, 0xed, 0xdd, 0x5f, 0x06, 0xfe, 0x8e, 0x12, 0x93, 0x98, 0x3c,
+	0x7d, 0xee, 0x02, 0xcd, 0xa5, 0x2b, 0xd6, 0x6e, 0xb2, 0xdc, 0xb9, 0xef, 0x88, 0x8b, 0x87, 0xcf,
+	0xf9, 0x90, 0x88, 0xb8, 0xe4, 0xb4, 0x7b, 0x45, 0x95, 0x75, 0x8f, 0x5f, 0x74, 0x7c, 0xf8, 0xfa,
+	0x73, 0xd8, 0xe8, 0xb1, 0x92, 0x72, 0x33, 0x94, 0x16, 0x2e, 0x59, 0xb6, 0x72, 0xdd, 0xe6, 0xed,
+	0xbb, 0xf6, 0x3b, 0x9e, 0xf0, 0xf4, 0xbd, 0x70, 0x25, 0xf2, 0xc6, 0xad, 0xf4, 0xdc, 0xe2, 0x07,
+	0xf5, 0x4f, 0x5e, 0xbe, 0xfd, 0xf8, 0xed, 0xd7, 0x70, 0xa1, 0x71, 0x52, 0xf2, 0x33, 0xe7, 0xa9,
+	0x69, 0xe9, 0xaf, 0x32, 0xdd, 0x62, 0xb5, 0xfb, 0x80, 0xd3, 0xc9, 0xd3, 0x7e, 0x41, 0xa1, 0x51,
+	0xf1, 0xb7, 0x33, 0xf2, 0x4a, 0xaa, 0x1a, 0x5a, 0x5e, 0xbd, 0xfb, 0xd4, 0xf7, 0x7b, 0x84, 0xf0,
+	0x78, 0xe9, 0x29, 0xb3, 0x94, 0x17, 0x69, 0x1b, 0x18, 0xaf, 0x37, 0xb7, 0xde, 0x73, 0xf0, 0xe8,
+	0xa9, 0x33, 0xfe, 0xc1, 0x61, 0xd1, 0x09, 0x77, 0x32, 0xf3, 0x4b, 0xab, 0x1f, 0xb5, 0xbe, 0x7e,
+	0xdf, 0xd3, 0x3f, 0x28, 0x20, 0x32, 0x41, 0x46, 0x61, 0xb6, 0x8a, 0xba, 0x8e, 0xa1, 0x89, 0x99,
+	0xc5, 0x8e, 0xbd, 0x87, 0x9c, 0x5d, 0xcf, 0x06, 0x5c, 0x0c, 0xbf, 0x7e, 0x33, 0x25, 0xeb, 0x7e,
+	0x59, 0x4d, 0xe3, 0xd3, 0x37, 0x9d, 0x9f, 0xbf, 0x0f, 0x8d, 0x14, 0x9d, 0x28, 0x3b, 0x55, 0x71,
+	0xfe, 0x62, 0x5d, 0xa3, 0xd5, 0x1b, 0xb6, 0xda, 0xd8, 0x1d, 0x3e, 0xe6, 0xe6, 0x15, 0x78, 0xe9,
+	0x6a, 0x4c, 0x62, 0x6a, 0x76, 0x41, 0xf9, 0xc3, 0xa6, 0x67, 0x6d, 0x5d, 0xbd, 0x3f, 0xfe, 0x08,
+	0x8e, 0x11, 0x9f, 0x34, 0x6d, 0x8e, 0xaa, 0x86, 0xde, 0xf2, 0x35, 0x1b, 0xb7, 0xd9, 0xda, 0x3b,
+	0x1c, 0x77, 0xf7, 0xa6, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a,
+	0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e,
+	0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53,
+	0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4,
+	0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75,
+	0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d,
+	0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7,
+	0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9,
+	0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea,
+	0xd4, 0xff, 0xd7, 0xff, 0x01, 0x6c, 0x3f, 0x0e, 0x7c, 0x00, 0x80, 0x00, 0x00, 0x1f, 0x8b, 0x08,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x00, 0x42, 0x43, 0x02, 0x00, 0xf1, 0x01, 0xed,
+	0xcf, 0xd7, 0x3a, 0x10, 0x00, 0x00, 0x80, 0xd1, 0xaf, 0xa5, 0x41, 0x8a, 0x94, 0x51, 0x64, 0xcf,
+	0x48, 0x49, 0x64, 0x45, 0x52, 0xa9, 0x10, 0x42, 0x66, 0xb4, 0x68, 0x8a, 0x94, 0xca, 0x2a, 0xb4,
+	0x69, 0xd0, 0x20, 0xb4, 0x33, 0x42, 0x91, 0x54, 0xf6, 0x0c, 0x19, 0xa1, 0x68, 0x87, 0x0a, 0x95,
+	0x54, 0x94, 0x8a, 0xba, 0xe9, 0xaa, 0xb7, 0xf8, 0xcf, 0x1b, 0x1c, 0x8f, 0xf5, 0x5b, 0x76, 0xec,
+	0xdd, 0x7f, 0xf8, 0xc4, 0xd9, 0xa4, 0x6b, 0xe9, 0xb7, 0xf3, 0x4a, 0xab, 0x1f, 0xb5, 0xbe, 0x7e,
+	0xdf, 0xd3, 0x3f, 0x38, 0x52, 0x50, 0x54, 0x52, 0x56, 0x45, 0x4b, 0xd7, 0xc8, 0x7c, 0xa9, 0xed,
+	0xaa, 0xd5, 0x1b, 0xb6, 0x06, 0x04, 0x85, 0x1f, 0x39, 0x79, 0xee, 0xc2, 0xf5, 0x8c, 0x9c, 0xfc,
+	0xb2, 0x9a, 0xc6, 0xa7, 0x6f, 0x3a, 0x3f, 0x7f, 0x1f, 0x1a, 0x25, 0x34, 0x49, 0x4a, 0x4e, 0x75,
+	0xe6, 0x5c, 0xe3, 0x85, 0xcb, 0xec, 0x9c, 0x3d, 0xbd, 0xb7, 0xed, 0x0c, 0x8e, 0x38, 0x7a, 0x2a,
+	0xee, 0x62, 0x72, 0xe6, 0x9d, 0x82, 0xf2, 0x87, 0x4d, 0xcf, 0xda, 0xba, 0x7a, 0x7f, 0xfc, 0x11,
+	0x18, 0x2f, 0x36, 0x55, 0x5e, 0x4d, 0x5b, 0xcf, 0xc4, 0x62, 0xb9, 0xbd, 0x8b, 0x97, 0x8f, 0xef,
+	0xae, 0x90, 0xc8, 0x63, 0x31, 0xf1, 0x97, 0x52, 0x6e, 0xe6, 0x16, 0x56, 0xd4, 0x36, 0x3f, 0x6f,
+	0xef, 0xfe, 0x32, 0xf0, 0x77, 0xb4, 0xf0, 0xe4, 0x69, 0x0a, 0xea, 0xb3, 0xf4, 0xe7, 0x2f, 0xb2,
+	0x5a, 0xe9, 0xba, 0x66, 0xe3, 0xf6, 0xc0, 0xd0, 0x03, 0x51, 0xb1, 0xe7, 0x2f, 0xa7, 0xde, 0xba,
+	0x5b, 0x54, 0x59, 0xf7, 0xf8, 0x45, 0xc7, 0x87, 0xaf, 0x3f, 0x87, 0x8d, 0x99, 0x30, 0x45, 0x5a,
+	0x51, 0x63, 0xf6, 0x3c, 0xd3, 0xc5, 0xd6, 0x0e, 0x6e, 0x6b, 0x37, 0xf9, 0xed, 0x0e, 0x3b, 0x18,
+	0x7d, 0x3a, 0xe1, 0x4a, 0x5a, 0xd6, 0xbd, 0xe2, 0x07, 0xf5, 0x4f, 0x5e, 0xbe, 0xfd, 0xf8, 0xed,
+	0xd7, 0xf0, 0xb1, 0x13, 0xc5, 0x65, 0x94, 0x66, 0xe8, 0x18, 0x98, 0x2d, 0xb1, 0x71, 0x74, 0x5f,
+	0xb7, 0xd9, 0x7f, 0xcf, 0xbe, 0x43, 0xc7, 0xcf, 0x24, 0x5e, 0xbd, 0x91, 0x7d, 0xbf, 0xa4, 0xaa,
+	0xa1, 0xe5, 0xd5, 0xbb, 0x4f, 0x7d, 0xbf, 0x47, 0x8c, 0x13, 0x91, 0x98, 0xae, 0xac, 0x39, 0xc7,
+	0x70, 0x81, 0xe5, 0x0a, 0x27, 0x0f, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea,
+	0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a,
+	0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e,
+	0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53,
+	0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4,
+	0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75,
+	0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d,
+	0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7,
+	0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9,
+	0x53, 0xa7, 0x4e, 0xfd, 0x7f, 0xfd, 0x1f, 0x5a, 0x90, 0x0b, 0x2e, 0x00, 0x80, 0x00, 0x00, 0x1f,
+	0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x00, 0x42, 0x43, 0x02, 0x00, 0xf1,
+	0x01, 0xed, 0xcf, 0xd7, 0x3a, 0x10, 0x00, 0x00, 0x80, 0xd1, 0x2f, 0x95, 0x26, 0x45, 0x8a, 0x06,
+	0xd9, 0x33, 0xbb, 0x21, 0x2b, 0x92, 0x4a, 0x85, 0x90, 0x64, 0xaf, 0xd0, 0xd0, 0x10, 0xa5, 0xb2,
+	0x47, 0x9b, 0x06, 0x0d, 0x42, 0x3b, 0x23, 0x2a, 0x92, 0xca, 0xa6, 0x61, 0x84, 0xa2, 0x6d, 0xb5,
+	0x90, 0x92, 0x8a, 0x52, 0x51, 0x37, 0x5d, 0xf5, 0x16, 0xff, 0x79, 0x83, 0xa3, 0xb7, 0x60, 0xb1,
+	0xe5, 0x2a, 0x67, 0xaf, 0xf5, 0x5b, 0x83, 0xc3, 0xf7, 0xc4, 0x25, 0x9e, 0x3e, 0x9f, 0x79, 0xfd,
+	0x56, 0xe9, 0xfd, 0xba, 0x27, 0xcd, 0x6f, 0xbb, 0xbf, 0xfe, 0x1c, 0x36, 0x7a, 0xc2, 0x14, 0x49,
+	0x79, 0x35, 0x9d, 0xf9, 0x26, 0x4b, 0xac, 0xec, 0x5d, 0xbc, 0x37, 0x04, 0xec, 0x8c, 0xd8, 0x1b,
+	0x7f, 0x3c, 0xe5, 0x42, 0x56, 0xee, 0xed, 0xb2, 0x07, 0xf5, 0x4f, 0x5b, 0xde, 0x7d, 0xfc, 0xf6,
+	0x4b, 0x60, 0xcc, 0x44, 0x71, 0x29, 0x85, 0x59, 0xba, 0xfa, 0xa6, 0x4b, 0xad, 0x57, 0xbb, 0xae,
+	0xdd, 0xb8, 0x6d, 0x57, 0xe4, 0xbe, 0xc3, 0x27, 0x52, 0x2f, 0x5e, 0xc9, 0xbb, 0x53, 0x5e, 0xd5,
+	0xf0, 0xac, 0xf5, 0xfd, 0xa7, 0xbe, 0xdf, 0xc3, 0xc7, 0x8a, 0x48, 0xcc, 0x54, 0x54, 0x9f, 0x6d,
+	0xb0, 0xd0, 0x62, 0xa5, 0x83, 0x9b, 0x8f, 0x7f, 0xe0, 0xee, 0xa8, 0xfd, 0x47, 0x4e, 0xa6, 0x5d,
+	0xca, 0xbe, 0x51, 0x58, 0x51, 0xfd, 0xe8, 0x79, 0x5b, 0x47, 0x4f, 0xff, 0xe0, 0x88, 0x71, 0xa2,
+	0x53, 0xa5, 0x95, 0x34, 0xe6, 0x18, 0x9a, 0x2d, 0xb3, 0x59, 0xe3, 0xee, 0xbb, 0x29, 0x28, 0x24,
+	0xfa, 0xc0, 0xd1, 0x53, 0x67, 0x2e, 0xe7, 0xe4, 0x17, 0x55, 0xd6, 0x3c, 0x7e, 0xd1, 0xde, 0xf9,
+	0xf9, 0xfb, 0xd0, 0xc8, 0xf1, 0x93, 0xa6, 0xc9, 0x28, 0x6b, 0xce, 0x35, 0x5a, 0xb4, 0xdc, 0xd6,
+	0xd1, 0xc3, 0x6f, 0xf3, 0xf6, 0xd0, 0x98, 0x83, 0xc7, 0x92, 0xce, 0xa6, 0x5f, 0xbd, 0x59, 0x7c,
+	0xb7, 0xb6, 0xf1, 0xe5, 0xeb, 0xae, 0xde, 0x1f, 0x7f, 0x04, 0x85, 0xc4, 0xa6, 0xcb, 0xaa, 0x68,
+	0xcd, 0x33, 0x36, 0x5f, 0x61, 0xe7, 0xe4, 0xb9, 0x6e, 0xcb, 0x8e, 0xb0, 0xd8, 0x43, 0x09, 0xc9,
+	0xe7, 0x32, 0xae, 0x15, 0x94, 0xdc, 0x7b, 0xd8, 0xf4, 0xea, 0xcd, 0x87, 0x2f, 0x03, 0x7f, 0x47,
+	0x09, 0x4f, 0x9e, 0x21, 0xa7, 0xaa, 0xad, 0x47, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7,
+	0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9,
+	0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea,
+	0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a,
+	0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e,
+	0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53,
+	0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4,
+	0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75,
+	0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d,
+	0x3a, 0x75, 0xea, 0xd4, 0xa9, 0xff, 0xaf, 0xff, 0x03, 0xfa, 0xb2, 0xea, 0x39, 0x00, 0x80, 0x00,
+	0x00, 0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x00, 0x42, 0x43, 0x02,
+	0x00, 0xf2, 0x01, 0xed, 0xcf, 0xd7, 0x5a, 0x08, 0x00, 0x00, 0x80, 0xd1, 0x0f, 0x89, 0x86, 0x28,
+	0x6d, 0x4a, 0x93, 0x48, 0x89, 0xa4, 0xb4, 0x34, 0x84, 0xac, 0x64, 0x15, 0x29, 0x65, 0x95, 0x99,
+	0x12, 0xa1, 0x45, 0xc3, 0x2c, 0xa3, 0x8c, 0x50, 0x2a, 0xa5, 0x42, 0x69, 0xab, 0xb4, 0x87, 0x4a,
+	0x43, 0x45, 0xd9, 0x2a, 0x54, 0x48, 0x28, 0x42, 0x71, 0xe3, 0xca, 0x5b, 0xfc, 0xe7, 0x0d, 0x8e,
+	0x84, 0x9c, 0xd2, 0x14, 0x6d, 0x3d, 0x63, 0xcb, 0xc5, 0xb6, 0xf6, 0x1b, 0xb7, 0xed, 0xf6, 0xf2,
+	0x09, 0x3c, 0x79, 0xee, 0xf2, 0xf5, 0x9b, 0x29, 0x59, 0xf7, 0xcb, 0x6a, 0x1a, 0x9f, 0xbe, 0xe9,
+	0xfc, 0xfc, 0x7d, 0x68, 0xa4, 0xe8, 0x78, 0x79, 0x65, 0x8d, 0x19, 0x73, 0x4c, 0xe6, 0x2f, 0x59,
+	0xb9, 0xce, 0xd9, 0x75, 0xcf, 0x7e, 0xdf, 0xa0, 0x53, 0xe7, 0x23, 0x63, 0x12, 0x53, 0xb3, 0x0b,
+	0xca, 0x1f, 0x36, 0x3d, 0x6b, 0xeb, 0xea, 0xfd, 0xf1, 0x47, 0x70, 0x8c, 0xe4, 0x04, 0x95, 0xa9,
+	0x3a, 0xfa, 0xa6, 0x56, 0x4b, 0x57, 0xad, 0x77, 0x71, 0x73, 0x3f, 0xe0, 0x17, 0x7c, 0x3a, 0xfc,
+	0x4a, 0x6c, 0xd2, 0xdd, 0x9c, 0xc2, 0x8a, 0xda, 0xe6, 0xe7, 0xed, 0xdd, 0x5f, 0x06, 0xfe, 0x8e,
+	0x12, 0x93, 0x9a, 0xa8, 0x3a, 0x6d, 0xa6, 0xc1, 0xbc, 0x05, 0xcb, 0x56, 0x3b, 0x6c, 0xda, 0xbe,
+	0xd7, 0xdb, 0x3f, 0x24, 0x34, 0xe2, 0x6a, 0x5c, 0x72, 0xda, 0xbd, 0xa2, 0xca, 0xba, 0xc7, 0x2f,
+	0x3a, 0x3e, 0x7c, 0xfd, 0x39, 0x6c, 0xf4, 0x58, 0x69, 0x05, 0x35, 0xcd, 0x59, 0x73, 0xcd, 0x16,
+	0x2e, 0x5f, 0xb3, 0x61, 0xf3, 0x0e, 0x8f, 0x83, 0x01, 0xc7, 0xc2, 0x2e, 0x5c, 0xbb, 0x71, 0x2b,
+	0x3d, 0xb7, 0xf8, 0x41, 0xfd, 0x93, 0x97, 0x6f, 0x3f, 0x7e, 0xfb, 0x35, 0x5c, 0x68, 0x9c, 0x8c,
+	0xa2, 0xfa, 0x74, 0x5d, 0x43, 0xf3, 0x45, 0x36, 0x6b, 0x1d, 0xb7, 0xec, 0xf4, 0x3c, 0x74, 0xe4,
+	0xf8, 0x99, 0x8b, 0x51, 0xf1, 0xb7, 0x33, 0xf2, 0x4a, 0xaa, 0x1a, 0x5a, 0x5e, 0xbd, 0xfb, 0xd4,
+	0xf7, 0x7b, 0x84, 0xb0, 0xb8, 0xec, 0xa4, 0xc9, 0x5a, 0xb3, 0x8d, 0x2c, 0xac, 0x57, 0xd8, 0x39,
+	0x6d, 0xdd, 0xb5, 0xef, 0xf0, 0xd1, 0x13, 0x67, 0x2f, 0x45, 0x27, 0xdc, 0xc9, 0xcc, 0x2f, 0xad,
+	0x7e, 0xd4, 0xfa, 0xfa, 0x7d, 0x4f, 0xff, 0xa0, 0x80, 0x88, 0x04, 0x75, 0xea, 0xd4, 0xa9, 0x53,
+	0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4,
+	0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75,
+	0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d,
+	0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7,
+	0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9,
+	0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea,
+	0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a,
+	0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e, 0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0x4e,
+	0x9d, 0x3a, 0x75, 0xea, 0xd4, 0xa9, 0x53, 0xa7, 0xfe, 0xbf, 0xfe, 0x0f, 0x15, 0x60, 0x95, 0xd3,
+	0x00, 0x80, 0x00, 0x00, 0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x00,
+	0x42, 0x43, 0x02, 0x00, 0xad, 0x0d, 0x15, 0x97, 0x6f, 0x70, 0x1c, 0xe5, 0x7d, 0xc7, 0x7f, 0xcf,
+	0x73, 0xcf, 0xae, 0x9f, 0x3d, 0x9f, 0xc4, 0xb3, 0xab, 0x93, 0xba, 0x92, 0x65, 0xe7, 0xd9, 0xf3,
+	0x4a, 0xac, 0x14, 0x41, 0x56, 0xb6, 0xec, 0xca, 0xe0, 0xb4, 0xcf, 0xad, 0x4f, 0xf2, 0xc9, 0x88,
+	0xcc, 0x4a, 0x16, 0xae, 0x70, 0x99, 0xcc, 0x49, 0x16, 0xae, 0x20, 0x4c, 0x22, 0x20, 0x74, 0x5c,
+	0x5e, 0x3d, 0xb7, 0x5e, 0xd9, 0x77, 0xb2, 0x20, 0x2b, 0x59, 0x93, 0xaa, 0x0c, 0xe9, 0xac, 0x84,
+	0xc8, 0x08, 0x30, 0x19, 0x91, 0x30, 0xa9, 0x9b, 0x69, 0x3b, 0x27, 0x59, 0x06, 0x85, 0x92, 0xa9,
+	0xe2, 0x31, 0xa9, 0xd3, 0xa1, 0x33, 0xc2, 0x98, 0xd4, 0x4d, 0x98, 0x29, 0x30, 0xbc, 0xe0, 0x65,
+	0x97, 0x97, 0xbb, 0x6f, 0x9e, 0xdd, 0xdf, 0xef, 0xfb, 0xe7, 0xf3, 0xa0, 0xe3, 0x99, 0x68, 0x05,
+	0x81, 0x47, 0x22, 0xff, 0x47, 0x60, 0xaf, 0xab, 0x25, 0x9d, 0xca, 0x99, 0x78, 0xdc, 0xa5, 0x2f,
+	0x03, 0x45, 0x1e, 0x1e, 0xad, 0xbf, 0x75, 0x18, 0x0b, 0xa0, 0x45, 0x33, 0xc8, 0x66, 0x5e, 0x2b,
+	0x66, 0x5c, 0x8d, 0x6f, 0xc6, 0x67, 0x9f, 0x90, 0x11, 0x28, 0xcc, 0x3f, 0xcd, 0x9d, 0x1d, 0x34,
+	0xc0, 0xb0, 0xcd, 0x32, 0xd9, 0x61, 0xd4, 0x9d, 0x9e, 0x21, 0x96, 0x72, 0x7d, 0xca, 0xea, 0xcd,
+	0xea, 0x58, 0x7e, 0xd3, 0x10, 0x4e, 0x34, 0x71, 0xa9, 0x58, 0x9e, 0x9a, 0x61, 0x06, 0xcb, 0xf7,
+	0x68, 0xee, 0x62, 0x93, 0x98, 0xbe, 0xc9, 0xcd, 0xb5, 0x62, 0xee, 0xa1, 0x5a, 0x20, 0x25, 0xd5,
+	0x8d, 0x1c, 0x96, 0xbc, 0xe8, 0x91, 0x5a, 0x1b, 0x86, 0xf7, 0xa2, 0x14, 0x8d, 0x06, 0x82, 0x39,
+	0x99, 0x3d, 0xb7, 0x38, 0x06, 0xcd, 0x20, 0xa3, 0xd8, 0x52, 0x71, 0xbc, 0x96, 0xd6, 0x47, 0xf6,
+	0x80, 0xfb, 0xbd, 0x19, 0xb4, 0xa1, 0x45, 0x3c, 0xab, 0x57, 0x5e, 0x5c, 0x1d, 0x6a, 0x25, 0x55,
+	0x31, 0x32, 0x38, 0x17, 0x37, 0x6c, 0x6b, 0xe4, 0xb1, 0x71, 0x31, 0x39, 0x7c, 0x30, 0xd3, 0x9e,
+	0x41, 0xc7, 0x1e, 0xe7, 0xc7, 0x95, 0x85, 0x9a, 0x09, 0x52, 0x38, 0x64, 0x80, 0x0f, 0xb4, 0x90,
+	0xbe, 0x23, 0x9c, 0x4c, 0x63, 0xfc, 0xa8, 0x5d, 0xf1, 0xb0, 0x67, 0x71, 0xc6, 0x79, 0x1b, 0x32,
+	0xa1, 0xe6, 0x00, 0xbf, 0xa8, 0xac, 0xa0, 0xd1, 0x5c, 0x97, 0xc3, 0xcb, 0x22, 0x42, 0x80, 0x6f,
+	0xf7, 0x4d, 0xd7, 0x86, 0xa3, 0xb0, 0xeb, 0x5a, 0x7f, 0x31, 0xfc, 0x04, 0xeb, 0x0d, 0x33, 0x33,
+	0x24, 0x82, 0x3e, 0x32, 0xdd, 0x86, 0x2f, 0x1e, 0x56, 0xcf, 0x0f, 0x57, 0xa5, 0x7a, 0xbc, 0x86,
+	0x24, 0x25, 0x21, 0x3a, 0x80, 0x40, 0x10, 0x5a, 0xc0, 0xa8, 0x5d, 0x6c, 0xb4, 0xd2, 0xeb, 0x65,
+	0xc8, 0x33, 0x42, 0xb3, 0x02, 0xa4, 0xe1, 0x96, 0x43, 0x38, 0x41, 0xf6, 0x43, 0xb5, 0xf6, 0x17,
+	0x4d, 0xe4, 0xd4, 0x4e, 0xd6, 0x57, 0x73, 0x50, 0xf6, 0xe1, 0xa5, 0x8b, 0x6b, 0xa6, 0xb9, 0x06,
+	0xd0, 0xe1, 0x05, 0x90, 0x3f, 0x8a, 0xf2, 0x30, 0x45, 0x77, 0xe1, 0xa0, 0x5f, 0x6b, 0x84, 0xd2,
+	0xcb, 0xb8, 0x2e, 0x75, 0xf9, 0xf2, 0xa2, 0x8e, 0x4d, 0x3a, 0xa1, 0x6e, 0x44, 0x28, 0xc3, 0x04,
+	0xe2, 0xdd, 0x76, 0xf7, 0xfa, 0x90, 0x0f, 0x82, 0x67, 0x06, 0x77, 0x43, 0x1a, 0x77, 0x42, 0x19,
+	0x92, 0x27, 0x37, 0x00, 0x20, 0x57, 0x68, 0x2b, 0x05, 0x3c, 0x5a, 0x6a, 0xa9, 0x2b, 0x4f, 0xef,
+	0xb0, 0xd8, 0xe1, 0x39, 0x9c, 0x4b, 0x16, 0x93, 0x87, 0xc1, 0x7b, 0x9d, 0x96, 0x72, 0xec, 0x31,
+	0x90, 0x0a, 0x49, 0x85, 0xb5, 0x36, 0x59, 0xbe, 0xe3, 0x75, 0x49, 0xbb, 0x19, 0xbb, 0x31, 0x5b,
+	0x90, 0x85, 0x3d, 0x2c, 0xdd, 0x56, 0xe3, 0x12, 0x02, 0xd1, 0x23, 0x47, 0x18, 0x3f, 0xef, 0xfd,
+	0x9a, 0x32, 0xe1, 0xdd, 0xc0, 0xd9, 0x75, 0x22, 0x21, 0x2d, 0xcd, 0x14, 0x21, 0xd4, 0xc9, 0x0d,
+	0x97, 0x86, 0x18, 0xfa, 0xf2, 0xdd, 0xb7, 0xc7, 0x58, 0x2e, 0x67, 0x5f, 0x70, 0x61, 0xae, 0xb4,
+	0x67, 0x40, 0xe4, 0x45, 0xce, 0x24, 0x37, 0x08, 0xf2, 0x00, 0x51, 0xc2, 0xb9, 0x44, 0x71, 0xe3,
+	0xac, 0x43, 0x2a, 0x72, 0x5e, 0x0c, 0x21, 0x1e, 0xf2, 0x6b, 0x4e, 0x06, 0x15, 0xdb, 0x86, 0xb5,
+	0xc8, 0x77, 0x05, 0xb8, 0x04, 0x67, 0x74, 0xd2, 0xd7, 0xb8, 0x4a, 0x22, 0x15, 0x44, 0xcb, 0x67,
+	0xe0, 0x1b, 0x68, 0xca, 0x23, 0x67, 0x19, 0x04, 0xa9, 0x8c, 0x0d, 0xd4, 0x90, 0x73, 0x95, 0x43,
+	0x9a, 0xac, 0x8b, 0x36, 0xb6, 0x6b, 0xab, 0xf6, 0x35, 0xdc, 0x52, 0xa6, 0x10, 0x6b, 0x12, 0xa1,
+	0x4c, 0xca, 0xa9, 0xc0, 0x57, 0x95, 0x72, 0xdb, 0x94, 0x90, 0x06, 0x7e, 0x0b, 0x94, 0x9c, 0x82,
+	0xb1, 0x3f, 0x0d, 0x50, 0xee, 0x2e, 0x14, 0x89, 0x14, 0x08, 0xda, 0xd4, 0x87, 0x09, 0xe9, 0x58,
+	0x6c, 0x16, 0x71, 0xb3, 0x9b, 0x67, 0xac, 0x17, 0xce, 0x12, 0x7e, 0x58, 0x09, 0x03, 0xd6, 0x0f,
+	0xbd, 0x4b, 0x6f, 0x03, 0x6e, 0x27, 0x22, 0x84, 0xf5, 0x82, 0x84, 0xdb, 0xc6, 0x3a, 0x4d, 0x99,
+	0xa0, 0x49, 0xca, 0xd5, 0x19, 0xa5, 0x4a, 0x32, 0xbc, 0xc8, 0x7d, 0xa8, 0xf7, 0xe1, 0x8f, 0x1f,
+	0xc0, 0xab, 0x63, 0x88, 0x7d, 0xc7, 0x8b, 0xcf, 0x7c, 0x00, 0x4a, 0xd4, 0x77, 0x58, 0x6c, 0x4b,
+	0x62, 0xef, 0x73, 0xfc, 0x87, 0xc9, 0xe5, 0xca, 0x50, 0x31, 0x60, 0x40, 0x8a, 0xcd, 0x1d, 0xe9,
+	0xcc, 0x2d, 0x60, 0x16, 0xc0, 0xe3, 0x3f, 0xea, 0xb8, 0x07, 0x19, 0xd9, 0x15, 0xc8, 0x41, 0x9a,
+	0x8e, 0x76, 0x85, 0xff, 0xf3, 0x05, 0x00, 0x2c, 0x32, 0x88, 0x73, 0x34, 0x36, 0x74, 0x16, 0xf5,
+	0xe3, 0x0c, 0x7d, 0xdc, 0xec, 0x05, 0x98, 0xff, 0x15, 0x5e, 0x96, 0x63, 0x3b, 0x86, 0xc9, 0x44,
+	0x00, 0x36, 0xbf, 0x38, 0x2e, 0xbe, 0x95, 0xef, 0x1c, 0x93, 0x4f, 0xc2, 0x70, 0x2b, 0x94, 0x3a,
+	0xcd, 0x58, 0x0e, 0x48, 0xe7, 0x53, 0xb3, 0x23, 0xac, 0x41, 0xc6, 0xeb, 0xa3, 0xcc, 0x0b, 0x99,
+	0x64, 0x30, 0x57, 0x01, 0x7e, 0xbe, 0x87, 0x6f, 0xd2, 0x14, 0xb8, 0x54, 0x62, 0x6a, 0xfb, 0x54,
+	0xd9, 0x7c, 0xae, 0x94, 0xaf, 0x2b, 0xbe, 0x66, 0x33, 0x68, 0xd1, 0x46, 0xa0, 0x25, 0xe2, 0x27,
+	0xad, 0xff, 0x94, 0x80, 0x7e, 0xf8, 0xec, 0xc4, 0x89, 0xd6, 0xa8, 0x92, 0x87, 0x9a, 0x0e, 0x20,
+	0x4e, 0x34, 0x2f, 0x2b, 0xdf, 0xef, 0x16, 0x0d, 0xb9, 0x27, 0x35, 0x32, 0xa8, 0x60, 0x40, 0x25,
+	0x18, 0xdf, 0x9f, 0x08, 0xe3, 0x1d, 0x10, 0x10, 0xd7, 0x47, 0x3f, 0x41, 0x6d, 0x72, 0xe3, 0xc3,
+	0xcf, 0xc6, 0x01, 0xa1, 0x61, 0x53, 0x3c, 0xd7, 0x39, 0x46, 0x80, 0x48, 0xae, 0x37, 0x0d, 0x86,
+	0xaa, 0x22, 0x1f, 0x99, 0x14, 0xad, 0xea, 0x47, 0x77, 0x09, 0x06, 0x3e, 0x52, 0x95, 0x00, 0x96,
+	0xb9, 0x2c, 0xb0, 0x8e, 0x91, 0x5a, 0x64, 0x23, 0x69, 0x11, 0xed, 0xb3, 0xea, 0x52, 0xfc, 0x86,
+	0xdb, 0x7c, 0xbe, 0xa9, 0x46, 0x3a, 0x89, 0x91, 0xe2, 0xc3, 0x69, 0xb1, 0x0a, 0x01, 0x48, 0x5c,
+	0x89, 0xeb, 0x04, 0x4d, 0x7f, 0x88, 0x76, 0xda, 0xe1, 0x6a, 0xce, 0xb9, 0xf8, 0x9e, 0xf1, 0xe5,
+	0x57, 0x1d, 0xdb, 0xb2, 0x75, 0x4f, 0xb7, 0x9a, 0x8d, 0xf7, 0xc7, 0x23, 0x4d, 0x4b, 0xff, 0x0c,
+	0xa0, 0x8c, 0x36, 0xf8, 0x70, 0xaa, 0x09, 0x42, 0x27, 0xe2, 0xa4, 0xb4, 0xd0, 0x89, 0x47, 0xc5,
+	0x33, 0xcd, 0x17, 0x00, 0xda, 0x7f, 0x6f, 0x97, 0x15, 0xf3, 0xb2, 0x55, 0x20, 0x35, 0x49, 0xa0,
+	0x6b, 0x6d, 0x1c, 0x5a, 0x02, 0x9a, 0x1f, 0xfc, 0x2b, 0x06, 0x07, 0xf9, 0x15, 0xf2, 0x2f, 0x07,
+	0x72, 0x5b, 0x8d, 0x06, 0xda, 0x04, 0x3a, 0x80, 0x60, 0x74, 0xb5, 0x97, 0x89, 0xcd, 0x63, 0x1b,
+	0xf4, 0x8c, 0x18, 0x6f, 0x46, 0xa5, 0xed, 0x09, 0xcb, 0x5a, 0x89, 0xe9, 0x89, 0xf4, 0x55, 0xd6,
+	0x51, 0x43, 0x82, 0x1c, 0xf3, 0xe8, 0x42, 0x0f, 0x80, 0x13, 0xab, 0xb3, 0xea, 0xfa, 0xae, 0xd3,
+	0x21, 0x4f, 0xed, 0xd5, 0x5e, 0xdf, 0x91, 0x4f, 0xff, 0x6c, 0x56, 0x81, 0xfb, 0x42, 0xd0, 0x50,
+	0x0f, 0x7e, 0x9f, 0xd9, 0xd6, 0x63, 0x02, 0x09, 0x94, 0x9e, 0xbc, 0x59, 0x78, 0x67, 0x96, 0x15,
+	0x36, 0x6f, 0x95, 0xd9, 0x00, 0x2b, 0x13, 0xa9, 0x86, 0x38, 0x27, 0x6f, 0x00, 0x97, 0xeb, 0x1c,
+	0xc3, 0x78, 0x38, 0x91, 0xa4, 0x0b, 0x1f, 0xad, 0x55, 0x58, 0x24, 0x7e, 0xec, 0x38, 0x00, 0x1c,
+	0x26, 0xae, 0x5f, 0x36, 0xe1, 0xfa, 0x5e, 0xa3, 0xa2, 0x9c, 0x04, 0x9a, 0x0c, 0xf4, 0x0d, 0xd4,
+	0xa6, 0x07, 0x12, 0x7f, 0x02, 0xb0, 0x7e, 0x7f, 0x41, 0x5b, 0xa5, 0x78, 0xf3, 0xcc, 0x11, 0xc6,
+	0xd2, 0x35, 0x29, 0x80, 0x5c, 0xeb, 0xcd, 0xcc, 0x92, 0x53, 0xa5, 0xcf, 0xf4, 0x87, 0x40, 0x23,
+	0xb7, 0x00, 0x36, 0xb1, 0x1d, 0x2a, 0x3a, 0x37, 0x6d, 0xc5, 0x6f, 0x28, 0xa1, 0xf4, 0x27, 0xaf,
+	0x5b, 0x20, 0xdb, 0xa9, 0x95, 0x7d, 0xd1, 0xcb, 0xfd, 0x6b, 0x5b, 0xcd, 0x54, 0xf5, 0xdb, 0x16,
+	0xdb, 0x9b, 0x2f, 0x81, 0xa0, 0x2f, 0x2d, 0xaf, 0x98, 0x74, 0x32, 0xd5, 0xf7, 0x0a, 0xe4, 0x21,
+	0x4a, 0x05, 0x86, 0x46, 0x6a, 0x83, 0xfc, 0x7d, 0xab, 0x99, 0xb7, 0x59, 0x76, 0xa1, 0x12, 0xb5,
+	0x16, 0x4e, 0x3a, 0x9a, 0xbb, 0xdd, 0xdb, 0x37, 0xb4, 0x9c, 0x28, 0xfc, 0x01, 0x14, 0x89, 0x37,
+	0x0b, 0xa7, 0x0b, 0xae, 0xfc, 0x9c, 0x3d, 0x80, 0xc9, 0x32, 0xef, 0x47, 0x78, 0xfb, 0x98, 0xd0,
+	0xb7, 0xdc, 0xff, 0x1b, 0x75, 0x50, 0xbc, 0xde, 0x3b, 0xb8, 0xd7, 0xf3, 0x6b, 0x70, 0x62, 0x96,
+	0x74, 0xbe, 0xd2, 0x30, 0xb2, 0x8e, 0x90, 0x9d, 0xf1, 0xe3, 0xb4, 0x48, 0xbe, 0x1e, 0x64, 0xa7,
+	0x16, 0xef, 0x9b, 0x40, 0x50, 0x21, 0x45, 0xc9, 0x77, 0x66, 0xeb, 0x6b, 0x05, 0xe5, 0x41, 0xe9,
+	0xda, 0x59, 0xc2, 0x94, 0xde, 0x9e, 0x43, 0x19, 0x1f, 0x27, 0xce, 0x02, 0x5e, 0x78, 0xcd, 0x6e,
+	0xcf, 0x43, 0x71, 0x85, 0x0b, 0x26, 0x47, 0xb6, 0x93, 0xdf, 0x3e, 0x03, 0xb7, 0xb7, 0x3b, 0x33,
+	0xa1, 0xae, 0xd2, 0x31, 0x16, 0x99, 0x47, 0x98, 0x79, 0x2d, 0x00, 0x96, 0x8e, 0x34, 0xc1, 0xb9,
+	0x2a, 0x0b, 0xb0, 0x39, 0xc2, 0x12, 0x39, 0xb0, 0x5f, 0x42, 0x1b, 0x30, 0xb1, 0xa8, 0x81, 0xb9,
+	0xd9, 0x3d, 0x40, 0x94, 0x4f, 0x50, 0x6a, 0x13, 0x38, 0x87, 0xec, 0x4a, 0x7a, 0xad, 0xf7, 0x4f,
+	0x38, 0xa0, 0x30, 0xa1, 0xbe, 0x00, 0xb7, 0x23, 0x81, 0xff, 0xf4, 0x68, 0x3d, 0x26, 0xf7, 0xd1,
+	0x22, 0x87, 0xfd, 0xcd, 0xf1, 0x8e, 0xab, 0x0a, 0x99, 0x1a, 0x11, 0x4b, 0x96, 0x05, 0x18, 0x17,
+	0x1a, 0xb3, 0xc9, 0xd4, 0xe7, 0x63, 0x13, 0x2a, 0x36, 0xf2, 0x35, 0xbd, 0x86, 0xa0, 0x01, 0x58,
+	0x33, 0x2b, 0xa7, 0xaa, 0x47, 0x40, 0x83, 0x38, 0x05, 0x61, 0xf8, 0xa4, 0xd9, 0xf9, 0x94, 0x06,
+	0x62, 0xb4, 0x9f, 0xfc, 0xc1, 0x45, 0x84, 0xba, 0xbf, 0x2b, 0xb2, 0xcc, 0x20, 0xa4, 0x95, 0x22,
+	0x9f, 0x41, 0xe2, 0xe3, 0x09, 0xb6, 0x63, 0x6f, 0x29, 0x13, 0x79, 0x0d, 0xef, 0x26, 0x69, 0x6e,
+	0x25, 0x6b, 0xb9, 0x34, 0xcb, 0x05, 0xbc, 0x0b, 0x21, 0xd4, 0x6e, 0xa3, 0xef, 0x3e, 0x26, 0xf5,
+	0x2d, 0x4a, 0xbd, 0x41, 0xf3, 0x99, 0xe5, 0xbc, 0x84, 0xf5, 0x51, 0xaf, 0x90, 0x3e, 0xfd, 0x2b,
+	0x44, 0xa6, 0x9b, 0x31, 0xe0, 0x58, 0xb5, 0x6f, 0x32, 0xdf, 0x10, 0x83, 0x48, 0x68, 0xf4, 0xbc,
+	0x3d, 0x39, 0x28, 0xcc, 0x14, 0xef, 0x5a, 0xe8, 0x4a, 0x01, 0x1c, 0xb4, 0x98, 0x51, 0x75, 0x7e,
+	0x5d, 0x80, 0x25, 0x89, 0xb3, 0xb0, 0x53, 0xb9, 0x9a, 0xbf, 0x6b, 0x1b, 0x01, 0x42, 0x43, 0xd9,
+	0x65, 0x48, 0x3e, 0xbb, 0x76, 0xb3, 0x52, 0xc4, 0x92, 0xd0, 0xed, 0x69, 0x66, 0x6c, 0x61, 0x32,
+	0xbe, 0xc3, 0x30, 0x1b, 0x93, 0x17, 0x50, 0x32, 0x3b, 0xb2, 0xac, 0x11, 0x7e, 0x89, 0x73, 0x8a,
+	0x78, 0x21, 0xa5, 0x4b, 0xf8, 0x1c, 0x5a, 0x6b, 0x3e, 0xae, 0x16, 0x88, 0x88, 0x55, 0x2b, 0x1d,
+	0x9b, 0x7f, 0x23, 0xbc, 0xd3, 0x73, 0x32, 0x7d, 0x3a, 0xb8, 0x73, 0xa4, 0x8a, 0x85, 0xa4, 0x0c,
+	0xc0, 0x4e, 0x0b, 0x14, 0x18, 0xaa, 0xca, 0x90, 0x56, 0x42, 0x56, 0x6d, 0x19, 0x7d, 0x94, 0x39,
+	0xc6, 0x7d, 0x14, 0xc1, 0x14, 0x0f, 0xa3, 0x34, 0x9e, 0x38, 0x90, 0x26, 0x94, 0xf1, 0x85, 0x18,
+	0xbc, 0xde, 0x2c, 0x16, 0xa4, 0x20, 0x4c, 0x64, 0x0c, 0x6d, 0x90, 0xec, 0x81, 0xcf, 0xe7, 0x10,
+	0xb4, 0xee, 0x2e, 0x1a, 0x6b, 0x21, 0xd1, 0x17, 0xbc, 0xb6, 0x03, 0x36, 0x3b, 0xce, 0x7b, 0x73,
+	0xd0, 0xcd, 0x41, 0x6c, 0xa8, 0xfd, 0x97, 0x45, 0xff, 0xd9, 0xb4, 0xec, 0x3a, 0xc5, 0xc6, 0x41,
+	0xae, 0x61, 0x1a, 0xa5, 0x17, 0x26, 0xfb, 0x4a, 0x4f, 0x22, 0x06, 0xf6, 0x37, 0xfe, 0x56, 0x3c,
+	0x82, 0x64, 0xce, 0xb7, 0x6b, 0x1b, 0x6a, 0x06, 0x5a, 0x05, 0xbc, 0x20, 0x05, 0xdb, 0x72, 0x38,
+	0x1b, 0x2f, 0x4a, 0x04, 0x17, 0x1a, 0xa0, 0x78, 0x69, 0x84, 0xa4, 0xe1, 0xa9, 0x14, 0x47, 0x27,
+	0x46, 0xe6, 0x83, 0xa3, 0xa9, 0x47, 0xf0, 0x6c, 0xe9, 0xc5, 0xfe, 0x64, 0xeb, 0xc4, 0x1a, 0x39,
+	0xc7, 0x4b, 0x30, 0x2a, 0x12, 0xb5, 0xa3, 0x10, 0xd8, 0xa4, 0xf1, 0xb5, 0x69, 0x1a, 0x84, 0x1d,
+	0x34, 0xb8, 0x80, 0x38, 0x46, 0x02, 0x16, 0xa2, 0x5d, 0xf4, 0xe3, 0x92, 0x0b, 0x97, 0x80, 0xcd,
+	0xdb, 0x5e, 0x92, 0x55, 0x15, 0x2c, 0xf0, 0xb7, 0xa1, 0xca, 0x87, 0x6a, 0xe7, 0xa0, 0x7a, 0x48,
+	0xd4, 0x7c, 0xf8, 0xcd, 0xce, 0x3e, 0x65, 0x86, 0x4e, 0x3e, 0x7c, 0x16, 0xda, 0x67, 0xec, 0xa9,
+	0xbb, 0x1e, 0xd6, 0x48, 0xbe, 0x14, 0x0b, 0xb8, 0x52, 0x86, 0x5a, 0xc5, 0x1f, 0x9f, 0x7e, 0x55,
+	0xe0, 0xf4, 0xd6, 0xd8, 0x5c, 0x4c, 0x60, 0xa1, 0xa0, 0xb8, 0x8b, 0xbc, 0xab, 0x94, 0x24, 0xb1,
+	0x79, 0x81, 0x41, 0xc5, 0x02, 0x97, 0xa3, 0x65, 0xda, 0x8b, 0x68, 0x28, 0x17, 0xbb, 0xa1, 0x94,
+	0xbc, 0x0d, 0xaa, 0x4e, 0x3b, 0xb1, 0xdb, 0x41, 0x0d, 0x1e, 0xea, 0xf5, 0x55, 0x95, 0x3b, 0x0c,
+	0x9e, 0x5e, 0x68, 0x1d, 0x3d, 0xbf, 0x94, 0x5b, 0x05, 0x59, 0xba, 0x67, 0xc7, 0x42, 0xe2, 0x80,
+	0xca, 0x0a, 0xce, 0x0c, 0xf7, 0xef, 0xac, 0x06, 0xcd, 0xef, 0x61, 0xe2, 0xdd, 0x9e, 0x28, 0x59,
+	0x13, 0x47, 0x15, 0xb9, 0x1f, 0x07, 0x32, 0x97, 0xd4, 0xa1, 0x68, 0xc7, 0x2d, 0xf2, 0xa9, 0x79,
+	0x90, 0x7f, 0x19, 0x24, 0x44, 0x40, 0x21, 0x51, 0x26, 0xd1, 0x66, 0x86, 0x0c, 0xd0, 0xe1, 0xd8,
+	0xc8, 0x81, 0xef, 0x1a, 0xe0, 0xc7, 0x0c, 0x56, 0xd5, 0x80, 0xeb, 0x62, 0x68, 0x62, 0xbf, 0x75,
+	0x1f, 0x6d, 0xf6, 0xfa, 0xf0, 0xfd, 0x22, 0x19, 0x41, 0x72, 0x86, 0x42, 0xd0, 0x28, 0x7f, 0x57,
+	0x37, 0xb7, 0x7e, 0x78, 0x35, 0xc5, 0x4b, 0xc3, 0x22, 0xc9, 0x55, 0x27, 0xfb, 0x44, 0xf9, 0x68,
+	0x06, 0xbf, 0x48, 0x02, 0xf1, 0x53, 0x91, 0xd5, 0x35, 0x48, 0x17, 0x95, 0x89, 0x31, 0x5c, 0x86,
+	0x51, 0xe4, 0xf9, 0x49, 0x71, 0xf7, 0x41, 0x9f, 0x5a, 0x11, 0x8c, 0x82, 0xa8, 0xcd, 0xf4, 0x48,
+	0x1f, 0xb4, 0xee, 0x71, 0xf0, 0xc3, 0xdd, 0x8b, 0x9c, 0xe3, 0xd1, 0xad, 0x0d, 0x8d, 0x2d, 0x38,
+	0x92, 0xe6, 0x77, 0x51, 0x54, 0xe8, 0x5e, 0x0a, 0x3d, 0xcb, 0xa8, 0xc9, 0xc3, 0x8d, 0x3d, 0xe4,
+	0x4e, 0xe9, 0xd0, 0x51, 0x3e, 0x1d, 0x85, 0xf5, 0xf4, 0x86, 0xee, 0x7d, 0x9d, 0x44, 0xa5, 0xdd,
+	0x9b, 0x7b, 0x8c, 0xc6, 0x57, 0x2a, 0xf0, 0xce, 0xba, 0x54, 0xf4, 0xc5, 0xf1, 0xc9, 0x6d, 0x96,
+	0x54, 0x83, 0xb1, 0x34, 0xff, 0x96, 0x21, 0x50, 0xbe, 0xc5, 0xce, 0xd2, 0x0b, 0x7a, 0x53, 0x15,
+	0x9b, 0x5d, 0x5c, 0xfa, 0x14, 0x9b, 0x45, 0xc8, 0xe8, 0xc6, 0x4e, 0xb2, 0x5f, 0x92, 0xfd, 0xcc,
+	0xfd, 0x7b, 0x12, 0x69, 0x90, 0x11, 0xdf, 0x3b, 0x33, 0x44, 0xc9, 0xae, 0xa1, 0xe4, 0x34, 0xde,
+	0xd8, 0x0b, 0xda, 0x4b, 0x0a, 0xf4, 0x31, 0xb8, 0x0e, 0x49, 0x2c, 0x9c, 0xcb, 0x2c, 0x6c, 0x0f,
+	0x0f, 0xd7, 0x4f, 0xda, 0x3e, 0x46, 0xba, 0x39, 0x75, 0x02, 0x40, 0xbf, 0xea, 0x08, 0xa2, 0x69,
+	0xd8, 0xff, 0x59, 0x2e, 0x5e, 0x6c, 0xeb, 0x3c, 0xe7, 0xf5, 0x01, 0xb6, 0x9d, 0xb4, 0xf0, 0x9a,
+	0xda, 0xcc, 0xf2, 0xb6, 0x01, 0xca, 0x8f, 0x9f, 0x05, 0xba, 0x83, 0x32, 0x3d, 0x3e, 0x00, 0x75,
+	0xe1, 0xed, 0x1a, 0x9d, 0x42, 0x45, 0x0b, 0x9a, 0xb7, 0x9f, 0x97, 0xea, 0xf4, 0x49, 0x43, 0x7b,
+	0xf7, 0x61, 0x52, 0x05, 0xd1, 0x11, 0x99, 0xcc, 0xa8, 0x7c, 0xca, 0x1a, 0xb4, 0xc1, 0xf8, 0xde,
+	0x75, 0x7a, 0xc8, 0xee, 0xcb, 0x7a, 0x95, 0x1c, 0x78, 0xf7, 0x7c, 0x22, 0xf5, 0x52, 0x30, 0x9d,
+	0x18, 0x88, 0xdb, 0x09, 0x63, 0x82, 0xa8, 0x1e, 0x19, 0xb0, 0x79, 0x1a, 0xb4, 0xb0, 0x7c, 0xa0,
+	0xbd, 0x1b, 0x1e, 0x5f, 0x66, 0x1a, 0xc7, 0xf9, 0x69, 0x48, 0xed, 0xf4, 0xb9, 0x72, 0xf3, 0x9d,
+	0x3d, 0x3c, 0xd1, 0x9d, 0x65, 0xb2, 0x17, 0x3a, 0x48, 0x67, 0xfd, 0x6e, 0xe9, 0x63, 0xe5, 0x3c,
+	0x2b, 0x97, 0xd6, 0x51, 0x8a, 0x49, 0x29, 0xff, 0xd0, 0xd1, 0xb1, 0x2a, 0xa7, 0xcb, 0xfc, 0x17,
+	0x38, 0xff, 0x67, 0xdf, 0x37, 0x6e, 0xc3, 0xfd, 0xc9, 0x58, 0xf8, 0x21, 0x8e, 0x14, 0xea, 0x15,
+	0x9e, 0x10, 0x77, 0xff, 0xb1, 0x82, 0x88, 0x30, 0xfb, 0xc3, 0xa6, 0x34, 0xdf, 0x7a, 0x20, 0xc3,
+	0xe2, 0xe3, 0x98, 0x3a, 0x5d, 0xc8, 0x1d, 0xb5, 0x90, 0x3f, 0x2f, 0xb7, 0xbd, 0x85, 0xff, 0x7a,
+	0x3a, 0xc3, 0xbf, 0x2a, 0x27, 0xa5, 0x5d, 0x70, 0x2a, 0xfa, 0xcb, 0xf9, 0x4b, 0x95, 0xbc, 0x48,
+	0x41, 0x4e, 0x7f, 0x74, 0x46, 0x23, 0xbd, 0x44, 0xcf, 0xf1, 0x37, 0x37, 0x80, 0xd7, 0xef, 0x89,
+	0xa5, 0xf7, 0xe9, 0x0e, 0x82, 0x40, 0xcb, 0xde, 0xd7, 0xed, 0x96, 0x5e, 0x5c, 0x66, 0xc5, 0x61,
+	0x08, 0xeb, 0x0a, 0x2c, 0x3c, 0x84, 0x17, 0xac, 0x29, 0x2c, 0xee, 0x88, 0x24, 0x9b, 0x29, 0x82,
+	0x67, 0xc0, 0xd1, 0x1f, 0x14, 0x4e, 0x8a, 0x9f, 0xaa, 0xd5, 0x82, 0x6f, 0xfe, 0xde, 0xf8, 0x23,
+	0x3c, 0xa2, 0x52, 0xf8, 0xeb, 0x83, 0xa3, 0xb5, 0x38, 0x03, 0x4f, 0x0a, 0xb5, 0xbf, 0x24, 0xfd,
+	0x20, 0x7b, 0x64, 0x83, 0x6c, 0xd0, 0x3c, 0x25, 0x87, 0x2f, 0x98, 0x33, 0xd0, 0x0e, 0x3d, 0x15,
+	0x6a, 0xe5, 0x88, 0x4e, 0x29, 0x52, 0x33, 0x22, 0x41, 0x8f, 0x22, 0xb3, 0x62, 0xb7, 0x50, 0xe5,
+	0x0c, 0x43, 0x02, 0xcb, 0xcc, 0xaf, 0xd3, 0x30, 0xc7, 0xae, 0xf5, 0xd3, 0x6d, 0xea, 0x21, 0xae,
+	0x8f, 0xb9, 0xb2, 0xe4, 0xd2, 0xeb, 0x68, 0x1f, 0x67, 0x79, 0x28, 0xf9, 0x7c, 0xf9, 0x0e, 0xcb,
+	0xfb, 0xd5, 0x13, 0xf4, 0xe4, 0xd0, 0x95, 0x2f, 0x80, 0x0f, 0xb9, 0xe9, 0x04, 0x34, 0x20, 0x64,
+	0x9d, 0x2a, 0xce, 0xc5, 0x7d, 0x79, 0xc8, 0xd2, 0x39, 0xeb, 0x53, 0x90, 0xf7, 0x0e, 0x40, 0xb6,
+	0x9d, 0xd9, 0x51, 0x5d, 0xb0, 0x59, 0x60, 0x2e, 0x76, 0x00, 0xb5, 0x81, 0x5e, 0x13, 0xda, 0xf2,
+	0x6c, 0xa2, 0x91, 0xa4, 0x97, 0x8c, 0x2d, 0x57, 0x3d, 0x9e, 0x5d, 0x55, 0xf6, 0xff, 0x5b, 0x46,
+	0x05, 0xc9, 0x05, 0xbd, 0x41, 0x5e, 0x5b, 0x32, 0xe1, 0x97, 0x37, 0xec, 0x5d, 0x5e, 0x92, 0x7d,
+	0xd1, 0x8d, 0x0c, 0x91, 0x1f, 0xed, 0x15, 0x99, 0xce, 0x98, 0xb3, 0xc4, 0x73, 0x8a, 0x9f, 0xee,
+	0x0a, 0xda, 0xad, 0xf2, 0x99, 0x1b, 0xd2, 0x3f, 0x6c, 0x4c, 0x21, 0xf4, 0xfc, 0xf8, 0xb1, 0x97,
+	0x74, 0x1e, 0x80, 0x7f, 0xfe, 0xec, 0x1e, 0xbf, 0x5a, 0xfe, 0x2a, 0x6e, 0xb7, 0x98, 0xb4, 0x9c,
+	0x53, 0x50, 0x3e, 0xe5, 0x21, 0xa9, 0x4e, 0x76, 0x4f, 0x07, 0xb7, 0xee, 0x70, 0x02, 0xeb, 0x56,
+	0x04, 0xff, 0xb4, 0x9d, 0xb8, 0x70, 0x3c, 0x1f, 0x51, 0xee, 0x51, 0x08, 0xca, 0x24, 0x0f, 0x55,
+	0xa3, 0x26, 0x4c, 0x3c, 0x72, 0x20, 0x0f, 0xfb, 0x94, 0x22, 0xfa, 0xb8, 0xfa, 0x77, 0x23, 0x6f,
+	0xb4, 0x40, 0x45, 0xc3, 0xc7, 0x9a, 0xca, 0xd9, 0xc3, 0x1a, 0x62, 0x08, 0x29, 0x04, 0xe8, 0xd2,
+	0x63, 0x41, 0x29, 0x9f, 0x37, 0x82, 0x81, 0x8e, 0x7d, 0x8f, 0x16, 0x68, 0x92, 0x0d, 0xf0, 0x6c,
+	0xa2, 0x1d, 0x67, 0x48, 0xa0, 0x94, 0x38, 0x99, 0x6a, 0x80, 0x89, 0xea, 0x2d, 0x35, 0x82, 0x45,
+	0x9f, 0x15, 0xa0, 0x7c, 0x77, 0x03, 0x9a, 0x2f, 0x26, 0x84, 0xcf, 0xfb, 0x9f, 0x9f, 0xac, 0xfd,
+	0x76, 0xe3, 0x41, 0x1a, 0xd9, 0xf2, 0xa2, 0x9a, 0xfa, 0x07, 0x42, 0x1f, 0x4c, 0xdf, 0x02, 0x34,
+	0x33, 0x2e, 0x75, 0x18, 0x66, 0x16, 0x56, 0xcd, 0x4c, 0xe3, 0x4c, 0x9c, 0x4e, 0x04, 0x96, 0xaa,
+	0x41, 0x76, 0x49, 0xb9, 0xdf, 0x03, 0x77, 0x9d, 0x11, 0x44, 0x8c, 0xd2, 0x1a, 0xc2, 0x95, 0xc1,
+	0xc4, 0xaf, 0xa2, 0x0f, 0xde, 0x4a, 0x3c, 0x32, 0xb0, 0xbd, 0xc9, 0x81, 0x40, 0xd8, 0x9e, 0xe0,
+	0x55, 0xf8, 0x81, 0x41, 0x1e, 0x87, 0x7f, 0xb7, 0x9a, 0x08, 0xd9, 0x2d, 0x77, 0xd1, 0x40, 0x3a,
+	0xf8, 0x07, 0x4a, 0x24, 0xe5, 0x9d, 0xc6, 0xfd, 0x1b, 0xc0, 0x7e, 0x9b, 0x0d, 0xaa, 0x63, 0x0b,
+	0x15, 0xcd, 0xb3, 0x5e, 0x7d, 0x98, 0x41, 0x59, 0x4b, 0x38, 0x69, 0xe8, 0x8a, 0x27, 0x56, 0x1f,
+	0xcb, 0x4c, 0xd4, 0x08, 0xb8, 0x90, 0xe8, 0x1e, 0x39, 0xfc, 0xf5, 0x24, 0x10, 0x86, 0x4f, 0x00,
+	0x9f, 0x91, 0xa9, 0xa1, 0x63, 0x37, 0x0d, 0x8e, 0x1b, 0xfa, 0x9b, 0x7b, 0x5f, 0x26, 0x7f, 0x7e,
+	0x8c, 0x6f, 0xbd, 0x3a, 0x96, 0xd7, 0xa3, 0x9c, 0xc8, 0x24, 0x77, 0x8e, 0xf1, 0x00, 0x49, 0x64,
+	0x8a, 0x9d, 0xf8, 0x62, 0xe5, 0x89, 0xa0, 0x6a, 0x0b, 0x12, 0x5d, 0xc1, 0xf3, 0x0a, 0xe0, 0xbc,
+	0xd8, 0x4b, 0xda, 0xbd, 0xfe, 0xb6, 0xbb, 0xec, 0xe5, 0x84, 0x94, 0xbf, 0xe1, 0x02, 0x3f, 0x98,
+	0x32, 0x92, 0x4b, 0x48, 0x82, 0x01, 0x99, 0x48, 0xd9, 0x0f, 0xaf, 0xbb, 0x71, 0xb6, 0x45, 0x2c,
+	0xa6, 0x4a, 0x73, 0x61, 0xae, 0xb8, 0x3a, 0x19, 0x0b, 0xb9, 0xe1, 0x42, 0x3a, 0x29, 0x1d, 0x58,
+	0xa4, 0x72, 0x0e, 0xd2, 0x39, 0x81, 0x4e, 0xdb, 0xd6, 0x5d, 0xce, 0x37, 0x1e, 0xf4, 0x5d, 0x29,
+	0xf5, 0xdb, 0x15, 0x46, 0x00, 0xc9, 0xe5, 0x22, 0x7f, 0xe4, 0xc3, 0x7a, 0x50, 0x7f, 0x91, 0xd4,
+	0x1e, 0xbc, 0x04, 0xe1, 0x28, 0x50, 0x0d, 0x42, 0xfc, 0x40, 0x42, 0x94, 0x2d, 0xd0, 0x07, 0x6d,
+	0xab, 0xda, 0x13, 0xf8, 0xce, 0xcc, 0x12, 0xb5, 0x1d, 0xa0, 0x54, 0x54, 0xa8, 0x94, 0xf7, 0xf2,
+	0xb0, 0x04, 0x6f, 0x97, 0x98, 0x4c, 0xdd, 0x17, 0x24, 0x82, 0x2d, 0xae, 0x40, 0xa4, 0xa8, 0x92,
+	0x58, 0x73, 0xad, 0xc2, 0xe9, 0xa2, 0x26, 0x69, 0x45, 0x23, 0x95, 0xdd, 0xc0, 0x2e, 0x60, 0xc1,
+	0xa6, 0x0b, 0x9e, 0x1c, 0xfb, 0xe2, 0x21, 0x91, 0x51, 0x30, 0xca, 0xec, 0x4a, 0xca, 0x1b, 0x14,
+	0xa4, 0x7a, 0xd9, 0x01, 0x34, 0x0e, 0x16, 0x55, 0xaf, 0xa9, 0x6f, 0x97, 0x51, 0x7f, 0x3f, 0xfc,
+	0x47, 0xfc, 0xdc, 0x6a, 0xb2, 0x9c, 0x0b, 0x28, 0x38, 0xb1, 0x92, 0x43, 0x54, 0x85, 0x12, 0xf5,
+	0x52, 0x08, 0x2c, 0xa1, 0x7c, 0x34, 0xff, 0xbb, 0xa4, 0x7e, 0x80, 0x7d, 0x35, 0x95, 0x1c, 0x84,
+	0xea, 0xc7, 0x1a, 0x99, 0xd2, 0x3e, 0x83, 0xb9, 0x75, 0x5a, 0x72, 0xe3, 0xe6, 0x06, 0xfe, 0xcd,
+	0x3d, 0xe2, 0x5b, 0xe4, 0x07, 0xff, 0xbb, 0x46, 0xd4, 0x1e, 0xd2, 0x5c, 0x0f, 0x4a, 0x90, 0x6f,
+	0x84, 0xa3, 0x72, 0x6f, 0x3a, 0x7b, 0x75, 0x9e, 0xa2, 0x16, 0x9a, 0x1a, 0x8b, 0x4b, 0x12, 0xfc,
+	0x36, 0x32, 0x59, 0x6b, 0x67, 0x13, 0xbd, 0xb3, 0xa4, 0xd8, 0x94, 0x03, 0xb1, 0x53, 0xec, 0xab,
+	0xbb, 0x9d, 0x07, 0x6b, 0x33, 0xb9, 0x45, 0xbd, 0xe1, 0x08, 0xbc, 0x30, 0xc8, 0x52, 0xf7, 0x30,
+	0x69, 0x12, 0x4c, 0x89, 0xa8, 0x75, 0x09, 0x66, 0x66, 0x1b, 0xee, 0x07, 0x25, 0x5f, 0xd2, 0xfb,
+	0x9d, 0xc9, 0x61, 0x0e, 0x33, 0x6e, 0x29, 0xfc, 0x36, 0x49, 0x63, 0x29, 0x13, 0xd0, 0x92, 0xff,
+	0xed, 0x02, 0x75, 0x7e, 0xb2, 0x36, 0x70, 0x41, 0xee, 0x17, 0xc8, 0x3a, 0x68, 0xe4, 0x56, 0x72,
+	0x58, 0x55, 0xe6, 0xec, 0xf5, 0x3d, 0x0e, 0x74, 0x7f, 0x09, 0x9b, 0xef, 0xc7, 0x21, 0x19, 0xb0,
+	0x09, 0x9e, 0x05, 0x47, 0x5b, 0xc8, 0x7c, 0xed, 0xac, 0x5c, 0x42, 0x2b, 0x5c, 0xce, 0x38, 0x3f,
+	0x87, 0x6d, 0xfe, 0xd4, 0x26, 0x49, 0xf1, 0xba, 0x31, 0x28, 0xa8, 0xaa, 0x00, 0x11, 0x0f, 0xad,
+	0x90, 0x74, 0x01, 0xde, 0xc4, 0x4e, 0xc5, 0x0c, 0xc1, 0xcc, 0x0e, 0x15, 0xa1, 0xec, 0x66, 0xa9,
+	0x46, 0x02, 0x38, 0x97, 0xd3, 0xa7, 0x53, 0x3d, 0xd9, 0x08, 0x0b, 0x1f, 0x06, 0x48, 0x39, 0xb9,
+	0x72, 0x81, 0x9a, 0x17, 0xf5, 0x0f, 0x74, 0xac, 0xf9, 0x85, 0x49, 0x6a, 0xbe, 0x32, 0xb6, 0xc0,
+	0x6c, 0x1e, 0x84, 0xb9, 0x64, 0x38, 0x11, 0x45, 0x4d, 0x30, 0x94, 0xac, 0x2b, 0x37, 0x3a, 0x55,
+	0x63, 0x12, 0xfb, 0xa8, 0x02, 0x50, 0xdc, 0x49, 0x68, 0xd7, 0x3c, 0xde, 0xeb, 0x2e, 0x07, 0xac,
+	0x6c, 0x22, 0x3e, 0xd1, 0x72, 0x5e, 0xe8, 0xe8, 0xff, 0x01, 0x3b, 0xee, 0x3f, 0xe2, 0x00, 0x10,
+	0x00, 0x00, 0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x00, 0x42, 0x43,
+	0x02, 0x00, 0x1b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t vsmbr_test_compressed_corrupted_data[ 8750 ];
+
+/* Fills the end of the test image data with pseudo random data
+ * The pseudo random data has a skewed distribution of byte values
+ * so that it is compressed with Huffman codes of up to 15 bits
+ */
+void vsmbr_test_compressed_fill_random_data(
+      uint8_t *image_data )
+{
+	size_t data_offset   = 0;
+	uint32_t value_32bit = 0x12345678UL;
+
+	for( data_offset = VSMBR_TEST_COMPRESSED_RANDOM_DATA_OFFSET;
+	     data_offset < VSMBR_TEST_COMPRESSED_IMAGE_SIZE;
+	     data_offset++ )
+	{
+		value_32bit = ( value_32bit * 1103515245UL ) + 12345UL;
+
+		image_data[ data_offset ] = (uint8_t) ( ( value_32bit >> 24 ) & ( value_32bit >> 16 ) );
+	}
+}
+
+/* Creates a memory range file IO handle of compressed data
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_compressed_initialize_file_io_handle(
+     libbfio_handle_t **file_io_handle,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	if( libbfio_memory_range_initialize(
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libbfio_memory_range_set(
+	     *file_io_handle,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libbfio_handle_free(
+		 file_io_handle,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+/* Tests the libvsmbr_compressed_io_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_compressed_io_handle_initialize(
+     void )
+{
+	libbfio_handle_t *file_io_handle                      = NULL;
+	libcerror_error_t *error                              = NULL;
+	libvsmbr_compressed_io_handle_t *compressed_io_handle = NULL;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	result = vsmbr_test_compressed_initialize_file_io_handle(
+	          &file_io_handle,
+	          vsmbr_test_compressed_data,
+	          8750,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_compressed_io_handle_initialize(
+	          &compressed_io_handle,
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_io_handle",
+	 compressed_io_handle );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "compressed_io_handle->last_frame_index",
+	 compressed_io_handle->last_frame_index,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "compressed_io_handle->cached_frames[ 0 ].frame_index",
+	 compressed_io_handle->cached_frames[ 0 ].frame_index,
+	 -1 );
+
+	result = libvsmbr_compressed_io_handle_free(
+	          &compressed_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "compressed_io_handle",
+	 compressed_io_handle );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_compressed_io_handle_initialize(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_io_handle = (libvsmbr_compressed_io_handle_t *) 0x12345678UL;
+
+	result = libvsmbr_compressed_io_handle_initialize(
+	          &compressed_io_handle,
+	          file_io_handle,
+	          &error );
+
+	compressed_io_handle = NULL;
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_compressed_io_handle_initialize(
+	          &compressed_io_handle,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_io_handle != NULL )
+	{
+		libvsmbr_compressed_io_handle_free(
+		 &compressed_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_compressed_io_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_compressed_io_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvsmbr_compressed_io_handle_free(
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_compressed_io_handle_open function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_compressed_io_handle_open(
+     void )
+{
+	libvsmbr_compressed_frame_t frame;
+
+	libbfio_handle_t *file_io_handle                      = NULL;
+	libcerror_error_t *error                              = NULL;
+	libvsmbr_compressed_io_handle_t *compressed_io_handle = NULL;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	result = vsmbr_test_compressed_initialize_file_io_handle(
+	          &file_io_handle,
+	          vsmbr_test_compressed_data,
+	          8750,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_compressed_io_handle_initialize(
+	          &compressed_io_handle,
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+
+	/* The base file IO handle is opened by the compressed IO handle
+	 * and the end-of-file marker is not part of the frame index
+	 */
+	result = libvsmbr_compressed_io_handle_open(
+	          compressed_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_io_handle->base_file_io_handle_opened_in_library",
+	 compressed_io_handle->base_file_io_handle_opened_in_library,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "compressed_io_handle->number_of_frames",
+	 compressed_io_handle->number_of_frames,
+	 VSMBR_TEST_COMPRESSED_NUMBER_OF_FRAMES );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "compressed_io_handle->size",
+	 compressed_io_handle->size,
+	 (size64_t) VSMBR_TEST_COMPRESSED_IMAGE_SIZE );
+
+	/* The members are indexed with a single read of the compressed image
+	 */
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "compressed_io_handle->number_of_compressed_reads",
+	 compressed_io_handle->number_of_compressed_reads,
+	 (uint64_t) 1 );
+
+	result = libvsmbr_compressed_io_handle_get_frame_by_index(
+	          compressed_io_handle,
+	          1,
+	          &frame,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "frame.member_offset",
+	 frame.member_offset,
+	 (int64_t) 543 );
+
+	VSMBR_TEST_ASSERT_EQUAL_SIZE(
+	 "frame.member_size",
+	 frame.member_size,
+	 (size_t) 499 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "frame.uncompressed_offset",
+	 frame.uncompressed_offset,
+	 (int64_t) 512 );
+
+	VSMBR_TEST_ASSERT_EQUAL_SIZE(
+	 "frame.uncompressed_size",
+	 frame.uncompressed_size,
+	 (size_t) 32768 );
+
+	result = libvsmbr_compressed_io_handle_get_frame_by_index(
+	          compressed_io_handle,
+	          VSMBR_TEST_COMPRESSED_NUMBER_OF_FRAMES,
+	          &frame,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_compressed_io_handle_open(
+	          compressed_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_compressed_io_handle_close(
+	          compressed_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_is_open(
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_compressed_io_handle_open(
+	          NULL,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_compressed_io_handle_open(
+	          compressed_io_handle,
+	          LIBBFIO_OPEN_READ_WRITE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_compressed_io_handle_close(
+	          compressed_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_compressed_io_handle_free(
+	          &compressed_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test opening data with an invalid member signature
+	 */
+	memory_copy(
+	 vsmbr_test_compressed_corrupted_data,
+	 vsmbr_test_compressed_data,
+	 8750 );
+
+	vsmbr_test_compressed_corrupted_data[ 0 ] = 0xff;
+
+	result = vsmbr_test_compressed_initialize_file_io_handle(
+	          &file_io_handle,
+	          vsmbr_test_compressed_corrupted_data,
+	          8750,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_compressed_io_handle_initialize(
+	          &compressed_io_handle,
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_compressed_io_handle_open(
+	          compressed_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_compressed_io_handle_free(
+	          &compressed_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test opening data with a member that is truncated
+	 */
+	vsmbr_test_compressed_corrupted_data[ 0 ] = 0x1f;
+
+	result = vsmbr_test_compressed_initialize_file_io_handle(
+	          &file_io_handle,
+	          vsmbr_test_compressed_corrupted_data,
+	          8710,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_compressed_io_handle_initialize(
+	          &compressed_io_handle,
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_compressed_io_handle_open(
+	          compressed_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_compressed_io_handle_free(
+	          &compressed_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_io_handle != NULL )
+	{
+		libvsmbr_compressed_io_handle_free(
+		 &compressed_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_compressed_io_handle_append_frame function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_compressed_io_handle_append_frame(
+     void )
+{
+	libvsmbr_compressed_frame_t frame;
+
+	libbfio_handle_t *file_io_handle                      = NULL;
+	libcerror_error_t *error                              = NULL;
+	libvsmbr_compressed_io_handle_t *compressed_io_handle = NULL;
+	size_t frame_offset                                   = 0;
+	int frame_index                                       = 0;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	result = vsmbr_test_compressed_initialize_file_io_handle(
+	          &file_io_handle,
+	          vsmbr_test_compressed_data,
+	          8750,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_compressed_io_handle_initialize(
+	          &compressed_io_handle,
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &( compressed_io_handle->frame_chunks_array ),
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+
+	/* Append frames of 1000 bytes of uncompressed data, which are stored in 3 chunks
+	 */
+	for( frame_index = 0;
+	     frame_index < ( 2 * LIBVSMBR_COMPRESSED_NUMBER_OF_FRAMES_PER_CHUNK ) + 3;
+	     frame_index++ )
+	{
+		result = libvsmbr_compressed_io_handle_append_frame(
+		          compressed_io_handle,
+		          (off64_t) frame_index * 600,
+		          600,
+		          18,
+		          1000,
+		          (uint32_t) frame_index,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "compressed_io_handle->number_of_frames",
+	 compressed_io_handle->number_of_frames,
+	 ( 2 * LIBVSMBR_COMPRESSED_NUMBER_OF_FRAMES_PER_CHUNK ) + 3 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "compressed_io_handle->size",
+	 compressed_io_handle->size,
+	 (size64_t) ( ( 2 * LIBVSMBR_COMPRESSED_NUMBER_OF_FRAMES_PER_CHUNK ) + 3 ) * 1000 );
+
+	result = libvsmbr_compressed_io_handle_get_frame_by_index(
+	          compressed_io_handle,
+	          LIBVSMBR_COMPRESSED_NUMBER_OF_FRAMES_PER_CHUNK + 5,
+	          &frame,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "frame.member_offset",
+	 frame.member_offset,
+	 (int64_t) ( LIBVSMBR_COMPRESSED_NUMBER_OF_FRAMES_PER_CHUNK + 5 ) * 600 );
+
+	VSMBR_TEST_ASSERT_EQUAL_SIZE(
+	 "frame.member_size",
+	 frame.member_size,
+	 (size_t) 600 );
+
+	VSMBR_TEST_ASSERT_EQUAL_SIZE(
+	 "frame.compressed_data_offset",
+	 frame.compressed_data_offset,
+	 (size_t) 18 );
+
+	VSMBR_TEST_ASSERT_EQUAL_SIZE(
+	 "frame.compressed_data_size",
+	 frame.compressed_data_size,
+	 (size_t) 574 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "frame.uncompressed_offset",
+	 frame.uncompressed_offset,
+	 (int64_t) ( LIBVSMBR_COMPRESSED_NUMBER_OF_FRAMES_PER_CHUNK + 5 ) * 1000 );
+
+	VSMBR_TEST_ASSERT_EQUAL_SIZE(
+	 "frame.uncompressed_size",
+	 frame.uncompressed_size,
+	 (size_t) 1000 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "frame.checksum",
+	 frame.checksum,
+	 (uint32_t) ( LIBVSMBR_COMPRESSED_NUMBER_OF_FRAMES_PER_CHUNK + 5 ) );
+
+	/* Test retrieving the frames at the end of the first chunk and in the last chunk
+	 */
+	result = libvsmbr_compressed_io_handle_get_frame_at_offset(
+	          compressed_io_handle,
+	          ( (off64_t) LIBVSMBR_COMPRESSED_NUMBER_OF_FRAMES_PER_CHUNK * 1000 ) - 1,
+	          &frame_index,
+	          &frame_offset,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "frame_index",
+	 frame_index,
+	 LIBVSMBR_COMPRESSED_NUMBER_OF_FRAMES_PER_CHUNK - 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_SIZE(
+	 "frame_offset",
+	 frame_offset,
+	 (size_t) 999 );
+
+	result = libvsmbr_compressed_io_handle_get_frame_at_offset(
+	          compressed_io_handle,
+	          ( (off64_t) ( ( 2 * LIBVSMBR_COMPRESSED_NUMBER_OF_FRAMES_PER_CHUNK ) + 1 ) * 1000 ) + 10,
+	          &frame_index,
+	          &frame_offset,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "frame_index",
+	 frame_index,
+	 ( 2 * LIBVSMBR_COMPRESSED_NUMBER_OF_FRAMES_PER_CHUNK ) + 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_SIZE(
+	 "frame_offset",
+	 frame_offset,
+	 (size_t) 10 );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_compressed_io_handle_append_frame(
+	          NULL,
+	          0,
+	          600,
+	          18,
+	          1000,
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_compressed_io_handle_append_frame(
+	          compressed_io_handle,
+	          -1,
+	          600,
+	          18,
+	          1000,
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_compressed_io_handle_append_frame(
+	          compressed_io_handle,
+	          0,
+	          (size_t) UINT16_MAX + 2,
+	          18,
+	          1000,
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_compressed_io_handle_append_frame(
+	          compressed_io_handle,
+	          0,
+	          600,
+	          600,
+	          1000,
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_compressed_io_handle_append_frame(
+	          compressed_io_handle,
+	          0,
+	          600,
+	          18,
+	          0,
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_compressed_io_handle_append_frame(
+	          compressed_io_handle,
+	          0,
+	          600,
+	          18,
+	          LIBVSMBR_COMPRESSED_MAXIMUM_FRAME_SIZE + 1,
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_compressed_io_handle_get_frame_at_offset(
+	          compressed_io_handle,
+	          (off64_t) compressed_io_handle->size,
+	          &frame_index,
+	          &frame_offset,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_compressed_io_handle_get_frame_by_index(
+	          compressed_io_handle,
+	          -1,
+	          &frame,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_compressed_io_handle_get_frame_by_index(
+	          compressed_io_handle,
+	          0,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_array_free(
+	          &( compressed_io_handle->frame_chunks_array ),
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libvsmbr_compressed_frame_chunk_free,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_compressed_io_handle_free(
+	          &compressed_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_io_handle != NULL )
+	{
+		libcdata_array_free(
+		 &( compressed_io_handle->frame_chunks_array ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libvsmbr_compressed_frame_chunk_free,
+		 NULL );
+
+		libvsmbr_compressed_io_handle_free(
+		 &compressed_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_compressed_io_handle_read function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_compressed_io_handle_read(
+     void )
+{
+	libbfio_handle_t *file_io_handle                      = NULL;
+	libbfio_handle_t *handle                              = NULL;
+	libcerror_error_t *error                              = NULL;
+	libvsmbr_compressed_io_handle_t *compressed_io_handle = NULL;
+	ssize_t read_count                                    = 0;
+	off64_t offset                                        = 0;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	result = vsmbr_test_compressed_initialize_file_io_handle(
+	          &file_io_handle,
+	          vsmbr_test_compressed_data,
+	          8750,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_compressed_initialize(
+	          &handle,
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_io_handle(
+	          handle,
+	          (intptr_t **) &compressed_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_io_handle",
+	 compressed_io_handle );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+
+	/* The first read is sequential, hence the first frame is decompressed
+	 * together with the read-ahead frames that are read with a single read
+	 */
+	read_count = libbfio_handle_read_buffer(
+	              handle,
+	              vsmbr_test_compressed_buffer,
+	              512,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          vsmbr_test_compressed_buffer,
+	          &( vsmbr_test_compressed_image_data[ 0 ] ),
+	          512 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "compressed_io_handle->number_of_decompressed_frames",
+	 compressed_io_handle->number_of_decompressed_frames,
+	 (uint64_t) 4 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "compressed_io_handle->number_of_compressed_reads",
+	 compressed_io_handle->number_of_compressed_reads,
+	 (uint64_t) 2 );
+
+	/* The read-ahead frames are served from the frame cache
+	 */
+	read_count = libbfio_handle_read_buffer(
+	              handle,
+	              vsmbr_test_compressed_buffer,
+	              3 * 32768,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) ( 3 * 32768 ) );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          vsmbr_test_compressed_buffer,
+	          &( vsmbr_test_compressed_image_data[ 512 ] ),
+	          3 * 32768 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "compressed_io_handle->number_of_decompressed_frames",
+	 compressed_io_handle->number_of_decompressed_frames,
+	 (uint64_t) 4 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "compressed_io_handle->number_of_compressed_reads",
+	 compressed_io_handle->number_of_compressed_reads,
+	 (uint64_t) 2 );
+
+	/* A read within a single frame that does not follow the last frame
+	 * that was read is random, hence only its frame is decompressed
+	 */
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          512 + ( 8 * 32768 ) + 100,
+	          SEEK_SET,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 512 + ( 8 * 32768 ) + 100 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer(
+	              handle,
+	              vsmbr_test_compressed_buffer,
+	              1000,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1000 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          vsmbr_test_compressed_buffer,
+	          &( vsmbr_test_compressed_image_data[ 512 + ( 8 * 32768 ) + 100 ] ),
+	          1000 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "compressed_io_handle->number_of_decompressed_frames",
+	 compressed_io_handle->number_of_decompressed_frames,
+	 (uint64_t) 5 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "compressed_io_handle->number_of_compressed_reads",
+	 compressed_io_handle->number_of_compressed_reads,
+	 (uint64_t) 3 );
+
+	read_count = libbfio_handle_read_buffer(
+	              handle,
+	              vsmbr_test_compressed_buffer,
+	              1000,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1000 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          vsmbr_test_compressed_buffer,
+	          &( vsmbr_test_compressed_image_data[ 512 + ( 8 * 32768 ) + 1100 ] ),
+	          1000 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "compressed_io_handle->number_of_decompressed_frames",
+	 compressed_io_handle->number_of_decompressed_frames,
+	 (uint64_t) 5 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "compressed_io_handle->number_of_compressed_reads",
+	 compressed_io_handle->number_of_compressed_reads,
+	 (uint64_t) 3 );
+
+	/* A read that spans multiple frames reads ahead, the frames that are
+	 * already cached are not decompressed again
+	 */
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          512 + ( 5 * 32768 ),
+	          SEEK_SET,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 512 + ( 5 * 32768 ) );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer(
+	              handle,
+	              vsmbr_test_compressed_buffer,
+	              3 * 32768,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) ( 3 * 32768 ) );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          vsmbr_test_compressed_buffer,
+	          &( vsmbr_test_compressed_image_data[ 512 + ( 5 * 32768 ) ] ),
+	          3 * 32768 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "compressed_io_handle->number_of_decompressed_frames",
+	 compressed_io_handle->number_of_decompressed_frames,
+	 (uint64_t) 8 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "compressed_io_handle->number_of_compressed_reads",
+	 compressed_io_handle->number_of_compressed_reads,
+	 (uint64_t) 4 );
+
+	/* Read the entire image, which contains members with stored, fixed
+	 * and dynamic Huffman blocks
+	 */
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer(
+	              handle,
+	              vsmbr_test_compressed_buffer,
+	              VSMBR_TEST_COMPRESSED_IMAGE_SIZE,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) VSMBR_TEST_COMPRESSED_IMAGE_SIZE );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          vsmbr_test_compressed_buffer,
+	          &( vsmbr_test_compressed_image_data[ 0 ] ),
+	          VSMBR_TEST_COMPRESSED_IMAGE_SIZE );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libbfio_handle_read_buffer(
+	              handle,
+	              vsmbr_test_compressed_buffer,
+	              512,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libvsmbr_compressed_io_handle_read(
+	              NULL,
+	              vsmbr_test_compressed_buffer,
+	              512,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libvsmbr_compressed_io_handle_read(
+	              compressed_io_handle,
+	              NULL,
+	              512,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libvsmbr_compressed_io_handle_write(
+	              compressed_io_handle,
+	              vsmbr_test_compressed_buffer,
+	              512,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_close(
+	          handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading a frame with a mismatching checksum, the frame index
+	 * is read without decompressing the frames
+	 */
+	memory_copy(
+	 vsmbr_test_compressed_corrupted_data,
+	 vsmbr_test_compressed_data,
+	 8750 );
+
+	vsmbr_test_compressed_corrupted_data[ VSMBR_TEST_COMPRESSED_FRAME1_CHECKSUM_OFFSET ] ^= 0xff;
+
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          vsmbr_test_compressed_corrupted_data,
+	          8750,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_compressed_initialize(
+	          &handle,
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          512,
+	          SEEK_SET,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 512 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer(
+	              handle,
+	              vsmbr_test_compressed_buffer,
+	              512,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The read-ahead frames that were decompressed correctly can still be read
+	 */
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer(
+	              handle,
+	              vsmbr_test_compressed_buffer,
+	              512,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          vsmbr_test_compressed_buffer,
+	          &( vsmbr_test_compressed_image_data[ 0 ] ),
+	          512 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The frame with the mismatching checksum was not cached by the read-ahead
+	 */
+	read_count = libbfio_handle_read_buffer(
+	              handle,
+	              vsmbr_test_compressed_buffer,
+	              512,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_close(
+	          handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+/* Tests the libvsmbr_volume_open_compressed_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_volume_open_compressed_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libvsmbr_partition_t *partition  = NULL;
+	libvsmbr_volume_t *volume        = NULL;
+	ssize_t read_count               = 0;
+	size64_t partition_size          = 0;
+	int number_of_partitions         = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = vsmbr_test_compressed_initialize_file_io_handle(
+	          &file_io_handle,
+	          vsmbr_test_compressed_data,
+	          8750,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_initialize(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_volume_open_compressed_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBVSMBR_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_get_number_of_partitions(
+	          volume,
+	          &number_of_partitions,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_partitions",
+	 number_of_partitions,
+	 1 );
+
+	result = libvsmbr_volume_get_partition_by_index(
+	          volume,
+	          0,
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_partition_get_size(
+	          partition,
+	          &partition_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "partition_size",
+	 partition_size,
+	 (size64_t) ( VSMBR_TEST_COMPRESSED_IMAGE_SIZE - 512 ) );
+
+	/* The read spans the members with the fixed Huffman blocks
+	 */
+	read_count = libvsmbr_partition_read_buffer_at_offset(
+	              partition,
+	              vsmbr_test_compressed_buffer,
+	              5 * 32768,
+	              32768,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) ( 5 * 32768 ) );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          vsmbr_test_compressed_buffer,
+	          &( vsmbr_test_compressed_image_data[ 512 + 32768 ] ),
+	          5 * 32768 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Writing to a compressed image is not supported
+	 */
+	read_count = libvsmbr_partition_write_buffer_at_offset(
+	              partition,
+	              vsmbr_test_compressed_buffer,
+	              512,
+	              0,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_partition_free(
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_close(
+	          volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_volume_open_compressed_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          LIBVSMBR_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_volume_open_compressed_file_io_handle(
+	          volume,
+	          NULL,
+	          LIBVSMBR_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_volume_open_compressed_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBVSMBR_OPEN_READ_WRITE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test opening data that is not compressed
+	 */
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          vsmbr_test_compressed_image_data,
+	          VSMBR_TEST_COMPRESSED_IMAGE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_open_compressed_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBVSMBR_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_volume_free(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition != NULL )
+	{
+		libvsmbr_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libvsmbr_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argc )
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+	if( vsmbr_test_image_fill(
+	     vsmbr_test_compressed_image_data,
+	     VSMBR_TEST_COMPRESSED_IMAGE_SIZE,
+	     1,
+	     0x12345678UL,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	vsmbr_test_compressed_fill_random_data(
+	 vsmbr_test_compressed_image_data );
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_compressed_io_handle_initialize",
+	 vsmbr_test_compressed_io_handle_initialize );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_compressed_io_handle_free",
+	 vsmbr_test_compressed_io_handle_free );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_compressed_io_handle_open",
+	 vsmbr_test_compressed_io_handle_open );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_compressed_io_handle_append_frame",
+	 vsmbr_test_compressed_io_handle_append_frame );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_compressed_io_handle_read",
+	 vsmbr_test_compressed_io_handle_read );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_volume_open_compressed_file_io_handle",
+	 vsmbr_test_volume_open_compressed_file_io_handle );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,2285 @@
+/*
+ * Library data mover type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsmbr_test_image.h"
+#include "vsmbr_test_libbfio.h"
+#include "vsmbr_test_libcerror.h"
+#include "vsmbr_test_libvsmbr.h"
+#include "vsmbr_test_macros.h"
+#include "vsmbr_test_memory.h"
+#include "vsmbr_test_unused.h"
+
+#include "../libvsmbr/libvsmbr_data_mover.h"
+#include "../libvsmbr/libvsmbr_definitions.h"
+#include "../libvsmbr/libvsmbr_io_handle.h"
+#include "../libvsmbr/libvsmbr_move_journal.h"
+
+/* The test image consists of 256 sectors of 512 bytes with a MBR
+ * that contains a primary partition of 64 sectors at sector 8 and
+ * an extended partition at sector 128 that contains a logical
+ * partition of 32 sectors at sector 136
+ */
+#define VSMBR_TEST_DATA_MOVER_IMAGE_SIZE	( 256 * 512 )
+
+/* The journal consists of the journal record followed by the buffered data
+ * of a batch of which the source and destination overlap
+ */
+#define VSMBR_TEST_DATA_MOVER_JOURNAL_SIZE	( 512 + ( 64 * 512 ) )
+
+uint8_t vsmbr_test_data_mover_image_data[ VSMBR_TEST_DATA_MOVER_IMAGE_SIZE ];
+
+uint8_t vsmbr_test_data_mover_original_image_data[ VSMBR_TEST_DATA_MOVER_IMAGE_SIZE ];
+
+uint8_t vsmbr_test_data_mover_journal_data[ VSMBR_TEST_DATA_MOVER_JOURNAL_SIZE ];
+
+/* Fills the test image data
+ * The test image contains a primary partition of 64 sectors at sector 8 and
+ * an extended partition at sector 128 that contains a logical partition
+ * of 32 sectors at sector 136
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_data_mover_fill_image(
+     uint8_t *image_data,
+     libcerror_error_t **error )
+{
+	libvsmbr_image_builder_t *image_builder = NULL;
+
+	if( libvsmbr_image_builder_initialize(
+	     &image_builder,
+	     512,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libvsmbr_image_builder_append_primary_partition(
+	     image_builder,
+	     0x83,
+	     8,
+	     64,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libvsmbr_image_builder_append_logical_partition(
+	     image_builder,
+	     128,
+	     0x83,
+	     136,
+	     32,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( vsmbr_test_image_fill_with_image_builder(
+	     image_data,
+	     VSMBR_TEST_DATA_MOVER_IMAGE_SIZE,
+	     image_builder,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libvsmbr_image_builder_free(
+	     &image_builder,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The extended partition extends to the end of the image
+	 * so that the logical partition can be moved within it
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( image_data[ 446 + 16 + 12 ] ),
+	 128 );
+
+	return( 1 );
+
+on_error:
+	if( image_builder != NULL )
+	{
+		libvsmbr_image_builder_free(
+		 &image_builder,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the journal data
+ */
+void vsmbr_test_data_mover_set_journal(
+      uint32_t state,
+      uint32_t sector_number,
+      uint32_t number_of_sectors,
+      uint64_t source_offset,
+      uint64_t destination_offset,
+      uint64_t data_size,
+      uint64_t copied_size,
+      uint32_t buffered_size )
+{
+	memory_set(
+	 vsmbr_test_data_mover_journal_data,
+	 0,
+	 VSMBR_TEST_DATA_MOVER_JOURNAL_SIZE );
+
+	memory_copy(
+	 vsmbr_test_data_mover_journal_data,
+	 "VSMBRMVJ",
+	 8 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( vsmbr_test_data_mover_journal_data[ 8 ] ),
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( vsmbr_test_data_mover_journal_data[ 12 ] ),
+	 state );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( vsmbr_test_data_mover_journal_data[ 28 ] ),
+	 sector_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( vsmbr_test_data_mover_journal_data[ 32 ] ),
+	 number_of_sectors );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( vsmbr_test_data_mover_journal_data[ 36 ] ),
+	 buffered_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( vsmbr_test_data_mover_journal_data[ 40 ] ),
+	 source_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( vsmbr_test_data_mover_journal_data[ 48 ] ),
+	 destination_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( vsmbr_test_data_mover_journal_data[ 56 ] ),
+	 data_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( vsmbr_test_data_mover_journal_data[ 64 ] ),
+	 copied_size );
+}
+
+/* Creates a file IO handle for memory data
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_data_mover_initialize_file_io_handle(
+     libbfio_handle_t **file_io_handle,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	if( libbfio_memory_range_initialize(
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libbfio_memory_range_set(
+	     *file_io_handle,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libbfio_handle_free(
+		 file_io_handle,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+/* Tests the libvsmbr_data_mover_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_data_mover_initialize(
+     void )
+{
+	libbfio_handle_t *file_io_handle    = NULL;
+	libcerror_error_t *error            = NULL;
+	libvsmbr_data_mover_t *data_mover   = NULL;
+	libvsmbr_io_handle_t *io_handle     = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libvsmbr_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_data_mover_initialize_file_io_handle(
+	          &file_io_handle,
+	          vsmbr_test_data_mover_image_data,
+	          VSMBR_TEST_DATA_MOVER_IMAGE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_data_mover_initialize(
+	          &data_mover,
+	          io_handle,
+	          file_io_handle,
+	          512,
+	          2048,
+	          4,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "data_mover",
+	 data_mover );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_data_mover_free(
+	          &data_mover,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "data_mover",
+	 data_mover );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_data_mover_initialize(
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          512,
+	          2048,
+	          4,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data_mover = (libvsmbr_data_mover_t *) 0x12345678UL;
+
+	result = libvsmbr_data_mover_initialize(
+	          &data_mover,
+	          io_handle,
+	          file_io_handle,
+	          512,
+	          2048,
+	          4,
+	          &error );
+
+	data_mover = NULL;
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_data_mover_initialize(
+	          &data_mover,
+	          NULL,
+	          file_io_handle,
+	          512,
+	          2048,
+	          4,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_data_mover_initialize(
+	          &data_mover,
+	          io_handle,
+	          NULL,
+	          512,
+	          2048,
+	          4,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_data_mover_initialize(
+	          &data_mover,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          2048,
+	          4,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_data_mover_initialize(
+	          &data_mover,
+	          io_handle,
+	          file_io_handle,
+	          512,
+	          0,
+	          4,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_data_mover_initialize(
+	          &data_mover,
+	          io_handle,
+	          file_io_handle,
+	          512,
+	          2048,
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_data_mover_initialize(
+	          &data_mover,
+	          io_handle,
+	          file_io_handle,
+	          512,
+	          2048,
+	          LIBVSMBR_MAXIMUM_NUMBER_OF_THREADS + 1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSMBR_TEST_MEMORY )
+
+	/* Test libvsmbr_data_mover_initialize with malloc failing
+	 */
+	vsmbr_test_malloc_attempts_before_fail = 0;
+
+	result = libvsmbr_data_mover_initialize(
+	          &data_mover,
+	          io_handle,
+	          file_io_handle,
+	          512,
+	          2048,
+	          4,
+	          &error );
+
+	if( vsmbr_test_malloc_attempts_before_fail != -1 )
+	{
+		vsmbr_test_malloc_attempts_before_fail = -1;
+
+		if( data_mover != NULL )
+		{
+			libvsmbr_data_mover_free(
+			 &data_mover,
+			 NULL );
+		}
+	}
+	else
+	{
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "data_mover",
+		 data_mover );
+
+		VSMBR_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_VSMBR_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_mover != NULL )
+	{
+		libvsmbr_data_mover_free(
+		 &data_mover,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libvsmbr_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_data_mover_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_data_mover_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvsmbr_data_mover_free(
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Copies data with a data mover and compares the result with memmove
+ * Returns 1 if successful, 0 if the data differs or -1 on error
+ */
+int vsmbr_test_data_mover_copy_and_compare(
+     libvsmbr_data_mover_t *data_mover,
+     off64_t source_offset,
+     off64_t destination_offset,
+     size64_t data_size,
+     size64_t copied_size,
+     libcerror_error_t **error )
+{
+	libvsmbr_move_journal_t *move_journal = NULL;
+	int result                            = 0;
+
+	if( vsmbr_test_data_mover_fill_image(
+	     vsmbr_test_data_mover_image_data,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( vsmbr_test_data_mover_fill_image(
+	     vsmbr_test_data_mover_original_image_data,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+
+	memmove(
+	 &( vsmbr_test_data_mover_original_image_data[ destination_offset ] ),
+	 &( vsmbr_test_data_mover_original_image_data[ source_offset ] ),
+	 (size_t) data_size );
+
+	if( libvsmbr_move_journal_initialize(
+	     &move_journal,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	move_journal->state              = LIBVSMBR_MOVE_JOURNAL_STATE_COPYING;
+	move_journal->source_offset      = source_offset;
+	move_journal->destination_offset = destination_offset;
+	move_journal->data_size          = data_size;
+	move_journal->copied_size        = copied_size;
+
+	result = libvsmbr_data_mover_copy(
+	          data_mover,
+	          move_journal,
+	          NULL,
+	          error );
+
+	if( result == 1 )
+	{
+		if( move_journal->copied_size != data_size )
+		{
+			result = 0;
+		}
+		else if( memory_compare(
+		          vsmbr_test_data_mover_image_data,
+		          vsmbr_test_data_mover_original_image_data,
+		          VSMBR_TEST_DATA_MOVER_IMAGE_SIZE ) != 0 )
+		{
+			result = 0;
+		}
+	}
+	libvsmbr_move_journal_free(
+	 &move_journal,
+	 NULL );
+
+	return( result );
+}
+
+/* Tests the libvsmbr_data_mover_copy function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_data_mover_copy(
+     void )
+{
+	libbfio_handle_t *file_io_handle      = NULL;
+	libcerror_error_t *error              = NULL;
+	libvsmbr_data_mover_t *data_mover     = NULL;
+	libvsmbr_io_handle_t *io_handle       = NULL;
+	libvsmbr_move_journal_t *move_journal = NULL;
+	int number_of_threads                 = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libvsmbr_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_data_mover_initialize_file_io_handle(
+	          &file_io_handle,
+	          vsmbr_test_data_mover_image_data,
+	          VSMBR_TEST_DATA_MOVER_IMAGE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ_WRITE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with a single thread and multiple threads
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 4;
+	     number_of_threads += 3 )
+	{
+		result = libvsmbr_data_mover_initialize(
+		          &data_mover,
+		          io_handle,
+		          file_io_handle,
+		          512,
+		          4096,
+		          number_of_threads,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test copying to a destination after the source that overlaps
+		 */
+		result = vsmbr_test_data_mover_copy_and_compare(
+		          data_mover,
+		          4096,
+		          5120,
+		          65536,
+		          0,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test copying to a destination before the source that overlaps
+		 */
+		result = vsmbr_test_data_mover_copy_and_compare(
+		          data_mover,
+		          12288,
+		          1024,
+		          98304,
+		          0,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test copying to a destination that does not overlap
+		 * with a size that is not a multiple of the block size
+		 */
+		result = vsmbr_test_data_mover_copy_and_compare(
+		          data_mover,
+		          1024,
+		          65536,
+		          33000,
+		          0,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_data_mover_free(
+		          &data_mover,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libvsmbr_data_mover_initialize(
+	          &data_mover,
+	          io_handle,
+	          file_io_handle,
+	          512,
+	          4096,
+	          1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_move_journal_initialize(
+	          &move_journal,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_data_mover_copy(
+	          NULL,
+	          move_journal,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_data_mover_copy(
+	          data_mover,
+	          NULL,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test copying beyond the end of the data
+	 */
+	move_journal->source_offset      = 0;
+	move_journal->destination_offset = VSMBR_TEST_DATA_MOVER_IMAGE_SIZE - 1024;
+	move_journal->data_size          = 4096;
+	move_journal->copied_size        = 0;
+
+	result = libvsmbr_data_mover_copy(
+	          data_mover,
+	          move_journal,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test copying with an abort signalled
+	 */
+	io_handle->abort = 1;
+
+	move_journal->destination_offset = 8192;
+
+	result = libvsmbr_data_mover_copy(
+	          data_mover,
+	          move_journal,
+	          NULL,
+	          &error );
+
+	io_handle->abort = 0;
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test copying ranges that overlap
+	 */
+	result = libvsmbr_data_mover_copy_range(
+	          data_mover,
+	          0,
+	          1024,
+	          4096,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_move_journal_free(
+	          &move_journal,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_data_mover_free(
+	          &data_mover,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( move_journal != NULL )
+	{
+		libvsmbr_move_journal_free(
+		 &move_journal,
+		 NULL );
+	}
+	if( data_mover != NULL )
+	{
+		libvsmbr_data_mover_free(
+		 &data_mover,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libvsmbr_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+/* Determines if the data of a sector range in the test image matches the original data of another sector range
+ * Returns 1 if the data matches or 0 if not
+ */
+int vsmbr_test_data_mover_compare_sectors(
+     uint32_t sector_number,
+     uint32_t original_sector_number,
+     uint32_t number_of_sectors )
+{
+	if( memory_compare(
+	     &( vsmbr_test_data_mover_image_data[ sector_number * 512 ] ),
+	     &( vsmbr_test_data_mover_original_image_data[ original_sector_number * 512 ] ),
+	     number_of_sectors * 512 ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests the libvsmbr_volume_move_partition function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_volume_move_partition(
+     void )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libvsmbr_partition_t *partition  = NULL;
+	libvsmbr_volume_t *volume        = NULL;
+	off64_t volume_offset            = 0;
+	size64_t partition_size          = 0;
+	uint32_t value_32bit             = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = vsmbr_test_data_mover_fill_image(
+	          vsmbr_test_data_mover_image_data,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_data_mover_fill_image(
+	          vsmbr_test_data_mover_original_image_data,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_data_mover_initialize_file_io_handle(
+	          &file_io_handle,
+	          vsmbr_test_data_mover_image_data,
+	          VSMBR_TEST_DATA_MOVER_IMAGE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_initialize(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBVSMBR_OPEN_READ_WRITE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test moving a primary partition to a destination after the source that overlaps
+	 */
+	result = libvsmbr_volume_move_partition(
+	          volume,
+	          0,
+	          24,
+	          64,
+	          2,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_data_mover_compare_sectors(
+	          24,
+	          8,
+	          64 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( vsmbr_test_data_mover_image_data[ 446 + 8 ] ),
+	 value_32bit );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 24 );
+
+	result = libvsmbr_volume_get_partition_by_index(
+	          volume,
+	          0,
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_partition_get_volume_offset(
+	          partition,
+	          &volume_offset,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "volume_offset",
+	 (int64_t) volume_offset,
+	 (int64_t) ( 24 * 512 ) );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_partition_free(
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test moving and shrinking a primary partition to a destination before the source that overlaps
+	 */
+	result = libvsmbr_volume_move_partition(
+	          volume,
+	          0,
+	          4,
+	          48,
+	          1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_data_mover_compare_sectors(
+	          4,
+	          8,
+	          48 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( vsmbr_test_data_mover_image_data[ 446 + 12 ] ),
+	 value_32bit );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 48 );
+
+	/* Test moving a logical partition
+	 */
+	result = libvsmbr_volume_move_partition(
+	          volume,
+	          1,
+	          200,
+	          32,
+	          4,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_data_mover_compare_sectors(
+	          200,
+	          136,
+	          32 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* The start address of a logical partition is relative to its extended boot record
+	 */
+	byte_stream_copy_to_uint32_little_endian(
+	 &( vsmbr_test_data_mover_image_data[ ( 128 * 512 ) + 446 + 8 ] ),
+	 value_32bit );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 72 );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_volume_move_partition(
+	          NULL,
+	          0,
+	          16,
+	          48,
+	          1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_volume_move_partition(
+	          volume,
+	          -1,
+	          16,
+	          48,
+	          1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test moving a partition over the master boot record
+	 */
+	result = libvsmbr_volume_move_partition(
+	          volume,
+	          0,
+	          0,
+	          48,
+	          1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test moving a partition over an extended boot record
+	 */
+	result = libvsmbr_volume_move_partition(
+	          volume,
+	          0,
+	          100,
+	          48,
+	          1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test moving a partition over another partition
+	 */
+	result = libvsmbr_volume_move_partition(
+	          volume,
+	          1,
+	          40,
+	          32,
+	          1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test moving a primary partition into the extended partition
+	 */
+	result = libvsmbr_volume_move_partition(
+	          volume,
+	          0,
+	          140,
+	          48,
+	          1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test moving a logical partition outside of the extended partition
+	 */
+	result = libvsmbr_volume_move_partition(
+	          volume,
+	          1,
+	          80,
+	          32,
+	          1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test moving a partition beyond the end of the volume
+	 */
+	result = libvsmbr_volume_move_partition(
+	          volume,
+	          1,
+	          240,
+	          32,
+	          1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_volume_move_partition(
+	          volume,
+	          0,
+	          16,
+	          0,
+	          1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_volume_move_partition(
+	          volume,
+	          0,
+	          16,
+	          48,
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_volume_close(
+	          volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the moved partitions are read from the partition entries
+	 */
+	result = libvsmbr_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBVSMBR_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_get_partition_by_index(
+	          volume,
+	          1,
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_partition_get_volume_offset(
+	          partition,
+	          &volume_offset,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "volume_offset",
+	 (int64_t) volume_offset,
+	 (int64_t) ( 200 * 512 ) );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_partition_get_size(
+	          partition,
+	          &partition_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "partition_size",
+	 (uint64_t) partition_size,
+	 (uint64_t) ( 32 * 512 ) );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_partition_free(
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test moving a partition of a volume that was opened read-only
+	 */
+	result = libvsmbr_volume_move_partition(
+	          volume,
+	          0,
+	          8,
+	          48,
+	          1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_volume_close(
+	          volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_free(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition != NULL )
+	{
+		libvsmbr_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libvsmbr_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_volume_move_partition_with_journal_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_volume_move_partition_with_journal_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle         = NULL;
+	libbfio_handle_t *journal_file_io_handle = NULL;
+	libcerror_error_t *error                 = NULL;
+	libvsmbr_volume_t *volume                = NULL;
+	uint64_t value_64bit                     = 0;
+	uint32_t value_32bit                     = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = vsmbr_test_data_mover_fill_image(
+	          vsmbr_test_data_mover_image_data,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_data_mover_fill_image(
+	          vsmbr_test_data_mover_original_image_data,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Simulate a move of the primary partition from sector 8 to sector 24
+	 * that was interrupted after the first checkpoint. The data is copied
+	 * back to front, hence the last 16 sectors were copied.
+	 */
+	memory_copy(
+	 &( vsmbr_test_data_mover_image_data[ 72 * 512 ] ),
+	 &( vsmbr_test_data_mover_image_data[ 56 * 512 ] ),
+	 16 * 512 );
+
+	/* The source of the first batch is overwritten by the second batch,
+	 * it is cleared here to detect if the first batch is copied again
+	 */
+	memory_set(
+	 &( vsmbr_test_data_mover_image_data[ 56 * 512 ] ),
+	 0,
+	 16 * 512 );
+
+	vsmbr_test_data_mover_set_journal(
+	 LIBVSMBR_MOVE_JOURNAL_STATE_COPYING,
+	 24,
+	 64,
+	 8 * 512,
+	 24 * 512,
+	 64 * 512,
+	 16 * 512,
+	 0 );
+
+	result = vsmbr_test_data_mover_initialize_file_io_handle(
+	          &file_io_handle,
+	          vsmbr_test_data_mover_image_data,
+	          VSMBR_TEST_DATA_MOVER_IMAGE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_data_mover_initialize_file_io_handle(
+	          &journal_file_io_handle,
+	          vsmbr_test_data_mover_journal_data,
+	          VSMBR_TEST_DATA_MOVER_JOURNAL_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_initialize(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBVSMBR_OPEN_READ_WRITE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test resuming a move with a journal that does not match
+	 */
+	result = libvsmbr_volume_move_partition_with_journal_file_io_handle(
+	          volume,
+	          0,
+	          32,
+	          64,
+	          1,
+	          journal_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test resuming an interrupted move
+	 */
+	result = libvsmbr_volume_move_partition_with_journal_file_io_handle(
+	          volume,
+	          0,
+	          24,
+	          64,
+	          2,
+	          journal_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_data_mover_compare_sectors(
+	          24,
+	          8,
+	          64 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( vsmbr_test_data_mover_image_data[ 446 + 8 ] ),
+	 value_32bit );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 24 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( vsmbr_test_data_mover_journal_data[ 12 ] ),
+	 value_32bit );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) LIBVSMBR_MOVE_JOURNAL_STATE_COMPLETED );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( vsmbr_test_data_mover_journal_data[ 64 ] ),
+	 value_64bit );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) ( 64 * 512 ) );
+
+	/* Simulate a move of the primary partition from sector 24 back to sector 8
+	 * that was interrupted while the destination was written. The source and
+	 * destination overlap, hence the data of the batch was stored in the journal
+	 * before the first 32 sectors of the destination were written.
+	 */
+	vsmbr_test_data_mover_set_journal(
+	 LIBVSMBR_MOVE_JOURNAL_STATE_COPYING,
+	 8,
+	 64,
+	 24 * 512,
+	 8 * 512,
+	 64 * 512,
+	 0,
+	 64 * 512 );
+
+	memory_copy(
+	 &( vsmbr_test_data_mover_journal_data[ 512 ] ),
+	 &( vsmbr_test_data_mover_original_image_data[ 8 * 512 ] ),
+	 64 * 512 );
+
+	memory_copy(
+	 &( vsmbr_test_data_mover_image_data[ 8 * 512 ] ),
+	 &( vsmbr_test_data_mover_original_image_data[ 8 * 512 ] ),
+	 32 * 512 );
+
+	/* The source of the remaining sectors was overwritten by the destination,
+	 * it is cleared here to detect if the batch is copied from the source
+	 */
+	memory_set(
+	 &( vsmbr_test_data_mover_image_data[ 40 * 512 ] ),
+	 0,
+	 48 * 512 );
+
+	result = libvsmbr_volume_move_partition_with_journal_file_io_handle(
+	          volume,
+	          0,
+	          8,
+	          64,
+	          2,
+	          journal_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_data_mover_compare_sectors(
+	          8,
+	          8,
+	          64 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( vsmbr_test_data_mover_image_data[ 446 + 8 ] ),
+	 value_32bit );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 8 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( vsmbr_test_data_mover_journal_data[ 36 ] ),
+	 value_32bit );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 0 );
+
+	/* Move the partition to sector 24 again, the journal of the completed move is ignored
+	 */
+	result = libvsmbr_volume_move_partition_with_journal_file_io_handle(
+	          volume,
+	          0,
+	          24,
+	          64,
+	          2,
+	          journal_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_data_mover_compare_sectors(
+	          24,
+	          8,
+	          64 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test resuming a move that was interrupted after the partition entry was written
+	 */
+	vsmbr_test_data_mover_set_journal(
+	 LIBVSMBR_MOVE_JOURNAL_STATE_COPIED,
+	 24,
+	 64,
+	 8 * 512,
+	 24 * 512,
+	 64 * 512,
+	 64 * 512,
+	 0 );
+
+	result = libvsmbr_volume_move_partition_with_journal_file_io_handle(
+	          volume,
+	          0,
+	          24,
+	          64,
+	          1,
+	          journal_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_data_mover_compare_sectors(
+	          24,
+	          8,
+	          64 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( vsmbr_test_data_mover_journal_data[ 12 ] ),
+	 value_32bit );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) LIBVSMBR_MOVE_JOURNAL_STATE_COMPLETED );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_volume_move_partition_with_journal_file_io_handle(
+	          volume,
+	          0,
+	          40,
+	          64,
+	          1,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_volume_close(
+	          volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_free(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &journal_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libvsmbr_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( journal_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &journal_file_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argc )
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_data_mover_initialize",
+	 vsmbr_test_data_mover_initialize );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_data_mover_free",
+	 vsmbr_test_data_mover_free );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_data_mover_copy",
+	 vsmbr_test_data_mover_copy );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_volume_move_partition",
+	 vsmbr_test_volume_move_partition );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_volume_move_partition_with_journal_file_io_handle",
+	 vsmbr_test_volume_move_partition_with_journal_file_io_handle );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
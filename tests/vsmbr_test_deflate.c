@@ -0,0 +1,740 @@
+/*
+ * Library deflate functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsmbr_test_libcerror.h"
+#include "vsmbr_test_libvsmbr.h"
+#include "vsmbr_test_macros.h"
+#include "vsmbr_test_unused.h"
+
+#include "../libvsmbr/libvsmbr_checksum.h"
+#include "../libvsmbr/libvsmbr_deflate.h"
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+/* The test data was compressed with zlib using raw deflate
+ */
+
+/* "The quick brown fox jumps over the lazy dog. " as a stored block
+ */
+uint8_t vsmbr_test_deflate_stored_data[ 50 ] = {
+	0x01, 0x2d, 0x00, 0xd2, 0xff, 0x54, 0x68, 0x65, 0x20, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x20, 0x62,
+	0x72, 0x6f, 0x77, 0x6e, 0x20, 0x66, 0x6f, 0x78, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x73, 0x20, 0x6f,
+	0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x7a, 0x79, 0x20, 0x64, 0x6f, 0x67,
+	0x2e, 0x20 };
+
+/* 8 times "The quick brown fox jumps over the lazy dog. " as a fixed Huffman block
+ */
+uint8_t vsmbr_test_deflate_fixed_huffman_data[ 51 ] = {
+	0x0b, 0xc9, 0x48, 0x55, 0x28, 0x2c, 0xcd, 0x4c, 0xce, 0x56, 0x48, 0x2a, 0xca, 0x2f, 0xcf, 0x53,
+	0x48, 0xcb, 0xaf, 0x50, 0xc8, 0x2a, 0xcd, 0x2d, 0x28, 0x56, 0xc8, 0x2f, 0x4b, 0x2d, 0x52, 0x28,
+	0x01, 0x4a, 0xe7, 0x24, 0x56, 0x55, 0x2a, 0xa4, 0xe4, 0xa7, 0xeb, 0x29, 0x84, 0x8c, 0x2a, 0x26,
+	0x57, 0x31, 0x00 };
+
+/* 16 times "The quick brown fox<N> jumps over the lazy dog. " with N from 0 to 15
+ * as a dynamic Huffman block
+ */
+uint8_t vsmbr_test_deflate_dynamic_huffman_data[ 98 ] = {
+	0x95, 0xd1, 0xc7, 0x0d, 0x80, 0x30, 0x10, 0x05, 0xd1, 0x56, 0xb6, 0x02, 0xc4, 0x92, 0xe9, 0xc3,
+	0x0d, 0x10, 0x4c, 0x86, 0x05, 0x83, 0x49, 0xd5, 0xc3, 0x1d, 0x09, 0xe9, 0x9f, 0xe7, 0xdd, 0x46,
+	0x35, 0x9a, 0x16, 0xdb, 0x16, 0x3d, 0xe5, 0x46, 0x8e, 0x89, 0x2a, 0x39, 0x5d, 0xea, 0xec, 0x38,
+	0xaf, 0x24, 0xbb, 0x36, 0xb4, 0xbd, 0x7d, 0xc8, 0xee, 0x8b, 0x4a, 0xa9, 0x1d, 0x52, 0x5f, 0xcd,
+	0x90, 0xf6, 0x20, 0xed, 0x43, 0x3a, 0x80, 0x74, 0x08, 0xe9, 0x08, 0xd2, 0x31, 0xa4, 0x13, 0x48,
+	0xa7, 0xd8, 0x1d, 0x70, 0x26, 0x76, 0x93, 0xb1, 0x9d, 0x8c, 0xfd, 0x64, 0x6c, 0x28, 0xff, 0x1c,
+	0x7d, 0x00 };
+
+/* A fixed Huffman block with a match before the start of the data
+ */
+uint8_t vsmbr_test_deflate_invalid_distance_data[ 3 ] = {
+	0x03, 0x02, 0x00 };
+
+/* Tests the libvsmbr_deflate_bit_stream_get_value function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_deflate_bit_stream_get_value(
+     void )
+{
+	uint8_t data[ 2 ] = {
+		0x5a, 0xc3 };
+
+	libvsmbr_deflate_bit_stream_t bit_stream;
+
+	libcerror_error_t *error = NULL;
+	uint32_t value_32bit     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	bit_stream.byte_stream        = data;
+	bit_stream.byte_stream_size   = 2;
+	bit_stream.byte_stream_offset = 0;
+	bit_stream.bit_buffer         = 0;
+	bit_stream.bit_buffer_size    = 0;
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_deflate_bit_stream_get_value(
+	          &bit_stream,
+	          3,
+	          &value_32bit,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x02 );
+
+	result = libvsmbr_deflate_bit_stream_get_value(
+	          &bit_stream,
+	          9,
+	          &value_32bit,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x6b );
+
+	result = libvsmbr_deflate_bit_stream_get_value(
+	          &bit_stream,
+	          0,
+	          &value_32bit,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_deflate_bit_stream_get_value(
+	          &bit_stream,
+	          5,
+	          &value_32bit,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_deflate_bit_stream_get_value(
+	          NULL,
+	          1,
+	          &value_32bit,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_deflate_bit_stream_get_value(
+	          &bit_stream,
+	          17,
+	          &value_32bit,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_deflate_bit_stream_get_value(
+	          &bit_stream,
+	          1,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_deflate_build_huffman_table function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_deflate_build_huffman_table(
+     void )
+{
+	uint8_t code_sizes[ 4 ] = {
+		1, 2, 3, 3 };
+
+	uint8_t over_subscribed_code_sizes[ 3 ] = {
+		1, 1, 1 };
+
+	libvsmbr_deflate_huffman_table_t huffman_table;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_deflate_build_huffman_table(
+	          &huffman_table,
+	          code_sizes,
+	          4,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "huffman_table.code_size_counts[ 3 ]",
+	 huffman_table.code_size_counts[ 3 ],
+	 2 );
+
+	/* The code of symbol 1 is 10, which is stored bit reversed
+	 */
+	VSMBR_TEST_ASSERT_EQUAL_UINT16(
+	 "huffman_table.lookup_table[ 1 ]",
+	 huffman_table.lookup_table[ 1 ],
+	 (uint16_t) ( ( 1 << 4 ) | 2 ) );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_deflate_build_huffman_table(
+	          NULL,
+	          code_sizes,
+	          4,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_deflate_build_huffman_table(
+	          &huffman_table,
+	          NULL,
+	          4,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_deflate_build_huffman_table(
+	          &huffman_table,
+	          code_sizes,
+	          -1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_deflate_build_huffman_table(
+	          &huffman_table,
+	          over_subscribed_code_sizes,
+	          3,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_deflate_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_deflate_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 1024 ];
+
+	uint8_t invalid_block_type_data[ 1 ] = {
+		0x07 };
+
+	uint8_t invalid_stored_block_data[ 5 ] = {
+		0x01, 0x05, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	uint32_t checksum             = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	uncompressed_data_size = 1024;
+
+	result = libvsmbr_deflate_decompress(
+	          vsmbr_test_deflate_stored_data,
+	          50,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 45 );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          "The quick brown fox jumps over the lazy dog. ",
+	          45 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	uncompressed_data_size = 1024;
+
+	result = libvsmbr_deflate_decompress(
+	          vsmbr_test_deflate_fixed_huffman_data,
+	          51,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 360 );
+
+	result = libvsmbr_checksum_calculate_crc32(
+	          &checksum,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0xe30f16bbUL );
+
+	uncompressed_data_size = 1024;
+
+	result = libvsmbr_deflate_decompress(
+	          vsmbr_test_deflate_dynamic_huffman_data,
+	          98,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 742 );
+
+	result = libvsmbr_checksum_calculate_crc32(
+	          &checksum,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0x55e54d49UL );
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = 1024;
+
+	result = libvsmbr_deflate_decompress(
+	          NULL,
+	          98,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_deflate_decompress(
+	          vsmbr_test_deflate_dynamic_huffman_data,
+	          (size_t) SSIZE_MAX + 1,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_deflate_decompress(
+	          vsmbr_test_deflate_dynamic_huffman_data,
+	          98,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_deflate_decompress(
+	          vsmbr_test_deflate_dynamic_huffman_data,
+	          98,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decompressing data that is truncated
+	 */
+	result = libvsmbr_deflate_decompress(
+	          vsmbr_test_deflate_dynamic_huffman_data,
+	          49,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decompressing data into a buffer that is too small
+	 */
+	uncompressed_data_size = 512;
+
+	result = libvsmbr_deflate_decompress(
+	          vsmbr_test_deflate_dynamic_huffman_data,
+	          98,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decompressing data with an unsupported block type
+	 */
+	uncompressed_data_size = 1024;
+
+	result = libvsmbr_deflate_decompress(
+	          invalid_block_type_data,
+	          1,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decompressing a stored block with a mismatching block size copy
+	 */
+	result = libvsmbr_deflate_decompress(
+	          invalid_stored_block_data,
+	          5,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decompressing a match with a distance before the start of the data
+	 */
+	result = libvsmbr_deflate_decompress(
+	          vsmbr_test_deflate_invalid_distance_data,
+	          3,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argc )
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_deflate_bit_stream_get_value",
+	 vsmbr_test_deflate_bit_stream_get_value );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_deflate_build_huffman_table",
+	 vsmbr_test_deflate_build_huffman_table );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_deflate_decompress",
+	 vsmbr_test_deflate_decompress );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1348 @@
+/*
+ * Library entropy_map type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsmbr_test_functions.h"
+#include "vsmbr_test_image.h"
+#include "vsmbr_test_libbfio.h"
+#include "vsmbr_test_libcerror.h"
+#include "vsmbr_test_libvsmbr.h"
+#include "vsmbr_test_macros.h"
+#include "vsmbr_test_memory.h"
+#include "vsmbr_test_unused.h"
+
+#include "../libvsmbr/libvsmbr_entropy_map.h"
+
+/* The test image consists of a MBR with a single partition
+ * of 127 sectors starting at sector 1
+ */
+#define VSMBR_TEST_ENTROPY_MAP_IMAGE_SIZE	65536
+#define VSMBR_TEST_ENTROPY_MAP_PARTITION_SIZE	65024
+#define VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE	4096
+
+uint8_t vsmbr_test_entropy_map_image_data[ VSMBR_TEST_ENTROPY_MAP_IMAGE_SIZE ];
+
+/* Fills the blocks of the test image data
+ * The 4 blocks after the first block of the image have an entropy of 0.0, 8.0, 1.0 and 2.0
+ * The remaining data consists of all byte values in sequence
+ */
+void vsmbr_test_entropy_map_fill_blocks(
+      uint8_t *image_data )
+{
+	size_t data_offset = 0;
+
+	memory_set(
+	 &( image_data[ 512 ] ),
+	 0,
+	 ( 2 * VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE ) - 512 );
+
+	for( data_offset = 0;
+	     data_offset < VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE;
+	     data_offset++ )
+	{
+		image_data[ ( 2 * VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE ) + data_offset ] = (uint8_t) ( data_offset % 256 );
+		image_data[ ( 3 * VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE ) + data_offset ] = (uint8_t) ( data_offset % 2 );
+		image_data[ ( 4 * VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE ) + data_offset ] = (uint8_t) ( data_offset % 4 );
+	}
+	for( data_offset = 5 * VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE;
+	     data_offset < VSMBR_TEST_ENTROPY_MAP_IMAGE_SIZE;
+	     data_offset++ )
+	{
+		image_data[ data_offset ] = (uint8_t) ( ( data_offset - 512 ) % 256 );
+	}
+}
+
+/* Tests the libvsmbr_entropy_map_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_entropy_map_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libvsmbr_entropy_map_t *entropy_map = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_VSMBR_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 1;
+	int number_of_memset_fail_tests     = 1;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_entropy_map_initialize(
+	          &entropy_map,
+	          VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "entropy_map",
+	 entropy_map );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_entropy_map_free(
+	          &entropy_map,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "entropy_map",
+	 entropy_map );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_entropy_map_initialize(
+	          NULL,
+	          VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	entropy_map = (libvsmbr_entropy_map_t *) 0x12345678UL;
+
+	result = libvsmbr_entropy_map_initialize(
+	          &entropy_map,
+	          VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE,
+	          &error );
+
+	entropy_map = NULL;
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_entropy_map_initialize(
+	          &entropy_map,
+	          1000,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "entropy_map",
+	 entropy_map );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSMBR_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvsmbr_entropy_map_initialize with malloc failing
+		 */
+		vsmbr_test_malloc_attempts_before_fail = test_number;
+
+		result = libvsmbr_entropy_map_initialize(
+		          &entropy_map,
+		          VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE,
+		          &error );
+
+		if( vsmbr_test_malloc_attempts_before_fail != -1 )
+		{
+			vsmbr_test_malloc_attempts_before_fail = -1;
+
+			if( entropy_map != NULL )
+			{
+				libvsmbr_entropy_map_free(
+				 &entropy_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSMBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSMBR_TEST_ASSERT_IS_NULL(
+			 "entropy_map",
+			 entropy_map );
+
+			VSMBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvsmbr_entropy_map_initialize with memset failing
+		 */
+		vsmbr_test_memset_attempts_before_fail = test_number;
+
+		result = libvsmbr_entropy_map_initialize(
+		          &entropy_map,
+		          VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE,
+		          &error );
+
+		if( vsmbr_test_memset_attempts_before_fail != -1 )
+		{
+			vsmbr_test_memset_attempts_before_fail = -1;
+
+			if( entropy_map != NULL )
+			{
+				libvsmbr_entropy_map_free(
+				 &entropy_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSMBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSMBR_TEST_ASSERT_IS_NULL(
+			 "entropy_map",
+			 entropy_map );
+
+			VSMBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_VSMBR_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( entropy_map != NULL )
+	{
+		libvsmbr_entropy_map_free(
+		 &entropy_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_entropy_map_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_entropy_map_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvsmbr_entropy_map_free(
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+/* Tests the libvsmbr_entropy_map_calculate_entropy function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_entropy_map_calculate_entropy(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	float entropy            = 0.0f;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_entropy_map_calculate_entropy(
+	          &( vsmbr_test_entropy_map_image_data[ VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE ] ),
+	          VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE,
+	          &entropy,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_FLOAT(
+	 "entropy",
+	 entropy,
+	 0.0f );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_entropy_map_calculate_entropy(
+	          &( vsmbr_test_entropy_map_image_data[ 2 * VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE ] ),
+	          VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE,
+	          &entropy,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_FLOAT(
+	 "entropy",
+	 entropy,
+	 8.0f );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a size that is not a multiple of 4
+	 */
+	result = libvsmbr_entropy_map_calculate_entropy(
+	          &( vsmbr_test_entropy_map_image_data[ 3 * VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE ] ),
+	          6,
+	          &entropy,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_FLOAT(
+	 "entropy",
+	 entropy,
+	 1.0f );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_entropy_map_calculate_entropy(
+	          vsmbr_test_entropy_map_image_data,
+	          0,
+	          &entropy,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_FLOAT(
+	 "entropy",
+	 entropy,
+	 0.0f );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_entropy_map_calculate_entropy(
+	          NULL,
+	          VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE,
+	          &entropy,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_entropy_map_calculate_entropy(
+	          vsmbr_test_entropy_map_image_data,
+	          VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+
+/* Tests the libvsmbr_internal_entropy_map_calculate_block_callback function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_internal_entropy_map_calculate_block_callback(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libvsmbr_entropy_map_block_t *entropy_map_block = NULL;
+	libvsmbr_entropy_map_t *entropy_map             = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libvsmbr_entropy_map_initialize(
+	          &entropy_map,
+	          VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "entropy_map",
+	 entropy_map );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_internal_entropy_map_set_data_size(
+	          (libvsmbr_internal_entropy_map_t *) entropy_map,
+	          2 * VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libvsmbr_internal_entropy_map_t *) entropy_map )->calculate_result = 1;
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_entropy_map_block_initialize(
+	          &entropy_map_block,
+	          VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	entropy_map_block->block_index = 1;
+	entropy_map_block->data_size   = VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE;
+
+	/* The callback takes over the ownership of the block
+	 */
+	result = libvsmbr_internal_entropy_map_calculate_block_callback(
+	          entropy_map_block,
+	          (libvsmbr_internal_entropy_map_t *) entropy_map );
+
+	entropy_map_block = NULL;
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "calculate_result",
+	 ( (libvsmbr_internal_entropy_map_t *) entropy_map )->calculate_result,
+	 1 );
+
+	/* Test error case where the block index is out of bounds
+	 */
+	result = libvsmbr_entropy_map_block_initialize(
+	          &entropy_map_block,
+	          VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	entropy_map_block->block_index = 2;
+	entropy_map_block->data_size   = VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE;
+
+	result = libvsmbr_internal_entropy_map_calculate_block_callback(
+	          entropy_map_block,
+	          (libvsmbr_internal_entropy_map_t *) entropy_map );
+
+	entropy_map_block = NULL;
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "calculate_result",
+	 ( (libvsmbr_internal_entropy_map_t *) entropy_map )->calculate_result,
+	 -1 );
+
+	/* Clean up
+	 */
+	result = libvsmbr_entropy_map_free(
+	          &entropy_map,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "entropy_map",
+	 entropy_map );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( entropy_map_block != NULL )
+	{
+		libvsmbr_entropy_map_block_free(
+		 &entropy_map_block,
+		 NULL );
+	}
+	if( entropy_map != NULL )
+	{
+		libvsmbr_entropy_map_free(
+		 &entropy_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+/* Tests the libvsmbr_entropy_map_build_from_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_entropy_map_build_from_file_io_handle(
+     void )
+{
+	float entropies[ 5 ];
+
+	libbfio_handle_t *file_io_handle    = NULL;
+	libcerror_error_t *error            = NULL;
+	libvsmbr_entropy_map_t *entropy_map = NULL;
+	size64_t data_size                  = 0;
+	uint64_t number_of_blocks           = 0;
+	float entropy                       = 0.0f;
+	int number_of_threads               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = vsmbr_test_open_file_io_handle(
+	          &file_io_handle,
+	          vsmbr_test_entropy_map_image_data,
+	          VSMBR_TEST_ENTROPY_MAP_IMAGE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_entropy_map_initialize(
+	          &entropy_map,
+	          VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with a single and multiple threads
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 4;
+	     number_of_threads += 3 )
+	{
+		result = libvsmbr_entropy_map_build_from_file_io_handle(
+		          entropy_map,
+		          file_io_handle,
+		          VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE,
+		          ( 4 * VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE ) + 512,
+		          number_of_threads,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_entropy_map_get_data_size(
+		          entropy_map,
+		          &data_size,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_EQUAL_UINT64(
+		 "data_size",
+		 (uint64_t) data_size,
+		 (uint64_t) ( 4 * VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE ) + 512 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_entropy_map_get_number_of_blocks(
+		          entropy_map,
+		          &number_of_blocks,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_EQUAL_UINT64(
+		 "number_of_blocks",
+		 number_of_blocks,
+		 (uint64_t) 5 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_entropy_map_get_entropies(
+		          entropy_map,
+		          entropies,
+		          5,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		VSMBR_TEST_ASSERT_EQUAL_FLOAT(
+		 "entropies[ 0 ]",
+		 entropies[ 0 ],
+		 0.0f );
+
+		VSMBR_TEST_ASSERT_EQUAL_FLOAT(
+		 "entropies[ 1 ]",
+		 entropies[ 1 ],
+		 8.0f );
+
+		VSMBR_TEST_ASSERT_EQUAL_FLOAT(
+		 "entropies[ 2 ]",
+		 entropies[ 2 ],
+		 1.0f );
+
+		VSMBR_TEST_ASSERT_EQUAL_FLOAT(
+		 "entropies[ 3 ]",
+		 entropies[ 3 ],
+		 2.0f );
+
+		/* The last block consists of 512 bytes with all byte values twice
+		 */
+		VSMBR_TEST_ASSERT_EQUAL_FLOAT(
+		 "entropies[ 4 ]",
+		 entropies[ 4 ],
+		 8.0f );
+	}
+	result = libvsmbr_entropy_map_get_entropy(
+	          entropy_map,
+	          2,
+	          &entropy,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_FLOAT(
+	 "entropy",
+	 entropy,
+	 1.0f );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_entropy_map_get_entropy(
+	          entropy_map,
+	          5,
+	          &entropy,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_entropy_map_get_entropies(
+	          entropy_map,
+	          entropies,
+	          4,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_entropy_map_build_from_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          VSMBR_TEST_ENTROPY_MAP_IMAGE_SIZE,
+	          1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_entropy_map_build_from_file_io_handle(
+	          entropy_map,
+	          NULL,
+	          0,
+	          VSMBR_TEST_ENTROPY_MAP_IMAGE_SIZE,
+	          1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_entropy_map_build_from_file_io_handle(
+	          entropy_map,
+	          file_io_handle,
+	          0,
+	          VSMBR_TEST_ENTROPY_MAP_IMAGE_SIZE,
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a range that exceeds the data
+	 */
+	result = libvsmbr_entropy_map_build_from_file_io_handle(
+	          entropy_map,
+	          file_io_handle,
+	          VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE,
+	          VSMBR_TEST_ENTROPY_MAP_IMAGE_SIZE,
+	          1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_entropy_map_get_number_of_blocks(
+	          entropy_map,
+	          &number_of_blocks,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_blocks",
+	 number_of_blocks,
+	 (uint64_t) 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_entropy_map_free(
+	          &entropy_map,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( entropy_map != NULL )
+	{
+		libvsmbr_entropy_map_free(
+		 &entropy_map,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_entropy_map_build_from_partition function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_entropy_map_build_from_partition(
+     void )
+{
+	libbfio_handle_t *file_io_handle    = NULL;
+	libcerror_error_t *error            = NULL;
+	libvsmbr_entropy_map_t *entropy_map = NULL;
+	libvsmbr_partition_t *partition     = NULL;
+	libvsmbr_volume_t *volume           = NULL;
+	uint64_t number_of_blocks           = 0;
+	float entropy                       = 0.0f;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = vsmbr_test_open_file_io_handle(
+	          &file_io_handle,
+	          vsmbr_test_entropy_map_image_data,
+	          VSMBR_TEST_ENTROPY_MAP_IMAGE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_initialize(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBVSMBR_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_get_partition_by_index(
+	          volume,
+	          0,
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_entropy_map_initialize(
+	          &entropy_map,
+	          VSMBR_TEST_ENTROPY_MAP_BLOCK_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_entropy_map_build_from_partition(
+	          entropy_map,
+	          partition,
+	          2,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_entropy_map_get_number_of_blocks(
+	          entropy_map,
+	          &number_of_blocks,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_blocks",
+	 number_of_blocks,
+	 (uint64_t) 16 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_entropy_map_get_entropy(
+	          entropy_map,
+	          15,
+	          &entropy,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_FLOAT(
+	 "entropy",
+	 entropy,
+	 8.0f );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_entropy_map_build_from_partition(
+	          entropy_map,
+	          NULL,
+	          1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_entropy_map_free(
+	          &entropy_map,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_partition_free(
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_close(
+	          volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_free(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( entropy_map != NULL )
+	{
+		libvsmbr_entropy_map_free(
+		 &entropy_map,
+		 NULL );
+	}
+	if( partition != NULL )
+	{
+		libvsmbr_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libvsmbr_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argc )
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+	if( vsmbr_test_image_fill(
+	     vsmbr_test_entropy_map_image_data,
+	     VSMBR_TEST_ENTROPY_MAP_IMAGE_SIZE,
+	     0,
+	     0,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	vsmbr_test_entropy_map_fill_blocks(
+	 vsmbr_test_entropy_map_image_data );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_entropy_map_initialize",
+	 vsmbr_test_entropy_map_initialize );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_entropy_map_free",
+	 vsmbr_test_entropy_map_free );
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_entropy_map_calculate_entropy",
+	 vsmbr_test_entropy_map_calculate_entropy );
+
+#if defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_internal_entropy_map_calculate_block_callback",
+	 vsmbr_test_internal_entropy_map_calculate_block_callback );
+
+#endif /* defined( HAVE_LIBVSMBR_MULTI_THREAD_SUPPORT ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_entropy_map_build_from_file_io_handle",
+	 vsmbr_test_entropy_map_build_from_file_io_handle );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_entropy_map_build_from_partition",
+	 vsmbr_test_entropy_map_build_from_partition );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -560,3 +561,107 @@ int vsmbr_test_close_file_io_handle(
 	return( result );
 }
 
+
+/* Compares the contents of a file stream with data
+ * Returns 1 if equal, 0 if not or -1 on error
+ */
+int vsmbr_test_compare_file_stream_with_data(
+     FILE *file_stream,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t file_buffer[ 4096 ];
+
+	static char *function = "vsmbr_test_compare_file_stream_with_data";
+	size_t data_offset    = 0;
+	size_t read_size      = 0;
+
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( fseek(
+	     file_stream,
+	     0,
+	     SEEK_END ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek end of file stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) ftell( file_stream ) != data_size )
+	{
+		return( 0 );
+	}
+	if( fseek(
+	     file_stream,
+	     0,
+	     SEEK_SET ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek start of file stream.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		read_size = data_size - data_offset;
+
+		if( read_size > 4096 )
+		{
+			read_size = 4096;
+		}
+		if( fread(
+		     file_buffer,
+		     1,
+		     read_size,
+		     file_stream ) != read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_compare(
+		     file_buffer,
+		     &( data[ data_offset ] ),
+		     read_size ) != 0 )
+		{
+			return( 0 );
+		}
+		data_offset += read_size;
+	}
+	return( 1 );
+}
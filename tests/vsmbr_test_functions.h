@@ -23,6 +23,7 @@
 #define _VSMBR_TEST_FUNCTIONS_H
 
 #include <common.h>
+#include <file_stream.h>
 #include <types.h>
 
 #include "vsmbr_test_libbfio.h"
@@ -58,6 +59,12 @@ int vsmbr_test_close_file_io_handle(
      libbfio_handle_t **file_io_handle,
      libcerror_error_t **error );
 
+int vsmbr_test_compare_file_stream_with_data(
+     FILE *file_stream,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1417 @@
+/*
+ * Library handle_pool type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsmbr_test_functions.h"
+#include "vsmbr_test_image.h"
+#include "vsmbr_test_libbfio.h"
+#include "vsmbr_test_libcerror.h"
+#include "vsmbr_test_libcthreads.h"
+#include "vsmbr_test_libvsmbr.h"
+#include "vsmbr_test_macros.h"
+#include "vsmbr_test_memory.h"
+#include "vsmbr_test_unused.h"
+
+#include "../libvsmbr/libvsmbr_handle_pool.h"
+#include "../libvsmbr/libvsmbr_partition.h"
+
+/* The test images consist of a MBR with a single partition
+ * of 63 sectors starting at sector 1, the partition data differs per image
+ */
+#define VSMBR_TEST_HANDLE_POOL_IMAGE_SIZE		32768
+
+#define VSMBR_TEST_HANDLE_POOL_NUMBER_OF_VOLUMES	3
+
+char *vsmbr_test_handle_pool_filenames[ VSMBR_TEST_HANDLE_POOL_NUMBER_OF_VOLUMES ] = {
+	"vsmbr_test_handle_pool1.raw",
+	"vsmbr_test_handle_pool2.raw",
+	"vsmbr_test_handle_pool3.raw" };
+
+uint8_t vsmbr_test_handle_pool_image_data[ VSMBR_TEST_HANDLE_POOL_NUMBER_OF_VOLUMES ][ VSMBR_TEST_HANDLE_POOL_IMAGE_SIZE ];
+
+/* Writes the test image files
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_handle_pool_write_images(
+     void )
+{
+	FILE *stream     = NULL;
+	int volume_index = 0;
+
+	for( volume_index = 0;
+	     volume_index < VSMBR_TEST_HANDLE_POOL_NUMBER_OF_VOLUMES;
+	     volume_index++ )
+	{
+		if( vsmbr_test_image_fill(
+		     vsmbr_test_handle_pool_image_data[ volume_index ],
+		     VSMBR_TEST_HANDLE_POOL_IMAGE_SIZE,
+		     (uint8_t) ( 1 + volume_index ),
+		     0,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+
+		stream = file_stream_open(
+		          vsmbr_test_handle_pool_filenames[ volume_index ],
+		          FILE_STREAM_BINARY_OPEN_WRITE );
+
+		if( stream == NULL )
+		{
+			return( -1 );
+		}
+		if( file_stream_write(
+		     stream,
+		     vsmbr_test_handle_pool_image_data[ volume_index ],
+		     VSMBR_TEST_HANDLE_POOL_IMAGE_SIZE ) != (size_t) VSMBR_TEST_HANDLE_POOL_IMAGE_SIZE )
+		{
+			file_stream_close(
+			 stream );
+
+			return( -1 );
+		}
+		if( file_stream_close(
+		     stream ) != 0 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Removes the test image files
+ */
+void vsmbr_test_handle_pool_remove_images(
+      void )
+{
+	int volume_index = 0;
+
+	for( volume_index = 0;
+	     volume_index < VSMBR_TEST_HANDLE_POOL_NUMBER_OF_VOLUMES;
+	     volume_index++ )
+	{
+		remove(
+		 vsmbr_test_handle_pool_filenames[ volume_index ] );
+	}
+}
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+/* Determines the number of files that are open in the handle pool
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_handle_pool_get_number_of_open_files(
+     libvsmbr_handle_pool_t *handle_pool,
+     int *number_of_open_files,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libbfio_pool_t *file_io_pool     = NULL;
+	int entry                        = 0;
+	int number_of_entries            = 0;
+	int result                       = 0;
+
+	file_io_pool = ( (libvsmbr_internal_handle_pool_t *) handle_pool )->file_io_pool;
+
+	*number_of_open_files = 0;
+
+	if( libbfio_pool_get_number_of_handles(
+	     file_io_pool,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	for( entry = 0;
+	     entry < number_of_entries;
+	     entry++ )
+	{
+		if( libbfio_pool_get_handle(
+		     file_io_pool,
+		     entry,
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( file_io_handle == NULL )
+		{
+			continue;
+		}
+		result = libbfio_handle_is_open(
+		          file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			*number_of_open_files += 1;
+		}
+	}
+	return( 1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) && defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct vsmbr_test_handle_pool_read_context vsmbr_test_handle_pool_read_context_t;
+
+struct vsmbr_test_handle_pool_read_context
+{
+	/* The partition
+	 */
+	libvsmbr_partition_t *partition;
+
+	/* The index of the volume that contains the partition
+	 */
+	int volume_index;
+
+	/* Value to indicate the data read matches the image data
+	 */
+	int result;
+};
+
+/* Reads the partition of a volume that is opened through the handle pool
+ * This function is the start function of the reading threads
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_handle_pool_read_thread(
+     void *arguments )
+{
+	uint8_t buffer[ 512 ];
+
+	vsmbr_test_handle_pool_read_context_t *read_context = NULL;
+	ssize_t read_count                                  = 0;
+	int iteration                                       = 0;
+	int sector_index                                    = 0;
+
+	read_context = (vsmbr_test_handle_pool_read_context_t *) arguments;
+
+	if( read_context == NULL )
+	{
+		return( -1 );
+	}
+	read_context->result = 0;
+
+	for( iteration = 0;
+	     iteration < 16;
+	     iteration++ )
+	{
+		for( sector_index = 0;
+		     sector_index < 63;
+		     sector_index++ )
+		{
+			read_count = libvsmbr_partition_read_buffer_at_offset(
+			              read_context->partition,
+			              buffer,
+			              512,
+			              (off64_t) ( 512 * sector_index ),
+			              NULL );
+
+			if( read_count != (ssize_t) 512 )
+			{
+				return( -1 );
+			}
+			if( memory_compare(
+			     buffer,
+			     &( vsmbr_test_handle_pool_image_data[ read_context->volume_index ][ 512 + ( 512 * sector_index ) ] ),
+			     512 ) != 0 )
+			{
+				return( -1 );
+			}
+		}
+	}
+	read_context->result = 1;
+
+	return( 1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) && defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Tests the libvsmbr_handle_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_handle_pool_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libvsmbr_handle_pool_t *handle_pool = NULL;
+	int result                          = 0;
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_handle_pool_initialize(
+	          &handle_pool,
+	          16,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "handle_pool",
+	 handle_pool );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_handle_pool_free(
+	          &handle_pool,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "handle_pool",
+	 handle_pool );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_handle_pool_initialize(
+	          NULL,
+	          16,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	handle_pool = (libvsmbr_handle_pool_t *) 0x12345678UL;
+
+	result = libvsmbr_handle_pool_initialize(
+	          &handle_pool,
+	          16,
+	          &error );
+
+	handle_pool = NULL;
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_handle_pool_initialize(
+	          &handle_pool,
+	          -1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle_pool != NULL )
+	{
+		libvsmbr_handle_pool_free(
+		 &handle_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_handle_pool_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_handle_pool_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvsmbr_handle_pool_free(
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_handle_pool_get_maximum_number_of_open_handles and
+ * libvsmbr_handle_pool_set_maximum_number_of_open_handles functions
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_handle_pool_maximum_number_of_open_handles(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libvsmbr_handle_pool_t *handle_pool = NULL;
+	int maximum_number_of_open_handles  = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libvsmbr_handle_pool_initialize(
+	          &handle_pool,
+	          16,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_handle_pool_get_maximum_number_of_open_handles(
+	          handle_pool,
+	          &maximum_number_of_open_handles,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "maximum_number_of_open_handles",
+	 maximum_number_of_open_handles,
+	 16 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_handle_pool_set_maximum_number_of_open_handles(
+	          handle_pool,
+	          4,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_handle_pool_get_maximum_number_of_open_handles(
+	          handle_pool,
+	          &maximum_number_of_open_handles,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "maximum_number_of_open_handles",
+	 maximum_number_of_open_handles,
+	 4 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_handle_pool_get_maximum_number_of_open_handles(
+	          NULL,
+	          &maximum_number_of_open_handles,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_handle_pool_set_maximum_number_of_open_handles(
+	          NULL,
+	          4,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_handle_pool_set_maximum_number_of_open_handles(
+	          handle_pool,
+	          -1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_handle_pool_free(
+	          &handle_pool,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle_pool != NULL )
+	{
+		libvsmbr_handle_pool_free(
+		 &handle_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+/* Tests the libvsmbr_volume_set_handle_pool function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_volume_set_handle_pool(
+     void )
+{
+	uint8_t buffer[ 4096 ];
+
+	libvsmbr_volume_t *volumes[ VSMBR_TEST_HANDLE_POOL_NUMBER_OF_VOLUMES ] = {
+		NULL, NULL, NULL };
+
+	libcerror_error_t *error            = NULL;
+	libvsmbr_handle_pool_t *handle_pool = NULL;
+	FILE *file_stream                   = NULL;
+	libvsmbr_partition_t *partition     = NULL;
+	ssize_t read_count                  = 0;
+	int number_of_handles               = 0;
+	int number_of_open_files            = 0;
+	int read_index                      = 0;
+	int result                          = 0;
+	int volume_index                    = 0;
+
+	/* Initialize test
+	 */
+	result = vsmbr_test_handle_pool_write_images();
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libvsmbr_handle_pool_initialize(
+	          &handle_pool,
+	          1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( volume_index = 0;
+	     volume_index < VSMBR_TEST_HANDLE_POOL_NUMBER_OF_VOLUMES;
+	     volume_index++ )
+	{
+		result = libvsmbr_volume_initialize(
+		          &( volumes[ volume_index ] ),
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_volume_set_handle_pool(
+		          volumes[ volume_index ],
+		          handle_pool,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_volume_open(
+		          volumes[ volume_index ],
+		          vsmbr_test_handle_pool_filenames[ volume_index ],
+		          LIBVSMBR_OPEN_READ,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libvsmbr_handle_pool_get_number_of_handles(
+	          handle_pool,
+	          &number_of_handles,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_handles",
+	 number_of_handles,
+	 VSMBR_TEST_HANDLE_POOL_NUMBER_OF_VOLUMES );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reads that alternate between the volumes, which requires
+	 * the files to be reopened on demand
+	 */
+	for( read_index = 0;
+	     read_index < 2 * VSMBR_TEST_HANDLE_POOL_NUMBER_OF_VOLUMES;
+	     read_index++ )
+	{
+		volume_index = read_index % VSMBR_TEST_HANDLE_POOL_NUMBER_OF_VOLUMES;
+
+		result = libvsmbr_volume_get_partition_by_index(
+		          volumes[ volume_index ],
+		          0,
+		          &partition,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libvsmbr_partition_read_buffer_at_offset(
+		              partition,
+		              buffer,
+		              4096,
+		              (off64_t) ( 512 * read_index ),
+		              &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 4096 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          buffer,
+		          &( vsmbr_test_handle_pool_image_data[ volume_index ][ 512 + ( 512 * read_index ) ] ),
+		          4096 );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libvsmbr_partition_free(
+		          &partition,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = vsmbr_test_handle_pool_get_number_of_open_files(
+		          handle_pool,
+		          &number_of_open_files,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "number_of_open_files",
+		 number_of_open_files,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#if !defined( WINAPI ) || defined( __CYGWIN__ )
+
+	/* Test an export of the partition, the file IO handle of a handle pool
+	 * is not a file hence the data is copied using buffered reads
+	 */
+	result = libvsmbr_volume_get_partition_by_index(
+	          volumes[ 0 ],
+	          0,
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT8(
+	 "file_io_handle_is_file",
+	 ( (libvsmbr_internal_partition_t *) partition )->file_io_handle_is_file,
+	 0 );
+
+	file_stream = tmpfile();
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	result = libvsmbr_partition_export_to_file_descriptor(
+	          partition,
+	          fileno( file_stream ),
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_compare_file_stream_with_data(
+	          file_stream,
+	          &( vsmbr_test_handle_pool_image_data[ 0 ][ 512 ] ),
+	          VSMBR_TEST_HANDLE_POOL_IMAGE_SIZE - 512,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fclose(
+	          file_stream );
+
+	file_stream = NULL;
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libvsmbr_partition_free(
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( WINAPI ) || defined( __CYGWIN__ ) */
+
+	/* Test error cases
+	 */
+	result = libvsmbr_volume_set_handle_pool(
+	          volumes[ 0 ],
+	          handle_pool,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_volume_set_handle_pool(
+	          NULL,
+	          handle_pool,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_handle_pool_free(
+	          &handle_pool,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that the entries of closed volumes are reused
+	 */
+	result = libvsmbr_volume_close(
+	          volumes[ 1 ],
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_open(
+	          volumes[ 1 ],
+	          vsmbr_test_handle_pool_filenames[ 1 ],
+	          LIBVSMBR_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_get_number_of_handles(
+	          ( (libvsmbr_internal_handle_pool_t *) handle_pool )->file_io_pool,
+	          &number_of_handles,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_handles",
+	 number_of_handles,
+	 VSMBR_TEST_HANDLE_POOL_NUMBER_OF_VOLUMES );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	for( volume_index = 0;
+	     volume_index < VSMBR_TEST_HANDLE_POOL_NUMBER_OF_VOLUMES;
+	     volume_index++ )
+	{
+		result = libvsmbr_volume_close(
+		          volumes[ volume_index ],
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_volume_free(
+		          &( volumes[ volume_index ] ),
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libvsmbr_handle_pool_get_number_of_handles(
+	          handle_pool,
+	          &number_of_handles,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_handles",
+	 number_of_handles,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_handle_pool_free(
+	          &handle_pool,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	vsmbr_test_handle_pool_remove_images();
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_stream != NULL )
+	{
+		fclose(
+		 file_stream );
+	}
+	if( partition != NULL )
+	{
+		libvsmbr_partition_free(
+		 &partition,
+		 NULL );
+	}
+	for( volume_index = 0;
+	     volume_index < VSMBR_TEST_HANDLE_POOL_NUMBER_OF_VOLUMES;
+	     volume_index++ )
+	{
+		if( volumes[ volume_index ] != NULL )
+		{
+			libvsmbr_volume_free(
+			 &( volumes[ volume_index ] ),
+			 NULL );
+		}
+	}
+	if( handle_pool != NULL )
+	{
+		libvsmbr_handle_pool_free(
+		 &handle_pool,
+		 NULL );
+	}
+	vsmbr_test_handle_pool_remove_images();
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) && defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Tests reading volumes that are opened through the handle pool from multiple threads
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_handle_pool_read_concurrently(
+     void )
+{
+	libcthreads_thread_t *threads[ 2 ] = {
+		NULL, NULL };
+
+	libvsmbr_partition_t *partitions[ 2 ] = {
+		NULL, NULL };
+
+	libvsmbr_volume_t *volumes[ 2 ] = {
+		NULL, NULL };
+
+	vsmbr_test_handle_pool_read_context_t read_contexts[ 2 ];
+
+	libcerror_error_t *error            = NULL;
+	libvsmbr_handle_pool_t *handle_pool = NULL;
+	int number_of_open_files            = 0;
+	int result                          = 0;
+	int volume_index                    = 0;
+
+	/* Initialize test
+	 */
+	result = vsmbr_test_handle_pool_write_images();
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* A single open handle forces the threads to reopen the files
+	 * while the file of the other thread is in use
+	 */
+	result = libvsmbr_handle_pool_initialize(
+	          &handle_pool,
+	          1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( volume_index = 0;
+	     volume_index < 2;
+	     volume_index++ )
+	{
+		result = libvsmbr_volume_initialize(
+		          &( volumes[ volume_index ] ),
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_volume_set_handle_pool(
+		          volumes[ volume_index ],
+		          handle_pool,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_volume_open(
+		          volumes[ volume_index ],
+		          vsmbr_test_handle_pool_filenames[ volume_index ],
+		          LIBVSMBR_OPEN_READ,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_volume_get_partition_by_index(
+		          volumes[ volume_index ],
+		          0,
+		          &( partitions[ volume_index ] ),
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_contexts[ volume_index ].partition    = partitions[ volume_index ];
+		read_contexts[ volume_index ].volume_index = volume_index;
+		read_contexts[ volume_index ].result       = 0;
+	}
+	/* Test regular cases
+	 */
+	for( volume_index = 0;
+	     volume_index < 2;
+	     volume_index++ )
+	{
+		result = libcthreads_thread_create(
+		          &( threads[ volume_index ] ),
+		          NULL,
+		          &vsmbr_test_handle_pool_read_thread,
+		          (void *) &( read_contexts[ volume_index ] ),
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( volume_index = 0;
+	     volume_index < 2;
+	     volume_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ volume_index ] ),
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "read_contexts[ volume_index ].result",
+		 read_contexts[ volume_index ].result,
+		 1 );
+	}
+	/* The maximum number of open handles is restored once the files are no longer in use
+	 */
+	result = vsmbr_test_handle_pool_get_number_of_open_files(
+	          handle_pool,
+	          &number_of_open_files,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_open_files",
+	 number_of_open_files,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	for( volume_index = 0;
+	     volume_index < 2;
+	     volume_index++ )
+	{
+		result = libvsmbr_partition_free(
+		          &( partitions[ volume_index ] ),
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_volume_close(
+		          volumes[ volume_index ],
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_volume_free(
+		          &( volumes[ volume_index ] ),
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libvsmbr_handle_pool_free(
+	          &handle_pool,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	vsmbr_test_handle_pool_remove_images();
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( volume_index = 0;
+	     volume_index < 2;
+	     volume_index++ )
+	{
+		if( threads[ volume_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ volume_index ] ),
+			 NULL );
+		}
+	}
+	for( volume_index = 0;
+	     volume_index < 2;
+	     volume_index++ )
+	{
+		if( partitions[ volume_index ] != NULL )
+		{
+			libvsmbr_partition_free(
+			 &( partitions[ volume_index ] ),
+			 NULL );
+		}
+		if( volumes[ volume_index ] != NULL )
+		{
+			libvsmbr_volume_free(
+			 &( volumes[ volume_index ] ),
+			 NULL );
+		}
+	}
+	if( handle_pool != NULL )
+	{
+		libvsmbr_handle_pool_free(
+		 &handle_pool,
+		 NULL );
+	}
+	vsmbr_test_handle_pool_remove_images();
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) && defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argc )
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_handle_pool_initialize",
+	 vsmbr_test_handle_pool_initialize );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_handle_pool_free",
+	 vsmbr_test_handle_pool_free );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_handle_pool_maximum_number_of_open_handles",
+	 vsmbr_test_handle_pool_maximum_number_of_open_handles );
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_volume_set_handle_pool",
+	 vsmbr_test_volume_set_handle_pool );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) && defined( HAVE_MULTI_THREAD_SUPPORT )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_handle_pool_read_concurrently",
+	 vsmbr_test_handle_pool_read_concurrently );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) && defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,261 @@
+/*
+ * Test image functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "vsmbr_test_image.h"
+#include "vsmbr_test_libbfio.h"
+#include "vsmbr_test_libcerror.h"
+#include "vsmbr_test_libvsmbr.h"
+
+/* Fills the test image data with the boot records of an image builder
+ * The other sectors are filled with a pattern that depends on the offset,
+ * so that data that was read from or written to the wrong offset is detected,
+ * where the seed distinguishes the data of different test images
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_image_fill_with_image_builder(
+     uint8_t *image_data,
+     size_t image_size,
+     libvsmbr_image_builder_t *image_builder,
+     uint8_t seed,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "vsmbr_test_image_fill_with_image_builder";
+	size_t data_offset               = 0;
+
+	if( image_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( image_size < 512 )
+	 || ( image_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid image size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( data_offset = 0;
+	     data_offset < image_size;
+	     data_offset++ )
+	{
+		image_data[ data_offset ] = (uint8_t) ( seed + ( ( data_offset * 7 ) % 251 ) );
+	}
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     image_data,
+	     image_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range of file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_image_builder_write_file_io_handle(
+	     image_builder,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write boot records.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The image builder extends the image by writing its last byte,
+	 * which is never part of a boot record, hence the pattern is restored
+	 */
+	data_offset = image_size - 1;
+
+	image_data[ data_offset ] = (uint8_t) ( seed + ( ( data_offset * 7 ) % 251 ) );
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Fills the test image data
+ * The test image contains a MBR with a single Linux (0x83) partition
+ * that starts at sector 1 and extends to the end of the image
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_image_fill(
+     uint8_t *image_data,
+     size_t image_size,
+     uint8_t seed,
+     uint32_t disk_identity,
+     libcerror_error_t **error )
+{
+	libvsmbr_image_builder_t *image_builder = NULL;
+	static char *function                   = "vsmbr_test_image_fill";
+
+	if( ( image_size < 1024 )
+	 || ( ( image_size / 512 ) > (size_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid image size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_image_builder_initialize(
+	     &image_builder,
+	     512,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create image builder.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_image_builder_set_disk_identity(
+	     image_builder,
+	     disk_identity,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set disk identity.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_image_builder_append_primary_partition(
+	     image_builder,
+	     0x83,
+	     1,
+	     (uint32_t) ( image_size / 512 ) - 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append partition.",
+		 function );
+
+		goto on_error;
+	}
+	if( vsmbr_test_image_fill_with_image_builder(
+	     image_data,
+	     image_size,
+	     image_builder,
+	     seed,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to fill image data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_image_builder_free(
+	     &image_builder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free image builder.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( image_builder != NULL )
+	{
+		libvsmbr_image_builder_free(
+		 &image_builder,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,54 @@
+/*
+ * Test image functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _VSMBR_TEST_IMAGE_H )
+#define _VSMBR_TEST_IMAGE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "vsmbr_test_libcerror.h"
+#include "vsmbr_test_libvsmbr.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int vsmbr_test_image_fill_with_image_builder(
+     uint8_t *image_data,
+     size_t image_size,
+     libvsmbr_image_builder_t *image_builder,
+     uint8_t seed,
+     libcerror_error_t **error );
+
+int vsmbr_test_image_fill(
+     uint8_t *image_data,
+     size_t image_size,
+     uint8_t seed,
+     uint32_t disk_identity,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _VSMBR_TEST_IMAGE_H ) */
+
@@ -0,0 +1,1005 @@
+/*
+ * Library image_builder type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsmbr_test_functions.h"
+#include "vsmbr_test_libbfio.h"
+#include "vsmbr_test_libcerror.h"
+#include "vsmbr_test_libvsmbr.h"
+#include "vsmbr_test_macros.h"
+#include "vsmbr_test_memory.h"
+#include "vsmbr_test_unused.h"
+
+/* The test image consists of 2048 sectors of 512 bytes
+ */
+#define VSMBR_TEST_IMAGE_BUILDER_IMAGE_SIZE	1048576
+
+uint8_t vsmbr_test_image_builder_image_data[ VSMBR_TEST_IMAGE_BUILDER_IMAGE_SIZE ];
+
+/* The expected partitions: type, sector number and number of sectors
+ */
+uint32_t vsmbr_test_image_builder_partitions[ 5 ][ 3 ] = {
+	{ 0x83, 1, 63 },
+	{ 0x07, 64, 192 },
+	{ 0x83, 257, 127 },
+	{ 0x0b, 448, 64 },
+	{ 0x83, 513, 511 } };
+
+/* The extended boot record sectors of the logical partitions
+ */
+uint32_t vsmbr_test_image_builder_extended_boot_record_sectors[ 3 ] = {
+	256, 384, 512 };
+
+/* Creates a file IO handle for the test image data
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_image_builder_initialize_file_io_handle(
+     libbfio_handle_t **file_io_handle,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	if( libbfio_memory_range_initialize(
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libbfio_memory_range_set(
+	     *file_io_handle,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libbfio_handle_free(
+		 file_io_handle,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+/* Tests the libvsmbr_image_builder_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_image_builder_initialize(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libvsmbr_image_builder_t *image_builder = NULL;
+	int result                              = 0;
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_image_builder_initialize(
+	          &image_builder,
+	          4096,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "image_builder",
+	 image_builder );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_image_builder_free(
+	          &image_builder,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "image_builder",
+	 image_builder );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_image_builder_initialize(
+	          NULL,
+	          512,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	image_builder = (libvsmbr_image_builder_t *) 0x12345678UL;
+
+	result = libvsmbr_image_builder_initialize(
+	          &image_builder,
+	          512,
+	          &error );
+
+	image_builder = NULL;
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_image_builder_initialize(
+	          &image_builder,
+	          520,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( image_builder != NULL )
+	{
+		libvsmbr_image_builder_free(
+		 &image_builder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_image_builder_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_image_builder_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvsmbr_image_builder_free(
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_image_builder_append_primary_partition and
+ * libvsmbr_image_builder_append_logical_partition functions
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_image_builder_append_partition(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libvsmbr_image_builder_t *image_builder = NULL;
+	int partition_index                     = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libvsmbr_image_builder_initialize(
+	          &image_builder,
+	          512,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( partition_index = 0;
+	     partition_index < 4;
+	     partition_index++ )
+	{
+		result = libvsmbr_image_builder_append_primary_partition(
+		          image_builder,
+		          0x83,
+		          1 + ( partition_index * 64 ),
+		          64,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libvsmbr_image_builder_append_logical_partition(
+	          image_builder,
+	          512,
+	          0x83,
+	          513,
+	          64,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_image_builder_append_primary_partition(
+	          NULL,
+	          0x83,
+	          1,
+	          64,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with more than 4 primary partitions
+	 */
+	result = libvsmbr_image_builder_append_primary_partition(
+	          image_builder,
+	          0x83,
+	          1024,
+	          64,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an extended partition type
+	 */
+	result = libvsmbr_image_builder_append_logical_partition(
+	          image_builder,
+	          640,
+	          0x05,
+	          641,
+	          64,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a number of sectors that exceeds the maximum
+	 */
+	result = libvsmbr_image_builder_append_logical_partition(
+	          image_builder,
+	          640,
+	          0x83,
+	          641,
+	          (uint32_t) 0xffffffffUL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a logical partition that does not start after its extended boot record
+	 */
+	result = libvsmbr_image_builder_append_logical_partition(
+	          image_builder,
+	          640,
+	          0x83,
+	          640,
+	          64,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an extended boot record before the first extended boot record
+	 */
+	result = libvsmbr_image_builder_append_logical_partition(
+	          image_builder,
+	          448,
+	          0x83,
+	          449,
+	          32,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a duplicate extended boot record
+	 */
+	result = libvsmbr_image_builder_append_logical_partition(
+	          image_builder,
+	          512,
+	          0x83,
+	          600,
+	          32,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_image_builder_free(
+	          &image_builder,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "image_builder",
+	 image_builder );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( image_builder != NULL )
+	{
+		libvsmbr_image_builder_free(
+		 &image_builder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_image_builder_write_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_image_builder_write_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle        = NULL;
+	libcerror_error_t *error                = NULL;
+	libvsmbr_image_builder_t *image_builder = NULL;
+	libvsmbr_partition_t *partition         = NULL;
+	libvsmbr_volume_t *volume               = NULL;
+	size64_t partition_size                 = 0;
+	off64_t volume_offset                   = 0;
+	uint32_t value_32bit                    = 0;
+	uint8_t partition_type                  = 0;
+	int number_of_partitions                = 0;
+	int partition_index                     = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     vsmbr_test_image_builder_image_data,
+	     0xcc,
+	     VSMBR_TEST_IMAGE_BUILDER_IMAGE_SIZE ) == NULL )
+	{
+		return( 0 );
+	}
+	result = libvsmbr_image_builder_initialize(
+	          &image_builder,
+	          512,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_image_builder_set_disk_identity(
+	          image_builder,
+	          0x12345678UL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_image_builder_set_media_size(
+	          image_builder,
+	          VSMBR_TEST_IMAGE_BUILDER_IMAGE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( partition_index = 0;
+	     partition_index < 5;
+	     partition_index++ )
+	{
+		if( partition_index < 2 )
+		{
+			result = libvsmbr_image_builder_append_primary_partition(
+			          image_builder,
+			          (uint8_t) vsmbr_test_image_builder_partitions[ partition_index ][ 0 ],
+			          vsmbr_test_image_builder_partitions[ partition_index ][ 1 ],
+			          vsmbr_test_image_builder_partitions[ partition_index ][ 2 ],
+			          &error );
+		}
+		else
+		{
+			result = libvsmbr_image_builder_append_logical_partition(
+			          image_builder,
+			          vsmbr_test_image_builder_extended_boot_record_sectors[ partition_index - 2 ],
+			          (uint8_t) vsmbr_test_image_builder_partitions[ partition_index ][ 0 ],
+			          vsmbr_test_image_builder_partitions[ partition_index ][ 1 ],
+			          vsmbr_test_image_builder_partitions[ partition_index ][ 2 ],
+			          &error );
+		}
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = vsmbr_test_image_builder_initialize_file_io_handle(
+	          &file_io_handle,
+	          vsmbr_test_image_builder_image_data,
+	          VSMBR_TEST_IMAGE_BUILDER_IMAGE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_image_builder_write_file_io_handle(
+	          image_builder,
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Only the boot record sectors and the last byte are written
+	 */
+	byte_stream_copy_to_uint32_little_endian(
+	 &( vsmbr_test_image_builder_image_data[ 440 ] ),
+	 value_32bit );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "disk_identity",
+	 value_32bit,
+	 (uint32_t) 0x12345678UL );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT8(
+	 "image_data[ 510 ]",
+	 vsmbr_test_image_builder_image_data[ 510 ],
+	 (uint8_t) 0x55 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT8(
+	 "image_data[ 511 ]",
+	 vsmbr_test_image_builder_image_data[ 511 ],
+	 (uint8_t) 0xaa );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT8(
+	 "image_data[ 512 ]",
+	 vsmbr_test_image_builder_image_data[ 512 ],
+	 (uint8_t) 0xcc );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT8(
+	 "image_data[ 256 * 512 - 1 ]",
+	 vsmbr_test_image_builder_image_data[ 256 * 512 - 1 ],
+	 (uint8_t) 0xcc );
+
+	/* The second entry of the first extended boot record links to the next extended boot record
+	 */
+	VSMBR_TEST_ASSERT_EQUAL_UINT8(
+	 "image_data[ 256 * 512 + 462 + 4 ]",
+	 vsmbr_test_image_builder_image_data[ 256 * 512 + 462 + 4 ],
+	 (uint8_t) 0x05 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( vsmbr_test_image_builder_image_data[ 256 * 512 + 462 + 8 ] ),
+	 value_32bit );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "next_extended_boot_record_sector",
+	 value_32bit,
+	 (uint32_t) 128 );
+
+	/* The second entry of the last extended boot record is unused
+	 */
+	VSMBR_TEST_ASSERT_EQUAL_UINT8(
+	 "image_data[ 512 * 512 + 462 + 4 ]",
+	 vsmbr_test_image_builder_image_data[ 512 * 512 + 462 + 4 ],
+	 (uint8_t) 0x00 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT8(
+	 "image_data[ VSMBR_TEST_IMAGE_BUILDER_IMAGE_SIZE - 1 ]",
+	 vsmbr_test_image_builder_image_data[ VSMBR_TEST_IMAGE_BUILDER_IMAGE_SIZE - 1 ],
+	 (uint8_t) 0x00 );
+
+	/* Read back the image
+	 */
+	result = libvsmbr_volume_initialize(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBVSMBR_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_get_number_of_partitions(
+	          volume,
+	          &number_of_partitions,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_partitions",
+	 number_of_partitions,
+	 5 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( partition_index = 0;
+	     partition_index < 5;
+	     partition_index++ )
+	{
+		result = libvsmbr_volume_get_partition_by_index(
+		          volume,
+		          partition_index,
+		          &partition,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_partition_get_type(
+		          partition,
+		          &partition_type,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_EQUAL_UINT8(
+		 "partition_type",
+		 partition_type,
+		 (uint8_t) vsmbr_test_image_builder_partitions[ partition_index ][ 0 ] );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_partition_get_volume_offset(
+		          partition,
+		          &volume_offset,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT64(
+		 "volume_offset",
+		 (int64_t) volume_offset,
+		 (int64_t) vsmbr_test_image_builder_partitions[ partition_index ][ 1 ] * 512 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_partition_get_size(
+		          partition,
+		          &partition_size,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_EQUAL_UINT64(
+		 "partition_size",
+		 (uint64_t) partition_size,
+		 (uint64_t) vsmbr_test_image_builder_partitions[ partition_index ][ 2 ] * 512 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libvsmbr_partition_free(
+		          &partition,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libvsmbr_volume_close(
+	          volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_free(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_image_builder_write_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_image_builder_write_file_io_handle(
+	          image_builder,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_image_builder_free(
+	          &image_builder,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition != NULL )
+	{
+		libvsmbr_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libvsmbr_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( image_builder != NULL )
+	{
+		libvsmbr_image_builder_free(
+		 &image_builder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argc )
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_image_builder_initialize",
+	 vsmbr_test_image_builder_initialize );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_image_builder_free",
+	 vsmbr_test_image_builder_free );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_image_builder_append_partition",
+	 vsmbr_test_image_builder_append_partition );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_image_builder_write_file_io_handle",
+	 vsmbr_test_image_builder_write_file_io_handle );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
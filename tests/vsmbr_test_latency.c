@@ -0,0 +1,602 @@
+/*
+ * Latency file IO handle test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsmbr_test_image.h"
+#include "vsmbr_test_latency_io_handle.h"
+#include "vsmbr_test_libbfio.h"
+#include "vsmbr_test_libcerror.h"
+#include "vsmbr_test_libvsmbr.h"
+#include "vsmbr_test_macros.h"
+#include "vsmbr_test_memory.h"
+#include "vsmbr_test_unused.h"
+
+/* The test image consists of a MBR with a single partition
+ * of 127 sectors starting at sector 1
+ */
+#define VSMBR_TEST_LATENCY_IMAGE_SIZE	65536
+
+/* The latency added to every read in nano seconds
+ */
+#define VSMBR_TEST_LATENCY_LATENCY	1000000
+
+uint8_t vsmbr_test_latency_image_data[ VSMBR_TEST_LATENCY_IMAGE_SIZE ];
+
+/* Tests the vsmbr_test_latency_io_handle_get_delay function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_latency_get_delay(
+     void )
+{
+	libbfio_handle_t *file_io_handle                  = NULL;
+	libcerror_error_t *error                          = NULL;
+	vsmbr_test_latency_io_handle_t *latency_io_handle = NULL;
+	uint64_t delay                                    = 0;
+	int draw_index                                    = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_latency_io_handle_initialize(
+	          &latency_io_handle,
+	          file_io_handle,
+	          1000,
+	          0,
+	          1000000,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The file IO handle is now managed by the latency IO handle
+	 */
+	file_io_handle = NULL;
+
+	/* Test regular cases
+	 * The delay of 1500000 bytes at 1000000 bytes per second is 1.5 seconds
+	 */
+	result = vsmbr_test_latency_io_handle_get_delay(
+	          latency_io_handle,
+	          1500000,
+	          &delay,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "delay",
+	 delay,
+	 (uint64_t) 1500001000UL );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The jitter adds at most the jitter to the latency
+	 */
+	latency_io_handle->jitter           = 100;
+	latency_io_handle->bytes_per_second = 0;
+
+	for( draw_index = 0;
+	     draw_index < 64;
+	     draw_index++ )
+	{
+		result = vsmbr_test_latency_io_handle_get_delay(
+		          latency_io_handle,
+		          512,
+		          &delay,
+		          &error );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		VSMBR_TEST_ASSERT_LESS_THAN_UINT64(
+		 "delay",
+		 delay,
+		 (uint64_t) 1101 );
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "delay >= 1000",
+		 (int) ( delay >= 1000 ),
+		 1 );
+	}
+	/* Test error cases
+	 */
+	result = vsmbr_test_latency_io_handle_get_delay(
+	          NULL,
+	          512,
+	          &delay,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = vsmbr_test_latency_io_handle_get_delay(
+	          latency_io_handle,
+	          512,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = vsmbr_test_latency_io_handle_free(
+	          &latency_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "latency_io_handle",
+	 latency_io_handle );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( latency_io_handle != NULL )
+	{
+		vsmbr_test_latency_io_handle_free(
+		 &latency_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+/* Tests the libvsmbr_volume_open_file_io_handle function with a latency file IO handle
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_latency_volume_open_file_io_handle(
+     void )
+{
+	uint8_t buffer[ 1024 ];
+
+	libbfio_handle_t *file_io_handle                  = NULL;
+	libbfio_handle_t *memory_range_io_handle          = NULL;
+	libcerror_error_t *error                          = NULL;
+	libvsmbr_partition_t *partition                   = NULL;
+	libvsmbr_statistics_t *statistics                 = NULL;
+	libvsmbr_volume_t *volume                         = NULL;
+	vsmbr_test_latency_io_handle_t *latency_io_handle = NULL;
+	ssize_t read_count                                = 0;
+	uint64_t io_wait_time                             = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_memory_range_initialize(
+	          &memory_range_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          memory_range_io_handle,
+	          vsmbr_test_latency_image_data,
+	          VSMBR_TEST_LATENCY_IMAGE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_latency_initialize(
+	          &file_io_handle,
+	          memory_range_io_handle,
+	          VSMBR_TEST_LATENCY_LATENCY,
+	          0,
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The memory range file IO handle is now managed by the latency file IO handle
+	 */
+	memory_range_io_handle = NULL;
+
+	result = libbfio_handle_get_io_handle(
+	          file_io_handle,
+	          (intptr_t **) &latency_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "latency_io_handle",
+	 latency_io_handle );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_initialize(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBVSMBR_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_get_partition_by_index(
+	          volume,
+	          0,
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libvsmbr_partition_read_buffer_at_offset(
+	              partition,
+	              buffer,
+	              1024,
+	              0,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1024 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The data is passed through unchanged
+	 */
+	result = memory_compare(
+	          buffer,
+	          &( vsmbr_test_latency_image_data[ 512 ] ),
+	          1024 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Every read of the volume is delayed by the latency
+	 */
+	VSMBR_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "latency_io_handle->number_of_reads",
+	 (int64_t) latency_io_handle->number_of_reads,
+	 (int64_t) 0 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "latency_io_handle->delay_time",
+	 latency_io_handle->delay_time,
+	 latency_io_handle->number_of_reads * VSMBR_TEST_LATENCY_LATENCY );
+
+#if defined( HAVE_CLOCK_GETTIME ) || defined( HAVE_GETTIMEOFDAY ) || defined( WINAPI )
+	/* The library measures the delay of the partition reads as time blocked in IO
+	 */
+	result = libvsmbr_partition_get_statistics(
+	          partition,
+	          &statistics,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_statistics_get_io_wait_time(
+	          statistics,
+	          &io_wait_time,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "io_wait_time >= latency",
+	 (int) ( io_wait_time >= VSMBR_TEST_LATENCY_LATENCY ),
+	 1 );
+
+	result = libvsmbr_statistics_free(
+	          &statistics,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( HAVE_CLOCK_GETTIME ) || defined( HAVE_GETTIMEOFDAY ) || defined( WINAPI ) */
+
+	/* Clean up
+	 */
+	result = libvsmbr_partition_free(
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_close(
+	          volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_free(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( statistics != NULL )
+	{
+		libvsmbr_statistics_free(
+		 &statistics,
+		 NULL );
+	}
+	if( partition != NULL )
+	{
+		libvsmbr_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libvsmbr_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( memory_range_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &memory_range_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argc )
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+	if( vsmbr_test_image_fill(
+	     vsmbr_test_latency_image_data,
+	     VSMBR_TEST_LATENCY_IMAGE_SIZE,
+	     1,
+	     0,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+
+	VSMBR_TEST_RUN(
+	 "vsmbr_test_latency_io_handle_get_delay",
+	 vsmbr_test_latency_get_delay );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_volume_open_file_io_handle",
+	 vsmbr_test_latency_volume_open_file_io_handle );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,848 @@
+/*
+ * Latency injecting file IO handle for testing
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_TIME_H )
+#include <time.h>
+#endif
+
+#include "vsmbr_test_latency_io_handle.h"
+#include "vsmbr_test_libbfio.h"
+#include "vsmbr_test_libcerror.h"
+
+/* The initial state of the jitter pseudo random number generator
+ * a fixed value is used so that runs are reproducible
+ */
+#define VSMBR_TEST_LATENCY_RANDOM_SEED	0x9e3779b97f4a7c15ULL
+
+/* Creates a latency IO handle
+ * Make sure the value latency_io_handle is referencing, is set to NULL
+ * The latency IO handle takes over management of the file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_latency_io_handle_initialize(
+     vsmbr_test_latency_io_handle_t **latency_io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t latency,
+     uint64_t jitter,
+     uint64_t bytes_per_second,
+     libcerror_error_t **error )
+{
+	static char *function = "vsmbr_test_latency_io_handle_initialize";
+
+	if( latency_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid latency IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *latency_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid latency IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*latency_io_handle = memory_allocate_structure(
+	                      vsmbr_test_latency_io_handle_t );
+
+	if( *latency_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create latency IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *latency_io_handle,
+	     0,
+	     sizeof( vsmbr_test_latency_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear latency IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *latency_io_handle )->file_io_handle   = file_io_handle;
+	( *latency_io_handle )->latency          = latency;
+	( *latency_io_handle )->jitter           = jitter;
+	( *latency_io_handle )->bytes_per_second = bytes_per_second;
+	( *latency_io_handle )->random_state     = VSMBR_TEST_LATENCY_RANDOM_SEED;
+
+	return( 1 );
+
+on_error:
+	if( *latency_io_handle != NULL )
+	{
+		memory_free(
+		 *latency_io_handle );
+
+		*latency_io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Initializes a handle that wraps the file IO handle and delays every read
+ * The latency and jitter are in nano seconds, a bytes per second of 0
+ * represents unlimited bandwidth
+ * The handle takes over management of the file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_latency_initialize(
+     libbfio_handle_t **handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t latency,
+     uint64_t jitter,
+     uint64_t bytes_per_second,
+     libcerror_error_t **error )
+{
+	vsmbr_test_latency_io_handle_t *latency_io_handle = NULL;
+	static char *function                             = "vsmbr_test_latency_initialize";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( vsmbr_test_latency_io_handle_initialize(
+	     &latency_io_handle,
+	     file_io_handle,
+	     latency,
+	     jitter,
+	     bytes_per_second,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create latency IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     handle,
+	     (intptr_t *) latency_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) vsmbr_test_latency_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) vsmbr_test_latency_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) vsmbr_test_latency_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) vsmbr_test_latency_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) vsmbr_test_latency_io_handle_read,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) vsmbr_test_latency_io_handle_write,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) vsmbr_test_latency_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) vsmbr_test_latency_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) vsmbr_test_latency_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) vsmbr_test_latency_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( latency_io_handle != NULL )
+	{
+		/* The file IO handle remains managed by the caller on error
+		 */
+		latency_io_handle->file_io_handle = NULL;
+
+		vsmbr_test_latency_io_handle_free(
+		 &latency_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a latency IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_latency_io_handle_free(
+     vsmbr_test_latency_io_handle_t **latency_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "vsmbr_test_latency_io_handle_free";
+	int result            = 1;
+
+	if( latency_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid latency IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *latency_io_handle != NULL )
+	{
+		if( ( *latency_io_handle )->file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( ( *latency_io_handle )->file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *latency_io_handle );
+
+		*latency_io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the latency IO handle and its attributes
+ * The wrapped file IO handle is cloned as well
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_latency_io_handle_clone(
+     vsmbr_test_latency_io_handle_t **destination_latency_io_handle,
+     vsmbr_test_latency_io_handle_t *source_latency_io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "vsmbr_test_latency_io_handle_clone";
+
+	if( destination_latency_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination latency IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_latency_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: destination latency IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_latency_io_handle == NULL )
+	{
+		*destination_latency_io_handle = NULL;
+
+		return( 1 );
+	}
+	if( libbfio_handle_clone(
+	     &file_io_handle,
+	     source_latency_io_handle->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( vsmbr_test_latency_io_handle_initialize(
+	     destination_latency_io_handle,
+	     file_io_handle,
+	     source_latency_io_handle->latency,
+	     source_latency_io_handle->jitter,
+	     source_latency_io_handle->bytes_per_second,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination latency IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* Give the clone its own jitter sequence
+	 */
+	( *destination_latency_io_handle )->random_state ^= source_latency_io_handle->random_state << 1;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines the delay of a read of a specific size
+ * The delay consists of the latency, a random part of the jitter and
+ * the transfer time at the configured bandwidth
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_latency_io_handle_get_delay(
+     vsmbr_test_latency_io_handle_t *latency_io_handle,
+     size_t read_size,
+     uint64_t *delay,
+     libcerror_error_t **error )
+{
+	static char *function = "vsmbr_test_latency_io_handle_get_delay";
+	uint64_t random_value = 0;
+	uint64_t safe_delay   = 0;
+
+	if( latency_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid latency IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( delay == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid delay.",
+		 function );
+
+		return( -1 );
+	}
+	safe_delay = latency_io_handle->latency;
+
+	if( latency_io_handle->jitter > 0 )
+	{
+		/* xorshift64
+		 */
+		random_value  = latency_io_handle->random_state;
+		random_value ^= random_value << 13;
+		random_value ^= random_value >> 7;
+		random_value ^= random_value << 17;
+
+		latency_io_handle->random_state = random_value;
+
+		if( latency_io_handle->jitter < UINT64_MAX )
+		{
+			random_value %= latency_io_handle->jitter + 1;
+		}
+		safe_delay += random_value;
+	}
+	if( latency_io_handle->bytes_per_second > 0 )
+	{
+		/* Split the calculation to prevent the multiplication from overflowing
+		 */
+		safe_delay += ( (uint64_t) read_size / latency_io_handle->bytes_per_second ) * 1000000000UL;
+		safe_delay += ( ( (uint64_t) read_size % latency_io_handle->bytes_per_second ) * 1000000000UL ) / latency_io_handle->bytes_per_second;
+	}
+	*delay = safe_delay;
+
+	return( 1 );
+}
+
+/* Suspends the calling thread for the delay in nano seconds
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_latency_sleep(
+     uint64_t delay,
+     libcerror_error_t **error )
+{
+	static char *function = "vsmbr_test_latency_sleep";
+
+#if !defined( WINAPI ) && defined( HAVE_NANOSLEEP )
+	struct timespec remaining_time;
+	struct timespec sleep_time;
+#endif
+
+	if( delay == 0 )
+	{
+		return( 1 );
+	}
+#if defined( WINAPI )
+	/* Sleep has a millisecond resolution, round up so that the delay
+	 * is never shorter than requested
+	 */
+	Sleep(
+	 (DWORD) ( ( delay + 999999 ) / 1000000 ) );
+
+#elif defined( HAVE_NANOSLEEP )
+	sleep_time.tv_sec  = (time_t) ( delay / 1000000000UL );
+	sleep_time.tv_nsec = (long) ( delay % 1000000000UL );
+
+	while( nanosleep(
+	        &sleep_time,
+	        &remaining_time ) != 0 )
+	{
+		if( errno != EINTR )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 errno,
+			 "%s: unable to sleep.",
+			 function );
+
+			return( -1 );
+		}
+		sleep_time = remaining_time;
+	}
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: sleep not supported.",
+	 function );
+
+	return( -1 );
+#endif
+	return( 1 );
+}
+
+/* Opens the latency IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_latency_io_handle_open(
+     vsmbr_test_latency_io_handle_t *latency_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "vsmbr_test_latency_io_handle_open";
+
+	if( latency_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid latency IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_open(
+	     latency_io_handle->file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the latency IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int vsmbr_test_latency_io_handle_close(
+     vsmbr_test_latency_io_handle_t *latency_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "vsmbr_test_latency_io_handle_close";
+
+	if( latency_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid latency IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_close(
+	     latency_io_handle->file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Reads a buffer from the latency IO handle
+ * The read is delayed before it is passed to the wrapped file IO handle
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t vsmbr_test_latency_io_handle_read(
+         vsmbr_test_latency_io_handle_t *latency_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "vsmbr_test_latency_io_handle_read";
+	ssize_t read_count    = 0;
+	uint64_t delay        = 0;
+
+	if( latency_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid latency IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( vsmbr_test_latency_io_handle_get_delay(
+	     latency_io_handle,
+	     size,
+	     &delay,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve delay.",
+		 function );
+
+		return( -1 );
+	}
+	if( vsmbr_test_latency_sleep(
+	     delay,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to delay read.",
+		 function );
+
+		return( -1 );
+	}
+	latency_io_handle->number_of_reads += 1;
+	latency_io_handle->delay_time      += delay;
+
+	read_count = libbfio_handle_read_buffer(
+	              latency_io_handle->file_io_handle,
+	              buffer,
+	              size,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Writes a buffer to the latency IO handle
+ * Writes are passed to the wrapped file IO handle without delay
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t vsmbr_test_latency_io_handle_write(
+         vsmbr_test_latency_io_handle_t *latency_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "vsmbr_test_latency_io_handle_write";
+	ssize_t write_count   = 0;
+
+	if( latency_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid latency IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = libbfio_handle_write_buffer(
+	               latency_io_handle->file_io_handle,
+	               buffer,
+	               size,
+	               error );
+
+	if( write_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write to file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( write_count );
+}
+
+/* Seeks a certain offset within the latency IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t vsmbr_test_latency_io_handle_seek_offset(
+         vsmbr_test_latency_io_handle_t *latency_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "vsmbr_test_latency_io_handle_seek_offset";
+
+	if( latency_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid latency IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	offset = libbfio_handle_seek_offset(
+	          latency_io_handle->file_io_handle,
+	          offset,
+	          whence,
+	          error );
+
+	if( offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset in file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( offset );
+}
+
+/* Function to determine if a file exists
+ * Returns 1 if file exists, 0 if not or -1 on error
+ */
+int vsmbr_test_latency_io_handle_exists(
+     vsmbr_test_latency_io_handle_t *latency_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "vsmbr_test_latency_io_handle_exists";
+	int result            = 0;
+
+	if( latency_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid latency IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_exists(
+	          latency_io_handle->file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file IO handle exists.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Check if the file is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int vsmbr_test_latency_io_handle_is_open(
+     vsmbr_test_latency_io_handle_t *latency_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "vsmbr_test_latency_io_handle_is_open";
+	int result            = 0;
+
+	if( latency_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid latency IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_is_open(
+	          latency_io_handle->file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the size of the latency IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_latency_io_handle_get_size(
+     vsmbr_test_latency_io_handle_t *latency_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "vsmbr_test_latency_io_handle_get_size";
+
+	if( latency_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid latency IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     latency_io_handle->file_io_handle,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
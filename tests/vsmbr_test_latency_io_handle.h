@@ -0,0 +1,148 @@
+/*
+ * Latency injecting file IO handle for testing
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _VSMBR_TEST_LATENCY_IO_HANDLE_H )
+#define _VSMBR_TEST_LATENCY_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "vsmbr_test_libbfio.h"
+#include "vsmbr_test_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct vsmbr_test_latency_io_handle vsmbr_test_latency_io_handle_t;
+
+struct vsmbr_test_latency_io_handle
+{
+	/* The wrapped file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The latency added to every read request in nano seconds
+	 */
+	uint64_t latency;
+
+	/* The maximum random latency added on top of the latency in nano seconds
+	 */
+	uint64_t jitter;
+
+	/* The maximum number of bytes per second, where 0 represents unlimited
+	 */
+	uint64_t bytes_per_second;
+
+	/* The state of the jitter pseudo random number generator
+	 */
+	uint64_t random_state;
+
+	/* The number of read requests
+	 */
+	uint64_t number_of_reads;
+
+	/* The cumulative delay injected in nano seconds
+	 */
+	uint64_t delay_time;
+};
+
+int vsmbr_test_latency_io_handle_initialize(
+     vsmbr_test_latency_io_handle_t **latency_io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t latency,
+     uint64_t jitter,
+     uint64_t bytes_per_second,
+     libcerror_error_t **error );
+
+int vsmbr_test_latency_initialize(
+     libbfio_handle_t **handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t latency,
+     uint64_t jitter,
+     uint64_t bytes_per_second,
+     libcerror_error_t **error );
+
+int vsmbr_test_latency_io_handle_free(
+     vsmbr_test_latency_io_handle_t **latency_io_handle,
+     libcerror_error_t **error );
+
+int vsmbr_test_latency_io_handle_clone(
+     vsmbr_test_latency_io_handle_t **destination_latency_io_handle,
+     vsmbr_test_latency_io_handle_t *source_latency_io_handle,
+     libcerror_error_t **error );
+
+int vsmbr_test_latency_io_handle_get_delay(
+     vsmbr_test_latency_io_handle_t *latency_io_handle,
+     size_t read_size,
+     uint64_t *delay,
+     libcerror_error_t **error );
+
+int vsmbr_test_latency_sleep(
+     uint64_t delay,
+     libcerror_error_t **error );
+
+int vsmbr_test_latency_io_handle_open(
+     vsmbr_test_latency_io_handle_t *latency_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int vsmbr_test_latency_io_handle_close(
+     vsmbr_test_latency_io_handle_t *latency_io_handle,
+     libcerror_error_t **error );
+
+ssize_t vsmbr_test_latency_io_handle_read(
+         vsmbr_test_latency_io_handle_t *latency_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t vsmbr_test_latency_io_handle_write(
+         vsmbr_test_latency_io_handle_t *latency_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t vsmbr_test_latency_io_handle_seek_offset(
+         vsmbr_test_latency_io_handle_t *latency_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int vsmbr_test_latency_io_handle_exists(
+     vsmbr_test_latency_io_handle_t *latency_io_handle,
+     libcerror_error_t **error );
+
+int vsmbr_test_latency_io_handle_is_open(
+     vsmbr_test_latency_io_handle_t *latency_io_handle,
+     libcerror_error_t **error );
+
+int vsmbr_test_latency_io_handle_get_size(
+     vsmbr_test_latency_io_handle_t *latency_io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _VSMBR_TEST_LATENCY_IO_HANDLE_H ) */
+
@@ -0,0 +1,666 @@
+/*
+ * Library move journal type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsmbr_test_libbfio.h"
+#include "vsmbr_test_libcerror.h"
+#include "vsmbr_test_libvsmbr.h"
+#include "vsmbr_test_macros.h"
+#include "vsmbr_test_memory.h"
+#include "vsmbr_test_unused.h"
+
+#include "../libvsmbr/libvsmbr_definitions.h"
+#include "../libvsmbr/libvsmbr_move_journal.h"
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+/* The on-disk size of a move journal
+ */
+#define VSMBR_TEST_MOVE_JOURNAL_DATA_SIZE	72
+
+uint8_t vsmbr_test_move_journal_data[ VSMBR_TEST_MOVE_JOURNAL_DATA_SIZE ];
+
+/* Tests the libvsmbr_move_journal_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_move_journal_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libvsmbr_move_journal_t *move_journal = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_VSMBR_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 1;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_move_journal_initialize(
+	          &move_journal,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "move_journal",
+	 move_journal );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_move_journal_free(
+	          &move_journal,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "move_journal",
+	 move_journal );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_move_journal_initialize(
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	move_journal = (libvsmbr_move_journal_t *) 0x12345678UL;
+
+	result = libvsmbr_move_journal_initialize(
+	          &move_journal,
+	          &error );
+
+	move_journal = NULL;
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSMBR_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvsmbr_move_journal_initialize with malloc failing
+		 */
+		vsmbr_test_malloc_attempts_before_fail = test_number;
+
+		result = libvsmbr_move_journal_initialize(
+		          &move_journal,
+		          &error );
+
+		if( vsmbr_test_malloc_attempts_before_fail != -1 )
+		{
+			vsmbr_test_malloc_attempts_before_fail = -1;
+
+			if( move_journal != NULL )
+			{
+				libvsmbr_move_journal_free(
+				 &move_journal,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSMBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSMBR_TEST_ASSERT_IS_NULL(
+			 "move_journal",
+			 move_journal );
+
+			VSMBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvsmbr_move_journal_initialize with memset failing
+		 */
+		vsmbr_test_memset_attempts_before_fail = test_number;
+
+		result = libvsmbr_move_journal_initialize(
+		          &move_journal,
+		          &error );
+
+		if( vsmbr_test_memset_attempts_before_fail != -1 )
+		{
+			vsmbr_test_memset_attempts_before_fail = -1;
+
+			if( move_journal != NULL )
+			{
+				libvsmbr_move_journal_free(
+				 &move_journal,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSMBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSMBR_TEST_ASSERT_IS_NULL(
+			 "move_journal",
+			 move_journal );
+
+			VSMBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_VSMBR_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( move_journal != NULL )
+	{
+		libvsmbr_move_journal_free(
+		 &move_journal,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_move_journal_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_move_journal_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvsmbr_move_journal_free(
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_move_journal_write_file_io_handle and libvsmbr_move_journal_read_file_io_handle functions
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_move_journal_read_write_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle      = NULL;
+	libcerror_error_t *error              = NULL;
+	libvsmbr_move_journal_t *move_journal = NULL;
+	libvsmbr_move_journal_t *read_journal = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          vsmbr_test_move_journal_data,
+	          VSMBR_TEST_MOVE_JOURNAL_DATA_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ_WRITE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_move_journal_initialize(
+	          &move_journal,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_move_journal_initialize(
+	          &read_journal,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	move_journal->state                   = LIBVSMBR_MOVE_JOURNAL_STATE_COPYING;
+	move_journal->partition_record_offset = 65536;
+	move_journal->partition_entry_index   = 1;
+	move_journal->sector_number           = 160;
+	move_journal->number_of_sectors       = 32;
+	move_journal->source_offset           = 69632;
+	move_journal->destination_offset      = 81920;
+	move_journal->data_size               = 16384;
+	move_journal->copied_size             = 4096;
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_move_journal_write_file_io_handle(
+	          move_journal,
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_move_journal_read_file_io_handle(
+	          read_journal,
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "read_journal->state",
+	 read_journal->state,
+	 (uint32_t) LIBVSMBR_MOVE_JOURNAL_STATE_COPYING );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "read_journal->partition_record_offset",
+	 (int64_t) read_journal->partition_record_offset,
+	 (int64_t) 65536 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT8(
+	 "read_journal->partition_entry_index",
+	 read_journal->partition_entry_index,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "read_journal->sector_number",
+	 read_journal->sector_number,
+	 160 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "read_journal->number_of_sectors",
+	 read_journal->number_of_sectors,
+	 32 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "read_journal->source_offset",
+	 (int64_t) read_journal->source_offset,
+	 (int64_t) 69632 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "read_journal->destination_offset",
+	 (int64_t) read_journal->destination_offset,
+	 (int64_t) 81920 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "read_journal->data_size",
+	 read_journal->data_size,
+	 (uint64_t) 16384 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "read_journal->copied_size",
+	 read_journal->copied_size,
+	 (uint64_t) 4096 );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_move_journal_write_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_move_journal_read_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a copied size that exceeds the data size
+	 */
+	move_journal->copied_size = 32768;
+
+	result = libvsmbr_move_journal_write_file_io_handle(
+	          move_journal,
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_move_journal_read_file_io_handle(
+	          read_journal,
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an invalid signature
+	 */
+	vsmbr_test_move_journal_data[ 0 ] = (uint8_t) 'X';
+
+	result = libvsmbr_move_journal_read_file_io_handle(
+	          read_journal,
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_move_journal_free(
+	          &read_journal,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_move_journal_free(
+	          &move_journal,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_journal != NULL )
+	{
+		libvsmbr_move_journal_free(
+		 &read_journal,
+		 NULL );
+	}
+	if( move_journal != NULL )
+	{
+		libvsmbr_move_journal_free(
+		 &move_journal,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argc )
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_move_journal_initialize",
+	 vsmbr_test_move_journal_initialize );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_move_journal_free",
+	 vsmbr_test_move_journal_free );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_move_journal_read_write_file_io_handle",
+	 vsmbr_test_move_journal_read_write_file_io_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,1685 @@
+/*
+ * Library overlay type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsmbr_test_functions.h"
+#include "vsmbr_test_image.h"
+#include "vsmbr_test_libbfio.h"
+#include "vsmbr_test_libcerror.h"
+#include "vsmbr_test_libvsmbr.h"
+#include "vsmbr_test_macros.h"
+#include "vsmbr_test_memory.h"
+#include "vsmbr_test_unused.h"
+
+#include "../libvsmbr/libvsmbr_definitions.h"
+#include "../libvsmbr/libvsmbr_overlay_io_handle.h"
+
+/* The test image consists of a MBR with a single partition
+ * of 319 sectors starting at sector 1, the image size is
+ * not a multiple of the overlay block size
+ */
+#define VSMBR_TEST_OVERLAY_IMAGE_SIZE		163840
+
+#define VSMBR_TEST_OVERLAY_DATA_SIZE		( 4 * 65536 )
+
+uint8_t vsmbr_test_overlay_image_data[ VSMBR_TEST_OVERLAY_IMAGE_SIZE ];
+
+uint8_t vsmbr_test_overlay_original_image_data[ VSMBR_TEST_OVERLAY_IMAGE_SIZE ];
+
+uint8_t vsmbr_test_overlay_data[ VSMBR_TEST_OVERLAY_DATA_SIZE ];
+
+/* Creates a file IO handle for memory data
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_overlay_initialize_file_io_handle(
+     libbfio_handle_t **file_io_handle,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	if( libbfio_memory_range_initialize(
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libbfio_memory_range_set(
+	     *file_io_handle,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libbfio_handle_free(
+		 file_io_handle,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+/* Tests the libvsmbr_overlay_io_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_overlay_io_handle_initialize(
+     void )
+{
+	libbfio_handle_t *base_file_io_handle           = NULL;
+	libbfio_handle_t *overlay_file_io_handle        = NULL;
+	libcerror_error_t *error                        = NULL;
+	libvsmbr_overlay_io_handle_t *overlay_io_handle = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = vsmbr_test_overlay_initialize_file_io_handle(
+	          &base_file_io_handle,
+	          vsmbr_test_overlay_image_data,
+	          VSMBR_TEST_OVERLAY_IMAGE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_overlay_initialize_file_io_handle(
+	          &overlay_file_io_handle,
+	          vsmbr_test_overlay_data,
+	          VSMBR_TEST_OVERLAY_DATA_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_overlay_io_handle_initialize(
+	          &overlay_io_handle,
+	          base_file_io_handle,
+	          overlay_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "overlay_io_handle",
+	 overlay_io_handle );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_overlay_io_handle_free(
+	          &overlay_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "overlay_io_handle",
+	 overlay_io_handle );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_overlay_io_handle_initialize(
+	          NULL,
+	          base_file_io_handle,
+	          overlay_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	overlay_io_handle = (libvsmbr_overlay_io_handle_t *) 0x12345678UL;
+
+	result = libvsmbr_overlay_io_handle_initialize(
+	          &overlay_io_handle,
+	          base_file_io_handle,
+	          overlay_file_io_handle,
+	          &error );
+
+	overlay_io_handle = NULL;
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_overlay_io_handle_initialize(
+	          &overlay_io_handle,
+	          NULL,
+	          overlay_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_overlay_io_handle_initialize(
+	          &overlay_io_handle,
+	          base_file_io_handle,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSMBR_TEST_MEMORY )
+
+	/* Test libvsmbr_overlay_io_handle_initialize with malloc failing
+	 */
+	vsmbr_test_malloc_attempts_before_fail = 0;
+
+	result = libvsmbr_overlay_io_handle_initialize(
+	          &overlay_io_handle,
+	          base_file_io_handle,
+	          overlay_file_io_handle,
+	          &error );
+
+	if( vsmbr_test_malloc_attempts_before_fail != -1 )
+	{
+		vsmbr_test_malloc_attempts_before_fail = -1;
+
+		if( overlay_io_handle != NULL )
+		{
+			libvsmbr_overlay_io_handle_free(
+			 &overlay_io_handle,
+			 NULL );
+		}
+	}
+	else
+	{
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "overlay_io_handle",
+		 overlay_io_handle );
+
+		VSMBR_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_VSMBR_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &overlay_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &base_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( overlay_io_handle != NULL )
+	{
+		libvsmbr_overlay_io_handle_free(
+		 &overlay_io_handle,
+		 NULL );
+	}
+	if( overlay_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &overlay_file_io_handle,
+		 NULL );
+	}
+	if( base_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &base_file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_overlay_io_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_overlay_io_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvsmbr_overlay_io_handle_free(
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_overlay_io_handle_get_block_overlay_offset and
+ * libvsmbr_overlay_io_handle_set_block_overlay_offset functions
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_overlay_io_handle_get_set_block_overlay_offset(
+     void )
+{
+	off64_t *block_table_segments[ 2 ];
+
+	libbfio_handle_t *base_file_io_handle           = NULL;
+	libbfio_handle_t *overlay_file_io_handle        = NULL;
+	libcerror_error_t *error                        = NULL;
+	libvsmbr_overlay_io_handle_t *overlay_io_handle = NULL;
+	off64_t overlay_offset                          = 0;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = vsmbr_test_overlay_initialize_file_io_handle(
+	          &base_file_io_handle,
+	          vsmbr_test_overlay_original_image_data,
+	          VSMBR_TEST_OVERLAY_IMAGE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = vsmbr_test_overlay_initialize_file_io_handle(
+	          &overlay_file_io_handle,
+	          vsmbr_test_overlay_data,
+	          VSMBR_TEST_OVERLAY_DATA_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libvsmbr_overlay_io_handle_initialize(
+	          &overlay_io_handle,
+	          base_file_io_handle,
+	          overlay_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* The block table covers 2 segments of which none is allocated
+	 */
+	block_table_segments[ 0 ] = NULL;
+	block_table_segments[ 1 ] = NULL;
+
+	overlay_io_handle->block_table_segments           = block_table_segments;
+	overlay_io_handle->number_of_block_table_segments = 2;
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_overlay_io_handle_get_block_overlay_offset(
+	          overlay_io_handle,
+	          LIBVSMBR_OVERLAY_BLOCK_TABLE_SEGMENT_SIZE + 3,
+	          &overlay_offset,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_overlay_io_handle_set_block_overlay_offset(
+	          overlay_io_handle,
+	          LIBVSMBR_OVERLAY_BLOCK_TABLE_SEGMENT_SIZE + 3,
+	          65536,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "block_table_segments[ 0 ]",
+	 block_table_segments[ 0 ] );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "block_table_segments[ 1 ]",
+	 block_table_segments[ 1 ] );
+
+	result = libvsmbr_overlay_io_handle_get_block_overlay_offset(
+	          overlay_io_handle,
+	          LIBVSMBR_OVERLAY_BLOCK_TABLE_SEGMENT_SIZE + 3,
+	          &overlay_offset,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "overlay_offset",
+	 (int64_t) overlay_offset,
+	 (int64_t) 65536 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A block in the same segment that was not written
+	 */
+	result = libvsmbr_overlay_io_handle_get_block_overlay_offset(
+	          overlay_io_handle,
+	          LIBVSMBR_OVERLAY_BLOCK_TABLE_SEGMENT_SIZE + 4,
+	          &overlay_offset,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A block beyond the block table
+	 */
+	result = libvsmbr_overlay_io_handle_get_block_overlay_offset(
+	          overlay_io_handle,
+	          2 * LIBVSMBR_OVERLAY_BLOCK_TABLE_SEGMENT_SIZE,
+	          &overlay_offset,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_overlay_io_handle_get_block_overlay_offset(
+	          NULL,
+	          0,
+	          &overlay_offset,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_overlay_io_handle_get_block_overlay_offset(
+	          overlay_io_handle,
+	          0,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_overlay_io_handle_set_block_overlay_offset(
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_overlay_io_handle_set_block_overlay_offset(
+	          overlay_io_handle,
+	          0,
+	          -1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_overlay_io_handle_set_block_overlay_offset(
+	          overlay_io_handle,
+	          2 * LIBVSMBR_OVERLAY_BLOCK_TABLE_SEGMENT_SIZE,
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 block_table_segments[ 1 ] );
+
+	overlay_io_handle->block_table_segments           = NULL;
+	overlay_io_handle->number_of_block_table_segments = 0;
+
+	result = libvsmbr_overlay_io_handle_free(
+	          &overlay_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &overlay_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_handle_free(
+	          &base_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( overlay_io_handle != NULL )
+	{
+		if( overlay_io_handle->block_table_segments == block_table_segments )
+		{
+			if( block_table_segments[ 0 ] != NULL )
+			{
+				memory_free(
+				 block_table_segments[ 0 ] );
+			}
+			if( block_table_segments[ 1 ] != NULL )
+			{
+				memory_free(
+				 block_table_segments[ 1 ] );
+			}
+			overlay_io_handle->block_table_segments           = NULL;
+			overlay_io_handle->number_of_block_table_segments = 0;
+		}
+		libvsmbr_overlay_io_handle_free(
+		 &overlay_io_handle,
+		 NULL );
+	}
+	if( overlay_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &overlay_file_io_handle,
+		 NULL );
+	}
+	if( base_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &base_file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_overlay_io_handle_read and libvsmbr_overlay_io_handle_write functions
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_overlay_io_handle_read_write(
+     void )
+{
+	uint8_t buffer[ 2048 ];
+
+	libbfio_handle_t *base_file_io_handle    = NULL;
+	libbfio_handle_t *handle                 = NULL;
+	libbfio_handle_t *overlay_file_io_handle = NULL;
+	libcerror_error_t *error                 = NULL;
+	uint8_t *expected_data                   = NULL;
+	uint8_t *read_data                       = NULL;
+	size64_t size                            = 0;
+	ssize_t read_count                       = 0;
+	ssize_t write_count                      = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	memory_copy(
+	 vsmbr_test_overlay_image_data,
+	 vsmbr_test_overlay_original_image_data,
+	 VSMBR_TEST_OVERLAY_IMAGE_SIZE );
+
+	expected_data = (uint8_t *) memory_allocate(
+	                             VSMBR_TEST_OVERLAY_IMAGE_SIZE );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "expected_data",
+	 expected_data );
+
+	read_data = (uint8_t *) memory_allocate(
+	                         VSMBR_TEST_OVERLAY_IMAGE_SIZE );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "read_data",
+	 read_data );
+
+	memory_copy(
+	 expected_data,
+	 vsmbr_test_overlay_original_image_data,
+	 VSMBR_TEST_OVERLAY_IMAGE_SIZE );
+
+	result = vsmbr_test_overlay_initialize_file_io_handle(
+	          &base_file_io_handle,
+	          vsmbr_test_overlay_image_data,
+	          VSMBR_TEST_OVERLAY_IMAGE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          base_file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_overlay_initialize_file_io_handle(
+	          &overlay_file_io_handle,
+	          vsmbr_test_overlay_data,
+	          VSMBR_TEST_OVERLAY_DATA_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_overlay_initialize(
+	          &handle,
+	          base_file_io_handle,
+	          overlay_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          handle,
+	          LIBBFIO_OPEN_READ_WRITE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_size(
+	          handle,
+	          &size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) VSMBR_TEST_OVERLAY_IMAGE_SIZE );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The first write spans 2 blocks and does not start or end on a block boundary
+	 */
+	memory_set(
+	 buffer,
+	 0x5a,
+	 2048 );
+
+	memory_set(
+	 &( expected_data[ 65000 ] ),
+	 0x5a,
+	 2048 );
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               handle,
+	               buffer,
+	               2048,
+	               65000,
+	               &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 2048 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A second write to a block that is already in the overlay
+	 */
+	memory_set(
+	 buffer,
+	 0xa5,
+	 100 );
+
+	memory_set(
+	 &( expected_data[ 1000 ] ),
+	 0xa5,
+	 100 );
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               handle,
+	               buffer,
+	               100,
+	               1000,
+	               &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 100 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A write is truncated at the end of the base
+	 */
+	memory_set(
+	 &( expected_data[ VSMBR_TEST_OVERLAY_IMAGE_SIZE - 10 ] ),
+	 0xa5,
+	 10 );
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               handle,
+	               buffer,
+	               100,
+	               VSMBR_TEST_OVERLAY_IMAGE_SIZE - 10,
+	               &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 10 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               handle,
+	               buffer,
+	               100,
+	               VSMBR_TEST_OVERLAY_IMAGE_SIZE,
+	               &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The base is not modified
+	 */
+	result = memory_compare(
+	          vsmbr_test_overlay_image_data,
+	          vsmbr_test_overlay_original_image_data,
+	          VSMBR_TEST_OVERLAY_IMAGE_SIZE );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The overlay contains the first and second block in order of first write
+	 * followed by the last block
+	 */
+	result = memory_compare(
+	          vsmbr_test_overlay_data,
+	          &( expected_data[ 0 ] ),
+	          65536 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( vsmbr_test_overlay_data[ 65536 ] ),
+	          &( expected_data[ 65536 ] ),
+	          65536 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( vsmbr_test_overlay_data[ 2 * 65536 ] ),
+	          &( expected_data[ 2 * 65536 ] ),
+	          VSMBR_TEST_OVERLAY_IMAGE_SIZE - ( 2 * 65536 ) );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Reads merge the overlay and the base
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              read_data,
+	              VSMBR_TEST_OVERLAY_IMAGE_SIZE,
+	              0,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) VSMBR_TEST_OVERLAY_IMAGE_SIZE );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          read_data,
+	          expected_data,
+	          VSMBR_TEST_OVERLAY_IMAGE_SIZE );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              read_data,
+	              2048,
+	              64000,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 2048 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          read_data,
+	          &( expected_data[ 64000 ] ),
+	          2048 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* A read is truncated at the end of the base
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              read_data,
+	              2048,
+	              VSMBR_TEST_OVERLAY_IMAGE_SIZE - 100,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 100 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          read_data,
+	          &( expected_data[ VSMBR_TEST_OVERLAY_IMAGE_SIZE - 100 ] ),
+	          100 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_close(
+	          handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &overlay_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &base_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 read_data );
+
+	memory_free(
+	 expected_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( overlay_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &overlay_file_io_handle,
+		 NULL );
+	}
+	if( base_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &base_file_io_handle,
+		 NULL );
+	}
+	if( read_data != NULL )
+	{
+		memory_free(
+		 read_data );
+	}
+	if( expected_data != NULL )
+	{
+		memory_free(
+		 expected_data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+/* Tests the libvsmbr_volume_set_overlay_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_volume_set_overlay_file_io_handle(
+     void )
+{
+	uint8_t buffer[ 2048 ];
+	uint8_t expected_data[ 2048 ];
+
+	libbfio_handle_t *file_io_handle         = NULL;
+	libbfio_handle_t *overlay_file_io_handle = NULL;
+	libcerror_error_t *error                 = NULL;
+	libvsmbr_partition_t *partition          = NULL;
+	libvsmbr_volume_t *volume                = NULL;
+	ssize_t read_count                       = 0;
+	ssize_t write_count                      = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	memory_copy(
+	 vsmbr_test_overlay_image_data,
+	 vsmbr_test_overlay_original_image_data,
+	 VSMBR_TEST_OVERLAY_IMAGE_SIZE );
+
+	result = vsmbr_test_overlay_initialize_file_io_handle(
+	          &file_io_handle,
+	          vsmbr_test_overlay_image_data,
+	          VSMBR_TEST_OVERLAY_IMAGE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_overlay_initialize_file_io_handle(
+	          &overlay_file_io_handle,
+	          vsmbr_test_overlay_data,
+	          VSMBR_TEST_OVERLAY_DATA_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_initialize(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_volume_set_overlay_file_io_handle(
+	          volume,
+	          overlay_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBVSMBR_OPEN_READ_WRITE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_get_partition_by_index(
+	          volume,
+	          0,
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_copy(
+	 expected_data,
+	 &( vsmbr_test_overlay_original_image_data[ 512 ] ),
+	 2048 );
+
+	memory_set(
+	 &( expected_data[ 300 ] ),
+	 0x5a,
+	 1000 );
+
+	memory_set(
+	 buffer,
+	 0x5a,
+	 1000 );
+
+	write_count = libvsmbr_partition_write_buffer_at_offset(
+	               partition,
+	               buffer,
+	               1000,
+	               300,
+	               &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 1000 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_partition_flush(
+	          partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The data is written to the overlay and not to the base
+	 */
+	result = memory_compare(
+	          vsmbr_test_overlay_image_data,
+	          vsmbr_test_overlay_original_image_data,
+	          VSMBR_TEST_OVERLAY_IMAGE_SIZE );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( vsmbr_test_overlay_data[ 512 ] ),
+	          expected_data,
+	          2048 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libvsmbr_partition_read_buffer_at_offset(
+	              partition,
+	              buffer,
+	              2048,
+	              0,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 2048 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          expected_data,
+	          2048 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libvsmbr_partition_free(
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_volume_set_overlay_file_io_handle(
+	          NULL,
+	          overlay_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The overlay cannot be set on an open volume
+	 */
+	result = libvsmbr_volume_set_overlay_file_io_handle(
+	          volume,
+	          overlay_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_volume_close(
+	          volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_set_overlay_file_io_handle(
+	          volume,
+	          overlay_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Without write access the overlay is not used
+	 */
+	result = libvsmbr_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBVSMBR_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_get_partition_by_index(
+	          volume,
+	          0,
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libvsmbr_partition_read_buffer_at_offset(
+	              partition,
+	              buffer,
+	              2048,
+	              0,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 2048 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( vsmbr_test_overlay_original_image_data[ 512 ] ),
+	          2048 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libvsmbr_partition_free(
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_close(
+	          volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_free(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &overlay_file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition != NULL )
+	{
+		libvsmbr_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libvsmbr_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( overlay_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &overlay_file_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argc )
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+	if( vsmbr_test_image_fill(
+	     vsmbr_test_overlay_original_image_data,
+	     VSMBR_TEST_OVERLAY_IMAGE_SIZE,
+	     1,
+	     0,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_overlay_io_handle_initialize",
+	 vsmbr_test_overlay_io_handle_initialize );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_overlay_io_handle_free",
+	 vsmbr_test_overlay_io_handle_free );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_overlay_io_handle_get_set_block_overlay_offset",
+	 vsmbr_test_overlay_io_handle_get_set_block_overlay_offset );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_overlay_io_handle_read_write",
+	 vsmbr_test_overlay_io_handle_read_write );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_volume_set_overlay_file_io_handle",
+	 vsmbr_test_volume_set_overlay_file_io_handle );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -34,6 +35,10 @@
 #include <sys/time.h>
 #endif
 
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
 #include <time.h>
 
 #include "vsmbr_test_functions.h"
@@ -2686,6 +2691,277 @@ on_error:
 	return( 0 );
 }
 
+#if !defined( WINAPI ) || defined( __CYGWIN__ )
+
+/* Compares the data of a file with the partition data
+ * Returns 1 if equal, 0 if not or -1 on error
+ */
+int vsmbr_test_partition_compare_with_file(
+     libvsmbr_partition_t *partition,
+     FILE *file_stream,
+     libcerror_error_t **error )
+{
+	uint8_t file_buffer[ VSMBR_TEST_PARTITION_READ_BUFFER_SIZE ];
+	uint8_t partition_buffer[ VSMBR_TEST_PARTITION_READ_BUFFER_SIZE ];
+
+	size64_t partition_offset = 0;
+	size64_t partition_size   = 0;
+	ssize_t read_count        = 0;
+	size_t read_size          = 0;
+
+	if( libvsmbr_partition_get_size(
+	     partition,
+	     &partition_size,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( fseeko(
+	     file_stream,
+	     0,
+	     SEEK_END ) != 0 )
+	{
+		return( -1 );
+	}
+	if( (size64_t) ftello( file_stream ) != partition_size )
+	{
+		return( 0 );
+	}
+	if( fseeko(
+	     file_stream,
+	     0,
+	     SEEK_SET ) != 0 )
+	{
+		return( -1 );
+	}
+	while( partition_offset < partition_size )
+	{
+		read_size = VSMBR_TEST_PARTITION_READ_BUFFER_SIZE;
+
+		if( (size64_t) read_size > ( partition_size - partition_offset ) )
+		{
+			read_size = (size_t) ( partition_size - partition_offset );
+		}
+		read_count = libvsmbr_partition_read_buffer_at_offset(
+		              partition,
+		              partition_buffer,
+		              read_size,
+		              (off64_t) partition_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			return( -1 );
+		}
+		if( fread(
+		     file_buffer,
+		     1,
+		     read_size,
+		     file_stream ) != read_size )
+		{
+			return( -1 );
+		}
+		if( memory_compare(
+		     file_buffer,
+		     partition_buffer,
+		     read_size ) != 0 )
+		{
+			return( 0 );
+		}
+		partition_offset += read_size;
+	}
+	return( 1 );
+}
+
+/* Tests the libvsmbr_partition_export_to_file_descriptor function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_partition_export_to_file_descriptor(
+     libvsmbr_partition_t *partition )
+{
+	libcerror_error_t *error = NULL;
+	FILE *file_stream        = NULL;
+	int result               = 0;
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+	uint8_t file_io_handle_is_file = 0;
+#endif
+
+	/* Initialize test
+	 */
+	file_stream = tmpfile();
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_partition_export_to_file_descriptor(
+	          partition,
+	          fileno( file_stream ),
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_partition_compare_with_file(
+	          partition,
+	          file_stream,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+	/* Test with the kernel-side copy, the file IO handle of the tests is a file
+	 */
+	file_io_handle_is_file = ( (libvsmbr_internal_partition_t *) partition )->file_io_handle_is_file;
+
+	( (libvsmbr_internal_partition_t *) partition )->file_io_handle_is_file = 1;
+
+	result = ftruncate(
+	          fileno( file_stream ),
+	          0 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libvsmbr_partition_export_to_file_descriptor(
+	          partition,
+	          fileno( file_stream ),
+	          0,
+	          &error );
+
+	( (libvsmbr_internal_partition_t *) partition )->file_io_handle_is_file = file_io_handle_is_file;
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_partition_compare_with_file(
+	          partition,
+	          file_stream,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+	/* Test error cases
+	 */
+	result = libvsmbr_partition_export_to_file_descriptor(
+	          NULL,
+	          fileno( file_stream ),
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_partition_export_to_file_descriptor(
+	          partition,
+	          -1,
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_partition_export_to_file_descriptor(
+	          partition,
+	          fileno( file_stream ),
+	          -1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fclose(
+	          file_stream );
+
+	file_stream = NULL;
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_stream != NULL )
+	{
+		fclose(
+		 file_stream );
+	}
+	return( 0 );
+}
+
+#endif /* !defined( WINAPI ) || defined( __CYGWIN__ ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -2913,6 +3189,15 @@ int main(
 			 vsmbr_test_partition_get_size,
 			 partition );
 
+#if !defined( WINAPI ) || defined( __CYGWIN__ )
+
+			VSMBR_TEST_RUN_WITH_ARGS(
+			 "libvsmbr_partition_export_to_file_descriptor",
+			 vsmbr_test_partition_export_to_file_descriptor,
+			 partition );
+
+#endif /* !defined( WINAPI ) || defined( __CYGWIN__ ) */
+
 			result = libvsmbr_partition_free(
 			          &partition,
 			          &error );
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -429,6 +430,171 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libvsmbr_partition_entry_write_data function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_partition_entry_write_data(
+     void )
+{
+	uint8_t data[ 16 ];
+
+	libcerror_error_t *error                    = NULL;
+	libvsmbr_partition_entry_t *partition_entry = NULL;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libvsmbr_partition_entry_initialize(
+	          &partition_entry,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "partition_entry",
+	 partition_entry );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_partition_entry_read_data(
+	          partition_entry,
+	          vsmbr_test_partition_entry_data1,
+	          16,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_partition_entry_write_data(
+	          partition_entry,
+	          data,
+	          16,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          vsmbr_test_partition_entry_data1,
+	          16 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_partition_entry_write_data(
+	          NULL,
+	          data,
+	          16,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_partition_entry_write_data(
+	          partition_entry,
+	          NULL,
+	          16,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_partition_entry_write_data(
+	          partition_entry,
+	          data,
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_partition_entry_free(
+	          &partition_entry,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "partition_entry",
+	 partition_entry );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition_entry != NULL )
+	{
+		libvsmbr_partition_entry_free(
+		 &partition_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
 
 /* The main program
@@ -460,6 +626,10 @@ int main(
 	 "libvsmbr_partition_entry_read_data",
 	 vsmbr_test_partition_entry_read_data );
 
+	VSMBR_TEST_RUN(
+	 "libvsmbr_partition_entry_write_data",
+	 vsmbr_test_partition_entry_write_data );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
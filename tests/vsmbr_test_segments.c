@@ -0,0 +1,1679 @@
+/*
+ * Library segments type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsmbr_test_functions.h"
+#include "vsmbr_test_image.h"
+#include "vsmbr_test_libbfio.h"
+#include "vsmbr_test_libcerror.h"
+#include "vsmbr_test_libvsmbr.h"
+#include "vsmbr_test_macros.h"
+#include "vsmbr_test_memory.h"
+#include "vsmbr_test_unused.h"
+
+#include "../libvsmbr/libvsmbr_partition.h"
+#include "../libvsmbr/libvsmbr_segments_io_handle.h"
+
+/* The test image consists of a MBR with a single partition
+ * of 319 sectors starting at sector 1, that is split in segments
+ * of which the sizes are not a multiple of the sector size
+ */
+#define VSMBR_TEST_SEGMENTS_IMAGE_SIZE		163840
+
+#define VSMBR_TEST_SEGMENTS_NUMBER_OF_SEGMENTS	3
+
+size_t vsmbr_test_segments_segment_sizes[ VSMBR_TEST_SEGMENTS_NUMBER_OF_SEGMENTS ] = {
+	50001, 70000, 43839 };
+
+uint8_t vsmbr_test_segments_image_data[ VSMBR_TEST_SEGMENTS_IMAGE_SIZE ];
+
+uint8_t vsmbr_test_segments_original_image_data[ VSMBR_TEST_SEGMENTS_IMAGE_SIZE ];
+
+/* Creates a file IO pool with a memory range file IO handle per segment of the image data
+ * Returns 1 if successful or -1 on error
+ */
+int vsmbr_test_segments_initialize_file_io_pool(
+     libbfio_pool_t **file_io_pool,
+     uint8_t *image_data,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	size_t data_offset               = 0;
+	int file_io_pool_entry           = 0;
+	int segment_index                = 0;
+
+	if( libbfio_pool_initialize(
+	     file_io_pool,
+	     0,
+	     LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( segment_index = 0;
+	     segment_index < VSMBR_TEST_SEGMENTS_NUMBER_OF_SEGMENTS;
+	     segment_index++ )
+	{
+		if( libbfio_memory_range_initialize(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libbfio_memory_range_set(
+		     file_io_handle,
+		     &( image_data[ data_offset ] ),
+		     vsmbr_test_segments_segment_sizes[ segment_index ],
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libbfio_pool_append_handle(
+		     *file_io_pool,
+		     &file_io_pool_entry,
+		     file_io_handle,
+		     LIBBFIO_OPEN_READ_WRITE,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		file_io_handle = NULL;
+
+		data_offset += vsmbr_test_segments_segment_sizes[ segment_index ];
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( *file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 file_io_pool,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+/* Tests the libvsmbr_segments_io_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_segments_io_handle_initialize(
+     void )
+{
+	libbfio_pool_t *file_io_pool                      = NULL;
+	libcerror_error_t *error                          = NULL;
+	libvsmbr_segments_io_handle_t *segments_io_handle = NULL;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = vsmbr_test_segments_initialize_file_io_pool(
+	          &file_io_pool,
+	          vsmbr_test_segments_image_data,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_segments_io_handle_initialize(
+	          &segments_io_handle,
+	          file_io_pool,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "segments_io_handle",
+	 segments_io_handle );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_segments_io_handle_free(
+	          &segments_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "segments_io_handle",
+	 segments_io_handle );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_segments_io_handle_initialize(
+	          NULL,
+	          file_io_pool,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	segments_io_handle = (libvsmbr_segments_io_handle_t *) 0x12345678UL;
+
+	result = libvsmbr_segments_io_handle_initialize(
+	          &segments_io_handle,
+	          file_io_pool,
+	          &error );
+
+	segments_io_handle = NULL;
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_segments_io_handle_initialize(
+	          &segments_io_handle,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSMBR_TEST_MEMORY )
+
+	/* Test libvsmbr_segments_io_handle_initialize with malloc failing
+	 */
+	vsmbr_test_malloc_attempts_before_fail = 0;
+
+	result = libvsmbr_segments_io_handle_initialize(
+	          &segments_io_handle,
+	          file_io_pool,
+	          &error );
+
+	if( vsmbr_test_malloc_attempts_before_fail != -1 )
+	{
+		vsmbr_test_malloc_attempts_before_fail = -1;
+
+		if( segments_io_handle != NULL )
+		{
+			libvsmbr_segments_io_handle_free(
+			 &segments_io_handle,
+			 NULL );
+		}
+	}
+	else
+	{
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "segments_io_handle",
+		 segments_io_handle );
+
+		VSMBR_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_VSMBR_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segments_io_handle != NULL )
+	{
+		libvsmbr_segments_io_handle_free(
+		 &segments_io_handle,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_segments_io_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_segments_io_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvsmbr_segments_io_handle_free(
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_segments_io_handle_get_segment_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_segments_io_handle_get_segment_at_offset(
+     void )
+{
+	libbfio_pool_t *file_io_pool                      = NULL;
+	libcerror_error_t *error                          = NULL;
+	libvsmbr_segments_io_handle_t *segments_io_handle = NULL;
+	off64_t segment_offset                            = 0;
+	int result                                        = 0;
+	int segment_index                                 = 0;
+
+	/* Initialize test
+	 */
+	result = vsmbr_test_segments_initialize_file_io_pool(
+	          &file_io_pool,
+	          vsmbr_test_segments_image_data,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_segments_io_handle_initialize(
+	          &segments_io_handle,
+	          file_io_pool,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_segments_io_handle_get_segment_at_offset(
+	          segments_io_handle,
+	          0,
+	          &segment_index,
+	          &segment_offset,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_segments_io_handle_open(
+	          segments_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_segments_io_handle_get_segment_at_offset(
+	          segments_io_handle,
+	          0,
+	          &segment_index,
+	          &segment_offset,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "segment_index",
+	 segment_index,
+	 0 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "segment_offset",
+	 (int64_t) segment_offset,
+	 (int64_t) 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_segments_io_handle_get_segment_at_offset(
+	          segments_io_handle,
+	          50000,
+	          &segment_index,
+	          &segment_offset,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "segment_index",
+	 segment_index,
+	 0 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "segment_offset",
+	 (int64_t) segment_offset,
+	 (int64_t) 50000 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_segments_io_handle_get_segment_at_offset(
+	          segments_io_handle,
+	          50001,
+	          &segment_index,
+	          &segment_offset,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "segment_index",
+	 segment_index,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "segment_offset",
+	 (int64_t) segment_offset,
+	 (int64_t) 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_segments_io_handle_get_segment_at_offset(
+	          segments_io_handle,
+	          VSMBR_TEST_SEGMENTS_IMAGE_SIZE - 1,
+	          &segment_index,
+	          &segment_offset,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "segment_index",
+	 segment_index,
+	 2 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "segment_offset",
+	 (int64_t) segment_offset,
+	 (int64_t) 43838 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_segments_io_handle_get_segment_at_offset(
+	          segments_io_handle,
+	          VSMBR_TEST_SEGMENTS_IMAGE_SIZE,
+	          &segment_index,
+	          &segment_offset,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_segments_io_handle_get_segment_at_offset(
+	          NULL,
+	          0,
+	          &segment_index,
+	          &segment_offset,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_segments_io_handle_get_segment_at_offset(
+	          segments_io_handle,
+	          -1,
+	          &segment_index,
+	          &segment_offset,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_segments_io_handle_get_segment_at_offset(
+	          segments_io_handle,
+	          0,
+	          NULL,
+	          &segment_offset,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_segments_io_handle_get_segment_at_offset(
+	          segments_io_handle,
+	          0,
+	          &segment_index,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_segments_io_handle_close(
+	          segments_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_segments_io_handle_free(
+	          &segments_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segments_io_handle != NULL )
+	{
+		libvsmbr_segments_io_handle_free(
+		 &segments_io_handle,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_segments_io_handle_read and libvsmbr_segments_io_handle_write functions
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_segments_io_handle_read_write(
+     void )
+{
+	uint8_t buffer[ 4096 ];
+
+	libbfio_handle_t *handle     = NULL;
+	libbfio_pool_t *file_io_pool = NULL;
+	libcerror_error_t *error     = NULL;
+	uint8_t *read_data           = NULL;
+	size64_t size                = 0;
+	ssize_t read_count           = 0;
+	ssize_t write_count          = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	memory_copy(
+	 vsmbr_test_segments_image_data,
+	 vsmbr_test_segments_original_image_data,
+	 VSMBR_TEST_SEGMENTS_IMAGE_SIZE );
+
+	read_data = (uint8_t *) memory_allocate(
+	                         VSMBR_TEST_SEGMENTS_IMAGE_SIZE );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "read_data",
+	 read_data );
+
+	result = vsmbr_test_segments_initialize_file_io_pool(
+	          &file_io_pool,
+	          vsmbr_test_segments_image_data,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_segments_initialize(
+	          &handle,
+	          file_io_pool,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          handle,
+	          LIBBFIO_OPEN_READ_WRITE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_size(
+	          handle,
+	          &size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) VSMBR_TEST_SEGMENTS_IMAGE_SIZE );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a read of all the segments at once
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              read_data,
+	              VSMBR_TEST_SEGMENTS_IMAGE_SIZE,
+	              0,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) VSMBR_TEST_SEGMENTS_IMAGE_SIZE );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          read_data,
+	          vsmbr_test_segments_original_image_data,
+	          VSMBR_TEST_SEGMENTS_IMAGE_SIZE );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read that spans the boundary of the first and second segment
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              4096,
+	              48000,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4096 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( vsmbr_test_segments_original_image_data[ 48000 ] ),
+	          4096 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read that is truncated at the end of the last segment
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              4096,
+	              VSMBR_TEST_SEGMENTS_IMAGE_SIZE - 1024,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1024 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              4096,
+	              VSMBR_TEST_SEGMENTS_IMAGE_SIZE,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a write that spans the boundary of the second and third segment
+	 */
+	memory_set(
+	 buffer,
+	 0x5a,
+	 4096 );
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               handle,
+	               buffer,
+	               4096,
+	               118000,
+	               &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 4096 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 &( vsmbr_test_segments_original_image_data[ 118000 ] ),
+	 0x5a,
+	 4096 );
+
+	result = memory_compare(
+	          vsmbr_test_segments_image_data,
+	          vsmbr_test_segments_original_image_data,
+	          VSMBR_TEST_SEGMENTS_IMAGE_SIZE );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              read_data,
+	              VSMBR_TEST_SEGMENTS_IMAGE_SIZE,
+	              0,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) VSMBR_TEST_SEGMENTS_IMAGE_SIZE );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          read_data,
+	          vsmbr_test_segments_original_image_data,
+	          VSMBR_TEST_SEGMENTS_IMAGE_SIZE );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a write that is truncated at the end of the last segment
+	 */
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               handle,
+	               buffer,
+	               4096,
+	               VSMBR_TEST_SEGMENTS_IMAGE_SIZE - 1024,
+	               &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 1024 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Restore the test image data
+	 */
+	result = vsmbr_test_image_fill(
+	          vsmbr_test_segments_original_image_data,
+	          VSMBR_TEST_SEGMENTS_IMAGE_SIZE,
+	          1,
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_close(
+	          handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 read_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( read_data != NULL )
+	{
+		memory_free(
+		 read_data );
+	}
+	vsmbr_test_image_fill(
+	 vsmbr_test_segments_original_image_data,
+	 VSMBR_TEST_SEGMENTS_IMAGE_SIZE,
+	 1,
+	 0,
+	 NULL );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+/* Tests the libvsmbr_volume_open_multiple function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_volume_open_multiple(
+     void )
+{
+	char *filenames[ 2 ] = {
+		"vsmbr_test_segments_missing.001",
+		NULL };
+
+	libcerror_error_t *error  = NULL;
+	libvsmbr_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libvsmbr_volume_initialize(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_volume_open_multiple(
+	          NULL,
+	          filenames,
+	          1,
+	          LIBVSMBR_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_volume_open_multiple(
+	          volume,
+	          NULL,
+	          1,
+	          LIBVSMBR_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_volume_open_multiple(
+	          volume,
+	          filenames,
+	          0,
+	          LIBVSMBR_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_volume_open_multiple(
+	          volume,
+	          filenames,
+	          1,
+	          -1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_volume_open_multiple(
+	          volume,
+	          filenames,
+	          2,
+	          LIBVSMBR_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_volume_open_multiple(
+	          volume,
+	          filenames,
+	          1,
+	          LIBVSMBR_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_volume_free(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libvsmbr_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_volume_open_file_io_pool function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_volume_open_file_io_pool(
+     void )
+{
+	uint8_t buffer[ 4096 ];
+
+	libbfio_pool_t *file_io_pool    = NULL;
+	libcerror_error_t *error        = NULL;
+	FILE *file_stream               = NULL;
+	libvsmbr_partition_t *partition = NULL;
+	libvsmbr_volume_t *volume       = NULL;
+	ssize_t read_count              = 0;
+	int number_of_partitions        = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	memory_copy(
+	 vsmbr_test_segments_image_data,
+	 vsmbr_test_segments_original_image_data,
+	 VSMBR_TEST_SEGMENTS_IMAGE_SIZE );
+
+	result = vsmbr_test_segments_initialize_file_io_pool(
+	          &file_io_pool,
+	          vsmbr_test_segments_image_data,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_initialize(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_volume_open_file_io_pool(
+	          volume,
+	          file_io_pool,
+	          LIBVSMBR_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_get_number_of_partitions(
+	          volume,
+	          &number_of_partitions,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_partitions",
+	 number_of_partitions,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_get_partition_by_index(
+	          volume,
+	          0,
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a read of partition data that spans segments
+	 */
+	read_count = libvsmbr_partition_read_buffer_at_offset(
+	              partition,
+	              buffer,
+	              4096,
+	              118000 - 512,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4096 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( vsmbr_test_segments_original_image_data[ 118000 ] ),
+	          4096 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libvsmbr_partition_read_buffer_at_offset(
+	              partition,
+	              buffer,
+	              4096,
+	              48000,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4096 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( vsmbr_test_segments_original_image_data[ 48512 ] ),
+	          4096 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+#if !defined( WINAPI ) || defined( __CYGWIN__ )
+
+	/* Test an export of the partition, the file IO handle of a split image
+	 * is not a file hence the data is copied using buffered reads
+	 */
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT8(
+	 "file_io_handle_is_file",
+	 ( (libvsmbr_internal_partition_t *) partition )->file_io_handle_is_file,
+	 0 );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+	file_stream = tmpfile();
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	result = libvsmbr_partition_export_to_file_descriptor(
+	          partition,
+	          fileno( file_stream ),
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_compare_file_stream_with_data(
+	          file_stream,
+	          &( vsmbr_test_segments_original_image_data[ 512 ] ),
+	          VSMBR_TEST_SEGMENTS_IMAGE_SIZE - 512,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fclose(
+	          file_stream );
+
+	file_stream = NULL;
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+#endif /* !defined( WINAPI ) || defined( __CYGWIN__ ) */
+
+	result = libvsmbr_partition_free(
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_volume_open_file_io_pool(
+	          volume,
+	          file_io_pool,
+	          LIBVSMBR_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_volume_close(
+	          volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_open_file_io_pool(
+	          NULL,
+	          file_io_pool,
+	          LIBVSMBR_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_volume_open_file_io_pool(
+	          volume,
+	          NULL,
+	          LIBVSMBR_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_volume_free(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition != NULL )
+	{
+		libvsmbr_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libvsmbr_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( file_stream != NULL )
+	{
+		fclose(
+		 file_stream );
+	}
+	return( 0 );
+}
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argc )
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+	if( vsmbr_test_image_fill(
+	     vsmbr_test_segments_original_image_data,
+	     VSMBR_TEST_SEGMENTS_IMAGE_SIZE,
+	     1,
+	     0,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_segments_io_handle_initialize",
+	 vsmbr_test_segments_io_handle_initialize );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_segments_io_handle_free",
+	 vsmbr_test_segments_io_handle_free );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_segments_io_handle_get_segment_at_offset",
+	 vsmbr_test_segments_io_handle_get_segment_at_offset );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_segments_io_handle_read_write",
+	 vsmbr_test_segments_io_handle_read_write );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_volume_open_multiple",
+	 vsmbr_test_volume_open_multiple );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_volume_open_file_io_pool",
+	 vsmbr_test_volume_open_file_io_pool );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1787 @@
+/*
+ * Library sparse_map type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsmbr_test_functions.h"
+#include "vsmbr_test_image.h"
+#include "vsmbr_test_libbfio.h"
+#include "vsmbr_test_libcerror.h"
+#include "vsmbr_test_libvsmbr.h"
+#include "vsmbr_test_macros.h"
+#include "vsmbr_test_memory.h"
+#include "vsmbr_test_unused.h"
+
+#include "../libvsmbr/libvsmbr_sparse_map.h"
+
+/* The test image consists of a MBR with a single partition
+ * of 127 sectors starting at sector 1
+ */
+#define VSMBR_TEST_SPARSE_MAP_IMAGE_SIZE	65536
+#define VSMBR_TEST_SPARSE_MAP_PARTITION_SIZE	65024
+#define VSMBR_TEST_SPARSE_MAP_BLOCK_SIZE	4096
+
+uint8_t vsmbr_test_sparse_map_image_data[ VSMBR_TEST_SPARSE_MAP_IMAGE_SIZE ];
+
+/* Clears the sparse ranges of the test image data
+ * The partition data contains 0-byte values in the ranges:
+ * 8192 - 20479, 25088 - 28671 and 61440 - 65023
+ */
+void vsmbr_test_sparse_map_clear_ranges(
+      uint8_t *image_data )
+{
+	memory_set(
+	 &( image_data[ 512 + 8192 ] ),
+	 0,
+	 12288 );
+
+	memory_set(
+	 &( image_data[ 512 + 25088 ] ),
+	 0,
+	 3584 );
+
+	memory_set(
+	 &( image_data[ 512 + 61440 ] ),
+	 0,
+	 3584 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+/* Tests the libvsmbr_sparse_map_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_sparse_map_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libvsmbr_sparse_map_t *sparse_map = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_VSMBR_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 2;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_sparse_map_initialize(
+	          &sparse_map,
+	          VSMBR_TEST_SPARSE_MAP_BLOCK_SIZE,
+	          VSMBR_TEST_SPARSE_MAP_PARTITION_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "sparse_map",
+	 sparse_map );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_sparse_map_free(
+	          &sparse_map,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "sparse_map",
+	 sparse_map );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_sparse_map_initialize(
+	          NULL,
+	          VSMBR_TEST_SPARSE_MAP_BLOCK_SIZE,
+	          VSMBR_TEST_SPARSE_MAP_PARTITION_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sparse_map = (libvsmbr_sparse_map_t *) 0x12345678UL;
+
+	result = libvsmbr_sparse_map_initialize(
+	          &sparse_map,
+	          VSMBR_TEST_SPARSE_MAP_BLOCK_SIZE,
+	          VSMBR_TEST_SPARSE_MAP_PARTITION_SIZE,
+	          &error );
+
+	sparse_map = NULL;
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_sparse_map_initialize(
+	          &sparse_map,
+	          1000,
+	          VSMBR_TEST_SPARSE_MAP_PARTITION_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "sparse_map",
+	 sparse_map );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSMBR_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvsmbr_sparse_map_initialize with malloc failing
+		 */
+		vsmbr_test_malloc_attempts_before_fail = test_number;
+
+		result = libvsmbr_sparse_map_initialize(
+		          &sparse_map,
+		          VSMBR_TEST_SPARSE_MAP_BLOCK_SIZE,
+		          VSMBR_TEST_SPARSE_MAP_PARTITION_SIZE,
+		          &error );
+
+		if( vsmbr_test_malloc_attempts_before_fail != -1 )
+		{
+			vsmbr_test_malloc_attempts_before_fail = -1;
+
+			if( sparse_map != NULL )
+			{
+				libvsmbr_sparse_map_free(
+				 &sparse_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSMBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSMBR_TEST_ASSERT_IS_NULL(
+			 "sparse_map",
+			 sparse_map );
+
+			VSMBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvsmbr_sparse_map_initialize with memset failing
+		 */
+		vsmbr_test_memset_attempts_before_fail = test_number;
+
+		result = libvsmbr_sparse_map_initialize(
+		          &sparse_map,
+		          VSMBR_TEST_SPARSE_MAP_BLOCK_SIZE,
+		          VSMBR_TEST_SPARSE_MAP_PARTITION_SIZE,
+		          &error );
+
+		if( vsmbr_test_memset_attempts_before_fail != -1 )
+		{
+			vsmbr_test_memset_attempts_before_fail = -1;
+
+			if( sparse_map != NULL )
+			{
+				libvsmbr_sparse_map_free(
+				 &sparse_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSMBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSMBR_TEST_ASSERT_IS_NULL(
+			 "sparse_map",
+			 sparse_map );
+
+			VSMBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_VSMBR_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sparse_map != NULL )
+	{
+		libvsmbr_sparse_map_free(
+		 &sparse_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+/* Tests the libvsmbr_sparse_map_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_sparse_map_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvsmbr_sparse_map_free(
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+/* Tests the libvsmbr_sparse_map_data_is_zero function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_sparse_map_data_is_zero(
+     void )
+{
+	uint8_t data[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	int result               = 0;
+
+	memory_set(
+	 data,
+	 0,
+	 256 );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_sparse_map_data_is_zero(
+	          data,
+	          256,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with unaligned data
+	 */
+	result = libvsmbr_sparse_map_data_is_zero(
+	          &( data[ 3 ] ),
+	          250,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a non 0-byte value at every position
+	 */
+	for( data_offset = 0;
+	     data_offset < 256;
+	     data_offset++ )
+	{
+		data[ data_offset ] = 0x01;
+
+		result = libvsmbr_sparse_map_data_is_zero(
+		          data,
+		          256,
+		          &error );
+
+		data[ data_offset ] = 0x00;
+
+		VSMBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		VSMBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libvsmbr_sparse_map_data_is_zero(
+	          data,
+	          0,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_sparse_map_data_is_zero(
+	          NULL,
+	          256,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_sparse_map_data_is_zero(
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_sparse_map_append_range function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_sparse_map_append_range(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libvsmbr_sparse_map_t *sparse_map = NULL;
+	size64_t range_size               = 0;
+	size64_t sparse_size              = 0;
+	off64_t range_offset              = 0;
+	int number_of_ranges              = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libvsmbr_sparse_map_initialize(
+	          &sparse_map,
+	          VSMBR_TEST_SPARSE_MAP_BLOCK_SIZE,
+	          VSMBR_TEST_SPARSE_MAP_PARTITION_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "sparse_map",
+	 sparse_map );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_sparse_map_append_range(
+	          sparse_map,
+	          4096,
+	          4096,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if an adjacent range is merged
+	 */
+	result = libvsmbr_sparse_map_append_range(
+	          sparse_map,
+	          8192,
+	          4096,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_sparse_map_append_range(
+	          sparse_map,
+	          20480,
+	          4096,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_sparse_map_get_number_of_ranges(
+	          sparse_map,
+	          &number_of_ranges,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 2 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_sparse_map_get_range_by_index(
+	          sparse_map,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 4096 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 (uint64_t) range_size,
+	 (uint64_t) 8192 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_sparse_map_get_sparse_size(
+	          sparse_map,
+	          &sparse_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "sparse_size",
+	 (uint64_t) sparse_size,
+	 (uint64_t) 12288 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_sparse_map_get_range_at_offset(
+	          sparse_map,
+	          10000,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 4096 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_sparse_map_get_range_at_offset(
+	          sparse_map,
+	          24575,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 20480 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_sparse_map_get_range_at_offset(
+	          sparse_map,
+	          12288,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_sparse_map_get_range_at_offset(
+	          sparse_map,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_sparse_map_append_range(
+	          NULL,
+	          32768,
+	          4096,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a range that overlaps with the last range
+	 */
+	result = libvsmbr_sparse_map_append_range(
+	          sparse_map,
+	          16384,
+	          8192,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a range that exceeds the data size
+	 */
+	result = libvsmbr_sparse_map_append_range(
+	          sparse_map,
+	          61440,
+	          4096,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_sparse_map_get_range_by_index(
+	          sparse_map,
+	          2,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_sparse_map_free(
+	          &sparse_map,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "sparse_map",
+	 sparse_map );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sparse_map != NULL )
+	{
+		libvsmbr_sparse_map_free(
+		 &sparse_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+/* Tests the libvsmbr_partition_get_sparse_map function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_partition_get_sparse_map(
+     void )
+{
+	uint8_t buffer[ 512 ];
+
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	libvsmbr_partition_t *partition   = NULL;
+	libvsmbr_sparse_map_t *sparse_map = NULL;
+	libvsmbr_statistics_t *statistics = NULL;
+	libvsmbr_volume_t *volume         = NULL;
+	size64_t range_size               = 0;
+	size64_t sparse_size              = 0;
+	ssize_t read_count                = 0;
+	off64_t range_offset              = 0;
+	uint64_t value_64bit              = 0;
+	uint32_t block_size               = 0;
+	int number_of_ranges              = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = vsmbr_test_open_file_io_handle(
+	          &file_io_handle,
+	          vsmbr_test_sparse_map_image_data,
+	          VSMBR_TEST_SPARSE_MAP_IMAGE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_initialize(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBVSMBR_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_get_partition_by_index(
+	          volume,
+	          0,
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_partition_get_sparse_map(
+	          partition,
+	          VSMBR_TEST_SPARSE_MAP_BLOCK_SIZE,
+	          &sparse_map,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "sparse_map",
+	 sparse_map );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The scan reads the data directly and does not fill the sector cache
+	 */
+	result = libvsmbr_partition_get_statistics(
+	          partition,
+	          &statistics,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_statistics_get_backing_bytes_read(
+	          statistics,
+	          &value_64bit,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "backing_bytes_read",
+	 value_64bit,
+	 (uint64_t) VSMBR_TEST_SPARSE_MAP_PARTITION_SIZE );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_statistics_get_number_of_cache_misses(
+	          statistics,
+	          &value_64bit,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_cache_misses",
+	 value_64bit,
+	 (uint64_t) 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_statistics_free(
+	          &statistics,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_sparse_map_get_block_size(
+	          sparse_map,
+	          &block_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "block_size",
+	 block_size,
+	 (uint32_t) VSMBR_TEST_SPARSE_MAP_BLOCK_SIZE );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The range 25088 - 28671 does not cover a whole 4096 bytes block
+	 */
+	result = libvsmbr_sparse_map_get_number_of_ranges(
+	          sparse_map,
+	          &number_of_ranges,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 2 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_sparse_map_get_range_by_index(
+	          sparse_map,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 8192 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 (uint64_t) range_size,
+	 (uint64_t) 12288 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_sparse_map_get_range_by_index(
+	          sparse_map,
+	          1,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 61440 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 (uint64_t) range_size,
+	 (uint64_t) 3584 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_sparse_map_free(
+	          &sparse_map,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a smaller block size
+	 */
+	result = libvsmbr_partition_get_sparse_map(
+	          partition,
+	          512,
+	          &sparse_map,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "sparse_map",
+	 sparse_map );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_sparse_map_get_number_of_ranges(
+	          sparse_map,
+	          &number_of_ranges,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 3 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_sparse_map_get_sparse_size(
+	          sparse_map,
+	          &sparse_size,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "sparse_size",
+	 (uint64_t) sparse_size,
+	 (uint64_t) 19456 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_sparse_map_free(
+	          &sparse_map,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if reading a sparse range and the data around it is unaffected
+	 */
+	read_count = libvsmbr_partition_read_buffer_at_offset(
+	              partition,
+	              buffer,
+	              512,
+	              8192 - 256,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( vsmbr_test_sparse_map_image_data[ 512 + 8192 - 256 ] ),
+	          512 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_partition_get_sparse_map(
+	          NULL,
+	          VSMBR_TEST_SPARSE_MAP_BLOCK_SIZE,
+	          &sparse_map,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_partition_get_sparse_map(
+	          partition,
+	          VSMBR_TEST_SPARSE_MAP_BLOCK_SIZE,
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_partition_get_sparse_map(
+	          partition,
+	          1000,
+	          &sparse_map,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "sparse_map",
+	 sparse_map );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_partition_free(
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_close(
+	          volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_free(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( statistics != NULL )
+	{
+		libvsmbr_statistics_free(
+		 &statistics,
+		 NULL );
+	}
+	if( sparse_map != NULL )
+	{
+		libvsmbr_sparse_map_free(
+		 &sparse_map,
+		 NULL );
+	}
+	if( partition != NULL )
+	{
+		libvsmbr_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libvsmbr_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_partition_get_sparse_map function with a cache arena
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_partition_get_sparse_map_with_cache_arena(
+     void )
+{
+	uint8_t buffer[ 512 ];
+
+	libbfio_handle_t *file_io_handle    = NULL;
+	libcerror_error_t *error            = NULL;
+	libvsmbr_cache_arena_t *cache_arena = NULL;
+	libvsmbr_partition_t *partition     = NULL;
+	libvsmbr_sparse_map_t *sparse_map   = NULL;
+	libvsmbr_statistics_t *statistics   = NULL;
+	libvsmbr_volume_t *volume           = NULL;
+	ssize_t read_count                  = 0;
+	uint64_t value_64bit                = 0;
+	int number_of_blocks                = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libvsmbr_cache_arena_initialize(
+	          &cache_arena,
+	          1024 * 1024,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_open_file_io_handle(
+	          &file_io_handle,
+	          vsmbr_test_sparse_map_image_data,
+	          VSMBR_TEST_SPARSE_MAP_IMAGE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_initialize(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_set_cache_arena(
+	          volume,
+	          cache_arena,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBVSMBR_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_get_partition_by_index(
+	          volume,
+	          0,
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_partition_get_sparse_map(
+	          partition,
+	          VSMBR_TEST_SPARSE_MAP_BLOCK_SIZE,
+	          &sparse_map,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "sparse_map",
+	 sparse_map );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The sectors of the 12 blocks that are not sparse are added to the cache arena
+	 */
+	result = libvsmbr_cache_arena_get_number_of_blocks(
+	          cache_arena,
+	          &number_of_blocks,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_blocks",
+	 number_of_blocks,
+	 12 * ( VSMBR_TEST_SPARSE_MAP_BLOCK_SIZE / 512 ) );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A read of the data that was scanned is served by the cache arena
+	 */
+	read_count = libvsmbr_partition_read_buffer_at_offset(
+	              partition,
+	              buffer,
+	              512,
+	              0,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( vsmbr_test_sparse_map_image_data[ 512 ] ),
+	          512 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libvsmbr_partition_get_statistics(
+	          partition,
+	          &statistics,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_statistics_get_backing_bytes_read(
+	          statistics,
+	          &value_64bit,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "backing_bytes_read",
+	 value_64bit,
+	 (uint64_t) VSMBR_TEST_SPARSE_MAP_PARTITION_SIZE );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_statistics_get_number_of_cache_misses(
+	          statistics,
+	          &value_64bit,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_cache_misses",
+	 value_64bit,
+	 (uint64_t) 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_statistics_free(
+	          &statistics,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_sparse_map_free(
+	          &sparse_map,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_partition_free(
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_close(
+	          volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_free(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_cache_arena_free(
+	          &cache_arena,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( statistics != NULL )
+	{
+		libvsmbr_statistics_free(
+		 &statistics,
+		 NULL );
+	}
+	if( sparse_map != NULL )
+	{
+		libvsmbr_sparse_map_free(
+		 &sparse_map,
+		 NULL );
+	}
+	if( partition != NULL )
+	{
+		libvsmbr_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libvsmbr_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( cache_arena != NULL )
+	{
+		libvsmbr_cache_arena_free(
+		 &cache_arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argc )
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+	if( vsmbr_test_image_fill(
+	     vsmbr_test_sparse_map_image_data,
+	     VSMBR_TEST_SPARSE_MAP_IMAGE_SIZE,
+	     1,
+	     0,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	vsmbr_test_sparse_map_clear_ranges(
+	 vsmbr_test_sparse_map_image_data );
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_sparse_map_initialize",
+	 vsmbr_test_sparse_map_initialize );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_sparse_map_free",
+	 vsmbr_test_sparse_map_free );
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_sparse_map_data_is_zero",
+	 vsmbr_test_sparse_map_data_is_zero );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_sparse_map_append_range",
+	 vsmbr_test_sparse_map_append_range );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_partition_get_sparse_map",
+	 vsmbr_test_partition_get_sparse_map );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_partition_get_sparse_map_with_cache_arena",
+	 vsmbr_test_partition_get_sparse_map_with_cache_arena );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1376 @@
+/*
+ * Library trace type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "vsmbr_test_functions.h"
+#include "vsmbr_test_image.h"
+#include "vsmbr_test_libbfio.h"
+#include "vsmbr_test_libcerror.h"
+#include "vsmbr_test_libvsmbr.h"
+#include "vsmbr_test_macros.h"
+#include "vsmbr_test_memory.h"
+#include "vsmbr_test_unused.h"
+
+#include "../libvsmbr/libvsmbr_trace.h"
+
+/* The test image consists of a MBR with a single partition
+ * of 127 sectors starting at sector 1
+ */
+#define VSMBR_TEST_TRACE_IMAGE_SIZE	65536
+
+/* The size of the trace file data, which fits the file header and 127 records
+ */
+#define VSMBR_TEST_TRACE_FILE_SIZE	4096
+
+uint8_t vsmbr_test_trace_image_data[ VSMBR_TEST_TRACE_IMAGE_SIZE ];
+
+/* Checks a record in the trace file data
+ * Returns 1 if the record matches, 0 if not
+ */
+int vsmbr_test_trace_check_record(
+     const uint8_t *trace_data,
+     int record_index,
+     uint8_t record_type,
+     uint32_t partition_index,
+     uint64_t offset,
+     uint32_t size )
+{
+	const uint8_t *record_data = NULL;
+	uint64_t value_64bit       = 0;
+	uint32_t value_32bit       = 0;
+
+	record_data = &( trace_data[ 32 + ( record_index * 32 ) ] );
+
+	if( record_data[ 28 ] != record_type )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 &( record_data[ 8 ] ),
+	 value_64bit );
+
+	if( value_64bit != offset )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( record_data[ 16 ] ),
+	 value_32bit );
+
+	if( value_32bit != size )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( record_data[ 24 ] ),
+	 value_32bit );
+
+	if( value_32bit != partition_index )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+/* Tests the libvsmbr_trace_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_trace_initialize(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libvsmbr_trace_t *trace  = NULL;
+	int result               = 0;
+
+#if defined( HAVE_VSMBR_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_trace_initialize(
+	          &trace,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "trace",
+	 trace );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_trace_free(
+	          &trace,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "trace",
+	 trace );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_trace_initialize(
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	trace = (libvsmbr_trace_t *) 0x12345678UL;
+
+	result = libvsmbr_trace_initialize(
+	          &trace,
+	          &error );
+
+	trace = NULL;
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_VSMBR_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvsmbr_trace_initialize with malloc failing
+		 */
+		vsmbr_test_malloc_attempts_before_fail = test_number;
+
+		result = libvsmbr_trace_initialize(
+		          &trace,
+		          NULL,
+		          &error );
+
+		if( vsmbr_test_malloc_attempts_before_fail != -1 )
+		{
+			vsmbr_test_malloc_attempts_before_fail = -1;
+
+			if( trace != NULL )
+			{
+				libvsmbr_trace_free(
+				 &trace,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSMBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSMBR_TEST_ASSERT_IS_NULL(
+			 "trace",
+			 trace );
+
+			VSMBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libvsmbr_trace_initialize with memset failing
+		 */
+		vsmbr_test_memset_attempts_before_fail = test_number;
+
+		result = libvsmbr_trace_initialize(
+		          &trace,
+		          NULL,
+		          &error );
+
+		if( vsmbr_test_memset_attempts_before_fail != -1 )
+		{
+			vsmbr_test_memset_attempts_before_fail = -1;
+
+			if( trace != NULL )
+			{
+				libvsmbr_trace_free(
+				 &trace,
+				 NULL );
+			}
+		}
+		else
+		{
+			VSMBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			VSMBR_TEST_ASSERT_IS_NULL(
+			 "trace",
+			 trace );
+
+			VSMBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_VSMBR_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( trace != NULL )
+	{
+		libvsmbr_trace_free(
+		 &trace,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_trace_free function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_trace_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libvsmbr_trace_free(
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_trace_start and libvsmbr_trace_stop functions
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_trace_start(
+     void )
+{
+	uint8_t trace_data[ VSMBR_TEST_TRACE_FILE_SIZE ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libvsmbr_trace_t *trace          = NULL;
+	uint32_t value_32bit             = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 trace_data,
+	 0,
+	 VSMBR_TEST_TRACE_FILE_SIZE );
+
+	result = libvsmbr_trace_initialize(
+	          &trace,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          trace_data,
+	          VSMBR_TEST_TRACE_FILE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libvsmbr_trace_start(
+	          trace,
+	          file_io_handle,
+	          0,
+	          512,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          trace_data,
+	          "VSMBRTRC",
+	          8 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( trace_data[ 8 ] ),
+	 value_32bit );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "format_version",
+	 value_32bit,
+	 (uint32_t) 1 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( trace_data[ 12 ] ),
+	 value_32bit );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "record_size",
+	 value_32bit,
+	 (uint32_t) 32 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( trace_data[ 16 ] ),
+	 value_32bit );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT32(
+	 "bytes_per_sector",
+	 value_32bit,
+	 (uint32_t) 512 );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_trace_start(
+	          trace,
+	          file_io_handle,
+	          0,
+	          512,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_trace_stop(
+	          trace,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test stopping a trace that is not active
+	 */
+	result = libvsmbr_trace_stop(
+	          trace,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_trace_start(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          512,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_trace_start(
+	          trace,
+	          NULL,
+	          0,
+	          512,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_trace_stop(
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_trace_free(
+	          &trace,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( trace != NULL )
+	{
+		libvsmbr_trace_free(
+		 &trace,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libvsmbr_trace_append_record function
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_trace_append_record(
+     void )
+{
+	uint8_t trace_data[ VSMBR_TEST_TRACE_FILE_SIZE ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libvsmbr_trace_t *trace          = NULL;
+	uint64_t first_timestamp         = 0;
+	uint64_t second_timestamp        = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 trace_data,
+	 0,
+	 VSMBR_TEST_TRACE_FILE_SIZE );
+
+	result = libvsmbr_trace_initialize(
+	          &trace,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          trace_data,
+	          VSMBR_TEST_TRACE_FILE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * A record is not appended when the trace is not active
+	 */
+	result = libvsmbr_trace_append_record(
+	          trace,
+	          LIBVSMBR_TRACE_RECORD_TYPE_REQUEST,
+	          0,
+	          0,
+	          512,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT8(
+	 "trace_data[ 0 ]",
+	 trace_data[ 0 ],
+	 (uint8_t) 0 );
+
+	result = libvsmbr_trace_start(
+	          trace,
+	          file_io_handle,
+	          0,
+	          512,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_trace_append_record(
+	          trace,
+	          LIBVSMBR_TRACE_RECORD_TYPE_REQUEST,
+	          2,
+	          4096,
+	          8192,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_trace_append_record(
+	          trace,
+	          LIBVSMBR_TRACE_RECORD_TYPE_BACKING_READ,
+	          0xffffffffUL,
+	          0,
+	          512,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The records are buffered until the trace is stopped
+	 */
+	VSMBR_TEST_ASSERT_EQUAL_UINT8(
+	 "trace_data[ 32 + 28 ]",
+	 trace_data[ 32 + 28 ],
+	 (uint8_t) 0 );
+
+	result = libvsmbr_trace_stop(
+	          trace,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_trace_check_record(
+	          trace_data,
+	          0,
+	          LIBVSMBR_TRACE_RECORD_TYPE_REQUEST,
+	          2,
+	          4096,
+	          8192 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = vsmbr_test_trace_check_record(
+	          trace_data,
+	          1,
+	          LIBVSMBR_TRACE_RECORD_TYPE_BACKING_READ,
+	          0xffffffffUL,
+	          0,
+	          512 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( trace_data[ 32 ] ),
+	 first_timestamp );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( trace_data[ 64 ] ),
+	 second_timestamp );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "second_timestamp >= first_timestamp",
+	 (int) ( second_timestamp >= first_timestamp ),
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT8(
+	 "trace_data[ 96 + 28 ]",
+	 trace_data[ 96 + 28 ],
+	 (uint8_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_trace_append_record(
+	          NULL,
+	          LIBVSMBR_TRACE_RECORD_TYPE_REQUEST,
+	          0,
+	          0,
+	          512,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_trace_free(
+	          &trace,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( trace != NULL )
+	{
+		libvsmbr_trace_free(
+		 &trace,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+/* Tests the libvsmbr_volume_start_trace_file_io_handle and libvsmbr_volume_stop_trace functions
+ * Returns 1 if successful or 0 if not
+ */
+int vsmbr_test_volume_start_trace_file_io_handle(
+     void )
+{
+	uint8_t buffer[ 1024 ];
+	uint8_t trace_data[ VSMBR_TEST_TRACE_FILE_SIZE ];
+
+	libbfio_handle_t *file_io_handle  = NULL;
+	libbfio_handle_t *trace_io_handle = NULL;
+	libcerror_error_t *error          = NULL;
+	libvsmbr_partition_t *partition   = NULL;
+	libvsmbr_volume_t *volume         = NULL;
+	ssize_t read_count                = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 trace_data,
+	 0,
+	 VSMBR_TEST_TRACE_FILE_SIZE );
+
+	result = libbfio_memory_range_initialize(
+	          &trace_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          trace_io_handle,
+	          trace_data,
+	          VSMBR_TEST_TRACE_FILE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_open_file_io_handle(
+	          &file_io_handle,
+	          vsmbr_test_trace_image_data,
+	          VSMBR_TEST_TRACE_IMAGE_SIZE,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_initialize(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The trace is started before the volume is opened so that
+	 * the read of the master boot record is recorded
+	 */
+	result = libvsmbr_volume_start_trace_file_io_handle(
+	          volume,
+	          trace_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBVSMBR_OPEN_READ,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_get_partition_by_index(
+	          volume,
+	          0,
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The first read is a cache miss of 2 sectors
+	 */
+	read_count = libvsmbr_partition_read_buffer_at_offset(
+	              partition,
+	              buffer,
+	              1024,
+	              0,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1024 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The second read is served from the cache
+	 */
+	read_count = libvsmbr_partition_read_buffer_at_offset(
+	              partition,
+	              buffer,
+	              1024,
+	              0,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1024 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_stop_trace(
+	          volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Reads after the trace was stopped are not recorded
+	 */
+	read_count = libvsmbr_partition_read_buffer_at_offset(
+	              partition,
+	              buffer,
+	              1024,
+	              4096,
+	              &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1024 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          trace_data,
+	          "VSMBRTRC",
+	          8 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = vsmbr_test_trace_check_record(
+	          trace_data,
+	          0,
+	          LIBVSMBR_TRACE_RECORD_TYPE_BACKING_READ,
+	          0xffffffffUL,
+	          0,
+	          512 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = vsmbr_test_trace_check_record(
+	          trace_data,
+	          1,
+	          LIBVSMBR_TRACE_RECORD_TYPE_REQUEST,
+	          0,
+	          0,
+	          1024 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = vsmbr_test_trace_check_record(
+	          trace_data,
+	          2,
+	          LIBVSMBR_TRACE_RECORD_TYPE_BACKING_READ,
+	          0,
+	          512,
+	          512 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = vsmbr_test_trace_check_record(
+	          trace_data,
+	          3,
+	          LIBVSMBR_TRACE_RECORD_TYPE_BACKING_READ,
+	          0,
+	          1024,
+	          512 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = vsmbr_test_trace_check_record(
+	          trace_data,
+	          4,
+	          LIBVSMBR_TRACE_RECORD_TYPE_REQUEST,
+	          0,
+	          0,
+	          1024 );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_EQUAL_UINT8(
+	 "trace_data[ 32 + ( 5 * 32 ) + 28 ]",
+	 trace_data[ 32 + ( 5 * 32 ) + 28 ],
+	 (uint8_t) 0 );
+
+	/* Test stopping a trace that is not active
+	 */
+	result = libvsmbr_volume_stop_trace(
+	          volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libvsmbr_volume_start_trace_file_io_handle(
+	          NULL,
+	          trace_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libvsmbr_volume_stop_trace(
+	          NULL,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	VSMBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libvsmbr_partition_free(
+	          &partition,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_close(
+	          volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libvsmbr_volume_free(
+	          &volume,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = vsmbr_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &trace_io_handle,
+	          &error );
+
+	VSMBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	VSMBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition != NULL )
+	{
+		libvsmbr_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libvsmbr_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( trace_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &trace_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc VSMBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] VSMBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argc )
+	VSMBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+	if( vsmbr_test_image_fill(
+	     vsmbr_test_trace_image_data,
+	     VSMBR_TEST_TRACE_IMAGE_SIZE,
+	     1,
+	     0,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+
+#if defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_trace_initialize",
+	 vsmbr_test_trace_initialize );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_trace_free",
+	 vsmbr_test_trace_free );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_trace_start",
+	 vsmbr_test_trace_start );
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_trace_append_record",
+	 vsmbr_test_trace_append_record );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBVSMBR_DLL_IMPORT ) */
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	VSMBR_TEST_RUN(
+	 "libvsmbr_volume_start_trace_file_io_handle",
+	 vsmbr_test_volume_start_trace_file_io_handle );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
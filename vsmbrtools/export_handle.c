@@ -0,0 +1,2789 @@
+/*
+ * Export handle
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#endif
+
+#if defined( HAVE_TIME_H )
+#include <time.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "export_handle.h"
+#include "vsmbrtools_libbfio.h"
+#include "vsmbrtools_libcerror.h"
+#include "vsmbrtools_libcnotify.h"
+#include "vsmbrtools_libcthreads.h"
+#include "vsmbrtools_libvsmbr.h"
+#include "vsmbrtools_system_string.h"
+
+#define EXPORT_HANDLE_NOTIFY_STREAM			stdout
+
+#define EXPORT_HANDLE_CHUNK_SIZE			( 1024 * 1024 )
+
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS		32
+
+/* Creates an export target
+ * Make sure the value export_target is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_target_initialize(
+     export_target_t **export_target,
+     libcerror_error_t **error )
+{
+	static char *function = "export_target_initialize";
+
+	if( export_target == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export target.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_target != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export target value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*export_target = memory_allocate_structure(
+	                  export_target_t );
+
+	if( *export_target == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export target.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *export_target,
+	     0,
+	     sizeof( export_target_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export target.",
+		 function );
+
+		goto on_error;
+	}
+	( *export_target )->file_descriptor = -1;
+
+	return( 1 );
+
+on_error:
+	if( *export_target != NULL )
+	{
+		memory_free(
+		 *export_target );
+
+		*export_target = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an export target
+ * Returns 1 if successful or -1 on error
+ */
+int export_target_free(
+     export_target_t **export_target,
+     libcerror_error_t **error )
+{
+	static char *function = "export_target_free";
+	int result            = 1;
+
+	if( export_target == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export target.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_target != NULL )
+	{
+		if( ( *export_target )->partition != NULL )
+		{
+			if( libvsmbr_partition_free(
+			     &( ( *export_target )->partition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free partition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_target )->filename != NULL )
+		{
+			memory_free(
+			 ( *export_target )->filename );
+		}
+		memory_free(
+		 *export_target );
+
+		*export_target = NULL;
+	}
+	return( result );
+}
+
+/* Creates an export chunk
+ * Make sure the value export_chunk is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_chunk_initialize(
+     export_chunk_t **export_chunk,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "export_chunk_initialize";
+
+	if( export_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_chunk != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export chunk value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*export_chunk = memory_allocate_structure(
+	                 export_chunk_t );
+
+	if( *export_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export chunk.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *export_chunk,
+	     0,
+	     sizeof( export_chunk_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export chunk.",
+		 function );
+
+		goto on_error;
+	}
+	( *export_chunk )->data = (uint8_t *) memory_allocate(
+	                                       sizeof( uint8_t ) * data_size );
+
+	if( ( *export_chunk )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	( *export_chunk )->data_size = data_size;
+
+	return( 1 );
+
+on_error:
+	if( *export_chunk != NULL )
+	{
+		memory_free(
+		 *export_chunk );
+
+		*export_chunk = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an export chunk
+ * Returns 1 if successful or -1 on error
+ */
+int export_chunk_free(
+     export_chunk_t **export_chunk,
+     libcerror_error_t **error )
+{
+	static char *function = "export_chunk_free";
+
+	if( export_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_chunk != NULL )
+	{
+		if( ( *export_chunk )->data != NULL )
+		{
+			memory_free(
+			 ( *export_chunk )->data );
+		}
+		memory_free(
+		 *export_chunk );
+
+		*export_chunk = NULL;
+	}
+	return( 1 );
+}
+
+/* Creates an export handle
+ * Make sure the value export_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_initialize(
+     export_handle_t **export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_initialize";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*export_handle = memory_allocate_structure(
+	                  export_handle_t );
+
+	if( *export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *export_handle,
+	     0,
+	     sizeof( export_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_volume_initialize(
+	     &( ( *export_handle )->input_volume ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &( ( *export_handle )->input_file_io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *export_handle )->targets_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize targets mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *export_handle )->bytes_per_sector  = 512;
+	( *export_handle )->number_of_threads = 1;
+	( *export_handle )->notify_stream     = EXPORT_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *export_handle != NULL )
+	{
+		if( ( *export_handle )->input_file_io_handle != NULL )
+		{
+			libbfio_handle_free(
+			 &( ( *export_handle )->input_file_io_handle ),
+			 NULL );
+		}
+		if( ( *export_handle )->input_volume != NULL )
+		{
+			libvsmbr_volume_free(
+			 &( ( *export_handle )->input_volume ),
+			 NULL );
+		}
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an export handle
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_free(
+     export_handle_t **export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_free";
+	int result            = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_handle != NULL )
+	{
+		if( ( *export_handle )->input_volume != NULL )
+		{
+			if( libvsmbr_volume_free(
+			     &( ( *export_handle )->input_volume ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->input_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( ( *export_handle )->input_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( export_handle_free_targets(
+		     *export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free targets.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *export_handle )->targets_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *export_handle )->targets_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free targets mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the export handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_signal_abort(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_signal_abort";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->abort = 1;
+
+	if( export_handle->input_volume != NULL )
+	{
+		if( libvsmbr_volume_signal_abort(
+		     export_handle->input_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input handle to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the bytes per sector
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_bytes_per_sector(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_bytes_per_sector";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( vsmbrtools_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_64bit != 512 )
+	 && ( value_64bit != 1024 )
+	 && ( value_64bit != 2048 )
+	 && ( value_64bit != 4096 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unuspported bytes per sector value.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->bytes_per_sector = (off64_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the partition number
+ * The string "all" represents all partitions
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_partition_number(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_partition_number";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 3 )
+	 && ( system_string_compare(
+	       string,
+	       _SYSTEM_STRING( "all" ),
+	       3 ) == 0 ) )
+	{
+		export_handle->partition_number = 0;
+
+		return( 1 );
+	}
+	if( vsmbrtools_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > (uint64_t) INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported partition number value.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->partition_number = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the target path
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_target_path(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_target_path";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string == NULL )
+	 || ( string[ 0 ] == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->target_path = string;
+
+	return( 1 );
+}
+
+/* Sets the number of threads
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_number_of_threads";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( vsmbrtools_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > (uint64_t) EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of threads value.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( value_64bit > 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: multi-threading is not supported.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	export_handle->number_of_threads = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* Opens the input
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_input";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_volume_set_bytes_per_sector(
+	     export_handle->input_volume,
+	     export_handle->bytes_per_sector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set bytes per sector in input handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libvsmbr_volume_open_wide(
+	     export_handle->input_volume,
+	     filename,
+	     LIBVSMBR_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libvsmbr_volume_open(
+	     export_handle->input_volume,
+	     filename,
+	     LIBVSMBR_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The gaps between the partitions are read directly from the input file
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     export_handle->input_file_io_handle,
+	     filename,
+	     system_string_length(
+	      filename ),
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     export_handle->input_file_io_handle,
+	     filename,
+	     system_string_length(
+	      filename ),
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set input file IO handle filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_open(
+	     export_handle->input_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the input
+ * Returns the 0 if successful or -1 on error
+ */
+int export_handle_close_input(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_close_input";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_volume_close(
+	     export_handle->input_volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_close(
+	     export_handle->input_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Opens an output file
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_output(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     int *file_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_output";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) || ( defined( WINAPI ) && !defined( __CYGWIN__ ) )
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: exporting to a file is not supported on this platform.",
+	 function );
+
+	return( -1 );
+#else
+	*file_descriptor = open(
+	                    filename,
+	                    O_WRONLY | O_CREAT | O_TRUNC,
+	                    0644 );
+
+	if( *file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	return( 1 );
+#endif
+}
+
+/* Closes an output file
+ * Returns 0 if successful or -1 on error
+ */
+int export_handle_close_output(
+     export_handle_t *export_handle,
+     int *file_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_close_output";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) || ( defined( WINAPI ) && !defined( __CYGWIN__ ) )
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: exporting to a file is not supported on this platform.",
+	 function );
+
+	return( -1 );
+#else
+	if( close(
+	     *file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file.",
+		 function );
+
+		*file_descriptor = -1;
+
+		return( -1 );
+	}
+	*file_descriptor = -1;
+
+	return( 0 );
+#endif
+}
+
+/* Exports a partition to a file
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_partition(
+     export_handle_t *export_handle,
+     libvsmbr_partition_t *partition,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function   = "export_handle_export_partition";
+	size64_t partition_size = 0;
+	int file_descriptor     = -1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_partition_get_size(
+	     partition,
+	     &partition_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition size.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_open_output(
+	     export_handle,
+	     filename,
+	     &file_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output file.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 export_handle->notify_stream,
+	 "Exporting %" PRIu64 " bytes to: %" PRIs_SYSTEM "\n",
+	 partition_size,
+	 filename );
+
+	if( libvsmbr_partition_export_to_file_descriptor(
+	     partition,
+	     file_descriptor,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to export partition.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_close_output(
+	     export_handle,
+	     &file_descriptor,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close output file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_descriptor != -1 )
+	{
+		export_handle_close_output(
+		 export_handle,
+		 &file_descriptor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the current time in micro seconds
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_current_time(
+     int64_t *current_time,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_GETTIMEOFDAY )
+	struct timeval time_value;
+#else
+	time_t time_value     = 0;
+#endif
+
+	static char *function = "export_handle_get_current_time";
+
+	if( current_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_GETTIMEOFDAY )
+	if( gettimeofday(
+	     &time_value,
+	     NULL ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve time of day.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = ( (int64_t) time_value.tv_sec * 1000000 ) + (int64_t) time_value.tv_usec;
+#else
+	time_value = time(
+	              NULL );
+
+	if( time_value == (time_t) -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve time.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = (int64_t) time_value * 1000000;
+#endif
+	return( 1 );
+}
+
+/* Appends a target
+ * The target takes over the ownership of the partition when successful
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_append_target(
+     export_handle_t *export_handle,
+     libvsmbr_partition_t *partition,
+     int partition_number,
+     int gap_number,
+     off64_t volume_offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	export_target_t **targets      = NULL;
+	export_target_t *export_target = NULL;
+	static char *function          = "export_handle_append_target";
+	size_t filename_size           = 0;
+	int print_count                = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing target path.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->number_of_targets >= (int) ( INT_MAX / sizeof( export_target_t * ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export handle - number of targets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_target_initialize(
+	     &export_target,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create export target.",
+		 function );
+
+		goto on_error;
+	}
+	export_target->partition_number = partition_number;
+	export_target->gap_number       = gap_number;
+	export_target->volume_offset    = volume_offset;
+	export_target->size             = size;
+
+	/* The size of the target path, the separator, up to 10 digits, the gap prefix
+	 * and the end-of-string character
+	 */
+	filename_size = system_string_length(
+	                 export_handle->target_path ) + 15;
+
+	export_target->filename = system_string_allocate(
+	                           filename_size );
+
+	if( export_target->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		goto on_error;
+	}
+	/* Only a single partition without gaps is exported to the target path itself
+	 */
+	if( ( export_handle->partition_number != 0 )
+	 && ( export_handle->export_gaps == 0 ) )
+	{
+		print_count = system_string_sprintf(
+		               export_target->filename,
+		               filename_size,
+		               _SYSTEM_STRING( "%" ) _SYSTEM_STRING( PRIs_SYSTEM ),
+		               export_handle->target_path );
+	}
+	else if( partition_number != 0 )
+	{
+		print_count = system_string_sprintf(
+		               export_target->filename,
+		               filename_size,
+		               _SYSTEM_STRING( "%" ) _SYSTEM_STRING( PRIs_SYSTEM ) _SYSTEM_STRING( ".%d" ),
+		               export_handle->target_path,
+		               partition_number );
+	}
+	else
+	{
+		print_count = system_string_sprintf(
+		               export_target->filename,
+		               filename_size,
+		               _SYSTEM_STRING( "%" ) _SYSTEM_STRING( PRIs_SYSTEM ) _SYSTEM_STRING( ".gap%d" ),
+		               export_handle->target_path,
+		               gap_number );
+	}
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= filename_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename.",
+		 function );
+
+		goto on_error;
+	}
+	targets = (export_target_t **) memory_reallocate(
+	                                export_handle->targets,
+	                                sizeof( export_target_t * ) * ( export_handle->number_of_targets + 1 ) );
+
+	if( targets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize targets.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->targets = targets;
+
+	export_handle->targets[ export_handle->number_of_targets ] = export_target;
+
+	export_handle->number_of_targets += 1;
+
+	export_target->partition = partition;
+
+	return( 1 );
+
+on_error:
+	if( export_target != NULL )
+	{
+		export_target_free(
+		 &export_target,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees the targets
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_free_targets(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_free_targets";
+	int result            = 1;
+	int target_index      = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->targets != NULL )
+	{
+		for( target_index = 0;
+		     target_index < export_handle->number_of_targets;
+		     target_index++ )
+		{
+			if( export_handle->targets[ target_index ]->file_descriptor != -1 )
+			{
+				if( export_handle_close_output(
+				     export_handle,
+				     &( export_handle->targets[ target_index ]->file_descriptor ),
+				     error ) != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+					 "%s: unable to close target: %d.",
+					 function,
+					 target_index );
+
+					result = -1;
+				}
+			}
+			if( export_target_free(
+			     &( export_handle->targets[ target_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free target: %d.",
+				 function,
+				 target_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 export_handle->targets );
+
+		export_handle->targets = NULL;
+	}
+	export_handle->number_of_targets = 0;
+
+	return( result );
+}
+
+/* Builds the targets from the partitions and, if requested, the gaps between them
+ * The targets are sorted by volume offset
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_build_targets(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	export_target_t *export_target  = NULL;
+	libvsmbr_partition_t *partition = NULL;
+	off64_t *partition_offsets      = NULL;
+	size64_t *partition_sizes       = NULL;
+	static char *function           = "export_handle_build_targets";
+	size64_t partition_size         = 0;
+	size64_t volume_size            = 0;
+	off64_t partition_offset        = 0;
+	off64_t volume_offset           = 0;
+	int gap_number                  = 0;
+	int number_of_partitions        = 0;
+	int partition_index             = 0;
+	int sort_index                  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->targets != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - targets value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_volume_get_number_of_partitions(
+	     export_handle->input_volume,
+	     &number_of_partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of partitions.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->partition_number > number_of_partitions )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition number value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_partitions > 0 )
+	{
+		partition_offsets = (off64_t *) memory_allocate(
+		                                 sizeof( off64_t ) * number_of_partitions );
+
+		if( partition_offsets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create partition offsets.",
+			 function );
+
+			goto on_error;
+		}
+		partition_sizes = (size64_t *) memory_allocate(
+		                                sizeof( size64_t ) * number_of_partitions );
+
+		if( partition_sizes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create partition sizes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( partition_index = 0;
+	     partition_index < number_of_partitions;
+	     partition_index++ )
+	{
+		if( libvsmbr_volume_get_partition_by_index(
+		     export_handle->input_volume,
+		     partition_index,
+		     &partition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		if( libvsmbr_partition_get_volume_offset(
+		     partition,
+		     &partition_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d volume offset.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		if( libvsmbr_partition_get_size(
+		     partition,
+		     &partition_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d size.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		partition_offsets[ partition_index ] = partition_offset;
+		partition_sizes[ partition_index ]   = partition_size;
+
+		if( ( export_handle->partition_number == 0 )
+		 || ( export_handle->partition_number == ( partition_index + 1 ) ) )
+		{
+			if( export_handle_append_target(
+			     export_handle,
+			     partition,
+			     partition_index + 1,
+			     0,
+			     partition_offset,
+			     partition_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append partition: %d target.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+			/* The target takes over the ownership of the partition
+			 */
+			partition = NULL;
+		}
+		else if( libvsmbr_partition_free(
+		          &partition,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+	}
+	if( export_handle->export_gaps != 0 )
+	{
+		if( libbfio_handle_get_size(
+		     export_handle->input_file_io_handle,
+		     &volume_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume size.",
+			 function );
+
+			goto on_error;
+		}
+		/* Sort the partition ranges by offset, there are only a few partitions
+		 */
+		for( partition_index = 1;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			partition_offset = partition_offsets[ partition_index ];
+			partition_size   = partition_sizes[ partition_index ];
+
+			for( sort_index = partition_index;
+			     sort_index > 0;
+			     sort_index-- )
+			{
+				if( partition_offsets[ sort_index - 1 ] <= partition_offset )
+				{
+					break;
+				}
+				partition_offsets[ sort_index ] = partition_offsets[ sort_index - 1 ];
+				partition_sizes[ sort_index ]   = partition_sizes[ sort_index - 1 ];
+			}
+			partition_offsets[ sort_index ] = partition_offset;
+			partition_sizes[ sort_index ]   = partition_size;
+		}
+		/* A gap is a range of the volume that is not covered by any partition,
+		 * including the range that contains the boot record
+		 */
+		for( partition_index = 0;
+		     partition_index <= number_of_partitions;
+		     partition_index++ )
+		{
+			if( partition_index < number_of_partitions )
+			{
+				partition_offset = partition_offsets[ partition_index ];
+				partition_size   = partition_sizes[ partition_index ];
+			}
+			else
+			{
+				partition_offset = (off64_t) volume_size;
+				partition_size   = 0;
+			}
+			if( partition_offset > (off64_t) volume_size )
+			{
+				partition_offset = (off64_t) volume_size;
+			}
+			if( partition_offset > volume_offset )
+			{
+				gap_number++;
+
+				if( export_handle_append_target(
+				     export_handle,
+				     NULL,
+				     0,
+				     gap_number,
+				     volume_offset,
+				     (size64_t) ( partition_offset - volume_offset ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append gap: %d target.",
+					 function,
+					 gap_number );
+
+					goto on_error;
+				}
+			}
+			if( ( partition_offset + (off64_t) partition_size ) > volume_offset )
+			{
+				volume_offset = partition_offset + (off64_t) partition_size;
+			}
+		}
+	}
+	/* Sort the targets by volume offset
+	 */
+	for( partition_index = 1;
+	     partition_index < export_handle->number_of_targets;
+	     partition_index++ )
+	{
+		export_target = export_handle->targets[ partition_index ];
+
+		for( sort_index = partition_index;
+		     sort_index > 0;
+		     sort_index-- )
+		{
+			if( export_handle->targets[ sort_index - 1 ]->volume_offset <= export_target->volume_offset )
+			{
+				break;
+			}
+			export_handle->targets[ sort_index ] = export_handle->targets[ sort_index - 1 ];
+		}
+		export_handle->targets[ sort_index ] = export_target;
+	}
+	if( partition_sizes != NULL )
+	{
+		memory_free(
+		 partition_sizes );
+	}
+	if( partition_offsets != NULL )
+	{
+		memory_free(
+		 partition_offsets );
+	}
+	return( 1 );
+
+on_error:
+	if( partition != NULL )
+	{
+		libvsmbr_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( partition_sizes != NULL )
+	{
+		memory_free(
+		 partition_sizes );
+	}
+	if( partition_offsets != NULL )
+	{
+		memory_free(
+		 partition_offsets );
+	}
+	export_handle_free_targets(
+	 export_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Writes a chunk to its target
+ * Chunks that only contain 0-byte values are not written to regular files,
+ * which leaves a hole in the file
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_chunk(
+     export_handle_t *export_handle,
+     export_chunk_t *export_chunk,
+     libcerror_error_t **error )
+{
+	export_target_t *export_target = NULL;
+	static char *function          = "export_handle_write_chunk";
+	size_t data_offset             = 0;
+	int64_t current_time           = 0;
+	uint8_t is_sparse              = 0;
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && ( !defined( WINAPI ) || defined( __CYGWIN__ ) )
+	ssize_t write_count            = 0;
+#endif
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_chunk == NULL )
+	 || ( export_chunk->target == NULL )
+	 || ( export_chunk->data == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export chunk.",
+		 function );
+
+		return( -1 );
+	}
+	export_target = export_chunk->target;
+
+	if( export_target->is_regular_file != 0 )
+	{
+		if( ( export_chunk->data[ 0 ] == 0 )
+		 && ( memory_compare(
+		       export_chunk->data,
+		       &( export_chunk->data[ 1 ] ),
+		       export_chunk->data_size - 1 ) == 0 ) )
+		{
+			is_sparse = 1;
+		}
+	}
+	if( is_sparse == 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) || ( defined( WINAPI ) && !defined( __CYGWIN__ ) )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: exporting to a file is not supported on this platform.",
+		 function );
+
+		return( -1 );
+#else
+		while( data_offset < export_chunk->data_size )
+		{
+			write_count = pwrite(
+			               export_target->file_descriptor,
+			               &( export_chunk->data[ data_offset ] ),
+			               export_chunk->data_size - data_offset,
+			               (off_t) ( export_chunk->offset + data_offset ) );
+
+			if( write_count < 0 )
+			{
+				if( errno == EINTR )
+				{
+					continue;
+				}
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 errno,
+				 "%s: unable to write chunk at offset: %" PRIi64 " (0x%08" PRIx64 ") to: %" PRIs_SYSTEM ".",
+				 function,
+				 export_chunk->offset,
+				 export_chunk->offset,
+				 export_target->filename );
+
+				return( -1 );
+			}
+			else if( write_count == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write chunk at offset: %" PRIi64 " (0x%08" PRIx64 ") to: %" PRIs_SYSTEM ".",
+				 function,
+				 export_chunk->offset,
+				 export_chunk->offset,
+				 export_target->filename );
+
+				return( -1 );
+			}
+			data_offset += (size_t) write_count;
+		}
+#endif
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     export_handle->targets_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab targets mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	export_target->write_count += export_chunk->data_size;
+
+	if( export_target->write_count >= export_target->size )
+	{
+		if( export_handle_get_current_time(
+		     &current_time,
+		     NULL ) == 1 )
+		{
+			export_target->end_time = current_time;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     export_handle->targets_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release targets mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Callback function to write a chunk from a worker thread
+ * The callback takes over the ownership of the chunk
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_chunk_callback(
+     export_chunk_t *export_chunk,
+     export_handle_t *export_handle )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "export_handle_write_chunk_callback";
+	int result               = 1;
+
+	if( export_handle_write_chunk(
+	     export_handle,
+	     export_chunk,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write chunk.",
+		 function );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+
+		/* The reader checks this value before scheduling the next chunk
+		 */
+		if( export_handle != NULL )
+		{
+			export_handle->write_failed = 1;
+		}
+		result = -1;
+	}
+	if( export_chunk_free(
+	     &export_chunk,
+	     NULL ) != 1 )
+	{
+		result = -1;
+	}
+	return( result );
+}
+
+/* Exports the targets
+ * A single reader reads the chunks of all targets in order of volume offset,
+ * to prevent seeking back and forth on the input, and hands them to a bounded
+ * number of worker threads that write them to the targets concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_targets(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	export_chunk_t *export_chunk          = NULL;
+	export_target_t *export_target        = NULL;
+	static char *function                 = "export_handle_export_targets";
+	size_t read_size                      = 0;
+	ssize_t read_count                    = 0;
+	int64_t current_time                  = 0;
+	int target_index                      = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+#endif
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && ( !defined( WINAPI ) || defined( __CYGWIN__ ) )
+	struct stat file_statistics;
+#endif
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_build_targets(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build targets.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_get_current_time(
+	     &current_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		goto on_error;
+	}
+	for( target_index = 0;
+	     target_index < export_handle->number_of_targets;
+	     target_index++ )
+	{
+		export_target = export_handle->targets[ target_index ];
+
+		if( export_handle_open_output(
+		     export_handle,
+		     export_target->filename,
+		     &( export_target->file_descriptor ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open output file.",
+			 function );
+
+			goto on_error;
+		}
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && ( !defined( WINAPI ) || defined( __CYGWIN__ ) )
+		if( fstat(
+		     export_target->file_descriptor,
+		     &file_statistics ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 errno,
+			 "%s: unable to retrieve file statistics of: %" PRIs_SYSTEM ".",
+			 function,
+			 export_target->filename );
+
+			goto on_error;
+		}
+		if( S_ISREG( file_statistics.st_mode ) )
+		{
+			export_target->is_regular_file = 1;
+		}
+#endif
+		/* The start time is updated when the first chunk of the target is read
+		 */
+		export_target->start_time = current_time;
+		export_target->end_time   = current_time;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->number_of_threads > 1 )
+	{
+		/* The queue holds 2 chunks per thread, which bounds the memory used
+		 * by chunks that have been read but not yet written
+		 */
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     export_handle->number_of_threads,
+		     export_handle->number_of_threads * 2,
+		     (int (*)(intptr_t *, void *)) &export_handle_write_chunk_callback,
+		     (void *) export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	while( export_handle->abort == 0 )
+	{
+		if( export_handle->write_failed != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write chunk.",
+			 function );
+
+			goto on_error;
+		}
+		/* Schedule the remaining chunk with the lowest volume offset next
+		 */
+		export_target = NULL;
+
+		for( target_index = 0;
+		     target_index < export_handle->number_of_targets;
+		     target_index++ )
+		{
+			if( export_handle->targets[ target_index ]->read_offset >= export_handle->targets[ target_index ]->size )
+			{
+				continue;
+			}
+			if( ( export_target == NULL )
+			 || ( ( export_handle->targets[ target_index ]->volume_offset + (off64_t) export_handle->targets[ target_index ]->read_offset )
+			    < ( export_target->volume_offset + (off64_t) export_target->read_offset ) ) )
+			{
+				export_target = export_handle->targets[ target_index ];
+			}
+		}
+		if( export_target == NULL )
+		{
+			break;
+		}
+		read_size = EXPORT_HANDLE_CHUNK_SIZE;
+
+		if( (size64_t) read_size > ( export_target->size - export_target->read_offset ) )
+		{
+			read_size = (size_t) ( export_target->size - export_target->read_offset );
+		}
+		if( export_chunk == NULL )
+		{
+			if( export_chunk_initialize(
+			     &export_chunk,
+			     EXPORT_HANDLE_CHUNK_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create export chunk.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( export_target->partition != NULL )
+		{
+			read_count = libvsmbr_partition_read_buffer_at_offset(
+			              export_target->partition,
+			              export_chunk->data,
+			              read_size,
+			              (off64_t) export_target->read_offset,
+			              error );
+		}
+		else
+		{
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              export_handle->input_file_io_handle,
+			              export_chunk->data,
+			              read_size,
+			              export_target->volume_offset + (off64_t) export_target->read_offset,
+			              error );
+		}
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk at volume offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 export_target->volume_offset + (off64_t) export_target->read_offset,
+			 export_target->volume_offset + (off64_t) export_target->read_offset );
+
+			goto on_error;
+		}
+		if( export_target->read_offset == 0 )
+		{
+			if( export_handle_get_current_time(
+			     &( export_target->start_time ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve current time.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		export_chunk->target    = export_target;
+		export_chunk->offset    = (off64_t) export_target->read_offset;
+		export_chunk->data_size = read_size;
+
+		export_target->read_offset += read_size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) export_chunk,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push chunk onto thread pool queue.",
+				 function );
+
+				goto on_error;
+			}
+			/* The worker thread takes over the ownership of the chunk
+			 */
+			export_chunk = NULL;
+		}
+		else
+#endif
+		if( export_handle_write_chunk(
+		     export_handle,
+		     export_chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write chunk.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( export_handle->write_failed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write chunk.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_chunk != NULL )
+	{
+		if( export_chunk_free(
+		     &export_chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free export chunk.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( target_index = 0;
+	     target_index < export_handle->number_of_targets;
+	     target_index++ )
+	{
+		export_target = export_handle->targets[ target_index ];
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && ( !defined( WINAPI ) || defined( __CYGWIN__ ) )
+		/* Chunks that were not written at the end of a regular file are added as a hole
+		 */
+		if( ( export_handle->abort == 0 )
+		 && ( export_target->is_regular_file != 0 ) )
+		{
+			if( ftruncate(
+			     export_target->file_descriptor,
+			     (off_t) export_target->size ) != 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 errno,
+				 "%s: unable to set size of: %" PRIs_SYSTEM ".",
+				 function,
+				 export_target->filename );
+
+				goto on_error;
+			}
+		}
+#endif
+		if( export_handle_close_output(
+		     export_handle,
+		     &( export_target->file_descriptor ),
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close output file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	if( export_chunk != NULL )
+	{
+		export_chunk_free(
+		 &export_chunk,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the throughput of the exported targets
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_targets_fprint(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	export_target_t *export_target = NULL;
+	static char *function          = "export_handle_targets_fprint";
+	double elapsed_seconds         = 0.0;
+	int target_index               = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( target_index = 0;
+	     target_index < export_handle->number_of_targets;
+	     target_index++ )
+	{
+		export_target = export_handle->targets[ target_index ];
+
+		if( export_target->partition_number != 0 )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "Partition: %d\n",
+			 export_target->partition_number );
+		}
+		else
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "Gap: %d\n",
+			 export_target->gap_number );
+		}
+		fprintf(
+		 export_handle->notify_stream,
+		 "\tTarget\t\t\t: %" PRIs_SYSTEM "\n",
+		 export_target->filename );
+
+		fprintf(
+		 export_handle->notify_stream,
+		 "\tVolume offset\t\t: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 export_target->volume_offset,
+		 export_target->volume_offset );
+
+		fprintf(
+		 export_handle->notify_stream,
+		 "\tWritten\t\t\t: %" PRIu64 " of %" PRIu64 " bytes\n",
+		 export_target->write_count,
+		 export_target->size );
+
+		elapsed_seconds = (double) ( export_target->end_time - export_target->start_time ) / 1000000.0;
+
+		fprintf(
+		 export_handle->notify_stream,
+		 "\tDuration\t\t: %.3f seconds\n",
+		 elapsed_seconds );
+
+		if( elapsed_seconds > 0.0 )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "\tThroughput\t\t: %.1f MiB/s\n",
+			 ( (double) export_target->write_count / ( 1024.0 * 1024.0 ) ) / elapsed_seconds );
+		}
+		fprintf(
+		 export_handle->notify_stream,
+		 "\n" );
+	}
+	return( 1 );
+}
+
+/* Exports the partitions to files
+ * If all partitions are exported the partition number is appended to the target path
+ * If multiple threads are used or the gaps are exported the targets are exported concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_partitions(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	libvsmbr_partition_t *partition = NULL;
+	system_character_t *filename    = NULL;
+	static char *function           = "export_handle_export_partitions";
+	size_t filename_size            = 0;
+	int number_of_partitions        = 0;
+	int partition_index             = 0;
+	int print_count                 = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing target path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_handle->number_of_threads > 1 )
+	 || ( export_handle->export_gaps != 0 ) )
+	{
+		if( export_handle_export_targets(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export targets.",
+			 function );
+
+			return( -1 );
+		}
+		if( export_handle_targets_fprint(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print targets.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libvsmbr_volume_get_number_of_partitions(
+	     export_handle->input_volume,
+	     &number_of_partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of partitions.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->partition_number > number_of_partitions )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition number value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->partition_number == 0 )
+	{
+		/* The size of the target path, the separator, up to 10 digits and the end-of-string character
+		 */
+		filename_size = system_string_length(
+		                 export_handle->target_path ) + 12;
+
+		filename = system_string_allocate(
+		            filename_size );
+
+		if( filename == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create filename.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( partition_index = 0;
+	     partition_index < number_of_partitions;
+	     partition_index++ )
+	{
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
+		if( ( export_handle->partition_number != 0 )
+		 && ( export_handle->partition_number != ( partition_index + 1 ) ) )
+		{
+			continue;
+		}
+		if( filename != NULL )
+		{
+			print_count = system_string_sprintf(
+			               filename,
+			               filename_size,
+			               _SYSTEM_STRING( "%" ) _SYSTEM_STRING( PRIs_SYSTEM ) _SYSTEM_STRING( ".%d" ),
+			               export_handle->target_path,
+			               partition_index + 1 );
+
+			if( ( print_count < 0 )
+			 || ( (size_t) print_count >= filename_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set filename.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libvsmbr_volume_get_partition_by_index(
+		     export_handle->input_volume,
+		     partition_index,
+		     &partition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		if( export_handle_export_partition(
+		     export_handle,
+		     partition,
+		     ( filename != NULL ) ? filename : export_handle->target_path,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export partition: %d.",
+			 function,
+			 partition_index + 1 );
+
+			goto on_error;
+		}
+		if( libvsmbr_partition_free(
+		     &partition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+	}
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	return( 1 );
+
+on_error:
+	if( partition != NULL )
+	{
+		libvsmbr_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,293 @@
+/*
+ * Export handle
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXPORT_HANDLE_H )
+#define _EXPORT_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "vsmbrtools_libbfio.h"
+#include "vsmbrtools_libcerror.h"
+#include "vsmbrtools_libcthreads.h"
+#include "vsmbrtools_libvsmbr.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct export_target export_target_t;
+
+struct export_target
+{
+	/* The partition number, where 0 represents a gap
+	 */
+	int partition_number;
+
+	/* The gap number
+	 */
+	int gap_number;
+
+	/* The partition
+	 */
+	libvsmbr_partition_t *partition;
+
+	/* The volume offset
+	 */
+	off64_t volume_offset;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The filename
+	 */
+	system_character_t *filename;
+
+	/* The file descriptor
+	 */
+	int file_descriptor;
+
+	/* Value to indicate the file descriptor refers to a regular file
+	 */
+	uint8_t is_regular_file;
+
+	/* The offset of the next chunk to read
+	 */
+	size64_t read_offset;
+
+	/* The number of bytes written
+	 */
+	size64_t write_count;
+
+	/* The start time in micro seconds
+	 */
+	int64_t start_time;
+
+	/* The end time in micro seconds
+	 */
+	int64_t end_time;
+};
+
+typedef struct export_chunk export_chunk_t;
+
+struct export_chunk
+{
+	/* The target
+	 */
+	export_target_t *target;
+
+	/* The offset relative to the start of the target
+	 */
+	off64_t offset;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+typedef struct export_handle export_handle_t;
+
+struct export_handle
+{
+	/* The number of bytes per sector
+	 */
+	uint32_t bytes_per_sector;
+
+	/* The partition number, where 0 represents all partitions
+	 */
+	int partition_number;
+
+	/* The target path
+	 */
+	const system_character_t *target_path;
+
+	/* Value to indicate the gaps between the partitions should be exported
+	 */
+	uint8_t export_gaps;
+
+	/* The number of threads used to write the targets
+	 */
+	int number_of_threads;
+
+	/* The libvsmbr input volume
+	 */
+	libvsmbr_volume_t *input_volume;
+
+	/* The libbfio input file IO handle, used to read the gaps
+	 */
+	libbfio_handle_t *input_file_io_handle;
+
+	/* The targets
+	 */
+	export_target_t **targets;
+
+	/* The number of targets
+	 */
+	int number_of_targets;
+
+	/* Value to indicate writing a chunk failed
+	 */
+	int write_failed;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The targets mutex
+	 */
+	libcthreads_mutex_t *targets_mutex;
+#endif
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int export_target_initialize(
+     export_target_t **export_target,
+     libcerror_error_t **error );
+
+int export_target_free(
+     export_target_t **export_target,
+     libcerror_error_t **error );
+
+int export_chunk_initialize(
+     export_chunk_t **export_chunk,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int export_chunk_free(
+     export_chunk_t **export_chunk,
+     libcerror_error_t **error );
+
+int export_handle_initialize(
+     export_handle_t **export_handle,
+     libcerror_error_t **error );
+
+int export_handle_free(
+     export_handle_t **export_handle,
+     libcerror_error_t **error );
+
+int export_handle_signal_abort(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_set_bytes_per_sector(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_partition_number(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_target_path(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_open_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_close_input(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_open_output(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     int *file_descriptor,
+     libcerror_error_t **error );
+
+int export_handle_close_output(
+     export_handle_t *export_handle,
+     int *file_descriptor,
+     libcerror_error_t **error );
+
+int export_handle_export_partition(
+     export_handle_t *export_handle,
+     libvsmbr_partition_t *partition,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_get_current_time(
+     int64_t *current_time,
+     libcerror_error_t **error );
+
+int export_handle_append_target(
+     export_handle_t *export_handle,
+     libvsmbr_partition_t *partition,
+     int partition_number,
+     int gap_number,
+     off64_t volume_offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int export_handle_free_targets(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_build_targets(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_write_chunk(
+     export_handle_t *export_handle,
+     export_chunk_t *export_chunk,
+     libcerror_error_t **error );
+
+int export_handle_write_chunk_callback(
+     export_chunk_t *export_chunk,
+     export_handle_t *export_handle );
+
+int export_handle_export_targets(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_targets_fprint(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_export_partitions(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXPORT_HANDLE_H ) */
+
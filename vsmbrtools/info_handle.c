@@ -31,119 +31,10 @@
 #include "vsmbrtools_libcerror.h"
 #include "vsmbrtools_libclocale.h"
 #include "vsmbrtools_libvsmbr.h"
+#include "vsmbrtools_system_string.h"
 
 #define INFO_HANDLE_NOTIFY_STREAM	stdout
 
-/* Copies a string of a decimal value to a 64-bit value
- * Returns 1 if successful or -1 on error
- */
-int vsmbrtools_system_string_copy_from_64_bit_in_decimal(
-     const system_character_t *string,
-     size_t string_size,
-     uint64_t *value_64bit,
-     libcerror_error_t **error )
-{
-	static char *function              = "vsmbrtools_system_string_copy_from_64_bit_in_decimal";
-	size_t string_index                = 0;
-	system_character_t character_value = 0;
-	uint8_t maximum_string_index       = 20;
-	int8_t sign                        = 1;
-
-	if( string == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid string.",
-		 function );
-
-		return( -1 );
-	}
-	if( string_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid string size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( value_64bit == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value 64-bit.",
-		 function );
-
-		return( -1 );
-	}
-	*value_64bit = 0;
-
-	if( string[ string_index ] == (system_character_t) '-' )
-	{
-		string_index++;
-		maximum_string_index++;
-
-		sign = -1;
-	}
-	else if( string[ string_index ] == (system_character_t) '+' )
-	{
-		string_index++;
-		maximum_string_index++;
-	}
-	while( string_index < string_size )
-	{
-		if( string[ string_index ] == 0 )
-		{
-			break;
-		}
-		if( string_index > (size_t) maximum_string_index )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_LARGE,
-			 "%s: string too large.",
-			 function );
-
-			return( -1 );
-		}
-		*value_64bit *= 10;
-
-		if( ( string[ string_index ] >= (system_character_t) '0' )
-		 && ( string[ string_index ] <= (system_character_t) '9' ) )
-		{
-			character_value = (system_character_t) ( string[ string_index ] - (system_character_t) '0' );
-		}
-		else
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported character value: %" PRIc_SYSTEM " at index: %d.",
-			 function,
-			 string[ string_index ],
-			 string_index );
-
-			return( -1 );
-		}
-		*value_64bit += character_value;
-
-		string_index++;
-	}
-	if( sign == -1 )
-	{
-		*value_64bit *= (uint64_t) -1;
-	}
-	return( 1 );
-}
-
 /* Creates an info handle
  * Make sure the value info_handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
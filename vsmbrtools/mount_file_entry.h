@@ -0,0 +1,101 @@
+/*
+ * Mount file entry
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MOUNT_FILE_ENTRY_H )
+#define _MOUNT_FILE_ENTRY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "vsmbrtools_libbfio.h"
+#include "vsmbrtools_libcerror.h"
+#include "vsmbrtools_libvsmbr.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct mount_file_entry mount_file_entry_t;
+
+struct mount_file_entry
+{
+	/* The index
+	 */
+	int index;
+
+	/* The name
+	 */
+	char *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The partition, where NULL represents a gap
+	 */
+	libvsmbr_partition_t *partition;
+
+	/* The file IO handle, used to read a gap
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The volume offset
+	 */
+	off64_t volume_offset;
+
+	/* The size
+	 */
+	size64_t size;
+};
+
+int mount_file_entry_initialize(
+     mount_file_entry_t **file_entry,
+     int index,
+     const char *name,
+     size_t name_length,
+     libvsmbr_partition_t *partition,
+     libbfio_handle_t *file_io_handle,
+     off64_t volume_offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int mount_file_entry_free(
+     mount_file_entry_t **file_entry,
+     libcerror_error_t **error );
+
+int mount_file_entry_get_size(
+     mount_file_entry_t *file_entry,
+     size64_t *size,
+     libcerror_error_t **error );
+
+ssize_t mount_file_entry_read_buffer_at_offset(
+         mount_file_entry_t *file_entry,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MOUNT_FILE_ENTRY_H ) */
+
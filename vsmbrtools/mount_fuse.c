@@ -0,0 +1,933 @@
+/*
+ * Mount tool fuse functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "mount_file_entry.h"
+#include "mount_fuse.h"
+#include "mount_handle.h"
+#include "vsmbrtools_libcerror.h"
+#include "vsmbrtools_libcnotify.h"
+#include "vsmbrtools_unused.h"
+
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
+
+/* Sets the values in a stat info structure
+ * Returns 1 if successful or -1 on error
+ */
+int mount_fuse_set_stat_info(
+     struct stat *stat_info,
+     size64_t size,
+     int is_directory,
+     int64_t mount_time,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_fuse_set_stat_info";
+
+	if( stat_info == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stat info.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_directory != 0 )
+	{
+		stat_info->st_mode  = S_IFDIR | 0555;
+		stat_info->st_nlink = 2;
+	}
+	else
+	{
+		stat_info->st_mode  = S_IFREG | 0444;
+		stat_info->st_nlink = 1;
+		stat_info->st_size  = (off_t) size;
+	}
+#if defined( HAVE_GETEUID )
+	stat_info->st_uid = geteuid();
+#else
+	stat_info->st_uid = 0;
+#endif
+#if defined( HAVE_GETEGID )
+	stat_info->st_gid = getegid();
+#else
+	stat_info->st_gid = 0;
+#endif
+	stat_info->st_atime = (time_t) mount_time;
+	stat_info->st_mtime = (time_t) mount_time;
+	stat_info->st_ctime = (time_t) mount_time;
+
+	return( 1 );
+}
+
+/* Fills a directory entry
+ * Returns 1 if successful or -1 on error
+ */
+int mount_fuse_filldir(
+     void *buffer,
+     fuse_fill_dir_t filler,
+     const char *name,
+     struct stat *stat_info,
+     mount_file_entry_t *file_entry,
+     int64_t mount_time,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_fuse_filldir";
+	size64_t size         = 0;
+	int is_directory      = 1;
+
+	if( filler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filler.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry != NULL )
+	{
+		if( mount_file_entry_get_size(
+		     file_entry,
+		     &size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry size.",
+			 function );
+
+			return( -1 );
+		}
+		is_directory = 0;
+	}
+	if( memory_set(
+	     stat_info,
+	     0,
+	     sizeof( struct stat ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stat info.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_fuse_set_stat_info(
+	     stat_info,
+	     size,
+	     is_directory,
+	     mount_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set stat info.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFUSE3 )
+	if( filler(
+	     buffer,
+	     name,
+	     stat_info,
+	     0,
+	     0 ) == 1 )
+#else
+	if( filler(
+	     buffer,
+	     name,
+	     stat_info,
+	     0 ) == 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Initializes the file system
+ * Large reads and read-ahead are requested, since the mounted data does not change
+ * Returns the private data of the file system
+ */
+#if defined( HAVE_LIBFUSE3 )
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_information,
+       struct fuse_config *configuration )
+#else
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_information )
+#endif
+{
+	if( connection_information != NULL )
+	{
+		connection_information->max_readahead = MOUNT_FUSE_MAXIMUM_READ_SIZE;
+	}
+#if defined( HAVE_LIBFUSE3 )
+	if( configuration != NULL )
+	{
+		configuration->kernel_cache = 1;
+	}
+#endif
+	return( fuse_get_context()->private_data );
+}
+
+/* Opens a file or device
+ * Returns 0 if successful or a negative errno value otherwise
+ */
+int mount_fuse_open(
+     const char *path,
+     struct fuse_file_info *file_info )
+{
+	libcerror_error_t *error       = NULL;
+	mount_file_entry_t *file_entry = NULL;
+	mount_handle_t *mount_handle   = NULL;
+	static char *function          = "mount_fuse_open";
+	int result                     = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file info.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( ( file_info->flags & 0x03 ) != O_RDONLY )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		result = -EACCES;
+
+		goto on_error;
+	}
+	mount_handle = (mount_handle_t *) fuse_get_context()->private_data;
+
+	result = mount_handle_get_file_entry_by_path(
+	          mount_handle,
+	          path,
+	          &file_entry,
+	          &error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry for path: %s.",
+		 function,
+		 path );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		result = -ENOENT;
+
+		goto on_error;
+	}
+	/* The data of the file entry does not change while mounted
+	 * so the kernel page cache does not need to be invalidated on open
+	 */
+	file_info->fh         = (uint64_t) (intptr_t) file_entry;
+	file_info->keep_cache = 1;
+
+	return( 0 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Reads a buffer of data at the specified offset
+ * Returns number of bytes read if successful or a negative errno value otherwise
+ */
+int mount_fuse_read(
+     const char *path,
+     char *buffer,
+     size_t size,
+     off_t offset,
+     struct fuse_file_info *file_info )
+{
+	libcerror_error_t *error       = NULL;
+	mount_file_entry_t *file_entry = NULL;
+	mount_handle_t *mount_handle   = NULL;
+	static char *function          = "mount_fuse_read";
+	ssize_t read_count             = 0;
+	int result                     = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( size > (size_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file info.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info->fh == (uint64_t) NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file info - missing file handle.",
+		 function );
+
+		result = -EBADF;
+
+		goto on_error;
+	}
+	mount_handle = (mount_handle_t *) fuse_get_context()->private_data;
+	file_entry   = (mount_file_entry_t *) (intptr_t) file_info->fh;
+
+	read_count = mount_handle_read_buffer_at_offset(
+	              mount_handle,
+	              file_entry,
+	              (uint8_t *) buffer,
+	              size,
+	              (off64_t) offset,
+	              &error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file entry.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	return( (int) read_count );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Releases a file entry
+ * Returns 0 if successful or a negative errno value otherwise
+ */
+int mount_fuse_release(
+     const char *path,
+     struct fuse_file_info *file_info )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "mount_fuse_release";
+	int result               = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file info.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	/* The file entries are owned by the mount handle
+	 */
+	file_info->fh = (uint64_t) NULL;
+
+	return( 0 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Opens a directory
+ * Returns 0 if successful or a negative errno value otherwise
+ */
+int mount_fuse_opendir(
+     const char *path,
+     struct fuse_file_info *file_info VSMBRTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "mount_fuse_opendir";
+	int result               = 0;
+
+	VSMBRTOOLS_UNREFERENCED_PARAMETER( file_info )
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	/* The root directory is the only directory
+	 */
+	if( ( path[ 0 ] != '/' )
+	 || ( path[ 1 ] != 0 ) )
+	{
+		result = -ENOENT;
+
+		goto on_error;
+	}
+	return( 0 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Reads a directory
+ * Returns 0 if successful or a negative errno value otherwise
+ */
+#if defined( HAVE_LIBFUSE3 )
+int mount_fuse_readdir(
+     const char *path,
+     void *buffer,
+     fuse_fill_dir_t filler,
+     off_t offset VSMBRTOOLS_ATTRIBUTE_UNUSED,
+     struct fuse_file_info *file_info VSMBRTOOLS_ATTRIBUTE_UNUSED,
+     enum fuse_readdir_flags flags VSMBRTOOLS_ATTRIBUTE_UNUSED )
+#else
+int mount_fuse_readdir(
+     const char *path,
+     void *buffer,
+     fuse_fill_dir_t filler,
+     off_t offset VSMBRTOOLS_ATTRIBUTE_UNUSED,
+     struct fuse_file_info *file_info VSMBRTOOLS_ATTRIBUTE_UNUSED )
+#endif
+{
+	struct stat *stat_info         = NULL;
+	libcerror_error_t *error       = NULL;
+	mount_file_entry_t *file_entry = NULL;
+	mount_handle_t *mount_handle   = NULL;
+	static char *function          = "mount_fuse_readdir";
+	int file_entry_index           = 0;
+	int number_of_file_entries     = 0;
+	int result                     = 0;
+
+	VSMBRTOOLS_UNREFERENCED_PARAMETER( offset )
+	VSMBRTOOLS_UNREFERENCED_PARAMETER( file_info )
+
+#if defined( HAVE_LIBFUSE3 )
+	VSMBRTOOLS_UNREFERENCED_PARAMETER( flags )
+#endif
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( ( path[ 0 ] != '/' )
+	 || ( path[ 1 ] != 0 ) )
+	{
+		result = -ENOENT;
+
+		goto on_error;
+	}
+	mount_handle = (mount_handle_t *) fuse_get_context()->private_data;
+
+	stat_info = memory_allocate_structure(
+	             struct stat );
+
+	if( stat_info == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stat info.",
+		 function );
+
+		result = -ENOMEM;
+
+		goto on_error;
+	}
+	if( mount_fuse_filldir(
+	     buffer,
+	     filler,
+	     ".",
+	     stat_info,
+	     NULL,
+	     mount_handle->mount_time,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set self directory entry.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	if( mount_fuse_filldir(
+	     buffer,
+	     filler,
+	     "..",
+	     stat_info,
+	     NULL,
+	     mount_handle->mount_time,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set parent directory entry.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	if( mount_handle_get_number_of_file_entries(
+	     mount_handle,
+	     &number_of_file_entries,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file entries.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	for( file_entry_index = 0;
+	     file_entry_index < number_of_file_entries;
+	     file_entry_index++ )
+	{
+		if( mount_handle_get_file_entry_by_index(
+		     mount_handle,
+		     file_entry_index,
+		     &file_entry,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry: %d.",
+			 function,
+			 file_entry_index );
+
+			result = -EIO;
+
+			goto on_error;
+		}
+		if( mount_fuse_filldir(
+		     buffer,
+		     filler,
+		     file_entry->name,
+		     stat_info,
+		     file_entry,
+		     mount_handle->mount_time,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set directory entry: %d.",
+			 function,
+			 file_entry_index );
+
+			result = -EIO;
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 stat_info );
+
+	return( 0 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( stat_info != NULL )
+	{
+		memory_free(
+		 stat_info );
+	}
+	return( result );
+}
+
+/* Releases a directory
+ * Returns 0 if successful or a negative errno value otherwise
+ */
+int mount_fuse_releasedir(
+     const char *path,
+     struct fuse_file_info *file_info VSMBRTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "mount_fuse_releasedir";
+	int result               = 0;
+
+	VSMBRTOOLS_UNREFERENCED_PARAMETER( file_info )
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	return( 0 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Retrieves the file stat info
+ * Returns 0 if successful or a negative errno value otherwise
+ */
+#if defined( HAVE_LIBFUSE3 )
+int mount_fuse_getattr(
+     const char *path,
+     struct stat *stat_info,
+     struct fuse_file_info *file_info VSMBRTOOLS_ATTRIBUTE_UNUSED )
+#else
+int mount_fuse_getattr(
+     const char *path,
+     struct stat *stat_info )
+#endif
+{
+	libcerror_error_t *error       = NULL;
+	mount_file_entry_t *file_entry = NULL;
+	mount_handle_t *mount_handle   = NULL;
+	static char *function          = "mount_fuse_getattr";
+	size64_t size                  = 0;
+	int is_directory               = 0;
+	int result                     = -ENOENT;
+
+#if defined( HAVE_LIBFUSE3 )
+	VSMBRTOOLS_UNREFERENCED_PARAMETER( file_info )
+#endif
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( stat_info == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stat info.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( memory_set(
+	     stat_info,
+	     0,
+	     sizeof( struct stat ) ) == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stat info.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	mount_handle = (mount_handle_t *) fuse_get_context()->private_data;
+
+	if( ( path[ 0 ] == '/' )
+	 && ( path[ 1 ] == 0 ) )
+	{
+		is_directory = 1;
+	}
+	else
+	{
+		result = mount_handle_get_file_entry_by_path(
+		          mount_handle,
+		          path,
+		          &file_entry,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry for path: %s.",
+			 function,
+			 path );
+
+			result = -EIO;
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( -ENOENT );
+		}
+		if( mount_file_entry_get_size(
+		     file_entry,
+		     &size,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry size.",
+			 function );
+
+			result = -EIO;
+
+			goto on_error;
+		}
+	}
+	if( mount_fuse_set_stat_info(
+	     stat_info,
+	     size,
+	     is_directory,
+	     mount_handle->mount_time,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set stat info.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	return( 0 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE ) */
+
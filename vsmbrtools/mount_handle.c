@@ -0,0 +1,2021 @@
+/*
+ * Mount handle
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_TIME_H )
+#include <time.h>
+#endif
+
+#include "mount_file_entry.h"
+#include "mount_handle.h"
+#include "vsmbrtools_libbfio.h"
+#include "vsmbrtools_libcerror.h"
+#include "vsmbrtools_libcthreads.h"
+#include "vsmbrtools_libvsmbr.h"
+#include "vsmbrtools_system_string.h"
+
+#define MOUNT_HANDLE_NOTIFY_STREAM		stdout
+
+#define MOUNT_HANDLE_CACHE_BLOCK_SIZE		( 256 * 1024 )
+
+#define MOUNT_HANDLE_NUMBER_OF_CACHE_BLOCKS	64
+
+/* Creates a cache block
+ * Make sure the value cache_block is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int mount_cache_block_initialize(
+     mount_cache_block_t **cache_block,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_cache_block_initialize";
+
+	if( cache_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache block.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_block != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cache block value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*cache_block = memory_allocate_structure(
+	                mount_cache_block_t );
+
+	if( *cache_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache block.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *cache_block,
+	     0,
+	     sizeof( mount_cache_block_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache block.",
+		 function );
+
+		memory_free(
+		 *cache_block );
+
+		*cache_block = NULL;
+
+		return( -1 );
+	}
+	( *cache_block )->data = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * data_size );
+
+	if( ( *cache_block )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *cache_block )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *cache_block != NULL )
+	{
+		if( ( *cache_block )->data != NULL )
+		{
+			memory_free(
+			 ( *cache_block )->data );
+		}
+		memory_free(
+		 *cache_block );
+
+		*cache_block = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a cache block
+ * Returns 1 if successful or -1 on error
+ */
+int mount_cache_block_free(
+     mount_cache_block_t **cache_block,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_cache_block_free";
+	int result            = 1;
+
+	if( cache_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache block.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_block != NULL )
+	{
+		/* The file_entry reference is freed elsewhere
+		 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *cache_block )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 ( *cache_block )->data );
+
+		memory_free(
+		 *cache_block );
+
+		*cache_block = NULL;
+	}
+	return( result );
+}
+
+/* Creates a mount handle
+ * Make sure the value mount_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_initialize(
+     mount_handle_t **mount_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_initialize";
+	int cache_block_index = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mount_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mount handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*mount_handle = memory_allocate_structure(
+	                 mount_handle_t );
+
+	if( *mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create mount handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *mount_handle,
+	     0,
+	     sizeof( mount_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear mount handle.",
+		 function );
+
+		memory_free(
+		 *mount_handle );
+
+		*mount_handle = NULL;
+
+		return( -1 );
+	}
+	if( libvsmbr_volume_initialize(
+	     &( ( *mount_handle )->input_volume ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &( ( *mount_handle )->input_file_io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *mount_handle )->cache_blocks = (mount_cache_block_t **) memory_allocate(
+	                                                            sizeof( mount_cache_block_t * ) * MOUNT_HANDLE_NUMBER_OF_CACHE_BLOCKS );
+
+	if( ( *mount_handle )->cache_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache blocks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *mount_handle )->cache_blocks,
+	     0,
+	     sizeof( mount_cache_block_t * ) * MOUNT_HANDLE_NUMBER_OF_CACHE_BLOCKS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache blocks.",
+		 function );
+
+		goto on_error;
+	}
+	( *mount_handle )->number_of_cache_blocks = MOUNT_HANDLE_NUMBER_OF_CACHE_BLOCKS;
+
+	for( cache_block_index = 0;
+	     cache_block_index < MOUNT_HANDLE_NUMBER_OF_CACHE_BLOCKS;
+	     cache_block_index++ )
+	{
+		if( mount_cache_block_initialize(
+		     &( ( *mount_handle )->cache_blocks[ cache_block_index ] ),
+		     MOUNT_HANDLE_CACHE_BLOCK_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create cache block: %d.",
+			 function,
+			 cache_block_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *mount_handle )->statistics_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize statistics mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *mount_handle )->bytes_per_sector = 512;
+	( *mount_handle )->notify_stream    = MOUNT_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *mount_handle != NULL )
+	{
+		if( ( *mount_handle )->cache_blocks != NULL )
+		{
+			for( cache_block_index = 0;
+			     cache_block_index < ( *mount_handle )->number_of_cache_blocks;
+			     cache_block_index++ )
+			{
+				mount_cache_block_free(
+				 &( ( *mount_handle )->cache_blocks[ cache_block_index ] ),
+				 NULL );
+			}
+			memory_free(
+			 ( *mount_handle )->cache_blocks );
+		}
+		if( ( *mount_handle )->input_file_io_handle != NULL )
+		{
+			libbfio_handle_free(
+			 &( ( *mount_handle )->input_file_io_handle ),
+			 NULL );
+		}
+		if( ( *mount_handle )->input_volume != NULL )
+		{
+			libvsmbr_volume_free(
+			 &( ( *mount_handle )->input_volume ),
+			 NULL );
+		}
+		memory_free(
+		 *mount_handle );
+
+		*mount_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a mount handle
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_free(
+     mount_handle_t **mount_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_free";
+	int cache_block_index = 0;
+	int result            = 1;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mount_handle != NULL )
+	{
+		if( mount_handle_free_file_entries(
+		     *mount_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entries.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *mount_handle )->input_volume != NULL )
+		{
+			if( libvsmbr_volume_free(
+			     &( ( *mount_handle )->input_volume ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input volume.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *mount_handle )->input_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( ( *mount_handle )->input_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *mount_handle )->cache_blocks != NULL )
+		{
+			for( cache_block_index = 0;
+			     cache_block_index < ( *mount_handle )->number_of_cache_blocks;
+			     cache_block_index++ )
+			{
+				if( mount_cache_block_free(
+				     &( ( *mount_handle )->cache_blocks[ cache_block_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free cache block: %d.",
+					 function,
+					 cache_block_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *mount_handle )->cache_blocks );
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *mount_handle )->statistics_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *mount_handle )->statistics_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free statistics mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		memory_free(
+		 *mount_handle );
+
+		*mount_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the mount handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_signal_abort(
+     mount_handle_t *mount_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_signal_abort";
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	mount_handle->abort = 1;
+
+	if( mount_handle->input_volume != NULL )
+	{
+		if( libvsmbr_volume_signal_abort(
+		     mount_handle->input_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input volume to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the bytes per sector
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_set_bytes_per_sector(
+     mount_handle_t *mount_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_set_bytes_per_sector";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( vsmbrtools_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_64bit != 512 )
+	 && ( value_64bit != 1024 )
+	 && ( value_64bit != 2048 )
+	 && ( value_64bit != 4096 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported bytes per sector value.",
+		 function );
+
+		return( -1 );
+	}
+	mount_handle->bytes_per_sector = (uint32_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Opens the mount handle
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_open(
+     mount_handle_t *mount_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_open";
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_volume_set_bytes_per_sector(
+	     mount_handle->input_volume,
+	     mount_handle->bytes_per_sector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set bytes per sector in input volume.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libvsmbr_volume_open_wide(
+	     mount_handle->input_volume,
+	     filename,
+	     LIBVSMBR_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libvsmbr_volume_open(
+	     mount_handle->input_volume,
+	     filename,
+	     LIBVSMBR_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input volume.",
+		 function );
+
+		goto on_error;
+	}
+	/* The gaps between the partitions are read directly from the input file
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     mount_handle->input_file_io_handle,
+	     filename,
+	     system_string_length(
+	      filename ),
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     mount_handle->input_file_io_handle,
+	     filename,
+	     system_string_length(
+	      filename ),
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set input file IO handle filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     mount_handle->input_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( mount_handle_build_file_entries(
+	     mount_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build file entries.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_TIME_H )
+	mount_handle->mount_time = (int64_t) time(
+	                                      NULL );
+#endif
+	return( 1 );
+
+on_error:
+	libbfio_handle_close(
+	 mount_handle->input_file_io_handle,
+	 NULL );
+	libvsmbr_volume_close(
+	 mount_handle->input_volume,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Closes the mount handle
+ * Returns the 0 if successful or -1 on error
+ */
+int mount_handle_close(
+     mount_handle_t *mount_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_close";
+	int result            = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The file entries reference the partitions and must be freed before the volume is closed
+	 */
+	if( mount_handle_free_file_entries(
+	     mount_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file entries.",
+		 function );
+
+		result = -1;
+	}
+	if( libvsmbr_volume_close(
+	     mount_handle->input_volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input volume.",
+		 function );
+
+		result = -1;
+	}
+	if( libbfio_handle_close(
+	     mount_handle->input_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Appends a file entry
+ * Partitions are named p1, p2, etc. and gaps are named gap1, gap2, etc.
+ * The file entry takes over the ownership of the partition when successful
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_append_file_entry(
+     mount_handle_t *mount_handle,
+     libvsmbr_partition_t *partition,
+     int partition_number,
+     int gap_number,
+     off64_t volume_offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	char name[ 16 ];
+
+	mount_file_entry_t **file_entries = NULL;
+	mount_file_entry_t *file_entry    = NULL;
+	static char *function             = "mount_handle_append_file_entry";
+	int print_count                   = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_handle->number_of_file_entries >= (int) ( INT_MAX / sizeof( mount_file_entry_t * ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid mount handle - number of file entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_number != 0 )
+	{
+		print_count = narrow_string_snprintf(
+		               name,
+		               16,
+		               "p%d",
+		               partition_number );
+	}
+	else
+	{
+		print_count = narrow_string_snprintf(
+		               name,
+		               16,
+		               "gap%d",
+		               gap_number );
+	}
+	if( ( print_count < 0 )
+	 || ( print_count >= 16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name.",
+		 function );
+
+		goto on_error;
+	}
+	if( mount_file_entry_initialize(
+	     &file_entry,
+	     mount_handle->number_of_file_entries,
+	     name,
+	     (size_t) print_count,
+	     partition,
+	     mount_handle->input_file_io_handle,
+	     volume_offset,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file entry.",
+		 function );
+
+		goto on_error;
+	}
+	file_entries = (mount_file_entry_t **) memory_reallocate(
+	                                        mount_handle->file_entries,
+	                                        sizeof( mount_file_entry_t * ) * ( mount_handle->number_of_file_entries + 1 ) );
+
+	if( file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize file entries.",
+		 function );
+
+		goto on_error;
+	}
+	mount_handle->file_entries = file_entries;
+
+	mount_handle->file_entries[ mount_handle->number_of_file_entries ] = file_entry;
+
+	mount_handle->number_of_file_entries += 1;
+
+	return( 1 );
+
+on_error:
+	if( file_entry != NULL )
+	{
+		/* The partition remains owned by the caller on error
+		 */
+		file_entry->partition = NULL;
+
+		mount_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees the file entries
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_free_file_entries(
+     mount_handle_t *mount_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_free_file_entries";
+	int cache_block_index = 0;
+	int file_entry_index  = 0;
+	int result            = 1;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the cache blocks no longer reference the file entries
+	 */
+	for( cache_block_index = 0;
+	     cache_block_index < mount_handle->number_of_cache_blocks;
+	     cache_block_index++ )
+	{
+		if( mount_handle->cache_blocks[ cache_block_index ] != NULL )
+		{
+			mount_handle->cache_blocks[ cache_block_index ]->file_entry = NULL;
+		}
+	}
+	if( mount_handle->file_entries != NULL )
+	{
+		for( file_entry_index = 0;
+		     file_entry_index < mount_handle->number_of_file_entries;
+		     file_entry_index++ )
+		{
+			if( mount_file_entry_free(
+			     &( mount_handle->file_entries[ file_entry_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file entry: %d.",
+				 function,
+				 file_entry_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 mount_handle->file_entries );
+
+		mount_handle->file_entries = NULL;
+	}
+	mount_handle->number_of_file_entries = 0;
+
+	return( result );
+}
+
+/* Builds the file entries from the partitions and, if requested, the gaps between them
+ * Logical partitions in an extended partition are exposed the same as primary partitions
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_build_file_entries(
+     mount_handle_t *mount_handle,
+     libcerror_error_t **error )
+{
+	libvsmbr_partition_t *partition = NULL;
+	off64_t *partition_offsets      = NULL;
+	size64_t *partition_sizes       = NULL;
+	static char *function           = "mount_handle_build_file_entries";
+	size64_t partition_size         = 0;
+	size64_t volume_size            = 0;
+	off64_t partition_offset        = 0;
+	off64_t volume_offset           = 0;
+	int gap_number                  = 0;
+	int number_of_partitions        = 0;
+	int partition_index             = 0;
+	int sort_index                  = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_handle->file_entries != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mount handle - file entries value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libvsmbr_volume_get_number_of_partitions(
+	     mount_handle->input_volume,
+	     &number_of_partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of partitions.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_partitions > 0 )
+	{
+		partition_offsets = (off64_t *) memory_allocate(
+		                                 sizeof( off64_t ) * number_of_partitions );
+
+		if( partition_offsets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create partition offsets.",
+			 function );
+
+			goto on_error;
+		}
+		partition_sizes = (size64_t *) memory_allocate(
+		                                sizeof( size64_t ) * number_of_partitions );
+
+		if( partition_sizes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create partition sizes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( partition_index = 0;
+	     partition_index < number_of_partitions;
+	     partition_index++ )
+	{
+		if( libvsmbr_volume_get_partition_by_index(
+		     mount_handle->input_volume,
+		     partition_index,
+		     &partition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		if( libvsmbr_partition_get_volume_offset(
+		     partition,
+		     &partition_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d volume offset.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		if( libvsmbr_partition_get_size(
+		     partition,
+		     &partition_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d size.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		partition_offsets[ partition_index ] = partition_offset;
+		partition_sizes[ partition_index ]   = partition_size;
+
+		if( mount_handle_append_file_entry(
+		     mount_handle,
+		     partition,
+		     partition_index + 1,
+		     0,
+		     partition_offset,
+		     partition_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append partition: %d file entry.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		/* The file entry takes over the ownership of the partition
+		 */
+		partition = NULL;
+	}
+	if( mount_handle->expose_gaps != 0 )
+	{
+		if( libbfio_handle_get_size(
+		     mount_handle->input_file_io_handle,
+		     &volume_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume size.",
+			 function );
+
+			goto on_error;
+		}
+		/* Sort the partition ranges by offset, there are only a few partitions
+		 */
+		for( partition_index = 1;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			partition_offset = partition_offsets[ partition_index ];
+			partition_size   = partition_sizes[ partition_index ];
+
+			for( sort_index = partition_index;
+			     sort_index > 0;
+			     sort_index-- )
+			{
+				if( partition_offsets[ sort_index - 1 ] <= partition_offset )
+				{
+					break;
+				}
+				partition_offsets[ sort_index ] = partition_offsets[ sort_index - 1 ];
+				partition_sizes[ sort_index ]   = partition_sizes[ sort_index - 1 ];
+			}
+			partition_offsets[ sort_index ] = partition_offset;
+			partition_sizes[ sort_index ]   = partition_size;
+		}
+		/* A gap is a range of the volume that is not covered by any partition,
+		 * including the ranges that contain the boot records
+		 */
+		for( partition_index = 0;
+		     partition_index <= number_of_partitions;
+		     partition_index++ )
+		{
+			if( partition_index < number_of_partitions )
+			{
+				partition_offset = partition_offsets[ partition_index ];
+				partition_size   = partition_sizes[ partition_index ];
+			}
+			else
+			{
+				partition_offset = (off64_t) volume_size;
+				partition_size   = 0;
+			}
+			if( partition_offset > (off64_t) volume_size )
+			{
+				partition_offset = (off64_t) volume_size;
+			}
+			if( partition_offset > volume_offset )
+			{
+				gap_number++;
+
+				if( mount_handle_append_file_entry(
+				     mount_handle,
+				     NULL,
+				     0,
+				     gap_number,
+				     volume_offset,
+				     (size64_t) ( partition_offset - volume_offset ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append gap: %d file entry.",
+					 function,
+					 gap_number );
+
+					goto on_error;
+				}
+			}
+			if( ( partition_offset + (off64_t) partition_size ) > volume_offset )
+			{
+				volume_offset = partition_offset + (off64_t) partition_size;
+			}
+		}
+	}
+	if( partition_sizes != NULL )
+	{
+		memory_free(
+		 partition_sizes );
+	}
+	if( partition_offsets != NULL )
+	{
+		memory_free(
+		 partition_offsets );
+	}
+	return( 1 );
+
+on_error:
+	if( partition != NULL )
+	{
+		libvsmbr_partition_free(
+		 &partition,
+		 NULL );
+	}
+	if( partition_sizes != NULL )
+	{
+		memory_free(
+		 partition_sizes );
+	}
+	if( partition_offsets != NULL )
+	{
+		memory_free(
+		 partition_offsets );
+	}
+	mount_handle_free_file_entries(
+	 mount_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the number of file entries
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_get_number_of_file_entries(
+     mount_handle_t *mount_handle,
+     int *number_of_file_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_get_number_of_file_entries";
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of file entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_file_entries = mount_handle->number_of_file_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific file entry
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_get_file_entry_by_index(
+     mount_handle_t *mount_handle,
+     int file_entry_index,
+     mount_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_get_file_entry_by_index";
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_entry_index < 0 )
+	 || ( file_entry_index >= mount_handle->number_of_file_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	*file_entry = mount_handle->file_entries[ file_entry_index ];
+
+	return( 1 );
+}
+
+/* Retrieves the file entry for a specific path
+ * The path is relative to the mount point and starts with a path separator
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int mount_handle_get_file_entry_by_path(
+     mount_handle_t *mount_handle,
+     const char *path,
+     mount_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_get_file_entry_by_path";
+	size_t path_length    = 0;
+	int file_entry_index  = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( path[ 0 ] != '/' )
+	{
+		return( 0 );
+	}
+	path_length = narrow_string_length(
+	               &( path[ 1 ] ) );
+
+	for( file_entry_index = 0;
+	     file_entry_index < mount_handle->number_of_file_entries;
+	     file_entry_index++ )
+	{
+		if( ( path_length + 1 ) != mount_handle->file_entries[ file_entry_index ]->name_size )
+		{
+			continue;
+		}
+		if( narrow_string_compare(
+		     &( path[ 1 ] ),
+		     mount_handle->file_entries[ file_entry_index ]->name,
+		     path_length ) == 0 )
+		{
+			*file_entry = mount_handle->file_entries[ file_entry_index ];
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Reads data of a file entry at a specific offset
+ * The data is read in cache block sized parts, where each cache block has its own lock
+ * so that concurrent reads of different parts of the volume do not block each other
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t mount_handle_read_buffer_at_offset(
+         mount_handle_t *mount_handle,
+         mount_file_entry_t *file_entry,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	mount_cache_block_t *cache_block = NULL;
+	static char *function            = "mount_handle_read_buffer_at_offset";
+	size64_t block_index             = 0;
+	size_t buffer_offset             = 0;
+	size_t data_offset               = 0;
+	size_t read_size                 = 0;
+	ssize_t read_count               = 0;
+	off64_t block_offset             = 0;
+	int cache_block_index            = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_handle->number_of_cache_blocks <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid mount handle - missing cache blocks.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= file_entry->size )
+	{
+		buffer_size = 0;
+	}
+	else if( (size64_t) buffer_size > ( file_entry->size - (size64_t) offset ) )
+	{
+		buffer_size = (size_t) ( file_entry->size - (size64_t) offset );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		block_index  = (size64_t) offset / MOUNT_HANDLE_CACHE_BLOCK_SIZE;
+		block_offset = (off64_t) ( block_index * MOUNT_HANDLE_CACHE_BLOCK_SIZE );
+
+		/* Spread the blocks of different file entries over the cache
+		 */
+		cache_block_index = (int) ( ( block_index + ( (size64_t) file_entry->index * 7919 ) ) % mount_handle->number_of_cache_blocks );
+
+		cache_block = mount_handle->cache_blocks[ cache_block_index ];
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     cache_block->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab cache block: %d mutex.",
+			 function,
+			 cache_block_index );
+
+			return( -1 );
+		}
+#endif
+		if( ( cache_block->file_entry == file_entry )
+		 && ( cache_block->offset == block_offset ) )
+		{
+			cache_block->number_of_hits += 1;
+		}
+		else
+		{
+			cache_block->number_of_misses += 1;
+			cache_block->file_entry        = NULL;
+
+			read_size = MOUNT_HANDLE_CACHE_BLOCK_SIZE;
+
+			if( (size64_t) read_size > ( file_entry->size - (size64_t) block_offset ) )
+			{
+				read_size = (size_t) ( file_entry->size - (size64_t) block_offset );
+			}
+			read_count = mount_file_entry_read_buffer_at_offset(
+			              file_entry,
+			              cache_block->data,
+			              read_size,
+			              block_offset,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read cache block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 block_offset,
+				 block_offset );
+
+				goto on_error;
+			}
+			cache_block->file_entry = file_entry;
+			cache_block->offset     = block_offset;
+			cache_block->data_size  = read_size;
+		}
+		data_offset = (size_t) ( offset - block_offset );
+		read_size   = cache_block->data_size - data_offset;
+
+		if( read_size > ( buffer_size - buffer_offset ) )
+		{
+			read_size = buffer_size - buffer_offset;
+		}
+		if( memory_copy(
+		     &( buffer[ buffer_offset ] ),
+		     &( cache_block->data[ data_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy cache block data.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     cache_block->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release cache block: %d mutex.",
+			 function,
+			 cache_block_index );
+
+			return( -1 );
+		}
+#endif
+		offset        += read_size;
+		buffer_offset += read_size;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     mount_handle->statistics_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab statistics mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	mount_handle->number_of_read_requests += 1;
+	mount_handle->number_of_bytes_read    += buffer_offset;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     mount_handle->statistics_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release statistics mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( (ssize_t) buffer_offset );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 cache_block->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Prints the read and cache statistics of the mount handle and the volume
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_statistics_fprint(
+     mount_handle_t *mount_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	libvsmbr_statistics_t *statistics  = NULL;
+	static char *function              = "mount_handle_statistics_fprint";
+	uint64_t backing_bytes_read        = 0;
+	uint64_t bytes_delivered           = 0;
+	uint64_t io_wait_time              = 0;
+	uint64_t number_of_backing_reads   = 0;
+	uint64_t number_of_cache_evictions = 0;
+	uint64_t number_of_cache_hits      = 0;
+	uint64_t number_of_cache_misses    = 0;
+	uint64_t number_of_hits            = 0;
+	uint64_t number_of_misses          = 0;
+	int cache_block_index              = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	for( cache_block_index = 0;
+	     cache_block_index < mount_handle->number_of_cache_blocks;
+	     cache_block_index++ )
+	{
+		number_of_hits   += mount_handle->cache_blocks[ cache_block_index ]->number_of_hits;
+		number_of_misses += mount_handle->cache_blocks[ cache_block_index ]->number_of_misses;
+	}
+	fprintf(
+	 stream,
+	 "Statistics:\n" );
+
+	fprintf(
+	 stream,
+	 "\tRead requests\t\t: %" PRIu64 "\n",
+	 mount_handle->number_of_read_requests );
+
+	fprintf(
+	 stream,
+	 "\tBytes read\t\t: %" PRIu64 "\n",
+	 mount_handle->number_of_bytes_read );
+
+	fprintf(
+	 stream,
+	 "\tCache hits\t\t: %" PRIu64 "\n",
+	 number_of_hits );
+
+	fprintf(
+	 stream,
+	 "\tCache misses\t\t: %" PRIu64 "\n",
+	 number_of_misses );
+
+	if( ( number_of_hits + number_of_misses ) > 0 )
+	{
+		fprintf(
+		 stream,
+		 "\tCache hit rate\t\t: %.1f %%\n",
+		 ( (double) number_of_hits * 100.0 ) / (double) ( number_of_hits + number_of_misses ) );
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+
+	if( mount_handle->input_volume == NULL )
+	{
+		return( 1 );
+	}
+	/* The statistics of the volume include the reads of the storage media
+	 * and the sector cache of the library underneath the cache blocks
+	 */
+	if( libvsmbr_volume_get_statistics(
+	     mount_handle->input_volume,
+	     &statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_statistics_get_number_of_backing_reads(
+	     statistics,
+	     &number_of_backing_reads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of backing reads.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_statistics_get_backing_bytes_read(
+	     statistics,
+	     &backing_bytes_read,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve backing bytes read.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_statistics_get_bytes_delivered(
+	     statistics,
+	     &bytes_delivered,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bytes delivered.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_statistics_get_number_of_cache_hits(
+	     statistics,
+	     &number_of_cache_hits,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sector cache hits.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_statistics_get_number_of_cache_misses(
+	     statistics,
+	     &number_of_cache_misses,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sector cache misses.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_statistics_get_number_of_cache_evictions(
+	     statistics,
+	     &number_of_cache_evictions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sector cache evictions.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_statistics_get_io_wait_time(
+	     statistics,
+	     &io_wait_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve IO wait time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libvsmbr_statistics_free(
+	     &statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume statistics.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 stream,
+	 "Volume statistics:\n" );
+
+	fprintf(
+	 stream,
+	 "\tBacking reads\t\t: %" PRIu64 "\n",
+	 number_of_backing_reads );
+
+	fprintf(
+	 stream,
+	 "\tBacking bytes read\t: %" PRIu64 "\n",
+	 backing_bytes_read );
+
+	fprintf(
+	 stream,
+	 "\tBytes delivered\t\t: %" PRIu64 "\n",
+	 bytes_delivered );
+
+	fprintf(
+	 stream,
+	 "\tSector cache hits\t: %" PRIu64 "\n",
+	 number_of_cache_hits );
+
+	fprintf(
+	 stream,
+	 "\tSector cache misses\t: %" PRIu64 "\n",
+	 number_of_cache_misses );
+
+	fprintf(
+	 stream,
+	 "\tSector cache evictions\t: %" PRIu64 "\n",
+	 number_of_cache_evictions );
+
+	fprintf(
+	 stream,
+	 "\tIO wait time\t\t: %" PRIu64 " ms\n",
+	 io_wait_time / 1000000 );
+
+	fprintf(
+	 stream,
+	 "\n" );
+
+	return( 1 );
+
+on_error:
+	if( statistics != NULL )
+	{
+		libvsmbr_statistics_free(
+		 &statistics,
+		 NULL );
+	}
+	return( -1 );
+}
+
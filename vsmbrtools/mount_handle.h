@@ -0,0 +1,224 @@
+/*
+ * Mount handle
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MOUNT_HANDLE_H )
+#define _MOUNT_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "mount_file_entry.h"
+#include "vsmbrtools_libbfio.h"
+#include "vsmbrtools_libcerror.h"
+#include "vsmbrtools_libcthreads.h"
+#include "vsmbrtools_libvsmbr.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct mount_cache_block mount_cache_block_t;
+
+struct mount_cache_block
+{
+	/* The file entry of the cached data
+	 */
+	mount_file_entry_t *file_entry;
+
+	/* The offset of the cached data relative to the start of the file entry
+	 */
+	off64_t offset;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The number of cache hits
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of cache misses
+	 */
+	uint64_t number_of_misses;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+typedef struct mount_handle mount_handle_t;
+
+struct mount_handle
+{
+	/* The number of bytes per sector
+	 */
+	uint32_t bytes_per_sector;
+
+	/* Value to indicate the gaps between the partitions should be exposed
+	 */
+	uint8_t expose_gaps;
+
+	/* The libvsmbr input volume
+	 */
+	libvsmbr_volume_t *input_volume;
+
+	/* The libbfio input file IO handle, used to read the gaps
+	 */
+	libbfio_handle_t *input_file_io_handle;
+
+	/* The file entries
+	 */
+	mount_file_entry_t **file_entries;
+
+	/* The number of file entries
+	 */
+	int number_of_file_entries;
+
+	/* The cache blocks
+	 */
+	mount_cache_block_t **cache_blocks;
+
+	/* The number of cache blocks
+	 */
+	int number_of_cache_blocks;
+
+	/* The number of read requests
+	 */
+	uint64_t number_of_read_requests;
+
+	/* The number of bytes read
+	 */
+	uint64_t number_of_bytes_read;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The statistics mutex
+	 */
+	libcthreads_mutex_t *statistics_mutex;
+#endif
+
+	/* The mount time
+	 */
+	int64_t mount_time;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int mount_cache_block_initialize(
+     mount_cache_block_t **cache_block,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int mount_cache_block_free(
+     mount_cache_block_t **cache_block,
+     libcerror_error_t **error );
+
+int mount_handle_initialize(
+     mount_handle_t **mount_handle,
+     libcerror_error_t **error );
+
+int mount_handle_free(
+     mount_handle_t **mount_handle,
+     libcerror_error_t **error );
+
+int mount_handle_signal_abort(
+     mount_handle_t *mount_handle,
+     libcerror_error_t **error );
+
+int mount_handle_set_bytes_per_sector(
+     mount_handle_t *mount_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int mount_handle_open(
+     mount_handle_t *mount_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int mount_handle_close(
+     mount_handle_t *mount_handle,
+     libcerror_error_t **error );
+
+int mount_handle_append_file_entry(
+     mount_handle_t *mount_handle,
+     libvsmbr_partition_t *partition,
+     int partition_number,
+     int gap_number,
+     off64_t volume_offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int mount_handle_free_file_entries(
+     mount_handle_t *mount_handle,
+     libcerror_error_t **error );
+
+int mount_handle_build_file_entries(
+     mount_handle_t *mount_handle,
+     libcerror_error_t **error );
+
+int mount_handle_get_number_of_file_entries(
+     mount_handle_t *mount_handle,
+     int *number_of_file_entries,
+     libcerror_error_t **error );
+
+int mount_handle_get_file_entry_by_index(
+     mount_handle_t *mount_handle,
+     int file_entry_index,
+     mount_file_entry_t **file_entry,
+     libcerror_error_t **error );
+
+int mount_handle_get_file_entry_by_path(
+     mount_handle_t *mount_handle,
+     const char *path,
+     mount_file_entry_t **file_entry,
+     libcerror_error_t **error );
+
+ssize_t mount_handle_read_buffer_at_offset(
+         mount_handle_t *mount_handle,
+         mount_file_entry_t *file_entry,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int mount_handle_statistics_fprint(
+     mount_handle_t *mount_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MOUNT_HANDLE_H ) */
+
@@ -0,0 +1,440 @@
+/*
+ * Exports the partitions of a Master Boot Record (MBR) volume system.
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "export_handle.h"
+#include "vsmbrtools_getopt.h"
+#include "vsmbrtools_libcerror.h"
+#include "vsmbrtools_libclocale.h"
+#include "vsmbrtools_libcnotify.h"
+#include "vsmbrtools_libvsmbr.h"
+#include "vsmbrtools_output.h"
+#include "vsmbrtools_signal.h"
+#include "vsmbrtools_unused.h"
+
+export_handle_t *vsmbrexport_export_handle = NULL;
+int vsmbrexport_abort                  = 0;
+
+/* Signal handler for vsmbrexport
+ */
+void vsmbrexport_signal_handler(
+      vsmbrtools_signal_t signal VSMBRTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "vsmbrexport_signal_handler";
+
+	VSMBRTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	vsmbrexport_abort = 1;
+
+	if( vsmbrexport_export_handle != NULL )
+	{
+		if( export_handle_signal_abort(
+		     vsmbrexport_export_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal export handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use vsmbrexport to export the partitions of a Master Boot Record (MBR) volume system to raw image files.";
+
+	vsmbrtools_option_t options[ ] = {
+		{ 'b', "bytes_per_sector", "specify the number of bytes per sector (default is 512). Use this to override the automatic bytes per sector detection" },
+		{ 'g', NULL, "export the gaps between the partitions as well, the gap number is appended to the target path" },
+		{ 'h', NULL, "shows this help" },
+		{ 'j', "jobs", "specify the number of concurrent writing jobs (threads) (default is 1). If more than 1 job is used or the gaps are exported the partitions are read in order of volume offset and written concurrently" },
+		{ 'p', "partition_number", "specify the number of the partition to export, where the first partition is 1 (default is all). If all partitions are exported the partition number is appended to the target path" },
+		{ 't', "target", "specify the target path of the exported partition image" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "source", "the source image" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libvsmbr_error_t *error                     = NULL;
+	system_character_t *option_bytes_per_sector = NULL;
+	system_character_t *option_jobs             = NULL;
+	system_character_t *option_partition_number = NULL;
+	system_character_t *option_target_path      = NULL;
+	system_character_t *source                  = NULL;
+	char *program                               = "vsmbrexport";
+	system_integer_t option                     = 0;
+	int number_of_options                       = (int) ( sizeof( options ) / sizeof( vsmbrtools_option_t ) );
+	int result                                  = 0;
+	int verbose                                 = 0;
+	uint8_t export_gaps                         = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "vsmbrtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( vsmbrtools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	vsmbrtools_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( vsmbrtools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = vsmbrtools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				vsmbrtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'b':
+				option_bytes_per_sector = optarg;
+
+				break;
+
+			case (system_integer_t) 'g':
+				export_gaps = 1;
+
+				break;
+
+			case (system_integer_t) 'h':
+				vsmbrtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'j':
+				option_jobs = optarg;
+
+				break;
+
+			case (system_integer_t) 'p':
+				option_partition_number = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_target_path = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				vsmbrtools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source image.\n" );
+
+		vsmbrtools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	if( option_target_path == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Missing target path.\n" );
+
+		vsmbrtools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+
+	libcnotify_verbose_set(
+	 verbose );
+	libvsmbr_notify_set_stream(
+	 stderr,
+	 NULL );
+	libvsmbr_notify_set_verbose(
+	 verbose );
+
+	if( export_handle_initialize(
+	     &vsmbrexport_export_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize export handle.\n" );
+
+		goto on_error;
+	}
+#if defined( __clang_analyzer__ )
+	__builtin_assume( vsmbrexport_export_handle != NULL );
+#endif
+	if( option_bytes_per_sector != NULL )
+	{
+		result = export_handle_set_bytes_per_sector(
+			  vsmbrexport_export_handle,
+			  option_bytes_per_sector,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set bytes per sector.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported bytes per sector defaulting to: %" PRIu32 ".\n",
+			 vsmbrexport_export_handle->bytes_per_sector );
+		}
+	}
+	if( option_partition_number != NULL )
+	{
+		if( export_handle_set_partition_number(
+		     vsmbrexport_export_handle,
+		     option_partition_number,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported partition number: %" PRIs_SYSTEM ".\n",
+			 option_partition_number );
+
+			goto on_error;
+		}
+	}
+	if( option_jobs != NULL )
+	{
+		if( export_handle_set_number_of_threads(
+		     vsmbrexport_export_handle,
+		     option_jobs,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of jobs: %" PRIs_SYSTEM ".\n",
+			 option_jobs );
+
+			goto on_error;
+		}
+	}
+	vsmbrexport_export_handle->export_gaps = export_gaps;
+
+	if( export_handle_set_target_path(
+	     vsmbrexport_export_handle,
+	     option_target_path,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set target path.\n" );
+
+		goto on_error;
+	}
+	if( export_handle_open_input(
+	     vsmbrexport_export_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	if( export_handle_export_partitions(
+	     vsmbrexport_export_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to export partitions.\n" );
+
+		goto on_error;
+	}
+	if( vsmbrexport_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Export aborted.\n" );
+	}
+	if( export_handle_close_input(
+	     vsmbrexport_export_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close export handle.\n" );
+
+		goto on_error;
+	}
+	if( export_handle_free(
+	     &vsmbrexport_export_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free export handle.\n" );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( vsmbrexport_export_handle != NULL )
+	{
+		export_handle_free(
+		 &vsmbrexport_export_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
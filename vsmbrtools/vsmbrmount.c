@@ -0,0 +1,620 @@
+/*
+ * Mounts a Master Boot Record (MBR) volume system.
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "mount_fuse.h"
+#include "mount_handle.h"
+#include "vsmbrtools_getopt.h"
+#include "vsmbrtools_libcerror.h"
+#include "vsmbrtools_libclocale.h"
+#include "vsmbrtools_libcnotify.h"
+#include "vsmbrtools_libvsmbr.h"
+#include "vsmbrtools_output.h"
+#include "vsmbrtools_signal.h"
+#include "vsmbrtools_unused.h"
+
+/* The FUSE options used for every mount, the mounted data is read-only
+ * and large read requests are allowed to reduce the number of requests
+ */
+#define VSMBRMOUNT_FUSE_OPTIONS		"ro,kernel_cache,max_read=1048576"
+
+mount_handle_t *vsmbrmount_mount_handle = NULL;
+int vsmbrmount_abort                    = 0;
+
+/* Signal handler for vsmbrmount
+ */
+void vsmbrmount_signal_handler(
+      vsmbrtools_signal_t signal VSMBRTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "vsmbrmount_signal_handler";
+
+	VSMBRTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	vsmbrmount_abort = 1;
+
+	if( vsmbrmount_mount_handle != NULL )
+	{
+		if( mount_handle_signal_abort(
+		     vsmbrmount_mount_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal mount handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use vsmbrmount to mount the partitions of a Master Boot Record (MBR) volume system as read-only files.";
+
+	vsmbrtools_option_t options[ ] = {
+		{ 'b', "bytes_per_sector", "specify the number of bytes per sector (default is 512). Use this to override the automatic bytes per sector detection" },
+		{ 'g', NULL, "expose the gaps between the partitions as well, as gap1, gap2, etc." },
+		{ 'h', NULL, "shows this help" },
+		{ 'v', NULL, "verbose output to stderr, while vsmbrmount will remain running in the foreground and print the read statistics when unmounted" },
+		{ 'V', NULL, "print version" },
+		{ 'X', "extended_options", "extended options to pass to sub system" },
+		{ 0, "image", "the source image" },
+		{ 0, "mount_point", "the directory to serve as mount point" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libvsmbr_error_t *error                     = NULL;
+	system_character_t *mount_point             = NULL;
+	system_character_t *option_bytes_per_sector = NULL;
+	system_character_t *option_extended_options = NULL;
+	system_character_t *source                  = NULL;
+	char *program                               = "vsmbrmount";
+	system_integer_t option                     = 0;
+	int number_of_options                       = (int) ( sizeof( options ) / sizeof( vsmbrtools_option_t ) );
+	int verbose                                 = 0;
+	uint8_t expose_gaps                         = 0;
+
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
+	struct fuse_operations vsmbrmount_fuse_operations;
+
+	struct fuse_args vsmbrmount_fuse_arguments = FUSE_ARGS_INIT(0, NULL);
+	struct fuse *vsmbrmount_fuse_handle        = NULL;
+	int result                                 = 0;
+
+#if !defined( HAVE_LIBFUSE3 )
+	struct fuse_chan *vsmbrmount_fuse_channel  = NULL;
+#endif
+#endif /* defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE ) */
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "vsmbrtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( vsmbrtools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	vsmbrtools_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( vsmbrtools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = vsmbrtools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				vsmbrtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'b':
+				option_bytes_per_sector = optarg;
+
+				break;
+
+			case (system_integer_t) 'g':
+				expose_gaps = 1;
+
+				break;
+
+			case (system_integer_t) 'h':
+				vsmbrtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				vsmbrtools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'X':
+				option_extended_options = optarg;
+
+				break;
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source image.\n" );
+
+		vsmbrtools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind++ ];
+
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing mount point.\n" );
+
+		vsmbrtools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	mount_point = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libvsmbr_notify_set_stream(
+	 stderr,
+	 NULL );
+	libvsmbr_notify_set_verbose(
+	 verbose );
+
+	if( mount_handle_initialize(
+	     &vsmbrmount_mount_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize mount handle.\n" );
+
+		goto on_error;
+	}
+#if defined( __clang_analyzer__ )
+	__builtin_assume( vsmbrmount_mount_handle != NULL );
+#endif
+	if( option_bytes_per_sector != NULL )
+	{
+		if( mount_handle_set_bytes_per_sector(
+		     vsmbrmount_mount_handle,
+		     option_bytes_per_sector,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported bytes per sector: %" PRIs_SYSTEM ".\n",
+			 option_bytes_per_sector );
+
+			goto on_error;
+		}
+	}
+	vsmbrmount_mount_handle->expose_gaps = expose_gaps;
+
+	if( mount_handle_open(
+	     vsmbrmount_mount_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
+	/* This argument is required but ignored
+	 */
+	if( fuse_opt_add_arg(
+	     &vsmbrmount_fuse_arguments,
+	     "" ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable add fuse arguments.\n" );
+
+		goto on_error;
+	}
+	if( fuse_opt_add_arg(
+	     &vsmbrmount_fuse_arguments,
+	     "-o" ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable add fuse arguments.\n" );
+
+		goto on_error;
+	}
+	if( fuse_opt_add_arg(
+	     &vsmbrmount_fuse_arguments,
+	     VSMBRMOUNT_FUSE_OPTIONS ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable add fuse arguments.\n" );
+
+		goto on_error;
+	}
+	if( option_extended_options != NULL )
+	{
+		if( fuse_opt_add_arg(
+		     &vsmbrmount_fuse_arguments,
+		     "-o" ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable add fuse arguments.\n" );
+
+			goto on_error;
+		}
+		if( fuse_opt_add_arg(
+		     &vsmbrmount_fuse_arguments,
+		     option_extended_options ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable add fuse arguments.\n" );
+
+			goto on_error;
+		}
+	}
+	if( memory_set(
+	     &vsmbrmount_fuse_operations,
+	     0,
+	     sizeof( struct fuse_operations ) ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to clear fuse operations.\n" );
+
+		goto on_error;
+	}
+	vsmbrmount_fuse_operations.init       = &mount_fuse_init;
+	vsmbrmount_fuse_operations.open       = &mount_fuse_open;
+	vsmbrmount_fuse_operations.read       = &mount_fuse_read;
+	vsmbrmount_fuse_operations.release    = &mount_fuse_release;
+	vsmbrmount_fuse_operations.opendir    = &mount_fuse_opendir;
+	vsmbrmount_fuse_operations.readdir    = &mount_fuse_readdir;
+	vsmbrmount_fuse_operations.releasedir = &mount_fuse_releasedir;
+	vsmbrmount_fuse_operations.getattr    = &mount_fuse_getattr;
+
+#if defined( HAVE_LIBFUSE3 )
+	vsmbrmount_fuse_handle = fuse_new(
+	                          &vsmbrmount_fuse_arguments,
+	                          &vsmbrmount_fuse_operations,
+	                          sizeof( struct fuse_operations ),
+	                          vsmbrmount_mount_handle );
+
+	if( vsmbrmount_fuse_handle == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create fuse handle.\n" );
+
+		goto on_error;
+	}
+	result = fuse_mount(
+	          vsmbrmount_fuse_handle,
+	          mount_point );
+
+	if( result != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to fuse mount file system.\n" );
+
+		goto on_error;
+	}
+#else
+	vsmbrmount_fuse_channel = fuse_mount(
+	                           mount_point,
+	                           &vsmbrmount_fuse_arguments );
+
+	if( vsmbrmount_fuse_channel == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create fuse channel.\n" );
+
+		goto on_error;
+	}
+	vsmbrmount_fuse_handle = fuse_new(
+	                          vsmbrmount_fuse_channel,
+	                          &vsmbrmount_fuse_arguments,
+	                          &vsmbrmount_fuse_operations,
+	                          sizeof( struct fuse_operations ),
+	                          vsmbrmount_mount_handle );
+
+	if( vsmbrmount_fuse_handle == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create fuse handle.\n" );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_LIBFUSE3 ) */
+
+	if( verbose == 0 )
+	{
+		if( fuse_daemonize(
+		     0 ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to daemonize fuse.\n" );
+
+			goto on_error;
+		}
+	}
+	/* Let fuse handle SIGINT, SIGTERM and SIGHUP so that the loop ends
+	 * and the file system is unmounted
+	 */
+	if( fuse_set_signal_handlers(
+	     fuse_get_session(
+	      vsmbrmount_fuse_handle ) ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set fuse signal handlers.\n" );
+
+		goto on_error;
+	}
+	/* Read requests are handled concurrently by multiple threads
+	 */
+#if defined( HAVE_LIBFUSE3 )
+	result = fuse_loop_mt(
+	          vsmbrmount_fuse_handle,
+	          0 );
+#else
+	result = fuse_loop_mt(
+	          vsmbrmount_fuse_handle );
+#endif
+	fuse_remove_signal_handlers(
+	 fuse_get_session(
+	  vsmbrmount_fuse_handle ) );
+
+#if defined( HAVE_LIBFUSE3 )
+	fuse_unmount(
+	 vsmbrmount_fuse_handle );
+#else
+	fuse_unmount(
+	 mount_point,
+	 vsmbrmount_fuse_channel );
+
+	vsmbrmount_fuse_channel = NULL;
+#endif
+	fuse_destroy(
+	 vsmbrmount_fuse_handle );
+
+	vsmbrmount_fuse_handle = NULL;
+
+	fuse_opt_free_args(
+	 &vsmbrmount_fuse_arguments );
+
+	if( result != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to run fuse loop.\n" );
+
+		goto on_error;
+	}
+	if( verbose != 0 )
+	{
+		if( mount_handle_statistics_fprint(
+		     vsmbrmount_mount_handle,
+		     stderr,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print statistics.\n" );
+
+			goto on_error;
+		}
+	}
+	if( mount_handle_close(
+	     vsmbrmount_mount_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close mount handle.\n" );
+
+		goto on_error;
+	}
+	if( mount_handle_free(
+	     &vsmbrmount_mount_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free mount handle.\n" );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+#else
+	VSMBRTOOLS_UNREFERENCED_PARAMETER( option_extended_options )
+
+	fprintf(
+	 stderr,
+	 "No sub system to mount MBR volume system on: %" PRIs_SYSTEM ".\n",
+	 mount_point );
+
+	goto on_error;
+
+#endif /* defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE ) */
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
+	if( vsmbrmount_fuse_handle != NULL )
+	{
+		fuse_destroy(
+		 vsmbrmount_fuse_handle );
+	}
+#if !defined( HAVE_LIBFUSE3 )
+	if( vsmbrmount_fuse_channel != NULL )
+	{
+		fuse_unmount(
+		 mount_point,
+		 vsmbrmount_fuse_channel );
+	}
+#endif
+	fuse_opt_free_args(
+	 &vsmbrmount_fuse_arguments );
+#endif
+	if( vsmbrmount_mount_handle != NULL )
+	{
+		mount_handle_free(
+		 &vsmbrmount_mount_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+